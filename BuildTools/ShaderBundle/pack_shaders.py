@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+#
+# Packs shader files into a C++ header with a compressed bundle that is read by
+# ShaderSourceBundle (Utilities/interface/ShaderSourceBundle.hpp).
+#
+# Every file is compressed independently with a byte-oriented LZ77 scheme, so that files
+# can be decompressed on first access. The file index is sorted by name for binary search.
+#
+# Usage: pack_shaders.py <file list> <output header>
+#
+# The file list contains one shader path per line.
+
+import os
+import sys
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+HASH_CHAIN_DEPTH = 32
+
+# Files shorter than this are stored as a single literal run
+MIN_COMPRESSED_SIZE = 16
+
+
+def compute_hash(data):
+    """FNV-1a hash, must match ShaderSourceBundle::ComputeHash."""
+    h = 2166136261
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def write_sequence(out, literals, offset, match_length):
+    """Writes a sequence of literals followed by a match. The last sequence has no match."""
+    lit_len = len(literals)
+    match_code = match_length - MIN_MATCH if match_length > 0 else 0
+    token = (min(lit_len, 15) << 4) | min(match_code, 15)
+    out.append(token)
+    if lit_len >= 15:
+        write_length(out, lit_len - 15)
+    out.extend(literals)
+    if match_length > 0:
+        out.append(offset & 0xFF)
+        out.append(offset >> 8)
+        if match_code >= 15:
+            write_length(out, match_code - 15)
+
+
+def compress(data):
+    out = bytearray()
+    size = len(data)
+    chains = {}
+    literal_start = 0
+    pos = 0
+    while size >= MIN_COMPRESSED_SIZE and pos + MIN_MATCH <= size:
+        key = data[pos:pos + MIN_MATCH]
+        candidates = chains.get(key)
+        best_length = 0
+        best_offset = 0
+        if candidates:
+            for candidate in reversed(candidates):
+                offset = pos - candidate
+                if offset > MAX_OFFSET:
+                    break
+                length = MIN_MATCH
+                while pos + length < size and data[candidate + length] == data[pos + length]:
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_offset = offset
+            if len(candidates) >= HASH_CHAIN_DEPTH:
+                del candidates[0]
+            candidates.append(pos)
+        else:
+            chains[key] = [pos]
+
+        if best_length >= MIN_MATCH:
+            write_sequence(out, data[literal_start:pos], best_offset, best_length)
+            # Register the positions inside the match so that later data can refer to them
+            for p in range(pos + 1, min(pos + best_length, size - MIN_MATCH + 1)):
+                chain = chains.setdefault(data[p:p + MIN_MATCH], [])
+                if len(chain) >= HASH_CHAIN_DEPTH:
+                    del chain[0]
+                chain.append(p)
+            pos += best_length
+            literal_start = pos
+        else:
+            pos += 1
+
+    write_sequence(out, data[literal_start:], 0, 0)
+    return out
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: pack_shaders.py <file list> <output header>")
+        return 1
+
+    with open(sys.argv[1], "r") as list_file:
+        paths = [line.strip() for line in list_file if line.strip()]
+
+    files = {}
+    for path in paths:
+        name = os.path.basename(path)
+        if name in files:
+            print("Duplicate shader file name: " + name)
+            return 1
+        with open(path, "rb") as src:
+            files[name] = src.read()
+
+    names = sorted(files.keys(), key=lambda n: n.encode("utf-8"))
+
+    blob = bytearray()
+    index = []
+    for name in names:
+        data = files[name]
+        compressed = compress(data)
+        index.append((name, len(blob), len(compressed), len(data), compute_hash(data)))
+        blob.extend(compressed)
+
+    lines = [
+        "// This file is generated by pack_shaders.py. Do not edit.",
+        "// Uncompressed size: {} bytes, compressed size: {} bytes".format(sum(len(d) for d in files.values()), len(blob)),
+        "",
+        "static constexpr ShaderSourceBundle::FileInfo g_ShaderBundleFiles[] = {",
+    ]
+    for name, offset, compressed_size, size, hash_value in index:
+        lines.append('    {{"{}", {}, {}, {}, 0x{:08X}u}},'.format(name, offset, compressed_size, size, hash_value))
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr Uint8 g_ShaderBundleData[] = {")
+    for i in range(0, len(blob), 20):
+        lines.append("    " + ", ".join("0x{:02X}".format(b) for b in blob[i:i + 20]) + ",")
+    lines.append("};")
+    lines.append("")
+
+    with open(sys.argv[2], "w") as out:
+        out.write("\n".join(lines))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
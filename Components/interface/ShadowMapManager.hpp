@@ -161,10 +161,44 @@ public:
         float4x4 WorldToLightProjSpace;
     };
 
+    /// Shadow map properties used to distribute cascades.
+    struct CascadeTargetInfo
+    {
+        /// Shadow map width.
+        Uint32 Width = 0;
+
+        /// Shadow map height.
+        Uint32 Height = 0;
+
+        /// Number of shadow cascades, must not be 0.
+        Uint32 NumCascades = 0;
+
+        /// Shadow mode (see SHADOW_MODE_* defines in BasicStructures.fxh).
+        int ShadowMode = SHADOW_MODE_PCF;
+
+        /// Whether the filterable shadow map uses 32-bit format.
+        bool Is32BitFilterableFmt = false;
+
+        /// Whether the device uses OpenGL depth range.
+        bool IsGL = false;
+
+        /// Normalized device coordinates attributes of the device.
+        NDCAttribs NDC = {0.f, 1.f, -0.5f};
+    };
+
     /// Distributes shadow cascades.
     void DistributeCascades(const DistributeCascadeInfo& Info,
                             ShadowMapAttribs&            shadowMapAttribs);
 
+    /// Distributes shadow cascades for the shadow map described by Target.
+
+    /// This method does not require a render device and writes the cascade
+    /// transforms to Transforms instead of the manager's state.
+    static void DistributeCascades(const DistributeCascadeInfo&    Info,
+                                   const CascadeTargetInfo&        Target,
+                                   ShadowMapAttribs&               shadowMapAttribs,
+                                   std::vector<CascadeTransforms>& Transforms);
+
     /// Converts the shadow map to filterable format.
     void ConvertToFilterable(IDeviceContext* pCtx, const ShadowMapAttribs& ShadowAttribs);
 
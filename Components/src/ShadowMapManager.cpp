@@ -134,27 +134,51 @@ void ShadowMapManager::Initialize(IRenderDevice* pDevice, IRenderStateCache* pSt
 void ShadowMapManager::DistributeCascades(const DistributeCascadeInfo& Info,
                                           ShadowMapAttribs&            ShadowAttribs)
 {
-    VERIFY(Info.pCameraView, "Camera view matrix must not be null");
-    VERIFY(Info.pCameraProj, "Camera projection matrix must not be null");
-    VERIFY(Info.pLightDir, "Light direction must not be null");
     VERIFY(m_pDevice, "Shadow map manager is not initialized");
 
     const RenderDeviceInfo& DevInfo = m_pDevice->GetDeviceInfo();
-    const bool              IsGL    = DevInfo.IsGLDevice();
     const TextureDesc&      SMDesc  = m_pShadowMapSRV->GetTexture()->GetDesc();
 
-    float2 f2ShadowMapSize = float2(static_cast<float>(SMDesc.Width), static_cast<float>(SMDesc.Height));
+    CascadeTargetInfo Target;
+    Target.Width       = SMDesc.Width;
+    Target.Height      = SMDesc.Height;
+    Target.NumCascades = SMDesc.ArraySize;
+    Target.ShadowMode  = m_ShadowMode;
+    Target.IsGL        = DevInfo.IsGLDevice();
+    Target.NDC         = DevInfo.GetNDCAttribs();
+    if (m_ShadowMode == SHADOW_MODE_VSM || m_ShadowMode == SHADOW_MODE_EVSM2 || m_ShadowMode == SHADOW_MODE_EVSM4)
+    {
+        VERIFY_EXPR(m_pFilterableShadowMapSRV);
+        const TextureDesc& FilterableSMDesc = m_pFilterableShadowMapSRV->GetTexture()->GetDesc();
+        Target.Is32BitFilterableFmt         = FilterableSMDesc.Format == TEX_FORMAT_RGBA32_FLOAT || FilterableSMDesc.Format == TEX_FORMAT_RG32_FLOAT;
+    }
+
+    DistributeCascades(Info, Target, ShadowAttribs, m_CascadeTransforms);
+}
+
+void ShadowMapManager::DistributeCascades(const DistributeCascadeInfo&    Info,
+                                          const CascadeTargetInfo&        Target,
+                                          ShadowMapAttribs&               ShadowAttribs,
+                                          std::vector<CascadeTransforms>& Transforms)
+{
+    VERIFY(Info.pCameraView, "Camera view matrix must not be null");
+    VERIFY(Info.pCameraProj, "Camera projection matrix must not be null");
+    VERIFY(Info.pLightDir, "Light direction must not be null");
+    VERIFY(Target.NumCascades > 0 && Target.NumCascades <= MAX_CASCADES, "Invalid number of cascades");
+
+    const bool IsGL       = Target.IsGL;
+    const int  ShadowMode = Target.ShadowMode;
+
+    float2 f2ShadowMapSize = float2(static_cast<float>(Target.Width), static_cast<float>(Target.Height));
 
     ShadowAttribs.f4ShadowMapDim.x = f2ShadowMapSize.x;
     ShadowAttribs.f4ShadowMapDim.y = f2ShadowMapSize.y;
     ShadowAttribs.f4ShadowMapDim.z = 1.f / f2ShadowMapSize.x;
     ShadowAttribs.f4ShadowMapDim.w = 1.f / f2ShadowMapSize.y;
 
-    if (m_ShadowMode == SHADOW_MODE_VSM || m_ShadowMode == SHADOW_MODE_EVSM2 || m_ShadowMode == SHADOW_MODE_EVSM4)
+    if (ShadowMode == SHADOW_MODE_VSM || ShadowMode == SHADOW_MODE_EVSM2 || ShadowMode == SHADOW_MODE_EVSM4)
     {
-        VERIFY_EXPR(m_pFilterableShadowMapSRV);
-        const TextureDesc& FilterableSMDesc = m_pFilterableShadowMapSRV->GetTexture()->GetDesc();
-        ShadowAttribs.bIs32BitEVSM          = FilterableSMDesc.Format == TEX_FORMAT_RGBA32_FLOAT || FilterableSMDesc.Format == TEX_FORMAT_RG32_FLOAT;
+        ShadowAttribs.bIs32BitEVSM = Target.Is32BitFilterableFmt;
     }
 
     float3 LightSpaceX, LightSpaceY, LightSpaceZ;
@@ -179,11 +203,11 @@ void ShadowMapManager::DistributeCascades(const DistributeCascadeInfo& Info,
     for (int i = 0; i < MAX_CASCADES; ++i)
         ShadowAttribs.fCascadeCamSpaceZEnd[i] = +FLT_MAX;
 
-    int iNumCascades           = SMDesc.ArraySize;
+    int iNumCascades           = static_cast<int>(Target.NumCascades);
     ShadowAttribs.iNumCascades = iNumCascades;
     ShadowAttribs.fNumCascades = static_cast<float>(iNumCascades);
 
-    m_CascadeTransforms.resize(iNumCascades);
+    Transforms.resize(iNumCascades);
     for (int iCascade = 0; iCascade < iNumCascades; ++iCascade)
     {
         CascadeAttribs& CurrCascade = ShadowAttribs.Cascades[iCascade];
@@ -260,7 +284,7 @@ void ShadowMapManager::DistributeCascades(const DistributeCascadeInfo& Info,
         }
 
         float2 f2FixedMargin = (Info.SnapCascades ? float2(0.5f, 0.5f) : float2(0, 0));
-        if (m_ShadowMode == SHADOW_MODE_VSM || m_ShadowMode == SHADOW_MODE_EVSM2 || m_ShadowMode == SHADOW_MODE_EVSM4)
+        if (ShadowMode == SHADOW_MODE_VSM || ShadowMode == SHADOW_MODE_EVSM2 || ShadowMode == SHADOW_MODE_EVSM4)
         {
             f2FixedMargin.x += static_cast<float>(ShadowAttribs.iMaxAnisotropy) / 2.f;
             f2FixedMargin.y += static_cast<float>(ShadowAttribs.iMaxAnisotropy) / 2.f;
@@ -378,14 +402,14 @@ void ShadowMapManager::DistributeCascades(const DistributeCascadeInfo& Info,
         float4x4 ScaledBiasMatrix = float4x4::Translation(CurrCascade.f4LightSpaceScaledBias.x, CurrCascade.f4LightSpaceScaledBias.y, CurrCascade.f4LightSpaceScaledBias.z);
 
         // Note: bias is applied after scaling!
-        float4x4& CascadeProjMatr = m_CascadeTransforms[iCascade].Proj;
+        float4x4& CascadeProjMatr = Transforms[iCascade].Proj;
         CascadeProjMatr           = ScaleMatrix * ScaledBiasMatrix;
 
         // Adjust the world to light space transformation matrix
-        float4x4& WorldToLightProjSpaceMatr = m_CascadeTransforms[iCascade].WorldToLightProjSpace;
+        float4x4& WorldToLightProjSpaceMatr = Transforms[iCascade].WorldToLightProjSpace;
         WorldToLightProjSpaceMatr           = WorldToLightViewSpaceMatr * CascadeProjMatr;
 
-        const NDCAttribs& NDC = DevInfo.GetNDCAttribs();
+        const NDCAttribs& NDC = Target.NDC;
 
         float4x4 ProjToUVScale = float4x4::Scale(0.5f, NDC.YtoVScale, NDC.ZtoDepthScale);
         float4x4 ProjToUVBias  = float4x4::Translation(0.5f, 0.5f, NDC.GetZtoDepthBias());
@@ -608,6 +608,7 @@ void HnBeginFrameTask::UpdateFrameConstants(IDeviceContext* pCtx,
                     DstShadowMap.UVScale        = pShadowMapInfo->UVScale;
                     DstShadowMap.UVBias         = pShadowMapInfo->UVBias;
                     DstShadowMap.ShadowMapSlice = pShadowMapInfo->ShadowMapSlice;
+                    DstShadowMap.CascadeCount   = 1;
                 }
                 else
                 {
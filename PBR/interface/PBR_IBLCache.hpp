@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/GraphicsTypes.h"
+#include "PBR_IrradianceSH.hpp"
+
+namespace Diligent
+{
+
+/// Content-keyed cache of precomputed image-based lighting data.
+///
+/// Every entry keeps the irradiance spherical harmonics and the texel data of the irradiance cube
+/// and the prefiltered environment map of one environment map, so that PBR_Renderer::PrecomputeCubemaps()
+/// can upload the data instead of recomputing it on the GPU. Entries are identified by the content key
+/// of the environment map, see ComputeContentKey().
+class PBR_IBLCache
+{
+public:
+    /// Texel data of all mip levels of a cube map.
+    struct CubemapData
+    {
+        TEXTURE_FORMAT Format    = TEX_FORMAT_UNKNOWN;
+        Uint32         TexelSize = 0;
+        Uint32         Dimension = 0;
+        Uint32         MipLevels = 0;
+
+        /// Texel data ordered by face and then by mip level. Rows are tightly packed.
+        std::vector<Uint8> Data;
+
+        Uint32 GetMipDimension(Uint32 Mip) const { return std::max(Dimension >> Mip, 1u); }
+        size_t GetRowSize(Uint32 Mip) const { return size_t{GetMipDimension(Mip)} * TexelSize; }
+
+        /// Returns the offset of the subresource in Data.
+        size_t GetSubresourceOffset(Uint32 Face, Uint32 Mip) const;
+
+        /// Returns the data size that is required by the format, dimension, and mip levels.
+        size_t GetRequiredDataSize() const { return GetSubresourceOffset(6, 0); }
+
+        bool IsValid() const
+        {
+            return Format != TEX_FORMAT_UNKNOWN && TexelSize > 0 && Dimension > 0 && MipLevels > 0 && Data.size() == GetRequiredDataSize();
+        }
+    };
+
+    /// Precomputed data of one environment map.
+    struct Entry
+    {
+        PBR_IrradianceSH IrradianceSH;
+        CubemapData      IrradianceCube;
+        CubemapData      PrefilteredEnvMap;
+    };
+
+    /// Cache statistics.
+    struct Statistics
+    {
+        /// The number of entries found in memory.
+        Uint32 MemoryHits = 0;
+
+        /// The number of entries loaded from the on-disk mirror.
+        Uint32 DiskHits = 0;
+
+        /// The number of keys that were not found.
+        Uint32 Misses = 0;
+    };
+
+    /// \param [in] MirrorDirectory - Optional directory where the entries are mirrored on disk,
+    ///                               so that they are reused by the next sessions.
+    explicit PBR_IBLCache(const char* MirrorDirectory = nullptr);
+
+    /// Computes the content key of the environment map data, for example the texel data or the file contents.
+    ///
+    /// \remarks    The key is never 0.
+    static Uint64 ComputeContentKey(const void* pData, size_t Size);
+
+    /// Returns the entry for the key, or null if the entry is neither in memory nor in the on-disk mirror.
+    ///
+    /// \remarks    The returned pointer stays valid until the entry is replaced, or the cache is cleared or destroyed.
+    const Entry* Find(Uint64 Key);
+
+    /// Adds the entry to the cache and the on-disk mirror. An existing entry with the same key is replaced.
+    const Entry& Add(Uint64 Key, Entry&& NewEntry);
+
+    /// Serializes the entry into the binary format that is used by the on-disk mirror.
+    static void Serialize(Uint64 Key, const Entry& SrcEntry, std::vector<Uint8>& Data);
+
+    /// Deserializes the entry. Returns false if the data is invalid or was serialized with a different key.
+    static bool Deserialize(Uint64 Key, const void* pData, size_t Size, Entry& DstEntry);
+
+    void Clear();
+
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    std::string  GetMirrorFilePath(Uint64 Key) const;
+    const Entry* LoadFromMirror(Uint64 Key);
+    void         SaveToMirror(Uint64 Key, const Entry& SrcEntry) const;
+
+private:
+    const std::string m_MirrorDirectory;
+
+    std::unordered_map<Uint64, Entry> m_Entries;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
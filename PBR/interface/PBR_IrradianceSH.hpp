@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../DiligentCore/Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Diffuse irradiance represented by the first three bands (L2) of spherical harmonics.
+///
+/// The coefficients are projected from the environment radiance on the CPU and are convolved with
+/// the clamped cosine lobe and divided by PI, so that evaluating them gives the same value that is
+/// stored in the irradiance cube map computed by PBR_Renderer::PrecomputeCubemaps().
+struct PBR_IrradianceSH
+{
+    static constexpr Uint32 NumCoeffs = 9;
+
+    /// RGB coefficients of the basis functions in the following order:
+    /// Y00, Y1-1, Y10, Y11, Y2-2, Y2-1, Y20, Y21, Y22.
+    float3 Coeffs[NumCoeffs] = {};
+
+    /// Environment map image that is projected onto the spherical harmonics.
+    struct SourceImage
+    {
+        /// Texel data. Texels must contain linear RGB radiance in the first three components.
+        const void* pData = nullptr;
+
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+
+        /// Component type, must be VT_FLOAT32 or VT_FLOAT16.
+        VALUE_TYPE ValueType = VT_FLOAT32;
+
+        /// The number of components per texel, must be at least 3.
+        Uint32 NumComponents = 4;
+
+        /// Row stride in bytes. If 0, the rows are tightly packed.
+        size_t Stride = 0;
+    };
+
+    /// Projects a cube map onto the spherical harmonics.
+    ///
+    /// \param [in]  Faces - Cube map faces in the +X, -X, +Y, -Y, +Z, -Z order.
+    ///                      All faces must be square and have the same size.
+    /// \param [out] SH    - Projected irradiance.
+    ///
+    /// \return     true if the projection was successful, and false if the faces are invalid.
+    static bool ProjectCubemap(const SourceImage Faces[6], PBR_IrradianceSH& SH);
+
+    /// Projects an equirectangular (sphere) map onto the spherical harmonics.
+    ///
+    /// \remarks    The map uses the same layout as the sphere environment maps in
+    ///             PBR_Renderer::PrecomputeCubemaps(), see TransformDirectionToSphereMapUV().
+    static bool ProjectSphereMap(const SourceImage& Image, PBR_IrradianceSH& SH);
+
+    /// Returns the irradiance divided by PI for the given unit normal.
+    float3 Evaluate(const float3& N) const;
+};
+
+} // namespace Diligent
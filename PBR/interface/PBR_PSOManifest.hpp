@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "PBR_Renderer.hpp"
+
+namespace Diligent
+{
+
+/// List of PBR renderer pipeline permutations.
+///
+/// The manifest is recorded during a session, see PBR_Renderer::SetPSOManifest(), saved to a file,
+/// and used to pre-create the pipelines at startup of the next session, see PBR_Renderer::BeginPSOWarmUp().
+/// Entries are deduplicated and kept sorted by their serialized form, so that the manifest file does not
+/// depend on the order in which the pipelines were requested.
+class PBR_PSOManifest
+{
+public:
+    struct Entry
+    {
+        GraphicsPipelineDesc GraphicsDesc;
+        PBR_Renderer::PSOKey Key;
+    };
+
+    /// Adds the permutation to the manifest.
+    ///
+    /// \return     true if the permutation was added, and false if it is already in the manifest
+    ///             or can't be serialized because the graphics description uses an explicit render pass.
+    ///
+    /// \remarks    The input layout of the graphics description is ignored as it is defined by the renderer.
+    bool Add(const GraphicsPipelineDesc& GraphicsDesc, const PBR_Renderer::PSOKey& Key);
+
+    /// Returns the entries in their stable order.
+    const std::vector<Entry>& GetEntries() const { return m_Entries; }
+
+    size_t GetEntryCount() const { return m_Entries.size(); }
+
+    void Clear();
+
+    /// Writes the manifest to the data buffer.
+    void Serialize(std::vector<Uint8>& Data) const;
+
+    /// Adds the permutations of the serialized manifest to this manifest.
+    ///
+    /// \return     false if the data is not a valid manifest or was written by a different manifest version,
+    ///             in which case the manifest is not modified.
+    bool Deserialize(const void* pData, size_t Size);
+
+    bool Save(const char* FilePath) const;
+
+    /// Adds the permutations of the manifest file to this manifest.
+    /// Returns false if the file does not exist or is not a valid manifest.
+    bool Load(const char* FilePath);
+
+private:
+    // Serialized entries in the same order as m_Entries
+    std::vector<std::vector<Uint8>> m_Records;
+    std::vector<Entry>              m_Entries;
+};
+
+} // namespace Diligent
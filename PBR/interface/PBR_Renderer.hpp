@@ -30,6 +30,9 @@
 #include <unordered_set>
 #include <functional>
 #include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
 
 #include "../../../DiligentCore/Platforms/Basic/interface/DebugUtilities.hpp"
 #include "../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
@@ -39,6 +42,7 @@
 #include "../../../DiligentCore/Graphics/GraphicsTools/interface/ShaderMacroHelper.hpp"
 #include "../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
 #include "../../../DiligentCore/Common/interface/HashUtils.hpp"
+#include "../../Utilities/interface/ReadMostlyHashMap.hpp"
 
 namespace Diligent
 {
@@ -48,6 +52,10 @@ namespace HLSL
 struct PBRRendererShaderParameters;
 } // namespace HLSL
 
+class PBR_PSOManifest;
+class PBR_ShaderSourceCache;
+class PBR_IBLCache;
+
 class PBR_Renderer
 {
 public:
@@ -146,6 +154,14 @@ public:
         /// A pipeline state can use IBL only if this flag is set to true.
         bool EnableIBL = true;
 
+        /// Whether to evaluate diffuse IBL from the irradiance spherical harmonics
+        /// instead of the irradiance cube map.
+        ///
+        /// \remarks    When enabled, pipeline states read the coefficients from the constant
+        ///             buffer set by SetIBLResourceViews() and do not use the irradiance cube map.
+        ///             See CreateIrradianceSHBuffer() and PrecomputeCubemapsAttribs::pIrradianceSH.
+        bool UseIrradianceSH = false;
+
         /// Whether to use enable ambient occlusion.
         /// A pipeline state can use AO only if this flag is set to true.
         bool EnableAO = true;
@@ -195,6 +211,15 @@ public:
         /// A pipeline state can use shadows only if this flag is set to true.
         bool EnableShadows = false;
 
+        /// Whether to enable clustered forward lighting.
+        ///
+        /// \remarks    When enabled, the renderer adds light cluster resources to the
+        ///             resource signature (see SetLightClusterResources()), and pipeline
+        ///             states created with PSO_FLAG_USE_CLUSTERED_LIGHTS read point and spot
+        ///             lights from the per-cluster light lists instead of the frame attributes.
+        ///             The number of clustered lights is only limited by the size of the buffers.
+        bool EnableClusteredLighting = false;
+
         /// Whether to allow hot shader reload.
         ///
         /// \remarks    When hot shader reload is enabled, the renderer will need
@@ -202,6 +227,21 @@ public:
         ///             This adds some overhead and should only be used in development mode.
         bool AllowHotShaderReload = false;
 
+        /// Whether to cache shader sources with expanded includes.
+        ///
+        /// \remarks    Shaders of different pipeline permutations are created from the same
+        ///             files and only differ in macros and generated includes. When this option
+        ///             is enabled, the includes of every combination of the shader file and
+        ///             generated includes are expanded once, and the expanded source is passed
+        ///             to the compiler. The option is ignored when hot shader reload is allowed.
+        bool CacheShaderSources = false;
+
+        /// Optional directory where the shader source cache is mirrored on disk.
+        ///
+        /// \remarks    Only used when CacheShaderSources is true. The directory must be cleared
+        ///             when the shader files change, see PBR_ShaderSourceCache.
+        const char* ShaderSourceCacheDirectory = nullptr;
+
         /// Whether shader matrices are laid out in row-major order in GPU memory.
         ///
         /// \remarks    By default, shader matrices are laid out in column-major order
@@ -451,6 +491,7 @@ public:
         Main,
         Shadow,
         OITLayers,
+        DepthOnly,
         Count
     };
 
@@ -501,6 +542,9 @@ public:
                                                     TEXTURE_FORMAT  Format    = PrefilteredEnvMapFmt,
                                                     Uint32          Dimension = PrefilteredEnvMapDim) const;
 
+    /// Creates a constant buffer for the irradiance spherical harmonics (HLSL::PBRIrradianceSHAttribs).
+    RefCntAutoPtr<IBuffer> CreateIrradianceSHBuffer(const char* Name = "Irradiance SH") const;
+
     struct PrecomputeCubemapsAttribs
     {
         /// Source environment map shader resource view.
@@ -522,6 +566,27 @@ public:
 
         /// Whether to optimize samples.
         bool OptimizeSamples = true;
+
+        /// Optional cache of the precomputed data, see PBR_IBLCache.
+        ///
+        /// \remarks    If the cache contains the data for ContentKey that matches the output
+        ///             textures, the data is uploaded and nothing is computed on the GPU.
+        ///             Otherwise, the cube maps are computed and read back to the cache,
+        ///             which waits until the GPU is idle.
+        PBR_IBLCache* pCache = nullptr;
+
+        /// Content key of the environment map, see PBR_IBLCache::ComputeContentKey().
+        /// The cache is not used if the key is 0.
+        ///
+        /// \remarks    The key must also reflect the sample counts if the application changes them.
+        Uint64 ContentKey = 0;
+
+        /// Optional constant buffer that receives the irradiance spherical harmonics,
+        /// see CreateIrradianceSHBuffer().
+        ///
+        /// \remarks    The coefficients are projected from the prefiltered environment map on the CPU,
+        ///             which requires the same read back as the cache unless they are found in the cache.
+        IBuffer* pIrradianceSH = nullptr;
     };
 
     /// Precompute cubemaps used by IBL.
@@ -583,8 +648,9 @@ public:
         PSO_FLAG_UNSHADED                  = PSO_FLAG_BIT(36),
         PSO_FLAG_COMPUTE_MOTION_VECTORS    = PSO_FLAG_BIT(37),
         PSO_FLAG_ENABLE_SHADOWS            = PSO_FLAG_BIT(38),
+        PSO_FLAG_USE_CLUSTERED_LIGHTS      = PSO_FLAG_BIT(39),
 
-        PSO_FLAG_LAST = PSO_FLAG_ENABLE_SHADOWS,
+        PSO_FLAG_LAST = PSO_FLAG_USE_CLUSTERED_LIGHTS,
 
         PSO_FLAG_FIRST_USER_DEFINED = PSO_FLAG_LAST << 1ull,
 
@@ -681,15 +747,10 @@ public:
         bool operator==(const PSOKey& rhs) const noexcept
         {
             // clang-format off
-            return Hash                      == rhs.Hash      &&
-                   Type                      == rhs.Type      &&
-                   Flags                     == rhs.Flags     &&
-                   CullMode                  == rhs.CullMode  &&
-                   AlphaMode                 == rhs.AlphaMode &&
-                   DebugView                 == rhs.DebugView &&
-                   LoadingAnimation          == rhs.LoadingAnimation &&
-                   UserValue                 == rhs.UserValue &&
-                   HasStaticShaderTextureIds == rhs.HasStaticShaderTextureIds &&
+            return Hash                == rhs.Hash                &&
+                   Flags               == rhs.Flags               &&
+                   GetPackedAttribs()  == rhs.GetPackedAttribs()  &&
+                   UserValue           == rhs.UserValue           &&
                    (!HasStaticShaderTextureIds || StaticShaderTextureIds == rhs.StaticShaderTextureIds);
             // clang-format on
         }
@@ -720,19 +781,37 @@ public:
         }
 
     private:
-        PSO_FLAGS                       Flags                     = PSO_FLAG_NONE;
-        RenderPassType                  Type                      = RenderPassType::Main;
-        ALPHA_MODE                      AlphaMode                 = ALPHA_MODE_OPAQUE;
-        CULL_MODE                       CullMode                  = CULL_MODE_BACK;
-        DebugViewType                   DebugView                 = DebugViewType::None;
-        LoadingAnimationMode            LoadingAnimation          = LoadingAnimationMode::None;
-        bool                            HasStaticShaderTextureIds = false;
+        // Returns the attributes that follow the flags as a single 64-bit word
+        Uint64 GetPackedAttribs() const noexcept
+        {
+            Uint64 Attribs;
+            std::memcpy(&Attribs, &Type, sizeof(Attribs));
+            return Attribs;
+        }
+
+    private:
+        // The flags and the packed attributes (Type to Padding) form two 64-bit words,
+        // so that keys are compared and hashed without looking at individual fields.
+        PSO_FLAGS            Flags                     = PSO_FLAG_NONE;
+        RenderPassType       Type                      = RenderPassType::Main;
+        ALPHA_MODE           AlphaMode                 = ALPHA_MODE_OPAQUE;
+        CULL_MODE            CullMode                  = CULL_MODE_BACK;
+        DebugViewType        DebugView                 = DebugViewType::None;
+        LoadingAnimationMode LoadingAnimation          = LoadingAnimationMode::None;
+        bool                 HasStaticShaderTextureIds = false;
+        Uint8                Padding[2]                = {};
+
+        Uint64 UserValue = 0;
+        size_t Hash      = 0;
+
         StaticShaderTextureIdsArrayType StaticShaderTextureIds{};
-        Uint64                          UserValue = 0;
-        size_t                          Hash      = 0;
     };
 
-    using PsoHashMapType = std::unordered_map<PSOKey, RefCntAutoPtr<IPipelineState>, PSOKey::Hasher>;
+    /// Pipeline states of one graphics pipeline description.
+    ///
+    /// \remarks    Lookups are lock-free, so PsoCacheAccessor::Get may be called from multiple
+    ///             threads recording draw commands. Pipeline states are created one at a time.
+    using PsoHashMapType = ReadMostlyHashMap<PSOKey, RefCntAutoPtr<IPipelineState>, PSOKey::Hasher>;
 
     class PsoCacheAccessor
     {
@@ -794,6 +873,56 @@ public:
 
     PsoCacheAccessor GetPsoCacheAccessor(const GraphicsPipelineDesc& GraphicsDesc);
 
+    /// Sets the manifest that records the pipeline permutations created by the renderer.
+    ///
+    /// \remarks    Permutations that are already in the cache are added to the manifest immediately.
+    ///             Pass null to stop recording. The manifest must outlive the renderer or be reset.
+    void SetPSOManifest(PBR_PSOManifest* pManifest);
+
+    /// Pipeline warm-up progress, see BeginPSOWarmUp().
+    struct PSOWarmUpProgress
+    {
+        /// The number of permutations to warm up.
+        Uint32 TotalCount = 0;
+
+        /// The number of pipelines whose creation has been started.
+        Uint32 StartedCount = 0;
+
+        /// The number of pipelines that are ready to use.
+        Uint32 ReadyCount = 0;
+
+        /// The number of pipelines that failed to compile.
+        Uint32 FailedCount = 0;
+
+        /// Indicates whether the warm-up was cancelled.
+        bool Cancelled = false;
+
+        bool IsComplete() const
+        {
+            return Cancelled || ReadyCount + FailedCount >= TotalCount;
+        }
+    };
+
+    /// Starts pre-creating the pipeline permutations of the manifest.
+    ///
+    /// \param [in] Manifest         - Permutations to create. The entries are copied.
+    /// \param [in] MaxPendingCount  - The maximum number of pipelines that are compiled at the same time.
+    ///
+    /// \remarks    Pipelines are created with asynchronous compilation when the device supports it,
+    ///             so that they are compiled in parallel by the device thread pool. Otherwise, up to
+    ///             MaxPendingCount pipelines are created synchronously by every UpdatePSOWarmUp() call.
+    ///             Permutations that are already in the cache are not created again.
+    ///             A warm-up that is in progress is cancelled.
+    void BeginPSOWarmUp(const PBR_PSOManifest& Manifest, Uint32 MaxPendingCount = 32);
+
+    /// Starts the creation of the next pipelines of the warm-up and returns the progress.
+    ///
+    /// \remarks    The method should be called every frame until the returned progress is complete.
+    PSOWarmUpProgress UpdatePSOWarmUp();
+
+    /// Cancels the warm-up. Pipelines whose compilation has started stay in the cache.
+    void CancelPSOWarmUp();
+
     void InitCommonSRBVars(IShaderResourceBinding* pSRB,
                            IBuffer*                pFrameAttribs,
                            bool                    BindPrimitiveAttribsBuffer = true,
@@ -802,12 +931,33 @@ public:
 
     void SetMaterialTexture(IShaderResourceBinding* pSRB, ITextureView* pTexSRV, TEXTURE_ATTRIB_ID TextureId) const;
 
+    /// Sets the IBL resources. The irradiance cube map is ignored and pIrradianceSH
+    /// is used instead if CreateInfo::UseIrradianceSH is true.
     void SetIBLResourceViews(IShaderResourceBinding* pSRB,
                              ITextureView*           pIrradianceCubeSRV,
-                             ITextureView*           pPrefilteredEnvMapSRV) const;
+                             ITextureView*           pPrefilteredEnvMapSRV,
+                             IBuffer*                pIrradianceSH = nullptr) const;
 
     void SetOITResources(IShaderResourceBinding* pSRB, const OITResources& OITResources) const;
 
+    /// Light cluster resources used by PSO_FLAG_USE_CLUSTERED_LIGHTS pipelines.
+    struct LightClusterResources
+    {
+        /// Constant buffer that contains HLSL::PBRLightClusterAttribs.
+        IBuffer* pAttribsCB = nullptr;
+
+        /// Structured buffer of HLSL::PBRLightAttribs.
+        IBuffer* pLights = nullptr;
+
+        /// Structured buffer of uint2 (offset, count) values, one per cluster.
+        IBuffer* pClusterGrid = nullptr;
+
+        /// Structured buffer of uint light indices referenced by the cluster grid.
+        IBuffer* pLightIndices = nullptr;
+    };
+
+    void SetLightClusterResources(IShaderResourceBinding* pSRB, const LightClusterResources& Resources) const;
+
     /// Initializes internal renderer parameters.
     ///
     /// \remarks    The function initializes the following parameters:
@@ -818,9 +968,17 @@ public:
     /// Returns the PBR primitive attributes shader data size for the given PSO flags.
     Uint32 GetPBRPrimitiveAttribsSize(PSO_FLAGS Flags, Uint32 CustomDataSize = sizeof(float4)) const;
 
+    /// Returns the PBR primitive attributes shader data size for the given renderer settings and PSO flags.
+    /// Unlike the member overload, does not require a renderer instance.
+    static Uint32 GetPBRPrimitiveAttribsSize(const CreateInfo& Settings, PSO_FLAGS Flags, Uint32 CustomDataSize = sizeof(float4));
+
     /// Returns the PBR material attributes shader data size for the given PSO flags.
     Uint32 GetPBRMaterialAttribsSize(PSO_FLAGS Flags) const;
 
+    /// Returns the PBR material attributes shader data size for the given renderer settings and PSO flags.
+    /// Unlike the member overload, does not require a renderer instance.
+    static Uint32 GetPBRMaterialAttribsSize(const CreateInfo& Settings, PSO_FLAGS Flags);
+
     /// Returns the PBR Frame attributes shader data size for the given light count.
     static Uint32 GetPRBFrameAttribsSize(Uint32 LightCount, Uint32 ShadowCastingLightCount);
 
@@ -939,6 +1097,8 @@ protected:
         const IBL_FEATURE_FLAGS FeatureFlags;
         const TEXTURE_FORMAT    RTVFormat;
 
+        const size_t Hash;
+
         IBL_PSOKey(PSO_TYPE          _PSOType,
                    ENV_MAP_TYPE      _EnvMapType,
                    IBL_FEATURE_FLAGS _FeatureFlags,
@@ -946,12 +1106,14 @@ protected:
             PSOType{_PSOType},
             EnvMapType{_EnvMapType},
             FeatureFlags{_FeatureFlags},
-            RTVFormat{_Format}
+            RTVFormat{_Format},
+            Hash{ComputeHash(_PSOType, _EnvMapType, _FeatureFlags, _Format)}
         {}
 
         constexpr bool operator==(const IBL_PSOKey& rhs) const
         {
-            return (PSOType == rhs.PSOType &&
+            return (Hash == rhs.Hash &&
+                    PSOType == rhs.PSOType &&
                     EnvMapType == rhs.EnvMapType &&
                     FeatureFlags == rhs.FeatureFlags &&
                     RTVFormat == rhs.RTVFormat);
@@ -959,9 +1121,9 @@ protected:
 
         struct Hasher
         {
-            size_t operator()(const IBL_PSOKey& Key) const
+            size_t operator()(const IBL_PSOKey& Key) const noexcept
             {
-                return ComputeHash(Key.PSOType, Key.EnvMapType, Key.FeatureFlags, Key.RTVFormat);
+                return Key.Hash;
             }
         };
     };
@@ -1008,8 +1170,20 @@ protected:
     std::unordered_map<PSOKey, RefCntAutoPtr<IShader>, PSOKey::Hasher> m_VertexShaders;
     std::unordered_map<PSOKey, RefCntAutoPtr<IShader>, PSOKey::Hasher> m_PixelShaders;
 
+    std::unique_ptr<PBR_ShaderSourceCache> m_ShaderSourceCache;
+
+    // Protects m_PSOs. Pipeline state lookups in the hash maps do not need the lock.
+    std::mutex                                               m_PSOsMtx;
     std::unordered_map<GraphicsPipelineDesc, PsoHashMapType> m_PSOs;
 
+    // Serializes pipeline state creation, which accesses the shader caches and the manifest
+    std::mutex m_CreatePSOMtx;
+
+    PBR_PSOManifest* m_pPSOManifest = nullptr;
+
+    struct PSOWarmUpState;
+    std::unique_ptr<PSOWarmUpState> m_PSOWarmUp;
+
     static constexpr Uint32                   ClearOITLayersThreadGroupSize = 16;
     RefCntAutoPtr<IPipelineState>             m_ClearOITLayersPSO;
     RefCntAutoPtr<IPipelineResourceSignature> m_RWOITLayersSignature;
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/Shader.h"
+
+namespace Diligent
+{
+
+/// Cache of shader sources with all includes expanded.
+///
+/// Pipeline permutations of the PBR renderer share the same shader files and differ in the
+/// macros and the generated include files. The cache keeps the expanded source of every
+/// combination of the shader file and the generated includes, so that the include files are read
+/// and expanded once. Macros are not part of the key because they are applied by the compiler.
+///
+/// Include files that use `#pragma once` are expanded once; other files are expanded every time
+/// they are included and are expected to use include guards, as with a regular preprocessor.
+class PBR_ShaderSourceCache
+{
+public:
+    /// Include file generated by the renderer, for example the shader input struct.
+    struct GeneratedInclude
+    {
+        const char*        Name   = nullptr;
+        const std::string* Source = nullptr;
+    };
+
+    /// Cache statistics.
+    struct Statistics
+    {
+        /// The number of sources found in memory.
+        Uint32 MemoryHits = 0;
+
+        /// The number of sources loaded from the on-disk mirror.
+        Uint32 DiskHits = 0;
+
+        /// The number of sources that were expanded.
+        Uint32 Misses = 0;
+    };
+
+    /// \param [in] MirrorDirectory - Optional directory where expanded sources are mirrored on disk,
+    ///                               so that they are reused by the next sessions. A mirrored source
+    ///                               is only used if the shader files it was expanded from are unchanged.
+    explicit PBR_ShaderSourceCache(const char* MirrorDirectory = nullptr);
+
+    /// Returns the source of the shader file with all includes expanded.
+    ///
+    /// \param [in] FilePath             - Shader file path.
+    /// \param [in] pFactory             - Factory that provides the shader file and its include files.
+    ///                                    The same factory must be used for all calls.
+    /// \param [in] GeneratedIncludes    - Generated include files that take precedence over the files
+    ///                                    of the factory. Their contents are part of the cache key.
+    /// \param [in] NumGeneratedIncludes - The number of elements in GeneratedIncludes.
+    ///
+    /// \return     The expanded source, which stays valid until the cache is cleared or destroyed,
+    ///             or null if the shader file or any of its includes can't be read.
+    const std::string* Get(const char*                      FilePath,
+                           IShaderSourceInputStreamFactory* pFactory,
+                           const GeneratedInclude*          GeneratedIncludes,
+                           Uint32                           NumGeneratedIncludes);
+
+    void Clear();
+
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    const std::string* ReadFile(const char* Name, IShaderSourceInputStreamFactory* pFactory);
+
+    const std::string* LoadFromMirror(const std::string& Key, IShaderSourceInputStreamFactory* pFactory);
+    void               SaveToMirror(const std::string& Key, const std::string& Source, const std::vector<std::string>& Dependencies) const;
+    std::string        GetMirrorFilePath(const std::string& Key) const;
+
+    struct ExpandContext;
+    bool ExpandIncludes(const char* Name, ExpandContext& Ctx, Uint32 Depth, std::string& Out);
+
+private:
+    const std::string m_MirrorDirectory;
+
+    // Contents of the files read from the factory
+    std::unordered_map<std::string, std::string> m_Files;
+
+    // Expanded sources by their keys
+    std::unordered_map<std::string, std::string> m_Sources;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -0,0 +1,311 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PBR_IBLCache.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 SerializationMagic   = 0x4C424944; // 'DIBL'
+constexpr Uint32 SerializationVersion = 1;
+
+// Limits that protect from corrupted mirror files
+constexpr Uint32 MaxCubemapDimension = 16384;
+constexpr Uint32 MaxTexelSize        = 16;
+
+class Writer
+{
+public:
+    explicit Writer(std::vector<Uint8>& Data) :
+        m_Data{Data}
+    {}
+
+    template <typename T>
+    void Write(const T& Value)
+    {
+        Write(&Value, sizeof(Value));
+    }
+
+    void Write(const void* pData, size_t Size)
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(pData);
+        m_Data.insert(m_Data.end(), pBytes, pBytes + Size);
+    }
+
+private:
+    std::vector<Uint8>& m_Data;
+};
+
+class Reader
+{
+public:
+    Reader(const void* pData, size_t Size) :
+        m_pPos{static_cast<const Uint8*>(pData)},
+        m_pEnd{m_pPos + Size}
+    {}
+
+    template <typename T>
+    bool Read(T& Value)
+    {
+        return Read(&Value, sizeof(Value));
+    }
+
+    bool Read(void* pData, size_t Size)
+    {
+        if (static_cast<size_t>(m_pEnd - m_pPos) < Size)
+            return false;
+        memcpy(pData, m_pPos, Size);
+        m_pPos += Size;
+        return true;
+    }
+
+    bool IsEnd() const { return m_pPos == m_pEnd; }
+
+private:
+    const Uint8*       m_pPos;
+    const Uint8* const m_pEnd;
+};
+
+void WriteCubemap(Writer& Out, const PBR_IBLCache::CubemapData& Cubemap)
+{
+    Out.Write(static_cast<Uint32>(Cubemap.Format));
+    Out.Write(Cubemap.TexelSize);
+    Out.Write(Cubemap.Dimension);
+    Out.Write(Cubemap.MipLevels);
+    Out.Write(static_cast<Uint64>(Cubemap.Data.size()));
+    Out.Write(Cubemap.Data.data(), Cubemap.Data.size());
+}
+
+bool ReadCubemap(Reader& In, PBR_IBLCache::CubemapData& Cubemap)
+{
+    Uint32 Format   = 0;
+    Uint64 DataSize = 0;
+    if (!In.Read(Format) ||
+        !In.Read(Cubemap.TexelSize) ||
+        !In.Read(Cubemap.Dimension) ||
+        !In.Read(Cubemap.MipLevels) ||
+        !In.Read(DataSize))
+        return false;
+
+    Cubemap.Format = static_cast<TEXTURE_FORMAT>(Format);
+    if (Cubemap.Format == TEX_FORMAT_UNKNOWN || Cubemap.Format >= TEX_FORMAT_NUM_FORMATS ||
+        Cubemap.TexelSize == 0 || Cubemap.TexelSize > MaxTexelSize ||
+        Cubemap.Dimension == 0 || Cubemap.Dimension > MaxCubemapDimension ||
+        Cubemap.MipLevels == 0 || Cubemap.MipLevels > 32 || (Cubemap.Dimension >> (Cubemap.MipLevels - 1)) == 0 ||
+        DataSize != Cubemap.GetRequiredDataSize())
+        return false;
+
+    Cubemap.Data.resize(static_cast<size_t>(DataSize));
+    return In.Read(Cubemap.Data.data(), Cubemap.Data.size());
+}
+
+} // namespace
+
+size_t PBR_IBLCache::CubemapData::GetSubresourceOffset(Uint32 Face, Uint32 Mip) const
+{
+    size_t FaceSize  = 0;
+    size_t MipOffset = 0;
+    for (Uint32 m = 0; m < MipLevels; ++m)
+    {
+        if (m == Mip)
+            MipOffset = FaceSize;
+        FaceSize += GetRowSize(m) * GetMipDimension(m);
+    }
+    return FaceSize * Face + MipOffset;
+}
+
+PBR_IBLCache::PBR_IBLCache(const char* MirrorDirectory) :
+    m_MirrorDirectory{MirrorDirectory != nullptr ? MirrorDirectory : ""}
+{
+    if (!m_MirrorDirectory.empty() && !FileSystem::PathExists(m_MirrorDirectory.c_str()))
+    {
+        if (!FileSystem::CreateDirectory(m_MirrorDirectory.c_str()))
+            LOG_WARNING_MESSAGE("Failed to create IBL cache directory '", m_MirrorDirectory, "'");
+    }
+}
+
+Uint64 PBR_IBLCache::ComputeContentKey(const void* pData, size_t Size)
+{
+    // FNV-1a over 64-bit words and the remaining bytes
+    constexpr Uint64 Prime = 1099511628211ull;
+
+    Uint64       Key    = 14695981039346656037ull ^ Size;
+    const Uint8* pBytes = static_cast<const Uint8*>(pData);
+    size_t       Pos    = 0;
+    for (; Pos + sizeof(Uint64) <= Size; Pos += sizeof(Uint64))
+    {
+        Uint64 Word;
+        memcpy(&Word, pBytes + Pos, sizeof(Word));
+        Key = (Key ^ Word) * Prime;
+    }
+    for (; Pos < Size; ++Pos)
+        Key = (Key ^ pBytes[Pos]) * Prime;
+
+    // Mix the high bits into the low bits, which are used by the hash map
+    Key ^= Key >> 32;
+
+    return Key != 0 ? Key : 1;
+}
+
+const PBR_IBLCache::Entry* PBR_IBLCache::Find(Uint64 Key)
+{
+    auto it = m_Entries.find(Key);
+    if (it != m_Entries.end())
+    {
+        ++m_Stats.MemoryHits;
+        return &it->second;
+    }
+
+    if (const Entry* pEntry = LoadFromMirror(Key))
+    {
+        ++m_Stats.DiskHits;
+        return pEntry;
+    }
+
+    ++m_Stats.Misses;
+    return nullptr;
+}
+
+const PBR_IBLCache::Entry& PBR_IBLCache::Add(Uint64 Key, Entry&& NewEntry)
+{
+    SaveToMirror(Key, NewEntry);
+
+    Entry& DstEntry = m_Entries[Key];
+    DstEntry        = std::move(NewEntry);
+    return DstEntry;
+}
+
+void PBR_IBLCache::Serialize(Uint64 Key, const Entry& SrcEntry, std::vector<Uint8>& Data)
+{
+    Data.clear();
+    Data.reserve(128 + SrcEntry.IrradianceCube.Data.size() + SrcEntry.PrefilteredEnvMap.Data.size());
+
+    Writer Out{Data};
+    Out.Write(SerializationMagic);
+    Out.Write(SerializationVersion);
+    Out.Write(Key);
+    for (const float3& Coeff : SrcEntry.IrradianceSH.Coeffs)
+    {
+        Out.Write(Coeff.x);
+        Out.Write(Coeff.y);
+        Out.Write(Coeff.z);
+    }
+    WriteCubemap(Out, SrcEntry.IrradianceCube);
+    WriteCubemap(Out, SrcEntry.PrefilteredEnvMap);
+}
+
+bool PBR_IBLCache::Deserialize(Uint64 Key, const void* pData, size_t Size, Entry& DstEntry)
+{
+    Reader In{pData, Size};
+
+    Uint32 Magic   = 0;
+    Uint32 Version = 0;
+    Uint64 DataKey = 0;
+    if (!In.Read(Magic) || Magic != SerializationMagic ||
+        !In.Read(Version) || Version != SerializationVersion ||
+        !In.Read(DataKey) || DataKey != Key)
+        return false;
+
+    for (float3& Coeff : DstEntry.IrradianceSH.Coeffs)
+    {
+        if (!In.Read(Coeff.x) || !In.Read(Coeff.y) || !In.Read(Coeff.z))
+            return false;
+    }
+
+    return ReadCubemap(In, DstEntry.IrradianceCube) &&
+        ReadCubemap(In, DstEntry.PrefilteredEnvMap) &&
+        In.IsEnd();
+}
+
+std::string PBR_IBLCache::GetMirrorFilePath(Uint64 Key) const
+{
+    char FileName[32];
+    snprintf(FileName, sizeof(FileName), "%016llx.ibl", static_cast<unsigned long long>(Key));
+
+    std::string Path = m_MirrorDirectory;
+    if (!FileSystem::IsSlash(Path.back()))
+        Path.push_back(FileSystem::SlashSymbol);
+    Path.append(FileName);
+    return Path;
+}
+
+const PBR_IBLCache::Entry* PBR_IBLCache::LoadFromMirror(Uint64 Key)
+{
+    if (m_MirrorDirectory.empty())
+        return nullptr;
+
+    const std::string FilePath = GetMirrorFilePath(Key);
+    if (!FileSystem::FileExists(FilePath.c_str()))
+        return nullptr;
+
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(FilePath.c_str(), Data, true))
+        return nullptr;
+
+    Entry NewEntry;
+    if (!Deserialize(Key, Data.data(), Data.size(), NewEntry))
+    {
+        LOG_WARNING_MESSAGE("IBL cache file '", FilePath, "' is invalid and will be ignored");
+        return nullptr;
+    }
+
+    return &m_Entries.emplace(Key, std::move(NewEntry)).first->second;
+}
+
+void PBR_IBLCache::SaveToMirror(Uint64 Key, const Entry& SrcEntry) const
+{
+    if (m_MirrorDirectory.empty())
+        return;
+
+    std::vector<Uint8> Data;
+    Serialize(Key, SrcEntry, Data);
+
+    const std::string FilePath = GetMirrorFilePath(Key);
+
+    FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+    if (!File || !File->Write(Data.data(), Data.size()))
+    {
+        LOG_WARNING_MESSAGE("Failed to write IBL cache file '", FilePath, "'");
+    }
+}
+
+void PBR_IBLCache::Clear()
+{
+    m_Entries.clear();
+    m_Stats = {};
+}
+
+} // namespace Diligent
@@ -0,0 +1,344 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PBR_IrradianceSH.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The number of texels that are processed together. Accumulators keep a separate sum for every
+// lane, so that the loops over the lanes vectorize without reordering floating-point additions.
+constexpr Uint32 LaneCount = 8;
+
+// Convolution of the bands with the clamped cosine lobe divided by PI (A0 = PI, A1 = 2 PI / 3, A2 = PI / 4),
+// see "An Efficient Representation for Irradiance Environment Maps" by Ramamoorthi and Hanrahan.
+constexpr float BandScales[PBR_IrradianceSH::NumCoeffs] = {1.f, 2.f / 3.f, 2.f / 3.f, 2.f / 3.f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+
+float HalfToFloat(Uint16 Half)
+{
+    const Uint32 Sign     = (Half & 0x8000u) << 16u;
+    const Uint32 Exponent = (Half >> 10u) & 0x1Fu;
+    const Uint32 Mantissa = Half & 0x3FFu;
+
+    Uint32 Bits = 0;
+    if (Exponent == 0)
+    {
+        // Zero or denormal
+        const float Value = static_cast<float>(Mantissa) * (1.f / 16777216.f);
+        return Sign != 0 ? -Value : Value;
+    }
+    else if (Exponent == 0x1F)
+    {
+        // Infinity or NaN
+        Bits = Sign | 0x7F800000u | (Mantissa << 13u);
+    }
+    else
+    {
+        Bits = Sign | ((Exponent + 112u) << 23u) | (Mantissa << 13u);
+    }
+
+    float Value;
+    memcpy(&Value, &Bits, sizeof(Value));
+    return Value;
+}
+
+bool IsValidImage(const PBR_IrradianceSH::SourceImage& Image)
+{
+    return Image.pData != nullptr &&
+        Image.Width > 0 &&
+        Image.Height > 0 &&
+        (Image.ValueType == VT_FLOAT32 || Image.ValueType == VT_FLOAT16) &&
+        Image.NumComponents >= 3;
+}
+
+// Directions, solid-angle weights and colors of the texels of one row.
+// The buffers are padded to the multiple of the lane count with zero weights.
+struct RowData
+{
+    explicit RowData(Uint32 Width) :
+        Size{(Width + LaneCount - 1) / LaneCount * LaneCount}
+    {
+        for (std::vector<float>* pBuffer : {&X, &Y, &Z, &W, &R, &G, &B})
+            pBuffer->resize(Size);
+    }
+
+    const Uint32 Size;
+
+    std::vector<float> X, Y, Z, W;
+    std::vector<float> R, G, B;
+};
+
+void ReadRowColors(const PBR_IrradianceSH::SourceImage& Image, Uint32 Row, RowData& Data)
+{
+    const size_t ComponentSize = Image.ValueType == VT_FLOAT16 ? sizeof(Uint16) : sizeof(float);
+    const size_t TexelSize     = ComponentSize * Image.NumComponents;
+    const size_t Stride        = Image.Stride != 0 ? Image.Stride : TexelSize * Image.Width;
+    const Uint8* pTexel        = static_cast<const Uint8*>(Image.pData) + Stride * Row;
+
+    float* const Colors[] = {Data.R.data(), Data.G.data(), Data.B.data()};
+    for (Uint32 x = 0; x < Image.Width; ++x, pTexel += TexelSize)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            if (Image.ValueType == VT_FLOAT16)
+            {
+                Uint16 Half;
+                memcpy(&Half, pTexel + c * ComponentSize, sizeof(Half));
+                Colors[c][x] = HalfToFloat(Half);
+            }
+            else
+            {
+                memcpy(&Colors[c][x], pTexel + c * ComponentSize, sizeof(float));
+            }
+        }
+    }
+}
+
+class SHAccumulator
+{
+public:
+    void AddRow(const RowData& Data)
+    {
+        for (Uint32 i = 0; i < Data.Size; i += LaneCount)
+        {
+            AddTexels(&Data.X[i], &Data.Y[i], &Data.Z[i], &Data.W[i], &Data.R[i], &Data.G[i], &Data.B[i]);
+        }
+
+        // Row sums are accumulated in double precision, so that the error does not grow with the image size
+        for (Uint32 l = 0; l < LaneCount; ++l)
+        {
+            m_TotalWeight += m_Weight[l];
+            m_Weight[l] = 0;
+        }
+        for (Uint32 k = 0; k < PBR_IrradianceSH::NumCoeffs; ++k)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                for (Uint32 l = 0; l < LaneCount; ++l)
+                {
+                    m_Totals[k][c] += m_Sums[k][c][l];
+                    m_Sums[k][c][l] = 0;
+                }
+            }
+        }
+    }
+
+    void GetSH(PBR_IrradianceSH& SH) const
+    {
+        // Normalizing by the total weight compensates the error of the texel solid angle approximation
+        const double Scale = m_TotalWeight > 0 ? 4.0 * PI / m_TotalWeight : 0.0;
+        for (Uint32 k = 0; k < PBR_IrradianceSH::NumCoeffs; ++k)
+        {
+            const double CoeffScale = Scale * BandScales[k];
+            SH.Coeffs[k]            = float3{
+                static_cast<float>(m_Totals[k][0] * CoeffScale),
+                static_cast<float>(m_Totals[k][1] * CoeffScale),
+                static_cast<float>(m_Totals[k][2] * CoeffScale),
+            };
+        }
+    }
+
+private:
+    void AddTexels(const float* X, const float* Y, const float* Z, const float* W, const float* R, const float* G, const float* B)
+    {
+        float Basis[PBR_IrradianceSH::NumCoeffs][LaneCount];
+        for (Uint32 l = 0; l < LaneCount; ++l)
+        {
+            Basis[0][l] = 0.282095f;
+            Basis[1][l] = 0.488603f * Y[l];
+            Basis[2][l] = 0.488603f * Z[l];
+            Basis[3][l] = 0.488603f * X[l];
+            Basis[4][l] = 1.092548f * X[l] * Y[l];
+            Basis[5][l] = 1.092548f * Y[l] * Z[l];
+            Basis[6][l] = 0.315392f * (3.f * Z[l] * Z[l] - 1.f);
+            Basis[7][l] = 1.092548f * X[l] * Z[l];
+            Basis[8][l] = 0.546274f * (X[l] * X[l] - Y[l] * Y[l]);
+        }
+
+        for (Uint32 l = 0; l < LaneCount; ++l)
+            m_Weight[l] += W[l];
+
+        for (Uint32 k = 0; k < PBR_IrradianceSH::NumCoeffs; ++k)
+        {
+            for (Uint32 l = 0; l < LaneCount; ++l)
+            {
+                const float BasisWeight = Basis[k][l] * W[l];
+                m_Sums[k][0][l] += BasisWeight * R[l];
+                m_Sums[k][1][l] += BasisWeight * G[l];
+                m_Sums[k][2][l] += BasisWeight * B[l];
+            }
+        }
+    }
+
+private:
+    float m_Sums[PBR_IrradianceSH::NumCoeffs][3][LaneCount] = {};
+    float m_Weight[LaneCount]                               = {};
+
+    double m_Totals[PBR_IrradianceSH::NumCoeffs][3] = {};
+    double m_TotalWeight                            = 0;
+};
+
+} // namespace
+
+bool PBR_IrradianceSH::ProjectCubemap(const SourceImage Faces[6], PBR_IrradianceSH& SH)
+{
+    const Uint32 Size = Faces[0].Width;
+    for (Uint32 Face = 0; Face < 6; ++Face)
+    {
+        if (!IsValidImage(Faces[Face]) || Faces[Face].Width != Size || Faces[Face].Height != Size)
+        {
+            LOG_ERROR_MESSAGE("Cube map face ", Face, " is invalid. All faces must be square, have the same size, and contain at least 3 float components.");
+            return false;
+        }
+    }
+
+    SHAccumulator Accumulator;
+    RowData       Row{Size};
+
+    const float TexelSize = 2.f / static_cast<float>(Size);
+    for (Uint32 Face = 0; Face < 6; ++Face)
+    {
+        for (Uint32 y = 0; y < Size; ++y)
+        {
+            ReadRowColors(Faces[Face], y, Row);
+
+            const float v = (static_cast<float>(y) + 0.5f) * TexelSize - 1.f;
+            for (Uint32 x = 0; x < Size; ++x)
+            {
+                const float u = (static_cast<float>(x) + 0.5f) * TexelSize - 1.f;
+
+                // Face directions follow the Direct3D cube map convention
+                float3 Dir;
+                switch (Face)
+                {
+                    // clang-format off
+                    case 0: Dir = float3{ 1.f,  -v,  -u}; break; // +X
+                    case 1: Dir = float3{-1.f,  -v,   u}; break; // -X
+                    case 2: Dir = float3{   u, 1.f,   v}; break; // +Y
+                    case 3: Dir = float3{   u,-1.f,  -v}; break; // -Y
+                    case 4: Dir = float3{   u,  -v, 1.f}; break; // +Z
+                    case 5: Dir = float3{  -u,  -v,-1.f}; break; // -Z
+                    // clang-format on
+                }
+
+                // The solid angle of the texel is proportional to 1 / (1 + u^2 + v^2)^(3/2)
+                const float LenSq  = 1.f + u * u + v * v;
+                const float InvLen = 1.f / std::sqrt(LenSq);
+
+                Row.X[x] = Dir.x * InvLen;
+                Row.Y[x] = Dir.y * InvLen;
+                Row.Z[x] = Dir.z * InvLen;
+                Row.W[x] = InvLen / LenSq;
+            }
+
+            Accumulator.AddRow(Row);
+        }
+    }
+
+    Accumulator.GetSH(SH);
+    return true;
+}
+
+bool PBR_IrradianceSH::ProjectSphereMap(const SourceImage& Image, PBR_IrradianceSH& SH)
+{
+    if (!IsValidImage(Image))
+    {
+        LOG_ERROR_MESSAGE("Sphere map is invalid. The map must contain at least 3 float components.");
+        return false;
+    }
+
+    SHAccumulator Accumulator;
+    RowData       Row{Image.Width};
+
+    std::vector<float> CosPhi(Image.Width);
+    std::vector<float> SinPhi(Image.Width);
+    for (Uint32 x = 0; x < Image.Width; ++x)
+    {
+        const float Phi = ((static_cast<float>(x) + 0.5f) / static_cast<float>(Image.Width) - 0.5f) * 2.f * PI_F;
+        CosPhi[x]       = std::cos(Phi);
+        SinPhi[x]       = std::sin(Phi);
+    }
+
+    for (Uint32 y = 0; y < Image.Height; ++y)
+    {
+        ReadRowColors(Image, y, Row);
+
+        // The inverse of TransformDirectionToSphereMapUV()
+        const float Latitude    = ((static_cast<float>(y) + 0.5f) / static_cast<float>(Image.Height) - 0.5f) * PI_F;
+        const float CosLatitude = std::cos(Latitude);
+        const float SinLatitude = std::sin(Latitude);
+        for (Uint32 x = 0; x < Image.Width; ++x)
+        {
+            Row.X[x] = CosLatitude * CosPhi[x];
+            Row.Y[x] = SinLatitude;
+            Row.Z[x] = CosLatitude * SinPhi[x];
+            // The solid angle of the texel is proportional to the cosine of the latitude
+            Row.W[x] = CosLatitude;
+        }
+
+        Accumulator.AddRow(Row);
+    }
+
+    Accumulator.GetSH(SH);
+    return true;
+}
+
+float3 PBR_IrradianceSH::Evaluate(const float3& N) const
+{
+    const float Basis[NumCoeffs] = {
+        0.282095f,
+        0.488603f * N.y,
+        0.488603f * N.z,
+        0.488603f * N.x,
+        1.092548f * N.x * N.y,
+        1.092548f * N.y * N.z,
+        0.315392f * (3.f * N.z * N.z - 1.f),
+        1.092548f * N.x * N.z,
+        0.546274f * (N.x * N.x - N.y * N.y),
+    };
+
+    float3 Irradiance;
+    for (Uint32 k = 0; k < NumCoeffs; ++k)
+        Irradiance += Coeffs[k] * Basis[k];
+
+    return float3{
+        std::max(Irradiance.x, 0.f),
+        std::max(Irradiance.y, 0.f),
+        std::max(Irradiance.z, 0.f),
+    };
+}
+
+} // namespace Diligent
@@ -0,0 +1,415 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PBR_PSOManifest.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "FileWrapper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr char   ManifestMagic[4] = {'P', 'B', 'R', 'M'};
+constexpr Uint64 ManifestVersion  = 1;
+
+template <typename T, bool IsEnum = std::is_enum<T>::value>
+struct UnderlyingValueType
+{
+    using Type = T;
+};
+
+template <typename T>
+struct UnderlyingValueType<T, true>
+{
+    using Type = typename std::underlying_type<T>::type;
+};
+
+class ManifestWriter
+{
+public:
+    explicit ManifestWriter(std::vector<Uint8>& Out) :
+        m_Out{Out}
+    {}
+
+    void WriteVarUint(Uint64 Value)
+    {
+        while (Value >= 0x80u)
+        {
+            m_Out.push_back(static_cast<Uint8>(Value | 0x80u));
+            Value >>= 7u;
+        }
+        m_Out.push_back(static_cast<Uint8>(Value));
+    }
+
+    void WriteBytes(const void* pData, size_t Size)
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(pData);
+        m_Out.insert(m_Out.end(), pBytes, pBytes + Size);
+    }
+
+    // Integers, booleans and enums are written as varints, signed values are zigzag-encoded
+    template <typename T>
+    void Write(const T& Value)
+    {
+        using RawType = typename UnderlyingValueType<T>::Type;
+        const RawType Raw = static_cast<RawType>(Value);
+        if (std::is_signed<RawType>::value)
+        {
+            const Int64 Signed = static_cast<Int64>(Raw);
+            WriteVarUint((static_cast<Uint64>(Signed) << 1u) ^ static_cast<Uint64>(Signed >> 63));
+        }
+        else
+        {
+            WriteVarUint(static_cast<Uint64>(Raw));
+        }
+    }
+
+    void Write(const Float32& Value)
+    {
+        Uint32 Bits = 0;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+        for (Uint32 i = 0; i < 4; ++i)
+            m_Out.push_back(static_cast<Uint8>(Bits >> (i * 8u)));
+    }
+
+private:
+    std::vector<Uint8>& m_Out;
+};
+
+class ManifestReader
+{
+public:
+    ManifestReader(const Uint8* pData, size_t Size) :
+        m_pCurr{pData},
+        m_pEnd{pData + Size}
+    {}
+
+    bool IsValid() const { return m_IsValid; }
+    bool IsEnd() const { return m_pCurr == m_pEnd; }
+
+    Uint64 ReadVarUint()
+    {
+        Uint64 Value = 0;
+        for (Uint32 Shift = 0; Shift < 64; Shift += 7)
+        {
+            if (m_pCurr == m_pEnd)
+                break;
+            const Uint8 Byte = *m_pCurr++;
+            Value |= Uint64{Byte & 0x7Fu} << Shift;
+            if ((Byte & 0x80u) == 0)
+                return Value;
+        }
+        m_IsValid = false;
+        return 0;
+    }
+
+    const Uint8* ReadBytes(size_t Size)
+    {
+        if (static_cast<size_t>(m_pEnd - m_pCurr) < Size)
+        {
+            m_IsValid = false;
+            return nullptr;
+        }
+        const Uint8* pBytes = m_pCurr;
+        m_pCurr += Size;
+        return pBytes;
+    }
+
+    template <typename T>
+    void Read(T& Value)
+    {
+        using RawType = typename UnderlyingValueType<T>::Type;
+        using WideType = typename std::conditional<std::is_signed<RawType>::value, Int64, Uint64>::type;
+
+        const Uint64 Encoded = ReadVarUint();
+        WideType     Wide    = static_cast<WideType>(Encoded);
+        if (std::is_signed<RawType>::value)
+            Wide = static_cast<WideType>((Encoded >> 1u) ^ (~(Encoded & 1u) + 1u));
+
+        // Values that do not fit the field type indicate corrupted data
+        if (Wide < static_cast<WideType>(std::numeric_limits<RawType>::min()) ||
+            Wide > static_cast<WideType>(std::numeric_limits<RawType>::max()))
+        {
+            m_IsValid = false;
+            Wide      = 0;
+        }
+        Value = static_cast<T>(static_cast<RawType>(Wide));
+    }
+
+    void Read(Float32& Value)
+    {
+        Uint32 Bits = 0;
+        if (const Uint8* pBytes = ReadBytes(4))
+        {
+            for (Uint32 i = 0; i < 4; ++i)
+                Bits |= Uint32{pBytes[i]} << (i * 8u);
+        }
+        std::memcpy(&Value, &Bits, sizeof(Bits));
+    }
+
+private:
+    const Uint8*       m_pCurr   = nullptr;
+    const Uint8* const m_pEnd    = nullptr;
+    bool               m_IsValid = true;
+};
+
+// Visits all serialized fields of the graphics pipeline description in a fixed order.
+// The input layout is defined by the renderer, and the render pass can't be serialized.
+template <typename DescType, typename HandlerType>
+void ProcessGraphicsDescFields(DescType& Desc, HandlerType&& Handler)
+{
+    Handler(Desc.BlendDesc.AlphaToCoverageEnable);
+    Handler(Desc.BlendDesc.IndependentBlendEnable);
+    for (auto& RT : Desc.BlendDesc.RenderTargets)
+    {
+        Handler(RT.BlendEnable);
+        Handler(RT.LogicOperationEnable);
+        Handler(RT.SrcBlend);
+        Handler(RT.DestBlend);
+        Handler(RT.BlendOp);
+        Handler(RT.SrcBlendAlpha);
+        Handler(RT.DestBlendAlpha);
+        Handler(RT.BlendOpAlpha);
+        Handler(RT.LogicOp);
+        Handler(RT.RenderTargetWriteMask);
+    }
+    Handler(Desc.SampleMask);
+
+    Handler(Desc.RasterizerDesc.FillMode);
+    Handler(Desc.RasterizerDesc.CullMode);
+    Handler(Desc.RasterizerDesc.FrontCounterClockwise);
+    Handler(Desc.RasterizerDesc.DepthClipEnable);
+    Handler(Desc.RasterizerDesc.ScissorEnable);
+    Handler(Desc.RasterizerDesc.AntialiasedLineEnable);
+    Handler(Desc.RasterizerDesc.DepthBias);
+    Handler(Desc.RasterizerDesc.DepthBiasClamp);
+    Handler(Desc.RasterizerDesc.SlopeScaledDepthBias);
+
+    Handler(Desc.DepthStencilDesc.DepthEnable);
+    Handler(Desc.DepthStencilDesc.DepthWriteEnable);
+    Handler(Desc.DepthStencilDesc.DepthFunc);
+    Handler(Desc.DepthStencilDesc.StencilEnable);
+    Handler(Desc.DepthStencilDesc.StencilReadMask);
+    Handler(Desc.DepthStencilDesc.StencilWriteMask);
+    for (auto* pFace : {&Desc.DepthStencilDesc.FrontFace, &Desc.DepthStencilDesc.BackFace})
+    {
+        Handler(pFace->StencilFailOp);
+        Handler(pFace->StencilDepthFailOp);
+        Handler(pFace->StencilPassOp);
+        Handler(pFace->StencilFunc);
+    }
+
+    Handler(Desc.PrimitiveTopology);
+    Handler(Desc.NumViewports);
+    Handler(Desc.NumRenderTargets);
+    Handler(Desc.SubpassIndex);
+    Handler(Desc.ShadingRateFlags);
+    for (auto& RTVFormat : Desc.RTVFormats)
+        Handler(RTVFormat);
+    Handler(Desc.DSVFormat);
+    Handler(Desc.ReadOnlyDSV);
+    Handler(Desc.SmplDesc.Count);
+    Handler(Desc.SmplDesc.Quality);
+    Handler(Desc.NodeMask);
+}
+
+void WriteEntry(std::vector<Uint8>& Record, const GraphicsPipelineDesc& GraphicsDesc, const PBR_Renderer::PSOKey& Key)
+{
+    ManifestWriter Writer{Record};
+    ProcessGraphicsDescFields(GraphicsDesc, [&Writer](const auto& Value) { Writer.Write(Value); });
+
+    Writer.Write(Key.GetType());
+    Writer.Write(Key.GetFlags());
+    Writer.Write(Key.GetAlphaMode());
+    Writer.Write(Key.GetCullMode());
+    Writer.Write(Key.GetDebugView());
+    Writer.Write(Key.GetLoadingAnimation());
+    Writer.Write(Key.GetUserValue());
+
+    const PBR_Renderer::StaticShaderTextureIdsArrayType* pTextureIds = Key.GetStaticShaderTextureIds();
+    Writer.Write(pTextureIds != nullptr);
+    if (pTextureIds != nullptr)
+    {
+        for (const Uint16 TextureId : *pTextureIds)
+            Writer.Write(TextureId);
+    }
+}
+
+bool ReadEntry(const Uint8* pData, size_t Size, PBR_PSOManifest::Entry& Entry)
+{
+    ManifestReader Reader{pData, Size};
+    ProcessGraphicsDescFields(Entry.GraphicsDesc, [&Reader](auto& Value) { Reader.Read(Value); });
+
+    PBR_Renderer::RenderPassType       Type             = PBR_Renderer::RenderPassType::Main;
+    PBR_Renderer::PSO_FLAGS            Flags            = PBR_Renderer::PSO_FLAG_NONE;
+    ALPHA_MODE                         AlphaMode        = ALPHA_MODE_OPAQUE;
+    CULL_MODE                          CullMode         = CULL_MODE_BACK;
+    PBR_Renderer::DebugViewType        DebugView        = PBR_Renderer::DebugViewType::None;
+    PBR_Renderer::LoadingAnimationMode LoadingAnimation = PBR_Renderer::LoadingAnimationMode::None;
+    Uint64                             UserValue        = 0;
+    bool                               HasTextureIds    = false;
+    Reader.Read(Type);
+    Reader.Read(Flags);
+    Reader.Read(AlphaMode);
+    Reader.Read(CullMode);
+    Reader.Read(DebugView);
+    Reader.Read(LoadingAnimation);
+    Reader.Read(UserValue);
+    Reader.Read(HasTextureIds);
+
+    PBR_Renderer::StaticShaderTextureIdsArrayType TextureIds{};
+    if (HasTextureIds)
+    {
+        for (Uint16& TextureId : TextureIds)
+            Reader.Read(TextureId);
+    }
+
+    if (!Reader.IsValid() || !Reader.IsEnd() || Type >= PBR_Renderer::RenderPassType::Count)
+        return false;
+
+    Entry.Key = PBR_Renderer::PSOKey{Type, Flags, AlphaMode, CullMode, DebugView, LoadingAnimation, UserValue, HasTextureIds ? &TextureIds : nullptr};
+    return true;
+}
+
+} // namespace
+
+bool PBR_PSOManifest::Add(const GraphicsPipelineDesc& GraphicsDesc, const PBR_Renderer::PSOKey& Key)
+{
+    if (GraphicsDesc.pRenderPass != nullptr)
+        return false;
+
+    std::vector<Uint8> Record;
+    WriteEntry(Record, GraphicsDesc, Key);
+
+    const auto it = std::lower_bound(m_Records.begin(), m_Records.end(), Record);
+    if (it != m_Records.end() && *it == Record)
+        return false;
+
+    Entry NewEntry;
+    NewEntry.GraphicsDesc             = GraphicsDesc;
+    NewEntry.GraphicsDesc.InputLayout = {};
+    NewEntry.Key                      = Key;
+
+    m_Entries.insert(m_Entries.begin() + (it - m_Records.begin()), NewEntry);
+    m_Records.insert(it, std::move(Record));
+    return true;
+}
+
+void PBR_PSOManifest::Clear()
+{
+    m_Records.clear();
+    m_Entries.clear();
+}
+
+void PBR_PSOManifest::Serialize(std::vector<Uint8>& Data) const
+{
+    Data.clear();
+
+    ManifestWriter Writer{Data};
+    Writer.WriteBytes(ManifestMagic, sizeof(ManifestMagic));
+    Writer.WriteVarUint(ManifestVersion);
+    Writer.WriteVarUint(m_Records.size());
+    for (const std::vector<Uint8>& Record : m_Records)
+    {
+        Writer.WriteVarUint(Record.size());
+        Writer.WriteBytes(Record.data(), Record.size());
+    }
+}
+
+bool PBR_PSOManifest::Deserialize(const void* pData, size_t Size)
+{
+    if (pData == nullptr && Size != 0)
+        return false;
+
+    ManifestReader Reader{static_cast<const Uint8*>(pData), Size};
+
+    const Uint8* pMagic = Reader.ReadBytes(sizeof(ManifestMagic));
+    if (pMagic == nullptr || std::memcmp(pMagic, ManifestMagic, sizeof(ManifestMagic)) != 0)
+        return false;
+
+    if (Reader.ReadVarUint() != ManifestVersion)
+        return false;
+
+    // Entries are decoded before any of them is added, so that invalid data leaves the manifest intact
+    const Uint64       EntryCount = Reader.ReadVarUint();
+    std::vector<Entry> Entries;
+    for (Uint64 i = 0; i < EntryCount && Reader.IsValid(); ++i)
+    {
+        const Uint64 RecordSize = Reader.ReadVarUint();
+        const Uint8* pRecord    = Reader.ReadBytes(static_cast<size_t>(RecordSize));
+        if (pRecord == nullptr)
+            break;
+
+        Entries.emplace_back();
+        if (!ReadEntry(pRecord, static_cast<size_t>(RecordSize), Entries.back()))
+            return false;
+    }
+    if (!Reader.IsValid() || !Reader.IsEnd())
+        return false;
+
+    for (const Entry& NewEntry : Entries)
+        Add(NewEntry.GraphicsDesc, NewEntry.Key);
+
+    return true;
+}
+
+bool PBR_PSOManifest::Save(const char* FilePath) const
+{
+    std::vector<Uint8> Data;
+    Serialize(Data);
+
+    FileWrapper File{FilePath, EFileAccessMode::Overwrite};
+    if (!File || !File->Write(Data.data(), Data.size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write PBR PSO manifest to file '", FilePath, "'");
+        return false;
+    }
+    return true;
+}
+
+bool PBR_PSOManifest::Load(const char* FilePath)
+{
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(FilePath, Data, true))
+        return false;
+
+    if (!Deserialize(Data.data(), Data.size()))
+    {
+        // The manifest may have been written by a different version of the renderer
+        LOG_WARNING_MESSAGE("File '", FilePath, "' is not a valid PBR PSO manifest");
+        return false;
+    }
+    return true;
+}
+
+} // namespace Diligent
@@ -25,8 +25,14 @@
  */
 
 #include "PBR_Renderer.hpp"
+#include "PBR_PSOManifest.hpp"
+#include "PBR_ShaderSourceCache.hpp"
+#include "PBR_IBLCache.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <tuple>
 #include <vector>
 #include <limits.h>
 
@@ -80,8 +86,8 @@ PBR_Renderer::PSOKey::PSOKey(RenderPassType                         _Type,
     if (HasStaticShaderTextureIds)
         StaticShaderTextureIds = *_pStaticShaderTextureIds;
 
-    static_assert(PSO_FLAG_LAST == Uint64{1} << Uint64{38}, "Please handle the new flag below, if necessary");
-    static_assert(static_cast<size_t>(RenderPassType::Count) == 3, "Please handle the new render pass type below, if necessary");
+    static_assert(PSO_FLAG_LAST == Uint64{1} << Uint64{39}, "Please handle the new flag below, if necessary");
+    static_assert(static_cast<size_t>(RenderPassType::Count) == 4, "Please handle the new render pass type below, if necessary");
     if (Type == RenderPassType::Shadow)
     {
         static constexpr PSO_FLAGS ShadowPassFlags =
@@ -112,6 +118,35 @@ PBR_Renderer::PSOKey::PSOKey(RenderPassType                         _Type,
         LoadingAnimation = LoadingAnimationMode::None;
         DebugView        = DebugViewType::None;
     }
+    else if (Type == RenderPassType::DepthOnly)
+    {
+        if (AlphaMode == ALPHA_MODE_MASK)
+        {
+            // Alpha-tested primitives need the base color to evaluate the alpha cutoff
+            static constexpr PSO_FLAGS DepthOnlyMaskFlags =
+                PSO_FLAG_USE_COLOR_MAP |
+                PSO_FLAG_USE_TEXCOORD0 |
+                PSO_FLAG_USE_TEXCOORD1 |
+                PSO_FLAG_USE_JOINTS |
+                PSO_FLAG_USE_TEXTURE_ATLAS |
+                PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
+                PSO_FLAG_ALL_USER_DEFINED;
+            Flags &= DepthOnlyMaskFlags;
+        }
+        else
+        {
+            // Other primitives only need positions and are rendered without a pixel shader
+            static constexpr PSO_FLAGS DepthOnlyFlags =
+                PSO_FLAG_USE_JOINTS |
+                PSO_FLAG_ALL_USER_DEFINED;
+            Flags &= DepthOnlyFlags;
+
+            AlphaMode = ALPHA_MODE_OPAQUE;
+        }
+
+        LoadingAnimation = LoadingAnimationMode::None;
+        DebugView        = DebugViewType::None;
+    }
 
     if (DebugView == DebugViewType::SceneDepth)
     {
@@ -130,7 +165,9 @@ PBR_Renderer::PSOKey::PSOKey(RenderPassType                         _Type,
         DebugView = DebugViewType::None;
     }
 
-    Hash = ComputeHash(Type, Flags, AlphaMode, CullMode, static_cast<Uint32>(DebugView), static_cast<Uint32>(LoadingAnimation), UserValue, HasStaticShaderTextureIds);
+    static_assert(offsetof(PSOKey, Padding) + sizeof(Padding) - offsetof(PSOKey, Type) == sizeof(Uint64),
+                  "Attributes from Type to Padding must form a single 64-bit word");
+    Hash = ComputeHash(Flags, GetPackedAttribs(), UserValue);
     if (HasStaticShaderTextureIds)
         HashCombine(Hash, ComputeHashRaw(StaticShaderTextureIds.data(), StaticShaderTextureIds.size() * sizeof(StaticShaderTextureIds[0])));
 }
@@ -230,13 +267,14 @@ std::string PBR_Renderer::GetPSOFlagsString(PSO_FLAGS Flags)
             case PSO_FLAG_UNSHADED:                  FlagsStr += "UNSHADED"; break;
             case PSO_FLAG_COMPUTE_MOTION_VECTORS:    FlagsStr += "MOTION_VECTORS"; break;
             case PSO_FLAG_ENABLE_SHADOWS:            FlagsStr += "SHADOWS"; break;
+            case PSO_FLAG_USE_CLUSTERED_LIGHTS:      FlagsStr += "CLUSTERED_LIGHTS"; break;
                 // clang-format on
 
             default:
                 FlagsStr += std::to_string(PlatformMisc::GetLSB(Flag));
         }
     }
-    static_assert(PSO_FLAG_LAST == 1ull << 38ull, "Please update the switch above to handle the new flag");
+    static_assert(PSO_FLAG_LAST == 1ull << 39ull, "Please update the switch above to handle the new flag");
 
     return FlagsStr;
 }
@@ -255,12 +293,13 @@ const char* PBR_Renderer::GetAlphaModeString(ALPHA_MODE AlphaMode)
 
 const char* PBR_Renderer::GetRenderPassTypeString(RenderPassType Type)
 {
-    static_assert(static_cast<size_t>(RenderPassType::Count) == 3, "Please add the new render pass type below");
+    static_assert(static_cast<size_t>(RenderPassType::Count) == 4, "Please add the new render pass type below");
     switch (Type)
     {
         case RenderPassType::Main: return "main";
         case RenderPassType::Shadow: return "shadow";
         case RenderPassType::OITLayers: return "OIT layers";
+        case RenderPassType::DepthOnly: return "depth only";
         default: UNEXPECTED("Unknown render pass type");
     }
     return "";
@@ -336,7 +375,8 @@ PBR_Renderer::PBR_Renderer(IRenderDevice*     pDevice,
     m_Settings{
         [this](CreateInfo CI) {
             CI.InputLayout               = m_InputLayout;
-            CI.SheenAlbedoScalingLUTPath = nullptr;
+            CI.SheenAlbedoScalingLUTPath  = nullptr;
+            CI.ShaderSourceCacheDirectory = nullptr;
             return CI;
         }(CI)},
     m_Device{pDevice, pStateCache},
@@ -344,6 +384,11 @@ PBR_Renderer::PBR_Renderer(IRenderDevice*     pDevice,
     m_PBRMaterialAttribsCB{CI.pMaterialAttribsCB},
     m_JointsBuffer{CI.pJointsBuffer}
 {
+    if (m_Settings.CacheShaderSources && !m_Settings.AllowHotShaderReload)
+    {
+        m_ShaderSourceCache = std::make_unique<PBR_ShaderSourceCache>(CI.ShaderSourceCacheDirectory);
+    }
+
     if (m_Settings.EnableIBL)
     {
         PrecomputeBRDF(pCtx, m_Settings.NumBRDFSamples);
@@ -538,7 +583,7 @@ PBR_Renderer::~PBR_Renderer()
         size_t NumPSOs = 0;
         for (const auto& it : m_PSOs)
         {
-            NumPSOs += it.second.size();
+            NumPSOs += it.second.Size();
         }
         LOG_INFO_MESSAGE("PBR Renderer objects: PSO: ", NumPSOs, "; VS: ", m_VertexShaders.size(), "; PS: ", m_PixelShaders.size());
     }
@@ -666,6 +711,138 @@ static Uint32 GetDefaultDiffuseSamplesCount(const GraphicsAdapterInfo& AdapterIn
 #endif
 }
 
+static bool IsCachedCubemapCompatible(const PBR_IBLCache::CubemapData& Cubemap, const TextureDesc& Desc)
+{
+    return Cubemap.IsValid() &&
+        Cubemap.Format == Desc.Format &&
+        Cubemap.Dimension == Desc.Width &&
+        Cubemap.MipLevels == Desc.MipLevels;
+}
+
+static void UploadCubemap(IDeviceContext* pCtx, ITexture* pCubemap, const PBR_IBLCache::CubemapData& Cubemap)
+{
+    for (Uint32 face = 0; face < 6; ++face)
+    {
+        for (Uint32 mip = 0; mip < Cubemap.MipLevels; ++mip)
+        {
+            const Uint32            MipDim = Cubemap.GetMipDimension(mip);
+            const TextureSubResData SubresData{&Cubemap.Data[Cubemap.GetSubresourceOffset(face, mip)], Cubemap.GetRowSize(mip)};
+            pCtx->UpdateTexture(pCubemap, mip, face, Box{0, MipDim, 0, MipDim}, SubresData,
+                                RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+    }
+}
+
+// Copies all subresources of the cube map to the CPU. The function waits until the GPU is idle.
+static bool ReadBackCubemap(IRenderDevice* pDevice, IDeviceContext* pCtx, ITexture* pCubemap, PBR_IBLCache::CubemapData& Cubemap)
+{
+    const TextureDesc&          Desc       = pCubemap->GetDesc();
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Desc.Format);
+    if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+    {
+        UNEXPECTED("Compressed IBL cube maps are not supported");
+        return false;
+    }
+
+    TextureDesc StagingTexDesc    = Desc;
+    StagingTexDesc.Name           = "IBL cube map staging texture";
+    StagingTexDesc.Type           = RESOURCE_DIM_TEX_2D_ARRAY;
+    StagingTexDesc.Usage          = USAGE_STAGING;
+    StagingTexDesc.BindFlags      = BIND_NONE;
+    StagingTexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingTexDesc.MiscFlags      = MISC_TEXTURE_FLAG_NONE;
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTex);
+    if (!pStagingTex)
+    {
+        LOG_ERROR_MESSAGE("Failed to create staging texture to read back cube map '", Desc.Name, "'");
+        return false;
+    }
+
+    for (Uint32 face = 0; face < 6; ++face)
+    {
+        for (Uint32 mip = 0; mip < Desc.MipLevels; ++mip)
+        {
+            CopyTextureAttribs CopyAttribs{pCubemap, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+            CopyAttribs.SrcMipLevel = mip;
+            CopyAttribs.SrcSlice    = face;
+            CopyAttribs.DstMipLevel = mip;
+            CopyAttribs.DstSlice    = face;
+            pCtx->CopyTexture(CopyAttribs);
+        }
+    }
+    pCtx->WaitForIdle();
+
+    Cubemap.Format    = Desc.Format;
+    Cubemap.TexelSize = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+    Cubemap.Dimension = Desc.Width;
+    Cubemap.MipLevels = Desc.MipLevels;
+    Cubemap.Data.resize(Cubemap.GetRequiredDataSize());
+
+    // The GPU is idle, but mapping the texture in D3D11 with the MAP_FLAG_DO_NOT_WAIT flag may still return null.
+    const MAP_FLAGS MapFlags = pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D11 ?
+        MAP_FLAG_NONE :
+        MAP_FLAG_DO_NOT_WAIT;
+    for (Uint32 face = 0; face < 6; ++face)
+    {
+        for (Uint32 mip = 0; mip < Desc.MipLevels; ++mip)
+        {
+            MappedTextureSubresource MappedData;
+            pCtx->MapTextureSubresource(pStagingTex, mip, face, MAP_READ, MapFlags, nullptr, MappedData);
+            if (MappedData.pData == nullptr)
+            {
+                UNEXPECTED("Mapped data pointer is null");
+                return false;
+            }
+
+            const size_t RowSize = Cubemap.GetRowSize(mip);
+            Uint8*       pDst    = &Cubemap.Data[Cubemap.GetSubresourceOffset(face, mip)];
+            for (Uint32 row = 0; row < Cubemap.GetMipDimension(mip); ++row)
+            {
+                memcpy(pDst + RowSize * row, static_cast<const Uint8*>(MappedData.pData) + MappedData.Stride * row, RowSize);
+            }
+            pCtx->UnmapTextureSubresource(pStagingTex, mip, face);
+        }
+    }
+
+    return true;
+}
+
+// Projects the most detailed level of the prefiltered environment map, which is computed with zero roughness
+static bool ProjectIrradianceSH(const PBR_IBLCache::CubemapData& PrefilteredEnvMap, PBR_IrradianceSH& SH)
+{
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(PrefilteredEnvMap.Format);
+    if (FmtAttribs.ComponentType != COMPONENT_TYPE_FLOAT ||
+        FmtAttribs.NumComponents < 3 ||
+        (FmtAttribs.ComponentSize != 2 && FmtAttribs.ComponentSize != 4))
+    {
+        LOG_WARNING_MESSAGE("Irradiance SH can't be projected from the prefiltered environment map with format ", FmtAttribs.Name,
+                            ". Only 16- and 32-bit float formats with at least 3 components are supported.");
+        return false;
+    }
+
+    PBR_IrradianceSH::SourceImage Faces[6];
+    for (Uint32 face = 0; face < 6; ++face)
+    {
+        Faces[face].pData         = &PrefilteredEnvMap.Data[PrefilteredEnvMap.GetSubresourceOffset(face, 0)];
+        Faces[face].Width         = PrefilteredEnvMap.Dimension;
+        Faces[face].Height        = PrefilteredEnvMap.Dimension;
+        Faces[face].ValueType     = FmtAttribs.ComponentSize == 2 ? VT_FLOAT16 : VT_FLOAT32;
+        Faces[face].NumComponents = FmtAttribs.NumComponents;
+    }
+    return PBR_IrradianceSH::ProjectCubemap(Faces, SH);
+}
+
+static void WriteIrradianceSH(IDeviceContext* pCtx, IBuffer* pBuffer, const PBR_IrradianceSH& SH)
+{
+    HLSL::PBRIrradianceSHAttribs SHAttribs;
+    for (Uint32 i = 0; i < PBR_IrradianceSH::NumCoeffs; ++i)
+        SHAttribs.Coeffs[i] = float4{SH.Coeffs[i], 0};
+
+    pCtx->UpdateBuffer(pBuffer, 0, sizeof(SHAttribs), &SHAttribs, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
 TextureDesc PBR_Renderer::GetIrradianceCubeDesc(const char*    Name,
                                                 TEXTURE_FORMAT Format,
                                                 Uint32         Dimension)
@@ -726,6 +903,15 @@ RefCntAutoPtr<ITexture> PBR_Renderer::CreatePrefilteredEnvMap(IDeviceContext* pC
     return pPrefilteredEnvMap;
 }
 
+RefCntAutoPtr<IBuffer> PBR_Renderer::CreateIrradianceSHBuffer(const char* Name) const
+{
+    BufferDesc Desc{Name, sizeof(HLSL::PBRIrradianceSHAttribs), BIND_UNIFORM_BUFFER, USAGE_DEFAULT};
+
+    RefCntAutoPtr<IBuffer> pBuffer = m_Device.CreateBuffer(Desc);
+    VERIFY_EXPR(pBuffer);
+    return pBuffer;
+}
+
 void PBR_Renderer::PrecomputeCubemaps(IDeviceContext*                  pCtx,
                                       const PrecomputeCubemapsAttribs& Attribs)
 {
@@ -744,6 +930,32 @@ void PBR_Renderer::PrecomputeCubemaps(IDeviceContext*                  pCtx,
         return;
     }
 
+    // clang-format off
+    StateTransitionDesc Barriers[] = 
+    {
+        {Attribs.pPrefilteredEnvMap, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {Attribs.pIrradianceCube,    RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE}
+    };
+    // clang-format on
+
+    PBR_IBLCache* const pCache = Attribs.ContentKey != 0 ? Attribs.pCache : nullptr;
+    if (pCache != nullptr)
+    {
+        const PBR_IBLCache::Entry* pEntry = pCache->Find(Attribs.ContentKey);
+        if (pEntry != nullptr &&
+            IsCachedCubemapCompatible(pEntry->IrradianceCube, Attribs.pIrradianceCube->GetDesc()) &&
+            IsCachedCubemapCompatible(pEntry->PrefilteredEnvMap, Attribs.pPrefilteredEnvMap->GetDesc()))
+        {
+            UploadCubemap(pCtx, Attribs.pIrradianceCube, pEntry->IrradianceCube);
+            UploadCubemap(pCtx, Attribs.pPrefilteredEnvMap, pEntry->PrefilteredEnvMap);
+            if (Attribs.pIrradianceSH != nullptr)
+                WriteIrradianceSH(pCtx, Attribs.pIrradianceSH, pEntry->IrradianceSH);
+
+            pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+            return;
+        }
+    }
+
     Uint32 NumDiffuseSamples  = Attribs.NumDiffuseSamples;
     Uint32 NumSpecularSamples = Attribs.NumSpecularSamples;
     if (NumSpecularSamples == 0)
@@ -958,15 +1170,21 @@ void PBR_Renderer::PrecomputeCubemaps(IDeviceContext*                  pCtx,
     // Release reference to the environment map
     ShaderResourceVariableX{PrefilterEnvMapTech.SRB, SHADER_TYPE_PIXEL, "g_EnvironmentMap"}.Set(nullptr);
 
+    pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
 
-    // clang-format off
-    StateTransitionDesc Barriers[] = 
+    if (pCache != nullptr || Attribs.pIrradianceSH != nullptr)
     {
-        {Attribs.pPrefilteredEnvMap, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
-        {Attribs.pIrradianceCube,    RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE}
-    };
-    // clang-format on
-    pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+        PBR_IBLCache::Entry NewEntry;
+        if (!ReadBackCubemap(m_Device, pCtx, Attribs.pPrefilteredEnvMap, NewEntry.PrefilteredEnvMap))
+            return;
+
+        const bool HasSH = ProjectIrradianceSH(NewEntry.PrefilteredEnvMap, NewEntry.IrradianceSH);
+        if (HasSH && Attribs.pIrradianceSH != nullptr)
+            WriteIrradianceSH(pCtx, Attribs.pIrradianceSH, NewEntry.IrradianceSH);
+
+        if (pCache != nullptr && HasSH && ReadBackCubemap(m_Device, pCtx, Attribs.pIrradianceCube, NewEntry.IrradianceCube))
+            pCache->Add(Attribs.ContentKey, std::move(NewEntry));
+    }
 }
 
 
@@ -1036,7 +1254,8 @@ void PBR_Renderer::InitCommonSRBVars(IShaderResourceBinding* pSRB,
 
 void PBR_Renderer::SetIBLResourceViews(IShaderResourceBinding* pSRB,
                                        ITextureView*           pIrradianceCubeSRV,
-                                       ITextureView*           pPrefilteredEnvMapSRV) const
+                                       ITextureView*           pPrefilteredEnvMapSRV,
+                                       IBuffer*                pIrradianceSH) const
 {
     if (!m_Settings.EnableIBL)
         return;
@@ -1047,7 +1266,10 @@ void PBR_Renderer::SetIBLResourceViews(IShaderResourceBinding* pSRB,
         return;
     }
 
-    ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_IrradianceMap"}.Set(pIrradianceCubeSRV);
+    if (m_Settings.UseIrradianceSH)
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "cbIrradianceSH"}.Set(pIrradianceSH);
+    else
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_IrradianceMap"}.Set(pIrradianceCubeSRV);
     ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_PrefilteredEnvMap"}.Set(pPrefilteredEnvMapSRV);
 }
 
@@ -1069,6 +1291,27 @@ void PBR_Renderer::SetOITResources(IShaderResourceBinding* pSRB, const OITResour
     }
 }
 
+void PBR_Renderer::SetLightClusterResources(IShaderResourceBinding* pSRB, const LightClusterResources& Resources) const
+{
+    if (!m_Settings.EnableClusteredLighting)
+        return;
+
+    if (pSRB == nullptr)
+    {
+        UNEXPECTED("SRB must not be null");
+        return;
+    }
+
+    if (Resources.pAttribsCB != nullptr)
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "cbLightClusterAttribs"}.Set(Resources.pAttribsCB);
+    if (Resources.pLights != nullptr)
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_ClusteredLights"}.Set(Resources.pLights->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    if (Resources.pClusterGrid != nullptr)
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_LightClusterGrid"}.Set(Resources.pClusterGrid->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    if (Resources.pLightIndices != nullptr)
+        ShaderResourceVariableX{pSRB, SHADER_TYPE_PIXEL, "g_LightIndexList"}.Set(Resources.pLightIndices->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+}
+
 void PBR_Renderer::SetMaterialTexture(IShaderResourceBinding* pSRB, ITextureView* pTexSRV, TEXTURE_ATTRIB_ID TextureId) const
 {
     if (m_Settings.ShaderTexturesArrayMode == SHADER_TEXTURE_ARRAY_MODE_NONE)
@@ -1270,7 +1513,10 @@ void PBR_Renderer::CreateSignature()
     {
         constexpr WebGPUResourceAttribs WGPUCubeMap{WEB_GPU_BINDING_TYPE_DEFAULT, RESOURCE_DIM_TEX_CUBE};
         AddTextureAndSampler("g_PreintegratedGGX", Sam_LinearClamp, "g_LinearClampSampler", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-        AddTextureAndSampler("g_IrradianceMap", Sam_LinearClamp, "g_LinearClampSampler", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, WGPUCubeMap);
+        if (m_Settings.UseIrradianceSH)
+            SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "cbIrradianceSH", SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+        else
+            AddTextureAndSampler("g_IrradianceMap", Sam_LinearClamp, "g_LinearClampSampler", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, WGPUCubeMap);
         AddTextureAndSampler("g_PrefilteredEnvMap", Sam_LinearClamp, "g_LinearClampSampler", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, WGPUCubeMap);
 
         if (m_Settings.EnableSheen)
@@ -1290,6 +1536,14 @@ void PBR_Renderer::CreateSignature()
         AddTextureAndSampler("g_ShadowMap", Sam_ComparisonLinearClamp, "g_ShadowMap_sampler", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, WGPUShadowMap);
     }
 
+    if (m_Settings.EnableClusteredLighting)
+    {
+        SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "cbLightClusterAttribs", SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+        SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "g_ClusteredLights", SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+        SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "g_LightClusterGrid", SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+        SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "g_LightIndexList", SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+
     if (m_Settings.OITLayerCount > 0)
     {
         SignatureDesc.AddResource(SHADER_TYPE_PIXEL, "g_OITLayers", 1u, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
@@ -1421,6 +1675,7 @@ ShaderMacroHelper PBR_Renderer::DefineMacros(const PSOKey& Key) const
 
     Macros.Add("USE_IBL_ENV_MAP_LOD", true);
     Macros.Add("USE_HDR_IBL_CUBEMAPS", true);
+    Macros.Add("USE_IBL_IRRADIANCE_SH", m_Settings.UseIrradianceSH);
     Macros.Add("USE_SEPARATE_METALLIC_ROUGHNESS_TEXTURES", m_Settings.UseSeparateMetallicRoughnessTextures);
 
     if (m_Settings.EnableShadows)
@@ -1482,7 +1737,7 @@ ShaderMacroHelper PBR_Renderer::DefineMacros(const PSOKey& Key) const
     Macros.Add("LOADING_ANIMATION_TRANSITIONING", static_cast<int>(LoadingAnimationMode::Transitioning));
     // clang-format on
 
-    static_assert(PSO_FLAG_LAST == PSO_FLAG_BIT(38), "Did you add new PSO Flag? You may need to handle it here.");
+    static_assert(PSO_FLAG_LAST == PSO_FLAG_BIT(39), "Did you add new PSO Flag? You may need to handle it here.");
 #define ADD_PSO_FLAG_MACRO(Flag) Macros.Add(#Flag, (PSOFlags & PSO_FLAG_##Flag) != PSO_FLAG_NONE)
     ADD_PSO_FLAG_MACRO(USE_COLOR_MAP);
     ADD_PSO_FLAG_MACRO(USE_NORMAL_MAP);
@@ -1526,6 +1781,7 @@ ShaderMacroHelper PBR_Renderer::DefineMacros(const PSOKey& Key) const
     ADD_PSO_FLAG_MACRO(UNSHADED);
     ADD_PSO_FLAG_MACRO(COMPUTE_MOTION_VECTORS);
     ADD_PSO_FLAG_MACRO(ENABLE_SHADOWS);
+    ADD_PSO_FLAG_MACRO(USE_CLUSTERED_LIGHTS);
 #undef ADD_PSO_FLAG_MACRO
 
     Macros.Add("TEX_COLOR_CONVERSION_MODE_NONE", CreateInfo::TEX_COLOR_CONVERSION_MODE_NONE);
@@ -1959,6 +2215,23 @@ void PBR_Renderer::CreatePSO(PsoHashMapType&             PsoHashMap,
         (AsyncCompile ? SHADER_COMPILE_FLAG_ASYNCHRONOUS : SHADER_COMPILE_FLAG_NONE) |
         (m_Settings.PackMatrixRowMajor ? SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR : SHADER_COMPILE_FLAG_NONE);
 
+    // Replaces the shader file with the cached source that has all includes expanded.
+    // If the source can't be expanded, the shader is created from the file as usual.
+    auto SetCachedShaderSource = [this](ShaderCreateInfo& ShaderCI, std::initializer_list<PBR_ShaderSourceCache::GeneratedInclude> GeneratedIncludes) {
+        if (!m_ShaderSourceCache)
+            return;
+
+        // Generated includes are only resolved from the list, so that their contents are always part of the cache key
+        const std::string* pSource = m_ShaderSourceCache->Get(ShaderCI.FilePath, &DiligentFXShaderSourceStreamFactory::GetInstance(),
+                                                              GeneratedIncludes.begin(), static_cast<Uint32>(GeneratedIncludes.size()));
+        if (pSource != nullptr)
+        {
+            ShaderCI.FilePath     = nullptr;
+            ShaderCI.Source       = pSource->c_str();
+            ShaderCI.SourceLength = pSource->size();
+        }
+    };
+
     RefCntAutoPtr<IShader>& pVS = m_VertexShaders[{
         RenderPassType::Main, // Vertex shaders are the same for all render passes
         PSOFlags,
@@ -1981,6 +2254,11 @@ void PBR_Renderer::CreatePSO(PsoHashMapType&             PsoHashMap,
             {"PBR VS", SHADER_TYPE_VERTEX, UseCombinedSamplers},
         };
         ShaderCI.CompileFlags = ShaderCompileFlags;
+        SetCachedShaderSource(ShaderCI,
+                              {
+                                  {"VSInputStruct.generated", &VSInputStruct},
+                                  {"VSOutputStruct.generated", &VSOutputStruct},
+                              });
 
         std::string GLSLSource;
         if (m_Settings.PrimitiveArraySize > 0)
@@ -2010,42 +2288,56 @@ void PBR_Renderer::CreatePSO(PsoHashMapType&             PsoHashMap,
         pVS = m_Device.CreateShader(ShaderCI);
     }
 
-    RefCntAutoPtr<IShader>& pPS = m_PixelShaders[{
-        PSOFlags,
-        // Non-OIT blend uses the same shader as opaque
-        (Key.GetAlphaMode() == ALPHA_MODE_BLEND && OITLayerCount == 0) ? ALPHA_MODE_OPAQUE : Key.GetAlphaMode(),
-        CULL_MODE_BACK,
-        Key,
-    }];
-    if (!pPS)
+    // Depth-only pass does not need a pixel shader unless the alpha cutoff has to be evaluated
+    const bool UsePixelShader = Key.GetType() != RenderPassType::DepthOnly || Key.GetAlphaMode() == ALPHA_MODE_MASK;
+
+    RefCntAutoPtr<IShader> pPS;
+    if (UsePixelShader)
     {
-        const char* SrcFile = nullptr;
-        const char* Name    = nullptr;
-        if (Key.GetType() == RenderPassType::OITLayers)
+        RefCntAutoPtr<IShader>& pCachedPS = m_PixelShaders[{
+            PSOFlags,
+            // Non-OIT blend uses the same shader as opaque
+            (Key.GetAlphaMode() == ALPHA_MODE_BLEND && OITLayerCount == 0) ? ALPHA_MODE_OPAQUE : Key.GetAlphaMode(),
+            CULL_MODE_BACK,
+            Key,
+        }];
+        if (!pCachedPS)
         {
-            SrcFile = "UpdateOITLayers.psh";
-            Name    = "OIT Layers PS";
-            // WebGPU does not support the earlydepthstencil attribute, so we have to
-            // perform depth testing manually in the shader.
-            Macros.Add("USE_MANUAL_DEPTH_TEST", m_Device.GetDeviceInfo().IsWebGPUDevice());
-        }
-        else
-        {
-            SrcFile = !IsUnshaded ? "RenderPBR.psh" : "RenderUnshaded.psh";
-            Name    = !IsUnshaded ? "PBR PS" : "Unshaded PS";
+            const char* SrcFile = nullptr;
+            const char* Name    = nullptr;
+            if (Key.GetType() == RenderPassType::OITLayers)
+            {
+                SrcFile = "UpdateOITLayers.psh";
+                Name    = "OIT Layers PS";
+                // WebGPU does not support the earlydepthstencil attribute, so we have to
+                // perform depth testing manually in the shader.
+                Macros.Add("USE_MANUAL_DEPTH_TEST", m_Device.GetDeviceInfo().IsWebGPUDevice());
+            }
+            else
+            {
+                SrcFile = !IsUnshaded ? "RenderPBR.psh" : "RenderUnshaded.psh";
+                Name    = !IsUnshaded ? "PBR PS" : "Unshaded PS";
+            }
+            ShaderCreateInfo ShaderCI{
+                SrcFile,
+                pShaderSourceFactory,
+                "main",
+                Macros,
+                SHADER_SOURCE_LANGUAGE_HLSL,
+                {Name, SHADER_TYPE_PIXEL, UseCombinedSamplers},
+            };
+            ShaderCI.CompileFlags                   = ShaderCompileFlags;
+            ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+            SetCachedShaderSource(ShaderCI,
+                                  {
+                                      {"VSOutputStruct.generated", &VSOutputStruct},
+                                      {"PSOutputStruct.generated", &PSMainSource.OutputStruct},
+                                      {"PSMainFooter.generated", &PSMainSource.Footer},
+                                  });
+
+            pCachedPS = m_Device.CreateShader(ShaderCI);
         }
-        ShaderCreateInfo ShaderCI{
-            SrcFile,
-            pShaderSourceFactory,
-            "main",
-            Macros,
-            SHADER_SOURCE_LANGUAGE_HLSL,
-            {Name, SHADER_TYPE_PIXEL, UseCombinedSamplers},
-        };
-        ShaderCI.CompileFlags                   = ShaderCompileFlags;
-        ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
-
-        pPS = m_Device.CreateShader(ShaderCI);
+        pPS = pCachedPS;
     }
 
     GraphicsPipeline             = GraphicsDesc;
@@ -2152,7 +2444,7 @@ void PBR_Renderer::CreatePSO(PsoHashMapType&             PsoHashMap,
     RefCntAutoPtr<IPipelineState> PSO        = m_Device.CreateGraphicsPipelineState(PSOCreateInfo);
     VERIFY_EXPR(PSO);
 
-    PsoHashMap[Key] = PSO;
+    PsoHashMap.Insert(Key, PSO);
 }
 
 void PBR_Renderer::CreateResourceBinding(IShaderResourceBinding** ppSRB, Uint32 Idx) const
@@ -2164,9 +2456,12 @@ PBR_Renderer::PsoCacheAccessor PBR_Renderer::GetPsoCacheAccessor(const GraphicsP
 {
     VERIFY(GraphicsDesc.InputLayout == InputLayoutDesc{}, "Input layout is ignored. It is defined in create info");
 
+    std::lock_guard<std::mutex> Lock{m_PSOsMtx};
+
     auto it = m_PSOs.find(GraphicsDesc);
     if (it == m_PSOs.end())
-        it = m_PSOs.emplace(GraphicsDesc, PsoHashMapType{}).first;
+        it = m_PSOs.emplace(std::piecewise_construct, std::forward_as_tuple(GraphicsDesc), std::forward_as_tuple()).first;
+    // Hash map nodes are never moved, so the accessor may keep references to the key and the value
     return {*this, it->second, it->first};
 }
 
@@ -2216,6 +2511,10 @@ IPipelineState* PBR_Renderer::GetPSO(PsoHashMapType&             PsoHashMap,
     {
         Flags &= ~PSO_FLAG_ENABLE_SHADOWS;
     }
+    if (!m_Settings.EnableClusteredLighting || (Flags & PSO_FLAG_USE_LIGHTS) == 0)
+    {
+        Flags &= ~PSO_FLAG_USE_CLUSTERED_LIGHTS;
+    }
 
     if (m_Settings.MaxJointCount == 0)
     {
@@ -2254,20 +2553,114 @@ IPipelineState* PBR_Renderer::GetPSO(PsoHashMapType&             PsoHashMap,
         Flags &= ~PSO_FLAG_USE_THICKNESS_MAP;
     }
 
-    const PSOKey UpdatedKey{Flags, Key};
+    // Keys are normalized at construction, so the key only needs to be rebuilt if the flags have changed
+    const PSOKey UpdatedKey = Flags == Key.GetFlags() ? Key : PSOKey{Flags, Key};
 
-    auto it = PsoHashMap.find(UpdatedKey);
-    if (it == PsoHashMap.end())
+    RefCntAutoPtr<IPipelineState>* pPSO = PsoHashMap.Find(UpdatedKey);
+    if (pPSO == nullptr && (GetFlags & PsoCacheAccessor::GET_FLAG_CREATE_IF_NULL))
     {
-        if (GetFlags & PsoCacheAccessor::GET_FLAG_CREATE_IF_NULL)
+        std::lock_guard<std::mutex> Lock{m_CreatePSOMtx};
+
+        // Another thread may have created the PSO while this thread was waiting for the lock
+        pPSO = PsoHashMap.Find(UpdatedKey);
+        if (pPSO == nullptr)
         {
             CreatePSO(PsoHashMap, GraphicsDesc, UpdatedKey, GetFlags & PsoCacheAccessor::GET_FLAG_ASYNC_COMPILE);
-            it = PsoHashMap.find(UpdatedKey);
-            VERIFY_EXPR(it != PsoHashMap.end());
+            pPSO = PsoHashMap.Find(UpdatedKey);
+            VERIFY_EXPR(pPSO != nullptr);
+
+            if (m_pPSOManifest != nullptr)
+                m_pPSOManifest->Add(GraphicsDesc, UpdatedKey);
         }
     }
 
-    return it != PsoHashMap.end() ? it->second.RawPtr() : nullptr;
+    return pPSO != nullptr ? pPSO->RawPtr() : nullptr;
+}
+
+void PBR_Renderer::SetPSOManifest(PBR_PSOManifest* pManifest)
+{
+    std::lock_guard<std::mutex> CreateLock{m_CreatePSOMtx};
+
+    m_pPSOManifest = pManifest;
+    if (m_pPSOManifest == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> PSOsLock{m_PSOsMtx};
+    for (const auto& GraphicsDescIt : m_PSOs)
+    {
+        GraphicsDescIt.second.ProcessEntries([&](const PSOKey& Key, const RefCntAutoPtr<IPipelineState>&) {
+            m_pPSOManifest->Add(GraphicsDescIt.first, Key);
+        });
+    }
+}
+
+struct PBR_Renderer::PSOWarmUpState
+{
+    std::vector<PBR_PSOManifest::Entry>        Entries;
+    size_t                                     NextEntry       = 0;
+    Uint32                                     MaxPendingCount = 0;
+    std::vector<RefCntAutoPtr<IPipelineState>> PendingPSOs;
+    PSOWarmUpProgress                          Progress;
+};
+
+void PBR_Renderer::BeginPSOWarmUp(const PBR_PSOManifest& Manifest, Uint32 MaxPendingCount)
+{
+    m_PSOWarmUp                      = std::make_unique<PSOWarmUpState>();
+    m_PSOWarmUp->Entries             = Manifest.GetEntries();
+    m_PSOWarmUp->MaxPendingCount     = std::max(MaxPendingCount, 1u);
+    m_PSOWarmUp->Progress.TotalCount = static_cast<Uint32>(m_PSOWarmUp->Entries.size());
+}
+
+PBR_Renderer::PSOWarmUpProgress PBR_Renderer::UpdatePSOWarmUp()
+{
+    if (!m_PSOWarmUp)
+        return {};
+
+    PSOWarmUpState&    WarmUp   = *m_PSOWarmUp;
+    PSOWarmUpProgress& Progress = WarmUp.Progress;
+    if (Progress.IsComplete())
+        return Progress;
+
+    PsoCacheAccessor::GET_FLAGS GetFlags = PsoCacheAccessor::GET_FLAG_CREATE_IF_NULL;
+    if (m_Device.GetDeviceInfo().Features.AsyncShaderCompilation != DEVICE_FEATURE_STATE_DISABLED)
+        GetFlags |= PsoCacheAccessor::GET_FLAG_ASYNC_COMPILE;
+
+    while (WarmUp.NextEntry < WarmUp.Entries.size() && WarmUp.PendingPSOs.size() < WarmUp.MaxPendingCount)
+    {
+        const PBR_PSOManifest::Entry& Entry = WarmUp.Entries[WarmUp.NextEntry++];
+
+        IPipelineState* pPSO = GetPsoCacheAccessor(Entry.GraphicsDesc).Get(Entry.Key, GetFlags);
+        ++Progress.StartedCount;
+        if (pPSO != nullptr)
+            WarmUp.PendingPSOs.emplace_back(pPSO);
+        else
+            ++Progress.FailedCount;
+    }
+
+    auto PendingEnd = std::remove_if(WarmUp.PendingPSOs.begin(), WarmUp.PendingPSOs.end(),
+                                     [&Progress](const RefCntAutoPtr<IPipelineState>& pPSO) {
+                                         const PIPELINE_STATE_STATUS Status = pPSO->GetStatus();
+                                         if (Status == PIPELINE_STATE_STATUS_READY)
+                                             ++Progress.ReadyCount;
+                                         else if (Status == PIPELINE_STATE_STATUS_FAILED)
+                                             ++Progress.FailedCount;
+                                         else
+                                             return false;
+                                         return true;
+                                     });
+    WarmUp.PendingPSOs.erase(PendingEnd, WarmUp.PendingPSOs.end());
+
+    return Progress;
+}
+
+void PBR_Renderer::CancelPSOWarmUp()
+{
+    if (!m_PSOWarmUp)
+        return;
+
+    m_PSOWarmUp->Progress.Cancelled = true;
+    m_PSOWarmUp->Entries.clear();
+    m_PSOWarmUp->PendingPSOs.clear();
 }
 
 
@@ -2508,6 +2901,11 @@ void PBR_Renderer::SetInternalShaderParameters(HLSL::PBRRendererShaderParameters
 }
 
 Uint32 PBR_Renderer::GetPBRPrimitiveAttribsSize(PSO_FLAGS Flags, Uint32 CustomDataSize) const
+{
+    return GetPBRPrimitiveAttribsSize(m_Settings, Flags, CustomDataSize);
+}
+
+Uint32 PBR_Renderer::GetPBRPrimitiveAttribsSize(const CreateInfo& Settings, PSO_FLAGS Flags, Uint32 CustomDataSize)
 {
     //struct PBRPrimitiveAttribs
     //{
@@ -2534,7 +2932,7 @@ Uint32 PBR_Renderer::GetPBRPrimitiveAttribsSize(PSO_FLAGS Flags, Uint32 CustomDa
     //    UserDefined CustomData;
     //};
 
-    const bool UseSkinPreTransform     = m_Settings.UseSkinPreTransform && (Flags & PSO_FLAG_USE_JOINTS) != 0;
+    const bool UseSkinPreTransform     = Settings.UseSkinPreTransform && (Flags & PSO_FLAG_USE_JOINTS) != 0;
     const bool UsePrevSkinPreTransform = UseSkinPreTransform && (Flags & PSO_FLAG_COMPUTE_MOTION_VECTORS) != 0;
 
     return (sizeof(float4x4) +                                                   // Transforms.NodeMatrix
@@ -2548,6 +2946,11 @@ Uint32 PBR_Renderer::GetPBRPrimitiveAttribsSize(PSO_FLAGS Flags, Uint32 CustomDa
 }
 
 Uint32 PBR_Renderer::GetPBRMaterialAttribsSize(PSO_FLAGS Flags) const
+{
+    return GetPBRMaterialAttribsSize(m_Settings, Flags);
+}
+
+Uint32 PBR_Renderer::GetPBRMaterialAttribsSize(const CreateInfo& Settings, PSO_FLAGS Flags)
 {
     // struct PBRMaterialShaderInfo
     // {
@@ -2563,7 +2966,7 @@ Uint32 PBR_Renderer::GetPBRMaterialAttribsSize(PSO_FLAGS Flags) const
     Uint32 NumTextureAttribs = 0;
     ProcessTexturAttribs(Flags, [&](int CurrIndex, PBR_Renderer::TEXTURE_ATTRIB_ID AttribId) //
                          {
-                             const int SrcAttribIndex = m_Settings.TextureAttribIndices[AttribId];
+                             const int SrcAttribIndex = Settings.TextureAttribIndices[AttribId];
                              if (SrcAttribIndex >= 0)
                              {
                                  ++NumTextureAttribs;
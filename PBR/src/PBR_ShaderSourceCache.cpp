@@ -0,0 +1,423 @@
+/*
+ *  Copyright 2019-2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PBR_ShaderSourceCache.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Protects from include cycles in files without include guards
+constexpr Uint32 MaxIncludeDepth = 64;
+
+// Format tag of the mirror files. Files with a different tag are ignored.
+constexpr char MirrorFormatTag[] = "PBR_ShaderSourceCache 2\n";
+
+Uint64 ComputeFNV1aHash(const std::string& Str)
+{
+    Uint64 Hash = 14695981039346656037ull;
+    for (char c : Str)
+    {
+        Hash ^= static_cast<Uint8>(c);
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+void AppendMirrorString(std::string& Out, const std::string& Str)
+{
+    Out.append(std::to_string(Str.size()));
+    Out.push_back('\n');
+    Out.append(Str);
+}
+
+bool ReadMirrorNumber(const char*& Pos, const char* End, Uint64& Value)
+{
+    Value = 0;
+
+    const char* Start = Pos;
+    while (Pos < End && *Pos >= '0' && *Pos <= '9')
+        Value = Value * 10 + static_cast<Uint64>(*Pos++ - '0');
+    if (Pos == Start || Pos == End || *Pos != '\n')
+        return false;
+    ++Pos;
+    return true;
+}
+
+bool ReadMirrorString(const char*& Pos, const char* End, std::string& Str)
+{
+    Uint64 Length = 0;
+    if (!ReadMirrorNumber(Pos, End, Length) || static_cast<Uint64>(End - Pos) < Length)
+        return false;
+    Str.assign(Pos, static_cast<size_t>(Length));
+    Pos += Length;
+    return true;
+}
+
+const char* SkipSpaces(const char* Pos, const char* End)
+{
+    while (Pos < End && (*Pos == ' ' || *Pos == '\t'))
+        ++Pos;
+    return Pos;
+}
+
+bool MatchKeyword(const char*& Pos, const char* End, const char* Keyword)
+{
+    const size_t Len = strlen(Keyword);
+    if (static_cast<size_t>(End - Pos) < Len || strncmp(Pos, Keyword, Len) != 0)
+        return false;
+    // The keyword must not be a prefix of a longer identifier
+    if (Pos + Len < End && (isalnum(static_cast<unsigned char>(Pos[Len])) || Pos[Len] == '_'))
+        return false;
+    Pos += Len;
+    return true;
+}
+
+// Updates the block comment state at the end of the line
+bool IsInBlockCommentAtEnd(const char* Pos, const char* End, bool InBlockComment)
+{
+    while (Pos < End)
+    {
+        if (InBlockComment)
+        {
+            if (Pos + 1 < End && Pos[0] == '*' && Pos[1] == '/')
+            {
+                InBlockComment = false;
+                Pos += 2;
+                continue;
+            }
+        }
+        else if (Pos + 1 < End && Pos[0] == '/')
+        {
+            if (Pos[1] == '/')
+                break;
+            if (Pos[1] == '*')
+            {
+                InBlockComment = true;
+                Pos += 2;
+                continue;
+            }
+        }
+        ++Pos;
+    }
+    return InBlockComment;
+}
+
+} // namespace
+
+struct PBR_ShaderSourceCache::ExpandContext
+{
+    IShaderSourceInputStreamFactory* pFactory             = nullptr;
+    const GeneratedInclude*          GeneratedIncludes    = nullptr;
+    Uint32                           NumGeneratedIncludes = 0;
+
+    // Files that have been included and contain #pragma once
+    std::unordered_set<std::string> OnceFiles;
+
+    // Files read from the factory, in the order they were first included
+    std::vector<std::string>        Dependencies;
+    std::unordered_set<std::string> DependencySet;
+};
+
+PBR_ShaderSourceCache::PBR_ShaderSourceCache(const char* MirrorDirectory) :
+    m_MirrorDirectory{MirrorDirectory != nullptr ? MirrorDirectory : ""}
+{
+    if (!m_MirrorDirectory.empty() && !FileSystem::PathExists(m_MirrorDirectory.c_str()))
+    {
+        if (!FileSystem::CreateDirectory(m_MirrorDirectory.c_str()))
+            LOG_WARNING_MESSAGE("Failed to create shader source cache directory '", m_MirrorDirectory, "'");
+    }
+}
+
+const std::string* PBR_ShaderSourceCache::ReadFile(const char* Name, IShaderSourceInputStreamFactory* pFactory)
+{
+    auto it = m_Files.find(Name);
+    if (it != m_Files.end())
+        return &it->second;
+
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    if (!pStream)
+        return nullptr;
+
+    std::string Source(pStream->GetSize(), '\0');
+    if (!Source.empty() && !pStream->Read(&Source[0], Source.size()))
+        return nullptr;
+
+    return &m_Files.emplace(Name, std::move(Source)).first->second;
+}
+
+bool PBR_ShaderSourceCache::ExpandIncludes(const char* Name, ExpandContext& Ctx, Uint32 Depth, std::string& Out)
+{
+    if (Depth > MaxIncludeDepth)
+    {
+        LOG_ERROR_MESSAGE("Include depth limit is exceeded while expanding '", Name, "'. This may indicate an include cycle.");
+        return false;
+    }
+
+    if (Ctx.OnceFiles.find(Name) != Ctx.OnceFiles.end())
+        return true;
+
+    const std::string* pSource = nullptr;
+    for (Uint32 i = 0; i < Ctx.NumGeneratedIncludes; ++i)
+    {
+        const GeneratedInclude& Include = Ctx.GeneratedIncludes[i];
+        if (Include.Name != nullptr && Include.Source != nullptr && strcmp(Include.Name, Name) == 0)
+        {
+            pSource = Include.Source;
+            break;
+        }
+    }
+    if (pSource == nullptr)
+    {
+        pSource = ReadFile(Name, Ctx.pFactory);
+        if (pSource == nullptr)
+            return false;
+        if (Ctx.DependencySet.emplace(Name).second)
+            Ctx.Dependencies.emplace_back(Name);
+    }
+
+    // File contents are stored in map nodes, so the pointer remains valid while nested includes are read
+    const char* Pos = pSource->data();
+    const char* End = Pos + pSource->size();
+
+    bool InBlockComment = false;
+    while (Pos < End)
+    {
+        const char* LineEnd = static_cast<const char*>(memchr(Pos, '\n', End - Pos));
+        const char* NextPos = LineEnd != nullptr ? LineEnd + 1 : End;
+        if (LineEnd == nullptr)
+            LineEnd = End;
+
+        bool IsDirectiveHandled = false;
+        if (!InBlockComment)
+        {
+            const char* Cur = SkipSpaces(Pos, LineEnd);
+            if (Cur < LineEnd && *Cur == '#')
+            {
+                Cur = SkipSpaces(Cur + 1, LineEnd);
+                if (MatchKeyword(Cur, LineEnd, "include"))
+                {
+                    Cur = SkipSpaces(Cur, LineEnd);
+                    if (Cur < LineEnd && (*Cur == '"' || *Cur == '<'))
+                    {
+                        const char        Terminator = *Cur == '"' ? '"' : '>';
+                        const char* const NameStart  = Cur + 1;
+                        const char*       NameEnd    = static_cast<const char*>(memchr(NameStart, Terminator, LineEnd - NameStart));
+                        if (NameEnd != nullptr)
+                        {
+                            const std::string IncludeName{NameStart, NameEnd};
+                            if (!ExpandIncludes(IncludeName.c_str(), Ctx, Depth + 1, Out))
+                                return false;
+                            if (!Out.empty() && Out.back() != '\n')
+                                Out.push_back('\n');
+                            IsDirectiveHandled = true;
+                        }
+                    }
+                }
+                else if (MatchKeyword(Cur, LineEnd, "pragma"))
+                {
+                    Cur = SkipSpaces(Cur, LineEnd);
+                    if (MatchKeyword(Cur, LineEnd, "once"))
+                    {
+                        Ctx.OnceFiles.emplace(Name);
+                        IsDirectiveHandled = true;
+                    }
+                }
+            }
+        }
+
+        if (!IsDirectiveHandled)
+            Out.append(Pos, NextPos);
+
+        InBlockComment = IsInBlockCommentAtEnd(Pos, LineEnd, InBlockComment);
+        Pos            = NextPos;
+    }
+
+    return true;
+}
+
+const std::string* PBR_ShaderSourceCache::Get(const char*                      FilePath,
+                                              IShaderSourceInputStreamFactory* pFactory,
+                                              const GeneratedInclude*          GeneratedIncludes,
+                                              Uint32                           NumGeneratedIncludes)
+{
+    VERIFY_EXPR(FilePath != nullptr && pFactory != nullptr);
+
+    // The key contains the file path and the names and contents of the generated includes.
+    // Lengths are written before the strings to make the key unambiguous.
+    std::string Key{FilePath};
+    for (Uint32 i = 0; i < NumGeneratedIncludes; ++i)
+    {
+        const GeneratedInclude& Include = GeneratedIncludes[i];
+        if (Include.Name == nullptr || Include.Source == nullptr)
+            continue;
+        Key.push_back('\n');
+        Key.append(Include.Name);
+        Key.push_back('\n');
+        Key.append(std::to_string(Include.Source->size()));
+        Key.push_back('\n');
+        Key.append(*Include.Source);
+    }
+
+    auto it = m_Sources.find(Key);
+    if (it != m_Sources.end())
+    {
+        ++m_Stats.MemoryHits;
+        return &it->second;
+    }
+
+    if (const std::string* pSource = LoadFromMirror(Key, pFactory))
+    {
+        ++m_Stats.DiskHits;
+        return pSource;
+    }
+
+    ++m_Stats.Misses;
+
+    ExpandContext Ctx;
+    Ctx.pFactory             = pFactory;
+    Ctx.GeneratedIncludes    = GeneratedIncludes;
+    Ctx.NumGeneratedIncludes = NumGeneratedIncludes;
+
+    std::string Source;
+    if (!ExpandIncludes(FilePath, Ctx, 0, Source))
+        return nullptr;
+
+    SaveToMirror(Key, Source, Ctx.Dependencies);
+
+    return &m_Sources.emplace(std::move(Key), std::move(Source)).first->second;
+}
+
+std::string PBR_ShaderSourceCache::GetMirrorFilePath(const std::string& Key) const
+{
+    char FileName[32];
+    snprintf(FileName, sizeof(FileName), "%016llx.fxh", static_cast<unsigned long long>(ComputeFNV1aHash(Key)));
+
+    std::string Path = m_MirrorDirectory;
+    if (!FileSystem::IsSlash(Path.back()))
+        Path.push_back(FileSystem::SlashSymbol);
+    Path.append(FileName);
+    return Path;
+}
+
+// Mirror files store the format tag, the key, the names and content hashes of the shader files the
+// source was expanded from, and the source. Strings are preceded by their lengths. The key is verified
+// when the file is loaded, so hash collisions and stale files with a different key are ignored.
+// The content hashes are verified against the files of the factory, so sources expanded from
+// older versions of the shader files are ignored as well.
+const std::string* PBR_ShaderSourceCache::LoadFromMirror(const std::string& Key, IShaderSourceInputStreamFactory* pFactory)
+{
+    if (m_MirrorDirectory.empty())
+        return nullptr;
+
+    const std::string FilePath = GetMirrorFilePath(Key);
+    if (!FileSystem::FileExists(FilePath.c_str()))
+        return nullptr;
+
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(FilePath.c_str(), Data, true))
+        return nullptr;
+
+    const char* Pos = reinterpret_cast<const char*>(Data.data());
+    const char* End = Pos + Data.size();
+
+    const size_t TagLength = sizeof(MirrorFormatTag) - 1;
+    if (static_cast<size_t>(End - Pos) < TagLength || memcmp(Pos, MirrorFormatTag, TagLength) != 0)
+        return nullptr;
+    Pos += TagLength;
+
+    std::string FileKey;
+    if (!ReadMirrorString(Pos, End, FileKey) || FileKey != Key)
+        return nullptr;
+
+    Uint64 NumDependencies = 0;
+    if (!ReadMirrorNumber(Pos, End, NumDependencies))
+        return nullptr;
+    for (Uint64 i = 0; i < NumDependencies; ++i)
+    {
+        std::string Name;
+        Uint64      Hash = 0;
+        if (!ReadMirrorString(Pos, End, Name) || !ReadMirrorNumber(Pos, End, Hash))
+            return nullptr;
+
+        const std::string* pContent = ReadFile(Name.c_str(), pFactory);
+        if (pContent == nullptr || ComputeFNV1aHash(*pContent) != Hash)
+            return nullptr;
+    }
+
+    return &m_Sources.emplace(Key, std::string{Pos, End}).first->second;
+}
+
+void PBR_ShaderSourceCache::SaveToMirror(const std::string& Key, const std::string& Source, const std::vector<std::string>& Dependencies) const
+{
+    if (m_MirrorDirectory.empty())
+        return;
+
+    std::string Header{MirrorFormatTag};
+    AppendMirrorString(Header, Key);
+    Header.append(std::to_string(Dependencies.size()));
+    Header.push_back('\n');
+    for (const std::string& Name : Dependencies)
+    {
+        auto it = m_Files.find(Name);
+        VERIFY_EXPR(it != m_Files.end());
+        AppendMirrorString(Header, Name);
+        Header.append(std::to_string(ComputeFNV1aHash(it->second)));
+        Header.push_back('\n');
+    }
+
+    const std::string FilePath = GetMirrorFilePath(Key);
+
+    FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+    if (!File ||
+        !File->Write(Header.data(), Header.size()) ||
+        !File->Write(Source.data(), Source.size()))
+    {
+        LOG_WARNING_MESSAGE("Failed to write shader source cache file '", FilePath, "'");
+    }
+}
+
+void PBR_ShaderSourceCache::Clear()
+{
+    m_Files.clear();
+    m_Sources.clear();
+    m_Stats = {};
+}
+
+} // namespace Diligent
@@ -252,6 +252,7 @@ void USD_Renderer::CreateCustomSignature(PipelineResourceSignatureDescX&& Signat
     FrameResources.emplace("cbFrameAttribs");
     FrameResources.emplace("g_PreintegratedGGX");
     FrameResources.emplace("g_IrradianceMap");
+    FrameResources.emplace("cbIrradianceSH");
     FrameResources.emplace("g_PrefilteredEnvMap");
     FrameResources.emplace("g_PreintegratedCharlie");
     FrameResources.emplace("g_SheenAlbedoScalingLUT");
@@ -127,6 +127,7 @@ public:
                                       IDeviceContext* pContext);
 
     GLTF::ResourceManager*          GetResourceManager() const;
+    IThreadPool*                    GetThreadPool() const;
     RadientTextureAssetManagerStats GetTextureManagerStats() const;
 
 private:
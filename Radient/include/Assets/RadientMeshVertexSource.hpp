@@ -161,6 +161,10 @@ public:
     /// Returns a key for packed GPU vertex data.
     std::string MakeCacheKey() const;
 
+    /// Returns object-space bounds of the source POSITION attribute.
+    /// Empty bounds are returned if positions are not three-component 32-bit floats.
+    RadientBounds GetPositionBounds() const;
+
 private:
     struct SrcAttributeData
     {
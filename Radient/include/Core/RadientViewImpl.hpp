@@ -57,6 +57,10 @@ public:
 
     virtual RADIENT_STATUS DILIGENT_CALL_TYPE SetSkybox(const RadientSkyboxDesc& Skybox) override final;
 
+    virtual RADIENT_STATUS DILIGENT_CALL_TYPE SetLayerMask(Uint64 LayerMask) override final;
+
+    virtual RADIENT_STATUS DILIGENT_CALL_TYPE SetRenderScale(const RadientRenderScaleDesc& RenderScale) override final;
+
 private:
     void CopySkybox(const RadientSkyboxDesc& Skybox);
 
@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "Render/RadientCommandLog.hpp"
+#include "Render/RadientDrawList.hpp"
+#include "Render/RadientMaterialTable.hpp"
+
+#include "PBR_Renderer.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Diligent
+{
+
+struct RadientDrawableSlot;
+
+/// Pipeline states a geometry pass renders its stages with.
+enum class RadientGeometryPipelineType : Uint8
+{
+    /// Main pass pipeline state.
+    Main,
+
+    /// Main pass pipeline state that tests depth written by the depth pre-pass.
+    EarlyZ,
+
+    /// Depth-only pipeline state of the depth pre-pass.
+    DepthPrepass,
+
+    /// Depth-only pipeline state of the shadow pass.
+    Shadow,
+
+    Count
+};
+
+/// Receives the pipeline state requests and the commands of RadientGeometryPass.
+///
+/// The pass resolves the pipeline states of the drawables, builds and sorts the stage lists and batches
+/// the primitive records on the CPU, and submits the resulting state changes and draws to the sink.
+/// The device sink of the pass submits them to a device context; renderers without a render device
+/// use RadientGeometryCommandLogSink.
+class IRadientGeometryCommandSink
+{
+public:
+    virtual ~IRadientGeometryCommandSink() = default;
+
+    /// Returns the pipeline state of the given type that renders primitives with the key.
+    /// The pass only requests the pipeline types of the stages it was prepared for.
+    virtual IPipelineState* GetPipelineState(RadientGeometryPipelineType Type, const PBR_Renderer::PSOKey& Key) = 0;
+
+    /// Returns true if draws may use the pipeline state. Pipeline states that are not ready are skipped
+    /// and are drawn once they are ready.
+    virtual bool IsPipelineReady(IPipelineState* pPSO) const = 0;
+
+    /// Returns the memory the primitive records of a batch are written to, or null on failure.
+    /// The memory holds the buffer size of the primitive record allocator of the renderer.
+    virtual Uint8* BeginPrimitiveBatch() = 0;
+
+    /// Submits the first BatchSize bytes of the primitive records written since BeginPrimitiveBatch().
+    virtual void EndPrimitiveBatch(Uint32 BatchSize) = 0;
+
+    virtual void SetVertexPool(IVertexPool* pVertexPool)  = 0;
+    virtual void SetPipelineState(IPipelineState* pPSO)   = 0;
+    virtual void SetPrimitiveAttribsOffset(Uint32 Offset) = 0;
+    virtual void SetMaterialAttribsOffset(Uint32 Offset)  = 0;
+
+    /// Draws the primitive of the drawable with the current state.
+    virtual void Draw(RadientDrawableID DrawableID, const RadientDrawableSlot& Drawable) = 0;
+
+    /// Issues up to MaxDrawCount indexed draws with the current state. The arguments of the first draw are at
+    /// DrawArgsOffset in pDrawArgs, and the draw count is read at DrawCountOffset in pDrawCounts. The primitive
+    /// records of the draws are consecutive and are indexed with the draw index.
+    virtual void DrawIndexedIndirect(IBuffer* pDrawArgs, Uint64 DrawArgsOffset, Uint32 MaxDrawCount, IBuffer* pDrawCounts, Uint64 DrawCountOffset) = 0;
+};
+
+/// Command sink of renderers without a render device.
+///
+/// The sink records the pipeline state, vertex pool and material changes, the buffer writes and the draws
+/// into a command log. Pipeline states are opaque identities derived from their keys and are never created;
+/// neither they, the vertex pools nor the indirect draw buffers are dereferenced, so the drawables may
+/// reference placeholder vertex pools.
+class RadientGeometryCommandLogSink final : public IRadientGeometryCommandSink
+{
+public:
+    /// Buffer identities of the recorded buffer writes.
+    static constexpr Uint64 FrameAttribsBufferID     = 1;
+    static constexpr Uint64 PrimitiveAttribsBufferID = 2;
+    static constexpr Uint64 MaterialAttribsBufferID  = 3;
+
+    /// Size of the buffer the primitive records of a batch are written to, see RadientDrawRecordAllocator.
+    static constexpr Uint32 PrimitiveAttribsBufferSize = 65536;
+
+    /// Offset alignment of the primitive records and material table slots.
+    static constexpr Uint32 ConstantBufferOffsetAlignment = 256;
+
+    explicit RadientGeometryCommandLogSink(RadientCommandLog& Log);
+
+    /// Records the upload of the material table slots written since the previous call,
+    /// see RadientMaterialTable::CommitUpdates().
+    void CommitMaterialTable(RadientMaterialTable& MaterialTable);
+
+    /// Records the write of the camera, light and shadow map attributes of a view.
+    void WriteFrameAttribs(const PBR_Renderer::CreateInfo& Settings);
+
+    /// Returns the identity recorded by RadientCommandType::SetPipelineState for the pipeline state.
+    static Uint64 GetPipelineStateID(IPipelineState* pPSO) { return reinterpret_cast<size_t>(pPSO); }
+
+    virtual IPipelineState* GetPipelineState(RadientGeometryPipelineType Type, const PBR_Renderer::PSOKey& Key) override final;
+    virtual bool            IsPipelineReady(IPipelineState* pPSO) const override final { return pPSO != nullptr; }
+
+    virtual Uint8* BeginPrimitiveBatch() override final;
+    virtual void   EndPrimitiveBatch(Uint32 BatchSize) override final;
+
+    virtual void SetVertexPool(IVertexPool* pVertexPool) override final;
+    virtual void SetPipelineState(IPipelineState* pPSO) override final;
+    virtual void SetPrimitiveAttribsOffset(Uint32 Offset) override final {} // Records are written by the batch
+    virtual void SetMaterialAttribsOffset(Uint32 Offset) override final;
+
+    virtual void Draw(RadientDrawableID DrawableID, const RadientDrawableSlot& Drawable) override final;
+    virtual void DrawIndexedIndirect(IBuffer* pDrawArgs, Uint64 DrawArgsOffset, Uint32 MaxDrawCount, IBuffer* pDrawCounts, Uint64 DrawCountOffset) override final;
+
+private:
+    RadientCommandLog& m_Log;
+
+    std::unordered_map<PBR_Renderer::PSOKey, Uint32, PBR_Renderer::PSOKey::Hasher> m_PSOKeyIndices;
+
+    std::vector<Uint8> m_PrimitiveAttribsData;
+};
+
+} // namespace Diligent
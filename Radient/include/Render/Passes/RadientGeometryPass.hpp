@@ -26,9 +26,18 @@
 
 #pragma once
 
+#include "Render/Passes/RadientGeometryCommandSink.hpp"
+#include "Render/RadientDepthSort.hpp"
 #include "Render/RadientDrawList.hpp"
+#include "Render/RadientDrawListCache.hpp"
+#include "Render/RadientDrawRecordAllocator.hpp"
 #include "Render/RadientFrameRenderTargets.hpp"
+#include "Render/RadientIndirectDrawList.hpp"
+#include "Render/RadientLightClusters.hpp"
 #include "Render/RadientLightList.hpp"
+#include "Render/RadientMaterialTable.hpp"
+#include "Render/RadientOcclusionBuffer.hpp"
+#include "Render/RadientShadowCascades.hpp"
 
 #include "GLTFLoader.hpp"
 #include "PBR_Renderer.hpp"
@@ -37,6 +46,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Diligent
@@ -59,23 +69,147 @@ struct RadientGeometryResourceCacheUseInfo
 
 struct RadientGeometryResourceCacheBindings
 {
-    Uint32 Version = ~0u;
+    Uint32 Version              = ~0u;
+    Uint32 MaterialTableVersion = ~0u;
 
     RefCntAutoPtr<IShaderResourceBinding> pSRB;
 };
 
+/// Order in which a geometry pass draws the primitives of a draw list.
+enum class RadientGeometryDrawOrder : Uint8
+{
+    /// Primitives are grouped by pipeline state and vertex pool to minimize state changes.
+    State,
+
+    /// Primitives are drawn back to front by the view-space depth of their bounds center.
+    /// Used for alpha-blended primitives.
+    BackToFront,
+
+    /// Primitives are drawn front to back by a coarse view-space depth bucket and grouped by
+    /// pipeline state within a bucket. Used by the depth pre-pass to maximize early depth rejection.
+    FrontToBack,
+};
+
+/// Returns the PBR renderer settings used by Radient geometry passes.
+/// Device-dependent settings (input layout, texture color conversion) are left at their defaults.
+PBR_Renderer::CreateInfo GetRadientPBRRendererSettings(const RadientShadowCascadeDesc& ShadowDesc);
+
+/// Returns the render flags of the geometry pass before the render target format is known.
+PBR_Renderer::PSO_FLAGS GetRadientBaseRenderFlags(bool EnableShadows);
+
+/// Returns the key of the main pass PSO that renders a primitive with the given vertex attributes and material.
+PBR_Renderer::PSOKey GetRadientMainPassPSOKey(const PBR_Renderer::CreateInfo& Settings,
+                                              PBR_Renderer::PSO_FLAGS         RenderFlags,
+                                              PBR_Renderer::PSO_FLAGS         VertexAttribFlags,
+                                              const GLTF::Material&           Material);
+
+/// Writes the primitive attributes of a drawable with the given world matrix and returns the end of the written data.
+/// The destination must hold PBR_Renderer::GetPBRPrimitiveAttribsSize(PSOFlags) bytes.
+void* WriteRadientPrimitiveAttribs(void*                   pDst,
+                                   PBR_Renderer::PSO_FLAGS PSOFlags,
+                                   const float4x4&         NodeMatrix,
+                                   bool                    PackMatrixRowMajor);
+
+/// Writes the material attributes packed for the PSO flags and returns the end of the written data.
+/// The destination must hold PBR_Renderer::GetPBRMaterialAttribsSize(PSOFlags) bytes.
+void* WriteRadientMaterialAttribs(void*                           pDst,
+                                  const PBR_Renderer::CreateInfo& Settings,
+                                  PBR_Renderer::PSO_FLAGS         PSOFlags,
+                                  const GLTF::Material&           Material);
+
+/// Returns the key of the depth-only PSO that lays down depth for the primitive rendered with the main pass key.
+/// Opaque primitives use position-only PSOs without a pixel shader; alpha-tested primitives keep
+/// the attributes required to evaluate the alpha cutoff.
+PBR_Renderer::PSOKey GetRadientDepthPrepassPSOKey(const PBR_Renderer::PSOKey& MainPsoKey);
+
+/// Returns the graphics pipeline description of the depth pre-pass derived from the main pass description.
+GraphicsPipelineDesc GetRadientDepthPrepassGraphicsDesc(const GraphicsPipelineDesc& MainDesc);
+
+/// Returns the graphics pipeline description of the main pass that follows the depth pre-pass.
+/// Depth is tested for equality with the pre-pass result and is not written again.
+GraphicsPipelineDesc GetRadientEarlyZGraphicsDesc(const GraphicsPipelineDesc& MainDesc);
+
+/// Returns the graphics pipeline description of the shadow pass derived from the main pass description.
+/// Depth is biased by the slope to avoid shadow acne within the filter kernel, and casters in front
+/// of the light near plane are clamped to it when the device supports depth clamping.
+GraphicsPipelineDesc GetRadientShadowGraphicsDesc(const GraphicsPipelineDesc& MainDesc,
+                                                  TEXTURE_FORMAT              ShadowMapFormat,
+                                                  Uint32                      FilterSize,
+                                                  bool                        EnableDepthClamp);
+
+/// Returns the world-space plane whose signed distance is the view-space depth of the view camera,
+/// see RadientDepthSorter::GetDepthPlane().
+RadientFloat4 GetRadientViewDepthPlane(IRenderDevice*                   pDevice,
+                                       const RadientViewDesc&           ViewDesc,
+                                       const RadientFrameRenderTargets& Targets);
+
+/// Returns the transformation from world space to the clip space of the view camera used by CPU occlusion culling.
+/// The depth is mapped to [0, 1] regardless of the device.
+float4x4 GetRadientViewOcclusionMatrix(const RadientViewDesc&           ViewDesc,
+                                       const RadientFrameRenderTargets& Targets);
+
+/// Camera-dependent draw lists of one view.
+///
+/// The lists are resolved from the cached stage lists by RadientGeometryPass::PrepareViewDrawables() on
+/// the render thread. RadientGeometryPass::SortViewDrawables() then orders them by depth; it only writes
+/// to the view, so the views of a multi-view render call can be sorted concurrently.
+struct RadientGeometryViewDrawables
+{
+    RadientFloat4 ViewDepthPlane;
+    Uint64        LayerMask = ~Uint64{0};
+
+    std::vector<RadientDrawableID> DepthPrepassIDs; // Front to back once sorted
+    std::vector<RadientDrawableID> BlendIDs;        // Back to front once sorted
+
+    // Build ID of the cached depth pre-pass list, see RadientDrawListCache::Entry::BuildID
+    Uint64 DepthPrepassBuildID = 0;
+
+    // Occlusion culling state, see RadientGeometryPass::BeginViewOcclusion().
+    // OccludedDrawables is indexed by the drawable ID and is empty if the view was not culled.
+    RadientOcclusionBuffer                           OcclusionBuffer;
+    std::vector<RadientDrawableID>                   OcclusionCandidates;
+    std::vector<Uint8>                               OccludedDrawables;
+    std::vector<std::pair<float, RadientDrawableID>> OccluderScores; // Occluder selection scratch
+
+    // Sort scratch
+    RadientDepthSorter           DepthSorter;
+    std::vector<IPipelineState*> SortPSOs;
+};
+
 /// Shared renderer state used by geometry passes.
 class RadientGeometryRenderer
 {
 public:
+    explicit RadientGeometryRenderer(const RadientShadowCascadeDesc& ShadowDesc               = {},
+                                     bool                            EnableGPUDrivenRendering = false) noexcept;
+
     RADIENT_STATUS Prepare(IRenderDevice* pDevice, IDeviceContext* pContext);
 
-    RADIENT_STATUS BeginFrame(IRenderDevice*                   pDevice,
-                              IDeviceContext*                  pContext,
-                              const RadientLightLists&         LightList,
-                              GLTF::ResourceManager*           pResourceManager,
-                              const RadientViewDesc&           ViewDesc,
-                              const RadientFrameRenderTargets& Targets);
+    /// Sets up the state the geometry passes use on the CPU when there is no render device: the PBR renderer
+    /// settings, the material table layout and the primitive record allocator. The primitive records of a batch
+    /// are written into the command sink memory of the given size, see IRadientGeometryCommandSink::BeginPrimitiveBatch().
+    void PrepareHeadless(Uint32 PrimitiveAttribsBufferSize, Uint32 OffsetAlignment);
+
+    /// Sets up the state shared by all views of the frame: the environment maps, the resource cache
+    /// and the view-independent light attributes.
+    RADIENT_STATUS BeginFrame(IRenderDevice*                pDevice,
+                              IDeviceContext*               pContext,
+                              const RadientLightLists&      LightList,
+                              GLTF::ResourceManager*        pResourceManager,
+                              const RadientEnvironmentDesc& Environment);
+
+    /// Sets up the camera, the light clusters and the shadow cascades of the view.
+    /// Must be called after BeginFrame() before the passes of every view of the frame.
+    RADIENT_STATUS BeginView(IRenderDevice*                   pDevice,
+                             IDeviceContext*                  pContext,
+                             const RadientViewDesc&           ViewDesc,
+                             const RadientFrameRenderTargets& Targets);
+
+    /// Counterpart of BeginView() for renderers without a render device: sets up the camera and the shadow
+    /// cascades of the view, so that the recorded passes cull the same drawables as the device passes.
+    void BeginHeadlessView(const RadientLightLists&         LightList,
+                           const RadientViewDesc&           ViewDesc,
+                           const RadientFrameRenderTargets& Targets);
 
     void EndFrame();
 
@@ -86,6 +220,38 @@ public:
     ITextureView*           GetPrefilteredEnvMapSRV() const { return m_pPrefilteredEnvMapSRV; }
     IShaderResourceBinding* GetResourceCacheSRB() const { return m_CacheBindings.pSRB.RawPtr(); }
     PBR_Renderer::PSO_FLAGS GetBaseRenderFlags() const { return m_BaseRenderFlags; }
+    const RadientFloat4&    GetViewDepthPlane() const { return m_ViewDepthPlane; }
+    Uint64                  GetViewLayerMask() const { return m_ViewLayerMask; }
+
+    /// PBR renderer settings. Without a render device, the device-independent settings set up by PrepareHeadless().
+    const PBR_Renderer::CreateInfo& GetSettings() const { return m_pRenderer ? m_pRenderer->GetSettings() : m_HeadlessSettings; }
+
+    /// Shadow cascade settings. The cascade count is zero if shadows are disabled.
+    const RadientShadowCascadeDesc& GetShadowDesc() const { return m_ShadowDesc; }
+
+    /// Shadow cascades of the current frame. Empty if shadows are disabled or there is no shadow-casting light.
+    const RadientShadowCascades& GetShadowCascades() const { return m_ShadowCascades; }
+    ITextureView*                GetShadowMapSRV() const { return m_pShadowMapSRV; }
+    ITextureView*                GetShadowMapDSV(Uint32 Cascade) const { return Cascade < m_ShadowMapDSVs.size() ? m_ShadowMapDSVs[Cascade].RawPtr() : nullptr; }
+    IShaderResourceBinding*      GetShadowResourceCacheSRB() const { return m_ShadowCacheBindings.pSRB.RawPtr(); }
+
+    /// Material attributes of the drawables of all geometry passes. The slots written by the passes
+    /// are uploaded by BeginFrame().
+    RadientMaterialTable& GetMaterialTable() { return m_MaterialTable; }
+
+    /// Allocator of the per-draw records in the primitive attribs buffer of the renderer.
+    RadientDrawRecordAllocator& GetPrimitiveRecordAllocator() { return m_PrimitiveRecords; }
+
+    /// Maximum number of draws of an indirect multi-draw call of the GPU-driven forward pass, which is
+    /// the size of the primitive attribs array of the PBR shaders. Zero if GPU-driven rendering is
+    /// disabled or is not supported by the device.
+    Uint32 GetIndirectDrawBucketSize() const { return m_IndirectDrawBucketSize; }
+
+    /// Frustum culling attributes of the current view. RecordCount is set by the pass.
+    const HLSL::RadientIndirectCullAttribs& GetViewCullAttribs() const { return m_ViewCullAttribs; }
+
+    /// Sets up the shadow frame attribs buffer to render the given cascade.
+    RADIENT_STATUS WriteShadowCascadeAttribs(IDeviceContext* pContext, Uint32 Cascade);
 
 private:
     RADIENT_STATUS CreateRenderer(IRenderDevice*  pDevice,
@@ -94,8 +260,39 @@ private:
     RADIENT_STATUS UpdateEnvironment(IDeviceContext*               pContext,
                                      const RadientEnvironmentDesc& Environment);
 
+    // Writes the attributes of the visible lights and finds the shadow-casting light.
+    // Bounded point and spot lights go to the clusters when clustered lighting is enabled.
+    void WriteFrameLights(const RadientLightLists& LightList);
+
+    // Fits the shadow cascades of the shadow-casting light to the view frustum.
+    // Returns false if there is no shadow-casting light or the cascades are empty.
+    bool DistributeShadowCascades(const float4x4& CameraWorld, const float4x4& CameraProj);
+
+    RADIENT_STATUS UpdateLightClusterBuffers(IRenderDevice*  pDevice,
+                                             IDeviceContext* pContext);
+
+    RADIENT_STATUS CreateShadowMap(IRenderDevice* pDevice);
+
 private:
+    // Bounded light that is binned into the clusters of every view
+    struct ClusteredLightSource
+    {
+        float3 Position;
+        float3 Direction;
+        float  Range     = 0;
+        float  ConeAngle = 0; // Zero for point lights
+    };
+
+    struct LightClusterBuffers
+    {
+        RefCntAutoPtr<IBuffer> pAttribsCB;
+        RefCntAutoPtr<IBuffer> pLights;
+        RefCntAutoPtr<IBuffer> pClusterGrid;
+        RefCntAutoPtr<IBuffer> pLightIndices;
+    };
+
     std::unique_ptr<PBR_Renderer> m_pRenderer;
+    PBR_Renderer::CreateInfo      m_HeadlessSettings; // Used when there is no render device
     RefCntAutoPtr<IBuffer>        m_pFrameAttribsCB;
     RefCntAutoPtr<ITextureView>   m_pDefaultIBLCubemapSRV;
     RefCntAutoPtr<ITextureView>   m_pIrradianceCubeSRV;
@@ -103,11 +300,54 @@ private:
 
     RadientGeometryResourceCacheUseInfo  m_CacheUseInfo;
     RadientGeometryResourceCacheBindings m_CacheBindings;
+    RadientGeometryResourceCacheBindings m_ShadowCacheBindings; // Binds the shadow frame attribs buffer
+
+    // Both resource cache SRBs bind the table buffer as the material attribs buffer
+    RadientMaterialTable m_MaterialTable;
+
+    // Per-draw primitive attribs records. The buffer is also used by the PBR renderer.
+    RefCntAutoPtr<IBuffer>     m_pPrimitiveAttribsCB;
+    RadientDrawRecordAllocator m_PrimitiveRecords;
 
     PBR_Renderer::PSO_FLAGS m_BaseRenderFlags = PBR_Renderer::PSO_FLAG_NONE;
 
     RefCntAutoPtr<IRadientTextureAsset> m_pCurrentEnvironmentMap;
 
+    // World-space plane of the current view camera, see RadientDepthSorter::GetDepthPlane().
+    RadientFloat4 m_ViewDepthPlane;
+
+    // Layer mask of the current view, see RadientViewDesc::LayerMask.
+    Uint64 m_ViewLayerMask = ~Uint64{0};
+
+    // Frustum planes of the current view used by the GPU-driven forward pass
+    HLSL::RadientIndirectCullAttribs m_ViewCullAttribs{};
+
+    bool   m_EnableGPUDrivenRendering = false;
+    Uint32 m_IndirectDrawBucketSize   = 0;
+
+    // Bounded point and spot lights are binned into view-space clusters and are not
+    // subject to the frame attribs light count limit.
+    RadientLightClusters m_LightClusters;
+    LightClusterBuffers  m_LightClusterBuffers;
+    std::vector<Uint8>   m_ClusteredLightsData; // HLSL::PBRLightAttribs array
+    bool                 m_UploadClusteredLights = true;
+
+    // Light attributes do not depend on the camera and are written once per frame for all views.
+    RadientEnvironmentDesc            m_Environment;
+    std::vector<Uint8>                m_FrameLightsData; // HLSL::PBRLightAttribs array
+    std::vector<ClusteredLightSource> m_ClusteredLightSources;
+    const RadientLightItem*           m_pShadowLightItem = nullptr;
+    Uint32                            m_ShadowLightIndex = ~0u; // Index in m_FrameLightsData
+
+    // Cascades are rendered into the slices of a 2D array depth texture. Shadow passes use a separate
+    // frame attribs buffer, so that the camera attribs of the main passes stay intact.
+    RadientShadowCascadeDesc                 m_ShadowDesc;
+    RadientShadowCascades                    m_ShadowCascades;
+    RefCntAutoPtr<ITextureView>              m_pShadowMapSRV;
+    RefCntAutoPtr<ITextureView>              m_pDummyShadowMapSRV; // Bound to the shadow pass SRB
+    std::vector<RefCntAutoPtr<ITextureView>> m_ShadowMapDSVs;
+    RefCntAutoPtr<IBuffer>                   m_pShadowFrameAttribsCB;
+
     Uint32 m_FrameIndex = 0;
 };
 
@@ -115,58 +355,352 @@ private:
 class RadientGeometryPass
 {
 public:
-    explicit RadientGeometryPass(bool EnableAsyncPipelineCompilation = true) noexcept;
+    explicit RadientGeometryPass(bool                               EnableAsyncPipelineCompilation = true,
+                                 bool                               EnableDepthPrepass             = false,
+                                 const RadientOcclusionCullingDesc& OcclusionDesc                  = {}) noexcept;
 
     RADIENT_STATUS Prepare(RadientGeometryRenderer&         Renderer,
                            IRenderDevice*                   pDevice,
                            IDeviceContext*                  pContext,
                            const RadientSceneDrawableCache& DrawableCache,
                            const RadientFrameRenderTargets& Targets);
-    RADIENT_STATUS Execute(RadientGeometryRenderer&         Renderer,
-                           IRenderDevice*                   pDevice,
-                           IDeviceContext*                  pContext,
-                           const RadientDrawList&           DrawList,
-                           const RadientSceneDrawableCache& DrawableCache,
-                           const RadientFrameRenderTargets& Targets);
+
+    /// Prepares the pass of a renderer without a render device. Pipeline states are resolved by the sink,
+    /// and the Record*() methods submit the commands of the stages to it. The renderer must be set up
+    /// with RadientGeometryRenderer::PrepareHeadless(), and the sink must outlive the use of the pass.
+    void Prepare(RadientGeometryRenderer&         Renderer,
+                 const RadientSceneDrawableCache& DrawableCache,
+                 IRadientGeometryCommandSink&     Sink);
+
+    /// Resolves the camera-dependent lists of the view: the depth pre-pass list and the alpha-blended list.
+    /// Must be called on the render thread after Prepare() and before SortViewDrawables().
+    void PrepareViewDrawables(const RadientDrawLists&          DrawLists,
+                              const RadientSceneDrawableCache& DrawableCache,
+                              const RadientViewDesc&           ViewDesc,
+                              const RadientFloat4&             ViewDepthPlane,
+                              RadientGeometryViewDrawables&    View);
+
+    /// Sorts the depth pre-pass list of the view front to back and the alpha-blended list back to front.
+    /// Only reads the pass state, so different views may be sorted concurrently.
+    void SortViewDrawables(RadientGeometryViewDrawables& View) const;
+
+    /// Selects the occluders of the view, adds them to the occlusion buffer of the view and collects the
+    /// drawables to test. Returns false if occlusion culling is disabled or the view has no occluders.
+    /// Must be called on the render thread after PrepareViewDrawables(). If the function returns true,
+    /// the caller rasterizes the tiles of the occlusion buffer, builds its hierarchy, tests the candidates
+    /// with TestViewOcclusion() and calls EndViewOcclusion() before SortViewDrawables().
+    bool BeginViewOcclusion(const RadientDrawLists&          DrawLists,
+                            const RadientSceneDrawableCache& DrawableCache,
+                            const float4x4&                  ViewProj,
+                            const RadientExtent2D&           ViewSize,
+                            RadientGeometryViewDrawables&    View) const;
+
+    /// Tests the occlusion candidates in the range [First, End) against the occlusion buffer of the view.
+    /// Disjoint ranges may be tested concurrently.
+    void TestViewOcclusion(RadientGeometryViewDrawables& View, size_t First, size_t End) const;
+
+    /// Removes the occluded drawables from the depth pre-pass and alpha-blended lists of the view.
+    /// Returns the number of occluded drawables.
+    Uint32 EndViewOcclusion(RadientGeometryViewDrawables& View) const;
+
+    /// Draws the primitives of the draw list grouped by state.
+    /// Primitives that are occluded in the view are skipped. If the renderer supports GPU-driven rendering,
+    /// indexed primitives are frustum-culled by a compute shader and are drawn with one indirect
+    /// multi-draw call per bucket of primitives that share the pipeline state and the material.
+    RADIENT_STATUS Execute(RadientGeometryRenderer&            Renderer,
+                           IRenderDevice*                      pDevice,
+                           IDeviceContext*                     pContext,
+                           const RadientDrawList&              DrawList,
+                           const RadientSceneDrawableCache&    DrawableCache,
+                           const RadientGeometryViewDrawables& View,
+                           const RadientFrameRenderTargets&    Targets);
+
+    /// Draws the alpha-blended primitives of the view back to front.
+    RADIENT_STATUS ExecuteBlend(RadientGeometryRenderer&            Renderer,
+                                IRenderDevice*                      pDevice,
+                                IDeviceContext*                     pContext,
+                                const RadientGeometryViewDrawables& View,
+                                const RadientFrameRenderTargets&    Targets);
+
+    /// Lays down depth for the opaque and alpha-tested primitives of the view.
+    /// Primitives that took part in the pre-pass are then drawn by Execute() with early-Z PSOs.
+    /// Primitives whose depth-only PSOs are not ready yet are skipped here and are drawn
+    /// by Execute() with the regular PSOs.
+    RADIENT_STATUS ExecuteDepthPrepass(RadientGeometryRenderer&            Renderer,
+                                       IRenderDevice*                      pDevice,
+                                       IDeviceContext*                     pContext,
+                                       const RadientGeometryViewDrawables& View,
+                                       const RadientFrameRenderTargets&    Targets);
+
+    /// Renders the opaque and alpha-tested shadow casters of the draw lists into the shadow cascades
+    /// of the renderer. Does nothing if the renderer has no shadow cascades in the current frame.
+    RADIENT_STATUS ExecuteShadowPass(RadientGeometryRenderer&         Renderer,
+                                     IRenderDevice*                   pDevice,
+                                     IDeviceContext*                  pContext,
+                                     const RadientDrawLists&          DrawLists,
+                                     const RadientSceneDrawableCache& DrawableCache);
+
+    /// Counterparts of ExecuteShadowPass(), ExecuteDepthPrepass(), Execute() and ExecuteBlend() for renderers
+    /// without a render device: the commands are submitted to the sink the pass was prepared with.
+    /// Shadow casters are culled per cascade as in ExecuteShadowPass(), see RadientGeometryRenderer::BeginHeadlessView().
+    void RecordShadowPass(RadientGeometryRenderer&            Renderer,
+                          const RadientDrawLists&             DrawLists,
+                          const RadientSceneDrawableCache&    DrawableCache,
+                          const RadientGeometryViewDrawables& View);
+    void RecordDepthPrepass(RadientGeometryRenderer&            Renderer,
+                            const RadientGeometryViewDrawables& View);
+    void Record(RadientGeometryRenderer&            Renderer,
+                const RadientDrawList&              DrawList,
+                const RadientSceneDrawableCache&    DrawableCache,
+                const RadientGeometryViewDrawables& View);
+    void RecordBlend(RadientGeometryRenderer&            Renderer,
+                     const RadientGeometryViewDrawables& View);
+
+    bool IsDepthPrepassEnabled() const { return m_EnableDepthPrepass; }
+    bool IsOcclusionCullingEnabled() const { return m_OcclusionDesc.Enable; }
 
 private:
     RADIENT_STATUS CreatePsoCaches(PBR_Renderer&           Renderer,
                                    PBR_Renderer::PSO_FLAGS BaseRenderFlags,
                                    TEXTURE_FORMAT          RTVFormat,
-                                   TEXTURE_FORMAT          DSVFormat);
+                                   TEXTURE_FORMAT          DSVFormat,
+                                   TEXTURE_FORMAT          ShadowMapFormat,
+                                   bool                    EnableDepthClamp);
+
+    enum class DrawStage : Uint8
+    {
+        Main,
+        DepthPrepass,
+        Shadow,
+    };
 
     struct DrawablePassData
     {
-        const RadientDrawableSlot* pDrawable  = nullptr;
-        Uint32                     Generation = 0;
-        PBR_Renderer::PSO_FLAGS    PSOFlags   = PBR_Renderer::PSO_FLAG_NONE;
-        IPipelineState*            pPSO       = nullptr;
+        const RadientDrawableSlot* pDrawable     = nullptr;
+        Uint32                     Generation    = 0;
+        PBR_Renderer::PSO_FLAGS    PSOFlags      = PBR_Renderer::PSO_FLAG_NONE;
+        IPipelineState*            pPSO          = nullptr;
+        PBR_Renderer::PSO_FLAGS    DepthPSOFlags = PBR_Renderer::PSO_FLAG_NONE;
+        IPipelineState*            pDepthPSO     = nullptr; // Depth pre-pass PSO
+        IPipelineState*            pEarlyZPSO    = nullptr; // Main pass PSO used after the depth pre-pass
+        IPipelineState*            pShadowPSO    = nullptr; // Uses DepthPSOFlags
+
+        // Material table slots of the attributes packed for PSOFlags and DepthPSOFlags
+        Uint32 MaterialIndex      = RadientMaterialTable::InvalidIndex;
+        Uint32 DepthMaterialIndex = RadientMaterialTable::InvalidIndex;
+
+        // Index of the last depth pre-pass that rendered the drawable
+        Uint32 DepthPrepassIndex = 0;
     };
 
-    void SyncDrawablePassData(PBR_Renderer&                    Renderer,
+    // Returns the PSO the drawable is rendered with in the given stage, or null if
+    // the drawable does not take part in the stage.
+    IPipelineState* GetStagePSO(const DrawablePassData& PassData, DrawStage Stage) const;
+
+    // Pipeline states of the drawables are resolved by m_pSink
+    void SyncDrawablePassData(const PBR_Renderer::CreateInfo&  Settings,
+                              RadientMaterialTable&            MaterialTable,
                               const RadientSceneDrawableCache& DrawableCache,
                               bool                             RebuildAll);
-    void UpdateDrawablePassData(PBR_Renderer&              Renderer,
-                                const RadientDrawableSlot& Drawable,
-                                RadientDrawableID          DrawableID);
-    void InvalidateDrawablePassData(RadientDrawableID DrawableID);
+    void UpdateDrawablePassData(const PBR_Renderer::CreateInfo& Settings,
+                                RadientMaterialTable&           MaterialTable,
+                                const RadientDrawableSlot&      Drawable,
+                                RadientDrawableID               DrawableID);
+    void InvalidateDrawablePassData(RadientMaterialTable& MaterialTable,
+                                    RadientDrawableID     DrawableID);
+
+    // Packs the material attributes for the PSO flags and acquires their material table slot.
+    Uint32 AcquireMaterialSlot(const PBR_Renderer::CreateInfo& Settings,
+                               RadientMaterialTable&           MaterialTable,
+                               const GLTF::Material&           Material,
+                               PBR_Renderer::PSO_FLAGS         PSOFlags);
+
+    // Returns the cached IDs of the drawables of the draw lists that take part in the stage and pass
+    // the layer mask. The list is sorted by state if DrawOrder is State, and is not sorted otherwise.
+    // pSource identifies the set of draw lists in the cache. Dependency is the build ID of the list
+    // the PSOs of the stage depend on, see RadientDrawListCache::Get().
+    const RadientDrawListCache::Entry& GetStageDrawableIDs(const void*                      pSource,
+                                                           const RadientDrawList* const*    ppDrawLists,
+                                                           Uint32                           NumDrawLists,
+                                                           const RadientSceneDrawableCache& DrawableCache,
+                                                           DrawStage                        Stage,
+                                                           RadientGeometryDrawOrder         DrawOrder,
+                                                           Uint64                           LayerMask,
+                                                           Uint64                           Dependency);
+
+    // Appends the IDs of the drawables of the draw list that take part in the stage and pass the layer mask.
+    // Returns false if some drawables were skipped because their pipelines are not ready yet.
+    bool AddStageDrawableIDs(const RadientDrawList&           DrawList,
+                             const RadientSceneDrawableCache& DrawableCache,
+                             DrawStage                        Stage,
+                             Uint64                           LayerMask,
+                             std::vector<RadientDrawableID>&  DrawableIDs) const;
+
+    void SortDrawableIDsByState(std::vector<RadientDrawableID>& DrawableIDs,
+                                DrawStage                       Stage) const;
+    void SortDrawableIDsByDepth(std::vector<RadientDrawableID>& DrawableIDs,
+                                RadientGeometryDrawOrder        DrawOrder,
+                                const RadientFloat4&            ViewDepthPlane,
+                                DrawStage                       Stage,
+                                RadientDepthSorter&             DepthSorter,
+                                std::vector<IPipelineState*>&   SortPSOs) const;
+
+    // Returns the state-sorted main pass drawables of the draw list that are not occluded in the view
+    const std::vector<RadientDrawableID>& GetMainPassDrawableIDs(const RadientDrawList&              DrawList,
+                                                                 const RadientSceneDrawableCache&    DrawableCache,
+                                                                 const RadientGeometryViewDrawables& View,
+                                                                 Uint64                              LayerMask);
+
+    // Returns the state-sorted opaque and alpha-tested shadow casters of the draw lists
+    const RadientDrawListCache::Entry& GetShadowCasters(const RadientDrawLists&          DrawLists,
+                                                        const RadientSceneDrawableCache& DrawableCache,
+                                                        Uint64                           LayerMask);
+
+    // Writes the casters that overlap the cascade into m_ShadowCasterIDs
+    void CullShadowCasters(const RadientShadowCascades&          Cascades,
+                           Uint32                                Cascade,
+                           const std::vector<RadientDrawableID>& DrawableIDs);
+
+    // Invalidates the results of the previous depth pre-pass
+    void BeginDepthPrepass();
+
+    // Marks the drawables of the depth pre-pass list of the view as rendered by the current pre-pass
+    void CommitDepthPrepass(const RadientGeometryViewDrawables& View);
+
+    // Submits the draws of the sorted list to the sink. The primitive attributes of a batch of draws
+    // are written into the sink memory at once, and the batch is drawn when the buffer is full or the list ends.
+    void DrawSortedDrawables(RadientGeometryRenderer&              Renderer,
+                             IRadientGeometryCommandSink&          Sink,
+                             const std::vector<RadientDrawableID>& DrawableIDs,
+                             DrawStage                             Stage);
+
+    // Submits the commands of the passes to the device context. Pipeline states are created in the PSO caches of the pass.
+    class DeviceCommandSink final : public IRadientGeometryCommandSink
+    {
+    public:
+        explicit DeviceCommandSink(RadientGeometryPass& Pass) noexcept :
+            m_Pass{Pass}
+        {}
+
+        // Sets up the commands of a sorted draw list. Returns false if the resource cache SRB
+        // has no primitive or material attribs variable.
+        bool Begin(RadientGeometryRenderer& Renderer,
+                   IDeviceContext*          pContext,
+                   IShaderResourceBinding*  pResourceCacheSRB);
+
+        virtual IPipelineState* GetPipelineState(RadientGeometryPipelineType Type, const PBR_Renderer::PSOKey& Key) override final;
+        virtual bool            IsPipelineReady(IPipelineState* pPSO) const override final;
+
+        virtual Uint8* BeginPrimitiveBatch() override final;
+        virtual void   EndPrimitiveBatch(Uint32 BatchSize) override final;
+
+        virtual void SetVertexPool(IVertexPool* pVertexPool) override final;
+        virtual void SetPipelineState(IPipelineState* pPSO) override final;
+        virtual void SetPrimitiveAttribsOffset(Uint32 Offset) override final;
+        virtual void SetMaterialAttribsOffset(Uint32 Offset) override final;
+
+        virtual void Draw(RadientDrawableID DrawableID, const RadientDrawableSlot& Drawable) override final;
+        virtual void DrawIndexedIndirect(IBuffer* pDrawArgs, Uint64 DrawArgsOffset, Uint32 MaxDrawCount, IBuffer* pDrawCounts, Uint64 DrawCountOffset) override final;
+
+    private:
+        RadientGeometryPass& m_Pass;
+
+        IDeviceContext*          m_pContext             = nullptr;
+        IShaderResourceBinding*  m_pResourceCacheSRB    = nullptr;
+        IShaderResourceVariable* m_pPrimitiveAttribsVar = nullptr;
+        IShaderResourceVariable* m_pMaterialAttribsVar  = nullptr;
+        IBuffer*                 m_pPrimitiveAttribsCB  = nullptr;
+        bool                     m_IsDynamicCB          = false;
+        bool                     m_IsSRBCommitted       = false;
+    };
+
+    // GPU-driven draws of a main pass draw list. The records do not depend on the camera,
+    // so they are only uploaded when the list or the transforms of its drawables change.
+    struct IndirectDrawBuffers
+    {
+        const RadientDrawList*  pDrawList = nullptr;
+        RadientIndirectDrawList Draws;
+        RefCntAutoPtr<IBuffer>  pRecords;
+        RefCntAutoPtr<IBuffer>  pDrawArgs;
+        RefCntAutoPtr<IBuffer>  pDrawCounts;
+    };
 
-    void BuildSortedDrawableIDs(const RadientDrawList&           DrawList,
-                                const RadientSceneDrawableCache& DrawableCache);
+    RADIENT_STATUS CreateIndirectCullResources(IRenderDevice* pDevice);
+
+    // Builds the indirect draws of the indexed main pass drawables of the state-sorted list and culls them
+    // on the GPU. The other drawables are written to m_DirectDrawIDs. Returns null if there are no indirect draws.
+    const IndirectDrawBuffers* CullIndirectDraws(RadientGeometryRenderer&              Renderer,
+                                                 IRenderDevice*                        pDevice,
+                                                 IDeviceContext*                       pContext,
+                                                 const RadientDrawList&                DrawList,
+                                                 const std::vector<RadientDrawableID>& DrawableIDs);
+
+    // Submits the culled indirect draws to the sink. The primitive records of the draws of a bucket
+    // are written consecutively into the sink memory, batched like the records of DrawSortedDrawables().
+    void DrawIndirectBuckets(RadientGeometryRenderer&     Renderer,
+                             IRadientGeometryCommandSink& Sink,
+                             const IndirectDrawBuffers&   Buffers);
 
 private:
+    DeviceCommandSink m_DeviceSink{*this};
+
+    // Sink the pass was prepared with, or null if the pass is not prepared.
+    // Pipeline states of the drawable pass data belong to the sink.
+    IRadientGeometryCommandSink* m_pSink = nullptr;
+
     PBR_Renderer::PsoCacheAccessor m_PbrPSOCache;
     PBR_Renderer::PsoCacheAccessor m_WireframePSOCache;
+    PBR_Renderer::PsoCacheAccessor m_DepthPrepassPSOCache;
+    PBR_Renderer::PsoCacheAccessor m_EarlyZPSOCache;
+    PBR_Renderer::PsoCacheAccessor m_ShadowPSOCache;
 
     std::vector<DrawablePassData>  m_DrawablePassData;
-    std::vector<RadientDrawableID> m_SortedDrawableIDs;
+    std::vector<RadientDrawableID> m_ShadowCasterIDs;     // Casters of the current cascade
+    std::vector<RadientDrawableID> m_VisibleIDs;          // Main pass drawables that are not occluded
+    std::vector<Uint8>             m_MaterialAttribsData; // Material attribs packing scratch
+
+    // Record offsets of the draws of the current primitive attribs batch
+    std::vector<Uint32> m_PrimitiveOffsets;
+    // Primitive attribs of the current batch when the buffer is not dynamic and is updated with UpdateBuffer()
+    std::vector<Uint8> m_PrimitiveAttribsData;
+
+    // GPU-driven rendering state, see CullIndirectDraws()
+    std::vector<IndirectDrawBuffers>                      m_IndirectDrawBuffers;
+    std::vector<RadientIndirectDrawItem>                  m_IndirectDrawItems;
+    std::vector<RadientDrawableID>                        m_IndirectDrawIDs; // Drawable of every indirect draw item
+    std::vector<RadientDrawableID>                        m_DirectDrawIDs;   // Main pass drawables that are drawn one by one
+    std::vector<std::pair<IPipelineState*, IVertexPool*>> m_IndirectDrawStates;
+    std::vector<Uint32>                                   m_ZeroDrawCounts;
+    RefCntAutoPtr<IPipelineState>                         m_pIndirectCullPSO;
+    RefCntAutoPtr<IShaderResourceBinding>                 m_pIndirectCullSRB;
+    RefCntAutoPtr<IBuffer>                                m_pIndirectCullAttribsCB;
+
+    // Stage lists are rebuilt only when the drawable cache draw lists or the pass data change.
+    RadientDrawListCache m_DrawListCache;
+    Uint64               m_DrawListRevision = ~Uint64{0};
+
+    // Build ID of the depth pre-pass list rendered in the current frame, or zero if there was no pre-pass.
+    // Main pass PSOs depend on the drawables that were rendered by the pre-pass.
+    Uint64 m_DepthPrepassBuildID = 0;
 
     PBR_Renderer::PSO_FLAGS m_RenderFlags = PBR_Renderer::PSO_FLAG_NONE;
 
-    TEXTURE_FORMAT m_RTVFormat = TEX_FORMAT_UNKNOWN;
-    TEXTURE_FORMAT m_DSVFormat = TEX_FORMAT_UNKNOWN;
+    TEXTURE_FORMAT m_RTVFormat       = TEX_FORMAT_UNKNOWN;
+    TEXTURE_FORMAT m_DSVFormat       = TEX_FORMAT_UNKNOWN;
+    TEXTURE_FORMAT m_ShadowMapFormat = TEX_FORMAT_UNKNOWN;
+
+    // Incremented by every depth pre-pass and by Prepare(), so that the main pass only uses
+    // early-Z PSOs for drawables whose depth was written in the current frame.
+    Uint32 m_DepthPrepassIndex = 0;
 
     bool m_EnableAsyncPipelineCompilation = true;
+    bool m_EnableDepthPrepass             = false;
+
+    // Whether the sink provides the pipeline states of the depth pre-pass and the shadow pass
+    bool m_HasDepthPrepassPipelines = false;
+    bool m_HasShadowPipelines       = false;
+
+    RadientOcclusionCullingDesc m_OcclusionDesc;
 };
 
 } // namespace Diligent
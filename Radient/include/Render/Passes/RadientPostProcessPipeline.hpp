@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "Render/Passes/RadientToneMappingPass.hpp"
 #include "Render/RadientFrameRenderTargets.hpp"
 
 namespace Diligent
@@ -35,8 +36,22 @@ namespace Diligent
 class RadientPostProcessPipeline
 {
 public:
-    RADIENT_STATUS Prepare(IRenderDevice* pDevice, IDeviceContext* pContext, const RadientFrameRenderTargets& Targets);
-    RADIENT_STATUS Execute(IDeviceContext* pContext, const RadientFrameRenderTargets& Targets);
+    explicit RadientPostProcessPipeline(const RadientToneMappingDesc& ToneMappingDesc);
+
+    RADIENT_STATUS Prepare(IRenderDevice*                   pDevice,
+                           IDeviceContext*                  pContext,
+                           Uint32                           ViewIndex,
+                           const RadientFrameRenderTargets& Targets);
+
+    /// Resolves the scene color of the view to its output target.
+    /// Does nothing if the scene is rendered directly to the output.
+    RADIENT_STATUS Execute(IDeviceContext*                  pContext,
+                           Uint32                           ViewIndex,
+                           const RadientFrameRenderTargets& Targets,
+                           double                           DeltaTime);
+
+private:
+    RadientToneMappingPass m_ToneMappingPass;
 };
 
 } // namespace Diligent
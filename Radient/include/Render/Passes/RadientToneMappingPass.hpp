@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "Render/RadientAutoExposure.hpp"
+#include "Render/RadientFrameRenderTargets.hpp"
+#include "PostProcess/Common/interface/PostFXRenderTechnique.hpp"
+
+#include "RadientRenderer.h"
+#include "RefCntAutoPtr.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Diligent
+{
+
+/// Resolves the HDR scene color of a view to its output color target.
+///
+/// With auto exposure, the luminance histogram of the scene color is built by a compute pass, and the
+/// adapted average luminance of the view is updated from the histogram on the GPU, so that the exposure
+/// never reads back to the CPU. Every view has its own adapted luminance.
+class RadientToneMappingPass
+{
+public:
+    explicit RadientToneMappingPass(const RadientToneMappingDesc& Desc);
+    ~RadientToneMappingPass();
+
+    bool IsEnabled() const { return m_Desc.Enable == True; }
+
+    /// Creates the pipeline states for the output format of the view and the exposure state of the view.
+    RADIENT_STATUS Prepare(IRenderDevice* pDevice, Uint32 ViewIndex, const RadientFrameRenderTargets& Targets);
+
+    /// Tone maps the HDR scene color of the view to its output color target.
+    RADIENT_STATUS Execute(IDeviceContext*                  pContext,
+                           Uint32                           ViewIndex,
+                           const RadientFrameRenderTargets& Targets,
+                           double                           DeltaTime);
+
+    /// Returns the tone mapping mode of the operator, see ToneMappingStructures.fxh.
+    static int GetToneMappingMode(RADIENT_TONE_MAPPING_OPERATOR Operator);
+
+    /// Returns the auto-exposure parameters of the tone mapping description.
+    static RadientAutoExposureDesc GetAutoExposureDesc(const RadientToneMappingDesc& Desc);
+
+private:
+    RADIENT_STATUS CreateExposureResources(IRenderDevice* pDevice);
+
+    RADIENT_STATUS CreateToneMappingTechnique(IRenderDevice* pDevice, TEXTURE_FORMAT RTVFormat, PostFXRenderTechnique& Technique);
+
+    void UpdateAttribs(IDeviceContext* pContext, const RadientFrameRenderTargets& Targets, double DeltaTime);
+
+private:
+    const RadientToneMappingDesc  m_Desc;
+    const RadientAutoExposureDesc m_AutoExposureDesc;
+
+    RefCntAutoPtr<IBuffer> m_pToneMappingAttribsCB;
+    RefCntAutoPtr<IBuffer> m_pExposureAttribsCB;
+
+    // Luminance histogram of the view that is being tone mapped. The adaptation pass clears it.
+    RefCntAutoPtr<IBuffer> m_pHistogram;
+
+    RefCntAutoPtr<IPipelineState>         m_pHistogramPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pHistogramSRB;
+    RefCntAutoPtr<IPipelineState>         m_pAdaptPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pAdaptSRB;
+
+    // Adapted average luminance of every view
+    std::vector<RefCntAutoPtr<IBuffer>> m_ViewExposure;
+
+    // Tone mapping techniques by the output format
+    std::unordered_map<TEXTURE_FORMAT, PostFXRenderTechnique> m_Techniques;
+};
+
+} // namespace Diligent
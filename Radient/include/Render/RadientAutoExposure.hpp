@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "BasicMath.hpp"
+
+#include <array>
+
+namespace Diligent
+{
+
+/// Auto-exposure parameters, see RadientToneMappingDesc.
+struct RadientAutoExposureDesc
+{
+    /// Base-2 logarithms of the luminance range of the histogram.
+    float MinLogLuminance = -10.f;
+    float MaxLogLuminance = 6.f;
+
+    /// The average luminance is computed over the pixels between the low and the high percentiles.
+    float LowPercentile  = 0.5f;
+    float HighPercentile = 0.95f;
+
+    /// Speed of the adaptation in 1/seconds. Zero adapts immediately.
+    float AdaptationSpeed = 1.5f;
+};
+
+/// CPU reference implementation of the auto-exposure passes of the tone mapping stage.
+///
+/// The luminance of the scene color is accumulated into a histogram of log2 luminance (BuildLuminanceHistogram.csh).
+/// The average log2 luminance of the pixels between the low and the high percentiles is then computed from the
+/// histogram, and the adapted luminance of the view moves towards it exponentially over time (AdaptExposure.csh).
+/// The shaders implement the same math, so that the algorithm is tested on the CPU.
+class RadientAutoExposure
+{
+public:
+    /// Must match RADIENT_LUMINANCE_HISTOGRAM_BIN_COUNT in RadientToneMappingStructures.fxh.
+    static constexpr Uint32 HistogramBinCount = 128;
+
+    using Histogram = std::array<Uint32, HistogramBinCount>;
+
+    /// Returns the relative luminance of the linear color.
+    static float GetLuminance(const float3& Color);
+
+    /// Returns the histogram bin of the luminance. Luminance outside of the histogram range is clamped.
+    static Uint32 GetHistogramBin(float Luminance, const RadientAutoExposureDesc& Desc);
+
+    /// Returns the log2 luminance of the center of the bin.
+    static float GetBinLogLuminance(Uint32 Bin, const RadientAutoExposureDesc& Desc);
+
+    /// Adds the pixels of a linear color image to the histogram.
+    ///
+    /// \param [in]  pPixels       - Pixels with at least three float components, rows are tightly packed.
+    /// \param [in]  NumPixels     - The number of pixels.
+    /// \param [in]  NumComponents - The number of components of a pixel, must be at least 3.
+    static void AddToHistogram(const float*                   pPixels,
+                               size_t                         NumPixels,
+                               Uint32                         NumComponents,
+                               const RadientAutoExposureDesc& Desc,
+                               Histogram&                     Hist);
+
+    /// Returns the average luminance of the pixels between the low and the high percentiles,
+    /// or 0 if the histogram is empty.
+    static float ComputeAverageLuminance(const Histogram& Hist, const RadientAutoExposureDesc& Desc);
+
+    /// Returns the fraction of the difference between the adapted and the average luminance
+    /// that is covered in DeltaTime seconds.
+    static float GetAdaptationRate(float DeltaTime, float AdaptationSpeed);
+
+    /// Moves the adapted luminance towards the average luminance.
+    /// A non-positive adapted luminance (the first frame) is replaced with the average luminance,
+    /// and a non-positive average luminance (an empty histogram) keeps the adapted luminance.
+    static float AdaptLuminance(float AdaptedLuminance, float AverageLuminance, float DeltaTime, float AdaptationSpeed);
+};
+
+} // namespace Diligent
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "Timer.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Type of a command recorded by RadientCommandLog.
+enum class RadientCommandType : Uint8
+{
+    /// Object is the pipeline state identity.
+    SetPipelineState,
+
+    /// Object is the vertex pool identity.
+    SetVertexBuffers,
+
+    /// Offset is the offset of the material attributes in the material table.
+    SetMaterial,
+
+    /// Object is the buffer identity, Offset and Size are the written range.
+    WriteBuffer,
+
+    /// Object is the drawable ID, Offset is the start vertex and Size is the vertex count.
+    Draw,
+
+    /// Object is the drawable ID, Offset is the first index and Size is the index count.
+    DrawIndexed,
+
+    /// Object is the draw arguments buffer identity, Offset is the offset of the arguments
+    /// of the first draw and Size is the maximum draw count.
+    DrawIndexedIndirect
+};
+
+/// Command recorded by RadientCommandLog.
+struct RadientCommand
+{
+    RadientCommandType Type   = RadientCommandType::Draw;
+    Uint32             Pass   = 0;
+    Uint64             Object = 0;
+    Uint32             Offset = 0;
+    Uint32             Size   = 0;
+};
+
+/// In-memory log of the commands of one frame.
+///
+/// Renderers without a render device record the commands they would submit to the device context
+/// into the log, so that the CPU side of a frame can be executed and inspected without a GPU.
+/// Commands are grouped into passes, and every pass measures the CPU time between BeginPass()
+/// and EndPass(). Objects are opaque identities and are never dereferenced.
+class RadientCommandLog
+{
+public:
+    static constexpr Uint32 InvalidViewIndex = ~0u;
+
+    struct PassInfo
+    {
+        const char* Name      = nullptr; // Must be a string literal
+        Uint32      ViewIndex = InvalidViewIndex;
+
+        Uint32 FirstCommand = 0;
+        Uint32 CommandCount = 0;
+
+        Uint32 DrawCount        = 0;
+        Uint32 StateChangeCount = 0;
+        Uint64 BufferWriteSize  = 0;
+
+        double CPUTime = 0; // Seconds
+    };
+
+    /// Drops the commands and passes of the previous frame.
+    void Clear();
+
+    /// Begins a pass. Commands recorded until EndPass() belong to it.
+    void BeginPass(const char* Name, Uint32 ViewIndex = InvalidViewIndex);
+
+    /// Ends the current pass and stores its CPU time.
+    void EndPass();
+
+    void SetPipelineState(Uint64 PSO) { Record(RadientCommandType::SetPipelineState, PSO, 0, 0); }
+    void SetVertexBuffers(Uint64 VertexPool) { Record(RadientCommandType::SetVertexBuffers, VertexPool, 0, 0); }
+    void SetMaterial(Uint32 Offset) { Record(RadientCommandType::SetMaterial, 0, Offset, 0); }
+    void WriteBuffer(Uint64 Buffer, Uint32 Offset, Uint32 Size) { Record(RadientCommandType::WriteBuffer, Buffer, Offset, Size); }
+    void Draw(Uint64 DrawableID, Uint32 StartVertex, Uint32 VertexCount) { Record(RadientCommandType::Draw, DrawableID, StartVertex, VertexCount); }
+    void DrawIndexed(Uint64 DrawableID, Uint32 FirstIndex, Uint32 IndexCount) { Record(RadientCommandType::DrawIndexed, DrawableID, FirstIndex, IndexCount); }
+    void DrawIndexedIndirect(Uint64 DrawArgs, Uint32 DrawArgsOffset, Uint32 MaxDrawCount) { Record(RadientCommandType::DrawIndexedIndirect, DrawArgs, DrawArgsOffset, MaxDrawCount); }
+
+    const std::vector<RadientCommand>& GetCommands() const { return m_Commands; }
+    const std::vector<PassInfo>&       GetPasses() const { return m_Passes; }
+
+    /// Returns the number of commands of the given type recorded in the frame.
+    Uint32 GetCommandCount(RadientCommandType Type) const;
+
+    /// Returns the pass with the given name recorded for the view, or null if there is no such pass.
+    const PassInfo* FindPass(const char* Name, Uint32 ViewIndex = InvalidViewIndex) const;
+
+private:
+    void Record(RadientCommandType Type, Uint64 Object, Uint32 Offset, Uint32 Size);
+
+private:
+    std::vector<RadientCommand> m_Commands;
+    std::vector<PassInfo>       m_Passes;
+
+    bool  m_InPass = false;
+    Timer m_PassTimer;
+};
+
+} // namespace Diligent
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientMath.h"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Depth ordering of drawable primitives.
+///
+/// Every item carries a 32-bit depth key, a tie-break key and a value (e.g. a drawable ID), and Sort()
+/// orders items by ascending depth key, then by ascending tie-break key. The depth key defines the
+/// direction: GetBackToFrontKey() decreases with the distance from the camera and is used for blended
+/// primitives, while GetFrontToBackKey() increases with the distance and only keeps a coarse depth
+/// bucket, so that primitives in the same bucket are grouped by the tie-break key (e.g. the PSO).
+/// Sort() is a stable LSD radix sort, so items with equal keys keep their insertion order and the
+/// result does not change from frame to frame.
+class RadientDepthSorter
+{
+public:
+    void Clear()
+    {
+        m_Items.clear();
+    }
+
+    void Reserve(size_t Count)
+    {
+        m_Items.reserve(Count);
+    }
+
+    void Add(Uint32 DepthKey, Uint32 TieBreak, Uint32 Value)
+    {
+        m_Items.push_back(Item{(Uint64{DepthKey} << 32u) | TieBreak, Value});
+    }
+
+    size_t GetItemCount() const
+    {
+        return m_Items.size();
+    }
+
+    /// Sorts the items and writes their values to SortedValues.
+    void Sort(std::vector<Uint32>& SortedValues);
+
+    /// Returns the world-space plane whose signed distance is the view-space depth.
+    /// ViewDirection must be normalized.
+    static RadientFloat4 GetDepthPlane(const RadientFloat3& CameraPosition,
+                                       const RadientFloat3& ViewDirection);
+
+    /// Returns the depth of the world-space center of the primitive bounds.
+    static float GetViewDepth(const RadientFloat4&    DepthPlane,
+                              const RadientMatrix4x4& WorldMatrix,
+                              const RadientBounds&    LocalBounds);
+
+    /// Quantizes the view-space depth. Greater depths produce smaller keys.
+    static Uint32 GetBackToFrontKey(float ViewDepth);
+
+    /// Returns the coarse depth bucket of the view-space depth. Buckets are logarithmic with
+    /// four buckets per octave, and all depths at or behind the camera plane share bucket 0.
+    static Uint32 GetFrontToBackKey(float ViewDepth);
+
+private:
+    struct Item
+    {
+        Uint64 Key   = 0;
+        Uint32 Value = 0;
+    };
+
+    std::vector<Item> m_Items;
+    std::vector<Item> m_Scratch;
+};
+
+} // namespace Diligent
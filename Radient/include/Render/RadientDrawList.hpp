@@ -61,15 +61,21 @@ struct RadientDrawItem
 /// A draw list does not own drawable data and does not preserve semantic order. Removal uses
 /// swap-erase; RemoveAt returns the moved drawable ID so RadientSceneDrawableCache can repair
 /// the moved slot's DrawListIndex.
+///
+/// The visibility masks of the drawables are kept in a separate column parallel to the items,
+/// so that filtering the list by a view layer mask only reads contiguous masks.
 class RadientDrawList
 {
 public:
     using ItemListType = std::vector<RadientDrawItem>;
+    using MaskListType = std::vector<Uint64>;
 
-    size_t Add(RadientDrawableID DrawableID)
+    size_t Add(RadientDrawableID DrawableID,
+               Uint64            VisibilityMask = ~Uint64{0})
     {
         const size_t Index = m_Items.size();
         m_Items.emplace_back(DrawableID);
+        m_VisibilityMasks.push_back(VisibilityMask);
         return Index;
     }
 
@@ -92,13 +98,27 @@ public:
         return m_Items;
     }
 
+    void SetVisibilityMask(size_t Index, Uint64 VisibilityMask);
+
+    /// Visibility masks of the items, in the item order.
+    const MaskListType& GetVisibilityMasks() const
+    {
+        return m_VisibilityMasks;
+    }
+
+    /// Appends the IDs of the drawables whose visibility mask shares at least one bit with the layer mask.
+    void FilterByLayerMask(Uint64                          LayerMask,
+                           std::vector<RadientDrawableID>& DrawableIDs) const;
+
     void Clear()
     {
         m_Items.clear();
+        m_VisibilityMasks.clear();
     }
 
 private:
     ItemListType m_Items;
+    MaskListType m_VisibilityMasks;
 };
 
 
@@ -112,9 +132,10 @@ public:
     void Clear();
 
     size_t Add(GLTF::Material::ALPHA_MODE AlphaMode,
-               RadientDrawableID          DrawableID)
+               RadientDrawableID          DrawableID,
+               Uint64                     VisibilityMask = ~Uint64{0})
     {
-        return m_DrawLists[AlphaMode].Add(DrawableID);
+        return m_DrawLists[AlphaMode].Add(DrawableID, VisibilityMask);
     }
 
     RadientDrawableID RemoveAt(GLTF::Material::ALPHA_MODE AlphaMode,
@@ -123,6 +144,13 @@ public:
         return m_DrawLists[AlphaMode].RemoveAt(Index);
     }
 
+    void SetVisibilityMask(GLTF::Material::ALPHA_MODE AlphaMode,
+                           size_t                     Index,
+                           Uint64                     VisibilityMask)
+    {
+        m_DrawLists[AlphaMode].SetVisibilityMask(Index, VisibilityMask);
+    }
+
     bool IsEmpty() const;
 
     const RadientDrawList& GetDrawList(GLTF::Material::ALPHA_MODE AlphaMode) const
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "Render/RadientDrawList.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Cache of the drawable ID lists that geometry passes build from draw lists.
+///
+/// A pass list is filtered by the view layer mask, effective visibility and pipeline readiness,
+/// and is sorted by state for state-ordered passes. Entries are keyed by the source draw list,
+/// the layer mask and the pass stage, so views that share a layer mask (e.g. split-screen views)
+/// reuse the same lists, while views with other masks (e.g. editor overlays) keep their own.
+/// The owner calls Invalidate() when the draw lists or the pass data the lists depend on change.
+class RadientDrawListCache
+{
+public:
+    /// Maximum number of cached lists. All lists are dropped when a new key exceeds the limit.
+    static constexpr size_t MaxEntryCount = 64;
+
+    struct Key
+    {
+        const void* pSource   = nullptr; // Draw list or draw lists the list is built from
+        Uint64      LayerMask = ~Uint64{0};
+        Uint32      Stage     = 0;
+
+        bool operator==(const Key& Rhs) const
+        {
+            return pSource == Rhs.pSource &&
+                LayerMask == Rhs.LayerMask &&
+                Stage == Rhs.Stage;
+        }
+    };
+
+    struct Entry
+    {
+        Key EntryKey;
+
+        // Cache revision the list was built at
+        Uint64 Revision = 0;
+
+        // Caller-defined value the list depends on in addition to the cache revision
+        Uint64 Dependency = 0;
+
+        // Unique ID of the list build. Lists built from this list may use it as their dependency.
+        Uint64 BuildID = 0;
+
+        // Set to false by the owner if some drawables were skipped only temporarily
+        // (e.g. because their pipelines are not ready yet), so that the list is rebuilt next time.
+        bool IsComplete = true;
+
+        std::vector<RadientDrawableID> DrawableIDs;
+    };
+
+    /// Returns the entry for the key. If the cached list was built at the current revision with the
+    /// same dependency and is complete, IsValid is set to true and the list can be used as is.
+    /// Otherwise the list is cleared, IsValid is set to false, and the caller must rebuild it.
+    /// The reference is valid until the next call to Get() or Clear().
+    Entry& Get(const Key& EntryKey, Uint64 Dependency, bool& IsValid);
+
+    /// Invalidates all cached lists.
+    void Invalidate()
+    {
+        ++m_Revision;
+    }
+
+    void Clear()
+    {
+        m_Entries.clear();
+    }
+
+    size_t GetEntryCount() const
+    {
+        return m_Entries.size();
+    }
+
+private:
+    // Few views render through a pass, so entries are searched linearly.
+    std::vector<Entry> m_Entries;
+
+    Uint64 m_Revision    = 1;
+    Uint64 m_NextBuildID = 1;
+};
+
+} // namespace Diligent
@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Linear allocator of per-draw records in a buffer that is refilled for every batch of draws.
+///
+/// A geometry pass writes the records of a sorted draw list one after another while the buffer is
+/// mapped, and every draw then selects its record by the buffer offset. Every record is followed by
+/// enough space to bind the full buffer range at its offset. When the buffer is full, the caller
+/// issues the pending draws, starts a new batch with Restart() and maps the buffer again.
+///
+/// The allocator deliberately does not track frames in flight and has no fences. Every batch, including
+/// consecutive batches of one frame, starts at offset 0 and overwrites the records of the previous one.
+/// This relies on the driver renaming the buffer memory on every update:
+///   - A dynamic buffer is mapped with MAP_FLAG_DISCARD for every batch, and the engine recycles
+///     the discarded memory once the GPU is done with it.
+///   - On OpenGL, a default buffer is updated with UpdateBuffer() for every batch, and the driver
+///     orphans the storage that is still in use by the GPU.
+/// A persistently mapped buffer without renaming would need a fence-guarded ring instead.
+class RadientDrawRecordAllocator
+{
+public:
+    static constexpr Uint32 InvalidOffset = ~0u;
+
+    /// Sets the buffer size, the record offset alignment and the size of the range bound at a record offset.
+    /// Drops the current batch.
+    void Reset(Uint32 BufferSize, Uint32 OffsetAlignment, Uint32 RangeSize);
+
+    /// Allocates a record and returns its offset, or InvalidOffset if the record does not fit into the
+    /// current batch. A record that does not fit into an empty batch can never be allocated.
+    Uint32 Allocate(Uint32 RecordSize);
+
+    /// Starts a new batch.
+    void Restart();
+
+    /// Returns the number of bytes written by the records of the current batch.
+    Uint32 GetBatchSize() const { return m_BatchSize; }
+
+    /// Returns the number of records in the current batch.
+    Uint32 GetRecordCount() const { return m_RecordCount; }
+
+    Uint32 GetBufferSize() const { return m_BufferSize; }
+    Uint32 GetRangeSize() const { return m_RangeSize; }
+
+private:
+    Uint32 m_BufferSize      = 0;
+    Uint32 m_OffsetAlignment = 1;
+    Uint32 m_RangeSize       = 0;
+
+    Uint32 m_BatchSize   = 0;
+    Uint32 m_RecordCount = 0;
+};
+
+} // namespace Diligent
@@ -46,6 +46,10 @@ struct RadientDrawableMeshPrimitive
 
     Uint32 FirstElement = 0;
     Uint32 ElementCount = 0;
+
+    /// Object-space bounds of the primitive. Empty bounds at the origin are used
+    /// when the source does not provide them.
+    RadientBounds LocalBounds;
 };
 
 struct RadientDrawableMeshGeometry
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "Render/RadientTransientTargetPool.hpp"
+
 #include "RadientRenderer.h"
 
 namespace Diligent
@@ -35,20 +37,66 @@ namespace Diligent
 class RadientFrameRenderTargets
 {
 public:
+    /// Format of the HDR scene color target.
+    static constexpr TEXTURE_FORMAT HDRColorFormat = TEX_FORMAT_RGBA16_FLOAT;
+
+    /// Prepares the targets of the view. The scene is rendered to the output color view
+    /// until the transient targets are resolved.
     RADIENT_STATUS Prepare(IRenderDevice* pDevice, IRadientRenderTarget& Target);
 
+    /// Declares the HDR scene color target that is written by the passes from ScenePass
+    /// and read by the passes up to PostProcessPass. Ignored if the target has no color view.
+    void DeclareSceneColor(RadientTransientTargetPool& Pool, Uint32 ScenePass, Uint32 PostProcessPass);
+
+    /// Takes the views of the declared targets from the compiled pool.
+    /// If the pool has no textures, the scene is rendered to the output color view.
+    void ResolveTransientTargets(const RadientTransientTargetPool& Pool);
+
+    /// Sets the render scale of the view. The scene is rendered to the top-left part of the HDR
+    /// scene color target and upscaled when it is tone mapped. Without the HDR target, the scale is ignored.
+    /// Must be called after the transient targets are resolved.
+    void SetRenderScale(float Scale);
+
     const RadientExtent2D& GetSize() const;
     Uint32                 GetVersion() const;
 
+    /// Returns the size of the rendered image, which is less than the target size when the render scale is below 1.
+    const RadientExtent2D& GetRenderSize() const { return m_RenderSize; }
+
+    /// Sets the viewport of the rendered image. Must be called after the scene targets are bound.
+    void SetViewport(IDeviceContext* pContext) const;
+
+    /// Returns the color view the scene is rendered to: the HDR scene color view, or the output view.
     ITextureView* GetColorRTV() const;
     ITextureView* GetDepthDSV() const;
 
+    /// Returns the color view of the view target.
+    ITextureView* GetOutputRTV() const;
+
+    /// Returns the shader resource view of the HDR scene color, or null if the scene is rendered to the output.
+    ITextureView* GetSceneColorSRV() const;
+
+    bool IsHDR() const { return m_pSceneColorSRV != nullptr; }
+
+    /// Clears the HDR scene color. The output view is cleared by the application.
+    void ClearSceneColor(IDeviceContext* pContext) const;
+
+    /// Returns true if the color and depth views of both bundles have the same formats,
+    /// so that the same pipeline states can render to either of them.
+    bool HasSameFormats(const RadientFrameRenderTargets& Other) const;
+
 private:
     RadientExtent2D m_Size;
+    RadientExtent2D m_RenderSize;
     Uint32          m_Version = 0;
 
-    ITextureView* m_pColorRTV = nullptr;
-    ITextureView* m_pDepthDSV = nullptr;
+    ITextureView* m_pColorRTV      = nullptr;
+    ITextureView* m_pDepthDSV      = nullptr;
+    ITextureView* m_pOutputRTV     = nullptr;
+    ITextureView* m_pSceneColorSRV = nullptr;
+
+    // Transient target of the HDR scene color
+    Uint32 m_SceneColorTarget = RadientTransientTargetPool::InvalidIndex;
 };
 
 } // namespace Diligent
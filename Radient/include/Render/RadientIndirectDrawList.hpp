@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientMath.h"
+#include "BasicMath.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+namespace HLSL
+{
+#include "Shaders/Common/public/ShaderDefinitions.fxh"
+#include "Shaders/Radient/private/RadientIndirectDrawStructures.fxh"
+} // namespace HLSL
+
+/// Indexed draw of the GPU-driven forward pass.
+struct RadientIndirectDrawItem
+{
+    /// Caller-defined index of the pipeline state and the vertex pool of the draw.
+    Uint32 StateIndex = 0;
+
+    /// Material table slot of the draw.
+    Uint32 MaterialIndex = 0;
+
+    Uint32 IndexCount = 0;
+    Uint32 FirstIndex = 0;
+    Uint32 BaseVertex = 0;
+
+    /// World-space bounds. Draws with inverted bounds are never culled.
+    RadientBounds Bounds;
+};
+
+/// Draw buckets and GPU buffer layout of the GPU-driven forward pass.
+///
+/// Draws that share the pipeline state, the vertex pool and the material are grouped into buckets
+/// that are drawn with one indirect multi-draw call. The bucket size is limited by the size of the
+/// primitive attribs array of the PBR shaders, which read the attributes of a draw by its index
+/// in the multi-draw.
+///
+/// Every draw has a record in the records buffer and the DrawIndexedIndirect arguments in the
+/// arguments buffer. The arguments of a bucket are contiguous and follow the bucket order, and
+/// every bucket has a draw count in the counts buffer. The culling shader (CullIndirectDraws.csh)
+/// writes the arguments and the counts; CullRadientIndirectDraws() is its CPU reference.
+class RadientIndirectDrawList
+{
+public:
+    static constexpr Uint32 DrawArgsStride = RADIENT_INDIRECT_DRAW_ARGS_WORDS * sizeof(Uint32);
+    static constexpr Uint32 CullGroupSize  = RADIENT_INDIRECT_CULL_GROUP_SIZE;
+
+    struct Bucket
+    {
+        Uint32 StateIndex    = 0;
+        Uint32 MaterialIndex = 0;
+        Uint32 FirstDraw     = 0; // Index of the arguments of the first draw of the bucket
+        Uint32 DrawCount     = 0;
+    };
+
+    /// Groups the draws into buckets and writes their records.
+    /// Draws with the same state and material are grouped in the order of the items, and buckets are
+    /// ordered by the state and the material, so that state-sorted items keep their state order.
+    /// Returns true if the records differ from the records of the previous build and must be uploaded.
+    bool Build(const std::vector<RadientIndirectDrawItem>& Items, Uint32 MaxBucketSize);
+
+    void Clear();
+
+    const std::vector<Bucket>&                          GetBuckets() const { return m_Buckets; }
+    const std::vector<HLSL::RadientIndirectDrawRecord>& GetRecords() const { return m_Records; }
+
+    /// Returns the index of the item that is drawn with the arguments at the given index.
+    Uint32 GetDrawItem(Uint32 DrawIndex) const { return m_DrawItems[DrawIndex]; }
+
+    Uint32 GetDrawCount() const { return static_cast<Uint32>(m_Records.size()); }
+    Uint32 GetBucketCount() const { return static_cast<Uint32>(m_Buckets.size()); }
+
+    Uint64 GetRecordsSize() const { return Uint64{sizeof(HLSL::RadientIndirectDrawRecord)} * m_Records.size(); }
+    Uint64 GetDrawArgsSize() const { return Uint64{DrawArgsStride} * m_Records.size(); }
+    Uint64 GetDrawCountsSize() const { return Uint64{sizeof(Uint32)} * m_Buckets.size(); }
+
+    static Uint64 GetDrawArgsOffset(const Bucket& DrawBucket) { return Uint64{DrawArgsStride} * DrawBucket.FirstDraw; }
+    static Uint64 GetDrawCountOffset(Uint32 BucketIndex) { return Uint64{sizeof(Uint32)} * BucketIndex; }
+
+private:
+    std::vector<Bucket>                          m_Buckets;
+    std::vector<HLSL::RadientIndirectDrawRecord> m_Records;
+    std::vector<HLSL::RadientIndirectDrawRecord> m_PrevRecords;
+    std::vector<Uint32>                          m_DrawItems;
+};
+
+/// Returns the culling attributes of the view. ViewProj transforms world space to clip space
+/// (row-vector convention). NDCMinusOneToOne is true if the normalized device depth range is [-1, 1].
+HLSL::RadientIndirectCullAttribs GetRadientIndirectCullAttribs(const float4x4& ViewProj,
+                                                               bool            NDCMinusOneToOne,
+                                                               Uint32          RecordCount);
+
+/// CPU reference implementation of the culling shader.
+/// pDrawArgs receives RADIENT_INDIRECT_DRAW_ARGS_WORDS words per record, pDrawCounts one word per bucket.
+/// The draw counts must be cleared by the caller.
+void CullRadientIndirectDraws(const HLSL::RadientIndirectCullAttribs& Attribs,
+                              const HLSL::RadientIndirectDrawRecord*  pRecords,
+                              Uint32*                                 pDrawArgs,
+                              Uint32*                                 pDrawCounts);
+
+} // namespace Diligent
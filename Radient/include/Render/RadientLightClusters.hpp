@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "BasicMath.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Light cluster grid parameters.
+///
+/// Cluster space is the camera view space with x pointing right, y pointing up and z being the
+/// positive distance along the view direction. The grid splits the viewport into GridSizeX x GridSizeY
+/// screen tiles (tile rows are counted from the top of the viewport) and the [NearZ, FarZ] depth range
+/// into GridSizeZ exponential slices. The projection is assumed to be symmetric.
+struct RadientLightClusterGridDesc
+{
+    Uint32 GridSizeX = 16;
+    Uint32 GridSizeY = 8;
+    Uint32 GridSizeZ = 24;
+
+    float NearZ = 0.1f;
+    float FarZ  = 1000.f;
+
+    /// Projection matrix scale factors (the _11 and _22 elements).
+    float ProjScaleX = 1.f;
+    float ProjScaleY = 1.f;
+
+    bool Orthographic = false;
+};
+
+/// Range of the light index list referenced by a single cluster.
+/// The layout matches the uint2 elements of the g_LightClusterGrid shader buffer.
+struct RadientLightClusterRange
+{
+    Uint32 Offset = 0;
+    Uint32 Count  = 0;
+};
+static_assert(sizeof(RadientLightClusterRange) == sizeof(Uint32) * 2, "Cluster range must match the shader uint2 layout");
+
+/// CPU froxel light binning.
+///
+/// Lights are bounded point (sphere) and spot (cone) lights given in cluster space. Bin() tests every
+/// light against the clusters covered by the light's bounding sphere and writes a compact light index
+/// list together with a per-cluster offset/count grid. Within a cluster, light indices are sorted in
+/// ascending order, so the result does not depend on the binning order.
+///
+/// Light and cluster bounds are stored as structures of arrays, and the per-light cluster row test is
+/// written as a branch-free loop, which lets the compiler vectorize it.
+class RadientLightClusters
+{
+public:
+    void SetGrid(const RadientLightClusterGridDesc& Desc);
+
+    const RadientLightClusterGridDesc& GetGridDesc() const { return m_Desc; }
+
+    void ClearLights();
+
+    /// Adds a point light and returns its index.
+    Uint32 AddPointLight(const float3& Position, float Range);
+
+    /// Adds a spot light and returns its index.
+    /// Direction must be normalized. OuterConeAngle is the half-angle of the cone in radians.
+    Uint32 AddSpotLight(const float3& Position, const float3& Direction, float Range, float OuterConeAngle);
+
+    Uint32 GetLightCount() const { return static_cast<Uint32>(m_PosX.size()); }
+
+    void Bin();
+
+    Uint32 GetClusterCount() const { return m_Desc.GridSizeX * m_Desc.GridSizeY * m_Desc.GridSizeZ; }
+
+    Uint32 GetClusterIndex(Uint32 X, Uint32 Y, Uint32 Z) const
+    {
+        return (Z * m_Desc.GridSizeY + Y) * m_Desc.GridSizeX + X;
+    }
+
+    /// Returns the index of the cluster that contains the cluster-space point, following the
+    /// same mapping the shader uses. Returns false if the point is outside of the view volume.
+    bool FindCluster(const float3& Pos, Uint32& ClusterIndex) const;
+
+    /// Returns the depth slice of the cluster-space depth, clamped to the grid.
+    Uint32 GetDepthSlice(float Depth) const;
+
+    /// Parameters of the exponential depth slicing, see PBRLightClusterAttribs.
+    float GetDepthSliceScale() const { return m_DepthSliceScale; }
+    float GetDepthSliceBias() const { return m_DepthSliceBias; }
+
+    void GetClusterBounds(Uint32 ClusterIndex, float3& Min, float3& Max) const;
+
+    /// Reference light-cluster intersection test used by the binning.
+    bool LightIntersectsCluster(Uint32 LightIndex, Uint32 ClusterIndex) const;
+
+    const std::vector<RadientLightClusterRange>& GetClusterRanges() const { return m_ClusterRanges; }
+    const std::vector<Uint32>&                   GetLightIndices() const { return m_LightIndices; }
+
+private:
+    void ComputeClusterBounds();
+
+    float GetSliceDepth(Uint32 Slice) const;
+
+    bool GetLightClusterRange(Uint32 LightIndex, Uint32 (&MinIdx)[3], Uint32 (&MaxIdx)[3]) const;
+
+private:
+    RadientLightClusterGridDesc m_Desc;
+
+    float m_DepthSliceScale = 0;
+    float m_DepthSliceBias  = 0;
+
+    // Cluster bounds (SoA)
+    std::vector<float> m_ClusterMinX;
+    std::vector<float> m_ClusterMinY;
+    std::vector<float> m_ClusterMinZ;
+    std::vector<float> m_ClusterMaxX;
+    std::vector<float> m_ClusterMaxY;
+    std::vector<float> m_ClusterMaxZ;
+
+    // Cluster bounding spheres used by the cone test (SoA)
+    std::vector<float> m_ClusterCenterX;
+    std::vector<float> m_ClusterCenterY;
+    std::vector<float> m_ClusterCenterZ;
+    std::vector<float> m_ClusterRadius;
+
+    // Lights (SoA)
+    std::vector<float> m_PosX;
+    std::vector<float> m_PosY;
+    std::vector<float> m_PosZ;
+    std::vector<float> m_Range;
+    std::vector<float> m_DirX;
+    std::vector<float> m_DirY;
+    std::vector<float> m_DirZ;
+    std::vector<float> m_ConeCos;
+    std::vector<float> m_ConeSin;
+
+    std::vector<RadientLightClusterRange> m_ClusterRanges;
+    std::vector<Uint32>                   m_LightIndices;
+
+    // Binning scratch data
+    std::vector<Uint32> m_HitClusters;
+    std::vector<Uint32> m_HitLights;
+    std::vector<Uint8>  m_RowHits;
+};
+
+} // namespace Diligent
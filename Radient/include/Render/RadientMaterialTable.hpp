@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientTypes.h"
+
+#include "GLTFLoader.hpp"
+#include "PBR_Renderer.hpp"
+#include "RefCntAutoPtr.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Diligent
+{
+
+/// Persistent table of packed PBR material attributes.
+///
+/// Every material a geometry pass draws occupies a fixed-size slot of a constant buffer that the
+/// resource cache SRB binds with the slot range. Draws select their material by setting the buffer
+/// offset to the slot offset instead of writing the attributes into the material constant buffer.
+/// A slot is keyed by the material and the PSO flags the attributes are packed for, and is written
+/// only when it is acquired with attributes that differ from its contents. CommitUpdates() uploads
+/// the range of slots written since the previous commit.
+///
+/// Slots are reference-counted by the drawables that use them and are recycled once released.
+class RadientMaterialTable
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Range of slots [First, End).
+    struct SlotRange
+    {
+        Uint32 First = 0;
+        Uint32 End   = 0;
+
+        bool IsEmpty() const { return First >= End; }
+    };
+
+    /// Sets the maximum size of the packed attributes of a slot and the alignment of slot offsets,
+    /// see PBR_Renderer::GetPBRMaterialAttribsSize() and BufferProperties::ConstantBufferOffsetAlignment.
+    /// Changing the layout drops all slots and the buffer.
+    void SetLayout(Uint32 AttribsSize, Uint32 OffsetAlignment);
+
+    /// Acquires the slot of the material attributes packed for the PSO flags and returns its index.
+    /// The slot is written and marked dirty if it is new or its contents differ from pAttribs.
+    /// Returns InvalidIndex if the layout is not set or the attributes do not fit into a slot.
+    Uint32 Acquire(const GLTF::Material*   pMaterial,
+                   PBR_Renderer::PSO_FLAGS PSOFlags,
+                   const void*             pAttribs,
+                   Uint32                  Size);
+
+    /// Releases a slot acquired by Acquire(). The slot is recycled when it is no longer used.
+    void Release(Uint32 Index);
+
+    /// Uploads the dirty slots to the buffer. The buffer is created or grown if it can't hold all slots,
+    /// in which case the version is incremented and all slots are uploaded.
+    RADIENT_STATUS CommitUpdates(IRenderDevice* pDevice, IDeviceContext* pContext);
+
+    Uint32 GetSlotOffset(Uint32 Index) const { return Index * m_SlotStride; }
+    Uint32 GetSlotStride() const { return m_SlotStride; }
+    Uint32 GetAttribsSize() const { return m_AttribsSize; }
+
+    /// Number of slots including the recycled ones.
+    Uint32 GetSlotCount() const { return static_cast<Uint32>(m_Slots.size()); }
+    Uint32 GetUsedSlotCount() const { return GetSlotCount() - static_cast<Uint32>(m_FreeSlots.size()); }
+    Uint32 GetUseCount(Uint32 Index) const { return Index < m_Slots.size() ? m_Slots[Index].UseCount : 0; }
+
+    const Uint8* GetSlotData(Uint32 Index) const { return Index < m_Slots.size() ? &m_Data[GetSlotOffset(Index)] : nullptr; }
+
+    /// Slots written since the previous commit.
+    const SlotRange& GetDirtySlots() const { return m_DirtySlots; }
+
+    /// Marks all slots as uploaded. Called by CommitUpdates() after the upload.
+    void ResetDirtySlots() { m_DirtySlots = {}; }
+
+    IBuffer* GetBuffer() const { return m_pBuffer; }
+
+    /// Incremented every time the buffer is recreated. SRBs that bind the buffer must then be updated.
+    Uint32 GetBufferVersion() const { return m_BufferVersion; }
+
+private:
+    struct SlotKey
+    {
+        const GLTF::Material*   pMaterial = nullptr;
+        PBR_Renderer::PSO_FLAGS PSOFlags  = PBR_Renderer::PSO_FLAG_NONE;
+
+        bool operator==(const SlotKey& Rhs) const
+        {
+            return pMaterial == Rhs.pMaterial && PSOFlags == Rhs.PSOFlags;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const SlotKey& Key) const;
+        };
+    };
+
+    struct Slot
+    {
+        SlotKey Key;
+        Uint32  UseCount = 0;
+    };
+
+    void MarkDirty(Uint32 Index);
+
+private:
+    Uint32 m_AttribsSize = 0;
+    Uint32 m_SlotStride  = 0;
+
+    std::vector<Slot>                                    m_Slots;
+    std::vector<Uint32>                                  m_FreeSlots;
+    std::unordered_map<SlotKey, Uint32, SlotKey::Hasher> m_SlotIndices;
+
+    // CPU copy of the buffer contents
+    std::vector<Uint8> m_Data;
+    SlotRange          m_DirtySlots;
+
+    RefCntAutoPtr<IBuffer> m_pBuffer;
+    Uint32                 m_BufferVersion = 0;
+};
+
+} // namespace Diligent
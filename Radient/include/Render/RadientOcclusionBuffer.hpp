@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientMath.h"
+#include "BasicMath.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Occlusion culling parameters of a geometry pass.
+struct RadientOcclusionCullingDesc
+{
+    /// Whether occlusion culling is enabled.
+    bool Enable = false;
+
+    /// Width of the occlusion depth buffer in pixels. The height follows the aspect ratio of the view.
+    Uint32 BufferWidth = 256;
+
+    /// Maximum number of occluders rasterized per view. The occluders that appear largest
+    /// in the view are selected.
+    Uint32 MaxOccluderCount = 64;
+};
+
+/// Low-resolution CPU depth buffer used to cull primitives hidden behind occluders.
+///
+/// Occluder triangles are transformed and binned into screen tiles by AddOccluder(), and every tile
+/// is rasterized independently by RasterizeTile(), so that the tiles can be processed in parallel.
+/// BuildHierarchy() then reduces the buffer into a pyramid that keeps both the nearest and the farthest
+/// depth of every texel. IsOccluded() descends the pyramid only where the bounds of the tested box can
+/// neither be accepted by the nearest depth nor rejected by the farthest depth of a texel.
+///
+/// Depth is the normalized device depth in [0, 1], with the near plane at 0. Pixels that no occluder
+/// covers keep the far plane depth, so boxes beyond the far plane are occluded as well.
+class RadientOcclusionBuffer
+{
+public:
+    /// Width and height of a rasterization tile in pixels.
+    static constexpr Uint32 TileSize = 32;
+
+    /// Resizes the buffer, sets the transformation from world space to the clip space of the view
+    /// and removes all occluders. The depth is cleared by RasterizeTile().
+    void Begin(Uint32 Width, Uint32 Height, const float4x4& ViewProj);
+
+    /// Adds the triangles of an occluder mesh. Triangles that cross the near plane are skipped,
+    /// which keeps the culling conservative.
+    void AddOccluder(const float3*   pPositions,
+                     Uint32          NumVertices,
+                     const Uint32*   pIndices,
+                     Uint32          NumIndices,
+                     const float4x4& World);
+
+    /// Adds the box of the object-space bounds as an occluder. The occluding object must fill its bounds.
+    void AddOccluderBox(const RadientBounds& LocalBounds, const float4x4& World);
+
+    Uint32 GetTileCount() const { return m_TileCountX * m_TileCountY; }
+
+    /// Clears the tile and rasterizes the occluder triangles that overlap it.
+    /// Different tiles may be rasterized concurrently.
+    void RasterizeTile(Uint32 Tile);
+
+    /// Builds the min/max depth hierarchy. Must be called after all tiles are rasterized.
+    void BuildHierarchy();
+
+    /// Returns true if the box of the object-space bounds is hidden behind the occluders, i.e. the nearest
+    /// depth of the box is farther than the depth of every pixel that the screen rectangle of the box touches.
+    /// Boxes that cross the near plane or lie outside of the screen are never occluded.
+    /// May be called concurrently after BuildHierarchy().
+    bool IsOccluded(const RadientBounds& LocalBounds, const float4x4& World) const;
+
+    Uint32 GetWidth() const { return m_Width; }
+    Uint32 GetHeight() const { return m_Height; }
+    Uint32 GetTriangleCount() const { return static_cast<Uint32>(m_Triangles.size()); }
+
+    /// Returns the number of hierarchy levels including the full-resolution level 0.
+    Uint32 GetLevelCount() const { return static_cast<Uint32>(m_Levels.size()) + 1; }
+
+    Uint32 GetLevelWidth(Uint32 Level) const { return Level == 0 ? m_Width : m_Levels[Level - 1].Width; }
+    Uint32 GetLevelHeight(Uint32 Level) const { return Level == 0 ? m_Height : m_Levels[Level - 1].Height; }
+
+    float GetDepth(Uint32 x, Uint32 y) const { return m_Depth[size_t{y} * m_Width + x]; }
+
+    /// Returns the nearest depth of the level texel.
+    float GetMinDepth(Uint32 Level, Uint32 x, Uint32 y) const
+    {
+        return Level == 0 ? GetDepth(x, y) : m_Levels[Level - 1].MinDepth[size_t{y} * m_Levels[Level - 1].Width + x];
+    }
+
+    /// Returns the farthest depth of the level texel.
+    float GetMaxDepth(Uint32 Level, Uint32 x, Uint32 y) const
+    {
+        return Level == 0 ? GetDepth(x, y) : m_Levels[Level - 1].MaxDepth[size_t{y} * m_Levels[Level - 1].Width + x];
+    }
+
+private:
+    // Screen-space triangle. The edge functions and the depth are stored as planes A * x + B * y + C,
+    // so that every pixel is evaluated independently.
+    struct Triangle
+    {
+        float EdgeA[3];
+        float EdgeB[3];
+        float EdgeC[3];
+
+        float DepthA;
+        float DepthB;
+        float DepthC;
+
+        // Inclusive range of the pixels whose centers may be covered
+        Int32 MinX;
+        Int32 MinY;
+        Int32 MaxX;
+        Int32 MaxY;
+    };
+
+    struct Level
+    {
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+
+        std::vector<float> MinDepth;
+        std::vector<float> MaxDepth;
+    };
+
+    void AddTriangle(const float4& V0, const float4& V1, const float4& V2);
+
+    // Returns true if a pixel of the inclusive level-0 rectangle is not farther than Depth.
+    bool IsRegionVisible(Uint32 Level, Int32 X0, Int32 Y0, Int32 X1, Int32 Y1, float Depth) const;
+
+private:
+    Uint32 m_Width      = 0;
+    Uint32 m_Height     = 0;
+    Uint32 m_TileCountX = 0;
+    Uint32 m_TileCountY = 0;
+
+    float4x4 m_ViewProj = float4x4::Identity();
+
+    std::vector<float>               m_Depth;
+    std::vector<Level>               m_Levels; // Levels 1 and higher
+    std::vector<Triangle>            m_Triangles;
+    std::vector<std::vector<Uint32>> m_TileTriangles; // Indices of the triangles that overlap every tile
+    std::vector<float4>              m_ClipPositions; // Occluder vertex scratch
+};
+
+} // namespace Diligent
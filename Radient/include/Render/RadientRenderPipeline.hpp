@@ -26,14 +26,22 @@
 
 #pragma once
 
+#include "Render/Passes/RadientGeometryCommandSink.hpp"
 #include "Render/Passes/RadientGeometryPass.hpp"
 #include "Render/Passes/RadientPostProcessPipeline.hpp"
+#include "Render/RadientCommandLog.hpp"
+#include "Render/RadientResolutionController.hpp"
 #include "Render/RadientSceneDrawableCache.hpp"
+#include "Render/RadientTransientTargetPool.hpp"
 #include "Render/Passes/RadientSkyboxPass.hpp"
 
 #include "RadientBackend.h"
 #include "RadientRenderer.h"
 #include "RefCntAutoPtr.hpp"
+#include "ThreadPool.h"
+
+#include <memory>
+#include <vector>
 
 namespace Diligent
 {
@@ -49,19 +57,74 @@ public:
                           const RadientRendererDesc& Desc);
     ~RadientRenderPipeline();
 
-    RADIENT_STATUS Update(const RadientRenderAttribs& Attribs);
-    RADIENT_STATUS Render(const RadientRenderAttribs& Attribs);
+    /// Synchronizes the scene shared by the views and prepares the passes for the view targets.
+    RADIENT_STATUS Update(const RadientRenderViewsAttribs& Attribs);
+
+    /// Records the views one after another.
+    RADIENT_STATUS Render(const RadientRenderViewsAttribs& Attribs);
+
+    const RadientRendererStats& GetStats() const { return m_Stats; }
+
+    /// Passes of the last frame recorded by the null backend, see IRadientRenderer::GetFramePassStats().
+    const std::vector<RadientFramePassStats>& GetFramePassStats() const { return m_FramePassStats; }
+
+    /// Commands of the last frame recorded by the null backend.
+    const RadientCommandLog& GetCommandLog() const { return m_CommandLog; }
+
+private:
+    struct ViewData
+    {
+        RadientFrameRenderTargets    Targets;
+        RadientGeometryViewDrawables Drawables;
+        RadientResolutionController  Resolution;
+    };
+
+    RADIENT_STATUS RecordViews(const RadientRenderViewsAttribs& Attribs);
+    RADIENT_STATUS RecordView(IRenderDevice*         pDevice,
+                              IDeviceContext*        pContext,
+                              const RadientViewDesc& ViewDesc,
+                              const ViewData&        View,
+                              bool                   HasDrawables);
+
+    // Records the CPU side of the views into the command log of the null backend.
+    void RecordHeadlessViews(const RadientRenderViewsAttribs& Attribs);
+
+    // Resolves the camera-dependent draw lists of the views, removes the occluded drawables and sorts the lists.
+    void PrepareViewDrawables(IRenderDevice* pDevice, const RadientRenderViewsAttribs& Attribs);
+
+    // Removes the occluded drawables from the camera-dependent draw lists of the views.
+    void CullViewDrawables(const RadientRenderViewsAttribs& Attribs);
+
+    // Sorts the camera-dependent draw lists of the views on the thread pool.
+    void SortViewDrawables(Uint32 NumViews);
 
 private:
     RefCntAutoPtr<IRadientBackend>         m_pBackend;
     RefCntAutoPtr<RadientAssetManagerImpl> m_pAssetManager;
 
     RadientSceneDrawableCache  m_DrawableCache;
-    RadientFrameRenderTargets  m_FrameTargets;
     RadientGeometryRenderer    m_GeometryRenderer;
     RadientGeometryPass        m_ForwardPass;
     RadientSkyboxPass          m_SkyboxPass;
     RadientPostProcessPipeline m_PostProcessPipeline;
+
+    // Intermediate targets of the views. Views are recorded one after another, so targets
+    // of different views alias the same textures.
+    RadientTransientTargetPool m_TargetPool;
+
+    // Whether the scene is rendered to an HDR target that the post-processing resolves to the view target
+    const bool m_EnableHDR;
+
+    // Views of the current render call. The array only grows to keep the list storage between frames.
+    std::vector<ViewData>                  m_Views;
+    std::vector<RefCntAutoPtr<IAsyncTask>> m_WorkerTasks;
+
+    RadientRendererStats m_Stats;
+
+    // Null backend only: the commands of the last frame and the sink the forward pass records them with
+    RadientCommandLog                              m_CommandLog;
+    std::unique_ptr<RadientGeometryCommandLogSink> m_CommandSink;
+    std::vector<RadientFramePassStats>             m_FramePassStats;
 };
 
 } // namespace Diligent
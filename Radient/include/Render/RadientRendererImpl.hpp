@@ -103,6 +103,12 @@ public:
 
     virtual RADIENT_STATUS DILIGENT_CALL_TYPE Render(const RadientRenderAttribs& Attribs) override final;
 
+    virtual RADIENT_STATUS DILIGENT_CALL_TYPE RenderViews(const RadientRenderViewsAttribs& Attribs) override final;
+
+    virtual const RadientRendererStats& DILIGENT_CALL_TYPE GetStats() const override final;
+
+    virtual const RadientFramePassStats* DILIGENT_CALL_TYPE GetFramePassStats(Uint32& NumPasses) const override final;
+
 private:
     std::string m_Name;
 
@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientView.h"
+
+namespace Diligent
+{
+
+/// Tuning parameters of the dynamic resolution controller.
+struct RadientResolutionControllerSettings
+{
+    /// Weight of the new frame time in the exponential moving average of the frame time.
+    float SmoothingFactor = 0.25f;
+
+    /// The scale decreases when the average frame time exceeds the target frame time times this ratio.
+    float OverBudgetRatio = 1.f;
+
+    /// The scale increases when the average frame time is below the target frame time times this ratio.
+    /// The gap between the ratios is the hysteresis that keeps the scale from oscillating.
+    float UnderBudgetRatio = 0.8f;
+
+    /// Number of consecutive over-budget frames after which the scale decreases.
+    Uint32 DecreaseFrameCount = 3;
+
+    /// Number of consecutive under-budget frames after which the scale increases.
+    Uint32 IncreaseFrameCount = 30;
+
+    /// Number of frames ignored after a scale change. Measured frame times lag behind
+    /// the rendered frames, so the frames right after the change still reflect the previous scale.
+    Uint32 SettleFrameCount = 4;
+};
+
+/// Dynamic resolution controller of a view.
+///
+/// The controller is fed by the measured frame times and returns the render scale of the next frame.
+/// The scale drops quickly when the frame is over budget: the pixel cost is assumed to be proportional
+/// to the pixel count, so the scale is reduced by the square root of the budget overrun in one change.
+/// The scale grows one step at a time and only after the frame stays well under budget for a while,
+/// so that the frame rate does not oscillate around the target.
+class RadientResolutionController
+{
+public:
+    explicit RadientResolutionController(const RadientResolutionControllerSettings& Settings = {}) noexcept;
+
+    /// Updates the controller with the measured time of the previous frame, in seconds,
+    /// and returns the render scale of the next frame.
+    ///
+    /// When dynamic resolution is disabled, returns the clamped scale of the description.
+    /// Non-positive frame times do not change the scale.
+    float Update(const RadientRenderScaleDesc& Desc, float FrameTime);
+
+    /// Returns the current render scale.
+    float GetScale() const { return m_Scale; }
+
+    /// Returns the number of scale changes since the controller was created.
+    Uint32 GetChangeCount() const { return m_ChangeCount; }
+
+    /// Restarts the dynamic resolution from the initial scale of the description.
+    void Reset();
+
+    /// Returns true if the description can drive the dynamic resolution: the scale step and
+    /// the target frame time are positive, and the minimum scale does not exceed the maximum scale.
+    static bool IsValidDesc(const RadientRenderScaleDesc& Desc);
+
+    /// Returns the largest multiple of the scale step that does not exceed the scale,
+    /// clamped to the bounds of the description.
+    static float QuantizeScale(float Scale, const RadientRenderScaleDesc& Desc);
+
+    /// Returns the minimum and the maximum scale of the description, clamped to (0, 1].
+    static float GetMinScale(const RadientRenderScaleDesc& Desc);
+    static float GetMaxScale(const RadientRenderScaleDesc& Desc);
+
+    /// Returns the size of the rendered image. Every dimension is at least 1.
+    static RadientExtent2D GetRenderSize(const RadientExtent2D& TargetSize, float Scale);
+
+private:
+    void SetScale(float Scale);
+
+private:
+    const RadientResolutionControllerSettings m_Settings;
+
+    float m_Scale = 1.f;
+
+    // Exponential moving average of the frame time. Zero if there are no samples since the last change.
+    float m_AverageFrameTime = 0.f;
+
+    Uint32 m_OverBudgetFrames  = 0;
+    Uint32 m_UnderBudgetFrames = 0;
+    Uint32 m_SettleFrames      = 0;
+    Uint32 m_ChangeCount       = 0;
+
+    bool m_IsDynamic = false;
+};
+
+} // namespace Diligent
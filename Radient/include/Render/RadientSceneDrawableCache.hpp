@@ -73,6 +73,8 @@ struct RadientDrawableSlot
     Uint32 FirstElement       = 0;
     Uint32 ElementCount       = 0;
 
+    RadientBounds LocalBounds;
+
     size_t DrawListIndex = InvalidDrawListIndex;
 
     bool IsValid() const
@@ -140,7 +142,7 @@ public:
 //          v                                           |
 //      m_DrawableSlots[DrawableID] <-------------------+
 //          |
-//          +--> m_DrawLists[AlphaMode] -> RadientDrawItem{DrawableID}
+//          +--> m_DrawLists[AlphaMode] -> RadientDrawItem{DrawableID} + renderer visibility mask
 //          |
 //          +--> m_DrawableChanges     -> Added/Updated/Removed DrawableID
 //
@@ -202,6 +204,13 @@ public:
         return m_SceneRevisions;
     }
 
+    /// Incremented by SyncScene() when the draw list membership, visibility masks, or
+    /// effective visibility of drawables may have changed.
+    Uint64 GetDrawListRevision() const
+    {
+        return m_DrawListRevision;
+    }
+
     const RadientDrawableSlot* GetDrawableSlot(RadientDrawableID DrawableID) const
     {
         if (DrawableID >= m_DrawableSlots.size())
@@ -278,6 +287,7 @@ private:
     RadientDrawLists      m_DrawLists;
     RadientLightLists     m_LightLists;
     RadientSceneRevisions m_SceneRevisions;
+    Uint64                m_DrawListRevision = 0;
 };
 
 } // namespace Diligent
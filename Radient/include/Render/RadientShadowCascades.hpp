@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientMath.h"
+#include "BasicMath.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Cascaded shadow map parameters of a directional light.
+struct RadientShadowCascadeDesc
+{
+    /// Number of cascades. Zero disables the cascades.
+    Uint32 CascadeCount = 4;
+
+    /// Width and height of a cascade in texels.
+    Uint32 Resolution = 2048;
+
+    /// Ratio between fully linear (0) and fully logarithmic (1) partitioning of the camera depth range.
+    float PartitioningFactor = 0.95f;
+
+    /// Maximum camera-space depth covered by the cascades. Zero covers the entire camera depth range.
+    float MaxDistance = 0.f;
+
+    /// Size of the shadow filter kernel in texels. Cascades are extended by half of the kernel,
+    /// so that the filter does not sample beyond the cascade.
+    Uint32 FilterSize = 3;
+
+    /// Whether the normalized device depth range is [-1, 1] (OpenGL) rather than [0, 1].
+    bool NDCMinusOneToOne = false;
+};
+
+/// Shadow cascade.
+struct RadientShadowCascade
+{
+    /// Transforms world space to the light projection space of the cascade (row-vector convention).
+    /// The cascade volume is [-1, 1] x [-1, 1] in x and y and spans the normalized device depth range in z.
+    float4x4 WorldToLightProjSpace = float4x4::Identity();
+
+    /// Camera-space depth range covered by the cascade.
+    float StartZ = 0.f;
+    float EndZ   = 0.f;
+};
+
+/// Stabilized cascaded shadow maps of a directional light.
+///
+/// The camera depth range is split into cascades by ShadowMapManager::DistributeCascades().
+/// Every cascade covers the bounding sphere of its slice of the camera frustum, so that the cascade
+/// extents do not change when the camera rotates, and the cascade center is snapped to the shadow
+/// map texels, so that shadow edges do not shimmer when the camera moves.
+class RadientShadowCascades
+{
+public:
+    /// Distributes the cascades over the depth range of a perspective camera.
+    /// CameraWorld and CameraProj follow the RadientMath::GetCameraProjection() convention,
+    /// i.e. the camera looks along its local -Z axis. LightDirection is the direction the light
+    /// travels in and must be normalized.
+    /// Returns false and removes all cascades if the projection is orthographic.
+    bool Distribute(const RadientShadowCascadeDesc& Desc,
+                    const float4x4&                 CameraWorld,
+                    const float4x4&                 CameraProj,
+                    const float3&                   LightDirection);
+
+    void Clear()
+    {
+        m_Cascades.clear();
+    }
+
+    Uint32 GetCascadeCount() const { return static_cast<Uint32>(m_Cascades.size()); }
+
+    const RadientShadowCascade& GetCascade(Uint32 Cascade) const { return m_Cascades[Cascade]; }
+
+    /// Returns true if the world-space bounds of a shadow caster overlap the volume of the cascade.
+    /// Casters between the light and the cascade are kept, since they may cast shadows into it.
+    /// Shadow pipelines clamp their depth to the near plane instead of clipping them.
+    bool IsCasterVisible(Uint32                  Cascade,
+                         const RadientMatrix4x4& WorldMatrix,
+                         const RadientBounds&    LocalBounds) const;
+
+private:
+    std::vector<RadientShadowCascade> m_Cascades;
+};
+
+} // namespace Diligent
@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientTypes.h"
+#include "RenderDevice.h"
+#include "RefCntAutoPtr.hpp"
+
+#include <vector>
+
+namespace Diligent
+{
+
+/// Transient render target description.
+struct RadientTransientTargetDesc
+{
+    TEXTURE_FORMAT Format    = TEX_FORMAT_UNKNOWN;
+    Uint32         Width     = 0;
+    Uint32         Height    = 0;
+    BIND_FLAGS     BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+
+    bool operator==(const RadientTransientTargetDesc& Rhs) const
+    {
+        return Format == Rhs.Format &&
+            Width == Rhs.Width &&
+            Height == Rhs.Height &&
+            BindFlags == Rhs.BindFlags;
+    }
+
+    bool operator!=(const RadientTransientTargetDesc& Rhs) const
+    {
+        return !(*this == Rhs);
+    }
+};
+
+/// Pool of the render targets that only live during a part of the frame.
+///
+/// Every frame, the passes are added in execution order, and the targets are declared with the first
+/// and the last pass that uses them. When the frame is compiled, the targets are assigned to physical
+/// textures so that targets with the same description whose lifetimes do not overlap share a texture.
+/// Physical textures are kept between frames and reused by the targets with the same description,
+/// and textures that are not used by a frame are released.
+///
+/// Without a device, the pool only assigns the physical targets, so that the scheduling is tested on the CPU.
+class RadientTransientTargetPool
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Memory report of the last compiled frame.
+    struct MemoryReport
+    {
+        Uint32 PassCount           = 0;
+        Uint32 TargetCount         = 0;
+        Uint32 PhysicalTargetCount = 0;
+
+        /// Memory of the textures if every target had its own texture, in bytes.
+        Uint64 UnaliasedMemory = 0;
+
+        /// Memory of the physical textures, in bytes.
+        Uint64 AllocatedMemory = 0;
+
+        /// Maximum memory of the targets that are alive during a pass, in bytes.
+        /// This is the lower bound of the allocated memory.
+        Uint64 PeakMemory = 0;
+
+        /// Pass during which the peak memory is reached.
+        Uint32 PeakPass = InvalidIndex;
+    };
+
+    /// Starts the declaration of a new frame.
+    void BeginFrame();
+
+    /// Adds a pass. Passes are executed in the order they are added.
+    ///
+    /// \param [in] Name - Pass name. The string must be alive until the next frame begins.
+    ///
+    /// \return     Index of the pass.
+    Uint32 AddPass(const Char* Name);
+
+    /// Declares a target that is used by the passes from FirstPass to LastPass inclusive.
+    ///
+    /// \return     Index of the target, or InvalidIndex if the description or the passes are invalid.
+    Uint32 DeclareTarget(const RadientTransientTargetDesc& Desc, const Char* Name, Uint32 FirstPass, Uint32 LastPass);
+
+    /// Assigns the physical targets to the declared targets, creates the new textures
+    /// and releases the textures that are not used by the frame.
+    ///
+    /// \param [in] pDevice - Render device that creates the textures. May be null.
+    RADIENT_STATUS Compile(IRenderDevice* pDevice);
+
+    Uint32 GetPassCount() const { return static_cast<Uint32>(m_Passes.size()); }
+    Uint32 GetTargetCount() const { return static_cast<Uint32>(m_Targets.size()); }
+
+    const Char* GetPassName(Uint32 Pass) const { return m_Passes[Pass]; }
+
+    /// Returns the index of the physical target of the declared target, or InvalidIndex if the frame is not compiled.
+    Uint32 GetPhysicalTarget(Uint32 Target) const { return m_Targets[Target].Physical; }
+
+    /// Returns the number of physical target slots, including released ones.
+    Uint32 GetPhysicalSlotCount() const { return static_cast<Uint32>(m_Physical.size()); }
+
+    /// Returns the texture of the declared target, or null if the pool has no device.
+    ITexture*     GetTexture(Uint32 Target) const;
+    ITextureView* GetRTV(Uint32 Target) const;
+    ITextureView* GetSRV(Uint32 Target) const;
+
+    const MemoryReport& GetMemoryReport() const { return m_Report; }
+
+    /// Returns the memory size of a target with the given description, in bytes.
+    static Uint64 GetMemorySize(const RadientTransientTargetDesc& Desc);
+
+private:
+    struct VirtualTarget
+    {
+        RadientTransientTargetDesc Desc;
+        const Char*                Name      = nullptr;
+        Uint32                     FirstPass = 0;
+        Uint32                     LastPass  = 0;
+        Uint32                     Physical  = InvalidIndex;
+    };
+
+    struct PhysicalTarget
+    {
+        RadientTransientTargetDesc Desc;
+        RefCntAutoPtr<ITexture>    pTexture;
+
+        bool IsUsedInFrame = false;
+
+        // Last pass of the targets assigned to the physical target in the current frame
+        Uint32 LastPass = 0;
+    };
+
+    Uint32 AssignPhysicalTarget(const VirtualTarget& Target, bool HasDevice);
+
+    void UpdateMemoryReport();
+
+private:
+    std::vector<const Char*>    m_Passes;
+    std::vector<VirtualTarget>  m_Targets;
+    std::vector<PhysicalTarget> m_Physical;
+
+    // Declared targets sorted by the first pass
+    std::vector<Uint32> m_SortedTargets;
+
+    // Change of the memory of the alive targets at the beginning of every pass
+    std::vector<Int64> m_PassMemoryDelta;
+
+    MemoryReport m_Report;
+};
+
+} // namespace Diligent
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientScene.h"
+
+#include "entt/entity/storage.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Diligent
+{
+
+// Storage for all instances of one custom component type.
+//
+// Instances with the same name, schema, version and payload size share a slab. A slab keeps the payloads
+// in one contiguous array with a fixed stride, so attaching a component does not allocate per instance
+// and enumeration reads memory sequentially. Instances are removed with swap-remove: the payload offset
+// of an instance is stable until another instance of the same slab is removed or the slab grows.
+//
+// Slabs are found by a hash of their layout. When the last instance of a slab is removed, its memory
+// is released and its index is reused by the next new layout, so short-lived layouts, e.g. payloads
+// of varying sizes, do not accumulate.
+class CustomComponentPool
+{
+public:
+    struct Slab
+    {
+        std::string Name;
+        std::string Schema;
+        Uint32      Version  = 0;
+        Uint32      DataSize = 0;
+
+        // Parallel arrays; Data holds Entities.size() payloads of DataSize bytes each.
+        std::vector<entt::entity>    Entities;
+        std::vector<RadientEntityID> EntityIDs;
+        std::vector<Uint8>           Data;
+
+        size_t       GetCount() const { return Entities.size(); }
+        const Uint8* GetData(size_t Slot) const { return Data.data() + Slot * DataSize; }
+    };
+
+    bool   Contains(entt::entity Entity) const { return m_Locations.contains(Entity); }
+    bool   IsEmpty() const { return m_Locations.empty(); }
+    size_t GetCount() const { return m_Locations.size(); }
+
+    // Adds or replaces the instance of the entity. Returns true if the instance was added.
+    bool Set(entt::entity Entity, RadientEntityID EntityID, const RadientCustomComponentData& Component);
+
+    // Returns false if the entity has no instance.
+    bool Remove(entt::entity Entity);
+
+    // Component type is not set; returned pointers reference pool-owned storage.
+    bool Get(entt::entity Entity, RadientCustomComponentData& Component) const;
+
+    // Slabs whose instances were all removed are empty and are reused by new layouts.
+    const std::vector<Slab>& GetSlabs() const { return m_Slabs; }
+
+private:
+    struct Location
+    {
+        Uint32 SlabIndex = 0;
+        Uint32 Slot      = 0;
+    };
+
+    static size_t ComputeLayoutHash(const RadientCustomComponentData& Component);
+
+    Uint32 FindOrCreateSlab(const RadientCustomComponentData& Component);
+    void   RemoveFromSlab(const Location& Loc);
+    void   FreeSlab(Uint32 SlabIndex);
+
+private:
+    std::vector<Slab> m_Slabs;
+
+    // Slab indices by the layout hash. Slabs with colliding hashes share the key.
+    std::unordered_multimap<size_t, Uint32> m_SlabIndices;
+
+    // Indices of freed slabs
+    std::vector<Uint32> m_FreeSlabs;
+
+    entt::storage<Location> m_Locations;
+};
+
+} // namespace Diligent
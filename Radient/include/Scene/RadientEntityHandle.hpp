@@ -0,0 +1,64 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientTypes.h"
+
+namespace Diligent
+{
+
+// Scene entity IDs are dense generation-checked handles. The low 32 bits hold the slot index plus one,
+// so that zero remains InvalidRadientEntityID, and bits 32..62 hold the generation of the slot.
+// Bit 63 is never set, which keeps scene IDs disjoint from deferred command queue IDs.
+struct RadientEntityHandle
+{
+    static constexpr Uint32 MaxSlotCount  = 0xFFFFFFFFu;
+    static constexpr Uint32 MaxGeneration = 0x7FFFFFFFu;
+
+    Uint32 SlotIndex  = 0;
+    Uint32 Generation = 0;
+
+    constexpr RadientEntityID ToID() const
+    {
+        return (RadientEntityID{Generation} << 32u) | (RadientEntityID{SlotIndex} + 1u);
+    }
+
+    // Returns false if the ID cannot reference any slot.
+    static constexpr bool FromID(RadientEntityID ID, RadientEntityHandle& Handle)
+    {
+        const RadientEntityID Index      = ID & 0xFFFFFFFFu;
+        const RadientEntityID Generation = ID >> 32u;
+        if (Index == 0 || Generation > MaxGeneration)
+            return false;
+
+        Handle.SlotIndex  = static_cast<Uint32>(Index - 1u);
+        Handle.Generation = static_cast<Uint32>(Generation);
+        return true;
+    }
+};
+
+} // namespace Diligent
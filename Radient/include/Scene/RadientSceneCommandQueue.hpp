@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientScene.h"
+#include "RefCntAutoPtr.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Diligent
+{
+
+class RadientSceneState;
+
+// Multi-producer scene command queue.
+//
+// Each producer records into its own arena, so recording does not take locks. Arenas are acquired and
+// released under a mutex, and Replay() must be externally synchronized with recording. Replay order
+// depends only on producer IDs and per-producer recording order, never on thread scheduling:
+//   1. Entity creation, in producer order and then recording order.
+//   2. All other commands, sorted by entity, then producer, then recording order. Only the last local
+//      transform of each entity is applied; commands on an entity that is destroyed in the same batch are dropped.
+//   3. Entity destruction, in entity order.
+class RadientSceneCommandQueue
+{
+public:
+    // Deferred entity IDs returned by Arena::CreateEntity have the high bit set and encode
+    // the producer ID and the creation index. Scene entity IDs never reach this range.
+    static constexpr RadientEntityID DeferredEntityFlag = RadientEntityID{1} << 63u;
+    static constexpr Uint32          MaxProducerID      = 0x7FFFFFFFu;
+
+    static bool IsDeferredEntity(RadientEntityID Entity)
+    {
+        return (Entity & DeferredEntityFlag) != 0;
+    }
+
+    enum class CommandType : Uint8
+    {
+        CreateEntity,
+        DestroyEntity,
+        SetEntityFlags,
+        SetEntityOwnVisibility,
+        SetParent,
+        SetLocalTransform,
+        SetCamera,
+        SetMesh,
+        SetMeshRenderer,
+        SetMaterialBindings,
+        SetLight,
+        SetCustomComponentData,
+        RemoveComponent
+    };
+
+    class Arena
+    {
+    public:
+        explicit Arena(Uint32 ProducerID) noexcept :
+            m_ProducerID{ProducerID}
+        {}
+
+        Uint32 GetProducerID() const { return m_ProducerID; }
+        size_t GetCommandCount() const { return m_Commands.size(); }
+
+        RADIENT_STATUS CreateEntity(const RadientEntityDesc& Desc, RadientEntityID& DeferredEntity);
+        RADIENT_STATUS DestroyEntity(RadientEntityID Entity);
+        RADIENT_STATUS SetEntityFlags(RadientEntityID Entity, RADIENT_ENTITY_FLAGS Flags);
+        RADIENT_STATUS SetEntityOwnVisibility(RadientEntityID Entity, Bool Visible);
+        RADIENT_STATUS SetParent(RadientEntityID Entity, RadientEntityID Parent, Bool KeepWorldTransform);
+        RADIENT_STATUS SetLocalTransform(RadientEntityID Entity, const RadientTransform& Transform);
+        RADIENT_STATUS SetCamera(RadientEntityID Entity, const RadientCameraComponent& Camera);
+        RADIENT_STATUS SetMesh(RadientEntityID Entity, const RadientMeshComponent& Mesh);
+        RADIENT_STATUS SetMeshRenderer(RadientEntityID Entity, const RadientMeshRendererComponent& Renderer);
+        RADIENT_STATUS SetMaterialBindings(RadientEntityID Entity, const RadientMaterialBindingsComponent& Bindings);
+        RADIENT_STATUS SetLight(RadientEntityID Entity, const RadientLightComponent& Light);
+        RADIENT_STATUS SetCustomComponentData(RadientEntityID Entity, const RadientCustomComponentData& Component);
+        RADIENT_STATUS RemoveComponent(RadientEntityID Entity, RadientComponentTypeID ComponentType);
+
+        // Returns the scene entity created by the last replay for a deferred ID recorded by this arena.
+        RADIENT_STATUS ResolveEntity(RadientEntityID DeferredEntity, RadientEntityID& Entity) const;
+
+    private:
+        friend class RadientSceneCommandQueue;
+
+        static constexpr Uint32 InvalidPayloadOffset = ~0u;
+
+        struct Command
+        {
+            RadientEntityID Entity        = InvalidRadientEntityID;
+            Uint32          PayloadOffset = InvalidPayloadOffset;
+            CommandType     Type          = CommandType::DestroyEntity;
+        };
+
+        RADIENT_STATUS Record(CommandType Type, RadientEntityID Entity, Uint32 PayloadOffset = InvalidPayloadOffset);
+
+        template <typename PayloadType>
+        Uint32 WritePayload(const PayloadType& Payload)
+        {
+            return WriteBytes(&Payload, sizeof(Payload));
+        }
+        Uint32 WriteBytes(const void* pData, size_t Size);
+        Uint32 WriteString(const Char* Str);
+
+        void Reset();
+
+    private:
+        const Uint32 m_ProducerID;
+        bool         m_InUse = false;
+
+        std::vector<Command> m_Commands;
+        std::vector<Uint8>   m_Payload;
+
+        // Keeps mesh and material assets referenced by recorded commands alive until replay.
+        std::vector<RefCntAutoPtr<IObject>> m_Assets;
+
+        // Creation indices are never reused, so a deferred ID from an older batch cannot alias a new entity.
+        Uint32 m_NextCreateIndex = 0;
+        Uint32 m_BatchBaseIndex  = 0;
+
+        // Scene entities created by the last replay for creation indices starting at m_ResolvedBaseIndex.
+        Uint32                       m_ResolvedBaseIndex = 0;
+        std::vector<RadientEntityID> m_ResolvedEntities;
+    };
+
+    struct ReplayStats
+    {
+        Uint32 NumCommands  = 0;
+        Uint32 NumApplied   = 0;
+        Uint32 NumCoalesced = 0;
+        Uint32 NumFailed    = 0;
+    };
+
+    RadientSceneCommandQueue();
+    ~RadientSceneCommandQueue();
+
+    // clang-format off
+    RadientSceneCommandQueue           (const RadientSceneCommandQueue&) = delete;
+    RadientSceneCommandQueue& operator=(const RadientSceneCommandQueue&) = delete;
+    RadientSceneCommandQueue           (RadientSceneCommandQueue&&)      = delete;
+    RadientSceneCommandQueue& operator=(RadientSceneCommandQueue&&)      = delete;
+    // clang-format on
+
+    // Returns the arena for the producer, or null if the producer ID is out of range or already in use.
+    // Commands left in a released arena are still replayed.
+    Arena* AcquireArena(Uint32 ProducerID);
+    void   ReleaseArena(Arena* pArena);
+
+    // Applies and clears all recorded commands. Returns the first failed command status, if any.
+    RADIENT_STATUS Replay(RadientSceneState& State, ReplayStats* pStats = nullptr);
+
+private:
+    struct SortedCommand
+    {
+        RadientEntityID Entity       = InvalidRadientEntityID;
+        Uint32          ArenaIndex   = 0;
+        Uint32          CommandIndex = 0;
+    };
+
+    RadientEntityID ResolveDeferredEntity(RadientEntityID Entity) const;
+    RADIENT_STATUS  ApplyCommand(RadientSceneState& State, const Arena& Src, const Arena::Command& Cmd, RadientEntityID Entity) const;
+
+private:
+    std::mutex m_ArenasMtx;
+
+    // Sorted by producer ID.
+    std::vector<std::unique_ptr<Arena>> m_Arenas;
+
+    std::vector<SortedCommand>   m_TmpSortedCommands;
+    std::vector<SortedCommand>   m_TmpDeferredParents;
+    std::vector<RadientEntityID> m_TmpDestroyedEntities;
+};
+
+} // namespace Diligent
@@ -0,0 +1,270 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RadientScene.h"
+#include "RefCntAutoPtr.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Diligent
+{
+
+class RadientSceneState;
+
+// Incremental scene replication stream.
+//
+// The encoder turns the scene entity change log into a sequence of length-prefixed binary frames.
+// A keyframe describes the complete scene; a delta frame only describes entities that changed since
+// the previous frame. Integers are written as LEB128 varints, entity IDs are delta-coded in ascending
+// order, asset URIs are interned per keyframe interval, and local transforms are optionally quantized
+// and written as zigzag deltas against the last value sent for the entity.
+//
+// Frame layout:
+//   varint   Frame size in bytes, not including this field
+//   Uint8    Frame flags (keyframe, quantized transforms, environment)
+//   varint   Frame index
+//   [Float32 x 3]  Position, rotation and scale precision (keyframes with quantized transforms only)
+//   varint x 7     Source scene revisions
+//   varint   Destroyed entity count, followed by delta-coded entity IDs
+//   varint   Entity record count, followed by entity records
+//   [...]    Environment (when the environment flag is set)
+class RadientSceneDeltaEncoder
+{
+public:
+    struct Desc
+    {
+        // Quantization steps. Position and scale are in scene units, rotation in quaternion component units.
+        Float32 PositionPrecision = 1.f / 1024.f;
+        Float32 RotationPrecision = 1.f / 16384.f;
+        Float32 ScalePrecision    = 1.f / 1024.f;
+
+        // When false, local transforms are written as raw 32-bit floats.
+        bool QuantizeTransforms = true;
+
+        // Number of frames between periodic keyframes. Zero disables periodic keyframes;
+        // the first frame is always a keyframe.
+        Uint32 KeyframeInterval = 0;
+    };
+
+    struct FrameStats
+    {
+        Uint64 FrameIndex           = 0;
+        bool   IsKeyframe           = false;
+        Uint32 NumEntityRecords     = 0;
+        Uint32 NumDestroyedEntities = 0;
+        size_t NumBytes             = 0;
+    };
+
+    RadientSceneDeltaEncoder() noexcept;
+    explicit RadientSceneDeltaEncoder(const Desc& EncoderDesc) noexcept;
+
+    const Desc& GetDesc() const { return m_Desc; }
+
+    // Appends one frame to the stream and clears the scene entity change log.
+    // The encoder enables the change log on first use and must be its only consumer.
+    RADIENT_STATUS EncodeFrame(RadientSceneState& State, std::vector<Uint8>& Stream);
+
+    // Makes the next frame a keyframe, e.g. when a new client joins or a decoder lost a frame.
+    void RequestKeyframe() { m_KeyframeRequested = true; }
+
+    const FrameStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+    struct QuantizedTransform
+    {
+        Int64 Values[10] = {};
+    };
+
+private:
+    struct EntityRecord
+    {
+        RadientEntityID                     Entity = InvalidRadientEntityID;
+        Uint32                              Mask   = 0;
+        std::vector<RadientComponentTypeID> CustomComponentTypes;
+    };
+
+    bool IsTransformChangeSignificant(const RadientSceneState& State, RadientEntityID Entity) const;
+    void WriteEntityRecord(const RadientSceneState& State, const EntityRecord& Record, std::vector<Uint8>& Frame);
+    void WriteAssetReference(const IRadientAsset* pAsset, std::vector<Uint8>& Frame);
+    void WriteTransform(RadientEntityID Entity, const RadientTransform& Transform, std::vector<Uint8>& Frame);
+
+    QuantizedTransform Quantize(const RadientTransform& Transform) const;
+
+private:
+    const Desc m_Desc;
+
+    Uint64 m_FrameIndex          = 0;
+    Uint32 m_FramesSinceKeyframe = 0;
+    bool   m_KeyframeRequested   = true;
+
+    RadientRevision m_EnvironmentRevision = 0;
+
+    std::unordered_map<RadientEntityID, QuantizedTransform> m_SentTransforms;
+    std::unordered_map<std::string, Uint32>                 m_SentURIs;
+
+    std::vector<EntityRecord>    m_Records;
+    std::vector<RadientEntityID> m_Destroyed;
+    std::vector<Uint8>           m_Frame;
+
+    FrameStats m_LastFrameStats;
+};
+
+// Applies frames produced by RadientSceneDeltaEncoder to a replica scene.
+//
+// Replica entity IDs are assigned by the replica scene, so the decoder keeps a map from source entity IDs.
+// Frames must be decoded in order. After a missing frame, or before the first keyframe, delta frames are
+// skipped with RADIENT_STATUS_OUT_OF_DATE until the next keyframe resynchronizes the replica.
+class RadientSceneDeltaDecoder
+{
+public:
+    // Resolves an asset reference received from the stream. May return null if the asset is not available,
+    // in which case the mesh or environment map is left unset and the material binding has no material.
+    using ResolveAssetCallbackType = RefCntAutoPtr<IRadientAsset> (*)(const RadientAssetReference& Ref, RADIENT_ASSET_TYPE Type, void* pUserData);
+
+    struct FrameStats
+    {
+        Uint64 FrameIndex          = 0;
+        bool   IsKeyframe          = false;
+        Uint32 NumCreated          = 0;
+        Uint32 NumDestroyed        = 0;
+        Uint32 NumUpdated          = 0;
+        Uint32 NumFailed           = 0;
+        Uint32 NumUnresolvedAssets = 0;
+    };
+
+    RadientSceneDeltaDecoder() noexcept;
+
+    void SetResolveAssetCallback(ResolveAssetCallbackType Callback, void* pUserData)
+    {
+        m_ResolveAssetCallback  = Callback;
+        m_pResolveAssetUserData = pUserData;
+    }
+
+    // Decodes one frame from the beginning of the data and applies it to the replica scene.
+    // BytesConsumed receives the size of the frame including its length prefix, even if the frame was skipped.
+    // Returns RADIENT_STATUS_INVALID_ARGUMENT if the frame is malformed; the replica is not modified in this case.
+    RADIENT_STATUS DecodeFrame(const Uint8* pData, size_t DataSize, RadientSceneState& Replica, size_t& BytesConsumed);
+
+    // Returns the replica entity that mirrors the source entity, or InvalidRadientEntityID.
+    RadientEntityID FindEntity(RadientEntityID SourceEntity) const;
+
+    const RadientSceneRevisions& GetSourceRevisions() const { return m_SourceRevisions; }
+    const FrameStats&            GetLastFrameStats() const { return m_LastFrameStats; }
+    bool                         IsSynchronized() const { return m_Synchronized; }
+
+private:
+    using QuantizedTransform = RadientSceneDeltaEncoder::QuantizedTransform;
+
+    struct AssetRecord
+    {
+        // Empty URI means no asset.
+        std::string URI;
+        Uint64      Version = 0;
+    };
+
+    struct MaterialBindingRecord
+    {
+        Uint32      PrimitiveIndex = 0;
+        AssetRecord Material;
+    };
+
+    struct CustomComponentRecord
+    {
+        RadientComponentTypeID ComponentType = InvalidRadientComponentTypeID;
+        bool                   Present       = false;
+        std::string            Name;
+        std::string            Schema;
+        Uint32                 Version = 0;
+        std::vector<Uint8>     Data;
+    };
+
+    struct EntityRecord
+    {
+        RadientEntityID      SourceEntity = InvalidRadientEntityID;
+        Uint32               Mask         = 0;
+        std::string          Name;
+        RADIENT_ENTITY_FLAGS Flags  = RADIENT_ENTITY_FLAG_NONE;
+        RadientEntityID      Parent = InvalidRadientEntityID;
+        RadientTransform     Transform;
+        QuantizedTransform   QuantizedValues;
+
+        bool                               HasCamera = false;
+        RadientCameraComponent             Camera;
+        bool                               HasMesh = false;
+        AssetRecord                        Mesh;
+        bool                               HasMeshRenderer = false;
+        RadientMeshRendererComponent       MeshRenderer;
+        bool                               HasMaterialBindings = false;
+        std::vector<MaterialBindingRecord> MaterialBindings;
+        bool                               HasLight = false;
+        RadientLightComponent              Light;
+
+        std::vector<CustomComponentRecord> CustomComponents;
+    };
+
+    struct EnvironmentRecord
+    {
+        AssetRecord   EnvironmentMap;
+        RadientFloat3 Color;
+        Float32       Intensity = 1.f;
+        Float32       Exposure  = 0.f;
+    };
+
+    struct EntityMapping
+    {
+        RadientEntityID    Entity = InvalidRadientEntityID;
+        QuantizedTransform Transform;
+    };
+
+    RefCntAutoPtr<IRadientAsset> ResolveAsset(const AssetRecord& Asset, RADIENT_ASSET_TYPE Type);
+
+    void ApplyEntityRecord(RadientSceneState& Replica, const EntityRecord& Record, bool IsKeyframe);
+    void ApplyEnvironment(RadientSceneState& Replica, const EnvironmentRecord& Environment);
+
+private:
+    ResolveAssetCallbackType m_ResolveAssetCallback  = nullptr;
+    void*                    m_pResolveAssetUserData = nullptr;
+
+    bool   m_Synchronized   = false;
+    Uint64 m_NextFrameIndex = 0;
+
+    Float32 m_PositionPrecision = 0;
+    Float32 m_RotationPrecision = 0;
+    Float32 m_ScalePrecision    = 0;
+
+    std::unordered_map<RadientEntityID, EntityMapping> m_EntityMap;
+    std::vector<std::string>                           m_URIs;
+
+    std::vector<EntityRecord> m_Records;
+
+    RadientSceneRevisions m_SourceRevisions;
+    FrameStats            m_LastFrameStats;
+};
+
+} // namespace Diligent
@@ -28,22 +28,14 @@
 
 #include "RadientScene.h"
 #include "FlagEnum.h"
+#include "Scene/Components/RadientCustomComponentPool.hpp"
 #include "Scene/Components/RadientMaterialBindingsStorage.hpp"
 #include "Scene/Components/RadientMeshComponentStorage.hpp"
+#include "Scene/RadientEntityHandle.hpp"
 
 #include "entt/entity/registry.hpp"
 #include "entt/entity/storage.hpp"
 
-#ifdef _MSC_VER
-#    pragma warning(push)
-#    pragma warning(disable : 4127) // conditional expression is constant
-#    pragma warning(disable : 4702) // unreachable code
-#endif
-#include "absl/container/flat_hash_map.h"
-#ifdef _MSC_VER
-#    pragma warning(pop)
-#endif
-
 #include <cstddef>
 #include <functional>
 #include <string>
@@ -115,6 +107,49 @@ public:
         RadientRevision LightsBaseRevision = 0;
     };
 
+    // Per-entity change log consumed by scene replication. Flags accumulate until the log is cleared.
+    // Component flags are set both when a component is updated and when it is removed.
+    enum ENTITY_CHANGE_FLAGS : Uint32
+    {
+        ENTITY_CHANGE_FLAG_NONE              = 0u,
+        ENTITY_CHANGE_FLAG_CREATED           = 1u << 0u,
+        ENTITY_CHANGE_FLAG_FLAGS             = 1u << 1u,
+        ENTITY_CHANGE_FLAG_PARENT            = 1u << 2u,
+        ENTITY_CHANGE_FLAG_TRANSFORM         = 1u << 3u,
+        ENTITY_CHANGE_FLAG_CAMERA            = 1u << 4u,
+        ENTITY_CHANGE_FLAG_MESH              = 1u << 5u,
+        ENTITY_CHANGE_FLAG_MESH_RENDERER     = 1u << 6u,
+        ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS = 1u << 7u,
+        ENTITY_CHANGE_FLAG_LIGHT             = 1u << 8u,
+        ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS = 1u << 9u,
+        ENTITY_CHANGE_FLAG_LAST              = ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS,
+        ENTITY_CHANGE_FLAGS_ALL              = (ENTITY_CHANGE_FLAG_LAST << 1u) - 1u
+    };
+
+    struct EntityChange
+    {
+        RadientEntityID     Entity = InvalidRadientEntityID;
+        ENTITY_CHANGE_FLAGS Flags  = ENTITY_CHANGE_FLAG_NONE;
+
+        // Custom component types that were set or removed.
+        const RadientComponentTypeID* pCustomComponentTypes   = nullptr;
+        Uint32                        NumCustomComponentTypes = 0;
+    };
+
+    // A contiguous run of custom component instances that share name, schema, version and payload size.
+    // Payload of the i-th instance starts at pData + i * DataSize.
+    struct CustomComponentSpan
+    {
+        const Char* Name     = nullptr;
+        const Char* Schema   = nullptr;
+        Uint32      Version  = 0;
+        Uint32      DataSize = 0;
+        Uint32      Count    = 0;
+
+        const RadientEntityID* pEntities = nullptr;
+        const Uint8*           pData     = nullptr;
+    };
+
     RadientSceneState();
     explicit RadientSceneState(const RadientSceneDesc& Desc);
 
@@ -141,6 +176,24 @@ public:
     RADIENT_STATUS GetCamera(RadientEntityID Entity, RadientCameraComponent& Camera) const;
     RADIENT_STATUS HasComponent(RadientEntityID Entity, RadientComponentTypeID ComponentType, Bool& HasComponent) const;
 
+    // Returned names, asset pointers and binding arrays reference scene-owned storage and remain valid until
+    // the entity or the component is modified. Custom component data is pooled per component type and remains
+    // valid until any component of that type is set or removed.
+    RADIENT_STATUS GetEntityName(RadientEntityID Entity, const Char*& Name) const;
+    RADIENT_STATUS GetMesh(RadientEntityID Entity, RadientMeshComponent& Mesh) const;
+    RADIENT_STATUS GetMeshRenderer(RadientEntityID Entity, RadientMeshRendererComponent& Renderer) const;
+    RADIENT_STATUS GetMaterialBindings(RadientEntityID Entity, RadientMaterialBindingsComponent& Bindings) const;
+    RADIENT_STATUS GetLight(RadientEntityID Entity, RadientLightComponent& Light) const;
+    RADIENT_STATUS GetCustomComponentData(RadientEntityID Entity, RadientComponentTypeID ComponentType, RadientCustomComponentData& Component) const;
+    RADIENT_STATUS GetCustomComponentTypes(RadientEntityID Entity, const RadientComponentTypeID*& pComponentTypes, Uint32& NumComponentTypes) const;
+
+    template <typename CallbackType>
+    void EnumerateEntities(CallbackType&& Callback) const;
+
+    // Callback receives const CustomComponentSpan&; spans are valid only during the callback.
+    template <typename CallbackType>
+    void EnumerateCustomComponents(RadientComponentTypeID ComponentType, CallbackType&& Callback) const;
+
     const RadientEnvironmentDesc& GetEnvironment() const;
 
     const RadientSceneRevisions&    GetSceneRevisions() const;
@@ -166,6 +219,29 @@ public:
     void ClearRenderableMeshChanges();
     void ClearRenderableLightChanges();
 
+    // The entity change log is disabled by default so that scenes without replication do not pay for it.
+    // Enabling the log does not record existing entities; consumers should start from a full snapshot.
+    void SetEntityChangeLogEnabled(bool Enabled);
+    bool IsEntityChangeLogEnabled() const { return m_EntityChangeLogEnabled; }
+
+    // Entities created and destroyed since the log was cleared are not reported.
+    template <typename CallbackType>
+    void EnumerateEntityChanges(CallbackType&& Callback) const;
+
+    const std::vector<RadientEntityID>& GetDestroyedEntityChanges() const { return m_DestroyedEntityChanges; }
+
+    void ClearEntityChanges();
+
+    // The flat hierarchy layout mirrors the entity hierarchy in a depth-first ordered array. It is maintained
+    // incrementally when entities are created, reparented, and destroyed: the old range of a moved subtree becomes
+    // tombstones and the subtree is appended at the end. The layout is compacted at the next commit once
+    // tombstones make up half of it.
+    void SetFlatHierarchyEnabled(bool Enabled);
+    bool IsFlatHierarchyEnabled() const { return m_FlatHierarchyEnabled; }
+
+    // Returns the number of times the flat hierarchy layout was built from scratch.
+    Uint32 GetFlatHierarchyRebuildCount() const { return m_FlatHierarchyRebuildCount; }
+
     RADIENT_STATUS CreateEntity(const RadientEntityDesc& Desc, RadientEntityID& Entity);
     RADIENT_STATUS DestroyEntity(RadientEntityID Entity);
 
@@ -227,6 +303,7 @@ private:
     DECLARE_FRIEND_FLAG_ENUM_OPERATORS(CHANGE_FLAGS);
 
     static constexpr size_t InvalidDirtyListIndex = static_cast<size_t>(-1);
+    static constexpr Uint32 InvalidFlatIndex      = ~0u;
 
     struct EntityComponent
     {
@@ -243,6 +320,9 @@ private:
     {
         entt::entity              Parent = entt::null;
         std::vector<entt::entity> Children;
+
+        // Index of the entity's node in m_FlatHierarchy; only meaningful while the flat layout is valid.
+        Uint32 FlatIndex = InvalidFlatIndex;
     };
 
     struct LocalTransformComponent
@@ -275,6 +355,12 @@ private:
         RenderableLightChangeType Type = RenderableLightChangeType::Updated;
     };
 
+    struct PendingEntityChangeComponent
+    {
+        ENTITY_CHANGE_FLAGS                 Flags = ENTITY_CHANGE_FLAG_NONE;
+        std::vector<RadientComponentTypeID> CustomComponentTypes;
+    };
+
     struct DirtyStateComponent
     {
         DIRTY_FLAGS Flags          = DIRTY_FLAG_NONE;
@@ -350,18 +436,36 @@ private:
             m_Storages;
     };
 
+    // A node of the flat hierarchy. Subtrees are appended in depth-first order, so a subtree that was created or
+    // moved as a whole occupies a contiguous run of the array. The child and sibling links define the traversal
+    // order and are updated on every edit, so inserting or reparenting a subtree only appends its own nodes to the
+    // end of the array. The slots of destroyed and moved nodes are no longer linked and stay in the array as
+    // tombstones until the layout is compacted.
+    struct FlatHierarchyNode
+    {
+        entt::entity Entity      = entt::null;
+        Uint32       Parent      = InvalidFlatIndex;
+        Uint32       FirstChild  = InvalidFlatIndex;
+        Uint32       LastChild   = InvalidFlatIndex;
+        Uint32       PrevSibling = InvalidFlatIndex;
+        Uint32       NextSibling = InvalidFlatIndex;
+
+        // Number of nodes in the subtree, including this one.
+        Uint32 SubtreeSize = 1;
+    };
+
     struct DestroyWorkItem
     {
         entt::entity Entity         = entt::null;
         size_t       NextChildIndex = 0;
     };
 
-    struct CustomComponentStorage
+    // Maps the slot index of an entity handle to the registry entity. The generation is incremented when
+    // the entity is destroyed, so stale handles are rejected after the slot is reused.
+    struct EntitySlot
     {
-        std::string        Name;
-        std::string        Schema;
-        Uint32             Version = 0;
-        std::vector<Uint8> Data;
+        entt::entity Entity     = entt::null;
+        Uint32       Generation = 0;
     };
 
     struct CustomComponentIndexComponent
@@ -369,8 +473,6 @@ private:
         std::vector<RadientComponentTypeID> ComponentTypes;
     };
 
-    using CustomComponentStore = entt::storage<CustomComponentStorage>;
-
     template <typename ComponentSourceType>
     RenderableMesh MakeRenderableMesh(entt::entity Entity, const ComponentSourceType& ComponentSource) const;
     template <typename ComponentSourceType>
@@ -384,6 +486,7 @@ private:
 
     void         DetachFromParent(entt::entity Entity);
     CHANGE_FLAGS DestroyEntitySubtree(entt::entity Entity);
+    void         DestroySingleEntity(entt::entity Entity, CHANGE_FLAGS& ChangeFlags);
     bool         RemoveCustomComponents(entt::entity Entity);
     void         RecordRenderableMeshChange(entt::entity Entity, RenderableMeshChangeType Type);
     void         RecordRenderableMeshUpdated(entt::entity Entity);
@@ -392,12 +495,16 @@ private:
     void         RecordRenderableLightChange(entt::entity Entity, RenderableLightChangeType Type);
     void         RecordRenderableLightUpdated(entt::entity Entity);
     bool         RecordRenderableLightRemoved(entt::entity Entity);
+    void         RecordEntityChange(entt::entity Entity, ENTITY_CHANGE_FLAGS Flags);
+    void         RecordCustomComponentChange(entt::entity Entity, RadientComponentTypeID ComponentType);
+    void         RecordEntityDestroyed(entt::entity Entity);
     DIRTY_FLAGS  MarkDirty(entt::entity Entity, DIRTY_FLAGS Flags, bool AddToDirtyList = true);
     void         RemoveFromDirtyList(entt::entity Entity, DirtyStateComponent& DirtyState);
     void         PropagateDirtyFlags(entt::entity Entity, DIRTY_FLAGS Flags);
     void         MarkChildrenDirtyExcept(entt::entity Entity, DIRTY_FLAGS Flags, entt::entity ExcludedChild);
     void         UpdateDirtyEntities();
     void         UpdateDirtySubtree(entt::entity Entity, DIRTY_FLAGS InheritedFlags);
+    void         UpdateDirtySubtreeFlat(entt::entity Entity, DIRTY_FLAGS InheritedFlags);
     void         UpdateDerivedStatePathToRoot(entt::entity Entity, DIRTY_FLAGS Flags);
 
     void UpdateEntityDerivedState(entt::entity            Entity,
@@ -406,24 +513,46 @@ private:
                                   const RadientMatrix4x4* pParentWorldMatrix,
                                   Bool                    ParentVisible);
 
+    void   InsertIntoFlatHierarchy(entt::entity Entity);
+    void   RemoveFromFlatHierarchy(entt::entity Entity);
+    Uint32 AppendFlatSubtree(entt::entity Entity);
+    void   LinkFlatNode(Uint32 Index, Uint32 ParentIndex);
+    void   UnlinkFlatNode(Uint32 Index);
+    void   CompactFlatHierarchyIfSparse();
+    void   InvalidateFlatHierarchy();
+    void   RebuildFlatHierarchy();
+
     void Touch(CHANGE_FLAGS ChangeFlags = CHANGE_FLAG_NONE);
 
     const std::string m_Name;
     RadientSceneDesc  m_Desc;
 
-    using CustomComponentStoresMapType = std::unordered_map<RadientComponentTypeID, CustomComponentStore>;
-    using EntityMapType                = absl::flat_hash_map<RadientEntityID, entt::entity>;
+    using CustomComponentStoresMapType = std::unordered_map<RadientComponentTypeID, CustomComponentPool>;
     entt::registry                      m_Registry;
     CoreStorages                        m_CoreStorages;
-    EntityMapType                       m_EntityMap;
+    std::vector<EntitySlot>             m_EntitySlots;
+    std::vector<Uint32>                 m_FreeEntitySlots;
     CustomComponentStoresMapType        m_CustomComponentStores;
-    RadientEntityID                     m_NextEntityID = 1;
     RadientSceneRevisions               m_SceneRevisions;
     RenderableChangeLogState            m_RenderableChangeLogState;
     RadientEnvironmentDesc              m_Environment;
     RefCntAutoPtr<IRadientTextureAsset> m_pEnvironmentMap;
     std::vector<RenderableMeshChange>   m_RemovedRenderableMeshChanges;
     std::vector<RenderableLightChange>  m_RemovedRenderableLightChanges;
+    std::vector<RadientEntityID>        m_DestroyedEntityChanges;
+
+    bool m_EntityChangeLogEnabled = false;
+
+    bool m_FlatHierarchyEnabled = false;
+    bool m_FlatHierarchyValid   = false;
+
+    // Linked depth-first ordered hierarchy; see FlatHierarchyNode. Valid only when m_FlatHierarchyValid is true.
+    std::vector<FlatHierarchyNode> m_FlatHierarchy;
+
+    // Number of destroyed or moved nodes in m_FlatHierarchy. The layout is compacted once they make up half of it.
+    Uint32 m_NumFlatHierarchyTombstones = 0;
+
+    Uint32 m_FlatHierarchyRebuildCount = 0;
 
     // Conservative scene-wide mask of derived states that may be dirty anywhere in the scene.
     DIRTY_FLAGS m_DirtyFlags = DIRTY_FLAG_NONE;
@@ -443,10 +572,14 @@ private:
 
     // Reused stack for iterative dirty subtree traversal.
     std::vector<DirtyWorkItem> m_TmpDirtyWorkItems;
+
+    // Reused stack of the effective dirty flags of the ancestors of the visited node in flat subtree sweeps.
+    std::vector<DIRTY_FLAGS> m_TmpFlatDirtyFlags;
 };
 
 DEFINE_FLAG_ENUM_OPERATORS(RadientSceneState::DIRTY_FLAGS);
 DEFINE_FLAG_ENUM_OPERATORS(RadientSceneState::CHANGE_FLAGS);
+DEFINE_FLAG_ENUM_OPERATORS(RadientSceneState::ENTITY_CHANGE_FLAGS);
 
 template <typename ComponentSourceType>
 inline RadientSceneState::RenderableMesh RadientSceneState::MakeRenderableMesh(entt::entity Entity, const ComponentSourceType& ComponentSource) const
@@ -568,4 +701,55 @@ void RadientSceneState::EnumerateRenderableLightChanges(CallbackType&& Callback)
     }
 }
 
+template <typename CallbackType>
+void RadientSceneState::EnumerateEntities(CallbackType&& Callback) const
+{
+    auto View = m_Registry.view<const EntityComponent>();
+    for (const entt::entity Entity : View)
+    {
+        Callback(View.get<const EntityComponent>(Entity).ID);
+    }
+}
+
+template <typename CallbackType>
+void RadientSceneState::EnumerateCustomComponents(RadientComponentTypeID ComponentType, CallbackType&& Callback) const
+{
+    const CustomComponentStoresMapType::const_iterator It = m_CustomComponentStores.find(ComponentType);
+    if (It == m_CustomComponentStores.end())
+        return;
+
+    for (const CustomComponentPool::Slab& Slab : It->second.GetSlabs())
+    {
+        if (Slab.Entities.empty())
+            continue;
+
+        CustomComponentSpan Span;
+        Span.Name      = Slab.Name.c_str();
+        Span.Schema    = Slab.Schema.c_str();
+        Span.Version   = Slab.Version;
+        Span.DataSize  = Slab.DataSize;
+        Span.Count     = static_cast<Uint32>(Slab.GetCount());
+        Span.pEntities = Slab.EntityIDs.data();
+        Span.pData     = Slab.DataSize != 0 ? Slab.Data.data() : nullptr;
+        Callback(Span);
+    }
+}
+
+template <typename CallbackType>
+void RadientSceneState::EnumerateEntityChanges(CallbackType&& Callback) const
+{
+    auto View = m_Registry.view<const EntityComponent, const PendingEntityChangeComponent>();
+    for (const entt::entity Entity : View)
+    {
+        const PendingEntityChangeComponent& Pending = View.get<const PendingEntityChangeComponent>(Entity);
+
+        EntityChange Change;
+        Change.Entity                  = View.get<const EntityComponent>(Entity).ID;
+        Change.Flags                   = Pending.Flags;
+        Change.pCustomComponentTypes   = Pending.CustomComponentTypes.data();
+        Change.NumCustomComponentTypes = static_cast<Uint32>(Pending.CustomComponentTypes.size());
+        Callback(Change);
+    }
+}
+
 } // namespace Diligent
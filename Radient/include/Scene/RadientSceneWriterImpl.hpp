@@ -37,6 +37,7 @@ namespace Diligent
 
 class RadientSceneImpl;
 class RadientSceneState;
+class RadientSceneCommandQueue;
 
 class RadientSceneWriterImpl final : public ObjectBase<IRadientSceneWriter>
 {
@@ -91,10 +92,16 @@ public:
     virtual RADIENT_STATUS DILIGENT_CALL_TYPE RemoveComponent(RadientEntityID        Entity,
                                                               RadientComponentTypeID ComponentType) override final;
 
+    virtual RADIENT_STATUS DILIGENT_CALL_TYPE CreateCommandRecorder(Uint32                         ProducerID,
+                                                                    IRadientSceneCommandRecorder** ppRecorder) override final;
+
     virtual RADIENT_STATUS DILIGENT_CALL_TYPE CommitChanges() override final;
 
 private:
     std::shared_ptr<RadientSceneState> m_pState;
+
+    // Shared with recorders so that a recorder may outlive the writer.
+    std::shared_ptr<RadientSceneCommandQueue> m_pCommandQueue;
 };
 
 } // namespace Diligent
@@ -40,6 +40,81 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 typedef struct IRadientRenderTarget IRadientRenderTarget;
 typedef struct IRadientRenderer     IRadientRenderer;
 
+// clang-format off
+
+/// Tone mapping operator.
+DILIGENT_TYPED_ENUM(RADIENT_TONE_MAPPING_OPERATOR, Uint8)
+{
+    /// Scales the color by the exposure and clamps it.
+    RADIENT_TONE_MAPPING_OPERATOR_LINEAR = 0,
+
+    /// Reinhard operator.
+    RADIENT_TONE_MAPPING_OPERATOR_REINHARD,
+
+    /// Uncharted 2 filmic operator.
+    RADIENT_TONE_MAPPING_OPERATOR_UNCHARTED2,
+
+    /// AgX operator.
+    RADIENT_TONE_MAPPING_OPERATOR_AGX,
+
+    /// Khronos PBR Neutral operator.
+    RADIENT_TONE_MAPPING_OPERATOR_PBR_NEUTRAL
+};
+
+// clang-format on
+
+
+/// Tone mapping description.
+struct RadientToneMappingDesc
+{
+    /// Enables tone mapping.
+    ///
+    /// When enabled, the scene is rendered into an intermediate HDR color target, and the post-processing
+    /// pipeline tone maps it into the color target of the view, overwriting its contents.
+    /// When disabled, the scene is rendered directly into the color target of the view.
+    Bool Enable DEFAULT_INITIALIZER(True);
+
+    /// Tone mapping operator.
+    RADIENT_TONE_MAPPING_OPERATOR Operator DEFAULT_INITIALIZER(RADIENT_TONE_MAPPING_OPERATOR_UNCHARTED2);
+
+    /// Exposure compensation as a power of 2.
+    Float32 Exposure DEFAULT_INITIALIZER(0.f);
+
+    /// Luminance that the average scene luminance is mapped to.
+    Float32 MiddleGray DEFAULT_INITIALIZER(0.18f);
+
+    /// White point of the Reinhard and Uncharted 2 operators.
+    Float32 WhitePoint DEFAULT_INITIALIZER(3.f);
+
+    /// Enables automatic exposure.
+    ///
+    /// When enabled, the average scene luminance is computed from a luminance histogram of every frame.
+    /// When disabled, the average luminance is assumed to be MiddleGray, so that only Exposure scales the color.
+    Bool AutoExposure DEFAULT_INITIALIZER(True);
+
+    /// Base-2 logarithm of the minimum luminance of the histogram.
+    Float32 MinLogLuminance DEFAULT_INITIALIZER(-10.f);
+
+    /// Base-2 logarithm of the maximum luminance of the histogram.
+    Float32 MaxLogLuminance DEFAULT_INITIALIZER(6.f);
+
+    /// Fraction of the darkest pixels that are excluded from the average luminance.
+    Float32 LowPercentile DEFAULT_INITIALIZER(0.5f);
+
+    /// Fraction of the pixels below which the average luminance is computed.
+    /// Brighter pixels are excluded, so that small highlights do not darken the image.
+    Float32 HighPercentile DEFAULT_INITIALIZER(0.95f);
+
+    /// Speed of the adaptation to the average luminance, in 1/seconds.
+    /// Zero adapts immediately.
+    ///
+    /// The adaptation advances by RadientRenderViewsAttribs::DeltaTime every frame,
+    /// so the exposure only adapts when the delta time is provided.
+    Float32 AdaptationSpeed DEFAULT_INITIALIZER(1.5f);
+};
+typedef struct RadientToneMappingDesc RadientToneMappingDesc;
+
+
 /// Renderer description.
 struct RadientRendererDesc
 {
@@ -51,6 +126,54 @@ struct RadientRendererDesc
     /// When enabled, geometry drawables are skipped until their pipeline state
     /// is ready instead of blocking the render call.
     Bool EnableAsyncPipelineCompilation DEFAULT_INITIALIZER(True);
+
+    /// Enables the depth pre-pass of the forward pass.
+    ///
+    /// When enabled, opaque and alpha-tested drawables first lay down depth front to back,
+    /// and the main pass only shades the visible surface of each pixel. This reduces the
+    /// shading cost of scenes with heavy overdraw at the price of an additional geometry pass.
+    Bool EnableDepthPrepass DEFAULT_INITIALIZER(False);
+
+    /// Number of shadow cascades of the shadow-casting directional light.
+    ///
+    /// Zero disables shadows. The count is clamped to 8.
+    Uint32 ShadowCascadeCount DEFAULT_INITIALIZER(4);
+
+    /// Width and height of a shadow cascade in texels.
+    Uint32 ShadowMapResolution DEFAULT_INITIALIZER(2048);
+
+    /// Maximum distance from the camera at which shadows are rendered.
+    ///
+    /// Zero uses the camera far plane distance.
+    Float32 ShadowDistance DEFAULT_INITIALIZER(0.f);
+
+    /// Enables CPU occlusion culling.
+    ///
+    /// When enabled, the bounds of the renderers flagged as occluders, see RadientMeshRendererComponent::Occluder,
+    /// are rasterized into a low-resolution depth buffer for every view, and primitives whose bounds
+    /// are hidden behind them are not drawn by the view.
+    Bool EnableOcclusionCulling DEFAULT_INITIALIZER(False);
+
+    /// Width of the occlusion culling depth buffer in pixels.
+    /// The height follows the aspect ratio of the view.
+    Uint32 OcclusionBufferWidth DEFAULT_INITIALIZER(256);
+
+    /// Maximum number of occluders rasterized for a view.
+    ///
+    /// Occluders that appear largest in the view, i.e. whose bounds are largest relative
+    /// to their distance from the camera, are selected.
+    Uint32 MaxOccluderCount DEFAULT_INITIALIZER(64);
+
+    /// Enables GPU-driven rendering of the forward pass.
+    ///
+    /// When enabled, indexed opaque and alpha-tested primitives are frustum-culled by a compute shader,
+    /// and primitives that share the pipeline state and the material are drawn with a single indirect
+    /// multi-draw call. Ignored if the device does not support native multi-draw indirect commands with
+    /// a counter buffer.
+    Bool EnableGPUDrivenRendering DEFAULT_INITIALIZER(False);
+
+    /// Tone mapping applied by the post-processing pipeline.
+    RadientToneMappingDesc ToneMapping DEFAULT_INITIALIZER({});
 };
 typedef struct RadientRendererDesc RadientRendererDesc;
 
@@ -88,12 +211,93 @@ struct RadientRenderAttribs
     /// Time since previous frame.
     double DeltaTime DEFAULT_INITIALIZER(0.0);
 
+    /// Measured time of the previous frame, in seconds.
+    ///
+    /// Drives the dynamic resolution of the views, see RadientRenderScaleDesc::Dynamic.
+    /// Zero uses DeltaTime. Applications that measure the GPU time of the frame should
+    /// pass the larger of the CPU and the GPU times.
+    double FrameTime DEFAULT_INITIALIZER(0.0);
+
     /// Absolute application time.
     double Time DEFAULT_INITIALIZER(0.0);
 };
 typedef struct RadientRenderAttribs RadientRenderAttribs;
 
 
+/// Multi-view render call attributes.
+///
+/// All views are rendered in one frame: the scene is synchronized once, light and environment
+/// setup is shared, and the views are recorded back to back in array order.
+struct RadientRenderViewsAttribs
+{
+    /// Views to render. All views must reference the same scene.
+    IRadientView* const* ppViews DEFAULT_INITIALIZER(nullptr);
+
+    /// Number of elements in ppViews.
+    Uint32 NumViews DEFAULT_INITIALIZER(0);
+
+    /// Optional device context override for local rendering.
+    IDeviceContext* pDeviceContext DEFAULT_INITIALIZER(nullptr);
+
+    /// Time since previous frame.
+    double DeltaTime DEFAULT_INITIALIZER(0.0);
+
+    /// Measured time of the previous frame, in seconds.
+    ///
+    /// Drives the dynamic resolution of the views, see RadientRenderScaleDesc::Dynamic.
+    /// Zero uses DeltaTime. Applications that measure the GPU time of the frame should
+    /// pass the larger of the CPU and the GPU times.
+    double FrameTime DEFAULT_INITIALIZER(0.0);
+
+    /// Absolute application time.
+    double Time DEFAULT_INITIALIZER(0.0);
+};
+typedef struct RadientRenderViewsAttribs RadientRenderViewsAttribs;
+
+
+/// Renderer statistics accumulated since the renderer was created.
+struct RadientRendererStats
+{
+    /// Number of successful Render and RenderViews calls.
+    Uint64 FrameCount DEFAULT_INITIALIZER(0);
+
+    /// Number of views rendered by these calls.
+    Uint64 ViewCount DEFAULT_INITIALIZER(0);
+
+    /// Number of times the renderer synchronized its drawable cache with a scene.
+    /// A render call synchronizes the scene once regardless of the number of views.
+    Uint64 SceneSyncCount DEFAULT_INITIALIZER(0);
+
+    /// Number of primitives that were not drawn by a view because they were occluded, summed over all views.
+    Uint64 OccludedPrimitiveCount DEFAULT_INITIALIZER(0);
+};
+typedef struct RadientRendererStats RadientRendererStats;
+
+
+/// CPU statistics of one pass of the last rendered frame.
+struct RadientFramePassStats
+{
+    /// Pass name.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the view in the render call, or ~0u for passes shared by all views.
+    Uint32 ViewIndex DEFAULT_INITIALIZER(~0u);
+
+    /// Number of draw commands recorded by the pass.
+    Uint32 DrawCount DEFAULT_INITIALIZER(0);
+
+    /// Number of pipeline state, vertex buffer and material changes recorded by the pass.
+    Uint32 StateChangeCount DEFAULT_INITIALIZER(0);
+
+    /// Total size of the buffer writes recorded by the pass, in bytes.
+    Uint64 BufferWriteSize DEFAULT_INITIALIZER(0);
+
+    /// CPU time spent recording the pass, in seconds.
+    double CPUTime DEFAULT_INITIALIZER(0.0);
+};
+typedef struct RadientFramePassStats RadientFramePassStats;
+
+
 // {E15BDBFE-2B5E-4A5A-AF6C-0B7DD326D182}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RadientRenderTarget =
     {0xe15bdbfe, 0x2b5e, 0x4a5a, {0xaf, 0x6c, 0xb, 0x7d, 0xd3, 0x26, 0xd1, 0x82}};
@@ -165,6 +369,9 @@ DILIGENT_BEGIN_INTERFACE(IRadientRenderer, IObject)
                                                       IRadientRenderTarget**            ppTarget) PURE;
 
     /// Creates a persistent render view.
+    ///
+    /// Returns RADIENT_STATUS_INVALID_ARGUMENT if the render scale description is invalid,
+    /// see IRadientView::SetRenderScale.
     VIRTUAL RADIENT_STATUS METHOD(CreateView)(THIS_
                                               const RadientViewDesc REF Desc,
                                               IRadientView**            ppView) PURE;
@@ -172,6 +379,21 @@ DILIGENT_BEGIN_INTERFACE(IRadientRenderer, IObject)
     /// Renders one frame.
     VIRTUAL RADIENT_STATUS METHOD(Render)(THIS_
                                           const RadientRenderAttribs REF Attribs) PURE;
+
+    /// Renders one frame of several views of the same scene, e.g. the eyes of a stereo
+    /// pair, split-screen players or the faces of a cube map.
+    VIRTUAL RADIENT_STATUS METHOD(RenderViews)(THIS_
+                                               const RadientRenderViewsAttribs REF Attribs) PURE;
+
+    /// Returns the renderer statistics.
+    VIRTUAL const RadientRendererStats REF METHOD(GetStats)(THIS) CONST PURE;
+
+    /// Returns the passes of the last rendered frame in the order they were recorded.
+    ///
+    /// Passes are only recorded by renderers of RADIENT_BACKEND_TYPE_NULL backends; other renderers
+    /// return no passes. The array is valid until the next render call.
+    VIRTUAL const RadientFramePassStats* METHOD(GetFramePassStats)(THIS_
+                                                                   Uint32 REF NumPasses) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -183,6 +405,9 @@ DILIGENT_END_INTERFACE
 #    define IRadientRenderer_CreateRenderTarget(This, ...)  CALL_IFACE_METHOD(RadientRenderer, CreateRenderTarget, This, __VA_ARGS__)
 #    define IRadientRenderer_CreateView(This, ...)          CALL_IFACE_METHOD(RadientRenderer, CreateView,         This, __VA_ARGS__)
 #    define IRadientRenderer_Render(This, ...)              CALL_IFACE_METHOD(RadientRenderer, Render,             This, __VA_ARGS__)
+#    define IRadientRenderer_RenderViews(This, ...)         CALL_IFACE_METHOD(RadientRenderer, RenderViews,        This, __VA_ARGS__)
+#    define IRadientRenderer_GetStats(This)                 CALL_IFACE_METHOD(RadientRenderer, GetStats,           This)
+#    define IRadientRenderer_GetFramePassStats(This, ...)   CALL_IFACE_METHOD(RadientRenderer, GetFramePassStats,  This, __VA_ARGS__)
 
 #endif
 
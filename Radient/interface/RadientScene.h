@@ -88,6 +88,16 @@ struct RadientSceneDesc
 {
     /// Scene name.
     const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+    /// Additionally keep entities in a depth-first ordered array so that subtree
+    /// transform updates and subtree destruction are linear sweeps.
+    ///
+    /// Creating or reparenting an entity appends only its own subtree to the end of the
+    /// array and links it to the new parent. The slots left behind by moved and destroyed
+    /// entities are compacted lazily, and subtrees that were created or moved as a whole
+    /// stay contiguous, so the layout benefits scenes whose hierarchy changes less often
+    /// than their transforms.
+    Bool FlatHierarchy DEFAULT_INITIALIZER(False);
 };
 typedef struct RadientSceneDesc RadientSceneDesc;
 
@@ -266,12 +276,34 @@ typedef struct RadientMeshComponent RadientMeshComponent;
 struct RadientMeshRendererComponent
 {
     /// Per-renderer visibility mask.
+    ///
+    /// The renderer is drawn by a view only if the mask shares at least one bit with
+    /// the view layer mask, see RadientViewDesc::LayerMask.
     Uint64 VisibilityMask DEFAULT_INITIALIZER(~0ull);
 
+    /// View-space depth bias, in world units, applied when sorting blended primitives
+    /// back to front. Positive values move the renderer farther from the camera, so it
+    /// is drawn earlier.
+    Float32 SortBias DEFAULT_INITIALIZER(0.f);
+
+    /// Whether the renderer casts shadows from shadow-casting lights.
+    /// Alpha-blended primitives never cast shadows.
+    Bool CastShadows DEFAULT_INITIALIZER(True);
+
+    /// Whether the renderer hides other renderers from occlusion culling, see
+    /// RadientRendererDesc::EnableOcclusionCulling.
+    ///
+    /// The bounds of the opaque primitives of an occluder are rasterized as solid boxes, so only
+    /// renderers whose geometry fills its bounds, such as walls, floors and buildings, should be flagged.
+    Bool Occluder DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr bool operator==(const RadientMeshRendererComponent& Rhs) const
     {
-        return VisibilityMask == Rhs.VisibilityMask;
+        return VisibilityMask == Rhs.VisibilityMask &&
+            SortBias == Rhs.SortBias &&
+            CastShadows == Rhs.CastShadows &&
+            Occluder == Rhs.Occluder;
     }
 
     constexpr bool operator!=(const RadientMeshRendererComponent& Rhs) const
@@ -398,6 +430,10 @@ struct RadientLightComponent
     /// Shaping focus.
     Float32 ShapingFocus DEFAULT_INITIALIZER(0.f);
 
+    /// Whether the light casts shadows. Only directional lights cast shadows,
+    /// and only the first visible shadow-casting directional light is used.
+    Bool CastShadows DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr bool operator==(const RadientLightComponent& Rhs) const
     {
@@ -415,7 +451,8 @@ struct RadientLightComponent
                 Angle == Rhs.Angle &&
                 InnerConeAngle == Rhs.InnerConeAngle &&
                 OuterConeAngle == Rhs.OuterConeAngle &&
-                ShapingFocus == Rhs.ShapingFocus);
+                ShapingFocus == Rhs.ShapingFocus &&
+                CastShadows == Rhs.CastShadows);
     }
 
     constexpr bool operator!=(const RadientLightComponent& Rhs) const
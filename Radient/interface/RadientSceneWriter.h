@@ -33,6 +33,137 @@
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
+// {F9BF749C-4DC5-4713-BB10-62ADC66AAA32}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_RadientSceneCommandRecorder =
+    { 0xf9bf749c, 0x4dc5, 0x4713, { 0xbb, 0x10, 0x62, 0xad, 0xc6, 0x6a, 0xaa, 0x32 } };
+
+#define DILIGENT_INTERFACE_NAME IRadientSceneCommandRecorder
+#include "../../../DiligentCore/Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IRadientSceneCommandRecorderInclusiveMethods \
+    IObjectInclusiveMethods;                         \
+    IRadientSceneCommandRecorderMethods RadientSceneCommandRecorder
+
+// clang-format off
+
+/// Records scene mutations from a worker thread.
+///
+/// Commands are not applied immediately. They are stored in the recorder's own arena and
+/// replayed into the scene by IRadientSceneWriter::CommitChanges(). Different recorders may record
+/// concurrently from different threads without synchronization, but a single recorder must not be used
+/// by more than one thread at a time, and recording must not overlap CommitChanges().
+///
+/// Replay order does not depend on thread scheduling: entities are created first in producer and
+/// recording order, then remaining commands are applied grouped by entity, and destroys run last.
+/// Only the last local transform recorded for an entity in a batch is applied.
+DILIGENT_BEGIN_INTERFACE(IRadientSceneCommandRecorder, IObject)
+{
+    /// Returns the producer ID the recorder was created with.
+    VIRTUAL Uint32 METHOD(GetProducerID)(THIS) CONST PURE;
+
+    /// Records entity creation and returns a deferred entity ID.
+    ///
+    /// The deferred ID may be used by any recorder of the same writer until the next
+    /// CommitChanges(). After the commit, ResolveEntity() returns the scene entity ID.
+    VIRTUAL RADIENT_STATUS METHOD(CreateEntity)(THIS_
+                                                const RadientEntityDesc REF Desc,
+                                                RadientEntityID REF         Entity) PURE;
+
+    /// Records entity destruction.
+    VIRTUAL RADIENT_STATUS METHOD(DestroyEntity)(THIS_
+                                                 RadientEntityID Entity) PURE;
+
+    /// Records an entity flags update.
+    VIRTUAL RADIENT_STATUS METHOD(SetEntityFlags)(THIS_
+                                                  RadientEntityID      Entity,
+                                                  RADIENT_ENTITY_FLAGS Flags) PURE;
+
+    /// Records an own visibility update.
+    VIRTUAL RADIENT_STATUS METHOD(SetEntityOwnVisibility)(THIS_
+                                                          RadientEntityID Entity,
+                                                          Bool            Visible) PURE;
+
+    /// Records a parent change.
+    VIRTUAL RADIENT_STATUS METHOD(SetParent)(THIS_
+                                             RadientEntityID Entity,
+                                             RadientEntityID Parent,
+                                             Bool            KeepWorldTransform DEFAULT_VALUE(True)) PURE;
+
+    /// Records a local transform update.
+    VIRTUAL RADIENT_STATUS METHOD(SetLocalTransform)(THIS_
+                                                     RadientEntityID            Entity,
+                                                     const RadientTransform REF Transform) PURE;
+
+    /// Records a camera component update.
+    VIRTUAL RADIENT_STATUS METHOD(SetCamera)(THIS_
+                                             RadientEntityID                  Entity,
+                                             const RadientCameraComponent REF Camera) PURE;
+
+    /// Records a mesh component update. The recorder keeps a reference to the mesh asset until replay.
+    VIRTUAL RADIENT_STATUS METHOD(SetMesh)(THIS_
+                                           RadientEntityID                Entity,
+                                           const RadientMeshComponent REF Mesh) PURE;
+
+    /// Records a mesh renderer component update.
+    VIRTUAL RADIENT_STATUS METHOD(SetMeshRenderer)(THIS_
+                                                   RadientEntityID                        Entity,
+                                                   const RadientMeshRendererComponent REF Renderer) PURE;
+
+    /// Records a material bindings update. The binding array is copied.
+    VIRTUAL RADIENT_STATUS METHOD(SetMaterialBindings)(THIS_
+                                                       RadientEntityID                            Entity,
+                                                       const RadientMaterialBindingsComponent REF Bindings) PURE;
+
+    /// Records a light component update.
+    VIRTUAL RADIENT_STATUS METHOD(SetLight)(THIS_
+                                            RadientEntityID                 Entity,
+                                            const RadientLightComponent REF Light) PURE;
+
+    /// Records a custom component update. Name, schema, and data are copied.
+    VIRTUAL RADIENT_STATUS METHOD(SetCustomComponentData)(THIS_
+                                                          RadientEntityID                       Entity,
+                                                          const RadientCustomComponentData REF Component) PURE;
+
+    /// Records component removal.
+    VIRTUAL RADIENT_STATUS METHOD(RemoveComponent)(THIS_
+                                                   RadientEntityID        Entity,
+                                                   RadientComponentTypeID ComponentType) PURE;
+
+    /// Returns the scene entity created by the last CommitChanges() for a deferred entity ID recorded by this recorder.
+    ///
+    /// Returns RADIENT_STATUS_PENDING if the entity has not been committed yet, and RADIENT_STATUS_NOT_FOUND
+    /// if its creation failed or the ID belongs to an older batch.
+    VIRTUAL RADIENT_STATUS METHOD(ResolveEntity)(THIS_
+                                                 RadientEntityID     DeferredEntity,
+                                                 RadientEntityID REF Entity) CONST PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../DiligentCore/Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+#    define IRadientSceneCommandRecorder_GetProducerID(This)            CALL_IFACE_METHOD(RadientSceneCommandRecorder, GetProducerID,          This)
+#    define IRadientSceneCommandRecorder_CreateEntity(This, ...)        CALL_IFACE_METHOD(RadientSceneCommandRecorder, CreateEntity,           This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_DestroyEntity(This, ...)       CALL_IFACE_METHOD(RadientSceneCommandRecorder, DestroyEntity,          This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetEntityFlags(This, ...)      CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetEntityFlags,         This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetEntityOwnVisibility(This, ...) CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetEntityOwnVisibility, This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetParent(This, ...)           CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetParent,              This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetLocalTransform(This, ...)   CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetLocalTransform,      This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetCamera(This, ...)           CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetCamera,              This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetMesh(This, ...)             CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetMesh,                This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetMeshRenderer(This, ...)     CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetMeshRenderer,        This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetMaterialBindings(This, ...) CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetMaterialBindings,    This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetLight(This, ...)            CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetLight,               This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_SetCustomComponentData(This, ...) CALL_IFACE_METHOD(RadientSceneCommandRecorder, SetCustomComponentData, This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_RemoveComponent(This, ...)     CALL_IFACE_METHOD(RadientSceneCommandRecorder, RemoveComponent,        This, __VA_ARGS__)
+#    define IRadientSceneCommandRecorder_ResolveEntity(This, ...)       CALL_IFACE_METHOD(RadientSceneCommandRecorder, ResolveEntity,          This, __VA_ARGS__)
+
+#endif
+
+// clang-format on
+
+
 // {A8E0ADCC-C8C3-4D2E-8732-D7A4E555A8F4}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RadientSceneWriter =
     { 0xa8e0adcc, 0xc8c3, 0x4d2e, { 0x87, 0x32, 0xd7, 0xa4, 0xe5, 0x55, 0xa8, 0xf4 } };
@@ -120,7 +251,15 @@ DILIGENT_BEGIN_INTERFACE(IRadientSceneWriter, IObject)
                                                    RadientEntityID        Entity,
                                                    RadientComponentTypeID ComponentType) PURE;
 
-    /// Commits pending scene changes to the active backend.
+    /// Creates a command recorder for deferred, multi-threaded scene mutation.
+    ///
+    /// ProducerID identifies the recorder in the replay order and must be unique among
+    /// the live recorders of this writer. Recorded commands are applied by CommitChanges().
+    VIRTUAL RADIENT_STATUS METHOD(CreateCommandRecorder)(THIS_
+                                                         Uint32                         ProducerID,
+                                                         IRadientSceneCommandRecorder** ppRecorder) PURE;
+
+    /// Replays recorded commands and commits pending scene changes to the active backend.
     VIRTUAL RADIENT_STATUS METHOD(CommitChanges)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
@@ -143,6 +282,7 @@ DILIGENT_END_INTERFACE
 #    define IRadientSceneWriter_SetEnvironment(This, ...)         CALL_IFACE_METHOD(RadientSceneWriter, SetEnvironment,    This, __VA_ARGS__)
 #    define IRadientSceneWriter_SetCustomComponentData(This, ...) CALL_IFACE_METHOD(RadientSceneWriter, SetCustomComponentData,  This, __VA_ARGS__)
 #    define IRadientSceneWriter_RemoveComponent(This, ...)        CALL_IFACE_METHOD(RadientSceneWriter, RemoveComponent,   This, __VA_ARGS__)
+#    define IRadientSceneWriter_CreateCommandRecorder(This, ...) CALL_IFACE_METHOD(RadientSceneWriter, CreateCommandRecorder, This, __VA_ARGS__)
 #    define IRadientSceneWriter_CommitChanges(This)               CALL_IFACE_METHOD(RadientSceneWriter, CommitChanges,     This)
 
 #endif
@@ -48,7 +48,13 @@ DILIGENT_TYPED_ENUM(RADIENT_BACKEND_TYPE, Uint8)
     RADIENT_BACKEND_TYPE_LOCAL = 0,
 
     /// Radient commands are sent to another process or server.
-    RADIENT_BACKEND_TYPE_REMOTE
+    RADIENT_BACKEND_TYPE_REMOTE,
+
+    /// Radient runs in the current process without a render device.
+    /// Render calls execute the CPU side of the frame and record the draws, state changes
+    /// and buffer writes into an in-memory command log instead of submitting them,
+    /// see IRadientRenderer::GetFramePassStats().
+    RADIENT_BACKEND_TYPE_NULL
 };
 
 
@@ -89,6 +95,9 @@ DILIGENT_TYPED_ENUM(RADIENT_STATUS, Int32)
 typedef Uint64 RadientHandle;
 
 /// Stable entity identifier.
+///
+/// An entity ID is never reported as alive after the entity is destroyed, even if
+/// the storage slot it referenced is reused by a new entity.
 typedef Uint64 RadientEntityID;
 
 /// Stable component type identifier for ECS components.
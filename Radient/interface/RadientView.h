@@ -94,6 +94,56 @@ struct RadientSkyboxDesc
 };
 typedef struct RadientSkyboxDesc RadientSkyboxDesc;
 
+
+/// Render scale description.
+///
+/// The render scale is the ratio of the size of the rendered image to the size of the render target.
+/// The scene is rendered to a part of the HDR scene color target and upscaled to the render target
+/// when it is tone mapped, so a scale below 1 requires tone mapping, see RadientToneMappingDesc::Enable.
+/// Without tone mapping, the view is always rendered at the render target size.
+struct RadientRenderScaleDesc
+{
+    /// Enables dynamic resolution.
+    ///
+    /// When enabled, the renderer adjusts the scale between MinScale and MaxScale every frame
+    /// so that the measured frame time stays within the target frame time.
+    Bool Dynamic DEFAULT_INITIALIZER(False);
+
+    /// Render scale when dynamic resolution is disabled, and the initial scale otherwise.
+    Float32 Scale DEFAULT_INITIALIZER(1.f);
+
+    /// Minimum render scale. Must not exceed MaxScale.
+    Float32 MinScale DEFAULT_INITIALIZER(0.5f);
+
+    /// Maximum render scale. Scales above 1 are clamped.
+    Float32 MaxScale DEFAULT_INITIALIZER(1.f);
+
+    /// Scale step of the dynamic resolution. The scale changes by multiples of the step,
+    /// so that the render targets are not resized by small frame time changes. Must be positive.
+    Float32 ScaleStep DEFAULT_INITIALIZER(0.05f);
+
+    /// Target frame time of the dynamic resolution, in seconds. Must be positive.
+    Float32 TargetFrameTime DEFAULT_INITIALIZER(1.f / 60.f);
+
+#if DILIGENT_CPP_INTERFACE
+    bool operator==(const RadientRenderScaleDesc& Rhs) const
+    {
+        return Dynamic == Rhs.Dynamic &&
+            Scale == Rhs.Scale &&
+            MinScale == Rhs.MinScale &&
+            MaxScale == Rhs.MaxScale &&
+            ScaleStep == Rhs.ScaleStep &&
+            TargetFrameTime == Rhs.TargetFrameTime;
+    }
+
+    bool operator!=(const RadientRenderScaleDesc& Rhs) const
+    {
+        return !(*this == Rhs);
+    }
+#endif
+};
+typedef struct RadientRenderScaleDesc RadientRenderScaleDesc;
+
 /// View description.
 ///
 /// A view describes one persistent way to render a scene: which scene is
@@ -114,6 +164,15 @@ struct RadientViewDesc
 
     /// Skybox rendered by the view.
     RadientSkyboxDesc Skybox DEFAULT_INITIALIZER({});
+
+    /// Layer mask of the view.
+    ///
+    /// A mesh renderer is drawn by the view and casts shadows in it only if its visibility
+    /// mask shares at least one bit with the layer mask. Zero hides all mesh renderers.
+    Uint64 LayerMask DEFAULT_INITIALIZER(~0ull);
+
+    /// Render scale of the view.
+    RadientRenderScaleDesc RenderScale DEFAULT_INITIALIZER({});
 };
 typedef struct RadientViewDesc RadientViewDesc;
 
@@ -151,6 +210,17 @@ DILIGENT_BEGIN_INTERFACE(IRadientView, IObject)
     /// Sets the skybox rendered by the view.
     VIRTUAL RADIENT_STATUS METHOD(SetSkybox)(THIS_
                                              const RadientSkyboxDesc REF Skybox) PURE;
+
+    /// Sets the layer mask of the view.
+    VIRTUAL RADIENT_STATUS METHOD(SetLayerMask)(THIS_
+                                                Uint64 LayerMask) PURE;
+
+    /// Sets the render scale of the view.
+    ///
+    /// Returns RADIENT_STATUS_INVALID_ARGUMENT if the scale step or the target frame time
+    /// is not positive, or if the minimum scale exceeds the maximum scale.
+    VIRTUAL RADIENT_STATUS METHOD(SetRenderScale)(THIS_
+                                                  const RadientRenderScaleDesc REF RenderScale) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -163,6 +233,8 @@ DILIGENT_END_INTERFACE
 #    define IRadientView_SetCamera(This, ...)         CALL_IFACE_METHOD(RadientView, SetCamera,       This, __VA_ARGS__)
 #    define IRadientView_SetRenderTarget(This, ...)   CALL_IFACE_METHOD(RadientView, SetRenderTarget, This, __VA_ARGS__)
 #    define IRadientView_SetSkybox(This, ...)         CALL_IFACE_METHOD(RadientView, SetSkybox,       This, __VA_ARGS__)
+#    define IRadientView_SetLayerMask(This, ...)      CALL_IFACE_METHOD(RadientView, SetLayerMask,    This, __VA_ARGS__)
+#    define IRadientView_SetRenderScale(This, ...)    CALL_IFACE_METHOD(RadientView, SetRenderScale,  This, __VA_ARGS__)
 
 #endif
 
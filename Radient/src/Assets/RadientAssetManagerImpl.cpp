@@ -635,6 +635,11 @@ GLTF::ResourceManager* RadientAssetManagerImpl::GetResourceManager() const
     return m_pResourceManager;
 }
 
+IThreadPool* RadientAssetManagerImpl::GetThreadPool() const
+{
+    return m_pThreadPool;
+}
+
 RadientTextureAssetManagerStats RadientAssetManagerImpl::GetTextureManagerStats() const
 {
     return m_pTextureManager ? m_pTextureManager->GetStats() : RadientTextureAssetManagerStats{};
@@ -75,7 +75,11 @@ RADIENT_STATUS ConvertGLTFDrawableMeshPrimitives(const std::vector<GLTF::Primiti
             0,
             IsIndexed,
             FirstElement,
-            ElementCount});
+            ElementCount,
+            RadientBounds{
+                RadientFloat3{Primitive.BB.Min.x, Primitive.BB.Min.y, Primitive.BB.Min.z},
+                RadientFloat3{Primitive.BB.Max.x, Primitive.BB.Max.y, Primitive.BB.Max.z},
+            }});
     }
 
     return RADIENT_STATUS_OK;
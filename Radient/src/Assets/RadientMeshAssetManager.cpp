@@ -141,10 +141,12 @@ public:
     MeshVertexDataStorage(RADIENT_STATUS          InitLoadStatus,
                           std::string             CacheKey,
                           Uint32                  VertexCount,
-                          PBR_Renderer::PSO_FLAGS VertexAttribFlags) :
+                          PBR_Renderer::PSO_FLAGS VertexAttribFlags,
+                          const RadientBounds&    PositionBounds) :
         MeshDataStatusStorage{InitLoadStatus, std::move(CacheKey)},
         VertexCount{VertexCount},
-        VertexAttribFlags{VertexAttribFlags}
+        VertexAttribFlags{VertexAttribFlags},
+        PositionBounds{PositionBounds}
     {
     }
 
@@ -152,6 +154,7 @@ public:
 
     const Uint32                  VertexCount       = 0;
     const PBR_Renderer::PSO_FLAGS VertexAttribFlags = PBR_Renderer::PSO_FLAG_NONE;
+    const RadientBounds           PositionBounds;
 };
 
 class MeshIndexDataPayloadImpl final : public RadientAssetPayloadImpl<MeshIndexDataStorage, MeshIndexDataPayloadImpl>
@@ -401,13 +404,17 @@ MeshStorage::MeshStorage(std::vector<MeshGeometryStorage> GeometryData,
                 MaterialStatusValue = RADIENT_STATUS_PENDING;
         }
 
+        // Primitives use the bounds of the whole geometry vertex range they index into.
+        const MeshVertexDataStorage& VertexData = Geometries[GeometryIndex].pVertexDataPayload->GetStorage();
+
         Materials.emplace_back(pMaterialAsset);
         DrawableMesh.Primitives.push_back(RadientDrawableMeshPrimitive{
             pMaterial,
             GeometryIndex,
             true,
             PrimitiveCI.FirstIndex,
-            PrimitiveCI.IndexCount});
+            PrimitiveCI.IndexCount,
+            VertexData.PositionBounds});
     }
 
     MaterialStatus.store(MaterialStatusValue, std::memory_order_release);
@@ -930,11 +937,12 @@ RADIENT_STATUS RadientMeshAssetManager::CreateMeshVertexData(IThreadPool&
                 auto [pVertexDataPayload, VertexDataCreated] =
                     pSelf->m_MeshVertexDataCache.GetOrCreate(
                         VertexCacheKey.c_str(),
-                        [VertexCacheKey, VertexCount, VertexAttribFlags]() mutable {
+                        [VertexCacheKey, VertexCount, VertexAttribFlags, &VertexSource = *pVertexSource]() mutable {
                             return MeshVertexDataPayloadImpl::Create(RADIENT_STATUS_PENDING,
                                                                      std::move(VertexCacheKey),
                                                                      VertexCount,
-                                                                     VertexAttribFlags);
+                                                                     VertexAttribFlags,
+                                                                     VertexSource.GetPositionBounds());
                         });
 
                 if (pVertexDataPayload == nullptr)
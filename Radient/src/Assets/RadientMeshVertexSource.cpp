@@ -407,6 +407,42 @@ std::string RadientMeshVertexSource::MakeCacheKey() const
     return std::string{"mesh-vertex:"} + Hasher.Digest().ToString();
 }
 
+RadientBounds RadientMeshVertexSource::GetPositionBounds() const
+{
+    if (RADIENT_FAILED(m_Status) || m_VertexCount == 0)
+        return {};
+
+    const auto It = m_SrcAttributes.find(GLTF::PositionAttributeName);
+    if (It == m_SrcAttributes.end())
+        return {};
+
+    const SrcAttributeData& Position = It->second;
+    if (Position.Type != VT_FLOAT32 || Position.NumComponents < 3 || Position.pData == nullptr)
+        return {};
+
+    RadientBounds Bounds;
+    for (Uint32 Vertex = 0; Vertex < m_VertexCount; ++Vertex)
+    {
+        float Pos[3];
+        std::memcpy(Pos, Position.pData + size_t{Vertex} * Position.Stride, sizeof(Pos));
+        if (Vertex == 0)
+        {
+            Bounds.Min = RadientFloat3{Pos[0], Pos[1], Pos[2]};
+            Bounds.Max = Bounds.Min;
+            continue;
+        }
+
+        Bounds.Min.x = std::min(Bounds.Min.x, Pos[0]);
+        Bounds.Min.y = std::min(Bounds.Min.y, Pos[1]);
+        Bounds.Min.z = std::min(Bounds.Min.z, Pos[2]);
+        Bounds.Max.x = std::max(Bounds.Max.x, Pos[0]);
+        Bounds.Max.y = std::max(Bounds.Max.y, Pos[1]);
+        Bounds.Max.z = std::max(Bounds.Max.z, Pos[2]);
+    }
+
+    return Bounds;
+}
+
 RADIENT_STATUS RadientMeshVertexSource::SetVertexAttributes(const GLTF::VertexAttributeDesc* pDstAttributes,
                                                             Uint32                           NumDstAttributes)
 {
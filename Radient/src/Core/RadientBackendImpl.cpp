@@ -26,6 +26,8 @@
 
 #include "Core/RadientBackendImpl.hpp"
 
+#include "Errors.hpp"
+
 namespace Diligent
 {
 
@@ -40,6 +42,14 @@ RadientBackendImpl::RadientBackendImpl(IReferenceCounters* pRefCounters, const R
 {
     m_Desc.Name           = m_Name.c_str();
     m_Desc.RemoteEndpoint = m_RemoteEndpoint.c_str();
+
+    if (m_Desc.Type == RADIENT_BACKEND_TYPE_NULL && (m_pDevice || m_pImmediateContext || m_pSwapChain))
+    {
+        LOG_WARNING_MESSAGE("Native interfaces are ignored by the null Radient backend");
+        m_pDevice.Release();
+        m_pImmediateContext.Release();
+        m_pSwapChain.Release();
+    }
 }
 
 RadientBackendImpl::~RadientBackendImpl()
@@ -25,6 +25,7 @@
  */
 
 #include "Core/RadientViewImpl.hpp"
+#include "Render/RadientResolutionController.hpp"
 
 #include <utility>
 
@@ -99,6 +100,27 @@ RADIENT_STATUS RadientViewImpl::SetSkybox(const RadientSkyboxDesc& Skybox)
     return RADIENT_STATUS_OK;
 }
 
+RADIENT_STATUS RadientViewImpl::SetLayerMask(Uint64 LayerMask)
+{
+    if (m_Desc.LayerMask == LayerMask)
+        return RADIENT_STATUS_NO_CHANGE;
+
+    m_Desc.LayerMask = LayerMask;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientViewImpl::SetRenderScale(const RadientRenderScaleDesc& RenderScale)
+{
+    if (!RadientResolutionController::IsValidDesc(RenderScale))
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    if (m_Desc.RenderScale == RenderScale)
+        return RADIENT_STATUS_NO_CHANGE;
+
+    m_Desc.RenderScale = RenderScale;
+    return RADIENT_STATUS_OK;
+}
+
 void RadientViewImpl::CopySkybox(const RadientSkyboxDesc& Skybox)
 {
     m_pSkyboxTexture       = Skybox.pTexture;
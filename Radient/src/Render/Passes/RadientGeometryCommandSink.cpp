@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/Passes/RadientGeometryCommandSink.hpp"
+
+#include "Render/RadientSceneDrawableCache.hpp"
+
+namespace Diligent
+{
+
+RadientGeometryCommandLogSink::RadientGeometryCommandLogSink(RadientCommandLog& Log) :
+    m_Log{Log},
+    m_PrimitiveAttribsData(PrimitiveAttribsBufferSize)
+{
+}
+
+void RadientGeometryCommandLogSink::CommitMaterialTable(RadientMaterialTable& MaterialTable)
+{
+    const RadientMaterialTable::SlotRange& DirtySlots = MaterialTable.GetDirtySlots();
+    if (DirtySlots.IsEmpty())
+        return;
+
+    const Uint32 FirstOffset = MaterialTable.GetSlotOffset(DirtySlots.First);
+    m_Log.WriteBuffer(MaterialAttribsBufferID, FirstOffset, MaterialTable.GetSlotOffset(DirtySlots.End) - FirstOffset);
+    MaterialTable.ResetDirtySlots();
+}
+
+void RadientGeometryCommandLogSink::WriteFrameAttribs(const PBR_Renderer::CreateInfo& Settings)
+{
+    m_Log.WriteBuffer(FrameAttribsBufferID, 0, PBR_Renderer::GetPRBFrameAttribsSize(Settings.MaxLightCount, Settings.MaxShadowCastingLightCount));
+}
+
+IPipelineState* RadientGeometryCommandLogSink::GetPipelineState(RadientGeometryPipelineType Type, const PBR_Renderer::PSOKey& Key)
+{
+    const auto   It       = m_PSOKeyIndices.emplace(Key, static_cast<Uint32>(m_PSOKeyIndices.size())).first;
+    const size_t KeyIndex = It->second;
+
+    // The identity combines the key index and the pipeline type. Zero is reserved for missing pipeline states.
+    const size_t Identity = (KeyIndex + 1) * static_cast<size_t>(RadientGeometryPipelineType::Count) + static_cast<size_t>(Type);
+    return reinterpret_cast<IPipelineState*>(Identity);
+}
+
+Uint8* RadientGeometryCommandLogSink::BeginPrimitiveBatch()
+{
+    return m_PrimitiveAttribsData.data();
+}
+
+void RadientGeometryCommandLogSink::EndPrimitiveBatch(Uint32 BatchSize)
+{
+    if (BatchSize > 0)
+        m_Log.WriteBuffer(PrimitiveAttribsBufferID, 0, BatchSize);
+}
+
+void RadientGeometryCommandLogSink::SetVertexPool(IVertexPool* pVertexPool)
+{
+    m_Log.SetVertexBuffers(reinterpret_cast<size_t>(pVertexPool));
+}
+
+void RadientGeometryCommandLogSink::SetPipelineState(IPipelineState* pPSO)
+{
+    m_Log.SetPipelineState(GetPipelineStateID(pPSO));
+}
+
+void RadientGeometryCommandLogSink::SetMaterialAttribsOffset(Uint32 Offset)
+{
+    m_Log.SetMaterial(Offset);
+}
+
+void RadientGeometryCommandLogSink::Draw(RadientDrawableID DrawableID, const RadientDrawableSlot& Drawable)
+{
+    if (Drawable.IsIndexed)
+        m_Log.DrawIndexed(DrawableID, Drawable.FirstIndexLocation + Drawable.FirstElement, Drawable.ElementCount);
+    else
+        m_Log.Draw(DrawableID, Drawable.BaseVertex + Drawable.FirstElement, Drawable.ElementCount);
+}
+
+void RadientGeometryCommandLogSink::DrawIndexedIndirect(IBuffer* pDrawArgs, Uint64 DrawArgsOffset, Uint32 MaxDrawCount, IBuffer* pDrawCounts, Uint64 DrawCountOffset)
+{
+    m_Log.DrawIndexedIndirect(reinterpret_cast<size_t>(pDrawArgs), static_cast<Uint32>(DrawArgsOffset), MaxDrawCount);
+}
+
+} // namespace Diligent
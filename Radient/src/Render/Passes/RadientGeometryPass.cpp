@@ -29,6 +29,7 @@
 #include "Assets/RadientAssetManagerImpl.hpp"
 #include "Math/RadientMath.hpp"
 #include "Render/RadientSceneDrawableCache.hpp"
+#include "Utilities/interface/DiligentFXShaderSourceStreamFactory.hpp"
 
 #include "GraphicsAccessories.hpp"
 #include "GraphicsUtilities.h"
@@ -55,7 +56,16 @@ namespace
 {
 
 constexpr float  RadientDefaultSceneScale = 1.f;
-constexpr Uint32 RadientMaxLightCount     = 16;
+constexpr Uint32 RadientMaxLightCount     = 16; // Directional and unbounded lights
+
+constexpr Uint32 RadientLightClusterGridSizeX = 16;
+constexpr Uint32 RadientLightClusterGridSizeY = 8;
+constexpr Uint32 RadientLightClusterGridSizeZ = 24;
+
+constexpr TEXTURE_FORMAT RadientShadowMapFormat = TEX_FORMAT_D32_FLOAT;
+
+// Size of the primitive attribs array of the PBR shaders when GPU-driven rendering is enabled
+constexpr Uint32 RadientIndirectDrawBucketSize = 64;
 
 TEXTURE_FORMAT GetTextureViewFormat(ITextureView* pView)
 {
@@ -76,7 +86,7 @@ bool RequiresOutputSRGBConversion(TEXTURE_FORMAT Format)
         Format == TEX_FORMAT_BGRA8_UNORM;
 }
 
-bool IsPipelineReady(IPipelineState* pPSO)
+bool IsPipelineStateReady(IPipelineState* pPSO)
 {
     return pPSO != nullptr && pPSO->GetStatus() == PIPELINE_STATE_STATUS_READY;
 }
@@ -166,10 +176,12 @@ void WriteCameraShaderAttribs(IRenderDevice*                   pDevice,
 {
     const RadientCameraComponent Camera     = GetCameraComponent(ViewDesc);
     const RadientExtent2D&       TargetSize = Targets.GetSize();
+    const RadientExtent2D&       RenderSize = Targets.GetRenderSize();
 
-    const float Width            = static_cast<float>(TargetSize.Width);
-    const float Height           = static_cast<float>(TargetSize.Height);
-    const float Aspect           = Height > 0.f ? Width / Height : 1.f;
+    // The aspect ratio is taken from the target, so that it does not change with the render scale
+    const float Aspect           = TargetSize.Height > 0 ? static_cast<float>(TargetSize.Width) / static_cast<float>(TargetSize.Height) : 1.f;
+    const float Width            = static_cast<float>(RenderSize.Width);
+    const float Height           = static_cast<float>(RenderSize.Height);
     const bool  NDCMinusOneToOne = pDevice != nullptr && pDevice->GetDeviceInfo().NDC.MinZ < 0.f;
 
     float4x4 CameraWorld = float4x4::Identity();
@@ -281,45 +293,73 @@ void WritePBRLightShaderAttribs(const RadientLightComponent& Light,
     ShaderAttribs.SpotAngleScale  = SpotAngleScale;
 }
 
-void WriteSceneLights(PBR_Renderer&                 Renderer,
-                      const RadientLightLists&      LightList,
-                      const RadientEnvironmentDesc& Environment,
-                      ITextureView*                 pPrefilteredEnvMapSRV,
-                      HLSL::PBRFrameAttribs&        FrameAttribs)
+RadientLightClusterGridDesc GetLightClusterGridDesc(const HLSL::CameraAttribs& CameraAttribs)
 {
-    HLSL::PBRLightAttribs* Lights = reinterpret_cast<HLSL::PBRLightAttribs*>(&FrameAttribs + 1);
+    RadientLightClusterGridDesc Desc;
+    Desc.GridSizeX    = RadientLightClusterGridSizeX;
+    Desc.GridSizeY    = RadientLightClusterGridSizeY;
+    Desc.GridSizeZ    = RadientLightClusterGridSizeZ;
+    Desc.NearZ        = CameraAttribs.fNearPlaneZ;
+    Desc.FarZ         = CameraAttribs.fFarPlaneZ;
+    Desc.ProjScaleX   = CameraAttribs.mProj._11;
+    Desc.ProjScaleY   = CameraAttribs.mProj._22;
+    Desc.Orthographic = CameraAttribs.mProj._34 == 0.f;
+    return Desc;
+}
 
-    Uint32 LightCount = 0;
-    LightList.Enumerate([&](const RadientLightItem& LightItem) {
-        if (LightCount >= RadientMaxLightCount)
-            return;
+// Returns the world-space plane whose signed distance is the view-space depth, i.e. the distance
+// along the camera view direction (-Z in view space, see RadientMath::GetCameraProjection).
+RadientFloat4 GetViewDepthPlane(const float4x4& CameraView)
+{
+    return RadientFloat4{-CameraView._13, -CameraView._23, -CameraView._33, -CameraView._43};
+}
 
-        VERIFY(LightItem.pLight != nullptr, "Light list item has null light pointer");
-        VERIFY(LightItem.pWorldMatrix != nullptr, "Light list item has null world matrix pointer");
-        VERIFY(LightItem.pEffectiveVisible != nullptr, "Light list item has null visibility pointer");
-        if (LightItem.pLight == nullptr ||
-            LightItem.pWorldMatrix == nullptr ||
-            LightItem.pEffectiveVisible == nullptr ||
-            !*LightItem.pEffectiveVisible)
-            return;
+// Transforms a world-space vector to the light cluster space.
+// Radient cameras look along the view-space -Z axis (see RadientMath::GetCameraProjection),
+// while the cluster space depth is the positive distance along the view direction.
+float3 GetLightClusterSpaceVector(const float4x4& CameraView, const float3& Vector, float W)
+{
+    const float4 ViewVector = float4{Vector, W} * CameraView;
+    return float3{ViewVector.x, ViewVector.y, -ViewVector.z};
+}
 
-        const RadientLightComponent& Light = *LightItem.pLight;
+// Returns the first visible directional light that casts shadows, see RadientLightComponent::CastShadows.
+const RadientLightItem* FindShadowLight(const RadientLightLists& LightList)
+{
+    for (const RadientLightItem& LightItem : LightList.GetLightList(RADIENT_LIGHT_TYPE_DIRECTIONAL).GetItems())
+    {
+        if (LightItem.pLight != nullptr &&
+            LightItem.pWorldMatrix != nullptr &&
+            LightItem.pEffectiveVisible != nullptr &&
+            *LightItem.pEffectiveVisible &&
+            LightItem.pLight->CastShadows)
+        {
+            return &LightItem;
+        }
+    }
 
-        const float3 Position  = GetLightPosition(*LightItem.pWorldMatrix);
-        const float3 Direction = GetLightDirection(*LightItem.pWorldMatrix);
-        const bool   HasPosition =
-            Light.Type == RADIENT_LIGHT_TYPE_POINT ||
-            Light.Type == RADIENT_LIGHT_TYPE_SPOT;
-        const bool HasDirection =
-            Light.Type == RADIENT_LIGHT_TYPE_DIRECTIONAL ||
-            Light.Type == RADIENT_LIGHT_TYPE_SPOT;
+    return nullptr;
+}
 
-        WritePBRLightShaderAttribs(Light,
-                                   HasPosition ? &Position : nullptr,
-                                   HasDirection ? &Direction : nullptr,
-                                   Lights[LightCount]);
-        ++LightCount;
-    });
+void WriteViewLights(PBR_Renderer&                 Renderer,
+                     const RadientEnvironmentDesc& Environment,
+                     ITextureView*                 pPrefilteredEnvMapSRV,
+                     const std::vector<Uint8>&     FrameLightsData,
+                     Uint32                        ShadowLightIndex,
+                     HLSL::PBRFrameAttribs&        FrameAttribs)
+{
+    HLSL::PBRLightAttribs* Lights = reinterpret_cast<HLSL::PBRLightAttribs*>(&FrameAttribs + 1);
+
+    const Uint32 LightCount = static_cast<Uint32>(FrameLightsData.size() / sizeof(HLSL::PBRLightAttribs));
+    VERIFY_EXPR(LightCount <= RadientMaxLightCount);
+    if (!FrameLightsData.empty())
+        std::memcpy(Lights, FrameLightsData.data(), FrameLightsData.size());
+
+    if (ShadowLightIndex < LightCount)
+    {
+        // Cascades occupy the shadow map infos starting with the first one, see WriteShadowMapInfos()
+        Lights[ShadowLightIndex].ShadowMapIndex = 0;
+    }
 
     HLSL::PBRRendererShaderParameters& RendererAttribs = FrameAttribs.Renderer;
     Renderer.SetInternalShaderParameters(RendererAttribs, pPrefilteredEnvMapSRV);
@@ -337,6 +377,25 @@ void WriteSceneLights(PBR_Renderer&                 Renderer,
     RendererAttribs.DebugView         = 0;
 }
 
+void WriteShadowMapInfos(const RadientShadowCascades& Cascades,
+                         HLSL::PBRFrameAttribs&       FrameAttribs)
+{
+    // || Camera|PrevCamera|Renderer || Lights[RadientMaxLightCount] || ShadowMaps[ShadowCascadeCount] ||
+    HLSL::PBRLightAttribs*  Lights     = reinterpret_cast<HLSL::PBRLightAttribs*>(&FrameAttribs + 1);
+    HLSL::PBRShadowMapInfo* ShadowMaps = reinterpret_cast<HLSL::PBRShadowMapInfo*>(Lights + RadientMaxLightCount);
+
+    const Uint32 CascadeCount = Cascades.GetCascadeCount();
+    for (Uint32 Cascade = 0; Cascade < CascadeCount; ++Cascade)
+    {
+        HLSL::PBRShadowMapInfo& ShadowMap = ShadowMaps[Cascade];
+        ShadowMap.WorldToLightProjSpace   = Cascades.GetCascade(Cascade).WorldToLightProjSpace;
+        ShadowMap.UVScale                 = float2{1.f, 1.f};
+        ShadowMap.UVBias                  = float2{0.f, 0.f};
+        ShadowMap.ShadowMapSlice          = static_cast<float>(Cascade);
+        ShadowMap.CascadeCount            = static_cast<float>(CascadeCount);
+    }
+}
+
 void SetGLTFTextureAttribIndices(PBR_Renderer::CreateInfo& CI)
 {
     CI.TextureAttribIndices[PBR_Renderer::TEXTURE_ATTRIB_ID_BASE_COLOR]            = GLTF::DefaultBaseColorTextureAttribId;
@@ -365,11 +424,9 @@ PBR_Renderer::ALPHA_MODE ToPBRAlphaMode(GLTF::Material::ALPHA_MODE AlphaMode)
     return static_cast<PBR_Renderer::ALPHA_MODE>(AlphaMode);
 }
 
-PBR_Renderer::PSO_FLAGS GetMaterialPSOFlags(const PBR_Renderer&   Renderer,
-                                            const GLTF::Material& Material)
+PBR_Renderer::PSO_FLAGS GetMaterialPSOFlags(const PBR_Renderer::CreateInfo& Settings,
+                                            const GLTF::Material&           Material)
 {
-    const PBR_Renderer::CreateInfo& Settings = Renderer.GetSettings();
-
     PBR_Renderer::PSO_FLAGS Flags =
         PBR_Renderer::PSO_FLAG_USE_COLOR_MAP |
         PBR_Renderer::PSO_FLAG_USE_NORMAL_MAP |
@@ -598,14 +655,17 @@ RefCntAutoPtr<ITextureView> GetPBRTextureSRV(ITexture*
     return pTexSRV;
 }
 
-void CreateResourceCacheSRB(PBR_Renderer&                        Renderer,
-                            IRenderDevice*                       pDevice,
-                            IDeviceContext*                      pContext,
-                            RadientGeometryResourceCacheUseInfo& CacheUseInfo,
-                            IBuffer*                             pFrameAttribs,
-                            ITextureView*                        pIrradianceCubeSRV,
-                            ITextureView*                        pPrefilteredEnvMapSRV,
-                            IShaderResourceBinding**             ppCacheSRB)
+void CreateResourceCacheSRB(PBR_Renderer&                              Renderer,
+                            IRenderDevice*                             pDevice,
+                            IDeviceContext*                            pContext,
+                            RadientGeometryResourceCacheUseInfo&       CacheUseInfo,
+                            IBuffer*                                   pFrameAttribs,
+                            ITextureView*                              pIrradianceCubeSRV,
+                            ITextureView*                              pPrefilteredEnvMapSRV,
+                            const PBR_Renderer::LightClusterResources& LightClusters,
+                            ITextureView*                              pShadowMapSRV,
+                            const RadientMaterialTable&                MaterialTable,
+                            IShaderResourceBinding**                   ppCacheSRB)
 {
     DEV_CHECK_ERR(CacheUseInfo.pResourceMgr != nullptr, "Resource manager must not be null");
 
@@ -617,8 +677,22 @@ void CreateResourceCacheSRB(PBR_Renderer&                        Renderer,
         return;
     }
 
-    Renderer.InitCommonSRBVars(pSRB, pFrameAttribs);
+    // Primitive attributes are read from the record selected by the buffer offset, and material attributes
+    // are read from the slot of the material table selected by the buffer offset
+    constexpr bool BindPrimitiveAttribsBuffer = false;
+    constexpr bool BindMaterialAttribsBuffer  = false;
+    Renderer.InitCommonSRBVars(pSRB, pFrameAttribs, BindPrimitiveAttribsBuffer, BindMaterialAttribsBuffer, pShadowMapSRV);
+    if (IShaderResourceVariable* pPrimitiveAttribsVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbPrimitiveAttribs"))
+    {
+        pPrimitiveAttribsVar->SetBufferRange(Renderer.GetPBRPrimitiveAttribsCB(), 0, GetPrimitiveAttribsRangeSize(Renderer.GetSettings()));
+    }
+    if (IShaderResourceVariable* pMaterialAttribsVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbMaterialAttribs"))
+    {
+        VERIFY(MaterialTable.GetBuffer() != nullptr, "Material table buffer must be created before the SRB");
+        pMaterialAttribsVar->SetBufferRange(MaterialTable.GetBuffer(), 0, MaterialTable.GetAttribsSize());
+    }
     Renderer.SetIBLResourceViews(pSRB, pIrradianceCubeSRV, pPrefilteredEnvMapSRV);
+    Renderer.SetLightClusterResources(pSRB, LightClusters);
 
     const PBR_Renderer::CreateInfo& Settings   = Renderer.GetSettings();
     auto                            SetTexture = [&](PBR_Renderer::TEXTURE_ATTRIB_ID ID) {
@@ -667,36 +741,47 @@ void CreateResourceCacheSRB(PBR_Renderer&                        Renderer,
         SetTexture(PBR_Renderer::TEXTURE_ATTRIB_ID_THICKNESS);
 }
 
-void BeginResourceCache(PBR_Renderer&                         Renderer,
-                        IRenderDevice*                        pDevice,
-                        IDeviceContext*                       pContext,
-                        RadientGeometryResourceCacheUseInfo&  CacheUseInfo,
-                        RadientGeometryResourceCacheBindings& Bindings,
-                        IBuffer*                              pFrameAttribs,
-                        ITextureView*                         pIrradianceCubeSRV,
-                        ITextureView*                         pPrefilteredEnvMapSRV)
+void UpdateResourceCacheSRB(PBR_Renderer&                              Renderer,
+                            IRenderDevice*                             pDevice,
+                            IDeviceContext*                            pContext,
+                            RadientGeometryResourceCacheUseInfo&       CacheUseInfo,
+                            RadientGeometryResourceCacheBindings&      Bindings,
+                            IBuffer*                                   pFrameAttribs,
+                            ITextureView*                              pIrradianceCubeSRV,
+                            ITextureView*                              pPrefilteredEnvMapSRV,
+                            const PBR_Renderer::LightClusterResources& LightClusters,
+                            ITextureView*                              pShadowMapSRV,
+                            const RadientMaterialTable&                MaterialTable)
 {
-    VERIFY(CacheUseInfo.pResourceMgr != nullptr, "Resource manager must not be null.");
-
-    if (Renderer.GetJointsBuffer() != nullptr)
-    {
-        MapHelper<float4x4> pJoints{pContext, Renderer.GetJointsBuffer(), MAP_WRITE, MAP_FLAG_DISCARD};
-    }
-
-    const Uint32 TextureVersion = CacheUseInfo.pResourceMgr->GetTextureVersion();
-    if (!Bindings.pSRB || Bindings.Version != TextureVersion)
+    const Uint32 TextureVersion       = CacheUseInfo.pResourceMgr->GetTextureVersion();
+    const Uint32 MaterialTableVersion = MaterialTable.GetBufferVersion();
+    if (!Bindings.pSRB || Bindings.Version != TextureVersion || Bindings.MaterialTableVersion != MaterialTableVersion)
     {
         Bindings.pSRB.Release();
-        CreateResourceCacheSRB(Renderer, pDevice, pContext, CacheUseInfo, pFrameAttribs, pIrradianceCubeSRV, pPrefilteredEnvMapSRV, &Bindings.pSRB);
+        CreateResourceCacheSRB(Renderer, pDevice, pContext, CacheUseInfo, pFrameAttribs, pIrradianceCubeSRV, pPrefilteredEnvMapSRV,
+                               LightClusters, pShadowMapSRV, MaterialTable, &Bindings.pSRB);
         if (!Bindings.pSRB)
         {
             LOG_ERROR_MESSAGE("Failed to create an SRB for Radient resource cache");
             return;
         }
-        Bindings.Version = TextureVersion;
+        Bindings.Version              = TextureVersion;
+        Bindings.MaterialTableVersion = MaterialTableVersion;
     }
 
     pContext->TransitionShaderResources(Bindings.pSRB);
+}
+
+void BeginResourceCache(PBR_Renderer&                        Renderer,
+                        IDeviceContext*                      pContext,
+                        RadientGeometryResourceCacheUseInfo& CacheUseInfo)
+{
+    VERIFY(CacheUseInfo.pResourceMgr != nullptr, "Resource manager must not be null.");
+
+    if (Renderer.GetJointsBuffer() != nullptr)
+    {
+        MapHelper<float4x4> pJoints{pContext, Renderer.GetJointsBuffer(), MAP_WRITE, MAP_FLAG_DISCARD};
+    }
 
     if (IBuffer* pIndexBuffer = CacheUseInfo.pResourceMgr->GetIndexBuffer())
         pContext->SetIndexBuffer(pIndexBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
@@ -715,63 +800,297 @@ void BindVertexPool(IVertexPool&    VertexPool,
     pContext->SetVertexBuffers(0, PoolDesc.NumElements, pVBs.data(), nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
 }
 
-void WritePrimitiveAttribs(PBR_Renderer&           Renderer,
-                           IDeviceContext*         pContext,
-                           PBR_Renderer::PSO_FLAGS PSOFlags,
-                           const RadientMatrix4x4& WorldMatrix)
+// Makes sure that the buffer can hold ElementCount elements.
+// The buffer grows to the next power of two to avoid frequent reallocations.
+bool PrepareGrowableBuffer(IRenderDevice*          pDevice,
+                           const char*             Name,
+                           Uint32                  ElementSize,
+                           Uint32                  ElementCount,
+                           BIND_FLAGS              BindFlags,
+                           BUFFER_MODE             Mode,
+                           RefCntAutoPtr<IBuffer>& pBuffer,
+                           bool&                   BufferRecreated)
 {
-    void* pAttribsData = nullptr;
-    pContext->MapBuffer(Renderer.GetPBRPrimitiveAttribsCB(), MAP_WRITE, MAP_FLAG_DISCARD, pAttribsData);
-    if (pAttribsData == nullptr)
+    const Uint64 RequiredSize = Uint64{ElementSize} * std::max(ElementCount, 1u);
+    if (pBuffer && pBuffer->GetDesc().Size >= RequiredSize)
+        return true;
+
+    Uint32 Capacity = 1;
+    while (Capacity < ElementCount)
+        Capacity <<= 1u;
+
+    BufferDesc Desc;
+    Desc.Name              = Name;
+    Desc.Usage             = USAGE_DEFAULT;
+    Desc.BindFlags         = BindFlags;
+    Desc.Mode              = Mode;
+    Desc.ElementByteStride = ElementSize;
+    Desc.Size              = Uint64{ElementSize} * Capacity;
+
+    pBuffer.Release();
+    pDevice->CreateBuffer(Desc, nullptr, &pBuffer);
+    if (!pBuffer)
     {
-        UNEXPECTED("Unable to map PBR primitive attribs buffer");
-        return;
+        LOG_ERROR_MESSAGE("Failed to create ", Name);
+        return false;
+    }
+
+    BufferRecreated = true;
+    return true;
+}
+
+RefCntAutoPtr<IBuffer> CreatePrimitiveAttribsCB(IRenderDevice* pDevice)
+{
+    // Same size as the Hydrogent primitive attribs buffer
+    Uint64 Size  = 65536;
+    USAGE  Usage = USAGE_DYNAMIC;
+    if (pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        // OpenGL updates a large default buffer with UpdateBuffer()
+        Size  = Uint64{512} << 10u;
+        Usage = USAGE_DEFAULT;
+    }
+
+    RefCntAutoPtr<IBuffer> pPrimitiveAttribsCB;
+    CreateUniformBuffer(pDevice, Size, "Radient PBR primitive attribs buffer", &pPrimitiveAttribsCB, Usage);
+    return pPrimitiveAttribsCB;
+}
+
+// Size of the primitive attribs range bound at a record offset. When the renderer uses a primitive
+// array, the records of all draws of a multi-draw follow the bound offset.
+Uint32 GetPrimitiveAttribsRangeSize(const PBR_Renderer::CreateInfo& Settings)
+{
+    return PBR_Renderer::GetPBRPrimitiveAttribsSize(Settings, PBR_Renderer::PSO_FLAG_ALL) * std::max(Settings.PrimitiveArraySize, 1u);
+}
+
+bool IsGPUDrivenRenderingSupported(IRenderDevice* pDevice)
+{
+    const DeviceFeatures&        Features    = pDevice->GetDeviceInfo().Features;
+    const DrawCommandProperties& DrawCommand = pDevice->GetAdapterInfo().DrawCommand;
+
+    // The PBR shaders read the primitive attribs of a multi-draw by the native draw index
+    return Features.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED &&
+        Features.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED &&
+        (DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT) != 0 &&
+        (DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER) != 0 &&
+        DrawCommand.MaxDrawIndirectCount >= RadientIndirectDrawBucketSize;
+}
+
+// Returns the world-space box that encloses the local bounds, or inverted bounds if the local bounds are unknown
+RadientBounds GetWorldBounds(const RadientMatrix4x4& WorldMatrix, const RadientBounds& LocalBounds)
+{
+    const float3 Min{LocalBounds.Min.x, LocalBounds.Min.y, LocalBounds.Min.z};
+    const float3 Max{LocalBounds.Max.x, LocalBounds.Max.y, LocalBounds.Max.z};
+
+    RadientBounds WorldBounds;
+    if (!(Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z))
+    {
+        WorldBounds.Min = {1, 1, 1};
+        WorldBounds.Max = {-1, -1, -1};
+        return WorldBounds;
+    }
+
+    const float4x4 World  = RadientMath::ToFloat4x4(WorldMatrix);
+    const float3   Center = (Min + Max) * 0.5f;
+    const float3   Extent = (Max - Min) * 0.5f;
+
+    const float4 WorldCenter = float4{Center, 1.f} * World;
+
+    float3 WorldExtent;
+    for (int Col = 0; Col < 3; ++Col)
+    {
+        WorldExtent[Col] =
+            std::abs(Extent.x * World.m[0][Col]) +
+            std::abs(Extent.y * World.m[1][Col]) +
+            std::abs(Extent.z * World.m[2][Col]);
+    }
+
+    WorldBounds.Min = {WorldCenter.x - WorldExtent.x, WorldCenter.y - WorldExtent.y, WorldCenter.z - WorldExtent.z};
+    WorldBounds.Max = {WorldCenter.x + WorldExtent.x, WorldCenter.y + WorldExtent.y, WorldCenter.z + WorldExtent.z};
+    return WorldBounds;
+}
+
+} // namespace
+
+PBR_Renderer::CreateInfo GetRadientPBRRendererSettings(const RadientShadowCascadeDesc& ShadowDesc)
+{
+    PBR_Renderer::CreateInfo RendererCI;
+    RendererCI.EnableIBL               = true;
+    RendererCI.EnableAO                = true;
+    RendererCI.EnableEmissive          = true;
+    RendererCI.EnableShadows           = ShadowDesc.CascadeCount > 0;
+    RendererCI.EnableClusteredLighting = true;
+    RendererCI.MaxLightCount           = RadientMaxLightCount;
+    if (RendererCI.EnableShadows)
+    {
+        // Cascades of the shadow-casting directional light use one shadow map info each
+        RendererCI.MaxShadowCastingLightCount = ShadowDesc.CascadeCount;
+        RendererCI.PCFKernelSize              = ShadowDesc.FilterSize;
     }
+    RendererCI.MaxJointCount           = 0;
+    RendererCI.PackMatrixRowMajor      = true;
+    RendererCI.ShaderTexturesArrayMode = PBR_Renderer::SHADER_TEXTURE_ARRAY_MODE_NONE;
+    SetGLTFTextureAttribIndices(RendererCI);
+    return RendererCI;
+}
+
+PBR_Renderer::PSO_FLAGS GetRadientBaseRenderFlags(bool EnableShadows)
+{
+    PBR_Renderer::PSO_FLAGS RenderFlags =
+        PBR_Renderer::PSO_FLAG_DEFAULT |
+        PBR_Renderer::PSO_FLAG_ALL_TEXTURES |
+        PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
+        PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS |
+        PBR_Renderer::PSO_FLAG_USE_CLUSTERED_LIGHTS;
+    RenderFlags &= ~PBR_Renderer::PSO_FLAG_ENABLE_TONE_MAPPING;
+    RenderFlags &= ~PBR_Renderer::PSO_FLAG_COMPUTE_MOTION_VECTORS;
+    if (EnableShadows)
+        RenderFlags |= PBR_Renderer::PSO_FLAG_ENABLE_SHADOWS;
+    return RenderFlags;
+}
+
+PBR_Renderer::PSOKey GetRadientMainPassPSOKey(const PBR_Renderer::CreateInfo& Settings,
+                                              PBR_Renderer::PSO_FLAGS         RenderFlags,
+                                              PBR_Renderer::PSO_FLAGS         VertexAttribFlags,
+                                              const GLTF::Material&           Material)
+{
+    PBR_Renderer::PSO_FLAGS PSOFlags = VertexAttribFlags | GetMaterialPSOFlags(Settings, Material);
+    PSOFlags |=
+        PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS |
+        PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
+        PBR_Renderer::PSO_FLAG_CONVERT_OUTPUT_TO_SRGB |
+        PBR_Renderer::PSO_FLAG_USE_IBL |
+        PBR_Renderer::PSO_FLAG_USE_LIGHTS |
+        PBR_Renderer::PSO_FLAG_ENABLE_SHADOWS;
+    PSOFlags &= RenderFlags;
+
+    return PBR_Renderer::PSOKey{
+        PBR_Renderer::RenderPassType::Main,
+        PSOFlags,
+        ToPBRAlphaMode(static_cast<GLTF::Material::ALPHA_MODE>(Material.Attribs.AlphaMode)),
+        Material.DoubleSided ? CULL_MODE_NONE : CULL_MODE_BACK,
+        PBR_Renderer::DebugViewType::None,
+    };
+}
 
-    const float4x4                NodeTransform = RadientMath::ToFloat4x4(WorldMatrix);
+void* WriteRadientPrimitiveAttribs(void*                   pDst,
+                                   PBR_Renderer::PSO_FLAGS PSOFlags,
+                                   const float4x4&         NodeMatrix,
+                                   bool                    PackMatrixRowMajor)
+{
     PBRPrimitiveShaderAttribsData AttribsData;
     AttribsData.PSOFlags       = PSOFlags;
-    AttribsData.NodeMatrix     = &NodeTransform;
-    AttribsData.PrevNodeMatrix = &NodeTransform;
+    AttribsData.NodeMatrix     = &NodeMatrix;
+    AttribsData.PrevNodeMatrix = &NodeMatrix;
+    return WritePBRPrimitiveShaderAttribs(pDst, AttribsData, !PackMatrixRowMajor);
+}
+
+void* WriteRadientMaterialAttribs(void*                           pDst,
+                                  const PBR_Renderer::CreateInfo& Settings,
+                                  PBR_Renderer::PSO_FLAGS         PSOFlags,
+                                  const GLTF::Material&           Material)
+{
+    return WritePBRMaterialShaderAttribs(pDst, Settings, PSOFlags, Material);
+}
 
-    void* pEndPtr = WritePBRPrimitiveShaderAttribs(pAttribsData,
-                                                   AttribsData,
-                                                   !Renderer.GetSettings().PackMatrixRowMajor);
+PBR_Renderer::PSOKey GetRadientDepthPrepassPSOKey(const PBR_Renderer::PSOKey& MainPsoKey)
+{
+    // PSOKey constructor strips the flags and the alpha mode that do not affect depth
+    return PBR_Renderer::PSOKey{
+        PBR_Renderer::RenderPassType::DepthOnly,
+        MainPsoKey.GetFlags(),
+        MainPsoKey.GetAlphaMode(),
+        MainPsoKey.GetCullMode(),
+    };
+}
 
-    VERIFY(reinterpret_cast<uint8_t*>(pEndPtr) <= static_cast<uint8_t*>(pAttribsData) + Renderer.GetPBRPrimitiveAttribsCB()->GetDesc().Size,
-           "Not enough space in the buffer to store primitive attributes");
+GraphicsPipelineDesc GetRadientDepthPrepassGraphicsDesc(const GraphicsPipelineDesc& MainDesc)
+{
+    GraphicsPipelineDesc DepthDesc = MainDesc;
+    DepthDesc.NumRenderTargets     = 0;
+    for (TEXTURE_FORMAT& RTVFormat : DepthDesc.RTVFormats)
+        RTVFormat = TEX_FORMAT_UNKNOWN;
+
+    DepthDesc.DepthStencilDesc.DepthEnable      = True;
+    DepthDesc.DepthStencilDesc.DepthWriteEnable = True;
+    DepthDesc.DepthStencilDesc.DepthFunc        = COMPARISON_FUNC_LESS;
+    return DepthDesc;
+}
 
-    pContext->UnmapBuffer(Renderer.GetPBRPrimitiveAttribsCB(), MAP_WRITE);
+GraphicsPipelineDesc GetRadientEarlyZGraphicsDesc(const GraphicsPipelineDesc& MainDesc)
+{
+    // The pre-pass and the main pass transform positions identically, so every visible
+    // pixel passes the equality test exactly once and no overdraw is shaded.
+    GraphicsPipelineDesc EarlyZDesc = MainDesc;
+
+    EarlyZDesc.DepthStencilDesc.DepthEnable      = True;
+    EarlyZDesc.DepthStencilDesc.DepthWriteEnable = False;
+    EarlyZDesc.DepthStencilDesc.DepthFunc        = COMPARISON_FUNC_EQUAL;
+    return EarlyZDesc;
 }
 
-void WriteMaterialAttribs(PBR_Renderer&           Renderer,
-                          IDeviceContext*         pContext,
-                          PBR_Renderer::PSO_FLAGS PSOFlags,
-                          const GLTF::Material&   Material)
+GraphicsPipelineDesc GetRadientShadowGraphicsDesc(const GraphicsPipelineDesc& MainDesc,
+                                                  TEXTURE_FORMAT              ShadowMapFormat,
+                                                  Uint32                      FilterSize,
+                                                  bool                        EnableDepthClamp)
 {
-    void* pAttribsData = nullptr;
-    pContext->MapBuffer(Renderer.GetPBRMaterialAttribsCB(), MAP_WRITE, MAP_FLAG_DISCARD, pAttribsData);
-    if (pAttribsData == nullptr)
+    GraphicsPipelineDesc ShadowDesc = GetRadientDepthPrepassGraphicsDesc(MainDesc);
+    ShadowDesc.DSVFormat            = ShadowMapFormat;
+
+    // Same bias as used by the Hydrogent shadow pass
+    ShadowDesc.RasterizerDesc.SlopeScaledDepthBias = static_cast<float>(FilterSize) * 0.5f + 0.5f;
+    if (ShadowMapFormat == TEX_FORMAT_D32_FLOAT ||
+        ShadowMapFormat == TEX_FORMAT_D32_FLOAT_S8X24_UINT)
     {
-        UNEXPECTED("Unable to map PBR material attribs buffer");
-        return;
+        // Bias = DepthBias * 2^(exponent(max z in primitive) - 23) + SlopeScaledDepthBias * MaxDepthSlope
+        ShadowDesc.RasterizerDesc.DepthBias = 10000;
+    }
+    else
+    {
+        // Bias = DepthBias * r + SlopeScaledDepthBias * MaxDepthSlope, where r is the smallest representable depth
+        ShadowDesc.RasterizerDesc.DepthBias = 10;
     }
 
-    void* pEndPtr = WritePBRMaterialShaderAttribs(pAttribsData,
-                                                  Renderer.GetSettings(),
-                                                  PSOFlags,
-                                                  Material);
+    // Casters between the light and the cascade near plane must still shadow the cascade
+    ShadowDesc.RasterizerDesc.DepthClipEnable = EnableDepthClamp ? False : True;
 
-    VERIFY(reinterpret_cast<uint8_t*>(pEndPtr) <= static_cast<uint8_t*>(pAttribsData) + Renderer.GetPBRMaterialAttribsCB()->GetDesc().Size,
-           "Not enough space in the buffer to store material attributes");
+    return ShadowDesc;
+}
 
-    pContext->UnmapBuffer(Renderer.GetPBRMaterialAttribsCB(), MAP_WRITE);
+RadientFloat4 GetRadientViewDepthPlane(IRenderDevice*                   pDevice,
+                                       const RadientViewDesc&           ViewDesc,
+                                       const RadientFrameRenderTargets& Targets)
+{
+    HLSL::CameraAttribs CameraAttribs{};
+    WriteCameraShaderAttribs(pDevice, ViewDesc, Targets, 0, CameraAttribs);
+    return GetViewDepthPlane(CameraAttribs.mView);
 }
 
-} // namespace
+float4x4 GetRadientViewOcclusionMatrix(const RadientViewDesc&           ViewDesc,
+                                       const RadientFrameRenderTargets& Targets)
+{
+    // Without a device, the camera projection maps depth to [0, 1]
+    HLSL::CameraAttribs CameraAttribs{};
+    WriteCameraShaderAttribs(nullptr, ViewDesc, Targets, 0, CameraAttribs);
+    return CameraAttribs.mViewProj;
+}
+
+RadientGeometryRenderer::RadientGeometryRenderer(const RadientShadowCascadeDesc& ShadowDesc,
+                                                 bool                            EnableGPUDrivenRendering) noexcept :
+    m_EnableGPUDrivenRendering{EnableGPUDrivenRendering},
+    m_ShadowDesc{ShadowDesc}
+{
+    m_ShadowDesc.CascadeCount = std::min(m_ShadowDesc.CascadeCount, Uint32{MAX_CASCADES});
+    if (m_ShadowDesc.Resolution == 0)
+        m_ShadowDesc.CascadeCount = 0;
+}
 
-RadientGeometryPass::RadientGeometryPass(bool EnableAsyncPipelineCompilation) noexcept :
-    m_EnableAsyncPipelineCompilation{EnableAsyncPipelineCompilation}
+RadientGeometryPass::RadientGeometryPass(bool                               EnableAsyncPipelineCompilation,
+                                         bool                               EnableDepthPrepass,
+                                         const RadientOcclusionCullingDesc& OcclusionDesc) noexcept :
+    m_EnableAsyncPipelineCompilation{EnableAsyncPipelineCompilation},
+    m_EnableDepthPrepass{EnableDepthPrepass},
+    m_OcclusionDesc{OcclusionDesc}
 {
 }
 
@@ -787,12 +1106,23 @@ RADIENT_STATUS RadientGeometryRenderer::Prepare(IRenderDevice*  pDevice,
     return RADIENT_STATUS_OK;
 }
 
-RADIENT_STATUS RadientGeometryRenderer::BeginFrame(IRenderDevice*                   pDevice,
-                                                   IDeviceContext*                  pContext,
-                                                   const RadientLightLists&         LightList,
-                                                   GLTF::ResourceManager*           pResourceManager,
-                                                   const RadientViewDesc&           ViewDesc,
-                                                   const RadientFrameRenderTargets& Targets)
+void RadientGeometryRenderer::PrepareHeadless(Uint32 PrimitiveAttribsBufferSize, Uint32 OffsetAlignment)
+{
+    VERIFY(m_pRenderer == nullptr, "Renderers with a render device must be prepared with Prepare()");
+
+    m_HeadlessSettings = GetRadientPBRRendererSettings(m_ShadowDesc);
+    m_BaseRenderFlags  = GetRadientBaseRenderFlags(m_HeadlessSettings.EnableShadows);
+
+    // Same layouts as CreateRenderer()
+    m_MaterialTable.SetLayout(PBR_Renderer::GetPBRMaterialAttribsSize(m_HeadlessSettings, PBR_Renderer::PSO_FLAG_ALL), OffsetAlignment);
+    m_PrimitiveRecords.Reset(PrimitiveAttribsBufferSize, OffsetAlignment, GetPrimitiveAttribsRangeSize(m_HeadlessSettings));
+}
+
+RADIENT_STATUS RadientGeometryRenderer::BeginFrame(IRenderDevice*                pDevice,
+                                                   IDeviceContext*               pContext,
+                                                   const RadientLightLists&      LightList,
+                                                   GLTF::ResourceManager*        pResourceManager,
+                                                   const RadientEnvironmentDesc& Environment)
 {
     if (pDevice == nullptr || pContext == nullptr)
         return RADIENT_STATUS_OK;
@@ -806,241 +1136,1456 @@ RADIENT_STATUS RadientGeometryRenderer::BeginFrame(IRenderDevice*
     if (m_pRenderer == nullptr || m_pFrameAttribsCB == nullptr)
         return RADIENT_STATUS_OK;
 
-    const RadientEnvironmentDesc Environment       = ViewDesc.pScene != nullptr ?
-              ViewDesc.pScene->GetEnvironment() :
-              RadientEnvironmentDesc{};
-    const RADIENT_STATUS         EnvironmentStatus = UpdateEnvironment(pContext, Environment);
+    const RADIENT_STATUS EnvironmentStatus = UpdateEnvironment(pContext, Environment);
     if (RADIENT_FAILED(EnvironmentStatus))
         return EnvironmentStatus;
+    m_Environment = Environment;
 
-    {
-        MapHelper<HLSL::PBRFrameAttribs> FrameAttribs{pContext, m_pFrameAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
-        HLSL::PBRFrameAttribs*           pFrameAttribs = FrameAttribs;
-        if (pFrameAttribs == nullptr)
-            return RADIENT_STATUS_INVALID_OPERATION;
-
-        WriteCameraShaderAttribs(pDevice, ViewDesc, Targets, m_FrameIndex, pFrameAttribs->Camera);
-        WriteCameraShaderAttribs(pDevice, ViewDesc, Targets, m_FrameIndex, pFrameAttribs->PrevCamera);
-        WriteSceneLights(*m_pRenderer, LightList, Environment, m_pPrefilteredEnvMapSRV, *pFrameAttribs);
-    }
+    WriteFrameLights(LightList);
 
     if (pResourceManager == nullptr)
         return RADIENT_STATUS_OUT_OF_DATE;
 
     m_CacheUseInfo.pResourceMgr = pResourceManager;
-    BeginResourceCache(*m_pRenderer, pDevice, pContext, m_CacheUseInfo, m_CacheBindings,
-                       m_pFrameAttribsCB, m_pIrradianceCubeSRV, m_pPrefilteredEnvMapSRV);
-    if (!m_CacheBindings.pSRB)
-        return RADIENT_STATUS_OUT_OF_DATE;
+    BeginResourceCache(*m_pRenderer, pContext, m_CacheUseInfo);
 
-    return RADIENT_STATUS_OK;
-}
+    // Slots written by the geometry passes since the previous frame
+    const RADIENT_STATUS MaterialTableStatus = m_MaterialTable.CommitUpdates(pDevice, pContext);
+    if (RADIENT_FAILED(MaterialTableStatus))
+        return MaterialTableStatus;
 
-void RadientGeometryRenderer::EndFrame()
-{
-    ++m_FrameIndex;
+    return RADIENT_STATUS_OK;
 }
 
-RADIENT_STATUS RadientGeometryPass::Prepare(RadientGeometryRenderer&         Renderer,
-                                            IRenderDevice*                   pDevice,
-                                            IDeviceContext*                  pContext,
-                                            const RadientSceneDrawableCache& DrawableCache,
-                                            const RadientFrameRenderTargets& Targets)
+RADIENT_STATUS RadientGeometryRenderer::BeginView(IRenderDevice*                   pDevice,
+                                                  IDeviceContext*                  pContext,
+                                                  const RadientViewDesc&           ViewDesc,
+                                                  const RadientFrameRenderTargets& Targets)
 {
     if (pDevice == nullptr || pContext == nullptr)
         return RADIENT_STATUS_OK;
 
-    PBR_Renderer* pRenderer = Renderer.GetRenderer();
-    if (pRenderer == nullptr)
+    if (m_pRenderer == nullptr || m_pFrameAttribsCB == nullptr)
+        return RADIENT_STATUS_OK;
+
+    if (m_CacheUseInfo.pResourceMgr == nullptr)
+        return RADIENT_STATUS_OUT_OF_DATE;
+
+    HLSL::CameraAttribs CameraAttribs{};
+    WriteCameraShaderAttribs(pDevice, ViewDesc, Targets, m_FrameIndex, CameraAttribs);
+    m_ViewDepthPlane  = GetViewDepthPlane(CameraAttribs.mView);
+    m_ViewLayerMask   = ViewDesc.LayerMask;
+    m_ViewCullAttribs = GetRadientIndirectCullAttribs(CameraAttribs.mViewProj, pDevice->GetDeviceInfo().NDC.MinZ < 0.f, 0);
+
+    // Cascades are fitted to the view frustum
+    Uint32 ShadowLightIndex = ~0u;
+    m_ShadowCascades.Clear();
+    if (m_pShadowMapSRV != nullptr && DistributeShadowCascades(CameraAttribs.mViewInv, CameraAttribs.mProj))
+        ShadowLightIndex = m_ShadowLightIndex;
+
+    if (m_pRenderer->GetSettings().EnableClusteredLighting)
     {
-        const RADIENT_STATUS PrepareStatus = Renderer.Prepare(pDevice, pContext);
-        if (RADIENT_FAILED(PrepareStatus))
-            return PrepareStatus;
+        m_LightClusters.SetGrid(GetLightClusterGridDesc(CameraAttribs));
+        m_LightClusters.ClearLights();
+        for (const ClusteredLightSource& Light : m_ClusteredLightSources)
+        {
+            const float3 ClusterPos = GetLightClusterSpaceVector(CameraAttribs.mView, Light.Position, 1.f);
+            if (Light.ConeAngle > 0)
+            {
+                const float3 ClusterDir = normalize(GetLightClusterSpaceVector(CameraAttribs.mView, Light.Direction, 0.f));
+                m_LightClusters.AddSpotLight(ClusterPos, ClusterDir, Light.Range, Light.ConeAngle);
+            }
+            else
+            {
+                m_LightClusters.AddPointLight(ClusterPos, Light.Range);
+            }
+        }
+        m_LightClusters.Bin();
+    }
 
-        pRenderer = Renderer.GetRenderer();
+    {
+        MapHelper<HLSL::PBRFrameAttribs> FrameAttribs{pContext, m_pFrameAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        HLSL::PBRFrameAttribs*           pFrameAttribs = FrameAttribs;
+        if (pFrameAttribs == nullptr)
+            return RADIENT_STATUS_INVALID_OPERATION;
+
+        pFrameAttribs->Camera     = CameraAttribs;
+        pFrameAttribs->PrevCamera = CameraAttribs;
+
+        WriteViewLights(*m_pRenderer, m_Environment, m_pPrefilteredEnvMapSRV, m_FrameLightsData, ShadowLightIndex, *pFrameAttribs);
+        WriteShadowMapInfos(m_ShadowCascades, *pFrameAttribs);
     }
-    if (pRenderer == nullptr)
-        return RADIENT_STATUS_OK;
 
-    bool          RebuildDrawablePassData = false;
-    ITextureView* pColorRTV               = Targets.GetColorRTV();
-    if (pColorRTV == nullptr)
-        return RADIENT_STATUS_OK;
+    const RADIENT_STATUS LightClustersStatus = UpdateLightClusterBuffers(pDevice, pContext);
+    if (RADIENT_FAILED(LightClustersStatus))
+        return LightClustersStatus;
+
+    PBR_Renderer::LightClusterResources LightClusters;
+    LightClusters.pAttribsCB    = m_LightClusterBuffers.pAttribsCB;
+    LightClusters.pLights       = m_LightClusterBuffers.pLights;
+    LightClusters.pClusterGrid  = m_LightClusterBuffers.pClusterGrid;
+    LightClusters.pLightIndices = m_LightClusterBuffers.pLightIndices;
+    UpdateResourceCacheSRB(*m_pRenderer, pDevice, pContext, m_CacheUseInfo, m_CacheBindings,
+                           m_pFrameAttribsCB, m_pIrradianceCubeSRV, m_pPrefilteredEnvMapSRV, LightClusters, m_pShadowMapSRV, m_MaterialTable);
+    if (!m_CacheBindings.pSRB)
+        return RADIENT_STATUS_OUT_OF_DATE;
 
-    const TEXTURE_FORMAT RTVFormat = GetTextureViewFormat(pColorRTV);
-    const TEXTURE_FORMAT DSVFormat = GetTextureViewFormat(Targets.GetDepthDSV());
-    if (m_RTVFormat != RTVFormat ||
-        m_DSVFormat != DSVFormat)
+    if (m_ShadowCascades.GetCascadeCount() > 0)
     {
-        const RADIENT_STATUS Status = CreatePsoCaches(*pRenderer, Renderer.GetBaseRenderFlags(), RTVFormat, DSVFormat);
-        if (RADIENT_FAILED(Status))
-            return Status;
-
-        RebuildDrawablePassData = true;
+        // Even though the shadow map is not sampled by the shadow pass, some backends do not allow
+        // null resources, and the shadow map itself can't be bound while it is being rendered to.
+        UpdateResourceCacheSRB(*m_pRenderer, pDevice, pContext, m_CacheUseInfo, m_ShadowCacheBindings,
+                               m_pShadowFrameAttribsCB, m_pIrradianceCubeSRV, m_pPrefilteredEnvMapSRV, LightClusters, m_pDummyShadowMapSRV,
+                               m_MaterialTable);
+        if (!m_ShadowCacheBindings.pSRB)
+            return RADIENT_STATUS_OUT_OF_DATE;
     }
 
-    SyncDrawablePassData(*pRenderer, DrawableCache, RebuildDrawablePassData);
     return RADIENT_STATUS_OK;
 }
 
-RADIENT_STATUS RadientGeometryPass::Execute(RadientGeometryRenderer&         Renderer,
-                                            IRenderDevice*                   pDevice,
-                                            IDeviceContext*                  pContext,
-                                            const RadientDrawList&           DrawList,
-                                            const RadientSceneDrawableCache& DrawableCache,
-                                            const RadientFrameRenderTargets& Targets)
+void RadientGeometryRenderer::BeginHeadlessView(const RadientLightLists&         LightList,
+                                                const RadientViewDesc&           ViewDesc,
+                                                const RadientFrameRenderTargets& Targets)
 {
-    if (pDevice == nullptr || pContext == nullptr || DrawList.IsEmpty())
-        return RADIENT_STATUS_OK;
+    VERIFY(m_pRenderer == nullptr, "Renderers with a render device must use BeginView()");
 
-    PBR_Renderer* const pRenderer = Renderer.GetRenderer();
-    if (pRenderer == nullptr)
-        return RADIENT_STATUS_OK;
+    HLSL::CameraAttribs CameraAttribs{};
+    WriteCameraShaderAttribs(nullptr, ViewDesc, Targets, m_FrameIndex, CameraAttribs);
+    m_ViewDepthPlane = GetViewDepthPlane(CameraAttribs.mView);
+    m_ViewLayerMask  = ViewDesc.LayerMask;
 
-    if (!m_PbrPSOCache)
-    {
-        const RADIENT_STATUS PrepareStatus = Prepare(Renderer, pDevice, pContext, DrawableCache, Targets);
-        if (RADIENT_FAILED(PrepareStatus))
-            return PrepareStatus;
-    }
-    if (!m_PbrPSOCache)
-        return RADIENT_STATUS_OK;
+    // There are no frame lights to write, so the shadow light is found for every view
+    m_pShadowLightItem = m_ShadowDesc.CascadeCount > 0 ? FindShadowLight(LightList) : nullptr;
+    m_ShadowCascades.Clear();
+    DistributeShadowCascades(CameraAttribs.mViewInv, CameraAttribs.mProj);
+}
 
-    IShaderResourceBinding* const pResourceCacheSRB = Renderer.GetResourceCacheSRB();
-    if (pResourceCacheSRB == nullptr)
-        return RADIENT_STATUS_OUT_OF_DATE;
+bool RadientGeometryRenderer::DistributeShadowCascades(const float4x4& CameraWorld, const float4x4& CameraProj)
+{
+    if (m_pShadowLightItem == nullptr)
+        return false;
 
-    ITextureView* pColorRTV = Targets.GetColorRTV();
-    ITextureView* pDepthDSV = Targets.GetDepthDSV();
-    pContext->SetRenderTargets(1, &pColorRTV, pDepthDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    return m_ShadowCascades.Distribute(m_ShadowDesc, CameraWorld, CameraProj, GetLightDirection(*m_pShadowLightItem->pWorldMatrix));
+}
 
-    BuildSortedDrawableIDs(DrawList, DrawableCache);
+void RadientGeometryRenderer::WriteFrameLights(const RadientLightLists& LightList)
+{
+    m_FrameLightsData.clear();
+    m_ClusteredLightsData.clear();
+    m_ClusteredLightSources.clear();
+    m_UploadClusteredLights = true;
 
-    IShaderResourceBinding* pCurrSRB        = nullptr;
-    IPipelineState*         pCurrPSO        = nullptr;
-    IVertexPool*            pCurrVertexPool = nullptr;
-    const GLTF::Material*   pCurrMaterial   = nullptr;
+    // The shadow light is found first, so that its index is known when its attributes are written
+    m_pShadowLightItem = m_ShadowDesc.CascadeCount > 0 ? FindShadowLight(LightList) : nullptr;
+    m_ShadowLightIndex = ~0u;
 
-    for (const RadientDrawableID DrawableID : m_SortedDrawableIDs)
-    {
-        VERIFY(DrawableID < m_DrawablePassData.size(), "Sorted drawable ID references invalid pass data");
-        const DrawablePassData& PassData = m_DrawablePassData[DrawableID];
-        VERIFY(PassData.pDrawable != nullptr &&
+    const bool EnableClusteredLighting = m_pRenderer->GetSettings().EnableClusteredLighting;
+
+    LightList.Enumerate([&](const RadientLightItem& LightItem) {
+        VERIFY(LightItem.pLight != nullptr, "Light list item has null light pointer");
+        VERIFY(LightItem.pWorldMatrix != nullptr, "Light list item has null world matrix pointer");
+        VERIFY(LightItem.pEffectiveVisible != nullptr, "Light list item has null visibility pointer");
+        if (LightItem.pLight == nullptr ||
+            LightItem.pWorldMatrix == nullptr ||
+            LightItem.pEffectiveVisible == nullptr ||
+            !*LightItem.pEffectiveVisible)
+            return;
+
+        const RadientLightComponent& Light = *LightItem.pLight;
+
+        const float3 Position  = GetLightPosition(*LightItem.pWorldMatrix);
+        const float3 Direction = GetLightDirection(*LightItem.pWorldMatrix);
+        const bool   HasPosition =
+            Light.Type == RADIENT_LIGHT_TYPE_POINT ||
+            Light.Type == RADIENT_LIGHT_TYPE_SPOT;
+        const bool HasDirection =
+            Light.Type == RADIENT_LIGHT_TYPE_DIRECTIONAL ||
+            Light.Type == RADIENT_LIGHT_TYPE_SPOT;
+
+        std::vector<Uint8>* pLightsData = nullptr;
+        if (EnableClusteredLighting && HasPosition && Light.Range > 0)
+        {
+            ClusteredLightSource Source;
+            Source.Position  = Position;
+            Source.Direction = Direction;
+            Source.Range     = Light.Range * RadientDefaultSceneScale;
+            Source.ConeAngle = Light.Type == RADIENT_LIGHT_TYPE_SPOT ? clamp(Light.OuterConeAngle, 0.f, PI_F * 0.5f) : 0.f;
+            m_ClusteredLightSources.push_back(Source);
+
+            pLightsData = &m_ClusteredLightsData;
+        }
+        else
+        {
+            if (m_FrameLightsData.size() >= RadientMaxLightCount * sizeof(HLSL::PBRLightAttribs))
+                return;
+
+            if (&LightItem == m_pShadowLightItem)
+                m_ShadowLightIndex = static_cast<Uint32>(m_FrameLightsData.size() / sizeof(HLSL::PBRLightAttribs));
+
+            pLightsData = &m_FrameLightsData;
+        }
+
+        const size_t DataOffset = pLightsData->size();
+        pLightsData->resize(DataOffset + sizeof(HLSL::PBRLightAttribs));
+        WritePBRLightShaderAttribs(Light,
+                                   HasPosition ? &Position : nullptr,
+                                   HasDirection ? &Direction : nullptr,
+                                   *reinterpret_cast<HLSL::PBRLightAttribs*>(&(*pLightsData)[DataOffset]));
+    });
+}
+
+RADIENT_STATUS RadientGeometryRenderer::WriteShadowCascadeAttribs(IDeviceContext* pContext, Uint32 Cascade)
+{
+    if (pContext == nullptr || m_pShadowFrameAttribsCB == nullptr || Cascade >= m_ShadowCascades.GetCascadeCount())
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    MapHelper<HLSL::PBRFrameAttribs> FrameAttribs{pContext, m_pShadowFrameAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+    HLSL::PBRFrameAttribs*           pFrameAttribs = FrameAttribs;
+    if (pFrameAttribs == nullptr)
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    const float4x4& WorldToLightProjSpace = m_ShadowCascades.GetCascade(Cascade).WorldToLightProjSpace;
+    const float     Resolution            = static_cast<float>(m_ShadowDesc.Resolution);
+
+    HLSL::CameraAttribs& CameraAttribs = pFrameAttribs->Camera;
+    CameraAttribs                      = {};
+    CameraAttribs.f4ViewportSize       = float4{Resolution, Resolution, 1.f / Resolution, 1.f / Resolution};
+    CameraAttribs.fHandness            = 1.f;
+    CameraAttribs.mView                = float4x4::Identity();
+    CameraAttribs.mProj                = WorldToLightProjSpace;
+    CameraAttribs.mViewProj            = WorldToLightProjSpace;
+    CameraAttribs.mViewInv             = float4x4::Identity();
+    CameraAttribs.mProjInv             = WorldToLightProjSpace.Inverse();
+    CameraAttribs.mViewProjInv         = CameraAttribs.mProjInv;
+    CameraAttribs.f4Position           = float4{0.f, 0.f, 0.f, 1.f};
+    pFrameAttribs->PrevCamera          = CameraAttribs;
+
+    std::memset(&pFrameAttribs->Renderer, 0, sizeof(HLSL::PBRRendererShaderParameters));
+
+    return RADIENT_STATUS_OK;
+}
+
+void RadientGeometryRenderer::EndFrame()
+{
+    ++m_FrameIndex;
+}
+
+RADIENT_STATUS RadientGeometryPass::Prepare(RadientGeometryRenderer&         Renderer,
+                                            IRenderDevice*                   pDevice,
+                                            IDeviceContext*                  pContext,
+                                            const RadientSceneDrawableCache& DrawableCache,
+                                            const RadientFrameRenderTargets& Targets)
+{
+    if (pDevice == nullptr || pContext == nullptr)
+        return RADIENT_STATUS_OK;
+
+    PBR_Renderer* pRenderer = Renderer.GetRenderer();
+    if (pRenderer == nullptr)
+    {
+        const RADIENT_STATUS PrepareStatus = Renderer.Prepare(pDevice, pContext);
+        if (RADIENT_FAILED(PrepareStatus))
+            return PrepareStatus;
+
+        pRenderer = Renderer.GetRenderer();
+    }
+    if (pRenderer == nullptr)
+        return RADIENT_STATUS_OK;
+
+    bool          RebuildDrawablePassData = false;
+    ITextureView* pColorRTV               = Targets.GetColorRTV();
+    if (pColorRTV == nullptr)
+        return RADIENT_STATUS_OK;
+
+    const TEXTURE_FORMAT RTVFormat       = GetTextureViewFormat(pColorRTV);
+    const TEXTURE_FORMAT DSVFormat       = GetTextureViewFormat(Targets.GetDepthDSV());
+    const TEXTURE_FORMAT ShadowMapFormat = GetTextureViewFormat(Renderer.GetShadowMapDSV(0));
+    // The render flags were overwritten if the pass was prepared with another sink
+    if (m_pSink != &m_DeviceSink ||
+        m_RTVFormat != RTVFormat ||
+        m_DSVFormat != DSVFormat ||
+        m_ShadowMapFormat != ShadowMapFormat)
+    {
+        const RADIENT_STATUS Status = CreatePsoCaches(*pRenderer, Renderer.GetBaseRenderFlags(), RTVFormat, DSVFormat, ShadowMapFormat,
+                                                      pDevice->GetDeviceInfo().Features.DepthClamp != DEVICE_FEATURE_STATE_DISABLED);
+        if (RADIENT_FAILED(Status))
+            return Status;
+
+        RebuildDrawablePassData = true;
+    }
+
+    if (Renderer.GetIndirectDrawBucketSize() > 0 && !m_pIndirectCullPSO)
+    {
+        const RADIENT_STATUS Status = CreateIndirectCullResources(pDevice);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    // Pipeline states of the pass data are created in the PSO caches of the pass
+    m_pSink = &m_DeviceSink;
+    SyncDrawablePassData(pRenderer->GetSettings(), Renderer.GetMaterialTable(), DrawableCache, RebuildDrawablePassData);
+
+    // Depth written by previous frames must not be used by early-Z PSOs
+    ++m_DepthPrepassIndex;
+    m_DepthPrepassBuildID = 0;
+
+    return RADIENT_STATUS_OK;
+}
+
+void RadientGeometryPass::Prepare(RadientGeometryRenderer&         Renderer,
+                                  const RadientSceneDrawableCache& DrawableCache,
+                                  IRadientGeometryCommandSink&     Sink)
+{
+    // Without render targets, the render flags do not depend on the output format
+    const bool RebuildDrawablePassData = m_pSink != &Sink;
+    if (RebuildDrawablePassData)
+    {
+        m_pSink                    = &Sink;
+        m_RenderFlags              = Renderer.GetBaseRenderFlags();
+        m_HasDepthPrepassPipelines = m_EnableDepthPrepass;
+        m_HasShadowPipelines       = Renderer.GetShadowDesc().CascadeCount > 0;
+    }
+    SyncDrawablePassData(Renderer.GetSettings(), Renderer.GetMaterialTable(), DrawableCache, RebuildDrawablePassData);
+
+    // Depth written by previous frames must not be used by early-Z PSOs
+    ++m_DepthPrepassIndex;
+    m_DepthPrepassBuildID = 0;
+}
+
+void RadientGeometryPass::PrepareViewDrawables(const RadientDrawLists&          DrawLists,
+                                               const RadientSceneDrawableCache& DrawableCache,
+                                               const RadientViewDesc&           ViewDesc,
+                                               const RadientFloat4&             ViewDepthPlane,
+                                               RadientGeometryViewDrawables&    View)
+{
+    View.ViewDepthPlane = ViewDepthPlane;
+    View.LayerMask      = ViewDesc.LayerMask;
+    View.DepthPrepassIDs.clear();
+    View.BlendIDs.clear();
+    View.OccludedDrawables.clear();
+    View.DepthPrepassBuildID = 0;
+
+    if (m_pSink == nullptr)
+        return;
+
+    // Views with the same layer mask share the cached lists; only the depth order is per view
+    if (m_HasDepthPrepassPipelines)
+    {
+        const RadientDrawList* const PrepassLists[] =
+            {
+                &DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE),
+                &DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_MASK),
+            };
+        const RadientDrawListCache::Entry& StageList = GetStageDrawableIDs(&DrawLists, PrepassLists, _countof(PrepassLists), DrawableCache, DrawStage::DepthPrepass,
+                                                                           RadientGeometryDrawOrder::FrontToBack, View.LayerMask, 0);
+        View.DepthPrepassIDs     = StageList.DrawableIDs;
+        View.DepthPrepassBuildID = StageList.BuildID;
+    }
+
+    // Alpha-blended primitives do not take part in the depth pre-pass, so their PSOs do not depend on it
+    const RadientDrawList* const       pBlendList = &DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_BLEND);
+    const RadientDrawListCache::Entry& BlendList  = GetStageDrawableIDs(pBlendList, &pBlendList, 1, DrawableCache, DrawStage::Main,
+                                                                        RadientGeometryDrawOrder::BackToFront, View.LayerMask, 0);
+    View.BlendIDs = BlendList.DrawableIDs;
+}
+
+void RadientGeometryPass::SortViewDrawables(RadientGeometryViewDrawables& View) const
+{
+    if (!View.DepthPrepassIDs.empty())
+    {
+        SortDrawableIDsByDepth(View.DepthPrepassIDs, RadientGeometryDrawOrder::FrontToBack, View.ViewDepthPlane, DrawStage::DepthPrepass,
+                               View.DepthSorter, View.SortPSOs);
+    }
+    if (!View.BlendIDs.empty())
+    {
+        SortDrawableIDsByDepth(View.BlendIDs, RadientGeometryDrawOrder::BackToFront, View.ViewDepthPlane, DrawStage::Main,
+                               View.DepthSorter, View.SortPSOs);
+    }
+}
+
+bool RadientGeometryPass::BeginViewOcclusion(const RadientDrawLists&          DrawLists,
+                                             const RadientSceneDrawableCache& DrawableCache,
+                                             const float4x4&                  ViewProj,
+                                             const RadientExtent2D&           ViewSize,
+                                             RadientGeometryViewDrawables&    View) const
+{
+    View.OcclusionCandidates.clear();
+    View.OccludedDrawables.clear();
+    if (!m_OcclusionDesc.Enable || m_OcclusionDesc.MaxOccluderCount == 0 || m_pSink == nullptr ||
+        m_OcclusionDesc.BufferWidth == 0 || ViewSize.Width == 0 || ViewSize.Height == 0)
+        return false;
+
+    const std::array<GLTF::Material::ALPHA_MODE, 3> AlphaModes =
+        {
+            GLTF::Material::ALPHA_MODE_OPAQUE,
+            GLTF::Material::ALPHA_MODE_MASK,
+            GLTF::Material::ALPHA_MODE_BLEND,
+        };
+    for (const GLTF::Material::ALPHA_MODE AlphaMode : AlphaModes)
+        DrawLists.GetDrawList(AlphaMode).FilterByLayerMask(View.LayerMask, View.OcclusionCandidates);
+
+    // Only the drawables that may be rendered by the view are tested
+    View.OcclusionCandidates.erase(
+        std::remove_if(View.OcclusionCandidates.begin(), View.OcclusionCandidates.end(),
+                       [&](RadientDrawableID DrawableID) {
+                           const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(DrawableID);
+                           return pDrawable == nullptr ||
+                               DrawableID >= m_DrawablePassData.size() ||
+                               m_DrawablePassData[DrawableID].pDrawable != pDrawable ||
+                               pDrawable->pWorldMatrix == nullptr ||
+                               pDrawable->pEffectiveVisible == nullptr ||
+                               !*pDrawable->pEffectiveVisible;
+                       }),
+        View.OcclusionCandidates.end());
+
+    // Opaque drawables flagged as occluders are ranked by the size of their bounds relative to
+    // their distance from the camera, and the largest ones are rasterized.
+    View.OccluderScores.clear();
+    for (const RadientDrawableID DrawableID : View.OcclusionCandidates)
+    {
+        const RadientDrawableSlot& Drawable = *m_DrawablePassData[DrawableID].pDrawable;
+        if (Drawable.AlphaMode != GLTF::Material::ALPHA_MODE_OPAQUE ||
+            Drawable.pRenderer == nullptr ||
+            !Drawable.pRenderer->Occluder)
+            continue;
+
+        const float4x4 World = RadientMath::ToFloat4x4(*Drawable.pWorldMatrix);
+        const float3   Min{Drawable.LocalBounds.Min.x, Drawable.LocalBounds.Min.y, Drawable.LocalBounds.Min.z};
+        const float3   Max{Drawable.LocalBounds.Max.x, Drawable.LocalBounds.Max.y, Drawable.LocalBounds.Max.z};
+        const float4   Center = float4{(Min + Max) * 0.5f, 1.f} * World;
+        const float3   AxisX  = float3::MakeVector(World[0]) * ((Max.x - Min.x) * 0.5f);
+        const float3   AxisY  = float3::MakeVector(World[1]) * ((Max.y - Min.y) * 0.5f);
+        const float3   AxisZ  = float3::MakeVector(World[2]) * ((Max.z - Min.z) * 0.5f);
+
+        const RadientFloat4& Plane  = View.ViewDepthPlane;
+        const float          Radius = std::sqrt(dot(AxisX, AxisX) + dot(AxisY, AxisY) + dot(AxisZ, AxisZ));
+        const float          Depth  = Plane.x * Center.x + Plane.y * Center.y + Plane.z * Center.z + Plane.w;
+        if (Depth + Radius <= 0.f || Radius <= 0.f)
+            continue; // Behind the camera or empty
+
+        View.OccluderScores.emplace_back(Radius / std::max(Depth, Radius * 1e-3f), DrawableID);
+    }
+    if (View.OccluderScores.empty())
+    {
+        View.OcclusionCandidates.clear();
+        return false;
+    }
+
+    const size_t OccluderCount = std::min(View.OccluderScores.size(), size_t{m_OcclusionDesc.MaxOccluderCount});
+    std::partial_sort(View.OccluderScores.begin(), View.OccluderScores.begin() + OccluderCount, View.OccluderScores.end(),
+                      [](const std::pair<float, RadientDrawableID>& Lhs, const std::pair<float, RadientDrawableID>& Rhs) {
+                          return Lhs.first > Rhs.first;
+                      });
+    View.OccluderScores.resize(OccluderCount);
+
+    const Uint32 BufferHeight = std::max(static_cast<Uint32>(static_cast<Uint64>(m_OcclusionDesc.BufferWidth) * ViewSize.Height / ViewSize.Width), 1u);
+    View.OcclusionBuffer.Begin(m_OcclusionDesc.BufferWidth, BufferHeight, ViewProj);
+    for (const std::pair<float, RadientDrawableID>& Occluder : View.OccluderScores)
+    {
+        const RadientDrawableSlot& Drawable = *m_DrawablePassData[Occluder.second].pDrawable;
+        View.OcclusionBuffer.AddOccluderBox(Drawable.LocalBounds, RadientMath::ToFloat4x4(*Drawable.pWorldMatrix));
+    }
+
+    // Occluders are not tested: the depth of their own boxes would hide them within the rounding error
+    std::sort(View.OccluderScores.begin(), View.OccluderScores.end(),
+              [](const std::pair<float, RadientDrawableID>& Lhs, const std::pair<float, RadientDrawableID>& Rhs) {
+                  return Lhs.second < Rhs.second;
+              });
+    View.OcclusionCandidates.erase(
+        std::remove_if(View.OcclusionCandidates.begin(), View.OcclusionCandidates.end(),
+                       [&](RadientDrawableID DrawableID) {
+                           return std::binary_search(View.OccluderScores.begin(), View.OccluderScores.end(), std::make_pair(0.f, DrawableID),
+                                                     [](const std::pair<float, RadientDrawableID>& Lhs, const std::pair<float, RadientDrawableID>& Rhs) {
+                                                         return Lhs.second < Rhs.second;
+                                                     });
+                       }),
+        View.OcclusionCandidates.end());
+
+    View.OccludedDrawables.assign(m_DrawablePassData.size(), Uint8{0});
+
+    return true;
+}
+
+void RadientGeometryPass::TestViewOcclusion(RadientGeometryViewDrawables& View, size_t First, size_t End) const
+{
+    VERIFY_EXPR(First <= End && End <= View.OcclusionCandidates.size());
+    for (size_t i = First; i < End; ++i)
+    {
+        const RadientDrawableID    DrawableID = View.OcclusionCandidates[i];
+        const RadientDrawableSlot& Drawable   = *m_DrawablePassData[DrawableID].pDrawable;
+        if (View.OcclusionBuffer.IsOccluded(Drawable.LocalBounds, RadientMath::ToFloat4x4(*Drawable.pWorldMatrix)))
+            View.OccludedDrawables[DrawableID] = 1;
+    }
+}
+
+Uint32 RadientGeometryPass::EndViewOcclusion(RadientGeometryViewDrawables& View) const
+{
+    if (View.OccludedDrawables.empty())
+        return 0;
+
+    const auto IsOccluded = [&View](RadientDrawableID DrawableID) {
+        return DrawableID < View.OccludedDrawables.size() && View.OccludedDrawables[DrawableID] != 0;
+    };
+    View.DepthPrepassIDs.erase(std::remove_if(View.DepthPrepassIDs.begin(), View.DepthPrepassIDs.end(), IsOccluded), View.DepthPrepassIDs.end());
+    View.BlendIDs.erase(std::remove_if(View.BlendIDs.begin(), View.BlendIDs.end(), IsOccluded), View.BlendIDs.end());
+
+    return static_cast<Uint32>(std::count_if(View.OcclusionCandidates.begin(), View.OcclusionCandidates.end(), IsOccluded));
+}
+
+RADIENT_STATUS RadientGeometryPass::Execute(RadientGeometryRenderer&            Renderer,
+                                            IRenderDevice*                      pDevice,
+                                            IDeviceContext*                     pContext,
+                                            const RadientDrawList&              DrawList,
+                                            const RadientSceneDrawableCache&    DrawableCache,
+                                            const RadientGeometryViewDrawables& View,
+                                            const RadientFrameRenderTargets&    Targets)
+{
+    if (pDevice == nullptr || pContext == nullptr || DrawList.IsEmpty())
+        return RADIENT_STATUS_OK;
+
+    PBR_Renderer* const pRenderer = Renderer.GetRenderer();
+    if (pRenderer == nullptr)
+        return RADIENT_STATUS_OK;
+
+    // Pipeline states of the pass data must belong to the device sink
+    if (m_pSink != &m_DeviceSink)
+    {
+        const RADIENT_STATUS PrepareStatus = Prepare(Renderer, pDevice, pContext, DrawableCache, Targets);
+        if (RADIENT_FAILED(PrepareStatus))
+            return PrepareStatus;
+    }
+    if (m_pSink != &m_DeviceSink)
+        return RADIENT_STATUS_OK;
+
+    IShaderResourceBinding* const pResourceCacheSRB = Renderer.GetResourceCacheSRB();
+    if (pResourceCacheSRB == nullptr)
+        return RADIENT_STATUS_OUT_OF_DATE;
+
+    const std::vector<RadientDrawableID>* pDrawableIDs = &GetMainPassDrawableIDs(DrawList, DrawableCache, View, Renderer.GetViewLayerMask());
+
+    // Indirect draws are culled before the render targets are bound
+    const IndirectDrawBuffers* pIndirectDraws = nullptr;
+    if (Renderer.GetIndirectDrawBucketSize() > 0 && m_pIndirectCullPSO)
+    {
+        pIndirectDraws = CullIndirectDraws(Renderer, pDevice, pContext, DrawList, *pDrawableIDs);
+        pDrawableIDs   = &m_DirectDrawIDs;
+    }
+
+    ITextureView* pColorRTV = Targets.GetColorRTV();
+    ITextureView* pDepthDSV = Targets.GetDepthDSV();
+    pContext->SetRenderTargets(1, &pColorRTV, pDepthDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Targets.SetViewport(pContext);
+
+    if (m_DeviceSink.Begin(Renderer, pContext, pResourceCacheSRB))
+    {
+        if (pIndirectDraws != nullptr)
+            DrawIndirectBuckets(Renderer, m_DeviceSink, *pIndirectDraws);
+        DrawSortedDrawables(Renderer, m_DeviceSink, *pDrawableIDs, DrawStage::Main);
+    }
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientGeometryPass::ExecuteBlend(RadientGeometryRenderer&            Renderer,
+                                                 IRenderDevice*                      pDevice,
+                                                 IDeviceContext*                     pContext,
+                                                 const RadientGeometryViewDrawables& View,
+                                                 const RadientFrameRenderTargets&    Targets)
+{
+    if (pDevice == nullptr || pContext == nullptr || View.BlendIDs.empty())
+        return RADIENT_STATUS_OK;
+
+    PBR_Renderer* const pRenderer = Renderer.GetRenderer();
+    if (pRenderer == nullptr || m_pSink != &m_DeviceSink)
+        return RADIENT_STATUS_OK;
+
+    IShaderResourceBinding* const pResourceCacheSRB = Renderer.GetResourceCacheSRB();
+    if (pResourceCacheSRB == nullptr)
+        return RADIENT_STATUS_OUT_OF_DATE;
+
+    ITextureView* pColorRTV = Targets.GetColorRTV();
+    ITextureView* pDepthDSV = Targets.GetDepthDSV();
+    pContext->SetRenderTargets(1, &pColorRTV, pDepthDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Targets.SetViewport(pContext);
+
+    if (m_DeviceSink.Begin(Renderer, pContext, pResourceCacheSRB))
+        DrawSortedDrawables(Renderer, m_DeviceSink, View.BlendIDs, DrawStage::Main);
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientGeometryPass::ExecuteDepthPrepass(RadientGeometryRenderer&            Renderer,
+                                                        IRenderDevice*                      pDevice,
+                                                        IDeviceContext*                     pContext,
+                                                        const RadientGeometryViewDrawables& View,
+                                                        const RadientFrameRenderTargets&    Targets)
+{
+    // Invalidate the results of the previous pre-pass even if nothing is rendered
+    BeginDepthPrepass();
+
+    if (!m_EnableDepthPrepass || pDevice == nullptr || pContext == nullptr || View.DepthPrepassIDs.empty())
+        return RADIENT_STATUS_OK;
+
+    PBR_Renderer* const pRenderer = Renderer.GetRenderer();
+    if (pRenderer == nullptr || m_pSink != &m_DeviceSink || !m_DepthPrepassPSOCache)
+        return RADIENT_STATUS_OK;
+
+    IShaderResourceBinding* const pResourceCacheSRB = Renderer.GetResourceCacheSRB();
+    if (pResourceCacheSRB == nullptr)
+        return RADIENT_STATUS_OUT_OF_DATE;
+
+    ITextureView* pDepthDSV = Targets.GetDepthDSV();
+    if (pDepthDSV == nullptr)
+        return RADIENT_STATUS_OK;
+
+    CommitDepthPrepass(View);
+
+    pContext->SetRenderTargets(0, nullptr, pDepthDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Targets.SetViewport(pContext);
+
+    if (m_DeviceSink.Begin(Renderer, pContext, pResourceCacheSRB))
+        DrawSortedDrawables(Renderer, m_DeviceSink, View.DepthPrepassIDs, DrawStage::DepthPrepass);
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientGeometryPass::ExecuteShadowPass(RadientGeometryRenderer&         Renderer,
+                                                      IRenderDevice*                   pDevice,
+                                                      IDeviceContext*                  pContext,
+                                                      const RadientDrawLists&          DrawLists,
+                                                      const RadientSceneDrawableCache& DrawableCache)
+{
+    if (pDevice == nullptr || pContext == nullptr)
+        return RADIENT_STATUS_OK;
+
+    const RadientShadowCascades& Cascades  = Renderer.GetShadowCascades();
+    PBR_Renderer* const          pRenderer = Renderer.GetRenderer();
+    if (Cascades.GetCascadeCount() == 0 || pRenderer == nullptr || m_pSink != &m_DeviceSink || !m_ShadowPSOCache)
+        return RADIENT_STATUS_OK;
+
+    IShaderResourceBinding* const pShadowCacheSRB = Renderer.GetShadowResourceCacheSRB();
+    if (pShadowCacheSRB == nullptr)
+        return RADIENT_STATUS_OUT_OF_DATE;
+
+    const RadientDrawListCache::Entry& Casters = GetShadowCasters(DrawLists, DrawableCache, Renderer.GetViewLayerMask());
+
+    for (Uint32 Cascade = 0; Cascade < Cascades.GetCascadeCount(); ++Cascade)
+    {
+        ITextureView* pShadowMapDSV = Renderer.GetShadowMapDSV(Cascade);
+        if (pShadowMapDSV == nullptr)
+            continue;
+
+        // Cascades that have no casters must still be cleared
+        pContext->SetRenderTargets(0, nullptr, pShadowMapDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearDepthStencil(pShadowMapDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        CullShadowCasters(Cascades, Cascade, Casters.DrawableIDs);
+        if (m_ShadowCasterIDs.empty())
+            continue;
+
+        const RADIENT_STATUS Status = Renderer.WriteShadowCascadeAttribs(pContext, Cascade);
+        if (RADIENT_FAILED(Status))
+            return Status;
+
+        if (m_DeviceSink.Begin(Renderer, pContext, pShadowCacheSRB))
+            DrawSortedDrawables(Renderer, m_DeviceSink, m_ShadowCasterIDs, DrawStage::Shadow);
+    }
+
+    if (ITextureView* pShadowMapSRV = Renderer.GetShadowMapSRV())
+    {
+        StateTransitionDesc Barrier{pShadowMapSRV->GetTexture(), RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+
+    return RADIENT_STATUS_OK;
+}
+
+void RadientGeometryPass::RecordShadowPass(RadientGeometryRenderer&            Renderer,
+                                           const RadientDrawLists&             DrawLists,
+                                           const RadientSceneDrawableCache&    DrawableCache,
+                                           const RadientGeometryViewDrawables& View)
+{
+    const RadientShadowCascades& Cascades = Renderer.GetShadowCascades();
+    if (m_pSink == nullptr || !m_HasShadowPipelines || Cascades.GetCascadeCount() == 0)
+        return;
+
+    const RadientDrawListCache::Entry& Casters = GetShadowCasters(DrawLists, DrawableCache, View.LayerMask);
+    for (Uint32 Cascade = 0; Cascade < Cascades.GetCascadeCount(); ++Cascade)
+    {
+        CullShadowCasters(Cascades, Cascade, Casters.DrawableIDs);
+        DrawSortedDrawables(Renderer, *m_pSink, m_ShadowCasterIDs, DrawStage::Shadow);
+    }
+}
+
+void RadientGeometryPass::RecordDepthPrepass(RadientGeometryRenderer&            Renderer,
+                                             const RadientGeometryViewDrawables& View)
+{
+    // Invalidate the results of the previous pre-pass even if nothing is rendered
+    BeginDepthPrepass();
+
+    if (m_pSink == nullptr || !m_HasDepthPrepassPipelines || View.DepthPrepassIDs.empty())
+        return;
+
+    CommitDepthPrepass(View);
+    DrawSortedDrawables(Renderer, *m_pSink, View.DepthPrepassIDs, DrawStage::DepthPrepass);
+}
+
+void RadientGeometryPass::Record(RadientGeometryRenderer&            Renderer,
+                                 const RadientDrawList&              DrawList,
+                                 const RadientSceneDrawableCache&    DrawableCache,
+                                 const RadientGeometryViewDrawables& View)
+{
+    if (m_pSink == nullptr)
+        return;
+
+    DrawSortedDrawables(Renderer, *m_pSink, GetMainPassDrawableIDs(DrawList, DrawableCache, View, View.LayerMask), DrawStage::Main);
+}
+
+void RadientGeometryPass::RecordBlend(RadientGeometryRenderer&            Renderer,
+                                      const RadientGeometryViewDrawables& View)
+{
+    if (m_pSink == nullptr)
+        return;
+
+    DrawSortedDrawables(Renderer, *m_pSink, View.BlendIDs, DrawStage::Main);
+}
+
+IPipelineState* RadientGeometryPass::GetStagePSO(const DrawablePassData& PassData, DrawStage Stage) const
+{
+    if (Stage == DrawStage::Shadow)
+        return PassData.pShadowPSO;
+
+    if (Stage == DrawStage::DepthPrepass)
+    {
+        // Both PSOs must be ready: the main pass must not test against depth that was not written
+        return m_pSink->IsPipelineReady(PassData.pDepthPSO) && m_pSink->IsPipelineReady(PassData.pEarlyZPSO) ?
+            PassData.pDepthPSO :
+            nullptr;
+    }
+
+    return PassData.DepthPrepassIndex == m_DepthPrepassIndex && PassData.DepthPrepassIndex != 0 ?
+        PassData.pEarlyZPSO :
+        PassData.pPSO;
+}
+
+const std::vector<RadientDrawableID>& RadientGeometryPass::GetMainPassDrawableIDs(const RadientDrawList&              DrawList,
+                                                                                  const RadientSceneDrawableCache&    DrawableCache,
+                                                                                  const RadientGeometryViewDrawables& View,
+                                                                                  Uint64                              LayerMask)
+{
+    // Main pass PSOs and their readiness depend on the drawables rendered by the depth pre-pass
+    const RadientDrawList* const       pDrawList = &DrawList;
+    const RadientDrawListCache::Entry& StageList = GetStageDrawableIDs(pDrawList, &pDrawList, 1, DrawableCache, DrawStage::Main, RadientGeometryDrawOrder::State,
+                                                                       LayerMask, m_DepthPrepassBuildID);
+    if (View.OccludedDrawables.empty())
+        return StageList.DrawableIDs;
+
+    // Culling keeps the state order of the cached list
+    m_VisibleIDs.clear();
+    for (const RadientDrawableID DrawableID : StageList.DrawableIDs)
+    {
+        if (DrawableID >= View.OccludedDrawables.size() || View.OccludedDrawables[DrawableID] == 0)
+            m_VisibleIDs.push_back(DrawableID);
+    }
+    return m_VisibleIDs;
+}
+
+const RadientDrawListCache::Entry& RadientGeometryPass::GetShadowCasters(const RadientDrawLists&          DrawLists,
+                                                                         const RadientSceneDrawableCache& DrawableCache,
+                                                                         Uint64                           LayerMask)
+{
+    // Alpha-blended primitives do not cast shadows
+    const RadientDrawList* const CasterLists[] =
+        {
+            &DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE),
+            &DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_MASK),
+        };
+    return GetStageDrawableIDs(&DrawLists, CasterLists, _countof(CasterLists), DrawableCache, DrawStage::Shadow,
+                               RadientGeometryDrawOrder::State, LayerMask, 0);
+}
+
+void RadientGeometryPass::CullShadowCasters(const RadientShadowCascades&          Cascades,
+                                            Uint32                                Cascade,
+                                            const std::vector<RadientDrawableID>& DrawableIDs)
+{
+    // Culling keeps the state order of the cached caster list
+    m_ShadowCasterIDs.clear();
+    for (const RadientDrawableID DrawableID : DrawableIDs)
+    {
+        const RadientDrawableSlot& Drawable = *m_DrawablePassData[DrawableID].pDrawable;
+        if (Cascades.IsCasterVisible(Cascade, *Drawable.pWorldMatrix, Drawable.LocalBounds))
+            m_ShadowCasterIDs.push_back(DrawableID);
+    }
+}
+
+void RadientGeometryPass::BeginDepthPrepass()
+{
+    if (++m_DepthPrepassIndex == 0)
+        ++m_DepthPrepassIndex;
+    m_DepthPrepassBuildID = 0;
+}
+
+void RadientGeometryPass::CommitDepthPrepass(const RadientGeometryViewDrawables& View)
+{
+    for (const RadientDrawableID DrawableID : View.DepthPrepassIDs)
+        m_DrawablePassData[DrawableID].DepthPrepassIndex = m_DepthPrepassIndex;
+    m_DepthPrepassBuildID = View.DepthPrepassBuildID;
+}
+
+void RadientGeometryPass::DrawSortedDrawables(RadientGeometryRenderer&              Renderer,
+                                              IRadientGeometryCommandSink&          Sink,
+                                              const std::vector<RadientDrawableID>& DrawableIDs,
+                                              DrawStage                             Stage)
+{
+    if (DrawableIDs.empty())
+        return;
+
+    const PBR_Renderer::CreateInfo& Settings         = Renderer.GetSettings();
+    const RadientMaterialTable&     MaterialTable    = Renderer.GetMaterialTable();
+    RadientDrawRecordAllocator&     PrimitiveRecords = Renderer.GetPrimitiveRecordAllocator();
+
+    IPipelineState* pCurrPSO           = nullptr;
+    IVertexPool*    pCurrVertexPool    = nullptr;
+    Uint32          CurrMaterialOffset = ~0u;
+
+    // The primitive attributes of a batch of draws are written into the sink memory at once,
+    // and the batch is drawn when the buffer is full or the list ends.
+    Uint8* pBatchData     = nullptr;
+    size_t FirstBatchDraw = 0;
+    m_PrimitiveOffsets.clear();
+    PrimitiveRecords.Restart();
+
+    auto DrawBatch = [&](size_t EndDraw) {
+        if (pBatchData != nullptr)
+            Sink.EndPrimitiveBatch(PrimitiveRecords.GetBatchSize());
+        pBatchData = nullptr;
+
+        VERIFY_EXPR(EndDraw - FirstBatchDraw == m_PrimitiveOffsets.size());
+        for (size_t DrawIdx = FirstBatchDraw; DrawIdx < EndDraw; ++DrawIdx)
+        {
+            const RadientDrawableID    DrawableID = DrawableIDs[DrawIdx];
+            const DrawablePassData&    PassData   = m_DrawablePassData[DrawableID];
+            const RadientDrawableSlot& Drawable   = *PassData.pDrawable;
+            IPipelineState* const      pPSO       = GetStagePSO(PassData, Stage);
+
+            if (pCurrVertexPool != Drawable.pVertexPool)
+            {
+                pCurrVertexPool = Drawable.pVertexPool;
+                VERIFY(pCurrVertexPool != nullptr, "Sorted drawable references null vertex pool");
+                if (pCurrVertexPool != nullptr)
+                    Sink.SetVertexPool(pCurrVertexPool);
+            }
+
+            if (pCurrPSO != pPSO)
+            {
+                pCurrPSO = pPSO;
+                if (pCurrPSO != nullptr)
+                    Sink.SetPipelineState(pCurrPSO);
+            }
+
+            Sink.SetPrimitiveAttribsOffset(m_PrimitiveOffsets[DrawIdx - FirstBatchDraw]);
+
+            const Uint32 MaterialIndex = Stage != DrawStage::Main ? PassData.DepthMaterialIndex : PassData.MaterialIndex;
+            VERIFY(MaterialIndex != RadientMaterialTable::InvalidIndex, "Sorted drawable has no material table slot");
+            const Uint32 MaterialOffset = MaterialTable.GetSlotOffset(MaterialIndex);
+            if (CurrMaterialOffset != MaterialOffset)
+            {
+                Sink.SetMaterialAttribsOffset(MaterialOffset);
+                CurrMaterialOffset = MaterialOffset;
+            }
+
+            Sink.Draw(DrawableID, Drawable);
+        }
+
+        FirstBatchDraw = EndDraw;
+        m_PrimitiveOffsets.clear();
+        PrimitiveRecords.Restart();
+    };
+
+    for (size_t DrawIdx = 0; DrawIdx < DrawableIDs.size(); ++DrawIdx)
+    {
+        const RadientDrawableID DrawableID = DrawableIDs[DrawIdx];
+        VERIFY(DrawableID < m_DrawablePassData.size(), "Sorted drawable ID references invalid pass data");
+        const DrawablePassData& PassData = m_DrawablePassData[DrawableID];
+        VERIFY(PassData.pDrawable != nullptr &&
                    PassData.Generation == PassData.pDrawable->Generation &&
-                   IsPipelineReady(PassData.pPSO),
+                   Sink.IsPipelineReady(GetStagePSO(PassData, Stage)),
                "Sorted drawable ID references stale pass data");
 
-        const RadientDrawableSlot& Drawable = *PassData.pDrawable;
-        const GLTF::Material&      Material = *Drawable.pMaterial;
+        const PBR_Renderer::PSO_FLAGS PSOFlags   = Stage != DrawStage::Main ? PassData.DepthPSOFlags : PassData.PSOFlags;
+        const Uint32                  RecordSize = PBR_Renderer::GetPBRPrimitiveAttribsSize(Settings, PSOFlags);
+
+        Uint32 RecordOffset = PrimitiveRecords.Allocate(RecordSize);
+        if (RecordOffset == RadientDrawRecordAllocator::InvalidOffset)
+        {
+            // The buffer is full
+            DrawBatch(DrawIdx);
+            RecordOffset = PrimitiveRecords.Allocate(RecordSize);
+            if (RecordOffset == RadientDrawRecordAllocator::InvalidOffset)
+            {
+                UNEXPECTED("Primitive attribs buffer is too small to hold a single record");
+                return;
+            }
+        }
+
+        if (pBatchData == nullptr)
+        {
+            pBatchData = Sink.BeginPrimitiveBatch();
+            if (pBatchData == nullptr)
+            {
+                UNEXPECTED("Unable to begin primitive attribs batch");
+                return;
+            }
+        }
+
+        const float4x4 NodeTransform = RadientMath::ToFloat4x4(*PassData.pDrawable->pWorldMatrix);
+
+        void* pEndPtr = WriteRadientPrimitiveAttribs(pBatchData + RecordOffset, PSOFlags, NodeTransform, Settings.PackMatrixRowMajor);
+        VERIFY(static_cast<Uint8*>(pEndPtr) <= pBatchData + RecordOffset + RecordSize,
+               "Not enough space in the record to store primitive attributes");
+        (void)pEndPtr;
+
+        m_PrimitiveOffsets.push_back(RecordOffset);
+    }
+
+    DrawBatch(DrawableIDs.size());
+}
+
+bool RadientGeometryPass::DeviceCommandSink::Begin(RadientGeometryRenderer& Renderer,
+                                                   IDeviceContext*          pContext,
+                                                   IShaderResourceBinding*  pResourceCacheSRB)
+{
+    m_pContext            = pContext;
+    m_pResourceCacheSRB   = pResourceCacheSRB;
+    m_pPrimitiveAttribsCB = Renderer.GetRenderer()->GetPBRPrimitiveAttribsCB();
+    m_IsDynamicCB         = m_pPrimitiveAttribsCB->GetDesc().Usage == USAGE_DYNAMIC;
+    m_IsSRBCommitted      = false;
+
+    // Offsets are applied by the next draw command and do not require committing the SRB again
+    m_pPrimitiveAttribsVar = pResourceCacheSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbPrimitiveAttribs");
+    m_pMaterialAttribsVar  = pResourceCacheSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbMaterialAttribs");
+    if (m_pPrimitiveAttribsVar == nullptr || m_pMaterialAttribsVar == nullptr)
+    {
+        UNEXPECTED("Resource cache SRB has no primitive or material attribs variable");
+        return false;
+    }
+
+    return true;
+}
+
+IPipelineState* RadientGeometryPass::DeviceCommandSink::GetPipelineState(RadientGeometryPipelineType Type, const PBR_Renderer::PSOKey& Key)
+{
+    PBR_Renderer::PsoCacheAccessor::GET_FLAGS GetFlags = PBR_Renderer::PsoCacheAccessor::GET_FLAG_CREATE_IF_NULL;
+    if (m_Pass.m_EnableAsyncPipelineCompilation)
+        GetFlags |= PBR_Renderer::PsoCacheAccessor::GET_FLAG_ASYNC_COMPILE;
+
+    switch (Type)
+    {
+        case RadientGeometryPipelineType::Main: return m_Pass.m_PbrPSOCache.Get(Key, GetFlags);
+        case RadientGeometryPipelineType::EarlyZ: return m_Pass.m_EarlyZPSOCache.Get(Key, GetFlags);
+        case RadientGeometryPipelineType::DepthPrepass: return m_Pass.m_DepthPrepassPSOCache.Get(Key, GetFlags);
+        case RadientGeometryPipelineType::Shadow: return m_Pass.m_ShadowPSOCache.Get(Key, GetFlags);
+
+        default:
+            UNEXPECTED("Unexpected pipeline type");
+            return nullptr;
+    }
+}
+
+bool RadientGeometryPass::DeviceCommandSink::IsPipelineReady(IPipelineState* pPSO) const
+{
+    return IsPipelineStateReady(pPSO);
+}
+
+Uint8* RadientGeometryPass::DeviceCommandSink::BeginPrimitiveBatch()
+{
+    if (!m_IsDynamicCB)
+    {
+        m_Pass.m_PrimitiveAttribsData.resize(static_cast<size_t>(m_pPrimitiveAttribsCB->GetDesc().Size));
+        return m_Pass.m_PrimitiveAttribsData.data();
+    }
+
+    void* pMappedData = nullptr;
+    m_pContext->MapBuffer(m_pPrimitiveAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+    if (pMappedData == nullptr)
+        UNEXPECTED("Unable to map PBR primitive attribs buffer");
+    return static_cast<Uint8*>(pMappedData);
+}
+
+void RadientGeometryPass::DeviceCommandSink::EndPrimitiveBatch(Uint32 BatchSize)
+{
+    if (m_IsDynamicCB)
+    {
+        m_pContext->UnmapBuffer(m_pPrimitiveAttribsCB, MAP_WRITE);
+    }
+    else if (BatchSize > 0)
+    {
+        m_pContext->UpdateBuffer(m_pPrimitiveAttribsCB, 0, BatchSize, m_Pass.m_PrimitiveAttribsData.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        StateTransitionDesc Barrier{m_pPrimitiveAttribsCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        m_pContext->TransitionResourceStates(1, &Barrier);
+    }
+}
+
+void RadientGeometryPass::DeviceCommandSink::SetVertexPool(IVertexPool* pVertexPool)
+{
+    BindVertexPool(*pVertexPool, m_pContext);
+}
+
+void RadientGeometryPass::DeviceCommandSink::SetPipelineState(IPipelineState* pPSO)
+{
+    m_pContext->SetPipelineState(pPSO);
+
+    // All pipelines of the pass share the resource cache SRB
+    if (!m_IsSRBCommitted)
+    {
+        m_pContext->CommitShaderResources(m_pResourceCacheSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        m_IsSRBCommitted = true;
+    }
+}
+
+void RadientGeometryPass::DeviceCommandSink::SetPrimitiveAttribsOffset(Uint32 Offset)
+{
+    m_pPrimitiveAttribsVar->SetBufferOffset(Offset);
+}
+
+void RadientGeometryPass::DeviceCommandSink::SetMaterialAttribsOffset(Uint32 Offset)
+{
+    m_pMaterialAttribsVar->SetBufferOffset(Offset);
+}
+
+void RadientGeometryPass::DeviceCommandSink::Draw(RadientDrawableID DrawableID, const RadientDrawableSlot& Drawable)
+{
+    if (Drawable.IsIndexed)
+    {
+        DrawIndexedAttribs DrawAttrs{Drawable.ElementCount, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+        DrawAttrs.FirstIndexLocation = Drawable.FirstIndexLocation + Drawable.FirstElement;
+        DrawAttrs.BaseVertex         = Drawable.BaseVertex;
+        m_pContext->DrawIndexed(DrawAttrs);
+    }
+    else
+    {
+        DrawAttribs DrawAttrs{Drawable.ElementCount, DRAW_FLAG_VERIFY_ALL};
+        DrawAttrs.StartVertexLocation = Drawable.BaseVertex + Drawable.FirstElement;
+        m_pContext->Draw(DrawAttrs);
+    }
+}
+
+void RadientGeometryPass::DeviceCommandSink::DrawIndexedIndirect(IBuffer* pDrawArgs, Uint64 DrawArgsOffset, Uint32 MaxDrawCount, IBuffer* pDrawCounts, Uint64 DrawCountOffset)
+{
+    DrawIndexedIndirectAttribs DrawAttrs;
+    DrawAttrs.IndexType                        = VT_UINT32;
+    DrawAttrs.pAttribsBuffer                   = pDrawArgs;
+    DrawAttrs.DrawArgsOffset                   = DrawArgsOffset;
+    DrawAttrs.Flags                            = DRAW_FLAG_VERIFY_ALL;
+    DrawAttrs.DrawCount                        = MaxDrawCount;
+    DrawAttrs.DrawArgsStride                   = RadientIndirectDrawList::DrawArgsStride;
+    DrawAttrs.AttribsBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_VERIFY;
+    DrawAttrs.pCounterBuffer                   = pDrawCounts;
+    DrawAttrs.CounterOffset                    = DrawCountOffset;
+    DrawAttrs.CounterBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_VERIFY;
+    m_pContext->DrawIndexedIndirect(DrawAttrs);
+}
+
+RADIENT_STATUS RadientGeometryPass::CreateIndirectCullResources(IRenderDevice* pDevice)
+{
+    ShaderCreateInfo ShaderCI{
+        "CullIndirectDraws.csh",
+        &DiligentFXShaderSourceStreamFactory::GetInstance(),
+        "main",
+        {},
+        SHADER_SOURCE_LANGUAGE_HLSL,
+        {"Radient cull indirect draws CS", SHADER_TYPE_COMPUTE, true},
+    };
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient indirect draw culling shader");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    ComputePipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name                               = "Radient cull indirect draws PSO";
+    PsoCI.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PsoCI.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PsoCI, &pPSO);
+    if (!pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient indirect draw culling PSO");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    RefCntAutoPtr<IBuffer> pAttribsCB;
+    CreateUniformBuffer(pDevice, sizeof(HLSL::RadientIndirectCullAttribs), "Radient indirect cull attribs buffer", &pAttribsCB);
+    if (!pAttribsCB)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient indirect cull attribs buffer");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    if (!pSRB)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient indirect draw culling SRB");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+    if (IShaderResourceVariable* pVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "cbCullAttribs"))
+        pVar->Set(pAttribsCB);
+
+    m_pIndirectCullPSO       = std::move(pPSO);
+    m_pIndirectCullSRB       = std::move(pSRB);
+    m_pIndirectCullAttribsCB = std::move(pAttribsCB);
 
-        if (pCurrVertexPool != Drawable.pVertexPool)
+    return RADIENT_STATUS_OK;
+}
+
+const RadientGeometryPass::IndirectDrawBuffers* RadientGeometryPass::CullIndirectDraws(RadientGeometryRenderer&              Renderer,
+                                                                                        IRenderDevice*                        pDevice,
+                                                                                        IDeviceContext*                       pContext,
+                                                                                        const RadientDrawList&                DrawList,
+                                                                                        const std::vector<RadientDrawableID>& DrawableIDs)
+{
+    m_IndirectDrawItems.clear();
+    m_IndirectDrawIDs.clear();
+    m_IndirectDrawStates.clear();
+    m_DirectDrawIDs.clear();
+
+    // The list is sorted by state, so drawables with the same PSO and vertex pool are adjacent
+    for (const RadientDrawableID DrawableID : DrawableIDs)
+    {
+        const DrawablePassData&    PassData = m_DrawablePassData[DrawableID];
+        const RadientDrawableSlot& Drawable = *PassData.pDrawable;
+        if (!Drawable.IsIndexed)
         {
-            pCurrVertexPool = Drawable.pVertexPool;
-            VERIFY(pCurrVertexPool != nullptr, "Sorted drawable references null vertex pool");
-            if (pCurrVertexPool != nullptr)
-                BindVertexPool(*pCurrVertexPool, pContext);
+            m_DirectDrawIDs.push_back(DrawableID);
+            continue;
         }
 
-        const PBR_Renderer::PSO_FLAGS PSOFlags = PassData.PSOFlags;
-        if (pCurrPSO != PassData.pPSO)
-        {
-            pCurrPSO      = PassData.pPSO;
-            pCurrMaterial = nullptr;
+        const std::pair<IPipelineState*, IVertexPool*> State{GetStagePSO(PassData, DrawStage::Main), Drawable.pVertexPool};
+        if (m_IndirectDrawStates.empty() || m_IndirectDrawStates.back() != State)
+            m_IndirectDrawStates.push_back(State);
+
+        RadientIndirectDrawItem Item;
+        Item.StateIndex    = static_cast<Uint32>(m_IndirectDrawStates.size() - 1);
+        Item.MaterialIndex = PassData.MaterialIndex;
+        Item.IndexCount    = Drawable.ElementCount;
+        Item.FirstIndex    = Drawable.FirstIndexLocation + Drawable.FirstElement;
+        Item.BaseVertex    = Drawable.BaseVertex;
+        Item.Bounds        = GetWorldBounds(*Drawable.pWorldMatrix, Drawable.LocalBounds);
+        m_IndirectDrawItems.push_back(Item);
+        m_IndirectDrawIDs.push_back(DrawableID);
+    }
+    if (m_IndirectDrawItems.empty())
+        return nullptr;
 
-            if (pCurrPSO != nullptr)
-                pContext->SetPipelineState(pCurrPSO);
+    IndirectDrawBuffers* pBuffers = nullptr;
+    for (IndirectDrawBuffers& Buffers : m_IndirectDrawBuffers)
+    {
+        if (Buffers.pDrawList == &DrawList)
+        {
+            pBuffers = &Buffers;
+            break;
         }
+    }
+    if (pBuffers == nullptr)
+    {
+        m_IndirectDrawBuffers.emplace_back();
+        pBuffers            = &m_IndirectDrawBuffers.back();
+        pBuffers->pDrawList = &DrawList;
+    }
+
+    RadientIndirectDrawList& Draws = pBuffers->Draws;
 
-        if (pCurrSRB != pResourceCacheSRB)
+    bool UploadRecords = Draws.Build(m_IndirectDrawItems, Renderer.GetIndirectDrawBucketSize());
+    bool ArgsRecreated = false;
+
+    const Uint32 DrawCount   = Draws.GetDrawCount();
+    const Uint32 BucketCount = Draws.GetBucketCount();
+    if (!PrepareGrowableBuffer(pDevice, "Radient indirect draw records buffer", sizeof(HLSL::RadientIndirectDrawRecord), DrawCount,
+                               BIND_SHADER_RESOURCE, BUFFER_MODE_STRUCTURED, pBuffers->pRecords, UploadRecords) ||
+        !PrepareGrowableBuffer(pDevice, "Radient indirect draw args buffer", sizeof(Uint32), DrawCount * RADIENT_INDIRECT_DRAW_ARGS_WORDS,
+                               BIND_UNORDERED_ACCESS | BIND_INDIRECT_DRAW_ARGS, BUFFER_MODE_RAW, pBuffers->pDrawArgs, ArgsRecreated) ||
+        !PrepareGrowableBuffer(pDevice, "Radient indirect draw counts buffer", sizeof(Uint32), BucketCount,
+                               BIND_UNORDERED_ACCESS | BIND_INDIRECT_DRAW_ARGS, BUFFER_MODE_RAW, pBuffers->pDrawCounts, ArgsRecreated))
+    {
+        // Records are uploaded again once the buffers are created
+        Draws.Clear();
+        m_DirectDrawIDs = DrawableIDs;
+        return nullptr;
+    }
+
+    if (UploadRecords)
+        pContext->UpdateBuffer(pBuffers->pRecords, 0, Draws.GetRecordsSize(), Draws.GetRecords().data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    if (m_ZeroDrawCounts.size() < BucketCount)
+        m_ZeroDrawCounts.resize(BucketCount, 0);
+    pContext->UpdateBuffer(pBuffers->pDrawCounts, 0, Draws.GetDrawCountsSize(), m_ZeroDrawCounts.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    {
+        MapHelper<HLSL::RadientIndirectCullAttribs> CullAttribs{pContext, m_pIndirectCullAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        *CullAttribs             = Renderer.GetViewCullAttribs();
+        CullAttribs->RecordCount = DrawCount;
+    }
+
+    auto SetCullVariable = [this](const char* Name, IDeviceObject* pObject) {
+        if (IShaderResourceVariable* pVar = m_pIndirectCullSRB->GetVariableByName(SHADER_TYPE_COMPUTE, Name))
+            pVar->Set(pObject);
+    };
+    SetCullVariable("g_DrawRecords", pBuffers->pRecords->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    SetCullVariable("g_DrawArgs", pBuffers->pDrawArgs->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    SetCullVariable("g_DrawCounts", pBuffers->pDrawCounts->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    pContext->SetPipelineState(m_pIndirectCullPSO);
+    pContext->CommitShaderResources(m_pIndirectCullSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->DispatchCompute({(DrawCount + RadientIndirectDrawList::CullGroupSize - 1) / RadientIndirectDrawList::CullGroupSize, 1});
+
+    StateTransitionDesc Barriers[] = {
+        {pBuffers->pDrawArgs, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_INDIRECT_ARGUMENT, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pBuffers->pDrawCounts, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_INDIRECT_ARGUMENT, STATE_TRANSITION_FLAG_UPDATE_STATE},
+    };
+    pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+
+    return pBuffers;
+}
+
+void RadientGeometryPass::DrawIndirectBuckets(RadientGeometryRenderer&     Renderer,
+                                              IRadientGeometryCommandSink& Sink,
+                                              const IndirectDrawBuffers&   Buffers)
+{
+    const RadientIndirectDrawList&                      Draws   = Buffers.Draws;
+    const std::vector<RadientIndirectDrawList::Bucket>& Buckets = Draws.GetBuckets();
+    if (Buckets.empty())
+        return;
+
+    const PBR_Renderer::CreateInfo& Settings         = Renderer.GetSettings();
+    const RadientMaterialTable&     MaterialTable    = Renderer.GetMaterialTable();
+    RadientDrawRecordAllocator&     PrimitiveRecords = Renderer.GetPrimitiveRecordAllocator();
+
+    IPipelineState* pCurrPSO           = nullptr;
+    IVertexPool*    pCurrVertexPool    = nullptr;
+    Uint32          CurrMaterialOffset = ~0u;
+
+    // The records of all draws of a bucket are consecutive, and the shaders index them with the draw index
+    Uint8* pBatchData       = nullptr;
+    size_t FirstBatchBucket = 0;
+    m_PrimitiveOffsets.clear();
+    PrimitiveRecords.Restart();
+
+    auto DrawBatch = [&](size_t EndBucket) {
+        if (pBatchData != nullptr)
+            Sink.EndPrimitiveBatch(PrimitiveRecords.GetBatchSize());
+        pBatchData = nullptr;
+
+        VERIFY_EXPR(EndBucket - FirstBatchBucket == m_PrimitiveOffsets.size());
+        for (size_t BucketIdx = FirstBatchBucket; BucketIdx < EndBucket; ++BucketIdx)
         {
-            pCurrSRB = pResourceCacheSRB;
-            pContext->CommitShaderResources(pCurrSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            const RadientIndirectDrawList::Bucket&          DrawBucket = Buckets[BucketIdx];
+            const std::pair<IPipelineState*, IVertexPool*>& State      = m_IndirectDrawStates[DrawBucket.StateIndex];
+
+            if (pCurrVertexPool != State.second)
+            {
+                pCurrVertexPool = State.second;
+                VERIFY(pCurrVertexPool != nullptr, "Indirect draw references null vertex pool");
+                if (pCurrVertexPool != nullptr)
+                    Sink.SetVertexPool(pCurrVertexPool);
+            }
+
+            if (pCurrPSO != State.first)
+            {
+                pCurrPSO = State.first;
+                if (pCurrPSO != nullptr)
+                    Sink.SetPipelineState(pCurrPSO);
+            }
+
+            Sink.SetPrimitiveAttribsOffset(m_PrimitiveOffsets[BucketIdx - FirstBatchBucket]);
+
+            const Uint32 MaterialOffset = MaterialTable.GetSlotOffset(DrawBucket.MaterialIndex);
+            if (CurrMaterialOffset != MaterialOffset)
+            {
+                Sink.SetMaterialAttribsOffset(MaterialOffset);
+                CurrMaterialOffset = MaterialOffset;
+            }
+
+            Sink.DrawIndexedIndirect(Buffers.pDrawArgs, RadientIndirectDrawList::GetDrawArgsOffset(DrawBucket), DrawBucket.DrawCount,
+                                     Buffers.pDrawCounts, RadientIndirectDrawList::GetDrawCountOffset(static_cast<Uint32>(BucketIdx)));
         }
 
-        WritePrimitiveAttribs(*pRenderer, pContext, PSOFlags, *Drawable.pWorldMatrix);
+        FirstBatchBucket = EndBucket;
+        m_PrimitiveOffsets.clear();
+        PrimitiveRecords.Restart();
+    };
+
+    for (size_t BucketIdx = 0; BucketIdx < Buckets.size(); ++BucketIdx)
+    {
+        const RadientIndirectDrawList::Bucket& DrawBucket = Buckets[BucketIdx];
+
+        // All draws of a bucket share the PSO, so they have the same flags and record size
+        const PBR_Renderer::PSO_FLAGS PSOFlags   = m_DrawablePassData[m_IndirectDrawIDs[Draws.GetDrawItem(DrawBucket.FirstDraw)]].PSOFlags;
+        const Uint32                  RecordSize = PBR_Renderer::GetPBRPrimitiveAttribsSize(Settings, PSOFlags);
 
-        if (pCurrMaterial != &Material)
+        Uint32 RecordOffset = PrimitiveRecords.Allocate(RecordSize * DrawBucket.DrawCount);
+        if (RecordOffset == RadientDrawRecordAllocator::InvalidOffset)
         {
-            WriteMaterialAttribs(*pRenderer, pContext, PSOFlags, Material);
-            pCurrMaterial = &Material;
+            // The buffer is full
+            DrawBatch(BucketIdx);
+            RecordOffset = PrimitiveRecords.Allocate(RecordSize * DrawBucket.DrawCount);
+            if (RecordOffset == RadientDrawRecordAllocator::InvalidOffset)
+            {
+                UNEXPECTED("Primitive attribs buffer is too small to hold the records of a bucket");
+                return;
+            }
         }
 
-        if (Drawable.IsIndexed)
+        if (pBatchData == nullptr)
         {
-            DrawIndexedAttribs DrawAttrs{Drawable.ElementCount, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
-            DrawAttrs.FirstIndexLocation = Drawable.FirstIndexLocation + Drawable.FirstElement;
-            DrawAttrs.BaseVertex         = Drawable.BaseVertex;
-            pContext->DrawIndexed(DrawAttrs);
+            pBatchData = Sink.BeginPrimitiveBatch();
+            if (pBatchData == nullptr)
+            {
+                UNEXPECTED("Unable to begin primitive attribs batch");
+                return;
+            }
         }
-        else
+
+        for (Uint32 Slot = 0; Slot < DrawBucket.DrawCount; ++Slot)
         {
-            DrawAttribs DrawAttrs{Drawable.ElementCount, DRAW_FLAG_VERIFY_ALL};
-            DrawAttrs.StartVertexLocation = Drawable.BaseVertex + Drawable.FirstElement;
-            pContext->Draw(DrawAttrs);
+            const DrawablePassData& PassData = m_DrawablePassData[m_IndirectDrawIDs[Draws.GetDrawItem(DrawBucket.FirstDraw + Slot)]];
+            VERIFY(PassData.PSOFlags == PSOFlags, "Draws of an indirect bucket must have the same PSO flags");
+
+            const float4x4 NodeTransform = RadientMath::ToFloat4x4(*PassData.pDrawable->pWorldMatrix);
+
+            Uint8* const pRecord = pBatchData + RecordOffset + Slot * RecordSize;
+            void*        pEndPtr = WriteRadientPrimitiveAttribs(pRecord, PSOFlags, NodeTransform, Settings.PackMatrixRowMajor);
+            VERIFY(static_cast<Uint8*>(pEndPtr) <= pRecord + RecordSize,
+                   "Not enough space in the record to store primitive attributes");
+            (void)pEndPtr;
         }
+
+        m_PrimitiveOffsets.push_back(RecordOffset);
     }
 
-    return RADIENT_STATUS_OK;
+    DrawBatch(Buckets.size());
 }
 
-void RadientGeometryPass::BuildSortedDrawableIDs(const RadientDrawList&           DrawList,
-                                                 const RadientSceneDrawableCache& DrawableCache)
+const RadientDrawListCache::Entry& RadientGeometryPass::GetStageDrawableIDs(const void*                      pSource,
+                                                                            const RadientDrawList* const*    ppDrawLists,
+                                                                            Uint32                           NumDrawLists,
+                                                                            const RadientSceneDrawableCache& DrawableCache,
+                                                                            DrawStage                        Stage,
+                                                                            RadientGeometryDrawOrder         DrawOrder,
+                                                                            Uint64                           LayerMask,
+                                                                            Uint64                           Dependency)
 {
-    m_SortedDrawableIDs.clear();
-    m_SortedDrawableIDs.reserve(DrawList.GetItemCount());
+    const RadientDrawListCache::Key Key{pSource, LayerMask, static_cast<Uint32>(Stage)};
 
-    for (const RadientDrawItem& DrawItem : DrawList.GetItems())
+    bool                         IsValid   = false;
+    RadientDrawListCache::Entry& StageList = m_DrawListCache.Get(Key, Dependency, IsValid);
+    if (IsValid)
+        return StageList;
+
+    for (Uint32 i = 0; i < NumDrawLists; ++i)
     {
-        const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(DrawItem.DrawableID);
-        if (pDrawable == nullptr ||
-            pDrawable->pMaterial == nullptr ||
-            pDrawable->pVertexPool == nullptr)
-        {
-            continue;
-        }
+        if (!AddStageDrawableIDs(*ppDrawLists[i], DrawableCache, Stage, LayerMask, StageList.DrawableIDs))
+            StageList.IsComplete = false;
+    }
 
-        if (pDrawable->pWorldMatrix == nullptr ||
-            pDrawable->pEffectiveVisible == nullptr ||
-            !*pDrawable->pEffectiveVisible)
-        {
-            continue;
-        }
+    if (DrawOrder == RadientGeometryDrawOrder::State)
+        SortDrawableIDsByState(StageList.DrawableIDs, Stage);
 
-        if (pDrawable->ElementCount == 0)
-            continue;
+    return StageList;
+}
 
-        if (DrawItem.DrawableID >= m_DrawablePassData.size())
-            continue;
+bool RadientGeometryPass::AddStageDrawableIDs(const RadientDrawList&           DrawList,
+                                              const RadientSceneDrawableCache& DrawableCache,
+                                              DrawStage                        Stage,
+                                              Uint64                           LayerMask,
+                                              std::vector<RadientDrawableID>&  DrawableIDs) const
+{
+    // The layer mask test only reads the contiguous mask column of the draw list,
+    // the remaining tests only touch the drawables that passed it.
+    const size_t FirstID = DrawableIDs.size();
+    DrawList.FilterByLayerMask(LayerMask, DrawableIDs);
+
+    bool IsComplete = true;
+
+    const auto RemoveIt = std::remove_if(
+        DrawableIDs.begin() + FirstID, DrawableIDs.end(),
+        [&](RadientDrawableID DrawableID) {
+            const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(DrawableID);
+            if (pDrawable == nullptr ||
+                pDrawable->pMaterial == nullptr ||
+                pDrawable->pVertexPool == nullptr)
+            {
+                return true;
+            }
 
-        const DrawablePassData& PassData = m_DrawablePassData[DrawItem.DrawableID];
-        if (PassData.pDrawable != pDrawable ||
-            PassData.Generation != pDrawable->Generation ||
-            !IsPipelineReady(PassData.pPSO))
-        {
-            continue;
-        }
+            if (pDrawable->pWorldMatrix == nullptr ||
+                pDrawable->pEffectiveVisible == nullptr ||
+                !*pDrawable->pEffectiveVisible)
+            {
+                return true;
+            }
 
-        m_SortedDrawableIDs.push_back(DrawItem.DrawableID);
-    }
+            if (pDrawable->ElementCount == 0)
+                return true;
+
+            if (Stage == DrawStage::Shadow &&
+                pDrawable->pRenderer != nullptr &&
+                !pDrawable->pRenderer->CastShadows)
+            {
+                return true;
+            }
+
+            if (DrawableID >= m_DrawablePassData.size())
+                return true;
+
+            const DrawablePassData& PassData = m_DrawablePassData[DrawableID];
+            if (PassData.pDrawable != pDrawable ||
+                PassData.Generation != pDrawable->Generation)
+            {
+                return true;
+            }
+
+            if (!m_pSink->IsPipelineReady(GetStagePSO(PassData, Stage)))
+            {
+                IsComplete = false;
+                return true;
+            }
+
+            return false;
+        });
+    DrawableIDs.erase(RemoveIt, DrawableIDs.end());
+
+    return IsComplete;
+}
 
-    std::sort(m_SortedDrawableIDs.begin(), m_SortedDrawableIDs.end(),
-              [this](RadientDrawableID LhsDrawableID, RadientDrawableID RhsDrawableID) {
+void RadientGeometryPass::SortDrawableIDsByState(std::vector<RadientDrawableID>& DrawableIDs,
+                                                 DrawStage                       Stage) const
+{
+    std::sort(DrawableIDs.begin(), DrawableIDs.end(),
+              [this, Stage](RadientDrawableID LhsDrawableID, RadientDrawableID RhsDrawableID) {
                   VERIFY(LhsDrawableID < m_DrawablePassData.size() &&
                              RhsDrawableID < m_DrawablePassData.size(),
                          "Sorted drawable ID references missing pass data");
 
                   const DrawablePassData& LhsPassData = m_DrawablePassData[LhsDrawableID];
                   const DrawablePassData& RhsPassData = m_DrawablePassData[RhsDrawableID];
+                  IPipelineState* const   pLhsPSO     = GetStagePSO(LhsPassData, Stage);
+                  IPipelineState* const   pRhsPSO     = GetStagePSO(RhsPassData, Stage);
                   VERIFY((LhsPassData.pDrawable != nullptr &&
                           RhsPassData.pDrawable != nullptr &&
                           LhsPassData.Generation == LhsPassData.pDrawable->Generation &&
                           RhsPassData.Generation == RhsPassData.pDrawable->Generation &&
-                          IsPipelineReady(LhsPassData.pPSO) &&
-                          IsPipelineReady(RhsPassData.pPSO)),
+                          m_pSink->IsPipelineReady(pLhsPSO) &&
+                          m_pSink->IsPipelineReady(pRhsPSO)),
                          "Sorted drawable ID references stale pass data");
 
-                  if (LhsPassData.pPSO != RhsPassData.pPSO)
-                      return std::less<IPipelineState*>{}(LhsPassData.pPSO, RhsPassData.pPSO);
+                  if (pLhsPSO != pRhsPSO)
+                      return std::less<IPipelineState*>{}(pLhsPSO, pRhsPSO);
 
                   if (LhsPassData.pDrawable->pVertexPool != RhsPassData.pDrawable->pVertexPool)
                       return std::less<IVertexPool*>{}(LhsPassData.pDrawable->pVertexPool, RhsPassData.pDrawable->pVertexPool);
@@ -1049,15 +2594,75 @@ void RadientGeometryPass::BuildSortedDrawableIDs(const RadientDrawList&
               });
 }
 
-void RadientGeometryPass::SyncDrawablePassData(PBR_Renderer&                    Renderer,
+void RadientGeometryPass::SortDrawableIDsByDepth(std::vector<RadientDrawableID>& DrawableIDs,
+                                                 RadientGeometryDrawOrder        DrawOrder,
+                                                 const RadientFloat4&            ViewDepthPlane,
+                                                 DrawStage                       Stage,
+                                                 RadientDepthSorter&             DepthSorter,
+                                                 std::vector<IPipelineState*>&   SortPSOs) const
+{
+    VERIFY_EXPR(DrawOrder == RadientGeometryDrawOrder::BackToFront || DrawOrder == RadientGeometryDrawOrder::FrontToBack);
+
+    // Primitives in the same depth bucket are grouped by the PSO rank to reduce pipeline switches.
+    SortPSOs.clear();
+    for (const RadientDrawableID DrawableID : DrawableIDs)
+        SortPSOs.push_back(GetStagePSO(m_DrawablePassData[DrawableID], Stage));
+
+    std::sort(SortPSOs.begin(), SortPSOs.end(), std::less<IPipelineState*>{});
+    SortPSOs.erase(std::unique(SortPSOs.begin(), SortPSOs.end()), SortPSOs.end());
+
+    DepthSorter.Clear();
+    DepthSorter.Reserve(DrawableIDs.size());
+    for (const RadientDrawableID DrawableID : DrawableIDs)
+    {
+        const DrawablePassData&    PassData = m_DrawablePassData[DrawableID];
+        const RadientDrawableSlot& Drawable = *PassData.pDrawable;
+        IPipelineState* const      pPSO     = GetStagePSO(PassData, Stage);
+
+        float ViewDepth = RadientDepthSorter::GetViewDepth(ViewDepthPlane, *Drawable.pWorldMatrix, Drawable.LocalBounds);
+
+        Uint32 DepthKey = 0;
+        if (DrawOrder == RadientGeometryDrawOrder::BackToFront)
+        {
+            if (Drawable.pRenderer != nullptr)
+                ViewDepth += Drawable.pRenderer->SortBias;
+            DepthKey = RadientDepthSorter::GetBackToFrontKey(ViewDepth);
+        }
+        else
+        {
+            DepthKey = RadientDepthSorter::GetFrontToBackKey(ViewDepth);
+        }
+
+        const auto PSOIt = std::lower_bound(SortPSOs.begin(), SortPSOs.end(), pPSO, std::less<IPipelineState*>{});
+        VERIFY_EXPR(PSOIt != SortPSOs.end() && *PSOIt == pPSO);
+
+        DepthSorter.Add(DepthKey, static_cast<Uint32>(PSOIt - SortPSOs.begin()), DrawableID);
+    }
+
+    DepthSorter.Sort(DrawableIDs);
+}
+
+void RadientGeometryPass::SyncDrawablePassData(const PBR_Renderer::CreateInfo&  Settings,
+                                               RadientMaterialTable&            MaterialTable,
                                                const RadientSceneDrawableCache& DrawableCache,
                                                bool                             RebuildAll)
 {
-    if (!m_PbrPSOCache)
+    if (m_pSink == nullptr)
+        return;
+
+    // Drawable changes are only applied once per scene sync, so that the views of a multi-view
+    // render call prepare the pass for their targets without redoing the work.
+    if (!RebuildAll && m_DrawListRevision == DrawableCache.GetDrawListRevision())
         return;
 
+    // Cached stage lists reference the draw list membership and the pass data PSOs
+    m_DrawListCache.Invalidate();
+    m_DrawListRevision = DrawableCache.GetDrawListRevision();
+
     if (RebuildAll)
     {
+        for (RadientDrawableID DrawableID = 0; DrawableID < m_DrawablePassData.size(); ++DrawableID)
+            InvalidateDrawablePassData(MaterialTable, DrawableID);
         m_DrawablePassData.clear();
 
         const std::array<GLTF::Material::ALPHA_MODE, 3> AlphaModes =
@@ -1073,7 +2678,7 @@ void RadientGeometryPass::SyncDrawablePassData(PBR_Renderer&
             {
                 const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(DrawItem.DrawableID);
                 if (pDrawable != nullptr)
-                    UpdateDrawablePassData(Renderer, *pDrawable, DrawItem.DrawableID);
+                    UpdateDrawablePassData(Settings, MaterialTable, *pDrawable, DrawItem.DrawableID);
             }
         }
         return;
@@ -1083,20 +2688,21 @@ void RadientGeometryPass::SyncDrawablePassData(PBR_Renderer&
     {
         if (Change.Type == RadientDrawableChangeType::Removed)
         {
-            InvalidateDrawablePassData(Change.DrawableID);
+            InvalidateDrawablePassData(MaterialTable, Change.DrawableID);
             continue;
         }
 
         if (const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(Change.DrawableID))
-            UpdateDrawablePassData(Renderer, *pDrawable, Change.DrawableID);
+            UpdateDrawablePassData(Settings, MaterialTable, *pDrawable, Change.DrawableID);
         else
-            InvalidateDrawablePassData(Change.DrawableID);
+            InvalidateDrawablePassData(MaterialTable, Change.DrawableID);
     }
 }
 
-void RadientGeometryPass::UpdateDrawablePassData(PBR_Renderer&              Renderer,
-                                                 const RadientDrawableSlot& Drawable,
-                                                 RadientDrawableID          DrawableID)
+void RadientGeometryPass::UpdateDrawablePassData(const PBR_Renderer::CreateInfo& Settings,
+                                                 RadientMaterialTable&           MaterialTable,
+                                                 const RadientDrawableSlot&      Drawable,
+                                                 RadientDrawableID               DrawableID)
 {
     if (DrawableID == InvalidRadientDrawableID)
         return;
@@ -1104,51 +2710,87 @@ void RadientGeometryPass::UpdateDrawablePassData(PBR_Renderer&              Rend
     if (DrawableID >= m_DrawablePassData.size())
         m_DrawablePassData.resize(static_cast<size_t>(DrawableID) + 1);
 
-    DrawablePassData& PassData = m_DrawablePassData[DrawableID];
     if (Drawable.pMaterial == nullptr)
     {
-        PassData = {};
+        InvalidateDrawablePassData(MaterialTable, DrawableID);
         return;
     }
 
-    const GLTF::Material&            Material  = *Drawable.pMaterial;
-    const GLTF::Material::ALPHA_MODE AlphaMode = static_cast<GLTF::Material::ALPHA_MODE>(Material.Attribs.AlphaMode);
+    DrawablePassData& PassData = m_DrawablePassData[DrawableID];
 
-    PBR_Renderer::PSO_FLAGS PSOFlags = Drawable.VertexAttribFlags | GetMaterialPSOFlags(Renderer, Material);
-    PSOFlags |=
-        PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS |
-        PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
-        PBR_Renderer::PSO_FLAG_CONVERT_OUTPUT_TO_SRGB |
-        PBR_Renderer::PSO_FLAG_USE_IBL |
-        PBR_Renderer::PSO_FLAG_USE_LIGHTS;
-    PSOFlags &= m_RenderFlags;
+    // The slots of the previous material are released after the new slots are acquired,
+    // so that the slots of an unchanged material are not rewritten.
+    const Uint32 PrevMaterialIndex      = PassData.MaterialIndex;
+    const Uint32 PrevDepthMaterialIndex = PassData.DepthMaterialIndex;
 
-    const PBR_Renderer::PSOKey PsoKey{
-        PBR_Renderer::RenderPassType::Main,
-        PSOFlags,
-        ToPBRAlphaMode(AlphaMode),
-        Material.DoubleSided ? CULL_MODE_NONE : CULL_MODE_BACK,
-        PBR_Renderer::DebugViewType::None,
-    };
+    const GLTF::Material&            Material  = *Drawable.pMaterial;
+    const GLTF::Material::ALPHA_MODE AlphaMode = static_cast<GLTF::Material::ALPHA_MODE>(Material.Attribs.AlphaMode);
 
-    PBR_Renderer::PsoCacheAccessor::GET_FLAGS GetFlags =
-        PBR_Renderer::PsoCacheAccessor::GET_FLAG_CREATE_IF_NULL;
-    if (m_EnableAsyncPipelineCompilation)
-    {
-        GetFlags |= PBR_Renderer::PsoCacheAccessor::GET_FLAG_ASYNC_COMPILE;
-    }
+    const PBR_Renderer::PSOKey    PsoKey   = GetRadientMainPassPSOKey(Settings, m_RenderFlags, Drawable.VertexAttribFlags, Material);
+    const PBR_Renderer::PSO_FLAGS PSOFlags = PsoKey.GetFlags();
 
     PassData.pDrawable  = &Drawable;
     PassData.Generation = Drawable.Generation;
     PassData.PSOFlags   = PSOFlags;
-    PassData.pPSO       = m_PbrPSOCache.Get(PsoKey, GetFlags);
+    PassData.pPSO       = m_pSink->GetPipelineState(RadientGeometryPipelineType::Main, PsoKey);
     VERIFY_EXPR(PassData.pPSO != nullptr);
+
+    PassData.DepthPSOFlags      = PBR_Renderer::PSO_FLAG_NONE;
+    PassData.pDepthPSO          = nullptr;
+    PassData.pEarlyZPSO         = nullptr;
+    PassData.pShadowPSO         = nullptr;
+    PassData.DepthMaterialIndex = RadientMaterialTable::InvalidIndex;
+    PassData.DepthPrepassIndex  = 0;
+    if (AlphaMode != GLTF::Material::ALPHA_MODE_BLEND)
+    {
+        // Shadow casters use the same depth-only PSO keys as the depth pre-pass
+        const PBR_Renderer::PSOKey DepthPsoKey = GetRadientDepthPrepassPSOKey(PsoKey);
+        if (m_HasDepthPrepassPipelines)
+        {
+            PassData.pDepthPSO  = m_pSink->GetPipelineState(RadientGeometryPipelineType::DepthPrepass, DepthPsoKey);
+            PassData.pEarlyZPSO = m_pSink->GetPipelineState(RadientGeometryPipelineType::EarlyZ, PsoKey);
+            VERIFY_EXPR(PassData.pDepthPSO != nullptr && PassData.pEarlyZPSO != nullptr);
+        }
+        if (m_HasShadowPipelines)
+        {
+            PassData.pShadowPSO = m_pSink->GetPipelineState(RadientGeometryPipelineType::Shadow, DepthPsoKey);
+            VERIFY_EXPR(PassData.pShadowPSO != nullptr);
+        }
+        PassData.DepthPSOFlags      = DepthPsoKey.GetFlags();
+        PassData.DepthMaterialIndex = AcquireMaterialSlot(Settings, MaterialTable, Material, PassData.DepthPSOFlags);
+    }
+    PassData.MaterialIndex = AcquireMaterialSlot(Settings, MaterialTable, Material, PSOFlags);
+
+    MaterialTable.Release(PrevMaterialIndex);
+    MaterialTable.Release(PrevDepthMaterialIndex);
+}
+
+Uint32 RadientGeometryPass::AcquireMaterialSlot(const PBR_Renderer::CreateInfo& Settings,
+                                                RadientMaterialTable&           MaterialTable,
+                                                const GLTF::Material&           Material,
+                                                PBR_Renderer::PSO_FLAGS         PSOFlags)
+{
+    m_MaterialAttribsData.resize(MaterialTable.GetAttribsSize());
+    if (m_MaterialAttribsData.empty())
+        return RadientMaterialTable::InvalidIndex;
+
+    const void* pEndPtr = WritePBRMaterialShaderAttribs(m_MaterialAttribsData.data(), Settings, PSOFlags, Material);
+
+    const size_t AttribsSize = static_cast<const Uint8*>(pEndPtr) - m_MaterialAttribsData.data();
+    VERIFY(AttribsSize <= m_MaterialAttribsData.size(), "Not enough space in the material table slot to store material attributes");
+    return MaterialTable.Acquire(&Material, PSOFlags, m_MaterialAttribsData.data(), static_cast<Uint32>(AttribsSize));
 }
 
-void RadientGeometryPass::InvalidateDrawablePassData(RadientDrawableID DrawableID)
+void RadientGeometryPass::InvalidateDrawablePassData(RadientMaterialTable& MaterialTable,
+                                                     RadientDrawableID     DrawableID)
 {
-    if (DrawableID < m_DrawablePassData.size())
-        m_DrawablePassData[DrawableID] = {};
+    if (DrawableID >= m_DrawablePassData.size())
+        return;
+
+    DrawablePassData& PassData = m_DrawablePassData[DrawableID];
+    MaterialTable.Release(PassData.MaterialIndex);
+    MaterialTable.Release(PassData.DepthMaterialIndex);
+    PassData = {};
 }
 
 RADIENT_STATUS RadientGeometryRenderer::UpdateEnvironment(IDeviceContext*               pContext,
@@ -1193,21 +2835,27 @@ RADIENT_STATUS RadientGeometryRenderer::CreateRenderer(IRenderDevice*  pDevice,
     if (pDevice == nullptr || pContext == nullptr)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
-    PBR_Renderer::CreateInfo RendererCI;
-    RendererCI.EnableIBL               = true;
-    RendererCI.EnableAO                = true;
-    RendererCI.EnableEmissive          = true;
-    RendererCI.EnableShadows           = false;
-    RendererCI.MaxLightCount           = RadientMaxLightCount;
-    RendererCI.MaxJointCount           = 0;
-    RendererCI.PackMatrixRowMajor      = true;
-    RendererCI.ShaderTexturesArrayMode = PBR_Renderer::SHADER_TEXTURE_ARRAY_MODE_NONE;
-    InputLayoutDescX InputLayout       = GLTF::VertexAttributesToInputLayout(GLTF::DefaultVertexAttributes.data(), GLTF::DefaultVertexAttributes.size());
-    RendererCI.InputLayout             = InputLayout;
-    RendererCI.TexColorConversionMode  = pDevice->GetDeviceInfo().Features.TextureSubresourceViews ?
-         PBR_Renderer::CreateInfo::TEX_COLOR_CONVERSION_MODE_NONE :
-         PBR_Renderer::CreateInfo::TEX_COLOR_CONVERSION_MODE_SRGB_TO_LINEAR;
-    SetGLTFTextureAttribIndices(RendererCI);
+    PBR_Renderer::CreateInfo RendererCI = GetRadientPBRRendererSettings(m_ShadowDesc);
+    if (RendererCI.EnableShadows)
+        m_ShadowDesc.NDCMinusOneToOne = pDevice->GetDeviceInfo().NDC.MinZ < 0.f;
+    InputLayoutDescX InputLayout      = GLTF::VertexAttributesToInputLayout(GLTF::DefaultVertexAttributes.data(), GLTF::DefaultVertexAttributes.size());
+    RendererCI.InputLayout            = InputLayout;
+    RendererCI.TexColorConversionMode = pDevice->GetDeviceInfo().Features.TextureSubresourceViews ?
+        PBR_Renderer::CreateInfo::TEX_COLOR_CONVERSION_MODE_NONE :
+        PBR_Renderer::CreateInfo::TEX_COLOR_CONVERSION_MODE_SRGB_TO_LINEAR;
+
+    // Primitive attributes of a sorted draw list are written into one buffer, see DrawSortedDrawables()
+    m_pPrimitiveAttribsCB = CreatePrimitiveAttribsCB(pDevice);
+    if (m_pPrimitiveAttribsCB == nullptr)
+        return RADIENT_STATUS_INVALID_OPERATION;
+    RendererCI.pPrimitiveAttribsCB = m_pPrimitiveAttribsCB;
+
+    // Indirect multi-draws read the primitive attribs from an array indexed by the draw index.
+    // A single draw reads the first element of the array at the bound offset.
+    m_IndirectDrawBucketSize = m_EnableGPUDrivenRendering && IsGPUDrivenRenderingSupported(pDevice) ? RadientIndirectDrawBucketSize : 0;
+    if (m_EnableGPUDrivenRendering && m_IndirectDrawBucketSize == 0)
+        LOG_WARNING_MESSAGE("GPU-driven rendering is not supported by the device. Radient forward pass primitives are drawn one by one.");
+    RendererCI.PrimitiveArraySize = m_IndirectDrawBucketSize;
 
     m_pRenderer             = std::make_unique<PBR_Renderer>(pDevice, nullptr, pContext, RendererCI);
     m_pDefaultIBLCubemapSRV = CreateDefaultIBLCubemap(pDevice);
@@ -1233,15 +2881,172 @@ RADIENT_STATUS RadientGeometryRenderer::CreateRenderer(IRenderDevice*  pDevice,
     if (m_pFrameAttribsCB == nullptr)
         return RADIENT_STATUS_INVALID_OPERATION;
 
-    m_BaseRenderFlags =
-        PBR_Renderer::PSO_FLAG_DEFAULT |
-        PBR_Renderer::PSO_FLAG_ALL_TEXTURES |
-        PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
-        PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS;
-    m_BaseRenderFlags &= ~PBR_Renderer::PSO_FLAG_ENABLE_TONE_MAPPING;
-    m_BaseRenderFlags &= ~PBR_Renderer::PSO_FLAG_COMPUTE_MOTION_VECTORS;
+    // Shadows are enabled once the shadow map is created
+    m_BaseRenderFlags = GetRadientBaseRenderFlags(false);
+
+    m_CacheBindings       = {};
+    m_ShadowCacheBindings = {};
+    m_LightClusterBuffers = {};
+
+    // Slots are large enough for the attributes of any PSO flags, see CreateResourceCacheSRB()
+    m_MaterialTable.SetLayout(m_pRenderer->GetPBRMaterialAttribsSize(PBR_Renderer::PSO_FLAG_ALL),
+                              pDevice->GetAdapterInfo().Buffer.ConstantBufferOffsetAlignment);
+    m_PrimitiveRecords.Reset(static_cast<Uint32>(m_pPrimitiveAttribsCB->GetDesc().Size),
+                             pDevice->GetAdapterInfo().Buffer.ConstantBufferOffsetAlignment,
+                             GetPrimitiveAttribsRangeSize(m_pRenderer->GetSettings()));
+
+    if (RendererCI.EnableShadows)
+    {
+        const RADIENT_STATUS ShadowMapStatus = CreateShadowMap(pDevice);
+        if (RADIENT_FAILED(ShadowMapStatus))
+            return ShadowMapStatus;
+
+        m_BaseRenderFlags = GetRadientBaseRenderFlags(true);
+    }
 
-    m_CacheBindings = {};
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientGeometryRenderer::CreateShadowMap(IRenderDevice* pDevice)
+{
+    m_pShadowMapSRV.Release();
+    m_pDummyShadowMapSRV.Release();
+    m_ShadowMapDSVs.clear();
+    m_pShadowFrameAttribsCB.Release();
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Radient shadow map";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL;
+    TexDesc.Format    = RadientShadowMapFormat;
+    TexDesc.Width     = m_ShadowDesc.Resolution;
+    TexDesc.Height    = m_ShadowDesc.Resolution;
+    TexDesc.MipLevels = 1;
+    TexDesc.ArraySize = m_ShadowDesc.CascadeCount;
+
+    RefCntAutoPtr<ITexture> pShadowMap;
+    pDevice->CreateTexture(TexDesc, nullptr, &pShadowMap);
+    if (pShadowMap == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient shadow map");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+    m_pShadowMapSRV = pShadowMap->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    m_ShadowMapDSVs.resize(TexDesc.ArraySize);
+    for (Uint32 Slice = 0; Slice < TexDesc.ArraySize; ++Slice)
+    {
+        TextureViewDesc DSVDesc;
+        DSVDesc.ViewType        = TEXTURE_VIEW_DEPTH_STENCIL;
+        DSVDesc.TextureDim      = RESOURCE_DIM_TEX_2D_ARRAY;
+        DSVDesc.FirstArraySlice = Slice;
+        DSVDesc.NumArraySlices  = 1;
+        pShadowMap->CreateView(DSVDesc, &m_ShadowMapDSVs[Slice]);
+        if (m_ShadowMapDSVs[Slice] == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to create Radient shadow map DSV for slice ", Slice);
+            return RADIENT_STATUS_INVALID_OPERATION;
+        }
+    }
+
+    TextureDesc DummyTexDesc = TexDesc;
+    DummyTexDesc.Name        = "Radient dummy shadow map";
+    DummyTexDesc.Width       = 16;
+    DummyTexDesc.Height      = 16;
+    DummyTexDesc.ArraySize   = 1;
+
+    RefCntAutoPtr<ITexture> pDummyShadowMap;
+    pDevice->CreateTexture(DummyTexDesc, nullptr, &pDummyShadowMap);
+    if (pDummyShadowMap == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient dummy shadow map");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+    m_pDummyShadowMapSRV = pDummyShadowMap->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    CreateUniformBuffer(pDevice,
+                        m_pRenderer->GetPRBFrameAttribsSize(),
+                        "Radient PBR shadow frame attribs buffer",
+                        &m_pShadowFrameAttribsCB);
+    if (m_pShadowFrameAttribsCB == nullptr)
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientGeometryRenderer::UpdateLightClusterBuffers(IRenderDevice*  pDevice,
+                                                                  IDeviceContext* pContext)
+{
+    if (m_pRenderer == nullptr || !m_pRenderer->GetSettings().EnableClusteredLighting)
+        return RADIENT_STATUS_OK;
+
+    bool BuffersRecreated = false;
+    if (!m_LightClusterBuffers.pAttribsCB)
+    {
+        CreateUniformBuffer(pDevice,
+                            sizeof(HLSL::PBRLightClusterAttribs),
+                            "Radient light cluster attribs buffer",
+                            &m_LightClusterBuffers.pAttribsCB);
+        if (!m_LightClusterBuffers.pAttribsCB)
+            return RADIENT_STATUS_INVALID_OPERATION;
+        BuffersRecreated = true;
+    }
+
+    const std::vector<RadientLightClusterRange>& ClusterRanges = m_LightClusters.GetClusterRanges();
+    const std::vector<Uint32>&                   LightIndices  = m_LightClusters.GetLightIndices();
+
+    const Uint32 ClusteredLightCount = static_cast<Uint32>(m_ClusteredLightsData.size() / sizeof(HLSL::PBRLightAttribs));
+    VERIFY_EXPR(ClusteredLightCount == m_LightClusters.GetLightCount());
+
+    if (!PrepareGrowableBuffer(pDevice, "Radient clustered lights buffer", sizeof(HLSL::PBRLightAttribs), ClusteredLightCount,
+                               BIND_SHADER_RESOURCE, BUFFER_MODE_STRUCTURED, m_LightClusterBuffers.pLights, BuffersRecreated) ||
+        !PrepareGrowableBuffer(pDevice, "Radient light cluster grid buffer", sizeof(RadientLightClusterRange), static_cast<Uint32>(ClusterRanges.size()),
+                               BIND_SHADER_RESOURCE, BUFFER_MODE_STRUCTURED, m_LightClusterBuffers.pClusterGrid, BuffersRecreated) ||
+        !PrepareGrowableBuffer(pDevice, "Radient light index list buffer", sizeof(Uint32), static_cast<Uint32>(LightIndices.size()),
+                               BIND_SHADER_RESOURCE, BUFFER_MODE_STRUCTURED, m_LightClusterBuffers.pLightIndices, BuffersRecreated))
+    {
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    {
+        MapHelper<HLSL::PBRLightClusterAttribs> Attribs{pContext, m_LightClusterBuffers.pAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        if (!Attribs)
+            return RADIENT_STATUS_INVALID_OPERATION;
+
+        const RadientLightClusterGridDesc& GridDesc = m_LightClusters.GetGridDesc();
+        Attribs->GridSizeX       = GridDesc.GridSizeX;
+        Attribs->GridSizeY       = GridDesc.GridSizeY;
+        Attribs->GridSizeZ       = GridDesc.GridSizeZ;
+        Attribs->LightCount      = ClusteredLightCount;
+        Attribs->DepthSliceScale = m_LightClusters.GetDepthSliceScale();
+        Attribs->DepthSliceBias  = m_LightClusters.GetDepthSliceBias();
+    }
+
+    // Clustered light attributes are shared by all views of the frame
+    if (!m_ClusteredLightsData.empty() && (m_UploadClusteredLights || BuffersRecreated))
+    {
+        pContext->UpdateBuffer(m_LightClusterBuffers.pLights, 0, m_ClusteredLightsData.size(), m_ClusteredLightsData.data(),
+                               RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    m_UploadClusteredLights = false;
+    if (!ClusterRanges.empty())
+    {
+        pContext->UpdateBuffer(m_LightClusterBuffers.pClusterGrid, 0, ClusterRanges.size() * sizeof(RadientLightClusterRange), ClusterRanges.data(),
+                               RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    if (!LightIndices.empty())
+    {
+        pContext->UpdateBuffer(m_LightClusterBuffers.pLightIndices, 0, LightIndices.size() * sizeof(Uint32), LightIndices.data(),
+                               RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    // Buffer views are bound when the resource cache SRBs are created
+    if (BuffersRecreated)
+    {
+        m_CacheBindings       = {};
+        m_ShadowCacheBindings = {};
+    }
 
     return RADIENT_STATUS_OK;
 }
@@ -1249,7 +3054,9 @@ RADIENT_STATUS RadientGeometryRenderer::CreateRenderer(IRenderDevice*  pDevice,
 RADIENT_STATUS RadientGeometryPass::CreatePsoCaches(PBR_Renderer&           Renderer,
                                                     PBR_Renderer::PSO_FLAGS BaseRenderFlags,
                                                     TEXTURE_FORMAT          RTVFormat,
-                                                    TEXTURE_FORMAT          DSVFormat)
+                                                    TEXTURE_FORMAT          DSVFormat,
+                                                    TEXTURE_FORMAT          ShadowMapFormat,
+                                                    bool                    EnableDepthClamp)
 {
     if (RTVFormat == TEX_FORMAT_UNKNOWN)
         return RADIENT_STATUS_INVALID_ARGUMENT;
@@ -1264,6 +3071,22 @@ RADIENT_STATUS RadientGeometryPass::CreatePsoCaches(PBR_Renderer&           Rend
 
     m_PbrPSOCache = Renderer.GetPsoCacheAccessor(GraphicsDesc);
 
+    m_DepthPrepassPSOCache = {};
+    m_EarlyZPSOCache       = {};
+    if (m_EnableDepthPrepass && DSVFormat != TEX_FORMAT_UNKNOWN)
+    {
+        m_DepthPrepassPSOCache = Renderer.GetPsoCacheAccessor(GetRadientDepthPrepassGraphicsDesc(GraphicsDesc));
+        m_EarlyZPSOCache       = Renderer.GetPsoCacheAccessor(GetRadientEarlyZGraphicsDesc(GraphicsDesc));
+    }
+
+    m_ShadowPSOCache = {};
+    if (ShadowMapFormat != TEX_FORMAT_UNKNOWN)
+    {
+        const GraphicsPipelineDesc ShadowDesc = GetRadientShadowGraphicsDesc(GraphicsDesc, ShadowMapFormat,
+                                                                             Renderer.GetSettings().PCFKernelSize, EnableDepthClamp);
+        m_ShadowPSOCache = Renderer.GetPsoCacheAccessor(ShadowDesc);
+    }
+
     GraphicsDesc.RasterizerDesc.FillMode = FILL_MODE_WIREFRAME;
     m_WireframePSOCache                  = Renderer.GetPsoCacheAccessor(GraphicsDesc);
 
@@ -1271,9 +3094,12 @@ RADIENT_STATUS RadientGeometryPass::CreatePsoCaches(PBR_Renderer&           Rend
     if (RequiresOutputSRGBConversion(RTVFormat))
         m_RenderFlags |= PBR_Renderer::PSO_FLAG_CONVERT_OUTPUT_TO_SRGB;
 
-    m_RTVFormat = RTVFormat;
-    m_DSVFormat = DSVFormat;
-    m_DrawablePassData.clear();
+    m_HasDepthPrepassPipelines = static_cast<bool>(m_DepthPrepassPSOCache);
+    m_HasShadowPipelines       = static_cast<bool>(m_ShadowPSOCache);
+
+    m_RTVFormat       = RTVFormat;
+    m_DSVFormat       = DSVFormat;
+    m_ShadowMapFormat = ShadowMapFormat;
 
     return RADIENT_STATUS_OK;
 }
@@ -29,23 +29,30 @@
 namespace Diligent
 {
 
-RADIENT_STATUS RadientPostProcessPipeline::Prepare(IRenderDevice* pDevice,
-                                                   IDeviceContext* pContext,
+RadientPostProcessPipeline::RadientPostProcessPipeline(const RadientToneMappingDesc& ToneMappingDesc) :
+    m_ToneMappingPass{ToneMappingDesc}
+{
+}
+
+RADIENT_STATUS RadientPostProcessPipeline::Prepare(IRenderDevice*                   pDevice,
+                                                   IDeviceContext*                  pContext,
+                                                   Uint32                           ViewIndex,
                                                    const RadientFrameRenderTargets& Targets)
 {
-    (void)pDevice;
     (void)pContext;
-    (void)Targets;
 
-    return RADIENT_STATUS_OK;
+    return m_ToneMappingPass.Prepare(pDevice, ViewIndex, Targets);
 }
 
-RADIENT_STATUS RadientPostProcessPipeline::Execute(IDeviceContext* pContext, const RadientFrameRenderTargets& Targets)
+RADIENT_STATUS RadientPostProcessPipeline::Execute(IDeviceContext*                  pContext,
+                                                   Uint32                           ViewIndex,
+                                                   const RadientFrameRenderTargets& Targets,
+                                                   double                           DeltaTime)
 {
-    (void)pContext;
-    (void)Targets;
+    if (!Targets.IsHDR())
+        return RADIENT_STATUS_OK;
 
-    return RADIENT_STATUS_OK;
+    return m_ToneMappingPass.Execute(pContext, ViewIndex, Targets, DeltaTime);
 }
 
 } // namespace Diligent
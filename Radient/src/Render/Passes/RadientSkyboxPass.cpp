@@ -155,6 +155,7 @@ RADIENT_STATUS RadientSkyboxPass::Execute(RadientGeometryRenderer&         Rende
         return RADIENT_STATUS_OK;
 
     pContext->SetRenderTargets(1, &pColorRTV, pDepthDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Targets.SetViewport(pContext);
 
     HLSL::ToneMappingAttribs ToneMapping{};
     ToneMapping.iToneMappingMode     = TONE_MAPPING_MODE_NONE;
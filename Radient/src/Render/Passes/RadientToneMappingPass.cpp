@@ -0,0 +1,401 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/Passes/RadientToneMappingPass.hpp"
+
+#include "Utilities/interface/DiligentFXShaderSourceStreamFactory.hpp"
+
+#include "CommonlyUsedStates.h"
+#include "GraphicsTypesX.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Diligent
+{
+
+namespace HLSL
+{
+#include "Shaders/Common/public/ShaderDefinitions.fxh"
+#include "Shaders/PostProcess/ToneMapping/public/ToneMappingStructures.fxh"
+#include "Shaders/Radient/private/RadientToneMappingStructures.fxh"
+} // namespace HLSL
+
+namespace
+{
+
+TEXTURE_FORMAT GetTextureViewFormat(ITextureView* pView)
+{
+    if (pView == nullptr)
+        return TEX_FORMAT_UNKNOWN;
+
+    const TextureViewDesc& ViewDesc = pView->GetDesc();
+    if (ViewDesc.Format != TEX_FORMAT_UNKNOWN)
+        return ViewDesc.Format;
+
+    ITexture* pTexture = pView->GetTexture();
+    return pTexture != nullptr ? pTexture->GetDesc().Format : TEX_FORMAT_UNKNOWN;
+}
+
+bool RequiresOutputSRGBConversion(TEXTURE_FORMAT Format)
+{
+    return Format == TEX_FORMAT_RGBA8_UNORM ||
+        Format == TEX_FORMAT_BGRA8_UNORM;
+}
+
+RefCntAutoPtr<IPipelineState> CreateExposurePSO(IRenderDevice* pDevice, const char* FileName, const char* Name)
+{
+    ShaderCreateInfo ShaderCI{
+        FileName,
+        &DiligentFXShaderSourceStreamFactory::GetInstance(),
+        "main",
+        {},
+        SHADER_SOURCE_LANGUAGE_HLSL,
+        {Name, SHADER_TYPE_COMPUTE, true},
+    };
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient shader '", FileName, "'");
+        return {};
+    }
+
+    ComputePipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name                               = Name;
+    PsoCI.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PsoCI.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PsoCI.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PsoCI, &pPSO);
+    if (!pPSO)
+        LOG_ERROR_MESSAGE("Failed to create Radient PSO '", Name, "'");
+
+    return pPSO;
+}
+
+RefCntAutoPtr<IBuffer> CreateRawBuffer(IRenderDevice* pDevice, const char* Name, Uint32 NumWords)
+{
+    BufferDesc Desc;
+    Desc.Name              = Name;
+    Desc.Size              = NumWords * sizeof(Uint32);
+    Desc.Usage             = USAGE_DEFAULT;
+    Desc.BindFlags         = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+    Desc.Mode              = BUFFER_MODE_RAW;
+    Desc.ElementByteStride = sizeof(Uint32);
+
+    // Zero histogram bins, and zero adapted luminance that makes the first frame adapt immediately
+    const std::vector<Uint32> InitData(NumWords, 0);
+    const BufferData          Data{InitData.data(), Desc.Size};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(Desc, &Data, &pBuffer);
+    if (!pBuffer)
+        LOG_ERROR_MESSAGE("Failed to create ", Name);
+
+    return pBuffer;
+}
+
+void SetVariable(IShaderResourceBinding* pSRB, SHADER_TYPE ShaderType, const char* Name, IDeviceObject* pObject)
+{
+    if (IShaderResourceVariable* pVar = pSRB->GetVariableByName(ShaderType, Name))
+        pVar->Set(pObject);
+}
+
+} // namespace
+
+RadientToneMappingPass::RadientToneMappingPass(const RadientToneMappingDesc& Desc) :
+    m_Desc{Desc},
+    m_AutoExposureDesc{GetAutoExposureDesc(Desc)}
+{
+}
+
+RadientToneMappingPass::~RadientToneMappingPass()
+{
+}
+
+int RadientToneMappingPass::GetToneMappingMode(RADIENT_TONE_MAPPING_OPERATOR Operator)
+{
+    switch (Operator)
+    {
+        case RADIENT_TONE_MAPPING_OPERATOR_LINEAR: return TONE_MAPPING_MODE_NONE;
+        case RADIENT_TONE_MAPPING_OPERATOR_REINHARD: return TONE_MAPPING_MODE_REINHARD;
+        case RADIENT_TONE_MAPPING_OPERATOR_UNCHARTED2: return TONE_MAPPING_MODE_UNCHARTED2;
+        case RADIENT_TONE_MAPPING_OPERATOR_AGX: return TONE_MAPPING_MODE_AGX;
+        case RADIENT_TONE_MAPPING_OPERATOR_PBR_NEUTRAL: return TONE_MAPPING_MODE_PBR_NEUTRAL;
+
+        default:
+            UNEXPECTED("Unexpected tone mapping operator");
+            return TONE_MAPPING_MODE_UNCHARTED2;
+    }
+}
+
+RadientAutoExposureDesc RadientToneMappingPass::GetAutoExposureDesc(const RadientToneMappingDesc& Desc)
+{
+    RadientAutoExposureDesc ExposureDesc;
+    ExposureDesc.MinLogLuminance = Desc.MinLogLuminance;
+    ExposureDesc.MaxLogLuminance = std::max(Desc.MaxLogLuminance, Desc.MinLogLuminance + 1.f);
+    ExposureDesc.LowPercentile   = clamp(Desc.LowPercentile, 0.f, 1.f);
+    ExposureDesc.HighPercentile  = clamp(Desc.HighPercentile, ExposureDesc.LowPercentile, 1.f);
+    ExposureDesc.AdaptationSpeed = Desc.AdaptationSpeed;
+    return ExposureDesc;
+}
+
+RADIENT_STATUS RadientToneMappingPass::CreateExposureResources(IRenderDevice* pDevice)
+{
+    CreateUniformBuffer(pDevice, sizeof(HLSL::ToneMappingAttribs), "Radient tone mapping attribs buffer", &m_pToneMappingAttribsCB);
+    CreateUniformBuffer(pDevice, sizeof(HLSL::RadientExposureAttribs), "Radient exposure attribs buffer", &m_pExposureAttribsCB);
+    if (!m_pToneMappingAttribsCB || !m_pExposureAttribsCB)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient tone mapping attribs buffers");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    if (m_Desc.AutoExposure != True)
+        return RADIENT_STATUS_OK;
+
+    m_pHistogram = CreateRawBuffer(pDevice, "Radient luminance histogram buffer", RADIENT_LUMINANCE_HISTOGRAM_BIN_COUNT);
+    if (!m_pHistogram)
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    m_pHistogramPSO = CreateExposurePSO(pDevice, "BuildLuminanceHistogram.csh", "Radient build luminance histogram PSO");
+    m_pAdaptPSO     = CreateExposurePSO(pDevice, "AdaptExposure.csh", "Radient adapt exposure PSO");
+    if (!m_pHistogramPSO || !m_pAdaptPSO)
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    m_pHistogramPSO->CreateShaderResourceBinding(&m_pHistogramSRB, true);
+    m_pAdaptPSO->CreateShaderResourceBinding(&m_pAdaptSRB, true);
+    if (!m_pHistogramSRB || !m_pAdaptSRB)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient auto exposure SRBs");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    SetVariable(m_pHistogramSRB, SHADER_TYPE_COMPUTE, "cbExposureAttribs", m_pExposureAttribsCB);
+    SetVariable(m_pHistogramSRB, SHADER_TYPE_COMPUTE, "g_Histogram", m_pHistogram->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    SetVariable(m_pAdaptSRB, SHADER_TYPE_COMPUTE, "cbExposureAttribs", m_pExposureAttribsCB);
+    SetVariable(m_pAdaptSRB, SHADER_TYPE_COMPUTE, "g_Histogram", m_pHistogram->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientToneMappingPass::CreateToneMappingTechnique(IRenderDevice* pDevice, TEXTURE_FORMAT RTVFormat, PostFXRenderTechnique& Technique)
+{
+    const bool AutoExposure = m_Desc.AutoExposure == True;
+
+    ShaderMacroHelper Macros;
+    Macros.Add("TONE_MAPPING_MODE", GetToneMappingMode(m_Desc.Operator));
+    Macros.Add("AUTO_EXPOSURE", AutoExposure);
+    Macros.Add("CONVERT_OUTPUT_TO_SRGB", RequiresOutputSRGBConversion(RTVFormat));
+
+    RefCntAutoPtr<IShader> VS = PostFXRenderTechnique::CreateShader(
+        pDevice, nullptr,
+        "FullScreenTriangleVS.fx", "FullScreenTriangleVS",
+        SHADER_TYPE_VERTEX);
+
+    RefCntAutoPtr<IShader> PS = PostFXRenderTechnique::CreateShader(
+        pDevice, nullptr,
+        "RadientToneMapping.psh", "main",
+        SHADER_TYPE_PIXEL, Macros);
+
+    if (!VS || !PS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient tone mapping shaders");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    PipelineResourceLayoutDescX ResourceLayout;
+    ResourceLayout
+        .AddVariable(SHADER_TYPE_PIXEL, "cbToneMappingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        .AddVariable(SHADER_TYPE_PIXEL, "cbExposureAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        .AddVariable(SHADER_TYPE_PIXEL, "g_SceneColor", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC)
+        .AddImmutableSampler(SHADER_TYPE_PIXEL, "g_SceneColor", Sam_LinearClamp);
+    if (AutoExposure)
+        ResourceLayout.AddVariable(SHADER_TYPE_PIXEL, "g_Exposure", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    Technique.InitializePSO(pDevice,
+                            nullptr, "Radient tone mapping PSO",
+                            VS, PS, ResourceLayout,
+                            {
+                                RTVFormat,
+                            },
+                            TEX_FORMAT_UNKNOWN,
+                            DSS_DisableDepth, BS_Default, false);
+    if (!Technique.IsInitializedPSO())
+    {
+        LOG_ERROR_MESSAGE("Failed to create Radient tone mapping PSO");
+        return RADIENT_STATUS_INVALID_OPERATION;
+    }
+
+    ShaderResourceVariableX{Technique.PSO, SHADER_TYPE_PIXEL, "cbToneMappingAttribs"}.Set(m_pToneMappingAttribsCB);
+    ShaderResourceVariableX{Technique.PSO, SHADER_TYPE_PIXEL, "cbExposureAttribs"}.Set(m_pExposureAttribsCB);
+    Technique.InitializeSRB(true);
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientToneMappingPass::Prepare(IRenderDevice* pDevice, Uint32 ViewIndex, const RadientFrameRenderTargets& Targets)
+{
+    if (pDevice == nullptr || !IsEnabled() || !Targets.IsHDR())
+        return RADIENT_STATUS_OK;
+
+    if (!m_pToneMappingAttribsCB)
+    {
+        const RADIENT_STATUS Status = CreateExposureResources(pDevice);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    if (m_Desc.AutoExposure == True)
+    {
+        if (m_ViewExposure.size() <= ViewIndex)
+            m_ViewExposure.resize(ViewIndex + 1);
+
+        RefCntAutoPtr<IBuffer>& pExposure = m_ViewExposure[ViewIndex];
+        if (!pExposure)
+        {
+            pExposure = CreateRawBuffer(pDevice, "Radient view exposure buffer", 1);
+            if (!pExposure)
+                return RADIENT_STATUS_INVALID_OPERATION;
+        }
+    }
+
+    const TEXTURE_FORMAT RTVFormat = GetTextureViewFormat(Targets.GetOutputRTV());
+    if (RTVFormat == TEX_FORMAT_UNKNOWN)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    PostFXRenderTechnique& Technique = m_Techniques[RTVFormat];
+    if (Technique.IsInitializedSRB())
+        return RADIENT_STATUS_OK;
+
+    const RADIENT_STATUS Status = CreateToneMappingTechnique(pDevice, RTVFormat, Technique);
+    if (RADIENT_FAILED(Status))
+        m_Techniques.erase(RTVFormat);
+
+    return Status;
+}
+
+void RadientToneMappingPass::UpdateAttribs(IDeviceContext* pContext, const RadientFrameRenderTargets& Targets, double DeltaTime)
+{
+    {
+        MapHelper<HLSL::ToneMappingAttribs> Attribs{pContext, m_pToneMappingAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        *Attribs                      = {};
+        Attribs->iToneMappingMode     = GetToneMappingMode(m_Desc.Operator);
+        Attribs->bAutoExposure        = m_Desc.AutoExposure == True ? 1 : 0;
+        Attribs->fMiddleGray          = m_Desc.MiddleGray;
+        Attribs->bLightAdaptation     = 0;
+        Attribs->fWhitePoint          = m_Desc.WhitePoint;
+        Attribs->fLuminanceSaturation = 1.f;
+    }
+
+    {
+        const RadientExtent2D& Size       = Targets.GetSize();
+        const RadientExtent2D& RenderSize = Targets.GetRenderSize();
+
+        const float2 TargetSize{static_cast<float>(Size.Width), static_cast<float>(Size.Height)};
+        const float2 RenderScale{static_cast<float>(RenderSize.Width) / TargetSize.x, static_cast<float>(RenderSize.Height) / TargetSize.y};
+
+        MapHelper<HLSL::RadientExposureAttribs> Attribs{pContext, m_pExposureAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        *Attribs                      = {};
+        Attribs->MinLogLuminance      = m_AutoExposureDesc.MinLogLuminance;
+        Attribs->LogLuminanceRange    = m_AutoExposureDesc.MaxLogLuminance - m_AutoExposureDesc.MinLogLuminance;
+        Attribs->InvLogLuminanceRange = 1.f / Attribs->LogLuminanceRange;
+        Attribs->MinLuminance         = std::exp2(m_AutoExposureDesc.MinLogLuminance);
+        Attribs->LowPercentile        = m_AutoExposureDesc.LowPercentile;
+        Attribs->HighPercentile       = m_AutoExposureDesc.HighPercentile;
+        Attribs->AdaptationRate       = RadientAutoExposure::GetAdaptationRate(static_cast<float>(DeltaTime), m_AutoExposureDesc.AdaptationSpeed);
+        Attribs->ExposureScale        = std::exp2(m_Desc.Exposure);
+        Attribs->Width                = RenderSize.Width;
+        Attribs->Height               = RenderSize.Height;
+        Attribs->PixelToUV            = RenderScale / TargetSize;
+        Attribs->MaxUV                = float2{static_cast<float>(RenderSize.Width) - 0.5f, static_cast<float>(RenderSize.Height) - 0.5f} / TargetSize;
+    }
+}
+
+RADIENT_STATUS RadientToneMappingPass::Execute(IDeviceContext*                  pContext,
+                                               Uint32                           ViewIndex,
+                                               const RadientFrameRenderTargets& Targets,
+                                               double                           DeltaTime)
+{
+    if (!IsEnabled() || !Targets.IsHDR())
+        return RADIENT_STATUS_OK;
+
+    ITextureView* pOutputRTV = Targets.GetOutputRTV();
+
+    auto TechniqueIt = m_Techniques.find(GetTextureViewFormat(pOutputRTV));
+    if (TechniqueIt == m_Techniques.end())
+        return RADIENT_STATUS_INVALID_OPERATION;
+    PostFXRenderTechnique& Technique = TechniqueIt->second;
+
+    UpdateAttribs(pContext, Targets, DeltaTime);
+
+    ITextureView* pSceneColorSRV = Targets.GetSceneColorSRV();
+
+    IBuffer* pExposure = nullptr;
+    if (m_Desc.AutoExposure == True)
+    {
+        if (ViewIndex >= m_ViewExposure.size() || !m_ViewExposure[ViewIndex])
+            return RADIENT_STATUS_INVALID_OPERATION;
+        pExposure = m_ViewExposure[ViewIndex];
+
+        // The histogram only covers the rendered part of the scene color
+        const RadientExtent2D& Size = Targets.GetRenderSize();
+
+        SetVariable(m_pHistogramSRB, SHADER_TYPE_COMPUTE, "g_SceneColor", pSceneColorSRV);
+        pContext->SetPipelineState(m_pHistogramPSO);
+        pContext->CommitShaderResources(m_pHistogramSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        DispatchComputeAttribs HistogramAttribs;
+        HistogramAttribs.ThreadGroupCountX = (Size.Width + RADIENT_LUMINANCE_HISTOGRAM_GROUP_SIZE - 1) / RADIENT_LUMINANCE_HISTOGRAM_GROUP_SIZE;
+        HistogramAttribs.ThreadGroupCountY = (Size.Height + RADIENT_LUMINANCE_HISTOGRAM_GROUP_SIZE - 1) / RADIENT_LUMINANCE_HISTOGRAM_GROUP_SIZE;
+        pContext->DispatchCompute(HistogramAttribs);
+
+        SetVariable(m_pAdaptSRB, SHADER_TYPE_COMPUTE, "g_Exposure", pExposure->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        pContext->SetPipelineState(m_pAdaptPSO);
+        pContext->CommitShaderResources(m_pAdaptSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+    }
+
+    pContext->SetRenderTargets(1, &pOutputRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    SetVariable(Technique.SRB, SHADER_TYPE_PIXEL, "g_SceneColor", pSceneColorSRV);
+    if (pExposure != nullptr)
+        SetVariable(Technique.SRB, SHADER_TYPE_PIXEL, "g_Exposure", pExposure->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+
+    pContext->SetPipelineState(Technique.PSO);
+    pContext->CommitShaderResources(Technique.SRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw({3, DRAW_FLAG_VERIFY_ALL, 1});
+
+    return RADIENT_STATUS_OK;
+}
+
+} // namespace Diligent
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientAutoExposure.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace HLSL
+{
+#include "Shaders/Common/public/ShaderDefinitions.fxh"
+#include "Shaders/Radient/private/RadientToneMappingStructures.fxh"
+} // namespace HLSL
+
+static_assert(RadientAutoExposure::HistogramBinCount == RADIENT_LUMINANCE_HISTOGRAM_BIN_COUNT,
+              "Histogram bin count does not match the shader constant");
+
+float RadientAutoExposure::GetLuminance(const float3& Color)
+{
+    // RGB_TO_LUMINANCE in ToneMapping.fxh
+    return dot(float3{0.212671f, 0.715160f, 0.072169f}, max(Color, float3{0, 0, 0}));
+}
+
+Uint32 RadientAutoExposure::GetHistogramBin(float Luminance, const RadientAutoExposureDesc& Desc)
+{
+    const float InvLogLuminanceRange = 1.f / (Desc.MaxLogLuminance - Desc.MinLogLuminance);
+
+    const float LogLuminance = std::log2(std::max(Luminance, 1e-10f));
+    const float Position     = clamp((LogLuminance - Desc.MinLogLuminance) * InvLogLuminanceRange, 0.f, 1.f);
+    return std::min(static_cast<Uint32>(Position * static_cast<float>(HistogramBinCount)), HistogramBinCount - 1);
+}
+
+float RadientAutoExposure::GetBinLogLuminance(Uint32 Bin, const RadientAutoExposureDesc& Desc)
+{
+    return Desc.MinLogLuminance + (static_cast<float>(Bin) + 0.5f) / static_cast<float>(HistogramBinCount) * (Desc.MaxLogLuminance - Desc.MinLogLuminance);
+}
+
+void RadientAutoExposure::AddToHistogram(const float*                   pPixels,
+                                         size_t                         NumPixels,
+                                         Uint32                         NumComponents,
+                                         const RadientAutoExposureDesc& Desc,
+                                         Histogram&                     Hist)
+{
+    VERIFY_EXPR(NumComponents >= 3);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const float* pPixel = pPixels + i * NumComponents;
+        ++Hist[GetHistogramBin(GetLuminance(float3{pPixel[0], pPixel[1], pPixel[2]}), Desc)];
+    }
+}
+
+float RadientAutoExposure::ComputeAverageLuminance(const Histogram& Hist, const RadientAutoExposureDesc& Desc)
+{
+    float PixelCount = 0;
+    for (Uint32 Count : Hist)
+        PixelCount += static_cast<float>(Count);
+
+    const float LowCount  = PixelCount * Desc.LowPercentile;
+    const float HighCount = PixelCount * Desc.HighPercentile;
+
+    float BinStart  = 0;
+    float WeightSum = 0;
+    float LogSum    = 0;
+    for (Uint32 Bin = 0; Bin < HistogramBinCount; ++Bin)
+    {
+        // The part of the bin that lies between the percentiles
+        const float BinEnd = BinStart + static_cast<float>(Hist[Bin]);
+        const float Weight = std::max(std::min(BinEnd, HighCount) - std::max(BinStart, LowCount), 0.f);
+        LogSum += Weight * GetBinLogLuminance(Bin, Desc);
+        WeightSum += Weight;
+        BinStart = BinEnd;
+    }
+
+    return WeightSum > 0 ? std::exp2(LogSum / WeightSum) : 0.f;
+}
+
+float RadientAutoExposure::GetAdaptationRate(float DeltaTime, float AdaptationSpeed)
+{
+    if (AdaptationSpeed <= 0)
+        return 1.f;
+
+    return 1.f - std::exp(-std::max(DeltaTime, 0.f) * AdaptationSpeed);
+}
+
+float RadientAutoExposure::AdaptLuminance(float AdaptedLuminance, float AverageLuminance, float DeltaTime, float AdaptationSpeed)
+{
+    if (AverageLuminance <= 0)
+        return AdaptedLuminance;
+    if (AdaptedLuminance <= 0)
+        return AverageLuminance;
+
+    return AdaptedLuminance + (AverageLuminance - AdaptedLuminance) * GetAdaptationRate(DeltaTime, AdaptationSpeed);
+}
+
+} // namespace Diligent
@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Render/RadientCommandLog.hpp"
+
+#include "DebugUtilities.hpp"
+
+#include <cstring>
+
+namespace Diligent
+{
+
+void RadientCommandLog::Clear()
+{
+    VERIFY(!m_InPass, "Command log is cleared inside a pass");
+    m_Commands.clear();
+    m_Passes.clear();
+    m_InPass = false;
+}
+
+void RadientCommandLog::BeginPass(const char* Name, Uint32 ViewIndex)
+{
+    VERIFY(!m_InPass, "Pass ", Name, " begins inside another pass");
+    if (m_InPass)
+        EndPass();
+
+    PassInfo Pass;
+    Pass.Name         = Name;
+    Pass.ViewIndex    = ViewIndex;
+    Pass.FirstCommand = static_cast<Uint32>(m_Commands.size());
+    m_Passes.push_back(Pass);
+
+    m_InPass = true;
+    m_PassTimer.Restart();
+}
+
+void RadientCommandLog::EndPass()
+{
+    VERIFY(m_InPass, "No pass to end");
+    if (!m_InPass)
+        return;
+
+    PassInfo& Pass    = m_Passes.back();
+    Pass.CPUTime      = m_PassTimer.GetElapsedTime();
+    Pass.CommandCount = static_cast<Uint32>(m_Commands.size()) - Pass.FirstCommand;
+    m_InPass          = false;
+}
+
+void RadientCommandLog::Record(RadientCommandType Type, Uint64 Object, Uint32 Offset, Uint32 Size)
+{
+    VERIFY(m_InPass, "Commands must be recorded inside a pass");
+    if (!m_InPass)
+        return;
+
+    PassInfo& Pass = m_Passes.back();
+    switch (Type)
+    {
+        case RadientCommandType::SetPipelineState:
+        case RadientCommandType::SetVertexBuffers:
+        case RadientCommandType::SetMaterial:
+            ++Pass.StateChangeCount;
+            break;
+
+        case RadientCommandType::WriteBuffer:
+            Pass.BufferWriteSize += Size;
+            break;
+
+        case RadientCommandType::Draw:
+        case RadientCommandType::DrawIndexed:
+        case RadientCommandType::DrawIndexedIndirect:
+            ++Pass.DrawCount;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected command type");
+    }
+
+    m_Commands.push_back(RadientCommand{Type, static_cast<Uint32>(m_Passes.size() - 1), Object, Offset, Size});
+}
+
+Uint32 RadientCommandLog::GetCommandCount(RadientCommandType Type) const
+{
+    Uint32 Count = 0;
+    for (const RadientCommand& Command : m_Commands)
+    {
+        if (Command.Type == Type)
+            ++Count;
+    }
+    return Count;
+}
+
+const RadientCommandLog::PassInfo* RadientCommandLog::FindPass(const char* Name, Uint32 ViewIndex) const
+{
+    for (const PassInfo& Pass : m_Passes)
+    {
+        if (Pass.ViewIndex == ViewIndex && std::strcmp(Pass.Name, Name) == 0)
+            return &Pass;
+    }
+    return nullptr;
+}
+
+} // namespace Diligent
@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientDepthSort.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace Diligent
+{
+
+void RadientDepthSorter::Sort(std::vector<Uint32>& SortedValues)
+{
+    constexpr Uint32 RadixBits = 8;
+    constexpr Uint32 RadixSize = 1u << RadixBits;
+    constexpr Uint32 RadixMask = RadixSize - 1;
+    constexpr Uint32 PassCount = sizeof(Uint64) * 8 / RadixBits;
+
+    SortedValues.clear();
+    if (m_Items.empty())
+        return;
+
+    // Histograms for all passes are built with a single read of the keys.
+    std::array<std::array<Uint32, RadixSize>, PassCount> Histograms{};
+    for (const Item& SrcItem : m_Items)
+    {
+        for (Uint32 Pass = 0; Pass < PassCount; ++Pass)
+            ++Histograms[Pass][(SrcItem.Key >> (Pass * RadixBits)) & RadixMask];
+    }
+
+    m_Scratch.resize(m_Items.size());
+    for (Uint32 Pass = 0; Pass < PassCount; ++Pass)
+    {
+        std::array<Uint32, RadixSize>& Histogram = Histograms[Pass];
+
+        const Uint32 Shift = Pass * RadixBits;
+        // Skip the pass if all keys have the same digit, which is common for the upper bytes
+        // of the tie-break key and of the depth keys of nearby objects.
+        if (Histogram[(m_Items.front().Key >> Shift) & RadixMask] == m_Items.size())
+            continue;
+
+        Uint32 Offset = 0;
+        for (Uint32& Bucket : Histogram)
+        {
+            const Uint32 BucketSize = Bucket;
+
+            Bucket = Offset;
+            Offset += BucketSize;
+        }
+
+        for (const Item& SrcItem : m_Items)
+            m_Scratch[Histogram[(SrcItem.Key >> Shift) & RadixMask]++] = SrcItem;
+
+        m_Items.swap(m_Scratch);
+    }
+
+    SortedValues.reserve(m_Items.size());
+    for (const Item& SortedItem : m_Items)
+        SortedValues.push_back(SortedItem.Value);
+}
+
+RadientFloat4 RadientDepthSorter::GetDepthPlane(const RadientFloat3& CameraPosition,
+                                                const RadientFloat3& ViewDirection)
+{
+    return RadientFloat4{
+        ViewDirection.x,
+        ViewDirection.y,
+        ViewDirection.z,
+        -(ViewDirection.x * CameraPosition.x + ViewDirection.y * CameraPosition.y + ViewDirection.z * CameraPosition.z),
+    };
+}
+
+float RadientDepthSorter::GetViewDepth(const RadientFloat4&    DepthPlane,
+                                       const RadientMatrix4x4& WorldMatrix,
+                                       const RadientBounds&    LocalBounds)
+{
+    const float CenterX = (LocalBounds.Min.x + LocalBounds.Max.x) * 0.5f;
+    const float CenterY = (LocalBounds.Min.y + LocalBounds.Max.y) * 0.5f;
+    const float CenterZ = (LocalBounds.Min.z + LocalBounds.Max.z) * 0.5f;
+
+    // Row-vector convention: WorldCenter = [Center, 1] * WorldMatrix.
+    const float* M = WorldMatrix.Data;
+
+    const float WorldX = CenterX * M[0] + CenterY * M[4] + CenterZ * M[8] + M[12];
+    const float WorldY = CenterX * M[1] + CenterY * M[5] + CenterZ * M[9] + M[13];
+    const float WorldZ = CenterX * M[2] + CenterY * M[6] + CenterZ * M[10] + M[14];
+
+    return DepthPlane.x * WorldX + DepthPlane.y * WorldY + DepthPlane.z * WorldZ + DepthPlane.w;
+}
+
+Uint32 RadientDepthSorter::GetBackToFrontKey(float ViewDepth)
+{
+    // NaN depths are sorted as if they were on the camera plane.
+    // Adding zero turns -0 into +0, so that both produce the same key.
+    ViewDepth = std::isnan(ViewDepth) ? 0.f : ViewDepth + 0.f;
+
+    Uint32 Bits = 0;
+    std::memcpy(&Bits, &ViewDepth, sizeof(Bits));
+
+    // Map the float to an unsigned integer with the same ordering, then invert it
+    // so that farther primitives get smaller keys.
+    const Uint32 OrderedBits = (Bits & 0x80000000u) != 0 ? ~Bits : (Bits | 0x80000000u);
+    return ~OrderedBits;
+}
+
+Uint32 RadientDepthSorter::GetFrontToBackKey(float ViewDepth)
+{
+    if (!(ViewDepth > 0.f))
+        return 0;
+
+    Uint32 Bits = 0;
+    std::memcpy(&Bits, &ViewDepth, sizeof(Bits));
+
+    // For positive floats, the exponent and the two upper mantissa bits form
+    // a monotonic logarithmic bucket index with four buckets per octave.
+    return Bits >> 21u;
+}
+
+} // namespace Diligent
@@ -39,14 +39,45 @@ RadientDrawableID RadientDrawList::RemoveAt(size_t Index)
         return InvalidRadientDrawableID;
     }
 
+    VERIFY_EXPR(m_VisibilityMasks.size() == m_Items.size());
+
     const RadientDrawableID MovedDrawableID = m_Items.back().DrawableID;
 
     m_Items[Index] = m_Items.back();
     m_Items.pop_back();
+    m_VisibilityMasks[Index] = m_VisibilityMasks.back();
+    m_VisibilityMasks.pop_back();
 
     return Index < m_Items.size() ? MovedDrawableID : InvalidRadientDrawableID;
 }
 
+void RadientDrawList::SetVisibilityMask(size_t Index, Uint64 VisibilityMask)
+{
+    if (Index >= m_VisibilityMasks.size())
+    {
+        UNEXPECTED("Draw list item index (", Index, ") exceeds the number of items in the list (", m_VisibilityMasks.size(), ")");
+        return;
+    }
+
+    m_VisibilityMasks[Index] = VisibilityMask;
+}
+
+void RadientDrawList::FilterByLayerMask(Uint64                          LayerMask,
+                                        std::vector<RadientDrawableID>& DrawableIDs) const
+{
+    VERIFY_EXPR(m_VisibilityMasks.size() == m_Items.size());
+
+    if (LayerMask == 0)
+        return;
+
+    DrawableIDs.reserve(DrawableIDs.size() + m_Items.size());
+    for (size_t i = 0; i < m_VisibilityMasks.size(); ++i)
+    {
+        if ((m_VisibilityMasks[i] & LayerMask) != 0)
+            DrawableIDs.push_back(m_Items[i].DrawableID);
+    }
+}
+
 void RadientDrawLists::Clear()
 {
     for (RadientDrawList& DrawList : m_DrawLists)
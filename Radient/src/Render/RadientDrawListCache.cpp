@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientDrawListCache.hpp"
+
+#include <algorithm>
+
+namespace Diligent
+{
+
+RadientDrawListCache::Entry& RadientDrawListCache::Get(const Key& EntryKey, Uint64 Dependency, bool& IsValid)
+{
+    auto EntryIt = std::find_if(m_Entries.begin(), m_Entries.end(),
+                                [&EntryKey](const Entry& Item) {
+                                    return Item.EntryKey == EntryKey;
+                                });
+    if (EntryIt == m_Entries.end())
+    {
+        // Keys of views that are no longer rendered would otherwise accumulate
+        if (m_Entries.size() >= MaxEntryCount)
+            m_Entries.clear();
+
+        m_Entries.emplace_back();
+        EntryIt           = m_Entries.end() - 1;
+        EntryIt->EntryKey = EntryKey;
+        EntryIt->Revision = 0;
+    }
+
+    Entry& CacheEntry = *EntryIt;
+
+    IsValid = CacheEntry.Revision == m_Revision &&
+        CacheEntry.Dependency == Dependency &&
+        CacheEntry.IsComplete;
+    if (!IsValid)
+    {
+        CacheEntry.Revision   = m_Revision;
+        CacheEntry.Dependency = Dependency;
+        CacheEntry.BuildID    = m_NextBuildID++;
+        CacheEntry.IsComplete = true;
+        CacheEntry.DrawableIDs.clear();
+    }
+
+    return CacheEntry;
+}
+
+} // namespace Diligent
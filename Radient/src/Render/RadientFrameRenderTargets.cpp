@@ -26,6 +26,8 @@
 
 #include "Render/RadientFrameRenderTargets.hpp"
 
+#include "Render/RadientResolutionController.hpp"
+
 namespace Diligent
 {
 
@@ -37,18 +39,58 @@ RADIENT_STATUS RadientFrameRenderTargets::Prepare(IRenderDevice* pDevice, IRadie
     if (Desc.Size.Width == 0 || Desc.Size.Height == 0)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
-    m_pColorRTV = Target.GetColorRTV();
-    m_pDepthDSV = Target.GetDepthDSV();
+    m_pOutputRTV       = Target.GetColorRTV();
+    m_pDepthDSV        = Target.GetDepthDSV();
+    m_pColorRTV        = m_pOutputRTV;
+    m_pSceneColorSRV   = nullptr;
+    m_SceneColorTarget = RadientTransientTargetPool::InvalidIndex;
 
     if (m_Size != Desc.Size)
     {
         m_Size = Desc.Size;
         ++m_Version;
     }
+    m_RenderSize = m_Size;
 
     return RADIENT_STATUS_OK;
 }
 
+void RadientFrameRenderTargets::DeclareSceneColor(RadientTransientTargetPool& Pool, Uint32 ScenePass, Uint32 PostProcessPass)
+{
+    if (m_pOutputRTV == nullptr)
+        return;
+
+    RadientTransientTargetDesc SceneColorDesc;
+    SceneColorDesc.Format = HDRColorFormat;
+    SceneColorDesc.Width  = m_Size.Width;
+    SceneColorDesc.Height = m_Size.Height;
+
+    m_SceneColorTarget = Pool.DeclareTarget(SceneColorDesc, "Radient HDR scene color", ScenePass, PostProcessPass);
+}
+
+void RadientFrameRenderTargets::ResolveTransientTargets(const RadientTransientTargetPool& Pool)
+{
+    if (m_SceneColorTarget == RadientTransientTargetPool::InvalidIndex || Pool.GetTexture(m_SceneColorTarget) == nullptr)
+        return;
+
+    m_pColorRTV      = Pool.GetRTV(m_SceneColorTarget);
+    m_pSceneColorSRV = Pool.GetSRV(m_SceneColorTarget);
+}
+
+void RadientFrameRenderTargets::SetRenderScale(float Scale)
+{
+    m_RenderSize = IsHDR() ? RadientResolutionController::GetRenderSize(m_Size, Scale) : m_Size;
+}
+
+void RadientFrameRenderTargets::SetViewport(IDeviceContext* pContext) const
+{
+    if (m_RenderSize == m_Size)
+        return;
+
+    Viewport VP{0, 0, static_cast<float>(m_RenderSize.Width), static_cast<float>(m_RenderSize.Height)};
+    pContext->SetViewports(1, &VP, m_Size.Width, m_Size.Height);
+}
+
 const RadientExtent2D& RadientFrameRenderTargets::GetSize() const
 {
     return m_Size;
@@ -69,4 +111,33 @@ ITextureView* RadientFrameRenderTargets::GetDepthDSV() const
     return m_pDepthDSV;
 }
 
+ITextureView* RadientFrameRenderTargets::GetOutputRTV() const
+{
+    return m_pOutputRTV;
+}
+
+ITextureView* RadientFrameRenderTargets::GetSceneColorSRV() const
+{
+    return m_pSceneColorSRV;
+}
+
+void RadientFrameRenderTargets::ClearSceneColor(IDeviceContext* pContext) const
+{
+    if (m_pSceneColorSRV == nullptr)
+        return;
+
+    constexpr float ClearColor[] = {0, 0, 0, 0};
+    pContext->ClearRenderTarget(m_pColorRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+bool RadientFrameRenderTargets::HasSameFormats(const RadientFrameRenderTargets& Other) const
+{
+    const auto GetFormat = [](ITextureView* pView) {
+        return pView != nullptr ? pView->GetDesc().Format : TEX_FORMAT_UNKNOWN;
+    };
+
+    return GetFormat(m_pColorRTV) == GetFormat(Other.m_pColorRTV) &&
+        GetFormat(m_pDepthDSV) == GetFormat(Other.m_pDepthDSV);
+}
+
 } // namespace Diligent
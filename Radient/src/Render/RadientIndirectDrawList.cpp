@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientIndirectDrawList.hpp"
+
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Diligent
+{
+
+namespace
+{
+
+bool IsBoxVisible(const HLSL::RadientIndirectCullAttribs& Attribs,
+                  const float3&                           BoundsMin,
+                  const float3&                           BoundsMax)
+{
+    for (const float4& Plane : Attribs.FrustumPlanes)
+    {
+        // The box corner that is farthest along the plane normal
+        const float3 Corner{
+            Plane.x >= 0.f ? BoundsMax.x : BoundsMin.x,
+            Plane.y >= 0.f ? BoundsMax.y : BoundsMin.y,
+            Plane.z >= 0.f ? BoundsMax.z : BoundsMin.z,
+        };
+        if (Plane.x * Corner.x + Plane.y * Corner.y + Plane.z * Corner.z + Plane.w < 0.f)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool RadientIndirectDrawList::Build(const std::vector<RadientIndirectDrawItem>& Items, Uint32 MaxBucketSize)
+{
+    VERIFY(MaxBucketSize > 0, "Maximum bucket size must not be zero");
+    MaxBucketSize = std::max(MaxBucketSize, 1u);
+
+    m_Buckets.clear();
+    m_PrevRecords.swap(m_Records);
+    m_Records.clear();
+
+    m_DrawItems.resize(Items.size());
+    for (size_t i = 0; i < Items.size(); ++i)
+        m_DrawItems[i] = static_cast<Uint32>(i);
+    std::stable_sort(m_DrawItems.begin(), m_DrawItems.end(),
+                     [&Items](Uint32 LhsItem, Uint32 RhsItem) {
+                         const RadientIndirectDrawItem& Lhs = Items[LhsItem];
+                         const RadientIndirectDrawItem& Rhs = Items[RhsItem];
+                         if (Lhs.StateIndex != Rhs.StateIndex)
+                             return Lhs.StateIndex < Rhs.StateIndex;
+                         return Lhs.MaterialIndex < Rhs.MaterialIndex;
+                     });
+
+    m_Records.reserve(Items.size());
+    for (Uint32 DrawIdx = 0; DrawIdx < m_DrawItems.size(); ++DrawIdx)
+    {
+        const RadientIndirectDrawItem& Item = Items[m_DrawItems[DrawIdx]];
+        if (m_Buckets.empty() ||
+            m_Buckets.back().StateIndex != Item.StateIndex ||
+            m_Buckets.back().MaterialIndex != Item.MaterialIndex ||
+            m_Buckets.back().DrawCount == MaxBucketSize)
+        {
+            m_Buckets.push_back({Item.StateIndex, Item.MaterialIndex, DrawIdx, 0});
+        }
+        Bucket& DrawBucket = m_Buckets.back();
+
+        HLSL::RadientIndirectDrawRecord Record{};
+        Record.BoundsMin  = float3{Item.Bounds.Min.x, Item.Bounds.Min.y, Item.Bounds.Min.z};
+        Record.IndexCount = Item.IndexCount;
+        Record.BoundsMax  = float3{Item.Bounds.Max.x, Item.Bounds.Max.y, Item.Bounds.Max.z};
+        Record.FirstIndex = Item.FirstIndex;
+        Record.BaseVertex = Item.BaseVertex;
+        Record.Bucket     = static_cast<Uint32>(m_Buckets.size() - 1);
+        Record.ArgsIndex  = DrawIdx;
+        Record.Slot       = DrawBucket.DrawCount++;
+        m_Records.push_back(Record);
+    }
+
+    return m_Records.size() != m_PrevRecords.size() ||
+        (!m_Records.empty() && std::memcmp(m_Records.data(), m_PrevRecords.data(), static_cast<size_t>(GetRecordsSize())) != 0);
+}
+
+void RadientIndirectDrawList::Clear()
+{
+    m_Buckets.clear();
+    m_Records.clear();
+    m_PrevRecords.clear();
+    m_DrawItems.clear();
+}
+
+HLSL::RadientIndirectCullAttribs GetRadientIndirectCullAttribs(const float4x4& ViewProj,
+                                                               bool            NDCMinusOneToOne,
+                                                               Uint32          RecordCount)
+{
+    // Clip-space coordinates are the dot products of the homogeneous point with the matrix columns
+    auto GetColumn = [&ViewProj](int Col) {
+        return float4{ViewProj.m[0][Col], ViewProj.m[1][Col], ViewProj.m[2][Col], ViewProj.m[3][Col]};
+    };
+    const float4 X = GetColumn(0);
+    const float4 Y = GetColumn(1);
+    const float4 Z = GetColumn(2);
+    const float4 W = GetColumn(3);
+
+    HLSL::RadientIndirectCullAttribs Attribs{};
+    Attribs.FrustumPlanes[0] = W + X; // Left
+    Attribs.FrustumPlanes[1] = W - X; // Right
+    Attribs.FrustumPlanes[2] = W + Y; // Bottom
+    Attribs.FrustumPlanes[3] = W - Y; // Top
+    Attribs.FrustumPlanes[4] = NDCMinusOneToOne ? W + Z : Z; // Near
+    Attribs.FrustumPlanes[5] = W - Z;                        // Far
+    for (float4& Plane : Attribs.FrustumPlanes)
+    {
+        const float Length = std::sqrt(Plane.x * Plane.x + Plane.y * Plane.y + Plane.z * Plane.z);
+        if (Length > 0.f)
+            Plane = Plane / Length;
+    }
+    Attribs.RecordCount = RecordCount;
+
+    return Attribs;
+}
+
+void CullRadientIndirectDraws(const HLSL::RadientIndirectCullAttribs& Attribs,
+                              const HLSL::RadientIndirectDrawRecord*  pRecords,
+                              Uint32*                                 pDrawArgs,
+                              Uint32*                                 pDrawCounts)
+{
+    for (Uint32 RecordIdx = 0; RecordIdx < Attribs.RecordCount; ++RecordIdx)
+    {
+        const HLSL::RadientIndirectDrawRecord& Record = pRecords[RecordIdx];
+
+        // Records with inverted bounds have unknown bounds and are always drawn
+        const bool IsVisible =
+            Record.BoundsMin.x > Record.BoundsMax.x ||
+            Record.BoundsMin.y > Record.BoundsMax.y ||
+            Record.BoundsMin.z > Record.BoundsMax.z ||
+            IsBoxVisible(Attribs, Record.BoundsMin, Record.BoundsMax);
+
+        Uint32* const pArgs = pDrawArgs + size_t{Record.ArgsIndex} * RADIENT_INDIRECT_DRAW_ARGS_WORDS;
+        pArgs[0]            = Record.IndexCount;
+        pArgs[1]            = IsVisible ? 1u : 0u;
+        pArgs[2]            = Record.FirstIndex;
+        pArgs[3]            = Record.BaseVertex;
+        pArgs[4]            = 0;
+
+        if (IsVisible)
+            pDrawCounts[Record.Bucket] = std::max(pDrawCounts[Record.Bucket], Record.Slot + 1);
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,423 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientLightClusters.hpp"
+
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Returns the range of grid tiles whose cluster AABBs in the [Depth0, Depth1] slice may overlap
+// the [Center - Radius, Center + Radius] interval along one screen axis.
+// The AABB of tile i spans [A * S(A), B * T(B)] / ProjScale, where [A, B] is the NDC range of the tile,
+// S(A) = A < 0 ? Depth1 : Depth0 and T(B) = B > 0 ? Depth1 : Depth0 for perspective projection,
+// and S = T = 1 for orthographic projection.
+bool GetTileRange(float   Center,
+                  float   Radius,
+                  float   ProjScale,
+                  float   Depth0,
+                  float   Depth1,
+                  bool    Orthographic,
+                  Uint32  GridSize,
+                  Uint32& MinTile,
+                  Uint32& MaxTile)
+{
+    const float Hi = (Center + Radius) * ProjScale;
+    const float Lo = (Center - Radius) * ProjScale;
+
+    float MaxA = Hi;
+    float MinB = Lo;
+    if (!Orthographic)
+    {
+        MaxA = Hi >= 0.f ? Hi / Depth0 : Hi / Depth1;
+        MinB = Lo <= 0.f ? Lo / Depth0 : Lo / Depth1;
+    }
+    if (MaxA < -1.f || MinB > 1.f)
+        return false;
+
+    // Expand the range by one tile to be robust to rounding at tile boundaries.
+    // The exact test is performed per cluster.
+    const float fGridSize = static_cast<float>(GridSize);
+    const float fMaxTile  = std::floor((std::min(MaxA, 1.f) + 1.f) * 0.5f * fGridSize) + 1.f;
+    const float fMinTile  = std::ceil((std::max(MinB, -1.f) + 1.f) * 0.5f * fGridSize) - 2.f;
+
+    MinTile = static_cast<Uint32>(clamp(fMinTile, 0.f, fGridSize - 1.f));
+    MaxTile = static_cast<Uint32>(clamp(fMaxTile, 0.f, fGridSize - 1.f));
+    return MinTile <= MaxTile;
+}
+
+struct ClusterLightParams
+{
+    float PosX;
+    float PosY;
+    float PosZ;
+    float Range;
+    float DirX;
+    float DirY;
+    float DirZ;
+    float ConeCos;
+    float ConeSin;
+};
+
+// Tests a light against Count consecutive clusters and writes 0/1 results to pHits.
+// The loop body is branch-free so that the compiler can vectorize it.
+void TestClusterRow(const ClusterLightParams& Light,
+                    const float*              pMinX,
+                    const float*              pMinY,
+                    const float*              pMinZ,
+                    const float*              pMaxX,
+                    const float*              pMaxY,
+                    const float*              pMaxZ,
+                    const float*              pCenterX,
+                    const float*              pCenterY,
+                    const float*              pCenterZ,
+                    const float*              pRadius,
+                    Uint32                    Count,
+                    Uint8*                    pHits)
+{
+    const float RangeSq = Light.Range * Light.Range;
+    // Point lights use ConeCos == -1 and always pass the cone test.
+    const bool IsSpot = Light.ConeCos > -1.f;
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        // Sphere vs AABB
+        const float dx     = std::max(std::max(pMinX[i] - Light.PosX, Light.PosX - pMaxX[i]), 0.f);
+        const float dy     = std::max(std::max(pMinY[i] - Light.PosY, Light.PosY - pMaxY[i]), 0.f);
+        const float dz     = std::max(std::max(pMinZ[i] - Light.PosZ, Light.PosZ - pMaxZ[i]), 0.f);
+        const bool  Sphere = dx * dx + dy * dy + dz * dz <= RangeSq;
+
+        // Cone vs cluster bounding sphere
+        const float vx       = pCenterX[i] - Light.PosX;
+        const float vy       = pCenterY[i] - Light.PosY;
+        const float vz       = pCenterZ[i] - Light.PosZ;
+        const float VLenSq   = vx * vx + vy * vy + vz * vz;
+        const float V1Len    = vx * Light.DirX + vy * Light.DirY + vz * Light.DirZ;
+        const float PerpLen  = std::sqrt(std::max(VLenSq - V1Len * V1Len, 0.f));
+        const float ConeDist = Light.ConeCos * PerpLen - V1Len * Light.ConeSin;
+        const bool  Cone =
+            (ConeDist <= pRadius[i]) &
+            (V1Len <= pRadius[i] + Light.Range) &
+            (V1Len >= -pRadius[i]);
+
+        pHits[i] = static_cast<Uint8>(Sphere & (Cone | !IsSpot));
+    }
+}
+
+} // namespace
+
+void RadientLightClusters::SetGrid(const RadientLightClusterGridDesc& Desc)
+{
+    m_Desc = Desc;
+
+    VERIFY(Desc.GridSizeX > 0 && Desc.GridSizeY > 0 && Desc.GridSizeZ > 0, "Light cluster grid size must not be zero");
+    VERIFY(Desc.NearZ > 0 && Desc.FarZ > Desc.NearZ, "Invalid light cluster depth range");
+    VERIFY(Desc.ProjScaleX > 0 && Desc.ProjScaleY > 0, "Projection scale must be positive");
+    m_Desc.GridSizeX  = std::max(m_Desc.GridSizeX, 1u);
+    m_Desc.GridSizeY  = std::max(m_Desc.GridSizeY, 1u);
+    m_Desc.GridSizeZ  = std::max(m_Desc.GridSizeZ, 1u);
+    m_Desc.NearZ      = std::max(m_Desc.NearZ, 1e-6f);
+    m_Desc.FarZ       = std::max(m_Desc.FarZ, m_Desc.NearZ * 2.f);
+    m_Desc.ProjScaleX = m_Desc.ProjScaleX > 0 ? m_Desc.ProjScaleX : 1.f;
+    m_Desc.ProjScaleY = m_Desc.ProjScaleY > 0 ? m_Desc.ProjScaleY : 1.f;
+
+    const float LogDepthRange = std::log(m_Desc.FarZ / m_Desc.NearZ);
+    m_DepthSliceScale         = static_cast<float>(m_Desc.GridSizeZ) / LogDepthRange;
+    m_DepthSliceBias          = -static_cast<float>(m_Desc.GridSizeZ) * std::log(m_Desc.NearZ) / LogDepthRange;
+
+    ComputeClusterBounds();
+
+    m_ClusterRanges.assign(GetClusterCount(), RadientLightClusterRange{});
+    m_LightIndices.clear();
+}
+
+void RadientLightClusters::ClearLights()
+{
+    m_PosX.clear();
+    m_PosY.clear();
+    m_PosZ.clear();
+    m_Range.clear();
+    m_DirX.clear();
+    m_DirY.clear();
+    m_DirZ.clear();
+    m_ConeCos.clear();
+    m_ConeSin.clear();
+}
+
+Uint32 RadientLightClusters::AddPointLight(const float3& Position, float Range)
+{
+    return AddSpotLight(Position, float3{0, 0, 1}, Range, PI_F);
+}
+
+Uint32 RadientLightClusters::AddSpotLight(const float3& Position, const float3& Direction, float Range, float OuterConeAngle)
+{
+    VERIFY(Range > 0, "Clustered lights must have a bounded range");
+
+    const Uint32 LightIndex = GetLightCount();
+    m_PosX.push_back(Position.x);
+    m_PosY.push_back(Position.y);
+    m_PosZ.push_back(Position.z);
+    m_Range.push_back(std::max(Range, 0.f));
+    m_DirX.push_back(Direction.x);
+    m_DirY.push_back(Direction.y);
+    m_DirZ.push_back(Direction.z);
+    if (OuterConeAngle >= PI_F)
+    {
+        m_ConeCos.push_back(-1.f);
+        m_ConeSin.push_back(0.f);
+    }
+    else
+    {
+        m_ConeCos.push_back(std::cos(OuterConeAngle));
+        m_ConeSin.push_back(std::sin(OuterConeAngle));
+    }
+    return LightIndex;
+}
+
+float RadientLightClusters::GetSliceDepth(Uint32 Slice) const
+{
+    if (Slice >= m_Desc.GridSizeZ)
+        return m_Desc.FarZ;
+
+    return m_Desc.NearZ * std::pow(m_Desc.FarZ / m_Desc.NearZ, static_cast<float>(Slice) / static_cast<float>(m_Desc.GridSizeZ));
+}
+
+Uint32 RadientLightClusters::GetDepthSlice(float Depth) const
+{
+    const float Slice = std::log(std::max(Depth, 1e-6f)) * m_DepthSliceScale + m_DepthSliceBias;
+    return static_cast<Uint32>(clamp(Slice, 0.f, static_cast<float>(m_Desc.GridSizeZ - 1)));
+}
+
+void RadientLightClusters::ComputeClusterBounds()
+{
+    const Uint32 ClusterCount = GetClusterCount();
+    for (std::vector<float>* pBounds : {&m_ClusterMinX, &m_ClusterMinY, &m_ClusterMinZ,
+                                        &m_ClusterMaxX, &m_ClusterMaxY, &m_ClusterMaxZ,
+                                        &m_ClusterCenterX, &m_ClusterCenterY, &m_ClusterCenterZ, &m_ClusterRadius})
+    {
+        pBounds->resize(ClusterCount);
+    }
+
+    const float TileSizeX = 2.f / static_cast<float>(m_Desc.GridSizeX);
+    const float TileSizeY = 2.f / static_cast<float>(m_Desc.GridSizeY);
+    for (Uint32 z = 0; z < m_Desc.GridSizeZ; ++z)
+    {
+        const float Depth0 = GetSliceDepth(z);
+        const float Depth1 = GetSliceDepth(z + 1);
+        for (Uint32 y = 0; y < m_Desc.GridSizeY; ++y)
+        {
+            // Tile rows are counted from the top of the viewport
+            const float Top    = 1.f - TileSizeY * static_cast<float>(y);
+            const float Bottom = Top - TileSizeY;
+            for (Uint32 x = 0; x < m_Desc.GridSizeX; ++x)
+            {
+                const float Left  = -1.f + TileSizeX * static_cast<float>(x);
+                const float Right = Left + TileSizeX;
+
+                float3 Min, Max;
+                if (m_Desc.Orthographic)
+                {
+                    Min = float3{Left / m_Desc.ProjScaleX, Bottom / m_Desc.ProjScaleY, Depth0};
+                    Max = float3{Right / m_Desc.ProjScaleX, Top / m_Desc.ProjScaleY, Depth1};
+                }
+                else
+                {
+                    Min = float3{std::min(Left * Depth0, Left * Depth1) / m_Desc.ProjScaleX,
+                                 std::min(Bottom * Depth0, Bottom * Depth1) / m_Desc.ProjScaleY,
+                                 Depth0};
+                    Max = float3{std::max(Right * Depth0, Right * Depth1) / m_Desc.ProjScaleX,
+                                 std::max(Top * Depth0, Top * Depth1) / m_Desc.ProjScaleY,
+                                 Depth1};
+                }
+
+                const Uint32 Idx   = GetClusterIndex(x, y, z);
+                m_ClusterMinX[Idx] = Min.x;
+                m_ClusterMinY[Idx] = Min.y;
+                m_ClusterMinZ[Idx] = Min.z;
+                m_ClusterMaxX[Idx] = Max.x;
+                m_ClusterMaxY[Idx] = Max.y;
+                m_ClusterMaxZ[Idx] = Max.z;
+
+                const float3 Center   = (Min + Max) * 0.5f;
+                m_ClusterCenterX[Idx] = Center.x;
+                m_ClusterCenterY[Idx] = Center.y;
+                m_ClusterCenterZ[Idx] = Center.z;
+                m_ClusterRadius[Idx]  = length(Max - Min) * 0.5f;
+            }
+        }
+    }
+}
+
+void RadientLightClusters::GetClusterBounds(Uint32 ClusterIndex, float3& Min, float3& Max) const
+{
+    VERIFY_EXPR(ClusterIndex < GetClusterCount());
+    Min = float3{m_ClusterMinX[ClusterIndex], m_ClusterMinY[ClusterIndex], m_ClusterMinZ[ClusterIndex]};
+    Max = float3{m_ClusterMaxX[ClusterIndex], m_ClusterMaxY[ClusterIndex], m_ClusterMaxZ[ClusterIndex]};
+}
+
+bool RadientLightClusters::FindCluster(const float3& Pos, Uint32& ClusterIndex) const
+{
+    if (Pos.z < m_Desc.NearZ || Pos.z > m_Desc.FarZ)
+        return false;
+
+    const float InvDepth = m_Desc.Orthographic ? 1.f : 1.f / Pos.z;
+    const float NdcX     = Pos.x * m_Desc.ProjScaleX * InvDepth;
+    const float NdcY     = Pos.y * m_Desc.ProjScaleY * InvDepth;
+    if (std::abs(NdcX) > 1.f || std::abs(NdcY) > 1.f)
+        return false;
+
+    const Uint32 X = std::min(static_cast<Uint32>((NdcX + 1.f) * 0.5f * static_cast<float>(m_Desc.GridSizeX)), m_Desc.GridSizeX - 1);
+    const Uint32 Y = std::min(static_cast<Uint32>((1.f - NdcY) * 0.5f * static_cast<float>(m_Desc.GridSizeY)), m_Desc.GridSizeY - 1);
+    ClusterIndex   = GetClusterIndex(X, Y, GetDepthSlice(Pos.z));
+    return true;
+}
+
+bool RadientLightClusters::LightIntersectsCluster(Uint32 LightIndex, Uint32 ClusterIndex) const
+{
+    VERIFY_EXPR(LightIndex < GetLightCount() && ClusterIndex < GetClusterCount());
+
+    const ClusterLightParams Light{
+        m_PosX[LightIndex],
+        m_PosY[LightIndex],
+        m_PosZ[LightIndex],
+        m_Range[LightIndex],
+        m_DirX[LightIndex],
+        m_DirY[LightIndex],
+        m_DirZ[LightIndex],
+        m_ConeCos[LightIndex],
+        m_ConeSin[LightIndex],
+    };
+
+    Uint8 Hit = 0;
+    TestClusterRow(Light,
+                   &m_ClusterMinX[ClusterIndex], &m_ClusterMinY[ClusterIndex], &m_ClusterMinZ[ClusterIndex],
+                   &m_ClusterMaxX[ClusterIndex], &m_ClusterMaxY[ClusterIndex], &m_ClusterMaxZ[ClusterIndex],
+                   &m_ClusterCenterX[ClusterIndex], &m_ClusterCenterY[ClusterIndex], &m_ClusterCenterZ[ClusterIndex],
+                   &m_ClusterRadius[ClusterIndex],
+                   1, &Hit);
+    return Hit != 0;
+}
+
+void RadientLightClusters::Bin()
+{
+    if (m_ClusterMinX.empty())
+        SetGrid(m_Desc);
+
+    const Uint32 ClusterCount = GetClusterCount();
+    const Uint32 LightCount   = GetLightCount();
+
+    m_HitClusters.clear();
+    m_HitLights.clear();
+    m_RowHits.resize(m_Desc.GridSizeX);
+
+    for (Uint32 LightIdx = 0; LightIdx < LightCount; ++LightIdx)
+    {
+        const ClusterLightParams Light{
+            m_PosX[LightIdx],
+            m_PosY[LightIdx],
+            m_PosZ[LightIdx],
+            m_Range[LightIdx],
+            m_DirX[LightIdx],
+            m_DirY[LightIdx],
+            m_DirZ[LightIdx],
+            m_ConeCos[LightIdx],
+            m_ConeSin[LightIdx],
+        };
+
+        const float MinDepth = Light.PosZ - Light.Range;
+        const float MaxDepth = Light.PosZ + Light.Range;
+        if (MaxDepth < m_Desc.NearZ || MinDepth > m_Desc.FarZ)
+            continue;
+
+        // Expand the slice range by one to be robust to rounding at slice boundaries
+        const Uint32 MinSlice = std::max(GetDepthSlice(MinDepth), 1u) - 1u;
+        const Uint32 MaxSlice = std::min(GetDepthSlice(MaxDepth) + 1u, m_Desc.GridSizeZ - 1u);
+        for (Uint32 z = MinSlice; z <= MaxSlice; ++z)
+        {
+            const float Depth0 = GetSliceDepth(z);
+            const float Depth1 = GetSliceDepth(z + 1);
+
+            Uint32 MinX = 0, MaxX = 0;
+            Uint32 MinY = 0, MaxY = 0;
+            if (!GetTileRange(Light.PosX, Light.Range, m_Desc.ProjScaleX, Depth0, Depth1, m_Desc.Orthographic, m_Desc.GridSizeX, MinX, MaxX))
+                continue;
+            // Tile rows grow downwards, so flip the Y axis
+            if (!GetTileRange(-Light.PosY, Light.Range, m_Desc.ProjScaleY, Depth0, Depth1, m_Desc.Orthographic, m_Desc.GridSizeY, MinY, MaxY))
+                continue;
+
+            const Uint32 RowLength = MaxX - MinX + 1;
+            for (Uint32 y = MinY; y <= MaxY; ++y)
+            {
+                const Uint32 FirstCluster = GetClusterIndex(MinX, y, z);
+                TestClusterRow(Light,
+                               &m_ClusterMinX[FirstCluster], &m_ClusterMinY[FirstCluster], &m_ClusterMinZ[FirstCluster],
+                               &m_ClusterMaxX[FirstCluster], &m_ClusterMaxY[FirstCluster], &m_ClusterMaxZ[FirstCluster],
+                               &m_ClusterCenterX[FirstCluster], &m_ClusterCenterY[FirstCluster], &m_ClusterCenterZ[FirstCluster],
+                               &m_ClusterRadius[FirstCluster],
+                               RowLength, m_RowHits.data());
+
+                for (Uint32 i = 0; i < RowLength; ++i)
+                {
+                    if (m_RowHits[i] != 0)
+                    {
+                        m_HitClusters.push_back(FirstCluster + i);
+                        m_HitLights.push_back(LightIdx);
+                    }
+                }
+            }
+        }
+    }
+
+    // Counting sort of the (cluster, light) pairs by cluster. Lights were processed in ascending
+    // order, so light indices within each cluster are sorted as well.
+    m_ClusterRanges.assign(ClusterCount, RadientLightClusterRange{});
+    for (const Uint32 ClusterIdx : m_HitClusters)
+        ++m_ClusterRanges[ClusterIdx].Count;
+
+    Uint32 Offset = 0;
+    for (RadientLightClusterRange& Range : m_ClusterRanges)
+    {
+        Range.Offset = Offset;
+        Offset += Range.Count;
+        Range.Count = 0;
+    }
+
+    m_LightIndices.resize(m_HitLights.size());
+    for (size_t i = 0; i < m_HitClusters.size(); ++i)
+    {
+        RadientLightClusterRange& Range = m_ClusterRanges[m_HitClusters[i]];
+        m_LightIndices[Range.Offset + Range.Count++] = m_HitLights[i];
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientMaterialTable.hpp"
+
+#include "Align.hpp"
+#include "HashUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Diligent
+{
+
+size_t RadientMaterialTable::SlotKey::Hasher::operator()(const SlotKey& Key) const
+{
+    return ComputeHash(Key.pMaterial, static_cast<Uint64>(Key.PSOFlags));
+}
+
+void RadientMaterialTable::SetLayout(Uint32 AttribsSize, Uint32 OffsetAlignment)
+{
+    const Uint32 SlotStride = AlignUp(std::max(AttribsSize, 1u), std::max(OffsetAlignment, 1u));
+    if (m_AttribsSize == AttribsSize && m_SlotStride == SlotStride)
+        return;
+
+    m_AttribsSize = AttribsSize;
+    m_SlotStride  = SlotStride;
+
+    m_Slots.clear();
+    m_FreeSlots.clear();
+    m_SlotIndices.clear();
+    m_Data.clear();
+    m_DirtySlots = {};
+    m_pBuffer.Release();
+}
+
+Uint32 RadientMaterialTable::Acquire(const GLTF::Material*   pMaterial,
+                                     PBR_Renderer::PSO_FLAGS PSOFlags,
+                                     const void*             pAttribs,
+                                     Uint32                  Size)
+{
+    if (m_SlotStride == 0 || pAttribs == nullptr || Size > m_AttribsSize)
+        return InvalidIndex;
+
+    const SlotKey Key{pMaterial, PSOFlags};
+
+    Uint32 Index = InvalidIndex;
+
+    auto IndexIt = m_SlotIndices.find(Key);
+    if (IndexIt != m_SlotIndices.end())
+    {
+        Index = IndexIt->second;
+    }
+    else
+    {
+        if (!m_FreeSlots.empty())
+        {
+            Index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            Index = static_cast<Uint32>(m_Slots.size());
+            m_Slots.emplace_back();
+            m_Data.resize(m_Data.size() + m_SlotStride);
+        }
+        m_Slots[Index].Key = Key;
+        m_SlotIndices.emplace(Key, Index);
+    }
+
+    Slot&  TableSlot = m_Slots[Index];
+    Uint8* pSlotData = &m_Data[GetSlotOffset(Index)];
+
+    // A new material may be allocated at the address of a released one that some drawables have not released yet,
+    // so an existing slot is compared with the attributes rather than trusted.
+    if (TableSlot.UseCount == 0 || std::memcmp(pSlotData, pAttribs, Size) != 0)
+    {
+        std::memcpy(pSlotData, pAttribs, Size);
+        std::memset(pSlotData + Size, 0, m_SlotStride - Size);
+        MarkDirty(Index);
+    }
+
+    ++TableSlot.UseCount;
+    return Index;
+}
+
+void RadientMaterialTable::Release(Uint32 Index)
+{
+    if (Index >= m_Slots.size())
+    {
+        VERIFY(Index == InvalidIndex, "Invalid material table slot index");
+        return;
+    }
+
+    Slot& TableSlot = m_Slots[Index];
+    VERIFY(TableSlot.UseCount > 0, "Material table slot is not used");
+    if (TableSlot.UseCount == 0 || --TableSlot.UseCount > 0)
+        return;
+
+    m_SlotIndices.erase(TableSlot.Key);
+    TableSlot.Key = {};
+    m_FreeSlots.push_back(Index);
+}
+
+RADIENT_STATUS RadientMaterialTable::CommitUpdates(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    if (pDevice == nullptr || pContext == nullptr)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+    if (m_SlotStride == 0)
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    // The buffer always holds at least one slot, so that the SRB has a valid range to bind
+    const Uint32 SlotCount    = std::max(GetSlotCount(), 1u);
+    const Uint64 RequiredSize = Uint64{m_SlotStride} * SlotCount;
+    if (!m_pBuffer || m_pBuffer->GetDesc().Size < RequiredSize)
+    {
+        // The buffer grows to the next power of two to avoid frequent reallocations
+        Uint32 Capacity = 16;
+        while (Capacity < SlotCount)
+            Capacity <<= 1u;
+
+        BufferDesc Desc;
+        Desc.Name      = "Radient material table";
+        Desc.Usage     = USAGE_DEFAULT;
+        Desc.BindFlags = BIND_UNIFORM_BUFFER;
+        Desc.Size      = Uint64{m_SlotStride} * Capacity;
+
+        m_pBuffer.Release();
+        pDevice->CreateBuffer(Desc, nullptr, &m_pBuffer);
+        if (!m_pBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create Radient material table buffer");
+            return RADIENT_STATUS_INVALID_OPERATION;
+        }
+        ++m_BufferVersion;
+
+        m_DirtySlots = {0, GetSlotCount()};
+    }
+
+    if (m_DirtySlots.IsEmpty())
+        return RADIENT_STATUS_OK;
+
+    if (pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D11)
+    {
+        // Direct3D11 does not support partial constant buffer updates
+        m_DirtySlots = {0, GetSlotCount()};
+    }
+
+    const Uint32 Offset = GetSlotOffset(m_DirtySlots.First);
+    const Uint32 Size   = GetSlotOffset(m_DirtySlots.End) - Offset;
+    pContext->UpdateBuffer(m_pBuffer, Offset, Size, &m_Data[Offset], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    ResetDirtySlots();
+
+    return RADIENT_STATUS_OK;
+}
+
+void RadientMaterialTable::MarkDirty(Uint32 Index)
+{
+    if (m_DirtySlots.IsEmpty())
+    {
+        m_DirtySlots = {Index, Index + 1};
+    }
+    else
+    {
+        m_DirtySlots.First = std::min(m_DirtySlots.First, Index);
+        m_DirtySlots.End   = std::max(m_DirtySlots.End, Index + 1);
+    }
+}
+
+} // namespace Diligent
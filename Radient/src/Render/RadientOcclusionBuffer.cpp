@@ -0,0 +1,383 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientOcclusionBuffer.hpp"
+
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Diligent
+{
+
+void RadientOcclusionBuffer::Begin(Uint32 Width, Uint32 Height, const float4x4& ViewProj)
+{
+    if (Width == 0 || Height == 0)
+        Width = Height = 0;
+
+    if (m_Width != Width || m_Height != Height)
+    {
+        m_Width      = Width;
+        m_Height     = Height;
+        m_TileCountX = (Width + TileSize - 1) / TileSize;
+        m_TileCountY = (Height + TileSize - 1) / TileSize;
+
+        m_Depth.assign(size_t{Width} * Height, 1.f);
+        m_TileTriangles.resize(GetTileCount());
+
+        m_Levels.clear();
+        Uint32 LevelWidth  = Width;
+        Uint32 LevelHeight = Height;
+        while (LevelWidth > 1 || LevelHeight > 1)
+        {
+            m_Levels.emplace_back();
+            Level& NewLevel = m_Levels.back();
+            NewLevel.Width  = (LevelWidth + 1) / 2;
+            NewLevel.Height = (LevelHeight + 1) / 2;
+            NewLevel.MinDepth.resize(size_t{NewLevel.Width} * NewLevel.Height);
+            NewLevel.MaxDepth.resize(size_t{NewLevel.Width} * NewLevel.Height);
+
+            LevelWidth  = NewLevel.Width;
+            LevelHeight = NewLevel.Height;
+        }
+    }
+
+    m_ViewProj = ViewProj;
+    m_Triangles.clear();
+    for (std::vector<Uint32>& TileTriangles : m_TileTriangles)
+        TileTriangles.clear();
+}
+
+void RadientOcclusionBuffer::AddOccluder(const float3*   pPositions,
+                                         Uint32          NumVertices,
+                                         const Uint32*   pIndices,
+                                         Uint32          NumIndices,
+                                         const float4x4& World)
+{
+    if (m_Width == 0 || pPositions == nullptr || pIndices == nullptr)
+        return;
+
+    const float4x4 WorldViewProj = World * m_ViewProj;
+
+    m_ClipPositions.resize(NumVertices);
+    for (Uint32 i = 0; i < NumVertices; ++i)
+        m_ClipPositions[i] = float4{pPositions[i], 1.f} * WorldViewProj;
+
+    for (Uint32 i = 0; i + 2 < NumIndices; i += 3)
+    {
+        const Uint32 I0 = pIndices[i + 0];
+        const Uint32 I1 = pIndices[i + 1];
+        const Uint32 I2 = pIndices[i + 2];
+        if (I0 >= NumVertices || I1 >= NumVertices || I2 >= NumVertices)
+        {
+            UNEXPECTED("Occluder index is out of range");
+            continue;
+        }
+        AddTriangle(m_ClipPositions[I0], m_ClipPositions[I1], m_ClipPositions[I2]);
+    }
+}
+
+void RadientOcclusionBuffer::AddOccluderBox(const RadientBounds& LocalBounds, const float4x4& World)
+{
+    const float3 Min{LocalBounds.Min.x, LocalBounds.Min.y, LocalBounds.Min.z};
+    const float3 Max{LocalBounds.Max.x, LocalBounds.Max.y, LocalBounds.Max.z};
+
+    // Corner i takes the maximum of the axis k if bit k of i is set
+    const float3 Corners[] =
+        {
+            float3{Min.x, Min.y, Min.z},
+            float3{Max.x, Min.y, Min.z},
+            float3{Min.x, Max.y, Min.z},
+            float3{Max.x, Max.y, Min.z},
+            float3{Min.x, Min.y, Max.z},
+            float3{Max.x, Min.y, Max.z},
+            float3{Min.x, Max.y, Max.z},
+            float3{Max.x, Max.y, Max.z},
+        };
+
+    // Triangles are rasterized regardless of their winding
+    static constexpr Uint32 Indices[] =
+        {
+            0, 1, 3, 0, 3, 2, // -Z
+            4, 5, 7, 4, 7, 6, // +Z
+            0, 1, 5, 0, 5, 4, // -Y
+            2, 3, 7, 2, 7, 6, // +Y
+            0, 2, 6, 0, 6, 4, // -X
+            1, 3, 7, 1, 7, 5, // +X
+        };
+
+    AddOccluder(Corners, _countof(Corners), Indices, _countof(Indices), World);
+}
+
+void RadientOcclusionBuffer::AddTriangle(const float4& V0, const float4& V1, const float4& V2)
+{
+    // Triangles in front of the near plane are skipped rather than clipped
+    if (V0.w <= 0.f || V1.w <= 0.f || V2.w <= 0.f ||
+        V0.z < 0.f || V1.z < 0.f || V2.z < 0.f)
+        return;
+
+    const float4* const Vertices[] = {&V0, &V1, &V2};
+
+    float X[3];
+    float Y[3];
+    float Z[3];
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const float4& V    = *Vertices[i];
+        const float   InvW = 1.f / V.w;
+
+        X[i] = (V.x * InvW * 0.5f + 0.5f) * static_cast<float>(m_Width);
+        Y[i] = (0.5f - V.y * InvW * 0.5f) * static_cast<float>(m_Height);
+        Z[i] = V.z * InvW;
+    }
+
+    // Pixels whose centers may be covered by the triangle
+    const float MinX = std::max(std::ceil(std::min({X[0], X[1], X[2]}) - 0.5f), 0.f);
+    const float MinY = std::max(std::ceil(std::min({Y[0], Y[1], Y[2]}) - 0.5f), 0.f);
+    const float MaxX = std::min(std::floor(std::max({X[0], X[1], X[2]}) - 0.5f), static_cast<float>(m_Width - 1));
+    const float MaxY = std::min(std::floor(std::max({Y[0], Y[1], Y[2]}) - 0.5f), static_cast<float>(m_Height - 1));
+    if (!(MinX <= MaxX && MinY <= MaxY))
+        return;
+
+    float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+    if (!(std::abs(Area) > 0.f))
+        return;
+
+    // Edge function i is positive on the side of vertex i and is zero on the opposite edge
+    Triangle Tri;
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const Uint32 A = (i + 1) % 3;
+        const Uint32 B = (i + 2) % 3;
+
+        Tri.EdgeA[i] = Y[A] - Y[B];
+        Tri.EdgeB[i] = X[B] - X[A];
+        Tri.EdgeC[i] = -(Tri.EdgeA[i] * X[A] + Tri.EdgeB[i] * Y[A]);
+    }
+    if (Area < 0.f)
+    {
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            Tri.EdgeA[i] = -Tri.EdgeA[i];
+            Tri.EdgeB[i] = -Tri.EdgeB[i];
+            Tri.EdgeC[i] = -Tri.EdgeC[i];
+        }
+        Area = -Area;
+    }
+
+    // Depth interpolated with the barycentric coordinates, i.e. the edge functions divided by the area
+    const float InvArea = 1.f / Area;
+    Tri.DepthA          = (Z[0] * Tri.EdgeA[0] + Z[1] * Tri.EdgeA[1] + Z[2] * Tri.EdgeA[2]) * InvArea;
+    Tri.DepthB          = (Z[0] * Tri.EdgeB[0] + Z[1] * Tri.EdgeB[1] + Z[2] * Tri.EdgeB[2]) * InvArea;
+    Tri.DepthC          = (Z[0] * Tri.EdgeC[0] + Z[1] * Tri.EdgeC[1] + Z[2] * Tri.EdgeC[2]) * InvArea;
+
+    Tri.MinX = static_cast<Int32>(MinX);
+    Tri.MinY = static_cast<Int32>(MinY);
+    Tri.MaxX = static_cast<Int32>(MaxX);
+    Tri.MaxY = static_cast<Int32>(MaxY);
+
+    const Uint32 TriangleIndex = static_cast<Uint32>(m_Triangles.size());
+    m_Triangles.push_back(Tri);
+
+    for (Int32 TileY = Tri.MinY / static_cast<Int32>(TileSize); TileY <= Tri.MaxY / static_cast<Int32>(TileSize); ++TileY)
+    {
+        for (Int32 TileX = Tri.MinX / static_cast<Int32>(TileSize); TileX <= Tri.MaxX / static_cast<Int32>(TileSize); ++TileX)
+            m_TileTriangles[TileY * m_TileCountX + TileX].push_back(TriangleIndex);
+    }
+}
+
+void RadientOcclusionBuffer::RasterizeTile(Uint32 Tile)
+{
+    VERIFY_EXPR(Tile < GetTileCount());
+
+    const Int32 TileX0 = static_cast<Int32>((Tile % m_TileCountX) * TileSize);
+    const Int32 TileY0 = static_cast<Int32>((Tile / m_TileCountX) * TileSize);
+    const Int32 TileX1 = std::min(TileX0 + static_cast<Int32>(TileSize), static_cast<Int32>(m_Width)) - 1;
+    const Int32 TileY1 = std::min(TileY0 + static_cast<Int32>(TileSize), static_cast<Int32>(m_Height)) - 1;
+
+    for (Int32 y = TileY0; y <= TileY1; ++y)
+    {
+        float* const pRow = &m_Depth[size_t{static_cast<Uint32>(y)} * m_Width];
+        std::fill(pRow + TileX0, pRow + TileX1 + 1, 1.f);
+    }
+
+    for (const Uint32 TriangleIndex : m_TileTriangles[Tile])
+    {
+        const Triangle& Tri = m_Triangles[TriangleIndex];
+
+        const Int32 X0 = std::max(Tri.MinX, TileX0);
+        const Int32 Y0 = std::max(Tri.MinY, TileY0);
+        const Int32 X1 = std::min(Tri.MaxX, TileX1);
+        const Int32 Y1 = std::min(Tri.MaxY, TileY1);
+
+        for (Int32 y = Y0; y <= Y1; ++y)
+        {
+            const float PixelY = static_cast<float>(y) + 0.5f;
+
+            const float RowEdge0 = Tri.EdgeB[0] * PixelY + Tri.EdgeC[0];
+            const float RowEdge1 = Tri.EdgeB[1] * PixelY + Tri.EdgeC[1];
+            const float RowEdge2 = Tri.EdgeB[2] * PixelY + Tri.EdgeC[2];
+            const float RowDepth = Tri.DepthB * PixelY + Tri.DepthC;
+
+            float* const pRow = &m_Depth[size_t{static_cast<Uint32>(y)} * m_Width];
+
+            // The loop body has no branches, so that compilers evaluate the edge functions
+            // of several pixels at once with SIMD instructions.
+            for (Int32 x = X0; x <= X1; ++x)
+            {
+                const float PixelX = static_cast<float>(x) + 0.5f;
+
+                const float Edge0 = Tri.EdgeA[0] * PixelX + RowEdge0;
+                const float Edge1 = Tri.EdgeA[1] * PixelX + RowEdge1;
+                const float Edge2 = Tri.EdgeA[2] * PixelX + RowEdge2;
+                const float Depth = Tri.DepthA * PixelX + RowDepth;
+
+                const bool Covered = (Edge0 >= 0.f) & (Edge1 >= 0.f) & (Edge2 >= 0.f) & (Depth < pRow[x]);
+                pRow[x]            = Covered ? Depth : pRow[x];
+            }
+        }
+    }
+}
+
+void RadientOcclusionBuffer::BuildHierarchy()
+{
+    const float* pSrcMin   = m_Depth.data();
+    const float* pSrcMax   = m_Depth.data();
+    Uint32       SrcWidth  = m_Width;
+    Uint32       SrcHeight = m_Height;
+
+    for (Level& Dst : m_Levels)
+    {
+        for (Uint32 y = 0; y < Dst.Height; ++y)
+        {
+            // The last row and column of odd-sized levels are reduced from a single texel
+            const size_t Row0 = size_t{y * 2} * SrcWidth;
+            const size_t Row1 = size_t{std::min(y * 2 + 1, SrcHeight - 1)} * SrcWidth;
+            for (Uint32 x = 0; x < Dst.Width; ++x)
+            {
+                const size_t Col0 = x * 2;
+                const size_t Col1 = std::min(x * 2 + 1, SrcWidth - 1);
+
+                const size_t DstIdx = size_t{y} * Dst.Width + x;
+                Dst.MinDepth[DstIdx] = std::min({pSrcMin[Row0 + Col0], pSrcMin[Row0 + Col1], pSrcMin[Row1 + Col0], pSrcMin[Row1 + Col1]});
+                Dst.MaxDepth[DstIdx] = std::max({pSrcMax[Row0 + Col0], pSrcMax[Row0 + Col1], pSrcMax[Row1 + Col0], pSrcMax[Row1 + Col1]});
+            }
+        }
+
+        pSrcMin   = Dst.MinDepth.data();
+        pSrcMax   = Dst.MaxDepth.data();
+        SrcWidth  = Dst.Width;
+        SrcHeight = Dst.Height;
+    }
+}
+
+bool RadientOcclusionBuffer::IsOccluded(const RadientBounds& LocalBounds, const float4x4& World) const
+{
+    if (m_Width == 0)
+        return false;
+
+    const float4x4 WorldViewProj = World * m_ViewProj;
+
+    float MinX = +std::numeric_limits<float>::max();
+    float MinY = +std::numeric_limits<float>::max();
+    float MaxX = -std::numeric_limits<float>::max();
+    float MaxY = -std::numeric_limits<float>::max();
+    float MinZ = +std::numeric_limits<float>::max();
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const float3 Corner{
+            (i & 1u) != 0 ? LocalBounds.Max.x : LocalBounds.Min.x,
+            (i & 2u) != 0 ? LocalBounds.Max.y : LocalBounds.Min.y,
+            (i & 4u) != 0 ? LocalBounds.Max.z : LocalBounds.Min.z,
+        };
+        const float4 Pos = float4{Corner, 1.f} * WorldViewProj;
+        if (Pos.w <= 0.f || Pos.z < 0.f)
+            return false;
+
+        const float InvW = 1.f / Pos.w;
+        const float X    = (Pos.x * InvW * 0.5f + 0.5f) * static_cast<float>(m_Width);
+        const float Y    = (0.5f - Pos.y * InvW * 0.5f) * static_cast<float>(m_Height);
+
+        MinX = std::min(MinX, X);
+        MinY = std::min(MinY, Y);
+        MaxX = std::max(MaxX, X);
+        MaxY = std::max(MaxY, Y);
+        MinZ = std::min(MinZ, Pos.z * InvW);
+    }
+
+    // Pixels touched by the screen rectangle of the box
+    const float X0 = std::max(std::floor(MinX), 0.f);
+    const float Y0 = std::max(std::floor(MinY), 0.f);
+    const float X1 = std::min(std::floor(MaxX), static_cast<float>(m_Width - 1));
+    const float Y1 = std::min(std::floor(MaxY), static_cast<float>(m_Height - 1));
+    if (!(X0 <= X1 && Y0 <= Y1))
+        return false;
+
+    const Int32 PixelX0 = static_cast<Int32>(X0);
+    const Int32 PixelY0 = static_cast<Int32>(Y0);
+    const Int32 PixelX1 = static_cast<Int32>(X1);
+    const Int32 PixelY1 = static_cast<Int32>(Y1);
+
+    // Start at the finest level where the rectangle touches at most 2x2 texels
+    Uint32 StartLevel = 0;
+    while (StartLevel + 1 < GetLevelCount() &&
+           ((PixelX1 >> StartLevel) - (PixelX0 >> StartLevel) > 1 || (PixelY1 >> StartLevel) - (PixelY0 >> StartLevel) > 1))
+        ++StartLevel;
+
+    return !IsRegionVisible(StartLevel, PixelX0, PixelY0, PixelX1, PixelY1, MinZ);
+}
+
+bool RadientOcclusionBuffer::IsRegionVisible(Uint32 Level, Int32 X0, Int32 Y0, Int32 X1, Int32 Y1, float Depth) const
+{
+    for (Int32 y = Y0 >> Level; y <= (Y1 >> Level); ++y)
+    {
+        for (Int32 x = X0 >> Level; x <= (X1 >> Level); ++x)
+        {
+            // Every pixel of the texel is nearer than the box
+            if (Depth > GetMaxDepth(Level, x, y))
+                continue;
+
+            // No pixel of the texel is nearer than the box. Pixels of level 0 have a single depth.
+            if (Level == 0 || Depth <= GetMinDepth(Level, x, y))
+                return true;
+
+            // Refine the part of the rectangle that the texel covers
+            if (IsRegionVisible(Level - 1,
+                                std::max(X0, x << Level),
+                                std::max(Y0, y << Level),
+                                std::min(X1, ((x + 1) << Level) - 1),
+                                std::min(Y1, ((y + 1) << Level) - 1),
+                                Depth))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Diligent
@@ -31,39 +31,120 @@
 
 #include "Cast.hpp"
 #include "Errors.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
 
 namespace Diligent
 {
 
+namespace
+{
+
+RadientShadowCascadeDesc GetShadowCascadeDesc(const RadientRendererDesc& Desc)
+{
+    RadientShadowCascadeDesc ShadowDesc;
+    ShadowDesc.CascadeCount = Desc.ShadowCascadeCount;
+    ShadowDesc.Resolution   = Desc.ShadowMapResolution;
+    ShadowDesc.MaxDistance  = Desc.ShadowDistance;
+    return ShadowDesc;
+}
+
+RadientOcclusionCullingDesc GetOcclusionCullingDesc(const RadientRendererDesc& Desc)
+{
+    RadientOcclusionCullingDesc OcclusionDesc;
+    OcclusionDesc.Enable           = Desc.EnableOcclusionCulling == True;
+    OcclusionDesc.BufferWidth      = Desc.OcclusionBufferWidth;
+    OcclusionDesc.MaxOccluderCount = Desc.MaxOccluderCount;
+    return OcclusionDesc;
+}
+
+// Number of occlusion culling candidates tested by one thread pool task
+constexpr size_t OcclusionTestBatchSize = 256;
+
+// Calls Func(i) for every i in [0, Count) on the thread pool. The calling thread processes the first item.
+template <typename FuncType>
+void ProcessParallel(IThreadPool*                            pThreadPool,
+                     Uint32                                  Count,
+                     std::vector<RefCntAutoPtr<IAsyncTask>>& Tasks,
+                     const FuncType&                         Func)
+{
+    if (pThreadPool == nullptr || Count < 2)
+    {
+        for (Uint32 i = 0; i < Count; ++i)
+            Func(i);
+        return;
+    }
+
+    Tasks.clear();
+    for (Uint32 i = 1; i < Count; ++i)
+    {
+        RefCntAutoPtr<IAsyncTask> pTask =
+            CreateAsyncWorkTask(
+                [&Func, i](Uint32) //
+                {
+                    Func(i);
+                    return ASYNC_TASK_STATUS_COMPLETE;
+                });
+        if (pTask && pThreadPool->EnqueueTask(pTask))
+            Tasks.emplace_back(std::move(pTask));
+        else
+            Func(i);
+    }
+
+    Func(0);
+
+    // Help the thread pool rather than block: the pool may have no worker threads
+    for (const RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        while (!pTask->IsFinished())
+        {
+            if (!pThreadPool->ProcessTask(0, false))
+                std::this_thread::yield();
+        }
+    }
+    Tasks.clear();
+}
+
+} // namespace
+
 RadientRenderPipeline::RadientRenderPipeline(IRadientBackend*           pBackend,
                                              RadientAssetManagerImpl*   pAssetManager,
                                              const RadientRendererDesc& Desc) :
     m_pBackend{pBackend},
     m_pAssetManager{pAssetManager},
-    m_ForwardPass{Desc.EnableAsyncPipelineCompilation == True}
+    m_GeometryRenderer{GetShadowCascadeDesc(Desc), Desc.EnableGPUDrivenRendering == True},
+    m_ForwardPass{Desc.EnableAsyncPipelineCompilation == True, Desc.EnableDepthPrepass == True, GetOcclusionCullingDesc(Desc)},
+    m_PostProcessPipeline{Desc.ToneMapping},
+    m_EnableHDR{Desc.ToneMapping.Enable == True}
 {
     if (m_pBackend == nullptr)
         LOG_ERROR_AND_THROW("Radient render pipeline backend must not be null");
     if (m_pAssetManager == nullptr)
         LOG_ERROR_AND_THROW("Radient render pipeline asset manager must not be null");
+
+    if (m_pBackend->GetDesc().Type == RADIENT_BACKEND_TYPE_NULL)
+    {
+        m_GeometryRenderer.PrepareHeadless(RadientGeometryCommandLogSink::PrimitiveAttribsBufferSize,
+                                           RadientGeometryCommandLogSink::ConstantBufferOffsetAlignment);
+        m_CommandSink = std::make_unique<RadientGeometryCommandLogSink>(m_CommandLog);
+    }
 }
 
 RadientRenderPipeline::~RadientRenderPipeline()
 {
 }
 
-RADIENT_STATUS RadientRenderPipeline::Update(const RadientRenderAttribs& Attribs)
+RADIENT_STATUS RadientRenderPipeline::Update(const RadientRenderViewsAttribs& Attribs)
 {
-    if (Attribs.pView == nullptr)
-    {
-        return RADIENT_STATUS_INVALID_ARGUMENT;
-    }
-
-    const RadientViewDesc& ViewDesc = Attribs.pView->GetDesc();
-    if (ViewDesc.pScene == nullptr || ViewDesc.pRenderTarget == nullptr)
+    if (Attribs.ppViews == nullptr || Attribs.NumViews == 0)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
-    RadientSceneImpl* pSceneImpl = ClassPtrCast<RadientSceneImpl>(ViewDesc.pScene);
+    // All views reference the same scene, see RadientRendererImpl::RenderViews()
+    const RadientViewDesc& FirstViewDesc = Attribs.ppViews[0]->GetDesc();
+    RadientSceneImpl*      pSceneImpl    = ClassPtrCast<RadientSceneImpl>(FirstViewDesc.pScene);
     if (pSceneImpl == nullptr)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
@@ -72,52 +153,127 @@ RADIENT_STATUS RadientRenderPipeline::Update(const RadientRenderAttribs& Attribs
         Attribs.pDeviceContext :
         m_pBackend->GetNativeImmediateContext();
 
-    const RADIENT_STATUS TargetStatus = m_FrameTargets.Prepare(pDevice, *ViewDesc.pRenderTarget);
-    if (RADIENT_FAILED(TargetStatus))
-        return TargetStatus;
+    if (m_Views.size() < Attribs.NumViews)
+        m_Views.resize(Attribs.NumViews);
 
-    // Remote execution and headless local tests use the same public renderer object.
-    // The concrete command serialization/GPU execution will be plugged in behind this pipeline.
-    if (pDevice == nullptr || pContext == nullptr)
-        return RADIENT_STATUS_OK;
+    // Views are recorded one after another: the scene pass of every view is followed by its post-processing
+    m_TargetPool.BeginFrame();
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        const RadientViewDesc& ViewDesc = Attribs.ppViews[i]->GetDesc();
+        if (ViewDesc.pRenderTarget == nullptr)
+            return RADIENT_STATUS_INVALID_ARGUMENT;
 
-    RADIENT_STATUS Status = m_pAssetManager->UpdateGPUResources(pDevice, pContext);
-    if (RADIENT_FAILED(Status))
-        return Status;
+        RadientFrameRenderTargets& Targets = m_Views[i].Targets;
 
-    const RADIENT_STATUS SyncStatus = m_DrawableCache.SyncScene(*ViewDesc.pScene);
+        const RADIENT_STATUS TargetStatus = Targets.Prepare(pDevice, *ViewDesc.pRenderTarget);
+        if (RADIENT_FAILED(TargetStatus))
+            return TargetStatus;
+
+        const Uint32 ScenePass       = m_TargetPool.AddPass("Radient scene");
+        const Uint32 PostProcessPass = m_TargetPool.AddPass("Radient post-processing");
+        if (m_EnableHDR)
+            Targets.DeclareSceneColor(m_TargetPool, ScenePass, PostProcessPass);
+    }
+
+    const RADIENT_STATUS PoolStatus = m_TargetPool.Compile(pDevice);
+    if (RADIENT_FAILED(PoolStatus))
+        return PoolStatus;
+
+    const float FrameTime = static_cast<float>(Attribs.FrameTime > 0 ? Attribs.FrameTime : Attribs.DeltaTime);
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        ViewData& View = m_Views[i];
+        View.Targets.ResolveTransientTargets(m_TargetPool);
+
+        // The targets are allocated at the full size, so the render scale changes do not reallocate them
+        View.Targets.SetRenderScale(View.Resolution.Update(Attribs.ppViews[i]->GetDesc().RenderScale, FrameTime));
+
+        // Passes are prepared once for all views, so all views share the same pipeline states
+        if (!View.Targets.HasSameFormats(m_Views[0].Targets))
+        {
+            LOG_ERROR_MESSAGE("Render target formats of Radient view ", i, " differ from the formats of the first view. "
+                              "All views of a render call must use the same formats.");
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    const bool HasDevice = pDevice != nullptr && pContext != nullptr;
+    if (HasDevice)
+    {
+        const RADIENT_STATUS Status = m_pAssetManager->UpdateGPUResources(pDevice, pContext);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    // The null backend records the frame from the scene synchronization on
+    if (m_CommandSink)
+    {
+        m_CommandLog.Clear();
+        m_CommandLog.BeginPass("Scene sync");
+    }
+
+    // The drawable cache does not depend on the device, so headless renderers consume the
+    // scene changes as well. The scene is synchronized once regardless of the number of views.
+    const RADIENT_STATUS SyncStatus = m_DrawableCache.SyncScene(*FirstViewDesc.pScene);
+    if (m_CommandSink)
+    {
+        if (RADIENT_SUCCEEDED(SyncStatus))
+        {
+            m_ForwardPass.Prepare(m_GeometryRenderer, m_DrawableCache, *m_CommandSink);
+            m_CommandSink->CommitMaterialTable(m_GeometryRenderer.GetMaterialTable());
+        }
+        m_CommandLog.EndPass();
+    }
     if (RADIENT_FAILED(SyncStatus))
         return SyncStatus;
     pSceneImpl->ClearPendingRenderChanges();
+    ++m_Stats.SceneSyncCount;
 
-    Status = m_GeometryRenderer.Prepare(pDevice, pContext);
-    if (RADIENT_FAILED(Status))
-        return Status;
+    // Remote execution and headless local tests use the same public renderer object.
+    // The concrete command serialization/GPU execution will be plugged in behind this pipeline.
+    if (!HasDevice)
+        return RADIENT_STATUS_OK;
 
-    Status = m_ForwardPass.Prepare(m_GeometryRenderer, pDevice, pContext, m_DrawableCache, m_FrameTargets);
+    RADIENT_STATUS Status = m_GeometryRenderer.Prepare(pDevice, pContext);
     if (RADIENT_FAILED(Status))
         return Status;
 
-    Status = m_SkyboxPass.Prepare(m_GeometryRenderer, pDevice, m_FrameTargets);
+    const RadientFrameRenderTargets& Targets = m_Views[0].Targets;
+
+    Status = m_ForwardPass.Prepare(m_GeometryRenderer, pDevice, pContext, m_DrawableCache, Targets);
     if (RADIENT_FAILED(Status))
         return Status;
 
-    Status = m_PostProcessPipeline.Prepare(pDevice, pContext, m_FrameTargets);
+    Status = m_SkyboxPass.Prepare(m_GeometryRenderer, pDevice, Targets);
     if (RADIENT_FAILED(Status))
         return Status;
 
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        Status = m_PostProcessPipeline.Prepare(pDevice, pContext, i, m_Views[i].Targets);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
     return RADIENT_STATUS_OK;
 }
 
-RADIENT_STATUS RadientRenderPipeline::Render(const RadientRenderAttribs& Attribs)
+RADIENT_STATUS RadientRenderPipeline::Render(const RadientRenderViewsAttribs& Attribs)
 {
-    if (Attribs.pView == nullptr)
+    const RADIENT_STATUS Status = RecordViews(Attribs);
+    if (RADIENT_SUCCEEDED(Status))
     {
-        return RADIENT_STATUS_INVALID_ARGUMENT;
+        ++m_Stats.FrameCount;
+        m_Stats.ViewCount += Attribs.NumViews;
     }
 
-    const RadientViewDesc& ViewDesc = Attribs.pView->GetDesc();
-    if (ViewDesc.pScene == nullptr || ViewDesc.pRenderTarget == nullptr)
+    return Status;
+}
+
+RADIENT_STATUS RadientRenderPipeline::RecordViews(const RadientRenderViewsAttribs& Attribs)
+{
+    if (Attribs.ppViews == nullptr || Attribs.NumViews == 0 || m_Views.size() < Attribs.NumViews)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
     IRenderDevice*  pDevice  = m_pBackend->GetNativeDevice();
@@ -128,12 +284,21 @@ RADIENT_STATUS RadientRenderPipeline::Render(const RadientRenderAttribs& Attribs
     // Remote execution and headless local tests use the same public renderer object.
     // The concrete command serialization/GPU execution will be plugged in behind this pipeline.
     if (pDevice == nullptr || pContext == nullptr)
+    {
+        if (m_CommandSink)
+            RecordHeadlessViews(Attribs);
         return RADIENT_STATUS_OK;
+    }
 
     RADIENT_STATUS Status = RADIENT_STATUS_OK;
 
-    const bool HasDrawables = !m_DrawableCache.GetDrawLists().IsEmpty();
-    const bool HasSkybox    = ViewDesc.Skybox.Source != RADIENT_SKYBOX_SOURCE_NONE;
+    const RadientViewDesc&  FirstViewDesc = Attribs.ppViews[0]->GetDesc();
+    const RadientDrawLists& DrawLists     = m_DrawableCache.GetDrawLists();
+
+    const bool HasDrawables = !DrawLists.IsEmpty();
+    bool       HasSkybox    = false;
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+        HasSkybox = HasSkybox || Attribs.ppViews[i]->GetDesc().Skybox.Source != RADIENT_SKYBOX_SOURCE_NONE;
 
     if (HasDrawables || HasSkybox)
     {
@@ -141,61 +306,237 @@ RADIENT_STATUS RadientRenderPipeline::Render(const RadientRenderAttribs& Attribs
                                                pContext,
                                                m_DrawableCache.GetLightList(),
                                                m_pAssetManager->GetResourceManager(),
-                                               ViewDesc,
-                                               m_FrameTargets);
+                                               FirstViewDesc.pScene->GetEnvironment());
         if (RADIENT_FAILED(Status))
             return Status;
 
         if (HasDrawables)
+            PrepareViewDrawables(pDevice, Attribs);
+    }
+
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        const RadientViewDesc& ViewDesc = Attribs.ppViews[i]->GetDesc();
+        const ViewData&        View     = m_Views[i];
+
+        // The views share the HDR scene color target
+        View.Targets.ClearSceneColor(pContext);
+
+        if (HasDrawables || ViewDesc.Skybox.Source != RADIENT_SKYBOX_SOURCE_NONE)
         {
-            Status = m_ForwardPass.Execute(m_GeometryRenderer,
-                                           pDevice,
-                                           pContext,
-                                           m_DrawableCache.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE),
-                                           m_DrawableCache,
-                                           m_FrameTargets);
+            Status = RecordView(pDevice, pContext, ViewDesc, View, HasDrawables);
             if (RADIENT_FAILED(Status))
                 return Status;
+        }
 
-            Status = m_ForwardPass.Execute(m_GeometryRenderer,
-                                           pDevice,
-                                           pContext,
-                                           m_DrawableCache.GetDrawList(GLTF::Material::ALPHA_MODE_MASK),
-                                           m_DrawableCache,
-                                           m_FrameTargets);
+        Status = m_PostProcessPipeline.Execute(pContext, i, View.Targets, Attribs.DeltaTime);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    if (HasDrawables || HasSkybox)
+        m_GeometryRenderer.EndFrame();
+
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientRenderPipeline::RecordView(IRenderDevice*         pDevice,
+                                                 IDeviceContext*        pContext,
+                                                 const RadientViewDesc& ViewDesc,
+                                                 const ViewData&        View,
+                                                 bool                   HasDrawables)
+{
+    RADIENT_STATUS Status = m_GeometryRenderer.BeginView(pDevice, pContext, ViewDesc, View.Targets);
+    if (RADIENT_FAILED(Status))
+        return Status;
+
+    if (HasDrawables)
+    {
+        Status = m_ForwardPass.ExecuteShadowPass(m_GeometryRenderer,
+                                                 pDevice,
+                                                 pContext,
+                                                 m_DrawableCache.GetDrawLists(),
+                                                 m_DrawableCache);
+        if (RADIENT_FAILED(Status))
+            return Status;
+
+        if (m_ForwardPass.IsDepthPrepassEnabled())
+        {
+            Status = m_ForwardPass.ExecuteDepthPrepass(m_GeometryRenderer,
+                                                       pDevice,
+                                                       pContext,
+                                                       View.Drawables,
+                                                       View.Targets);
             if (RADIENT_FAILED(Status))
                 return Status;
         }
 
-        if (HasSkybox)
-        {
-            const RadientEnvironmentDesc& Environment = ViewDesc.pScene->GetEnvironment();
+        Status = m_ForwardPass.Execute(m_GeometryRenderer,
+                                       pDevice,
+                                       pContext,
+                                       m_DrawableCache.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE),
+                                       m_DrawableCache,
+                                       View.Drawables,
+                                       View.Targets);
+        if (RADIENT_FAILED(Status))
+            return Status;
 
-            Status = m_SkyboxPass.Execute(m_GeometryRenderer,
-                                          pContext,
-                                          ViewDesc,
-                                          Environment,
-                                          m_FrameTargets);
-            if (RADIENT_FAILED(Status))
-                return Status;
+        Status = m_ForwardPass.Execute(m_GeometryRenderer,
+                                       pDevice,
+                                       pContext,
+                                       m_DrawableCache.GetDrawList(GLTF::Material::ALPHA_MODE_MASK),
+                                       m_DrawableCache,
+                                       View.Drawables,
+                                       View.Targets);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    if (ViewDesc.Skybox.Source != RADIENT_SKYBOX_SOURCE_NONE)
+    {
+        const RadientEnvironmentDesc& Environment = ViewDesc.pScene->GetEnvironment();
+
+        Status = m_SkyboxPass.Execute(m_GeometryRenderer,
+                                      pContext,
+                                      ViewDesc,
+                                      Environment,
+                                      View.Targets);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    if (HasDrawables)
+    {
+        Status = m_ForwardPass.ExecuteBlend(m_GeometryRenderer,
+                                            pDevice,
+                                            pContext,
+                                            View.Drawables,
+                                            View.Targets);
+        if (RADIENT_FAILED(Status))
+            return Status;
+    }
+
+    return RADIENT_STATUS_OK;
+}
+
+void RadientRenderPipeline::RecordHeadlessViews(const RadientRenderViewsAttribs& Attribs)
+{
+    const RadientDrawLists& DrawLists = m_DrawableCache.GetDrawLists();
+
+    PrepareViewDrawables(nullptr, Attribs);
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        const RadientGeometryViewDrawables& View = m_Views[i].Drawables;
+
+        m_GeometryRenderer.BeginHeadlessView(m_DrawableCache.GetLightList(), Attribs.ppViews[i]->GetDesc(), m_Views[i].Targets);
+
+        // Camera, lights and shadow map infos
+        m_CommandLog.BeginPass("View constants", i);
+        m_CommandSink->WriteFrameAttribs(m_GeometryRenderer.GetSettings());
+        m_CommandLog.EndPass();
+
+        if (m_GeometryRenderer.GetShadowDesc().CascadeCount > 0)
+        {
+            m_CommandLog.BeginPass("Shadow", i);
+            m_ForwardPass.RecordShadowPass(m_GeometryRenderer, DrawLists, m_DrawableCache, View);
+            m_CommandLog.EndPass();
         }
 
-        if (HasDrawables)
+        if (m_ForwardPass.IsDepthPrepassEnabled())
         {
-            Status = m_ForwardPass.Execute(m_GeometryRenderer,
-                                           pDevice,
-                                           pContext,
-                                           m_DrawableCache.GetDrawList(GLTF::Material::ALPHA_MODE_BLEND),
-                                           m_DrawableCache,
-                                           m_FrameTargets);
-            if (RADIENT_FAILED(Status))
-                return Status;
+            m_CommandLog.BeginPass("Depth prepass", i);
+            m_ForwardPass.RecordDepthPrepass(m_GeometryRenderer, View);
+            m_CommandLog.EndPass();
         }
 
-        m_GeometryRenderer.EndFrame();
+        m_CommandLog.BeginPass("Opaque", i);
+        m_ForwardPass.Record(m_GeometryRenderer, DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE), m_DrawableCache, View);
+        m_CommandLog.EndPass();
+
+        m_CommandLog.BeginPass("Mask", i);
+        m_ForwardPass.Record(m_GeometryRenderer, DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_MASK), m_DrawableCache, View);
+        m_CommandLog.EndPass();
+
+        m_CommandLog.BeginPass("Blend", i);
+        m_ForwardPass.RecordBlend(m_GeometryRenderer, View);
+        m_CommandLog.EndPass();
+    }
+
+    m_FramePassStats.clear();
+    for (const RadientCommandLog::PassInfo& Pass : m_CommandLog.GetPasses())
+    {
+        RadientFramePassStats PassStats;
+        PassStats.Name             = Pass.Name;
+        PassStats.ViewIndex        = Pass.ViewIndex;
+        PassStats.DrawCount        = Pass.DrawCount;
+        PassStats.StateChangeCount = Pass.StateChangeCount;
+        PassStats.BufferWriteSize  = Pass.BufferWriteSize;
+        PassStats.CPUTime          = Pass.CPUTime;
+        m_FramePassStats.push_back(PassStats);
+    }
+}
+
+void RadientRenderPipeline::PrepareViewDrawables(IRenderDevice* pDevice, const RadientRenderViewsAttribs& Attribs)
+{
+    // Cached lists are resolved on the render thread, the occlusion culling and the depth sorting are parallel
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        const RadientViewDesc& ViewDesc = Attribs.ppViews[i]->GetDesc();
+        ViewData&              View     = m_Views[i];
+        m_ForwardPass.PrepareViewDrawables(m_DrawableCache.GetDrawLists(),
+                                           m_DrawableCache,
+                                           ViewDesc,
+                                           GetRadientViewDepthPlane(pDevice, ViewDesc, View.Targets),
+                                           View.Drawables);
+    }
+    if (m_ForwardPass.IsOcclusionCullingEnabled())
+        CullViewDrawables(Attribs);
+    SortViewDrawables(Attribs.NumViews);
+}
+
+void RadientRenderPipeline::CullViewDrawables(const RadientRenderViewsAttribs& Attribs)
+{
+    IThreadPool* const pThreadPool = m_pAssetManager->GetThreadPool();
+
+    // Views are culled one after another, the tiles and the candidate batches of a view are processed in parallel
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        const RadientViewDesc&        ViewDesc  = Attribs.ppViews[i]->GetDesc();
+        ViewData&                     View      = m_Views[i];
+        RadientGeometryViewDrawables& Drawables = View.Drawables;
+        if (!m_ForwardPass.BeginViewOcclusion(m_DrawableCache.GetDrawLists(),
+                                              m_DrawableCache,
+                                              GetRadientViewOcclusionMatrix(ViewDesc, View.Targets),
+                                              View.Targets.GetSize(),
+                                              Drawables))
+            continue;
+
+        RadientOcclusionBuffer& OcclusionBuffer = Drawables.OcclusionBuffer;
+        ProcessParallel(pThreadPool, OcclusionBuffer.GetTileCount(), m_WorkerTasks,
+                        [&OcclusionBuffer](Uint32 Tile) {
+                            OcclusionBuffer.RasterizeTile(Tile);
+                        });
+        OcclusionBuffer.BuildHierarchy();
+
+        const size_t CandidateCount = Drawables.OcclusionCandidates.size();
+        const Uint32 BatchCount     = static_cast<Uint32>((CandidateCount + OcclusionTestBatchSize - 1) / OcclusionTestBatchSize);
+        ProcessParallel(pThreadPool, BatchCount, m_WorkerTasks,
+                        [this, &Drawables, CandidateCount](Uint32 Batch) {
+                            const size_t First = size_t{Batch} * OcclusionTestBatchSize;
+                            m_ForwardPass.TestViewOcclusion(Drawables, First, std::min(First + OcclusionTestBatchSize, CandidateCount));
+                        });
+
+        m_Stats.OccludedPrimitiveCount += m_ForwardPass.EndViewOcclusion(Drawables);
     }
+}
 
-    return m_PostProcessPipeline.Execute(pContext, m_FrameTargets);
+void RadientRenderPipeline::SortViewDrawables(Uint32 NumViews)
+{
+    // Workers sort the other views while the render thread sorts the first one
+    ProcessParallel(m_pAssetManager->GetThreadPool(), NumViews, m_WorkerTasks,
+                    [this](Uint32 i) {
+                        m_ForwardPass.SortViewDrawables(m_Views[i].Drawables);
+                    });
 }
 
 } // namespace Diligent
@@ -26,6 +26,7 @@
 
 #include "Render/RadientRendererImpl.hpp"
 #include "Render/RadientRenderPipeline.hpp"
+#include "Render/RadientResolutionController.hpp"
 #include "Core/RadientViewImpl.hpp"
 
 #include "Errors.hpp"
@@ -124,7 +125,7 @@ RADIENT_STATUS RadientRendererImpl::CreateRenderTarget(const RadientRenderTarget
 
 RADIENT_STATUS RadientRendererImpl::CreateView(const RadientViewDesc& Desc, IRadientView** ppView)
 {
-    if (ppView == nullptr)
+    if (ppView == nullptr || !RadientResolutionController::IsValidDesc(Desc.RenderScale))
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
     DEV_CHECK_ERR(*ppView == nullptr, "Output view pointer must be null. Overwriting a non-null output pointer may result in memory leaks.");
@@ -137,13 +138,40 @@ RADIENT_STATUS RadientRendererImpl::CreateView(const RadientViewDesc& Desc, IRad
 
 RADIENT_STATUS RadientRendererImpl::Render(const RadientRenderAttribs& Attribs)
 {
-    if (m_pBackend == nullptr || m_RenderPipeline == nullptr || Attribs.pView == nullptr)
-        return RADIENT_STATUS_INVALID_ARGUMENT;
+    IRadientView* const pView = Attribs.pView;
+
+    RadientRenderViewsAttribs ViewsAttribs;
+    ViewsAttribs.ppViews        = &pView;
+    ViewsAttribs.NumViews       = 1;
+    ViewsAttribs.pDeviceContext = Attribs.pDeviceContext;
+    ViewsAttribs.DeltaTime      = Attribs.DeltaTime;
+    ViewsAttribs.FrameTime      = Attribs.FrameTime;
+    ViewsAttribs.Time           = Attribs.Time;
+    return RenderViews(ViewsAttribs);
+}
 
-    const RadientViewDesc& ViewDesc = Attribs.pView->GetDesc();
-    if (ViewDesc.pScene == nullptr || ViewDesc.pRenderTarget == nullptr)
+RADIENT_STATUS RadientRendererImpl::RenderViews(const RadientRenderViewsAttribs& Attribs)
+{
+    if (m_pBackend == nullptr || m_RenderPipeline == nullptr || Attribs.ppViews == nullptr || Attribs.NumViews == 0)
         return RADIENT_STATUS_INVALID_ARGUMENT;
 
+    const IRadientScene* pScene = nullptr;
+    for (Uint32 i = 0; i < Attribs.NumViews; ++i)
+    {
+        if (Attribs.ppViews[i] == nullptr)
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+
+        const RadientViewDesc& ViewDesc = Attribs.ppViews[i]->GetDesc();
+        if (ViewDesc.pScene == nullptr || ViewDesc.pRenderTarget == nullptr)
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+
+        // The scene is synchronized once per call
+        if (pScene == nullptr)
+            pScene = ViewDesc.pScene;
+        else if (pScene != ViewDesc.pScene)
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+    }
+
     const RADIENT_STATUS UpdateStatus = m_RenderPipeline->Update(Attribs);
     if (RADIENT_FAILED(UpdateStatus))
         return UpdateStatus;
@@ -151,4 +179,17 @@ RADIENT_STATUS RadientRendererImpl::Render(const RadientRenderAttribs& Attribs)
     return m_RenderPipeline->Render(Attribs);
 }
 
+const RadientRendererStats& RadientRendererImpl::GetStats() const
+{
+    return m_RenderPipeline->GetStats();
+}
+
+const RadientFramePassStats* RadientRendererImpl::GetFramePassStats(Uint32& NumPasses) const
+{
+    const std::vector<RadientFramePassStats>& PassStats = m_RenderPipeline->GetFramePassStats();
+
+    NumPasses = static_cast<Uint32>(PassStats.size());
+    return !PassStats.empty() ? PassStats.data() : nullptr;
+}
+
 } // namespace Diligent
@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientResolutionController.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Smallest render scale
+constexpr float RadientMinRenderScale = 1.f / 16.f;
+
+} // namespace
+
+RadientResolutionController::RadientResolutionController(const RadientResolutionControllerSettings& Settings) noexcept :
+    m_Settings{Settings}
+{
+}
+
+bool RadientResolutionController::IsValidDesc(const RadientRenderScaleDesc& Desc)
+{
+    return Desc.ScaleStep > 0 && Desc.TargetFrameTime > 0 && Desc.MinScale <= Desc.MaxScale;
+}
+
+float RadientResolutionController::GetMinScale(const RadientRenderScaleDesc& Desc)
+{
+    return std::min(std::max(Desc.MinScale, RadientMinRenderScale), 1.f);
+}
+
+float RadientResolutionController::GetMaxScale(const RadientRenderScaleDesc& Desc)
+{
+    return std::min(std::max(Desc.MaxScale, GetMinScale(Desc)), 1.f);
+}
+
+float RadientResolutionController::QuantizeScale(float Scale, const RadientRenderScaleDesc& Desc)
+{
+    if (Desc.ScaleStep > 0)
+    {
+        // The epsilon keeps exact multiples of the step from being rounded down
+        Scale = std::floor(Scale / Desc.ScaleStep + 1e-3f) * Desc.ScaleStep;
+    }
+    return std::min(std::max(Scale, GetMinScale(Desc)), GetMaxScale(Desc));
+}
+
+RadientExtent2D RadientResolutionController::GetRenderSize(const RadientExtent2D& TargetSize, float Scale)
+{
+    const auto ScaleDimension = [Scale](Uint32 Size) {
+        const Uint32 Scaled = static_cast<Uint32>(std::lround(static_cast<float>(Size) * Scale));
+        return std::min(std::max(Scaled, 1u), Size);
+    };
+    return RadientExtent2D{ScaleDimension(TargetSize.Width), ScaleDimension(TargetSize.Height)};
+}
+
+void RadientResolutionController::Reset()
+{
+    m_AverageFrameTime  = 0;
+    m_OverBudgetFrames  = 0;
+    m_UnderBudgetFrames = 0;
+    m_SettleFrames      = 0;
+    m_IsDynamic         = false;
+}
+
+void RadientResolutionController::SetScale(float Scale)
+{
+    if (Scale == m_Scale)
+        return;
+
+    m_Scale             = Scale;
+    m_AverageFrameTime  = 0;
+    m_OverBudgetFrames  = 0;
+    m_UnderBudgetFrames = 0;
+    m_SettleFrames      = m_Settings.SettleFrameCount;
+    ++m_ChangeCount;
+}
+
+float RadientResolutionController::Update(const RadientRenderScaleDesc& Desc, float FrameTime)
+{
+    const float MinScale = GetMinScale(Desc);
+    const float MaxScale = GetMaxScale(Desc);
+
+    if (Desc.Dynamic != True)
+    {
+        Reset();
+        m_Scale = std::min(std::max(Desc.Scale, MinScale), MaxScale);
+        return m_Scale;
+    }
+
+    if (!m_IsDynamic)
+    {
+        m_Scale     = QuantizeScale(Desc.Scale, Desc);
+        m_IsDynamic = true;
+    }
+    // The bounds may have changed
+    SetScale(std::min(std::max(m_Scale, MinScale), MaxScale));
+
+    if (FrameTime <= 0 || Desc.TargetFrameTime <= 0)
+        return m_Scale;
+
+    if (m_SettleFrames > 0)
+    {
+        --m_SettleFrames;
+        return m_Scale;
+    }
+
+    m_AverageFrameTime = m_AverageFrameTime > 0 ?
+        m_AverageFrameTime + (FrameTime - m_AverageFrameTime) * m_Settings.SmoothingFactor :
+        FrameTime;
+
+    const float BudgetRatio = m_AverageFrameTime / Desc.TargetFrameTime;
+    if (BudgetRatio > m_Settings.OverBudgetRatio)
+    {
+        m_UnderBudgetFrames = 0;
+        if (++m_OverBudgetFrames >= m_Settings.DecreaseFrameCount && m_Scale > MinScale)
+        {
+            // Drop at least one step, and far enough to fit the budget at once
+            const float FitScale = m_Scale * std::sqrt(m_Settings.OverBudgetRatio / BudgetRatio);
+            const float NewScale = std::min(QuantizeScale(FitScale, Desc), QuantizeScale(m_Scale - Desc.ScaleStep, Desc));
+            SetScale(std::max(NewScale, MinScale));
+        }
+    }
+    else if (BudgetRatio < m_Settings.UnderBudgetRatio)
+    {
+        m_OverBudgetFrames = 0;
+        if (++m_UnderBudgetFrames >= m_Settings.IncreaseFrameCount && m_Scale < MaxScale)
+        {
+            // Step up from the quantized scale, so that a minimum scale that is not a multiple
+            // of the step moves onto the step grid
+            SetScale(std::max(QuantizeScale(m_Scale + Desc.ScaleStep, Desc), m_Scale));
+        }
+    }
+    else
+    {
+        m_OverBudgetFrames  = 0;
+        m_UnderBudgetFrames = 0;
+    }
+
+    return m_Scale;
+}
+
+} // namespace Diligent
@@ -49,6 +49,11 @@ Uint8 CorrectMaterialAlphaMode(int AlphaMode)
     return static_cast<Uint8>(AlphaMode);
 }
 
+Uint64 GetVisibilityMask(const RadientMeshRendererComponent* pRenderer)
+{
+    return pRenderer != nullptr ? pRenderer->VisibilityMask : ~Uint64{0};
+}
+
 class RadientAssetDrawableMeshProvider final : public IRadientDrawableMeshProvider
 {
 public:
@@ -154,6 +159,11 @@ RADIENT_STATUS RadientSceneDrawableCache::SyncScene(const IRadientScene& Scene)
             });
     }
 
+    // Effective visibility is read through slot pointers, so lists filtered by it
+    // must be rebuilt when it may have changed, even if no drawable was updated.
+    if (!m_DrawableChanges.empty() || m_SceneRevisions.Visibility != SceneRevisions.Visibility)
+        ++m_DrawListRevision;
+
     m_SceneRevisions = SceneRevisions;
 
     return RADIENT_STATUS_OK;
@@ -198,6 +208,7 @@ void RadientSceneDrawableCache::ProcessRenderableMeshAddedOrUpdated(const Radien
             Slot.pRenderer         = Record.pRenderer;
             Slot.pWorldMatrix      = Record.pWorldMatrix;
             Slot.pEffectiveVisible = Record.pEffectiveVisible;
+            m_DrawLists.SetVisibilityMask(static_cast<GLTF::Material::ALPHA_MODE>(Slot.AlphaMode), Slot.DrawListIndex, GetVisibilityMask(Slot.pRenderer));
             RecordDrawableChange(DrawableID, RadientDrawableChangeType::Updated);
         }
     }
@@ -327,9 +338,10 @@ bool RadientSceneDrawableCache::TryExpandRenderable(RadientEntityID Entity, Rend
         Slot.BaseVertex         = Geometry.BaseVertex;
         Slot.FirstElement       = Primitive.FirstElement;
         Slot.ElementCount       = Primitive.ElementCount;
+        Slot.LocalBounds        = Primitive.LocalBounds;
         Slot.AlphaMode          = CorrectMaterialAlphaMode(Primitive.pMaterial->Attribs.AlphaMode);
 
-        Slot.DrawListIndex = m_DrawLists.Add(static_cast<GLTF::Material::ALPHA_MODE>(Slot.AlphaMode), DrawableID);
+        Slot.DrawListIndex = m_DrawLists.Add(static_cast<GLTF::Material::ALPHA_MODE>(Slot.AlphaMode), DrawableID, GetVisibilityMask(Slot.pRenderer));
         Record.DrawableIDs.push_back(DrawableID);
         RecordDrawableChange(DrawableID, RadientDrawableChangeType::Added);
     }
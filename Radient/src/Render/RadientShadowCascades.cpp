@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientShadowCascades.hpp"
+
+#include "Math/RadientMath.hpp"
+
+#include "DebugUtilities.hpp"
+#include "ShadowMapManager.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Diligent
+{
+
+bool RadientShadowCascades::Distribute(const RadientShadowCascadeDesc& Desc,
+                                       const float4x4&                 CameraWorld,
+                                       const float4x4&                 CameraProj,
+                                       const float3&                   LightDirection)
+{
+    m_Cascades.clear();
+    if (Desc.CascadeCount == 0 || Desc.Resolution == 0)
+        return false;
+
+    // Cascade bounding spheres are only defined for perspective frustums
+    if (CameraProj._34 == 0.f)
+        return false;
+
+    // Radient cameras look along -Z, and GetCameraProjection() bakes the z flip into the projection.
+    // ShadowMapManager expects +Z camera space, so move the flip to the camera transform:
+    // View * Proj == (View * FlipZ) * (FlipZ * Proj).
+    const float4x4 FlipZ        = float4x4::Scale(1.f, 1.f, -1.f);
+    const float4x4 CascadeProj  = FlipZ * CameraProj;
+    const float4x4 CascadeWorld = FlipZ * CameraWorld;
+    const float4x4 CascadeView  = CascadeWorld.Inverse();
+
+    ShadowMapManager::DistributeCascadeInfo DistrInfo;
+    DistrInfo.pCameraView         = &CascadeView;
+    DistrInfo.pCameraWorld        = &CascadeWorld;
+    DistrInfo.pCameraProj         = &CascadeProj;
+    DistrInfo.pLightDir           = &LightDirection;
+    DistrInfo.SnapCascades        = true;
+    DistrInfo.StabilizeExtents    = true;
+    DistrInfo.EqualizeExtents     = true;
+    DistrInfo.fPartitioningFactor = Desc.PartitioningFactor;
+    DistrInfo.PackMatrixRowMajor  = true;
+    if (Desc.MaxDistance > 0.f)
+    {
+        const float MaxDistance      = Desc.MaxDistance;
+        DistrInfo.AdjustCascadeRange = [MaxDistance](int CascadeIdx, float& MinZ, float& MaxZ) {
+            if (CascadeIdx < 0)
+                MaxZ = std::max(std::min(MaxZ, MaxDistance), MinZ);
+        };
+    }
+
+    ShadowMapManager::CascadeTargetInfo Target;
+    Target.Width       = Desc.Resolution;
+    Target.Height      = Desc.Resolution;
+    Target.NumCascades = std::min(Desc.CascadeCount, Uint32{MAX_CASCADES});
+    Target.ShadowMode  = SHADOW_MODE_PCF;
+    Target.IsGL        = Desc.NDCMinusOneToOne;
+    Target.NDC         = Desc.NDCMinusOneToOne ?
+        NDCAttribs{-1.f, 0.5f, -0.5f} :
+        NDCAttribs{0.f, 1.f, -0.5f};
+
+    ShadowMapAttribs ShadowAttribs;
+    ShadowAttribs.iFixedFilterSize = static_cast<int>(std::max(Desc.FilterSize, 1u));
+
+    std::vector<ShadowMapManager::CascadeTransforms> Transforms;
+    ShadowMapManager::DistributeCascades(DistrInfo, Target, ShadowAttribs, Transforms);
+
+    m_Cascades.resize(Transforms.size());
+    for (size_t i = 0; i < Transforms.size(); ++i)
+    {
+        RadientShadowCascade& Cascade = m_Cascades[i];
+        Cascade.WorldToLightProjSpace = Transforms[i].WorldToLightProjSpace;
+        Cascade.StartZ                = ShadowAttribs.Cascades[i].f4StartEndZ.x;
+        Cascade.EndZ                  = ShadowAttribs.Cascades[i].f4StartEndZ.y;
+    }
+
+    return true;
+}
+
+bool RadientShadowCascades::IsCasterVisible(Uint32                  Cascade,
+                                            const RadientMatrix4x4& WorldMatrix,
+                                            const RadientBounds&    LocalBounds) const
+{
+    VERIFY_EXPR(Cascade < m_Cascades.size());
+
+    const float3 Min{LocalBounds.Min.x, LocalBounds.Min.y, LocalBounds.Min.z};
+    const float3 Max{LocalBounds.Max.x, LocalBounds.Max.y, LocalBounds.Max.z};
+    if (!(Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z))
+    {
+        // Unknown bounds
+        return true;
+    }
+
+    // The light projection is orthographic, so the box center and half extents transform
+    // as an affine box: the projected half extent is the sum of the absolute axis contributions.
+    const float4x4 LocalToLightProj = RadientMath::ToFloat4x4(WorldMatrix) * m_Cascades[Cascade].WorldToLightProjSpace;
+
+    const float3 Center = (Min + Max) * 0.5f;
+    const float3 Extent = (Max - Min) * 0.5f;
+
+    const float4 ProjCenter = float4{Center, 1.f} * LocalToLightProj;
+
+    float3 ProjExtent;
+    for (int Col = 0; Col < 3; ++Col)
+    {
+        ProjExtent[Col] =
+            std::abs(Extent.x * LocalToLightProj.m[0][Col]) +
+            std::abs(Extent.y * LocalToLightProj.m[1][Col]) +
+            std::abs(Extent.z * LocalToLightProj.m[2][Col]);
+    }
+
+    if (ProjCenter.x - ProjExtent.x > 1.f || ProjCenter.x + ProjExtent.x < -1.f ||
+        ProjCenter.y - ProjExtent.y > 1.f || ProjCenter.y + ProjExtent.y < -1.f)
+    {
+        return false;
+    }
+
+    // Casters beyond the far plane can't shadow anything in the cascade. Casters in front of
+    // the near plane are kept, see the description of the method.
+    return ProjCenter.z - ProjExtent.z <= 1.f;
+}
+
+} // namespace Diligent
@@ -0,0 +1,229 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Render/RadientTransientTargetPool.hpp"
+
+#include "GraphicsAccessories.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Diligent
+{
+
+void RadientTransientTargetPool::BeginFrame()
+{
+    m_Passes.clear();
+    m_Targets.clear();
+}
+
+Uint32 RadientTransientTargetPool::AddPass(const Char* Name)
+{
+    m_Passes.push_back(Name);
+    return static_cast<Uint32>(m_Passes.size() - 1);
+}
+
+Uint32 RadientTransientTargetPool::DeclareTarget(const RadientTransientTargetDesc& Desc, const Char* Name, Uint32 FirstPass, Uint32 LastPass)
+{
+    if (Desc.Format == TEX_FORMAT_UNKNOWN || Desc.Width == 0 || Desc.Height == 0)
+        return InvalidIndex;
+    if (FirstPass > LastPass || LastPass >= m_Passes.size())
+        return InvalidIndex;
+
+    VirtualTarget Target;
+    Target.Desc      = Desc;
+    Target.Name      = Name;
+    Target.FirstPass = FirstPass;
+    Target.LastPass  = LastPass;
+    m_Targets.push_back(Target);
+
+    return static_cast<Uint32>(m_Targets.size() - 1);
+}
+
+Uint32 RadientTransientTargetPool::AssignPhysicalTarget(const VirtualTarget& Target, bool HasDevice)
+{
+    // Targets are assigned in the order of their first pass, so taking any physical target whose
+    // targets have ended uses the minimum number of physical targets (interval graph coloring).
+    // Physical targets that are already used by the frame are preferred over the ones kept from
+    // the previous frames, which would add a physical target to the frame.
+    Uint32 KeptIdx = InvalidIndex;
+    Uint32 FreeIdx = InvalidIndex;
+    for (Uint32 i = 0; i < m_Physical.size(); ++i)
+    {
+        const PhysicalTarget& Physical = m_Physical[i];
+        if (Physical.Desc == Target.Desc && (Physical.pTexture != nullptr || !HasDevice))
+        {
+            if (!Physical.IsUsedInFrame)
+            {
+                if (KeptIdx == InvalidIndex)
+                    KeptIdx = i;
+            }
+            else if (Physical.LastPass < Target.FirstPass)
+            {
+                return i;
+            }
+        }
+        else if (FreeIdx == InvalidIndex && Physical.Desc.Format == TEX_FORMAT_UNKNOWN)
+        {
+            FreeIdx = i;
+        }
+    }
+
+    if (KeptIdx != InvalidIndex)
+        return KeptIdx;
+
+    if (FreeIdx == InvalidIndex)
+    {
+        FreeIdx = static_cast<Uint32>(m_Physical.size());
+        m_Physical.emplace_back();
+    }
+    m_Physical[FreeIdx].Desc = Target.Desc;
+
+    return FreeIdx;
+}
+
+RADIENT_STATUS RadientTransientTargetPool::Compile(IRenderDevice* pDevice)
+{
+    for (PhysicalTarget& Physical : m_Physical)
+    {
+        Physical.IsUsedInFrame = false;
+        Physical.LastPass      = 0;
+    }
+
+    m_SortedTargets.resize(m_Targets.size());
+    std::iota(m_SortedTargets.begin(), m_SortedTargets.end(), 0u);
+    std::stable_sort(m_SortedTargets.begin(), m_SortedTargets.end(),
+                     [this](Uint32 Lhs, Uint32 Rhs) {
+                         return m_Targets[Lhs].FirstPass < m_Targets[Rhs].FirstPass;
+                     });
+
+    RADIENT_STATUS Status = RADIENT_STATUS_OK;
+    for (const Uint32 TargetIdx : m_SortedTargets)
+    {
+        VirtualTarget& Target = m_Targets[TargetIdx];
+
+        const Uint32    PhysicalIdx = AssignPhysicalTarget(Target, pDevice != nullptr);
+        PhysicalTarget& Physical    = m_Physical[PhysicalIdx];
+        if (pDevice != nullptr && !Physical.pTexture)
+        {
+            TextureDesc TexDesc;
+            TexDesc.Name      = Target.Name;
+            TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+            TexDesc.Width     = Target.Desc.Width;
+            TexDesc.Height    = Target.Desc.Height;
+            TexDesc.Format    = Target.Desc.Format;
+            TexDesc.BindFlags = Target.Desc.BindFlags;
+            TexDesc.Usage     = USAGE_DEFAULT;
+
+            pDevice->CreateTexture(TexDesc, nullptr, &Physical.pTexture);
+            if (!Physical.pTexture)
+            {
+                LOG_ERROR_MESSAGE("Failed to create Radient transient render target '", (Target.Name != nullptr ? Target.Name : ""), "'");
+                Physical = {};
+                Status   = RADIENT_STATUS_INVALID_OPERATION;
+                continue;
+            }
+        }
+
+        Physical.IsUsedInFrame = true;
+        Physical.LastPass      = Target.LastPass;
+        Target.Physical        = PhysicalIdx;
+    }
+
+    for (PhysicalTarget& Physical : m_Physical)
+    {
+        if (!Physical.IsUsedInFrame && Physical.Desc.Format != TEX_FORMAT_UNKNOWN)
+            Physical = {};
+    }
+
+    UpdateMemoryReport();
+
+    return Status;
+}
+
+void RadientTransientTargetPool::UpdateMemoryReport()
+{
+    m_Report             = {};
+    m_Report.PassCount   = GetPassCount();
+    m_Report.TargetCount = GetTargetCount();
+
+    m_PassMemoryDelta.assign(m_Passes.size() + 1, 0);
+    for (const VirtualTarget& Target : m_Targets)
+    {
+        const Uint64 Size = GetMemorySize(Target.Desc);
+        m_Report.UnaliasedMemory += Size;
+        m_PassMemoryDelta[Target.FirstPass] += static_cast<Int64>(Size);
+        m_PassMemoryDelta[Target.LastPass + 1] -= static_cast<Int64>(Size);
+    }
+
+    Int64 AliveMemory = 0;
+    for (Uint32 Pass = 0; Pass < m_Passes.size(); ++Pass)
+    {
+        AliveMemory += m_PassMemoryDelta[Pass];
+        if (AliveMemory > 0 && static_cast<Uint64>(AliveMemory) > m_Report.PeakMemory)
+        {
+            m_Report.PeakMemory = static_cast<Uint64>(AliveMemory);
+            m_Report.PeakPass   = Pass;
+        }
+    }
+
+    for (const PhysicalTarget& Physical : m_Physical)
+    {
+        if (!Physical.IsUsedInFrame)
+            continue;
+
+        ++m_Report.PhysicalTargetCount;
+        m_Report.AllocatedMemory += GetMemorySize(Physical.Desc);
+    }
+}
+
+ITexture* RadientTransientTargetPool::GetTexture(Uint32 Target) const
+{
+    const Uint32 PhysicalIdx = m_Targets[Target].Physical;
+    return PhysicalIdx != InvalidIndex ? m_Physical[PhysicalIdx].pTexture.RawPtr() : nullptr;
+}
+
+ITextureView* RadientTransientTargetPool::GetRTV(Uint32 Target) const
+{
+    ITexture* pTexture = GetTexture(Target);
+    return pTexture != nullptr ? pTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET) : nullptr;
+}
+
+ITextureView* RadientTransientTargetPool::GetSRV(Uint32 Target) const
+{
+    ITexture* pTexture = GetTexture(Target);
+    return pTexture != nullptr ? pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE) : nullptr;
+}
+
+Uint64 RadientTransientTargetPool::GetMemorySize(const RadientTransientTargetDesc& Desc)
+{
+    if (Desc.Format == TEX_FORMAT_UNKNOWN)
+        return 0;
+
+    return Uint64{Desc.Width} * Desc.Height * GetTextureFormatAttribs(Desc.Format).GetElementSize();
+}
+
+} // namespace Diligent
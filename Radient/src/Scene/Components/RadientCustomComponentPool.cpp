@@ -0,0 +1,228 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Scene/Components/RadientCustomComponentPool.hpp"
+
+#include "DebugUtilities.hpp"
+#include "HashUtils.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace Diligent
+{
+
+namespace
+{
+
+const Char* SafeStr(const Char* Str)
+{
+    return Str != nullptr ? Str : "";
+}
+
+} // namespace
+
+size_t CustomComponentPool::ComputeLayoutHash(const RadientCustomComponentData& Component)
+{
+    size_t Hash = ComputeHash(Component.Version, Component.DataSize);
+    HashCombine(Hash, CStringHash<Char>{}(SafeStr(Component.Name)));
+    HashCombine(Hash, CStringHash<Char>{}(SafeStr(Component.Schema)));
+    return Hash;
+}
+
+Uint32 CustomComponentPool::FindOrCreateSlab(const RadientCustomComponentData& Component)
+{
+    // The strings may belong to a slab of the pool and would dangle once m_Slabs grows
+    std::string  Name   = SafeStr(Component.Name);
+    std::string  Schema = SafeStr(Component.Schema);
+    const size_t Hash   = ComputeLayoutHash(Component);
+
+    const auto Range = m_SlabIndices.equal_range(Hash);
+    for (auto It = Range.first; It != Range.second; ++It)
+    {
+        const Slab& S = m_Slabs[It->second];
+        if (S.DataSize == Component.DataSize && S.Version == Component.Version && S.Name == Name && S.Schema == Schema)
+            return It->second;
+    }
+
+    Uint32 SlabIndex = 0;
+    if (!m_FreeSlabs.empty())
+    {
+        SlabIndex = m_FreeSlabs.back();
+        m_FreeSlabs.pop_back();
+    }
+    else
+    {
+        SlabIndex = static_cast<Uint32>(m_Slabs.size());
+        m_Slabs.emplace_back();
+    }
+
+    Slab& NewSlab    = m_Slabs[SlabIndex];
+    NewSlab.Name     = std::move(Name);
+    NewSlab.Schema   = std::move(Schema);
+    NewSlab.Version  = Component.Version;
+    NewSlab.DataSize = Component.DataSize;
+    m_SlabIndices.emplace(Hash, SlabIndex);
+    return SlabIndex;
+}
+
+void CustomComponentPool::FreeSlab(Uint32 SlabIndex)
+{
+    Slab& S = m_Slabs[SlabIndex];
+    VERIFY_EXPR(S.GetCount() == 0);
+
+    RadientCustomComponentData Layout;
+    Layout.Name     = S.Name.c_str();
+    Layout.Schema   = S.Schema.c_str();
+    Layout.Version  = S.Version;
+    Layout.DataSize = S.DataSize;
+
+    const auto Range = m_SlabIndices.equal_range(ComputeLayoutHash(Layout));
+    for (auto It = Range.first; It != Range.second; ++It)
+    {
+        if (It->second == SlabIndex)
+        {
+            m_SlabIndices.erase(It);
+            break;
+        }
+    }
+
+    // Release the memory of the slab
+    S = Slab{};
+    m_FreeSlabs.push_back(SlabIndex);
+}
+
+void CustomComponentPool::RemoveFromSlab(const Location& Loc)
+{
+    Slab& S = m_Slabs[Loc.SlabIndex];
+    VERIFY_EXPR(Loc.Slot < S.GetCount());
+
+    const size_t LastSlot = S.GetCount() - 1;
+    if (Loc.Slot != LastSlot)
+    {
+        const entt::entity Moved = S.Entities[LastSlot];
+
+        S.Entities[Loc.Slot]  = Moved;
+        S.EntityIDs[Loc.Slot] = S.EntityIDs[LastSlot];
+        if (S.DataSize != 0)
+            std::memcpy(S.Data.data() + size_t{Loc.Slot} * S.DataSize, S.Data.data() + LastSlot * S.DataSize, S.DataSize);
+
+        m_Locations.get(Moved).Slot = Loc.Slot;
+    }
+
+    S.Entities.pop_back();
+    S.EntityIDs.pop_back();
+    S.Data.resize(LastSlot * S.DataSize);
+
+    if (S.GetCount() == 0)
+        FreeSlab(Loc.SlabIndex);
+}
+
+bool CustomComponentPool::Set(entt::entity Entity, RadientEntityID EntityID, const RadientCustomComponentData& Component)
+{
+    VERIFY_EXPR(Component.pData != nullptr || Component.DataSize == 0);
+
+    const Uint32 SlabIndex = FindOrCreateSlab(Component);
+
+    const bool      Added = !m_Locations.contains(Entity);
+    const Location* pLoc  = !Added ? &m_Locations.get(Entity) : nullptr;
+
+    // The payload may point into this pool, e.g. when a component is copied from another entity.
+    // Growing the target slab or compacting or freeing the current slab of the entity would
+    // invalidate it, so copy it first. Other slabs are not modified.
+    const auto IsInSlab = [&Component](const Slab& S) {
+        const uintptr_t Address = reinterpret_cast<uintptr_t>(Component.pData);
+        const uintptr_t Begin   = reinterpret_cast<uintptr_t>(S.Data.data());
+        return Address >= Begin && Address < Begin + S.Data.size();
+    };
+    std::vector<Uint8>         PayloadCopy;
+    RadientCustomComponentData Source = Component;
+    if (Source.DataSize != 0 &&
+        (IsInSlab(m_Slabs[SlabIndex]) || (pLoc != nullptr && IsInSlab(m_Slabs[pLoc->SlabIndex]))))
+    {
+        const Uint8* pData = static_cast<const Uint8*>(Source.pData);
+        PayloadCopy.assign(pData, pData + Source.DataSize);
+        Source.pData = PayloadCopy.data();
+    }
+
+    if (pLoc != nullptr)
+    {
+        if (pLoc->SlabIndex == SlabIndex)
+        {
+            // Same layout: overwrite the payload in place.
+            Slab& S = m_Slabs[SlabIndex];
+            if (S.DataSize != 0)
+                std::memcpy(S.Data.data() + size_t{pLoc->Slot} * S.DataSize, Source.pData, S.DataSize);
+            return false;
+        }
+
+        RemoveFromSlab(*pLoc);
+        m_Locations.remove(Entity);
+    }
+
+    Slab&        S    = m_Slabs[SlabIndex];
+    const Uint32 Slot = static_cast<Uint32>(S.GetCount());
+    S.Entities.push_back(Entity);
+    S.EntityIDs.push_back(EntityID);
+    if (S.DataSize != 0)
+    {
+        const Uint8* pData = static_cast<const Uint8*>(Source.pData);
+        S.Data.insert(S.Data.end(), pData, pData + S.DataSize);
+    }
+    m_Locations.emplace(Entity, Location{SlabIndex, Slot});
+
+    return Added;
+}
+
+bool CustomComponentPool::Remove(entt::entity Entity)
+{
+    if (!m_Locations.contains(Entity))
+        return false;
+
+    RemoveFromSlab(m_Locations.get(Entity));
+    m_Locations.remove(Entity);
+    return true;
+}
+
+bool CustomComponentPool::Get(entt::entity Entity, RadientCustomComponentData& Component) const
+{
+    if (!m_Locations.contains(Entity))
+        return false;
+
+    const Location& Loc = m_Locations.get(Entity);
+    const Slab&     S   = m_Slabs[Loc.SlabIndex];
+
+    Component.Name     = S.Name.c_str();
+    Component.Schema   = S.Schema.c_str();
+    Component.Version  = S.Version;
+    Component.pData    = S.DataSize != 0 ? S.GetData(Loc.Slot) : nullptr;
+    Component.DataSize = S.DataSize;
+    return true;
+}
+
+} // namespace Diligent
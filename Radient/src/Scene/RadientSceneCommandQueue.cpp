@@ -0,0 +1,615 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Scene/RadientSceneCommandQueue.hpp"
+
+#include "Scene/RadientSceneState.hpp"
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct CreateEntityPayload
+{
+    RadientTransform     Transform;
+    RadientEntityID      Parent     = InvalidRadientEntityID;
+    RADIENT_ENTITY_FLAGS Flags      = RADIENT_ENTITY_FLAG_NONE;
+    Uint32               NameOffset = ~0u;
+};
+
+struct SetParentPayload
+{
+    RadientEntityID Parent             = InvalidRadientEntityID;
+    Bool            KeepWorldTransform = True;
+};
+
+struct MaterialBindingsPayload
+{
+    Uint32 BindingCount   = 0;
+    Uint32 BindingsOffset = ~0u;
+};
+
+struct CustomComponentPayload
+{
+    RadientComponentTypeID ComponentType = InvalidRadientComponentTypeID;
+    Uint32                 Version       = 0;
+    Uint32                 DataSize      = 0;
+    Uint32                 NameOffset    = ~0u;
+    Uint32                 SchemaOffset  = ~0u;
+    Uint32                 DataOffset    = ~0u;
+};
+
+template <typename PayloadType>
+PayloadType ReadPayload(const std::vector<Uint8>& Payload, Uint32 Offset)
+{
+    VERIFY_EXPR(static_cast<size_t>(Offset) + sizeof(PayloadType) <= Payload.size());
+    PayloadType Value;
+    std::memcpy(&Value, Payload.data() + Offset, sizeof(PayloadType));
+    return Value;
+}
+
+const void* GetPayloadData(const std::vector<Uint8>& Payload, Uint32 Offset)
+{
+    return Offset != ~0u ? Payload.data() + Offset : nullptr;
+}
+
+RadientEntityID MakeDeferredEntity(Uint32 ProducerID, Uint32 CreateIndex)
+{
+    return RadientSceneCommandQueue::DeferredEntityFlag | (static_cast<RadientEntityID>(ProducerID) << 32u) | CreateIndex;
+}
+
+Uint32 GetDeferredEntityProducerID(RadientEntityID Entity)
+{
+    return static_cast<Uint32>(Entity >> 32u) & RadientSceneCommandQueue::MaxProducerID;
+}
+
+Uint32 GetDeferredEntityCreateIndex(RadientEntityID Entity)
+{
+    return static_cast<Uint32>(Entity);
+}
+
+} // namespace
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::Record(CommandType Type, RadientEntityID Entity, Uint32 PayloadOffset)
+{
+    if (m_Commands.size() >= std::numeric_limits<Uint32>::max())
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    m_Commands.push_back({Entity, PayloadOffset, Type});
+    return RADIENT_STATUS_OK;
+}
+
+Uint32 RadientSceneCommandQueue::Arena::WriteBytes(const void* pData, size_t Size)
+{
+    VERIFY_EXPR(m_Payload.size() + Size < InvalidPayloadOffset);
+
+    const Uint32 Offset = static_cast<Uint32>(m_Payload.size());
+    m_Payload.resize(m_Payload.size() + Size);
+    if (Size > 0)
+        std::memcpy(m_Payload.data() + Offset, pData, Size);
+    return Offset;
+}
+
+Uint32 RadientSceneCommandQueue::Arena::WriteString(const Char* Str)
+{
+    return Str != nullptr ? WriteBytes(Str, std::strlen(Str) + 1) : InvalidPayloadOffset;
+}
+
+void RadientSceneCommandQueue::Arena::Reset()
+{
+    m_Commands.clear();
+    m_Payload.clear();
+    m_Assets.clear();
+    m_BatchBaseIndex = m_NextCreateIndex;
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::CreateEntity(const RadientEntityDesc& Desc, RadientEntityID& DeferredEntity)
+{
+    DeferredEntity = InvalidRadientEntityID;
+    if (m_NextCreateIndex == std::numeric_limits<Uint32>::max())
+        return RADIENT_STATUS_INVALID_OPERATION;
+
+    CreateEntityPayload Payload;
+    Payload.Transform  = Desc.Transform;
+    Payload.Parent     = Desc.Parent;
+    Payload.Flags      = Desc.Flags;
+    Payload.NameOffset = WriteString(Desc.Name);
+
+    DeferredEntity = MakeDeferredEntity(m_ProducerID, m_NextCreateIndex);
+
+    const RADIENT_STATUS Status = Record(CommandType::CreateEntity, DeferredEntity, WritePayload(Payload));
+    if (RADIENT_SUCCEEDED(Status))
+        ++m_NextCreateIndex;
+    else
+        DeferredEntity = InvalidRadientEntityID;
+    return Status;
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::DestroyEntity(RadientEntityID Entity)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::DestroyEntity, Entity);
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetEntityFlags(RadientEntityID Entity, RADIENT_ENTITY_FLAGS Flags)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetEntityFlags, Entity, WritePayload(Flags));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetEntityOwnVisibility(RadientEntityID Entity, Bool Visible)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetEntityOwnVisibility, Entity, WritePayload(Visible));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetParent(RadientEntityID Entity, RadientEntityID Parent, Bool KeepWorldTransform)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetParent, Entity, WritePayload(SetParentPayload{Parent, KeepWorldTransform}));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetLocalTransform(RadientEntityID Entity, const RadientTransform& Transform)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetLocalTransform, Entity, WritePayload(Transform));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetCamera(RadientEntityID Entity, const RadientCameraComponent& Camera)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetCamera, Entity, WritePayload(Camera));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetMesh(RadientEntityID Entity, const RadientMeshComponent& Mesh)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    if (Mesh.pMesh != nullptr)
+        m_Assets.emplace_back(Mesh.pMesh);
+
+    return Record(CommandType::SetMesh, Entity, WritePayload(Mesh));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetMeshRenderer(RadientEntityID Entity, const RadientMeshRendererComponent& Renderer)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetMeshRenderer, Entity, WritePayload(Renderer));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetMaterialBindings(RadientEntityID Entity, const RadientMaterialBindingsComponent& Bindings)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+    if (Bindings.BindingCount > 0 && Bindings.pBindings == nullptr)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    MaterialBindingsPayload Payload;
+    Payload.BindingCount = Bindings.BindingCount;
+    if (Bindings.BindingCount > 0)
+    {
+        Payload.BindingsOffset = WriteBytes(Bindings.pBindings, sizeof(RadientMaterialBinding) * Bindings.BindingCount);
+        for (Uint32 BindingIndex = 0; BindingIndex < Bindings.BindingCount; ++BindingIndex)
+        {
+            if (Bindings.pBindings[BindingIndex].pMaterial != nullptr)
+                m_Assets.emplace_back(Bindings.pBindings[BindingIndex].pMaterial);
+        }
+    }
+
+    return Record(CommandType::SetMaterialBindings, Entity, WritePayload(Payload));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetLight(RadientEntityID Entity, const RadientLightComponent& Light)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::SetLight, Entity, WritePayload(Light));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::SetCustomComponentData(RadientEntityID Entity, const RadientCustomComponentData& Component)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+    if (Component.DataSize > 0 && Component.pData == nullptr)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    CustomComponentPayload Payload;
+    Payload.ComponentType = Component.ComponentType;
+    Payload.Version       = Component.Version;
+    Payload.DataSize      = Component.DataSize;
+    Payload.NameOffset    = WriteString(Component.Name);
+    Payload.SchemaOffset  = WriteString(Component.Schema);
+    if (Component.pData != nullptr)
+        Payload.DataOffset = WriteBytes(Component.pData, Component.DataSize);
+
+    return Record(CommandType::SetCustomComponentData, Entity, WritePayload(Payload));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::RemoveComponent(RadientEntityID Entity, RadientComponentTypeID ComponentType)
+{
+    if (Entity == InvalidRadientEntityID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    return Record(CommandType::RemoveComponent, Entity, WritePayload(ComponentType));
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Arena::ResolveEntity(RadientEntityID DeferredEntity, RadientEntityID& Entity) const
+{
+    Entity = InvalidRadientEntityID;
+    if (!IsDeferredEntity(DeferredEntity) || GetDeferredEntityProducerID(DeferredEntity) != m_ProducerID)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    const Uint32 CreateIndex = GetDeferredEntityCreateIndex(DeferredEntity);
+    if (CreateIndex < m_ResolvedBaseIndex || CreateIndex - m_ResolvedBaseIndex >= m_ResolvedEntities.size())
+        return CreateIndex >= m_BatchBaseIndex ? RADIENT_STATUS_PENDING : RADIENT_STATUS_NOT_FOUND;
+
+    Entity = m_ResolvedEntities[CreateIndex - m_ResolvedBaseIndex];
+    return Entity != InvalidRadientEntityID ? RADIENT_STATUS_OK : RADIENT_STATUS_NOT_FOUND;
+}
+
+RadientSceneCommandQueue::RadientSceneCommandQueue()
+{
+}
+
+RadientSceneCommandQueue::~RadientSceneCommandQueue()
+{
+#ifdef DILIGENT_DEBUG
+    for (const std::unique_ptr<Arena>& pArena : m_Arenas)
+        VERIFY(!pArena->m_InUse, "Scene command queue is destroyed while arena ", pArena->m_ProducerID, " is still in use.");
+#endif
+}
+
+RadientSceneCommandQueue::Arena* RadientSceneCommandQueue::AcquireArena(Uint32 ProducerID)
+{
+    if (ProducerID > MaxProducerID)
+        return nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_ArenasMtx};
+
+    auto It = std::lower_bound(m_Arenas.begin(), m_Arenas.end(), ProducerID,
+                               [](const std::unique_ptr<Arena>& pArena, Uint32 ID) {
+                                   return pArena->m_ProducerID < ID;
+                               });
+    if (It == m_Arenas.end() || (*It)->m_ProducerID != ProducerID)
+        It = m_Arenas.insert(It, std::make_unique<Arena>(ProducerID));
+
+    Arena& Dst = **It;
+    if (Dst.m_InUse)
+        return nullptr;
+
+    Dst.m_InUse = true;
+    return &Dst;
+}
+
+void RadientSceneCommandQueue::ReleaseArena(Arena* pArena)
+{
+    if (pArena == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_ArenasMtx};
+    VERIFY(pArena->m_InUse, "Arena ", pArena->m_ProducerID, " is not in use.");
+    pArena->m_InUse = false;
+}
+
+RadientEntityID RadientSceneCommandQueue::ResolveDeferredEntity(RadientEntityID Entity) const
+{
+    if (!IsDeferredEntity(Entity))
+        return Entity;
+
+    const Uint32 ProducerID = GetDeferredEntityProducerID(Entity);
+
+    auto It = std::lower_bound(m_Arenas.begin(), m_Arenas.end(), ProducerID,
+                               [](const std::unique_ptr<Arena>& pArena, Uint32 ID) {
+                                   return pArena->m_ProducerID < ID;
+                               });
+    if (It == m_Arenas.end() || (*It)->m_ProducerID != ProducerID)
+        return InvalidRadientEntityID;
+
+    const Arena& Src         = **It;
+    const Uint32 CreateIndex = GetDeferredEntityCreateIndex(Entity);
+    if (CreateIndex < Src.m_ResolvedBaseIndex || CreateIndex - Src.m_ResolvedBaseIndex >= Src.m_ResolvedEntities.size())
+        return InvalidRadientEntityID;
+
+    return Src.m_ResolvedEntities[CreateIndex - Src.m_ResolvedBaseIndex];
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::ApplyCommand(RadientSceneState& State, const Arena& Src, const Arena::Command& Cmd, RadientEntityID Entity) const
+{
+    const std::vector<Uint8>& Payload = Src.m_Payload;
+    switch (Cmd.Type)
+    {
+        case CommandType::SetEntityFlags:
+            return State.SetEntityFlags(Entity, ReadPayload<RADIENT_ENTITY_FLAGS>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetEntityOwnVisibility:
+            return State.SetEntityOwnVisibility(Entity, ReadPayload<Bool>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetParent:
+        {
+            const SetParentPayload Parent = ReadPayload<SetParentPayload>(Payload, Cmd.PayloadOffset);
+            if (Parent.Parent == InvalidRadientEntityID)
+                return State.SetParent(Entity, InvalidRadientEntityID, Parent.KeepWorldTransform);
+
+            const RadientEntityID ParentEntity = ResolveDeferredEntity(Parent.Parent);
+            if (ParentEntity == InvalidRadientEntityID)
+                return RADIENT_STATUS_NOT_FOUND;
+            return State.SetParent(Entity, ParentEntity, Parent.KeepWorldTransform);
+        }
+
+        case CommandType::SetLocalTransform:
+            return State.SetLocalTransform(Entity, ReadPayload<RadientTransform>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetCamera:
+            return State.SetCamera(Entity, ReadPayload<RadientCameraComponent>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetMesh:
+            return State.SetMesh(Entity, ReadPayload<RadientMeshComponent>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetMeshRenderer:
+            return State.SetMeshRenderer(Entity, ReadPayload<RadientMeshRendererComponent>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetMaterialBindings:
+        {
+            const MaterialBindingsPayload Bindings = ReadPayload<MaterialBindingsPayload>(Payload, Cmd.PayloadOffset);
+
+            // Bindings were copied byte-wise into the payload and may not be suitably aligned, so copy them out.
+            std::vector<RadientMaterialBinding> BindingArray(Bindings.BindingCount);
+            if (Bindings.BindingCount > 0)
+                std::memcpy(BindingArray.data(), GetPayloadData(Payload, Bindings.BindingsOffset), sizeof(RadientMaterialBinding) * Bindings.BindingCount);
+
+            RadientMaterialBindingsComponent Component;
+            Component.pBindings    = BindingArray.data();
+            Component.BindingCount = Bindings.BindingCount;
+            return State.SetMaterialBindings(Entity, Component);
+        }
+
+        case CommandType::SetLight:
+            return State.SetLight(Entity, ReadPayload<RadientLightComponent>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::SetCustomComponentData:
+        {
+            const CustomComponentPayload Custom = ReadPayload<CustomComponentPayload>(Payload, Cmd.PayloadOffset);
+
+            RadientCustomComponentData Component;
+            Component.ComponentType = Custom.ComponentType;
+            Component.Name          = static_cast<const Char*>(GetPayloadData(Payload, Custom.NameOffset));
+            Component.Schema        = static_cast<const Char*>(GetPayloadData(Payload, Custom.SchemaOffset));
+            Component.Version       = Custom.Version;
+            Component.pData         = GetPayloadData(Payload, Custom.DataOffset);
+            Component.DataSize      = Custom.DataSize;
+            return State.SetCustomComponentData(Entity, Component);
+        }
+
+        case CommandType::RemoveComponent:
+            return State.RemoveComponent(Entity, ReadPayload<RadientComponentTypeID>(Payload, Cmd.PayloadOffset));
+
+        case CommandType::CreateEntity:
+        case CommandType::DestroyEntity:
+            UNEXPECTED("Entity creation and destruction are replayed in separate phases.");
+            return RADIENT_STATUS_INVALID_OPERATION;
+
+        default:
+            UNEXPECTED("Unexpected scene command type.");
+            return RADIENT_STATUS_INVALID_OPERATION;
+    }
+}
+
+RADIENT_STATUS RadientSceneCommandQueue::Replay(RadientSceneState& State, ReplayStats* pStats)
+{
+    std::lock_guard<std::mutex> Lock{m_ArenasMtx};
+
+    ReplayStats    Stats;
+    RADIENT_STATUS Status = RADIENT_STATUS_OK;
+
+    const auto OnCommandReplayed = [&Stats, &Status](RADIENT_STATUS CommandStatus) {
+        if (RADIENT_FAILED(CommandStatus))
+        {
+            ++Stats.NumFailed;
+            if (RADIENT_SUCCEEDED(Status))
+                Status = CommandStatus;
+        }
+        else
+        {
+            ++Stats.NumApplied;
+        }
+    };
+
+    // Phase 1: create entities. Deferred parents may be created later in the same batch,
+    // so they are attached once every entity of the batch exists.
+    m_TmpDeferredParents.clear();
+    for (Uint32 ArenaIndex = 0; ArenaIndex < m_Arenas.size(); ++ArenaIndex)
+    {
+        Arena& Src = *m_Arenas[ArenaIndex];
+
+        Src.m_ResolvedBaseIndex = Src.m_BatchBaseIndex;
+        Src.m_ResolvedEntities.assign(Src.m_NextCreateIndex - Src.m_BatchBaseIndex, InvalidRadientEntityID);
+        Stats.NumCommands += static_cast<Uint32>(Src.m_Commands.size());
+
+        for (Uint32 CommandIndex = 0; CommandIndex < Src.m_Commands.size(); ++CommandIndex)
+        {
+            const Arena::Command& Cmd = Src.m_Commands[CommandIndex];
+            if (Cmd.Type != CommandType::CreateEntity)
+                continue;
+
+            const CreateEntityPayload Payload = ReadPayload<CreateEntityPayload>(Src.m_Payload, Cmd.PayloadOffset);
+
+            RadientEntityDesc Desc;
+            Desc.Name      = static_cast<const Char*>(GetPayloadData(Src.m_Payload, Payload.NameOffset));
+            Desc.Parent    = IsDeferredEntity(Payload.Parent) ? InvalidRadientEntityID : Payload.Parent;
+            Desc.Flags     = Payload.Flags;
+            Desc.Transform = Payload.Transform;
+
+            RadientEntityID      Entity        = InvalidRadientEntityID;
+            const RADIENT_STATUS CommandStatus = State.CreateEntity(Desc, Entity);
+            if (RADIENT_SUCCEEDED(CommandStatus))
+                Src.m_ResolvedEntities[GetDeferredEntityCreateIndex(Cmd.Entity) - Src.m_ResolvedBaseIndex] = Entity;
+
+            if (RADIENT_SUCCEEDED(CommandStatus) && IsDeferredEntity(Payload.Parent))
+                m_TmpDeferredParents.push_back({Entity, ArenaIndex, CommandIndex});
+            else
+                OnCommandReplayed(CommandStatus);
+        }
+    }
+
+    for (const SortedCommand& Item : m_TmpDeferredParents)
+    {
+        const Arena&              Src     = *m_Arenas[Item.ArenaIndex];
+        const CreateEntityPayload Payload = ReadPayload<CreateEntityPayload>(Src.m_Payload, Src.m_Commands[Item.CommandIndex].PayloadOffset);
+        const RadientEntityID     Parent  = ResolveDeferredEntity(Payload.Parent);
+
+        // The local transform from the entity desc is relative to the parent, so do not preserve the world transform.
+        OnCommandReplayed(Parent != InvalidRadientEntityID ?
+                              State.SetParent(Item.Entity, Parent, False) :
+                              RADIENT_STATUS_NOT_FOUND);
+    }
+
+    // Phase 2: sort the remaining commands by entity. Arenas are ordered by producer ID, so
+    // (Entity, ArenaIndex, CommandIndex) is a total order that does not depend on which thread recorded first.
+    m_TmpSortedCommands.clear();
+    for (Uint32 ArenaIndex = 0; ArenaIndex < m_Arenas.size(); ++ArenaIndex)
+    {
+        const Arena& Src = *m_Arenas[ArenaIndex];
+        for (Uint32 CommandIndex = 0; CommandIndex < Src.m_Commands.size(); ++CommandIndex)
+        {
+            const Arena::Command& Cmd = Src.m_Commands[CommandIndex];
+            if (Cmd.Type == CommandType::CreateEntity)
+                continue;
+
+            const RadientEntityID Entity = ResolveDeferredEntity(Cmd.Entity);
+            if (Entity == InvalidRadientEntityID)
+            {
+                OnCommandReplayed(RADIENT_STATUS_NOT_FOUND);
+                continue;
+            }
+
+            m_TmpSortedCommands.push_back({Entity, ArenaIndex, CommandIndex});
+        }
+    }
+
+    std::sort(m_TmpSortedCommands.begin(), m_TmpSortedCommands.end(),
+              [](const SortedCommand& Lhs, const SortedCommand& Rhs) {
+                  if (Lhs.Entity != Rhs.Entity)
+                      return Lhs.Entity < Rhs.Entity;
+                  if (Lhs.ArenaIndex != Rhs.ArenaIndex)
+                      return Lhs.ArenaIndex < Rhs.ArenaIndex;
+                  return Lhs.CommandIndex < Rhs.CommandIndex;
+              });
+
+    m_TmpDestroyedEntities.clear();
+    for (size_t GroupStart = 0; GroupStart < m_TmpSortedCommands.size();)
+    {
+        const RadientEntityID Entity = m_TmpSortedCommands[GroupStart].Entity;
+
+        size_t GroupEnd      = GroupStart;
+        size_t LastTransform = m_TmpSortedCommands.size();
+        bool   IsDestroyed   = false;
+        for (; GroupEnd < m_TmpSortedCommands.size() && m_TmpSortedCommands[GroupEnd].Entity == Entity; ++GroupEnd)
+        {
+            const SortedCommand&  Item = m_TmpSortedCommands[GroupEnd];
+            const Arena::Command& Cmd  = m_Arenas[Item.ArenaIndex]->m_Commands[Item.CommandIndex];
+            if (Cmd.Type == CommandType::DestroyEntity)
+                IsDestroyed = true;
+            else if (Cmd.Type == CommandType::SetLocalTransform)
+                LastTransform = GroupEnd;
+        }
+
+        if (IsDestroyed)
+        {
+            // Everything else recorded for the entity is superseded by its destruction.
+            Stats.NumCoalesced += static_cast<Uint32>(GroupEnd - GroupStart) - 1;
+            m_TmpDestroyedEntities.push_back(Entity);
+        }
+        else
+        {
+            for (size_t ItemIndex = GroupStart; ItemIndex < GroupEnd; ++ItemIndex)
+            {
+                const SortedCommand&  Item = m_TmpSortedCommands[ItemIndex];
+                const Arena&          Src  = *m_Arenas[Item.ArenaIndex];
+                const Arena::Command& Cmd  = Src.m_Commands[Item.CommandIndex];
+                if (Cmd.Type == CommandType::SetLocalTransform && ItemIndex != LastTransform)
+                {
+                    ++Stats.NumCoalesced;
+                    continue;
+                }
+
+                OnCommandReplayed(ApplyCommand(State, Src, Cmd, Entity));
+            }
+        }
+
+        GroupStart = GroupEnd;
+    }
+
+    // Phase 3: destroy entities. An entity may already be gone because its ancestor was destroyed
+    // earlier in this phase, so only entities that were missing before the phase count as failures.
+    size_t NumAliveEntities = 0;
+    for (const RadientEntityID Entity : m_TmpDestroyedEntities)
+    {
+        if (RADIENT_SUCCEEDED(State.IsEntityAlive(Entity)))
+            m_TmpDestroyedEntities[NumAliveEntities++] = Entity;
+        else
+            OnCommandReplayed(RADIENT_STATUS_NOT_FOUND);
+    }
+    m_TmpDestroyedEntities.resize(NumAliveEntities);
+
+    for (const RadientEntityID Entity : m_TmpDestroyedEntities)
+    {
+        const RADIENT_STATUS CommandStatus = State.DestroyEntity(Entity);
+        OnCommandReplayed(CommandStatus == RADIENT_STATUS_NOT_FOUND ? RADIENT_STATUS_OK : CommandStatus);
+    }
+
+    for (const std::unique_ptr<Arena>& pArena : m_Arenas)
+        pArena->Reset();
+
+    if (pStats != nullptr)
+        *pStats = Stats;
+
+    return Status;
+}
+
+} // namespace Diligent
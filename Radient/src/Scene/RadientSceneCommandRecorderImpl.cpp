@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Scene/RadientSceneCommandRecorderImpl.hpp"
+
+#include <utility>
+
+namespace Diligent
+{
+
+RadientSceneCommandRecorderImpl::RadientSceneCommandRecorderImpl(IReferenceCounters*                       pRefCounters,
+                                                                 std::shared_ptr<RadientSceneCommandQueue> pQueue,
+                                                                 RadientSceneCommandQueue::Arena&          Arena) :
+    TBase{pRefCounters},
+    m_pQueue{std::move(pQueue)},
+    m_Arena{Arena}
+{}
+
+RadientSceneCommandRecorderImpl::~RadientSceneCommandRecorderImpl()
+{
+    m_pQueue->ReleaseArena(&m_Arena);
+}
+
+RefCntAutoPtr<IRadientSceneCommandRecorder> RadientSceneCommandRecorderImpl::Create(std::shared_ptr<RadientSceneCommandQueue> pQueue, Uint32 ProducerID)
+{
+    if (!pQueue)
+        return {};
+
+    RadientSceneCommandQueue::Arena* pArena = pQueue->AcquireArena(ProducerID);
+    if (pArena == nullptr)
+        return {};
+
+    return RefCntAutoPtr<RadientSceneCommandRecorderImpl>{MakeNewRCObj<RadientSceneCommandRecorderImpl>()(std::move(pQueue), *pArena)};
+}
+
+Uint32 RadientSceneCommandRecorderImpl::GetProducerID() const
+{
+    return m_Arena.GetProducerID();
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::CreateEntity(const RadientEntityDesc& Desc, RadientEntityID& Entity)
+{
+    return m_Arena.CreateEntity(Desc, Entity);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::DestroyEntity(RadientEntityID Entity)
+{
+    return m_Arena.DestroyEntity(Entity);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetEntityFlags(RadientEntityID Entity, RADIENT_ENTITY_FLAGS Flags)
+{
+    return m_Arena.SetEntityFlags(Entity, Flags);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetEntityOwnVisibility(RadientEntityID Entity, Bool Visible)
+{
+    return m_Arena.SetEntityOwnVisibility(Entity, Visible);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetParent(RadientEntityID Entity, RadientEntityID Parent, Bool KeepWorldTransform)
+{
+    return m_Arena.SetParent(Entity, Parent, KeepWorldTransform);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetLocalTransform(RadientEntityID Entity, const RadientTransform& Transform)
+{
+    return m_Arena.SetLocalTransform(Entity, Transform);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetCamera(RadientEntityID Entity, const RadientCameraComponent& Camera)
+{
+    return m_Arena.SetCamera(Entity, Camera);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetMesh(RadientEntityID Entity, const RadientMeshComponent& Mesh)
+{
+    return m_Arena.SetMesh(Entity, Mesh);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetMeshRenderer(RadientEntityID Entity, const RadientMeshRendererComponent& Renderer)
+{
+    return m_Arena.SetMeshRenderer(Entity, Renderer);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetMaterialBindings(RadientEntityID Entity, const RadientMaterialBindingsComponent& Bindings)
+{
+    return m_Arena.SetMaterialBindings(Entity, Bindings);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetLight(RadientEntityID Entity, const RadientLightComponent& Light)
+{
+    return m_Arena.SetLight(Entity, Light);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::SetCustomComponentData(RadientEntityID Entity, const RadientCustomComponentData& Component)
+{
+    return m_Arena.SetCustomComponentData(Entity, Component);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::RemoveComponent(RadientEntityID Entity, RadientComponentTypeID ComponentType)
+{
+    return m_Arena.RemoveComponent(Entity, ComponentType);
+}
+
+RADIENT_STATUS RadientSceneCommandRecorderImpl::ResolveEntity(RadientEntityID DeferredEntity, RadientEntityID& Entity) const
+{
+    return m_Arena.ResolveEntity(DeferredEntity, Entity);
+}
+
+} // namespace Diligent
@@ -0,0 +1,1173 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Scene/RadientSceneReplication.hpp"
+
+#include "Scene/RadientSceneState.hpp"
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace Diligent
+{
+
+namespace
+{
+
+enum FRAME_FLAGS : Uint8
+{
+    FRAME_FLAG_NONE                = 0u,
+    FRAME_FLAG_KEYFRAME            = 1u << 0u,
+    FRAME_FLAG_QUANTIZED_TRANSFORM = 1u << 1u,
+    FRAME_FLAG_ENVIRONMENT         = 1u << 2u,
+    FRAME_FLAGS_ALL                = (1u << 3u) - 1u
+};
+
+// Asset reference codes. Codes starting from AssetCodeFirstIndex refer to URIs
+// already sent since the last keyframe.
+constexpr Uint64 AssetCodeNull       = 0;
+constexpr Uint64 AssetCodeNewURI     = 1;
+constexpr Uint64 AssetCodeFirstIndex = 2;
+
+constexpr Uint32 TransformValueCount = 10;
+
+void WriteUint8(std::vector<Uint8>& Out, Uint8 Value)
+{
+    Out.push_back(Value);
+}
+
+void WriteVarUint(std::vector<Uint8>& Out, Uint64 Value)
+{
+    while (Value >= 0x80u)
+    {
+        Out.push_back(static_cast<Uint8>(Value | 0x80u));
+        Value >>= 7u;
+    }
+    Out.push_back(static_cast<Uint8>(Value));
+}
+
+void WriteVarInt(std::vector<Uint8>& Out, Int64 Value)
+{
+    // Zigzag encoding keeps small negative deltas small.
+    WriteVarUint(Out, (static_cast<Uint64>(Value) << 1u) ^ static_cast<Uint64>(Value >> 63));
+}
+
+void WriteFixedUint(std::vector<Uint8>& Out, Uint64 Value, Uint32 NumBytes)
+{
+    for (Uint32 i = 0; i < NumBytes; ++i)
+        Out.push_back(static_cast<Uint8>(Value >> (i * 8u)));
+}
+
+void WriteFloat(std::vector<Uint8>& Out, Float32 Value)
+{
+    Uint32 Bits = 0;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+    WriteFixedUint(Out, Bits, 4);
+}
+
+void WriteBytes(std::vector<Uint8>& Out, const void* pData, size_t Size)
+{
+    WriteVarUint(Out, Size);
+    if (Size != 0)
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(pData);
+        Out.insert(Out.end(), pBytes, pBytes + Size);
+    }
+}
+
+void WriteString(std::vector<Uint8>& Out, const Char* Str)
+{
+    WriteBytes(Out, Str, Str != nullptr ? std::strlen(Str) : 0);
+}
+
+void WriteRevisions(std::vector<Uint8>& Out, const RadientSceneRevisions& Revisions)
+{
+    WriteVarUint(Out, Revisions.Drawables);
+    WriteVarUint(Out, Revisions.Lights);
+    WriteVarUint(Out, Revisions.Transforms);
+    WriteVarUint(Out, Revisions.Visibility);
+    WriteVarUint(Out, Revisions.Cameras);
+    WriteVarUint(Out, Revisions.Environment);
+    WriteVarUint(Out, Revisions.CustomComponents);
+}
+
+void WriteCamera(std::vector<Uint8>& Out, const RadientCameraComponent& Camera)
+{
+    WriteUint8(Out, static_cast<Uint8>(Camera.Projection));
+    WriteFloat(Out, Camera.HorizontalAperture);
+    WriteFloat(Out, Camera.VerticalAperture);
+    WriteFloat(Out, Camera.HorizontalApertureOffset);
+    WriteFloat(Out, Camera.VerticalApertureOffset);
+    WriteFloat(Out, Camera.FocalLength);
+    WriteFloat(Out, Camera.ClippingRange.x);
+    WriteFloat(Out, Camera.ClippingRange.y);
+    WriteFloat(Out, Camera.FStop);
+    WriteFloat(Out, Camera.FocusDistance);
+}
+
+void WriteLight(std::vector<Uint8>& Out, const RadientLightComponent& Light)
+{
+    WriteUint8(Out, static_cast<Uint8>(Light.Type));
+    WriteUint8(Out, static_cast<Uint8>((Light.Normalize ? 1u : 0u) | (Light.EnableColorTemperature ? 2u : 0u) | (Light.CastShadows ? 4u : 0u)));
+    WriteFloat(Out, Light.Color.x);
+    WriteFloat(Out, Light.Color.y);
+    WriteFloat(Out, Light.Color.z);
+    WriteFloat(Out, Light.Intensity);
+    WriteFloat(Out, Light.Range);
+    WriteFloat(Out, Light.Exposure);
+    WriteFloat(Out, Light.Diffuse);
+    WriteFloat(Out, Light.Specular);
+    WriteFloat(Out, Light.ColorTemperature);
+    WriteFloat(Out, Light.Radius);
+    WriteFloat(Out, Light.Angle);
+    WriteFloat(Out, Light.InnerConeAngle);
+    WriteFloat(Out, Light.OuterConeAngle);
+    WriteFloat(Out, Light.ShapingFocus);
+}
+
+// Bounds-checked reader. Any out-of-range read invalidates the reader and returns zero.
+class StreamReader
+{
+public:
+    StreamReader(const Uint8* pData, size_t Size) noexcept :
+        m_pData{pData},
+        m_Size{pData != nullptr ? Size : 0}
+    {}
+
+    bool   IsValid() const { return m_Valid; }
+    bool   IsEnd() const { return m_Position == m_Size; }
+    size_t GetPosition() const { return m_Position; }
+    size_t GetRemainingSize() const { return m_Size - m_Position; }
+
+    void Invalidate()
+    {
+        m_Valid    = false;
+        m_Position = m_Size;
+    }
+
+    Uint8 ReadUint8()
+    {
+        if (!m_Valid || m_Position >= m_Size)
+            return InvalidValue<Uint8>();
+        return m_pData[m_Position++];
+    }
+
+    Uint64 ReadVarUint()
+    {
+        Uint64 Value = 0;
+        for (Uint32 Shift = 0; Shift < 64; Shift += 7)
+        {
+            const Uint8 Byte = ReadUint8();
+            Value |= static_cast<Uint64>(Byte & 0x7Fu) << Shift;
+            if ((Byte & 0x80u) == 0)
+                return Value;
+        }
+        return InvalidValue<Uint64>();
+    }
+
+    Int64 ReadVarInt()
+    {
+        const Uint64 Value = ReadVarUint();
+        return static_cast<Int64>(Value >> 1u) ^ -static_cast<Int64>(Value & 1u);
+    }
+
+    Uint32 ReadVarUint32()
+    {
+        const Uint64 Value = ReadVarUint();
+        return Value <= std::numeric_limits<Uint32>::max() ? static_cast<Uint32>(Value) : InvalidValue<Uint32>();
+    }
+
+    // Reads an element count and rejects counts that cannot fit into the remaining data,
+    // so that malformed frames cannot trigger huge allocations.
+    size_t ReadCount(size_t MinElementSize)
+    {
+        const Uint64 Count = ReadVarUint();
+        return Count <= GetRemainingSize() / MinElementSize ? static_cast<size_t>(Count) : InvalidValue<size_t>();
+    }
+
+    Uint64 ReadFixedUint(Uint32 NumBytes)
+    {
+        Uint64 Value = 0;
+        for (Uint32 i = 0; i < NumBytes; ++i)
+            Value |= static_cast<Uint64>(ReadUint8()) << (i * 8u);
+        return Value;
+    }
+
+    Float32 ReadFloat()
+    {
+        const Uint32 Bits  = static_cast<Uint32>(ReadFixedUint(4));
+        Float32      Value = 0;
+        std::memcpy(&Value, &Bits, sizeof(Value));
+        return Value;
+    }
+
+    void ReadBytes(std::vector<Uint8>& Data)
+    {
+        const size_t Size = ReadCount(1);
+        Data.assign(m_pData + m_Position, m_pData + m_Position + Size);
+        m_Position += Size;
+    }
+
+    void ReadString(std::string& Str)
+    {
+        const size_t Size = ReadCount(1);
+        Str.assign(reinterpret_cast<const char*>(m_pData + m_Position), Size);
+        m_Position += Size;
+    }
+
+private:
+    template <typename T>
+    T InvalidValue()
+    {
+        Invalidate();
+        return T{};
+    }
+
+private:
+    const Uint8* const m_pData;
+    const size_t       m_Size;
+    size_t             m_Position = 0;
+    bool               m_Valid    = true;
+};
+
+RadientSceneRevisions ReadRevisions(StreamReader& Reader)
+{
+    RadientSceneRevisions Revisions;
+    Revisions.Drawables        = Reader.ReadVarUint();
+    Revisions.Lights           = Reader.ReadVarUint();
+    Revisions.Transforms       = Reader.ReadVarUint();
+    Revisions.Visibility       = Reader.ReadVarUint();
+    Revisions.Cameras          = Reader.ReadVarUint();
+    Revisions.Environment      = Reader.ReadVarUint();
+    Revisions.CustomComponents = Reader.ReadVarUint();
+    return Revisions;
+}
+
+void ReadCamera(StreamReader& Reader, RadientCameraComponent& Camera)
+{
+    Camera.Projection               = static_cast<RADIENT_CAMERA_PROJECTION>(Reader.ReadUint8());
+    Camera.HorizontalAperture       = Reader.ReadFloat();
+    Camera.VerticalAperture         = Reader.ReadFloat();
+    Camera.HorizontalApertureOffset = Reader.ReadFloat();
+    Camera.VerticalApertureOffset   = Reader.ReadFloat();
+    Camera.FocalLength              = Reader.ReadFloat();
+    Camera.ClippingRange.x          = Reader.ReadFloat();
+    Camera.ClippingRange.y          = Reader.ReadFloat();
+    Camera.FStop                    = Reader.ReadFloat();
+    Camera.FocusDistance            = Reader.ReadFloat();
+}
+
+void ReadLight(StreamReader& Reader, RadientLightComponent& Light)
+{
+    Light.Type                   = static_cast<RADIENT_LIGHT_TYPE>(Reader.ReadUint8());
+    const Uint8 LightFlags       = Reader.ReadUint8();
+    Light.Normalize              = (LightFlags & 1u) != 0 ? True : False;
+    Light.EnableColorTemperature = (LightFlags & 2u) != 0 ? True : False;
+    Light.CastShadows            = (LightFlags & 4u) != 0 ? True : False;
+    Light.Color.x                = Reader.ReadFloat();
+    Light.Color.y                = Reader.ReadFloat();
+    Light.Color.z                = Reader.ReadFloat();
+    Light.Intensity              = Reader.ReadFloat();
+    Light.Range                  = Reader.ReadFloat();
+    Light.Exposure               = Reader.ReadFloat();
+    Light.Diffuse                = Reader.ReadFloat();
+    Light.Specular               = Reader.ReadFloat();
+    Light.ColorTemperature       = Reader.ReadFloat();
+    Light.Radius                 = Reader.ReadFloat();
+    Light.Angle                  = Reader.ReadFloat();
+    Light.InnerConeAngle         = Reader.ReadFloat();
+    Light.OuterConeAngle         = Reader.ReadFloat();
+    Light.ShapingFocus           = Reader.ReadFloat();
+}
+
+void TransformToValues(const RadientTransform& Transform, Float32 Values[TransformValueCount])
+{
+    // q and -q represent the same rotation; keep w non-negative so that deltas stay small.
+    const Float32 Sign = Transform.Rotation.w < 0.f ? -1.f : 1.f;
+
+    Values[0] = Transform.Position.x;
+    Values[1] = Transform.Position.y;
+    Values[2] = Transform.Position.z;
+    Values[3] = Transform.Rotation.x * Sign;
+    Values[4] = Transform.Rotation.y * Sign;
+    Values[5] = Transform.Rotation.z * Sign;
+    Values[6] = Transform.Rotation.w * Sign;
+    Values[7] = Transform.Scale.x;
+    Values[8] = Transform.Scale.y;
+    Values[9] = Transform.Scale.z;
+}
+
+RadientTransform ValuesToTransform(const Float32 Values[TransformValueCount])
+{
+    RadientTransform Transform;
+    Transform.Position = {Values[0], Values[1], Values[2]};
+    Transform.Rotation = {Values[3], Values[4], Values[5], Values[6]};
+    Transform.Scale    = {Values[7], Values[8], Values[9]};
+    return Transform;
+}
+
+Float32 GetTransformValuePrecision(Uint32 ValueIndex, Float32 PositionPrecision, Float32 RotationPrecision, Float32 ScalePrecision)
+{
+    return ValueIndex < 3 ? PositionPrecision : (ValueIndex < 7 ? RotationPrecision : ScalePrecision);
+}
+
+bool IsValidPrecision(Float32 Precision)
+{
+    return std::isfinite(Precision) && Precision > 0.f;
+}
+
+} // namespace
+
+RadientSceneDeltaEncoder::RadientSceneDeltaEncoder() noexcept :
+    RadientSceneDeltaEncoder{Desc{}}
+{
+}
+
+RadientSceneDeltaEncoder::RadientSceneDeltaEncoder(const Desc& EncoderDesc) noexcept :
+    m_Desc{EncoderDesc}
+{
+    VERIFY(!m_Desc.QuantizeTransforms ||
+               (IsValidPrecision(m_Desc.PositionPrecision) && IsValidPrecision(m_Desc.RotationPrecision) && IsValidPrecision(m_Desc.ScalePrecision)),
+           "Transform quantization precision must be finite and positive");
+}
+
+RadientSceneDeltaEncoder::QuantizedTransform RadientSceneDeltaEncoder::Quantize(const RadientTransform& Transform) const
+{
+    Float32 Values[TransformValueCount];
+    TransformToValues(Transform, Values);
+
+    QuantizedTransform Quantized;
+    for (Uint32 i = 0; i < TransformValueCount; ++i)
+    {
+        const Float32 Precision = GetTransformValuePrecision(i, m_Desc.PositionPrecision, m_Desc.RotationPrecision, m_Desc.ScalePrecision);
+        Quantized.Values[i]     = static_cast<Int64>(std::llround(static_cast<double>(Values[i]) / Precision));
+    }
+    return Quantized;
+}
+
+RADIENT_STATUS RadientSceneDeltaEncoder::EncodeFrame(RadientSceneState& State, std::vector<Uint8>& Stream)
+{
+    State.SetEntityChangeLogEnabled(true);
+
+    const bool IsKeyframe = m_KeyframeRequested ||
+        (m_Desc.KeyframeInterval != 0 && m_FramesSinceKeyframe >= m_Desc.KeyframeInterval);
+
+    const RadientSceneRevisions Revisions = State.GetSceneRevisions();
+
+    m_Records.clear();
+    m_Destroyed.clear();
+    if (IsKeyframe)
+    {
+        // A keyframe does not depend on previously sent data.
+        m_SentTransforms.clear();
+        m_SentURIs.clear();
+
+        State.EnumerateEntities([&](RadientEntityID Entity) {
+            EntityRecord Record;
+            Record.Entity = Entity;
+            Record.Mask   = RadientSceneState::ENTITY_CHANGE_FLAGS_ALL;
+
+            const RadientComponentTypeID* pComponentTypes   = nullptr;
+            Uint32                        NumComponentTypes = 0;
+            State.GetCustomComponentTypes(Entity, pComponentTypes, NumComponentTypes);
+            Record.CustomComponentTypes.assign(pComponentTypes, pComponentTypes + NumComponentTypes);
+
+            m_Records.emplace_back(std::move(Record));
+        });
+    }
+    else
+    {
+        m_Destroyed = State.GetDestroyedEntityChanges();
+        std::sort(m_Destroyed.begin(), m_Destroyed.end());
+        for (RadientEntityID Entity : m_Destroyed)
+            m_SentTransforms.erase(Entity);
+
+        // The view only visits entities with pending changes, so this is proportional to the number of changed entities.
+        State.EnumerateEntityChanges([&](const RadientSceneState::EntityChange& Change) {
+            EntityRecord Record;
+            Record.Entity = Change.Entity;
+            Record.Mask   = Change.Flags;
+            Record.CustomComponentTypes.assign(Change.pCustomComponentTypes, Change.pCustomComponentTypes + Change.NumCustomComponentTypes);
+            m_Records.emplace_back(std::move(Record));
+        });
+    }
+    std::sort(m_Records.begin(), m_Records.end(), [](const EntityRecord& Lhs, const EntityRecord& Rhs) {
+        return Lhs.Entity < Rhs.Entity;
+    });
+
+    if (m_Desc.QuantizeTransforms && !IsKeyframe)
+    {
+        // Drop transform changes that are below the quantization precision, and records that become empty.
+        for (EntityRecord& Record : m_Records)
+        {
+            if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM) != 0 &&
+                (Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CREATED) == 0 &&
+                !IsTransformChangeSignificant(State, Record.Entity))
+                Record.Mask &= ~static_cast<Uint32>(RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM);
+        }
+        m_Records.erase(std::remove_if(m_Records.begin(), m_Records.end(), [](const EntityRecord& Record) { return Record.Mask == 0; }),
+                        m_Records.end());
+    }
+
+    const bool WriteEnvironment = IsKeyframe || Revisions.Environment != m_EnvironmentRevision;
+
+    Uint8 FrameFlags = FRAME_FLAG_NONE;
+    if (IsKeyframe)
+        FrameFlags |= FRAME_FLAG_KEYFRAME;
+    if (m_Desc.QuantizeTransforms)
+        FrameFlags |= FRAME_FLAG_QUANTIZED_TRANSFORM;
+    if (WriteEnvironment)
+        FrameFlags |= FRAME_FLAG_ENVIRONMENT;
+
+    m_Frame.clear();
+    WriteUint8(m_Frame, FrameFlags);
+    WriteVarUint(m_Frame, m_FrameIndex);
+    if (IsKeyframe && m_Desc.QuantizeTransforms)
+    {
+        WriteFloat(m_Frame, m_Desc.PositionPrecision);
+        WriteFloat(m_Frame, m_Desc.RotationPrecision);
+        WriteFloat(m_Frame, m_Desc.ScalePrecision);
+    }
+    WriteRevisions(m_Frame, Revisions);
+
+    WriteVarUint(m_Frame, m_Destroyed.size());
+    RadientEntityID PrevEntity = InvalidRadientEntityID;
+    for (RadientEntityID Entity : m_Destroyed)
+    {
+        WriteVarUint(m_Frame, Entity - PrevEntity);
+        PrevEntity = Entity;
+    }
+
+    WriteVarUint(m_Frame, m_Records.size());
+    PrevEntity = InvalidRadientEntityID;
+    for (const EntityRecord& Record : m_Records)
+    {
+        WriteVarUint(m_Frame, Record.Entity - PrevEntity);
+        PrevEntity = Record.Entity;
+        WriteEntityRecord(State, Record, m_Frame);
+    }
+
+    if (WriteEnvironment)
+    {
+        const RadientEnvironmentDesc& Environment = State.GetEnvironment();
+        WriteAssetReference(Environment.pEnvironmentMap, m_Frame);
+        WriteFloat(m_Frame, Environment.Color.x);
+        WriteFloat(m_Frame, Environment.Color.y);
+        WriteFloat(m_Frame, Environment.Color.z);
+        WriteFloat(m_Frame, Environment.Intensity);
+        WriteFloat(m_Frame, Environment.Exposure);
+    }
+
+    const size_t StreamOffset = Stream.size();
+    WriteVarUint(Stream, m_Frame.size());
+    Stream.insert(Stream.end(), m_Frame.begin(), m_Frame.end());
+
+    m_LastFrameStats.FrameIndex           = m_FrameIndex;
+    m_LastFrameStats.IsKeyframe           = IsKeyframe;
+    m_LastFrameStats.NumEntityRecords     = static_cast<Uint32>(m_Records.size());
+    m_LastFrameStats.NumDestroyedEntities = static_cast<Uint32>(m_Destroyed.size());
+    m_LastFrameStats.NumBytes             = Stream.size() - StreamOffset;
+
+    State.ClearEntityChanges();
+    m_EnvironmentRevision = Revisions.Environment;
+    m_FramesSinceKeyframe = IsKeyframe ? 1 : m_FramesSinceKeyframe + 1;
+    m_KeyframeRequested   = false;
+    ++m_FrameIndex;
+
+    return RADIENT_STATUS_OK;
+}
+
+bool RadientSceneDeltaEncoder::IsTransformChangeSignificant(const RadientSceneState& State, RadientEntityID Entity) const
+{
+    const auto SentIt = m_SentTransforms.find(Entity);
+    if (SentIt == m_SentTransforms.end())
+        return true;
+
+    RadientTransform Transform;
+    State.GetLocalTransform(Entity, Transform);
+
+    const QuantizedTransform Quantized = Quantize(Transform);
+    return !std::equal(std::begin(Quantized.Values), std::end(Quantized.Values), std::begin(SentIt->second.Values));
+}
+
+void RadientSceneDeltaEncoder::WriteEntityRecord(const RadientSceneState& State, const EntityRecord& Record, std::vector<Uint8>& Frame)
+{
+    const RadientEntityID Entity = Record.Entity;
+    const Uint32          Mask   = Record.Mask;
+
+    WriteVarUint(Frame, Mask);
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CREATED) != 0)
+    {
+        const Char* Name = nullptr;
+        State.GetEntityName(Entity, Name);
+        WriteString(Frame, Name);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_FLAGS) != 0)
+    {
+        RADIENT_ENTITY_FLAGS Flags = RADIENT_ENTITY_FLAG_NONE;
+        State.GetEntityFlags(Entity, Flags);
+        WriteVarUint(Frame, static_cast<Uint32>(Flags));
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_PARENT) != 0)
+    {
+        RadientEntityID Parent = InvalidRadientEntityID;
+        State.GetParent(Entity, Parent);
+        WriteVarUint(Frame, Parent);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM) != 0)
+    {
+        RadientTransform Transform;
+        State.GetLocalTransform(Entity, Transform);
+        WriteTransform(Entity, Transform, Frame);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CAMERA) != 0)
+    {
+        RadientCameraComponent Camera;
+        const bool             HasCamera = State.GetCamera(Entity, Camera) == RADIENT_STATUS_OK;
+        WriteUint8(Frame, HasCamera ? 1 : 0);
+        if (HasCamera)
+            WriteCamera(Frame, Camera);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH) != 0)
+    {
+        RadientMeshComponent Mesh;
+        const bool           HasMesh = State.GetMesh(Entity, Mesh) == RADIENT_STATUS_OK;
+        WriteUint8(Frame, HasMesh ? 1 : 0);
+        if (HasMesh)
+            WriteAssetReference(Mesh.pMesh, Frame);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH_RENDERER) != 0)
+    {
+        RadientMeshRendererComponent Renderer;
+        const bool                   HasRenderer = State.GetMeshRenderer(Entity, Renderer) == RADIENT_STATUS_OK;
+        WriteUint8(Frame, HasRenderer ? 1 : 0);
+        if (HasRenderer)
+        {
+            WriteFixedUint(Frame, Renderer.VisibilityMask, 8);
+            WriteFloat(Frame, Renderer.SortBias);
+            WriteUint8(Frame, static_cast<Uint8>((Renderer.CastShadows ? 1u : 0u) | (Renderer.Occluder ? 2u : 0u)));
+        }
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS) != 0)
+    {
+        RadientMaterialBindingsComponent Bindings;
+        const bool                       HasBindings = State.GetMaterialBindings(Entity, Bindings) == RADIENT_STATUS_OK;
+        WriteUint8(Frame, HasBindings ? 1 : 0);
+        if (HasBindings)
+        {
+            WriteVarUint(Frame, Bindings.BindingCount);
+            for (Uint32 i = 0; i < Bindings.BindingCount; ++i)
+            {
+                WriteVarUint(Frame, Bindings.pBindings[i].PrimitiveIndex);
+                WriteAssetReference(Bindings.pBindings[i].pMaterial, Frame);
+            }
+        }
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_LIGHT) != 0)
+    {
+        RadientLightComponent Light;
+        const bool            HasLight = State.GetLight(Entity, Light) == RADIENT_STATUS_OK;
+        WriteUint8(Frame, HasLight ? 1 : 0);
+        if (HasLight)
+            WriteLight(Frame, Light);
+    }
+
+    if ((Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS) != 0)
+    {
+        WriteVarUint(Frame, Record.CustomComponentTypes.size());
+        for (RadientComponentTypeID ComponentType : Record.CustomComponentTypes)
+        {
+            WriteVarUint(Frame, ComponentType);
+
+            RadientCustomComponentData Component;
+            const bool                 HasComponent = State.GetCustomComponentData(Entity, ComponentType, Component) == RADIENT_STATUS_OK;
+            WriteUint8(Frame, HasComponent ? 1 : 0);
+            if (HasComponent)
+            {
+                WriteString(Frame, Component.Name);
+                WriteString(Frame, Component.Schema);
+                WriteVarUint(Frame, Component.Version);
+                WriteBytes(Frame, Component.pData, Component.DataSize);
+            }
+        }
+    }
+}
+
+void RadientSceneDeltaEncoder::WriteAssetReference(const IRadientAsset* pAsset, std::vector<Uint8>& Frame)
+{
+    const RadientAssetReference* pRef = pAsset != nullptr ? &pAsset->GetReference() : nullptr;
+    if (pRef == nullptr || pRef->URI == nullptr || *pRef->URI == '\0')
+    {
+        // Assets without a URI cannot be resolved on the receiving side.
+        WriteVarUint(Frame, AssetCodeNull);
+        return;
+    }
+
+    const auto URIIt = m_SentURIs.find(pRef->URI);
+    if (URIIt != m_SentURIs.end())
+    {
+        WriteVarUint(Frame, AssetCodeFirstIndex + URIIt->second);
+    }
+    else
+    {
+        WriteVarUint(Frame, AssetCodeNewURI);
+        WriteString(Frame, pRef->URI);
+        m_SentURIs.emplace(pRef->URI, static_cast<Uint32>(m_SentURIs.size()));
+    }
+    WriteVarUint(Frame, pRef->Version);
+}
+
+void RadientSceneDeltaEncoder::WriteTransform(RadientEntityID Entity, const RadientTransform& Transform, std::vector<Uint8>& Frame)
+{
+    if (!m_Desc.QuantizeTransforms)
+    {
+        Float32 Values[TransformValueCount];
+        TransformToValues(Transform, Values);
+        for (Float32 Value : Values)
+            WriteFloat(Frame, Value);
+        return;
+    }
+
+    // New entities and keyframes are delta-coded against zero.
+    QuantizedTransform&      Sent      = m_SentTransforms[Entity];
+    const QuantizedTransform Quantized = Quantize(Transform);
+    for (Uint32 i = 0; i < TransformValueCount; ++i)
+        WriteVarInt(Frame, Quantized.Values[i] - Sent.Values[i]);
+    Sent = Quantized;
+}
+
+RadientSceneDeltaDecoder::RadientSceneDeltaDecoder() noexcept
+{
+}
+
+RadientEntityID RadientSceneDeltaDecoder::FindEntity(RadientEntityID SourceEntity) const
+{
+    const auto It = m_EntityMap.find(SourceEntity);
+    return It != m_EntityMap.end() ? It->second.Entity : InvalidRadientEntityID;
+}
+
+RADIENT_STATUS RadientSceneDeltaDecoder::DecodeFrame(const Uint8* pData, size_t DataSize, RadientSceneState& Replica, size_t& BytesConsumed)
+{
+    BytesConsumed = 0;
+
+    StreamReader Prefix{pData, DataSize};
+    const Uint64 FrameSize = Prefix.ReadVarUint();
+    if (!Prefix.IsValid() || FrameSize > Prefix.GetRemainingSize())
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    BytesConsumed = Prefix.GetPosition() + static_cast<size_t>(FrameSize);
+    StreamReader Reader{pData + Prefix.GetPosition(), static_cast<size_t>(FrameSize)};
+
+    const Uint8  FrameFlags = Reader.ReadUint8();
+    const Uint64 FrameIndex = Reader.ReadVarUint();
+    if (!Reader.IsValid() || (FrameFlags & ~FRAME_FLAGS_ALL) != 0)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    const bool IsKeyframe = (FrameFlags & FRAME_FLAG_KEYFRAME) != 0;
+    const bool Quantized  = (FrameFlags & FRAME_FLAG_QUANTIZED_TRANSFORM) != 0;
+
+    m_LastFrameStats            = {};
+    m_LastFrameStats.FrameIndex = FrameIndex;
+    m_LastFrameStats.IsKeyframe = IsKeyframe;
+
+    // Delta frames can only be applied on top of the frame they were encoded after.
+    if (!IsKeyframe && (!m_Synchronized || FrameIndex != m_NextFrameIndex))
+    {
+        m_Synchronized = false;
+        return RADIENT_STATUS_OUT_OF_DATE;
+    }
+
+    Float32 PositionPrecision = m_PositionPrecision;
+    Float32 RotationPrecision = m_RotationPrecision;
+    Float32 ScalePrecision    = m_ScalePrecision;
+    if (IsKeyframe && Quantized)
+    {
+        PositionPrecision = Reader.ReadFloat();
+        RotationPrecision = Reader.ReadFloat();
+        ScalePrecision    = Reader.ReadFloat();
+    }
+    if (Quantized && !(IsValidPrecision(PositionPrecision) && IsValidPrecision(RotationPrecision) && IsValidPrecision(ScalePrecision)))
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    const RadientSceneRevisions Revisions = ReadRevisions(Reader);
+
+    std::vector<RadientEntityID> Destroyed(Reader.ReadCount(1));
+    RadientEntityID              PrevEntity = InvalidRadientEntityID;
+    for (RadientEntityID& Entity : Destroyed)
+    {
+        PrevEntity += Reader.ReadVarUint();
+        Entity = PrevEntity;
+    }
+
+    // URIs received in this frame are appended to the table only if the whole frame is valid.
+    const size_t             BaseURICount = IsKeyframe ? 0 : m_URIs.size();
+    std::vector<std::string> NewURIs;
+
+    const auto ReadAsset = [&](AssetRecord& Asset) {
+        const Uint64 Code = Reader.ReadVarUint();
+        if (Code == AssetCodeNull)
+        {
+            Asset = {};
+            return;
+        }
+
+        if (Code == AssetCodeNewURI)
+        {
+            Reader.ReadString(Asset.URI);
+            NewURIs.push_back(Asset.URI);
+        }
+        else
+        {
+            const Uint64 Index = Code - AssetCodeFirstIndex;
+            if (Index < BaseURICount)
+                Asset.URI = m_URIs[static_cast<size_t>(Index)];
+            else if (Index - BaseURICount < NewURIs.size())
+                Asset.URI = NewURIs[static_cast<size_t>(Index - BaseURICount)];
+            else
+                Reader.Invalidate();
+        }
+        Asset.Version = Reader.ReadVarUint();
+    };
+
+    m_Records.resize(Reader.ReadCount(2));
+    PrevEntity = InvalidRadientEntityID;
+    for (EntityRecord& Record : m_Records)
+    {
+        Record = {};
+
+        PrevEntity += Reader.ReadVarUint();
+        Record.SourceEntity = PrevEntity;
+        Record.Mask         = Reader.ReadVarUint32();
+        if ((Record.Mask & ~static_cast<Uint32>(RadientSceneState::ENTITY_CHANGE_FLAGS_ALL)) != 0)
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CREATED) != 0)
+            Reader.ReadString(Record.Name);
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_FLAGS) != 0)
+            Record.Flags = static_cast<RADIENT_ENTITY_FLAGS>(Reader.ReadVarUint32());
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_PARENT) != 0)
+            Record.Parent = Reader.ReadVarUint();
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM) != 0)
+        {
+            Float32 Values[TransformValueCount];
+            if (Quantized)
+            {
+                const auto MappingIt = IsKeyframe ? m_EntityMap.end() : m_EntityMap.find(Record.SourceEntity);
+                for (Uint32 i = 0; i < TransformValueCount; ++i)
+                {
+                    const Int64 Base                = MappingIt != m_EntityMap.end() ? MappingIt->second.Transform.Values[i] : 0;
+                    Record.QuantizedValues.Values[i] = Base + Reader.ReadVarInt();
+
+                    const Float32 Precision = GetTransformValuePrecision(i, PositionPrecision, RotationPrecision, ScalePrecision);
+                    Values[i]               = static_cast<Float32>(static_cast<double>(Record.QuantizedValues.Values[i]) * Precision);
+                }
+            }
+            else
+            {
+                for (Float32& Value : Values)
+                    Value = Reader.ReadFloat();
+            }
+            Record.Transform = ValuesToTransform(Values);
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CAMERA) != 0)
+        {
+            Record.HasCamera = Reader.ReadUint8() != 0;
+            if (Record.HasCamera)
+                ReadCamera(Reader, Record.Camera);
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH) != 0)
+        {
+            Record.HasMesh = Reader.ReadUint8() != 0;
+            if (Record.HasMesh)
+                ReadAsset(Record.Mesh);
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH_RENDERER) != 0)
+        {
+            Record.HasMeshRenderer = Reader.ReadUint8() != 0;
+            if (Record.HasMeshRenderer)
+            {
+                Record.MeshRenderer.VisibilityMask = Reader.ReadFixedUint(8);
+                Record.MeshRenderer.SortBias       = Reader.ReadFloat();
+                const Uint8 RendererFlags          = Reader.ReadUint8();
+                Record.MeshRenderer.CastShadows    = (RendererFlags & 1u) != 0 ? True : False;
+                Record.MeshRenderer.Occluder       = (RendererFlags & 2u) != 0 ? True : False;
+            }
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS) != 0)
+        {
+            Record.HasMaterialBindings = Reader.ReadUint8() != 0;
+            if (Record.HasMaterialBindings)
+            {
+                Record.MaterialBindings.resize(Reader.ReadCount(2));
+                for (MaterialBindingRecord& Binding : Record.MaterialBindings)
+                {
+                    Binding.PrimitiveIndex = Reader.ReadVarUint32();
+                    ReadAsset(Binding.Material);
+                }
+            }
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_LIGHT) != 0)
+        {
+            Record.HasLight = Reader.ReadUint8() != 0;
+            if (Record.HasLight)
+                ReadLight(Reader, Record.Light);
+        }
+
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS) != 0)
+        {
+            Record.CustomComponents.resize(Reader.ReadCount(2));
+            for (CustomComponentRecord& Component : Record.CustomComponents)
+            {
+                Component.ComponentType = Reader.ReadVarUint();
+                Component.Present       = Reader.ReadUint8() != 0;
+                if (Component.Present)
+                {
+                    Reader.ReadString(Component.Name);
+                    Reader.ReadString(Component.Schema);
+                    Component.Version = Reader.ReadVarUint32();
+                    Reader.ReadBytes(Component.Data);
+                }
+            }
+        }
+
+        if (!Reader.IsValid())
+            return RADIENT_STATUS_INVALID_ARGUMENT;
+    }
+
+    EnvironmentRecord Environment;
+    if ((FrameFlags & FRAME_FLAG_ENVIRONMENT) != 0)
+    {
+        ReadAsset(Environment.EnvironmentMap);
+        Environment.Color.x   = Reader.ReadFloat();
+        Environment.Color.y   = Reader.ReadFloat();
+        Environment.Color.z   = Reader.ReadFloat();
+        Environment.Intensity = Reader.ReadFloat();
+        Environment.Exposure  = Reader.ReadFloat();
+    }
+
+    if (!Reader.IsValid() || !Reader.IsEnd())
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    // The frame is well-formed; apply it.
+    if (IsKeyframe)
+        m_URIs.clear();
+    m_URIs.insert(m_URIs.end(), std::make_move_iterator(NewURIs.begin()), std::make_move_iterator(NewURIs.end()));
+
+    m_PositionPrecision = PositionPrecision;
+    m_RotationPrecision = RotationPrecision;
+    m_ScalePrecision    = ScalePrecision;
+
+    const auto DestroyMappedEntity = [&](RadientEntityID SourceEntity) {
+        const auto It = m_EntityMap.find(SourceEntity);
+        if (It == m_EntityMap.end())
+            return;
+
+        // Descendants may already be gone together with their destroyed ancestor.
+        if (It->second.Entity != InvalidRadientEntityID &&
+            Replica.DestroyEntity(It->second.Entity) == RADIENT_STATUS_OK)
+            ++m_LastFrameStats.NumDestroyed;
+        m_EntityMap.erase(It);
+    };
+
+    for (RadientEntityID SourceEntity : Destroyed)
+        DestroyMappedEntity(SourceEntity);
+
+    if (IsKeyframe)
+    {
+        // Entities that are not in the keyframe no longer exist in the source scene.
+        std::vector<RadientEntityID> StaleEntities;
+        for (const auto& It : m_EntityMap)
+        {
+            const auto RecordIt = std::lower_bound(m_Records.begin(), m_Records.end(), It.first,
+                                                   [](const EntityRecord& Record, RadientEntityID SourceEntity) {
+                                                       return Record.SourceEntity < SourceEntity;
+                                                   });
+            if (RecordIt == m_Records.end() || RecordIt->SourceEntity != It.first)
+                StaleEntities.push_back(It.first);
+        }
+        std::sort(StaleEntities.begin(), StaleEntities.end());
+        for (RadientEntityID SourceEntity : StaleEntities)
+            DestroyMappedEntity(SourceEntity);
+    }
+
+    // Create new entities first, without parents, so that records can reference entities created later in the frame.
+    for (const EntityRecord& Record : m_Records)
+    {
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CREATED) == 0 ||
+            m_EntityMap.find(Record.SourceEntity) != m_EntityMap.end())
+            continue;
+
+        RadientEntityDesc Desc;
+        Desc.Name      = Record.Name.c_str();
+        Desc.Flags     = Record.Flags;
+        Desc.Transform = Record.Transform;
+
+        EntityMapping& Mapping = m_EntityMap[Record.SourceEntity];
+        if (Replica.CreateEntity(Desc, Mapping.Entity) == RADIENT_STATUS_OK)
+            ++m_LastFrameStats.NumCreated;
+        else
+            ++m_LastFrameStats.NumFailed;
+    }
+
+    // Detach entities that move to a different parent before attaching any of them,
+    // so that swapping a parent and a child within one frame does not form a transient cycle.
+    for (const EntityRecord& Record : m_Records)
+    {
+        if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_PARENT) == 0)
+            continue;
+
+        const RadientEntityID Entity = FindEntity(Record.SourceEntity);
+        if (Entity == InvalidRadientEntityID)
+            continue;
+
+        RadientEntityID CurrentParent = InvalidRadientEntityID;
+        Replica.GetParent(Entity, CurrentParent);
+        if (CurrentParent != InvalidRadientEntityID && CurrentParent != FindEntity(Record.Parent))
+            Replica.SetParent(Entity, InvalidRadientEntityID, False);
+    }
+
+    for (const EntityRecord& Record : m_Records)
+        ApplyEntityRecord(Replica, Record, IsKeyframe);
+
+    if ((FrameFlags & FRAME_FLAG_ENVIRONMENT) != 0)
+        ApplyEnvironment(Replica, Environment);
+
+    m_SourceRevisions = Revisions;
+    m_Synchronized    = true;
+    m_NextFrameIndex  = FrameIndex + 1;
+
+    return RADIENT_STATUS_OK;
+}
+
+RefCntAutoPtr<IRadientAsset> RadientSceneDeltaDecoder::ResolveAsset(const AssetRecord& Asset, RADIENT_ASSET_TYPE Type)
+{
+    if (Asset.URI.empty())
+        return {};
+
+    RefCntAutoPtr<IRadientAsset> pAsset;
+    if (m_ResolveAssetCallback != nullptr)
+    {
+        RadientAssetReference Ref;
+        Ref.URI     = Asset.URI.c_str();
+        Ref.Version = Asset.Version;
+        pAsset      = m_ResolveAssetCallback(Ref, Type, m_pResolveAssetUserData);
+    }
+
+    if (pAsset == nullptr || pAsset->GetType() != Type)
+    {
+        ++m_LastFrameStats.NumUnresolvedAssets;
+        return {};
+    }
+    return pAsset;
+}
+
+void RadientSceneDeltaDecoder::ApplyEntityRecord(RadientSceneState& Replica, const EntityRecord& Record, bool IsKeyframe)
+{
+    const auto MappingIt = m_EntityMap.find(Record.SourceEntity);
+    if (MappingIt == m_EntityMap.end())
+    {
+        // The record references an entity the decoder has never seen.
+        ++m_LastFrameStats.NumFailed;
+        return;
+    }
+
+    EntityMapping& Mapping = MappingIt->second;
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM) != 0)
+        Mapping.Transform = Record.QuantizedValues;
+
+    const RadientEntityID Entity = Mapping.Entity;
+    if (Entity == InvalidRadientEntityID)
+        return;
+
+    bool       Failed      = false;
+    const auto CheckStatus = [&Failed](RADIENT_STATUS Status) {
+        if (RADIENT_FAILED(Status))
+            Failed = true;
+    };
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_FLAGS) != 0)
+        CheckStatus(Replica.SetEntityFlags(Entity, Record.Flags));
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_PARENT) != 0)
+    {
+        const RadientEntityID Parent = FindEntity(Record.Parent);
+        if (Record.Parent != InvalidRadientEntityID && Parent == InvalidRadientEntityID)
+            Failed = true;
+        else
+            CheckStatus(Replica.SetParent(Entity, Parent, False));
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_TRANSFORM) != 0)
+        CheckStatus(Replica.SetLocalTransform(Entity, Record.Transform));
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CAMERA) != 0)
+    {
+        CheckStatus(Record.HasCamera ?
+                        Replica.SetCamera(Entity, Record.Camera) :
+                        Replica.RemoveComponent(Entity, RADIENT_COMPONENT_TYPE_CAMERA));
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH) != 0)
+    {
+        RefCntAutoPtr<IRadientMeshAsset> pMesh;
+        if (Record.HasMesh)
+            pMesh = RefCntAutoPtr<IRadientMeshAsset>{ResolveAsset(Record.Mesh, RADIENT_ASSET_TYPE_MESH), IID_RadientMeshAsset};
+
+        if (pMesh)
+        {
+            RadientMeshComponent Mesh;
+            Mesh.pMesh = pMesh;
+            CheckStatus(Replica.SetMesh(Entity, Mesh));
+        }
+        else
+        {
+            CheckStatus(Replica.RemoveComponent(Entity, RADIENT_COMPONENT_TYPE_MESH));
+        }
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MESH_RENDERER) != 0)
+    {
+        CheckStatus(Record.HasMeshRenderer ?
+                        Replica.SetMeshRenderer(Entity, Record.MeshRenderer) :
+                        Replica.RemoveComponent(Entity, RADIENT_COMPONENT_TYPE_MESH_RENDERER));
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS) != 0)
+    {
+        if (Record.HasMaterialBindings)
+        {
+            std::vector<RefCntAutoPtr<IRadientMaterialAsset>> Materials(Record.MaterialBindings.size());
+            std::vector<RadientMaterialBinding>               Bindings(Record.MaterialBindings.size());
+            for (size_t i = 0; i < Bindings.size(); ++i)
+            {
+                const MaterialBindingRecord& Binding = Record.MaterialBindings[i];
+                if (!Binding.Material.URI.empty())
+                    Materials[i] = RefCntAutoPtr<IRadientMaterialAsset>{ResolveAsset(Binding.Material, RADIENT_ASSET_TYPE_MATERIAL), IID_RadientMaterialAsset};
+
+                Bindings[i].PrimitiveIndex = Binding.PrimitiveIndex;
+                Bindings[i].pMaterial      = Materials[i];
+            }
+
+            RadientMaterialBindingsComponent Component;
+            Component.pBindings    = Bindings.data();
+            Component.BindingCount = static_cast<Uint32>(Bindings.size());
+            CheckStatus(Replica.SetMaterialBindings(Entity, Component));
+        }
+        else
+        {
+            CheckStatus(Replica.RemoveComponent(Entity, RADIENT_COMPONENT_TYPE_MATERIAL_BINDINGS));
+        }
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_LIGHT) != 0)
+    {
+        CheckStatus(Record.HasLight ?
+                        Replica.SetLight(Entity, Record.Light) :
+                        Replica.RemoveComponent(Entity, RADIENT_COMPONENT_TYPE_LIGHT));
+    }
+
+    if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS) != 0)
+    {
+        if (IsKeyframe)
+        {
+            // A keyframe lists all custom components of the entity; remove the ones it does not list.
+            const RadientComponentTypeID* pComponentTypes   = nullptr;
+            Uint32                        NumComponentTypes = 0;
+            Replica.GetCustomComponentTypes(Entity, pComponentTypes, NumComponentTypes);
+
+            std::vector<RadientComponentTypeID> StaleTypes;
+            for (Uint32 i = 0; i < NumComponentTypes; ++i)
+            {
+                const RadientComponentTypeID ComponentType = pComponentTypes[i];
+                if (std::none_of(Record.CustomComponents.begin(), Record.CustomComponents.end(),
+                                 [ComponentType](const CustomComponentRecord& Component) { return Component.ComponentType == ComponentType; }))
+                    StaleTypes.push_back(ComponentType);
+            }
+            for (RadientComponentTypeID ComponentType : StaleTypes)
+                CheckStatus(Replica.RemoveComponent(Entity, ComponentType));
+        }
+
+        for (const CustomComponentRecord& Component : Record.CustomComponents)
+        {
+            if (Component.Present)
+            {
+                RadientCustomComponentData Data;
+                Data.ComponentType = Component.ComponentType;
+                Data.Name          = Component.Name.c_str();
+                Data.Schema        = Component.Schema.c_str();
+                Data.Version       = Component.Version;
+                Data.pData         = Component.Data.data();
+                Data.DataSize      = static_cast<Uint32>(Component.Data.size());
+                CheckStatus(Replica.SetCustomComponentData(Entity, Data));
+            }
+            else
+            {
+                CheckStatus(Replica.RemoveComponent(Entity, Component.ComponentType));
+            }
+        }
+    }
+
+    if (Failed)
+        ++m_LastFrameStats.NumFailed;
+    else if ((Record.Mask & RadientSceneState::ENTITY_CHANGE_FLAG_CREATED) == 0)
+        ++m_LastFrameStats.NumUpdated;
+}
+
+void RadientSceneDeltaDecoder::ApplyEnvironment(RadientSceneState& Replica, const EnvironmentRecord& Environment)
+{
+    const RefCntAutoPtr<IRadientTextureAsset> pEnvironmentMap{ResolveAsset(Environment.EnvironmentMap, RADIENT_ASSET_TYPE_TEXTURE), IID_RadientTextureAsset};
+
+    RadientEnvironmentDesc Desc;
+    Desc.pEnvironmentMap = pEnvironmentMap;
+    Desc.Color           = Environment.Color;
+    Desc.Intensity       = Environment.Intensity;
+    Desc.Exposure        = Environment.Exposure;
+    if (RADIENT_FAILED(Replica.SetEnvironment(Desc)))
+        ++m_LastFrameStats.NumFailed;
+}
+
+} // namespace Diligent
@@ -30,7 +30,6 @@
 #include "Math/RadientMath.hpp"
 
 #include <algorithm>
-#include <limits>
 #include <utility>
 
 #ifdef DILIGENT_DEBUG
@@ -54,7 +53,7 @@ namespace Diligent
 namespace
 {
 
-constexpr size_t InitialEntityMapCapacity = 1024;
+constexpr size_t InitialEntitySlotCapacity = 1024;
 
 bool IsBuiltInComponentType(const RadientComponentTypeID ComponentType)
 {
@@ -138,7 +137,7 @@ RadientSceneState::RadientSceneState() :
     m_Desc{},
     m_CoreStorages{m_Registry}
 {
-    m_EntityMap.reserve(InitialEntityMapCapacity);
+    m_EntitySlots.reserve(InitialEntitySlotCapacity);
 }
 
 RadientSceneState::RadientSceneState(const RadientSceneDesc& Desc) :
@@ -147,7 +146,8 @@ RadientSceneState::RadientSceneState(const RadientSceneDesc& Desc) :
     m_CoreStorages{m_Registry}
 {
     m_Desc.Name = Desc.Name != nullptr ? m_Name.c_str() : nullptr;
-    m_EntityMap.reserve(InitialEntityMapCapacity);
+    m_EntitySlots.reserve(InitialEntitySlotCapacity);
+    SetFlatHierarchyEnabled(Desc.FlatHierarchy != False);
 }
 
 const RadientSceneDesc& RadientSceneState::GetDesc() const
@@ -377,7 +377,7 @@ RADIENT_STATUS RadientSceneState::HasComponent(RadientEntityID Entity, RadientCo
         {
             const CustomComponentStoresMapType::const_iterator It = m_CustomComponentStores.find(ComponentType);
 
-            HasComponent = It != m_CustomComponentStores.end() && It->second.contains(E) ? True : False;
+            HasComponent = It != m_CustomComponentStores.end() && It->second.Contains(E) ? True : False;
             break;
         }
     }
@@ -385,6 +385,118 @@ RADIENT_STATUS RadientSceneState::HasComponent(RadientEntityID Entity, RadientCo
     return RADIENT_STATUS_OK;
 }
 
+RADIENT_STATUS RadientSceneState::GetEntityName(RadientEntityID Entity, const Char*& Name) const
+{
+    Name = nullptr;
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Name = m_CoreStorages.get<EntityComponent>(E).Name.c_str();
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetMesh(RadientEntityID Entity, RadientMeshComponent& Mesh) const
+{
+    Mesh = {};
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    const MeshComponentStorage* pMesh = m_Registry.try_get<MeshComponentStorage>(E);
+    if (pMesh == nullptr)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Mesh = pMesh->Component;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetMeshRenderer(RadientEntityID Entity, RadientMeshRendererComponent& Renderer) const
+{
+    Renderer = {};
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    const RadientMeshRendererComponent* pRenderer = m_Registry.try_get<RadientMeshRendererComponent>(E);
+    if (pRenderer == nullptr)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Renderer = *pRenderer;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetMaterialBindings(RadientEntityID Entity, RadientMaterialBindingsComponent& Bindings) const
+{
+    Bindings = {};
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    const MaterialBindingsStorage* pBindings = m_Registry.try_get<MaterialBindingsStorage>(E);
+    if (pBindings == nullptr)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Bindings = pBindings->Component;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetLight(RadientEntityID Entity, RadientLightComponent& Light) const
+{
+    Light = {};
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    const RadientLightComponent* pLight = m_Registry.try_get<RadientLightComponent>(E);
+    if (pLight == nullptr)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Light = *pLight;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetCustomComponentData(RadientEntityID Entity, RadientComponentTypeID ComponentType, RadientCustomComponentData& Component) const
+{
+    Component = {};
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    if (ComponentType == InvalidRadientComponentTypeID || IsBuiltInComponentType(ComponentType))
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    const CustomComponentStoresMapType::const_iterator It = m_CustomComponentStores.find(ComponentType);
+    if (It == m_CustomComponentStores.end() || !It->second.Get(E, Component))
+        return RADIENT_STATUS_NOT_FOUND;
+
+    Component.ComponentType = ComponentType;
+    return RADIENT_STATUS_OK;
+}
+
+RADIENT_STATUS RadientSceneState::GetCustomComponentTypes(RadientEntityID Entity, const RadientComponentTypeID*& pComponentTypes, Uint32& NumComponentTypes) const
+{
+    pComponentTypes   = nullptr;
+    NumComponentTypes = 0;
+
+    const entt::entity E = FindEntity(Entity);
+    if (E == entt::null)
+        return RADIENT_STATUS_NOT_FOUND;
+
+    if (const CustomComponentIndexComponent* pIndex = m_Registry.try_get<CustomComponentIndexComponent>(E))
+    {
+        pComponentTypes   = pIndex->ComponentTypes.data();
+        NumComponentTypes = static_cast<Uint32>(pIndex->ComponentTypes.size());
+    }
+    return RADIENT_STATUS_OK;
+}
+
 const RadientSceneRevisions& RadientSceneState::GetSceneRevisions() const
 {
     return m_SceneRevisions;
@@ -410,13 +522,28 @@ RADIENT_STATUS RadientSceneState::CreateEntity(const RadientEntityDesc& Desc, Ra
             return RADIENT_STATUS_NOT_FOUND;
     }
 
-    if (m_NextEntityID == InvalidRadientEntityID ||
-        m_NextEntityID == std::numeric_limits<RadientEntityID>::max())
+    if (m_FreeEntitySlots.empty() && m_EntitySlots.size() >= RadientEntityHandle::MaxSlotCount)
         return RADIENT_STATUS_INVALID_OPERATION;
 
-    Entity                                = m_NextEntityID++;
+    Uint32 SlotIndex = 0;
+    if (!m_FreeEntitySlots.empty())
+    {
+        SlotIndex = m_FreeEntitySlots.back();
+        m_FreeEntitySlots.pop_back();
+    }
+    else
+    {
+        SlotIndex = static_cast<Uint32>(m_EntitySlots.size());
+        m_EntitySlots.emplace_back();
+    }
+
+    EntitySlot& Slot = m_EntitySlots[SlotIndex];
+    VERIFY(Slot.Entity == entt::null, "Free entity slot is in use");
+
+    Entity                                = RadientEntityHandle{SlotIndex, Slot.Generation}.ToID();
     const entt::entity     E              = m_Registry.create();
     const RadientTransform LocalTransform = RadientMath::NormalizeTransform(Desc.Transform);
+    Slot.Entity                           = E;
 
     m_Registry.emplace<EntityComponent>(E, EntityComponent{Entity, Desc.Name != nullptr ? Desc.Name : ""});
     m_Registry.emplace<EntityStateComponent>(E, EntityStateComponent{Desc.Flags});
@@ -427,16 +554,17 @@ RADIENT_STATUS RadientSceneState::CreateEntity(const RadientEntityDesc& Desc, Ra
     m_Registry.emplace<RenderableMeshStateComponent>(E);
     m_Registry.emplace<DirtyStateComponent>(E);
 
-    m_EntityMap.emplace(Entity, E);
-
     if (Parent != entt::null)
     {
         m_CoreStorages.get<HierarchyComponent>(E).Parent = Parent;
         m_CoreStorages.get<HierarchyComponent>(Parent).Children.push_back(E);
     }
+    InsertIntoFlatHierarchy(E);
 
     MarkDirty(E, DIRTY_FLAGS_REQUIRING_PROPAGATION);
     Touch(CHANGE_FLAG_TRANSFORMS | CHANGE_FLAG_VISIBILITY);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_CREATED | ENTITY_CHANGE_FLAG_FLAGS | ENTITY_CHANGE_FLAG_TRANSFORM |
+                              (Parent != entt::null ? ENTITY_CHANGE_FLAG_PARENT : ENTITY_CHANGE_FLAG_NONE));
     return RADIENT_STATUS_OK;
 }
 
@@ -474,6 +602,7 @@ RADIENT_STATUS RadientSceneState::SetEntityFlags(RadientEntityID Entity, RADIENT
     if (VisibilityChanged)
         MarkDirty(E, DIRTY_FLAG_VISIBILITY);
     Touch(VisibilityChanged ? CHANGE_FLAG_VISIBILITY : CHANGE_FLAG_NONE);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_FLAGS);
     return RADIENT_STATUS_OK;
 }
 
@@ -493,6 +622,7 @@ RADIENT_STATUS RadientSceneState::SetEntityOwnVisibility(RadientEntityID Entity,
     State.Flags = Flags;
     MarkDirty(E, DIRTY_FLAG_VISIBILITY);
     Touch(CHANGE_FLAG_VISIBILITY);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_FLAGS);
     return RADIENT_STATUS_OK;
 }
 
@@ -547,10 +677,13 @@ RADIENT_STATUS RadientSceneState::SetParent(RadientEntityID Entity, RadientEntit
                "Entity is already listed as a child of the new parent");
         Siblings.push_back(E);
     }
+    RemoveFromFlatHierarchy(E);
+    InsertIntoFlatHierarchy(E);
 
     m_CoreStorages.get<LocalTransformComponent>(E).Transform = LocalTransform;
     MarkDirty(E, DIRTY_FLAGS_REQUIRING_PROPAGATION);
     Touch(CHANGE_FLAG_TRANSFORMS | CHANGE_FLAG_VISIBILITY);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_PARENT | (KeepWorldTransform ? ENTITY_CHANGE_FLAG_TRANSFORM : ENTITY_CHANGE_FLAG_NONE));
     return RADIENT_STATUS_OK;
 }
 
@@ -568,6 +701,7 @@ RADIENT_STATUS RadientSceneState::SetLocalTransform(RadientEntityID Entity, cons
     LocalTransform.Transform = NormalizedTransform;
     MarkDirty(E, DIRTY_FLAG_TRANSFORM);
     Touch(CHANGE_FLAG_TRANSFORMS);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_TRANSFORM);
     return RADIENT_STATUS_OK;
 }
 
@@ -586,6 +720,7 @@ RADIENT_STATUS RadientSceneState::SetCamera(RadientEntityID Entity, const Radien
 
     m_Registry.emplace_or_replace<RadientCameraComponent>(E, Camera);
     Touch(CHANGE_FLAG_CAMERAS);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_CAMERA);
     return RADIENT_STATUS_OK;
 }
 
@@ -609,6 +744,7 @@ RADIENT_STATUS RadientSceneState::SetMesh(RadientEntityID Entity, const RadientM
     MeshStorage.Assign(Mesh);
     Touch(CHANGE_FLAG_DRAWABLES);
     UpdateRenderableMeshState(E);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_MESH);
     return RADIENT_STATUS_OK;
 }
 
@@ -625,6 +761,7 @@ RADIENT_STATUS RadientSceneState::SetMeshRenderer(RadientEntityID Entity, const
     m_Registry.emplace_or_replace<RadientMeshRendererComponent>(E, Renderer);
     Touch(CHANGE_FLAG_DRAWABLES);
     UpdateRenderableMeshState(E);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_MESH_RENDERER);
     return RADIENT_STATUS_OK;
 }
 
@@ -648,6 +785,7 @@ RADIENT_STATUS RadientSceneState::SetMaterialBindings(RadientEntityID Entity, co
     BindingStorage.Assign(Bindings);
     Touch(CHANGE_FLAG_DRAWABLES);
     RecordRenderableMeshUpdated(E);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS);
     return RADIENT_STATUS_OK;
 }
 
@@ -667,6 +805,7 @@ RADIENT_STATUS RadientSceneState::SetLight(RadientEntityID Entity, const Radient
     m_Registry.emplace_or_replace<RadientLightComponent>(E, Light);
     Touch(CHANGE_FLAG_LIGHTS);
     RecordRenderableLightChange(E, pExistingLight != nullptr ? RenderableLightChangeType::Updated : RenderableLightChangeType::Added);
+    RecordEntityChange(E, ENTITY_CHANGE_FLAG_LIGHT);
     return RADIENT_STATUS_OK;
 }
 
@@ -701,38 +840,25 @@ RADIENT_STATUS RadientSceneState::SetCustomComponentData(RadientEntityID Entity,
         return RADIENT_STATUS_INVALID_ARGUMENT;
     }
 
-    CustomComponentStorage CustomComponent;
-    CustomComponent.Name    = Component.Name != nullptr ? Component.Name : "";
-    CustomComponent.Schema  = Component.Schema != nullptr ? Component.Schema : "";
-    CustomComponent.Version = Component.Version;
-
-    if (Component.pData != nullptr && Component.DataSize != 0)
+    CustomComponentPool& Pool = m_CustomComponentStores[Component.ComponentType];
+    if (Pool.Set(E, Entity, Component))
     {
-        const Uint8* pData = static_cast<const Uint8*>(Component.pData);
-        CustomComponent.Data.assign(pData, pData + Component.DataSize);
+        CustomComponentIndexComponent& Index = m_Registry.get_or_emplace<CustomComponentIndexComponent>(E);
+        if (std::find(Index.ComponentTypes.begin(), Index.ComponentTypes.end(), Component.ComponentType) == Index.ComponentTypes.end())
+            Index.ComponentTypes.push_back(Component.ComponentType);
     }
-
-    CustomComponentStore& Store = m_CustomComponentStores[Component.ComponentType];
-    if (Store.contains(E))
-    {
 #ifdef DILIGENT_DEBUG
+    else
+    {
         const CustomComponentIndexComponent* pIndex = m_Registry.try_get<CustomComponentIndexComponent>(E);
         VERIFY(pIndex != nullptr &&
                    std::find(pIndex->ComponentTypes.begin(), pIndex->ComponentTypes.end(), Component.ComponentType) != pIndex->ComponentTypes.end(),
                "Custom component index is missing component type ", Component.ComponentType);
-#endif
-        Store.get(E) = std::move(CustomComponent);
-    }
-    else
-    {
-        Store.emplace(E, std::move(CustomComponent));
-
-        CustomComponentIndexComponent& Index = m_Registry.get_or_emplace<CustomComponentIndexComponent>(E);
-        if (std::find(Index.ComponentTypes.begin(), Index.ComponentTypes.end(), Component.ComponentType) == Index.ComponentTypes.end())
-            Index.ComponentTypes.push_back(Component.ComponentType);
     }
+#endif
 
     Touch(CHANGE_FLAG_CUSTOM_COMPONENTS);
+    RecordCustomComponentChange(E, Component.ComponentType);
     return RADIENT_STATUS_OK;
 }
 
@@ -795,12 +921,12 @@ RADIENT_STATUS RadientSceneState::RemoveComponent(RadientEntityID Entity, Radien
                         m_Registry.remove<CustomComponentIndexComponent>(E);
 
                     CustomComponentStoresMapType::iterator StoreIt = m_CustomComponentStores.find(ComponentType);
-                    VERIFY(StoreIt != m_CustomComponentStores.end() && StoreIt->second.contains(E),
+                    VERIFY(StoreIt != m_CustomComponentStores.end() && StoreIt->second.Contains(E),
                            "Custom component store is missing component type ", ComponentType, " listed in the entity index");
                     if (StoreIt != m_CustomComponentStores.end())
                     {
-                        StoreIt->second.remove(E);
-                        if (StoreIt->second.empty())
+                        StoreIt->second.Remove(E);
+                        if (StoreIt->second.IsEmpty())
                             m_CustomComponentStores.erase(StoreIt);
                     }
 
@@ -821,6 +947,18 @@ RADIENT_STATUS RadientSceneState::RemoveComponent(RadientEntityID Entity, Radien
             else
                 UpdateRenderableMeshState(E);
         }
+
+        switch (ComponentType)
+        {
+            // clang-format off
+            case RADIENT_COMPONENT_TYPE_CAMERA:            RecordEntityChange(E, ENTITY_CHANGE_FLAG_CAMERA);            break;
+            case RADIENT_COMPONENT_TYPE_MESH:              RecordEntityChange(E, ENTITY_CHANGE_FLAG_MESH);              break;
+            case RADIENT_COMPONENT_TYPE_MESH_RENDERER:     RecordEntityChange(E, ENTITY_CHANGE_FLAG_MESH_RENDERER);     break;
+            case RADIENT_COMPONENT_TYPE_MATERIAL_BINDINGS: RecordEntityChange(E, ENTITY_CHANGE_FLAG_MATERIAL_BINDINGS); break;
+            case RADIENT_COMPONENT_TYPE_LIGHT:             RecordEntityChange(E, ENTITY_CHANGE_FLAG_LIGHT);             break;
+            default:                                       RecordCustomComponentChange(E, ComponentType);               break;
+            // clang-format on
+        }
         return RADIENT_STATUS_OK;
     }
 
@@ -883,14 +1021,54 @@ void RadientSceneState::ClearRenderableChanges()
     ClearRenderableLightChanges();
 }
 
+void RadientSceneState::SetEntityChangeLogEnabled(bool Enabled)
+{
+    if (m_EntityChangeLogEnabled == Enabled)
+        return;
+
+    if (!Enabled)
+        ClearEntityChanges();
+    m_EntityChangeLogEnabled = Enabled;
+}
+
+void RadientSceneState::SetFlatHierarchyEnabled(bool Enabled)
+{
+    if (m_FlatHierarchyEnabled == Enabled)
+        return;
+
+    m_FlatHierarchyEnabled = Enabled;
+    InvalidateFlatHierarchy();
+    if (Enabled)
+    {
+        // An empty layout is trivially valid, so entities created from now on can be appended incrementally.
+        m_FlatHierarchyValid = m_Registry.storage<EntityComponent>().empty();
+    }
+    else
+    {
+        m_FlatHierarchy.shrink_to_fit();
+        m_TmpFlatDirtyFlags.clear();
+        m_TmpFlatDirtyFlags.shrink_to_fit();
+    }
+}
+
+void RadientSceneState::ClearEntityChanges()
+{
+    m_DestroyedEntityChanges.clear();
+    m_Registry.clear<PendingEntityChangeComponent>();
+}
+
 entt::entity RadientSceneState::FindEntity(RadientEntityID Entity) const
 {
-    const EntityMapType::const_iterator It = m_EntityMap.find(Entity);
-    if (It == m_EntityMap.end())
+    RadientEntityHandle Handle;
+    if (!RadientEntityHandle::FromID(Entity, Handle) || Handle.SlotIndex >= m_EntitySlots.size())
+        return entt::null;
+
+    const EntitySlot& Slot = m_EntitySlots[Handle.SlotIndex];
+    if (Slot.Generation != Handle.Generation || Slot.Entity == entt::null)
         return entt::null;
 
-    VERIFY_ENTITY(It->second);
-    return It->second;
+    VERIFY_ENTITY(Slot.Entity);
+    return Slot.Entity;
 }
 
 bool RadientSceneState::IsDescendant(entt::entity Entity, entt::entity PotentialAncestor) const
@@ -961,6 +1139,47 @@ RadientSceneState::CHANGE_FLAGS RadientSceneState::DestroyEntitySubtree(entt::en
 
     CHANGE_FLAGS ChangeFlags = CHANGE_FLAG_NONE;
 
+    if (m_FlatHierarchyValid)
+    {
+        // Post-order walk over the child and sibling links of the flat layout, which destroys descendants
+        // before their ancestors like the walk below. Subtrees that were appended as a whole are swept linearly.
+        const Uint32 Root = m_CoreStorages.get<HierarchyComponent>(Entity).FlatIndex;
+        VERIFY_EXPR(Root < m_FlatHierarchy.size() && m_FlatHierarchy[Root].Entity == Entity);
+
+        UnlinkFlatNode(Root);
+
+        Uint32 Index = Root;
+        while (m_FlatHierarchy[Index].FirstChild != InvalidFlatIndex)
+            Index = m_FlatHierarchy[Index].FirstChild;
+
+        while (true)
+        {
+            FlatHierarchyNode& Node = m_FlatHierarchy[Index];
+            VERIFY_ENTITY(Node.Entity);
+
+            DestroySingleEntity(Node.Entity, ChangeFlags);
+            Node.Entity = entt::null;
+            ++m_NumFlatHierarchyTombstones;
+
+            if (Index == Root)
+                break;
+
+            if (Node.NextSibling != InvalidFlatIndex)
+            {
+                Index = Node.NextSibling;
+                while (m_FlatHierarchy[Index].FirstChild != InvalidFlatIndex)
+                    Index = m_FlatHierarchy[Index].FirstChild;
+            }
+            else
+            {
+                Index = Node.Parent;
+            }
+        }
+        CompactFlatHierarchyIfSparse();
+
+        return ChangeFlags;
+    }
+
     std::vector<DestroyWorkItem>& Stack = m_TmpDestroyStack;
     Stack.clear();
     Stack.push_back({Entity, 0});
@@ -982,42 +1201,65 @@ RadientSceneState::CHANGE_FLAGS RadientSceneState::DestroyEntitySubtree(entt::en
         const entt::entity Current = Item.Entity;
         Stack.pop_back();
 
-        ChangeFlags |= CHANGE_FLAG_TRANSFORMS | CHANGE_FLAG_VISIBILITY;
+        DestroySingleEntity(Current, ChangeFlags);
+    }
 
-        const bool HadRenderableChange = RecordRenderableMeshRemoved(Current);
-        if ((ChangeFlags & CHANGE_FLAG_DRAWABLES) == CHANGE_FLAG_NONE &&
-            (HadRenderableChange ||
-             m_Registry.all_of<MeshComponentStorage>(Current) ||
-             m_Registry.all_of<RadientMeshRendererComponent>(Current) ||
-             m_Registry.all_of<MaterialBindingsStorage>(Current)))
-        {
-            ChangeFlags |= CHANGE_FLAG_DRAWABLES;
-        }
+    Stack.clear();
+    return ChangeFlags;
+}
 
-        if (RecordRenderableLightRemoved(Current))
-        {
-            ChangeFlags |= CHANGE_FLAG_LIGHTS;
-        }
+void RadientSceneState::DestroySingleEntity(entt::entity Entity, CHANGE_FLAGS& ChangeFlags)
+{
+    VERIFY_ENTITY(Entity);
 
-        if ((ChangeFlags & CHANGE_FLAG_CAMERAS) == CHANGE_FLAG_NONE &&
-            m_Registry.all_of<RadientCameraComponent>(Current))
-        {
-            ChangeFlags |= CHANGE_FLAG_CAMERAS;
-        }
+    ChangeFlags |= CHANGE_FLAG_TRANSFORMS | CHANGE_FLAG_VISIBILITY;
 
-        if (RemoveCustomComponents(Current))
-        {
-            ChangeFlags |= CHANGE_FLAG_CUSTOM_COMPONENTS;
-        }
+    const bool HadRenderableChange = RecordRenderableMeshRemoved(Entity);
+    if ((ChangeFlags & CHANGE_FLAG_DRAWABLES) == CHANGE_FLAG_NONE &&
+        (HadRenderableChange ||
+         m_Registry.all_of<MeshComponentStorage>(Entity) ||
+         m_Registry.all_of<RadientMeshRendererComponent>(Entity) ||
+         m_Registry.all_of<MaterialBindingsStorage>(Entity)))
+    {
+        ChangeFlags |= CHANGE_FLAG_DRAWABLES;
+    }
 
-        DirtyStateComponent& DirtyState = m_CoreStorages.get<DirtyStateComponent>(Current);
-        RemoveFromDirtyList(Current, DirtyState);
-        m_EntityMap.erase(m_CoreStorages.get<EntityComponent>(Current).ID);
-        m_Registry.destroy(Current);
+    if (RecordRenderableLightRemoved(Entity))
+    {
+        ChangeFlags |= CHANGE_FLAG_LIGHTS;
     }
 
-    Stack.clear();
-    return ChangeFlags;
+    if ((ChangeFlags & CHANGE_FLAG_CAMERAS) == CHANGE_FLAG_NONE &&
+        m_Registry.all_of<RadientCameraComponent>(Entity))
+    {
+        ChangeFlags |= CHANGE_FLAG_CAMERAS;
+    }
+
+    if (RemoveCustomComponents(Entity))
+    {
+        ChangeFlags |= CHANGE_FLAG_CUSTOM_COMPONENTS;
+    }
+
+    RecordEntityDestroyed(Entity);
+
+    DirtyStateComponent& DirtyState = m_CoreStorages.get<DirtyStateComponent>(Entity);
+    RemoveFromDirtyList(Entity, DirtyState);
+    RadientEntityHandle Handle;
+    const bool          IsValidHandle = RadientEntityHandle::FromID(m_CoreStorages.get<EntityComponent>(Entity).ID, Handle);
+    VERIFY(IsValidHandle && Handle.SlotIndex < m_EntitySlots.size(), "Entity ID is not a valid handle");
+    (void)IsValidHandle;
+
+    EntitySlot& Slot = m_EntitySlots[Handle.SlotIndex];
+    VERIFY(Slot.Entity == Entity && Slot.Generation == Handle.Generation, "Entity slot does not reference the entity");
+    Slot.Entity = entt::null;
+    // A slot whose generation is exhausted is retired rather than reused, so its handles can never alias.
+    if (Slot.Generation < RadientEntityHandle::MaxGeneration)
+    {
+        ++Slot.Generation;
+        m_FreeEntitySlots.push_back(Handle.SlotIndex);
+    }
+
+    m_Registry.destroy(Entity);
 }
 
 bool RadientSceneState::RemoveCustomComponents(entt::entity Entity)
@@ -1033,8 +1275,8 @@ bool RadientSceneState::RemoveCustomComponents(entt::entity Entity)
         CustomComponentStoresMapType::iterator It = m_CustomComponentStores.find(ComponentType);
         if (It != m_CustomComponentStores.end())
         {
-            It->second.remove(Entity);
-            if (It->second.empty())
+            It->second.Remove(Entity);
+            if (It->second.IsEmpty())
                 m_CustomComponentStores.erase(It);
         }
     }
@@ -1043,6 +1285,42 @@ bool RadientSceneState::RemoveCustomComponents(entt::entity Entity)
     return true;
 }
 
+void RadientSceneState::RecordEntityChange(entt::entity Entity, ENTITY_CHANGE_FLAGS Flags)
+{
+    VERIFY_ENTITY(Entity);
+
+    if (!m_EntityChangeLogEnabled || Flags == ENTITY_CHANGE_FLAG_NONE)
+        return;
+
+    m_Registry.get_or_emplace<PendingEntityChangeComponent>(Entity).Flags |= Flags;
+}
+
+void RadientSceneState::RecordCustomComponentChange(entt::entity Entity, RadientComponentTypeID ComponentType)
+{
+    VERIFY_ENTITY(Entity);
+
+    if (!m_EntityChangeLogEnabled)
+        return;
+
+    PendingEntityChangeComponent& Pending = m_Registry.get_or_emplace<PendingEntityChangeComponent>(Entity);
+    Pending.Flags |= ENTITY_CHANGE_FLAG_CUSTOM_COMPONENTS;
+    if (std::find(Pending.CustomComponentTypes.begin(), Pending.CustomComponentTypes.end(), ComponentType) == Pending.CustomComponentTypes.end())
+        Pending.CustomComponentTypes.push_back(ComponentType);
+}
+
+void RadientSceneState::RecordEntityDestroyed(entt::entity Entity)
+{
+    VERIFY_ENTITY(Entity);
+
+    if (!m_EntityChangeLogEnabled)
+        return;
+
+    // An entity created since the last clear was never reported, so its destruction is not reported either.
+    const PendingEntityChangeComponent* pPending = m_Registry.try_get<PendingEntityChangeComponent>(Entity);
+    if (pPending == nullptr || (pPending->Flags & ENTITY_CHANGE_FLAG_CREATED) == 0)
+        m_DestroyedEntityChanges.push_back(m_CoreStorages.get<EntityComponent>(Entity).ID);
+}
+
 void RadientSceneState::RecordRenderableMeshChange(entt::entity Entity, RenderableMeshChangeType Type)
 {
     VERIFY_ENTITY(Entity);
@@ -1315,6 +1593,9 @@ void RadientSceneState::UpdateDirtyEntities()
         return;
     }
 
+    if (m_FlatHierarchyEnabled && !m_FlatHierarchyValid)
+        RebuildFlatHierarchy();
+
     // Commit updates dirty derived state in three phases:
     // 1. Propagate directly tracked dirty flags down affected subtrees without adding descendants to
     //    m_DirtyEntities. Propagation stops when a subtree already has the requested flags.
@@ -1396,6 +1677,12 @@ void RadientSceneState::UpdateDirtyEntities()
 // before updating it.
 void RadientSceneState::UpdateDirtySubtree(entt::entity Entity, DIRTY_FLAGS InheritedFlags)
 {
+    if (m_FlatHierarchyValid)
+    {
+        UpdateDirtySubtreeFlat(Entity, InheritedFlags);
+        return;
+    }
+
     InheritedFlags &= DIRTY_FLAGS_REQUIRING_PROPAGATION;
 
     VERIFY_ENTITY(Entity);
@@ -1447,6 +1734,80 @@ void RadientSceneState::UpdateDirtySubtree(entt::entity Entity, DIRTY_FLAGS Inhe
     Stack.clear();
 }
 
+// Same as UpdateDirtySubtree, but walks the child and sibling links of the flat layout in depth-first order
+// instead of the child lists, so every parent is updated before its children and subtrees that were appended
+// as a whole are swept linearly. The effective dirty flags of the ancestors of the visited node are kept on
+// the m_TmpFlatDirtyFlags stack; clean subtrees are skipped whole.
+void RadientSceneState::UpdateDirtySubtreeFlat(entt::entity Entity, DIRTY_FLAGS InheritedFlags)
+{
+    InheritedFlags &= DIRTY_FLAGS_REQUIRING_PROPAGATION;
+
+    VERIFY_ENTITY(Entity);
+
+    const Uint32 Root = m_CoreStorages.get<HierarchyComponent>(Entity).FlatIndex;
+    VERIFY_EXPR(Root < m_FlatHierarchy.size() && m_FlatHierarchy[Root].Entity == Entity);
+
+    std::vector<DIRTY_FLAGS>& AncestorFlags = m_TmpFlatDirtyFlags;
+    AncestorFlags.clear();
+
+    Uint32 Index = Root;
+    while (true)
+    {
+        const FlatHierarchyNode& Node = m_FlatHierarchy[Index];
+        VERIFY_ENTITY(Node.Entity);
+
+        entt::entity Parent      = entt::null;
+        DIRTY_FLAGS  ParentFlags = InheritedFlags;
+        if (Index != Root)
+        {
+            VERIFY_EXPR(Node.Parent < m_FlatHierarchy.size() && !AncestorFlags.empty());
+            Parent      = m_FlatHierarchy[Node.Parent].Entity;
+            ParentFlags = AncestorFlags.back();
+        }
+        else
+        {
+            Parent = m_CoreStorages.get<HierarchyComponent>(Node.Entity).Parent;
+        }
+
+        DirtyStateComponent& DirtyState = m_CoreStorages.get<DirtyStateComponent>(Node.Entity);
+        const DIRTY_FLAGS    Flags      = (DirtyState.Flags | ParentFlags) & DIRTY_FLAGS_REQUIRING_PROPAGATION;
+        if (Flags != DIRTY_FLAG_NONE)
+        {
+            const RadientMatrix4x4* pParentWorldMatrix = nullptr;
+            Bool                    ParentVisible      = True;
+            if (Parent != entt::null)
+            {
+                VERIFY_ENTITY(Parent);
+
+                pParentWorldMatrix = &m_CoreStorages.get<WorldTransformComponent>(Parent).Matrix;
+                ParentVisible      = m_CoreStorages.get<EffectiveVisibilityComponent>(Parent).Visible;
+            }
+
+            UpdateEntityDerivedState(Node.Entity, DirtyState, Flags, pParentWorldMatrix, ParentVisible);
+
+            if (Node.FirstChild != InvalidFlatIndex)
+            {
+                AncestorFlags.push_back(Flags);
+                Index = Node.FirstChild;
+                continue;
+            }
+        }
+
+        // Skip the subtree of the node: climb until an ancestor within the swept subtree has a next sibling.
+        while (Index != Root && m_FlatHierarchy[Index].NextSibling == InvalidFlatIndex)
+        {
+            Index = m_FlatHierarchy[Index].Parent;
+            AncestorFlags.pop_back();
+        }
+        if (Index == Root)
+            break;
+
+        Index = m_FlatHierarchy[Index].NextSibling;
+    }
+
+    VERIFY_EXPR(AncestorFlags.empty());
+}
+
 void RadientSceneState::UpdateDerivedStatePathToRoot(entt::entity Entity, DIRTY_FLAGS Flags)
 {
     Flags &= DIRTY_FLAGS_REQUIRING_PROPAGATION;
@@ -1568,6 +1929,170 @@ void RadientSceneState::UpdateEntityDerivedState(entt::entity            Entity,
         RemoveFromDirtyList(Entity, DirtyState);
 }
 
+// Adds the subtree of the entity, which is not in the flat layout, as the last child of its parent. Only the
+// nodes of the subtree are appended to the end of the array; the rest of the layout is not moved.
+void RadientSceneState::InsertIntoFlatHierarchy(entt::entity Entity)
+{
+    if (!m_FlatHierarchyValid)
+        return;
+
+    VERIFY_ENTITY(Entity);
+
+    Uint32 ParentIndex = InvalidFlatIndex;
+    if (const entt::entity Parent = m_CoreStorages.get<HierarchyComponent>(Entity).Parent; Parent != entt::null)
+    {
+        ParentIndex = m_CoreStorages.get<HierarchyComponent>(Parent).FlatIndex;
+        VERIFY_EXPR(ParentIndex < m_FlatHierarchy.size() && m_FlatHierarchy[ParentIndex].Entity == Parent);
+    }
+
+    const Uint32 Index = static_cast<Uint32>(m_FlatHierarchy.size());
+    AppendFlatSubtree(Entity);
+    LinkFlatNode(Index, ParentIndex);
+
+    CompactFlatHierarchyIfSparse();
+}
+
+// Unlinks the subtree of the entity from the flat layout. Its nodes become tombstones.
+void RadientSceneState::RemoveFromFlatHierarchy(entt::entity Entity)
+{
+    if (!m_FlatHierarchyValid)
+        return;
+
+    const Uint32 Index = m_CoreStorages.get<HierarchyComponent>(Entity).FlatIndex;
+    VERIFY_EXPR(Index < m_FlatHierarchy.size() && m_FlatHierarchy[Index].Entity == Entity);
+
+    UnlinkFlatNode(Index);
+    m_FlatHierarchy[Index].Entity = entt::null;
+    m_NumFlatHierarchyTombstones += m_FlatHierarchy[Index].SubtreeSize;
+}
+
+// Appends the subtree of the entity in depth-first order as an unlinked root and returns the number of appended nodes.
+Uint32 RadientSceneState::AppendFlatSubtree(entt::entity Entity)
+{
+    const Uint32 Begin = static_cast<Uint32>(m_FlatHierarchy.size());
+
+    std::vector<DestroyWorkItem>& Stack = m_TmpDestroyStack;
+    VERIFY_EXPR(Stack.empty());
+
+    m_CoreStorages.get<HierarchyComponent>(Entity).FlatIndex = Begin;
+    m_FlatHierarchy.push_back({Entity});
+    Stack.push_back({Entity, 0});
+
+    while (!Stack.empty())
+    {
+        DestroyWorkItem&    Item      = Stack.back();
+        HierarchyComponent& Hierarchy = m_CoreStorages.get<HierarchyComponent>(Item.Entity);
+        if (Item.NextChildIndex < Hierarchy.Children.size())
+        {
+            const entt::entity Child = Hierarchy.Children[Item.NextChildIndex++];
+            VERIFY_ENTITY(Child);
+
+            // Children are appended in order, so the new node is the last child of its parent.
+            const Uint32 ChildIndex  = static_cast<Uint32>(m_FlatHierarchy.size());
+            const Uint32 PrevSibling = m_FlatHierarchy[Hierarchy.FlatIndex].LastChild;
+            m_FlatHierarchy.push_back({Child, Hierarchy.FlatIndex, InvalidFlatIndex, InvalidFlatIndex, PrevSibling});
+
+            if (PrevSibling != InvalidFlatIndex)
+                m_FlatHierarchy[PrevSibling].NextSibling = ChildIndex;
+            else
+                m_FlatHierarchy[Hierarchy.FlatIndex].FirstChild = ChildIndex;
+            m_FlatHierarchy[Hierarchy.FlatIndex].LastChild = ChildIndex;
+
+            m_CoreStorages.get<HierarchyComponent>(Child).FlatIndex = ChildIndex;
+            Stack.push_back({Child, 0});
+            continue;
+        }
+
+        m_FlatHierarchy[Hierarchy.FlatIndex].SubtreeSize = static_cast<Uint32>(m_FlatHierarchy.size() - Hierarchy.FlatIndex);
+        Stack.pop_back();
+    }
+
+    return static_cast<Uint32>(m_FlatHierarchy.size()) - Begin;
+}
+
+// Links the unlinked subtree at the given index as the last child of the parent node and adds its size
+// to the subtree sizes of the ancestors. Roots are not linked to each other.
+void RadientSceneState::LinkFlatNode(Uint32 Index, Uint32 ParentIndex)
+{
+    FlatHierarchyNode& Node = m_FlatHierarchy[Index];
+    VERIFY_EXPR(Node.Parent == InvalidFlatIndex && Node.PrevSibling == InvalidFlatIndex && Node.NextSibling == InvalidFlatIndex);
+    if (ParentIndex == InvalidFlatIndex)
+        return;
+
+    FlatHierarchyNode& ParentNode = m_FlatHierarchy[ParentIndex];
+
+    Node.Parent      = ParentIndex;
+    Node.PrevSibling = ParentNode.LastChild;
+    if (ParentNode.LastChild != InvalidFlatIndex)
+        m_FlatHierarchy[ParentNode.LastChild].NextSibling = Index;
+    else
+        ParentNode.FirstChild = Index;
+    ParentNode.LastChild = Index;
+
+    for (Uint32 Ancestor = ParentIndex; Ancestor != InvalidFlatIndex; Ancestor = m_FlatHierarchy[Ancestor].Parent)
+        m_FlatHierarchy[Ancestor].SubtreeSize += Node.SubtreeSize;
+}
+
+// Unlinks the subtree at the given index from its parent and siblings and subtracts its size from the subtree
+// sizes of the ancestors. The links within the subtree are kept.
+void RadientSceneState::UnlinkFlatNode(Uint32 Index)
+{
+    FlatHierarchyNode& Node = m_FlatHierarchy[Index];
+    if (Node.Parent == InvalidFlatIndex)
+        return;
+
+    FlatHierarchyNode& ParentNode = m_FlatHierarchy[Node.Parent];
+    if (Node.PrevSibling != InvalidFlatIndex)
+        m_FlatHierarchy[Node.PrevSibling].NextSibling = Node.NextSibling;
+    else
+        ParentNode.FirstChild = Node.NextSibling;
+    if (Node.NextSibling != InvalidFlatIndex)
+        m_FlatHierarchy[Node.NextSibling].PrevSibling = Node.PrevSibling;
+    else
+        ParentNode.LastChild = Node.PrevSibling;
+
+    for (Uint32 Ancestor = Node.Parent; Ancestor != InvalidFlatIndex; Ancestor = m_FlatHierarchy[Ancestor].Parent)
+        m_FlatHierarchy[Ancestor].SubtreeSize -= Node.SubtreeSize;
+
+    Node.Parent      = InvalidFlatIndex;
+    Node.PrevSibling = InvalidFlatIndex;
+    Node.NextSibling = InvalidFlatIndex;
+}
+
+// Compaction rebuilds the layout, so it is deferred to the next commit and only happens
+// once tombstones make up half of the layout.
+void RadientSceneState::CompactFlatHierarchyIfSparse()
+{
+    if (m_FlatHierarchyValid && size_t{m_NumFlatHierarchyTombstones} * 2 > m_FlatHierarchy.size())
+        InvalidateFlatHierarchy();
+}
+
+void RadientSceneState::InvalidateFlatHierarchy()
+{
+    m_FlatHierarchyValid         = false;
+    m_NumFlatHierarchyTombstones = 0;
+    m_FlatHierarchy.clear();
+}
+
+void RadientSceneState::RebuildFlatHierarchy()
+{
+    VERIFY_EXPR(m_FlatHierarchyEnabled);
+
+    m_FlatHierarchy.clear();
+    m_NumFlatHierarchyTombstones = 0;
+
+    m_FlatHierarchy.reserve(m_Registry.storage<EntityComponent>().size());
+
+    for (const entt::entity Root : m_Registry.view<const HierarchyComponent>())
+    {
+        if (m_CoreStorages.get<HierarchyComponent>(Root).Parent == entt::null)
+            AppendFlatSubtree(Root);
+    }
+
+    m_FlatHierarchyValid = true;
+    ++m_FlatHierarchyRebuildCount;
+}
+
 void RadientSceneState::Touch(CHANGE_FLAGS ChangeFlags)
 {
     if ((ChangeFlags & CHANGE_FLAG_DRAWABLES) != CHANGE_FLAG_NONE)
@@ -26,8 +26,11 @@
 
 #include "Scene/RadientSceneWriterImpl.hpp"
 
+#include "Scene/RadientSceneCommandQueue.hpp"
+#include "Scene/RadientSceneCommandRecorderImpl.hpp"
 #include "Scene/RadientSceneImpl.hpp"
 #include "Scene/RadientSceneState.hpp"
+#include "DebugUtilities.hpp"
 
 #include <utility>
 
@@ -36,7 +39,8 @@ namespace Diligent
 
 RadientSceneWriterImpl::RadientSceneWriterImpl(IReferenceCounters* pRefCounters, std::shared_ptr<RadientSceneState> pState) :
     TBase{pRefCounters},
-    m_pState{std::move(pState)}
+    m_pState{std::move(pState)},
+    m_pCommandQueue{std::make_shared<RadientSceneCommandQueue>()}
 {}
 
 RadientSceneWriterImpl::~RadientSceneWriterImpl()
@@ -119,9 +123,34 @@ RADIENT_STATUS RadientSceneWriterImpl::RemoveComponent(RadientEntityID Entity, R
     return m_pState ? m_pState->RemoveComponent(Entity, ComponentType) : RADIENT_STATUS_INVALID_ARGUMENT;
 }
 
+RADIENT_STATUS RadientSceneWriterImpl::CreateCommandRecorder(Uint32 ProducerID, IRadientSceneCommandRecorder** ppRecorder)
+{
+    if (ppRecorder == nullptr)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    DEV_CHECK_ERR(*ppRecorder == nullptr, "Output command recorder pointer must be null. Overwriting a non-null output pointer may result in memory leaks.");
+    *ppRecorder = nullptr;
+    if (!m_pState)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    RefCntAutoPtr<IRadientSceneCommandRecorder> pRecorder = RadientSceneCommandRecorderImpl::Create(m_pCommandQueue, ProducerID);
+    if (!pRecorder)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    *ppRecorder = pRecorder.Detach();
+    return RADIENT_STATUS_OK;
+}
+
 RADIENT_STATUS RadientSceneWriterImpl::CommitChanges()
 {
-    return m_pState ? m_pState->CommitChanges() : RADIENT_STATUS_INVALID_ARGUMENT;
+    if (!m_pState)
+        return RADIENT_STATUS_INVALID_ARGUMENT;
+
+    // Recorded commands are applied even if some of them fail, and the scene is committed regardless;
+    // the first replay failure is reported to the caller.
+    const RADIENT_STATUS ReplayStatus = m_pCommandQueue->Replay(*m_pState);
+    const RADIENT_STATUS CommitStatus = m_pState->CommitChanges();
+    return RADIENT_FAILED(ReplayStatus) ? ReplayStatus : CommitStatus;
 }
 
 } // namespace Diligent
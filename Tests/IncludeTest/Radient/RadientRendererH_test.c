@@ -45,19 +45,26 @@ void RadientRenderTarget_C_TestMacros(IRadientRenderTarget* pTarget)
 
 void RadientRenderer_C_TestMacros(IRadientRenderer* pRenderer)
 {
-    const RadientRendererDesc* pDesc         = IRadientRenderer_GetDesc(pRenderer);
-    RadientRenderTargetDesc    TargetDesc    = {0};
-    RadientViewDesc            ViewDesc      = {0};
-    RadientRenderAttribs       RenderAttribs = {0};
-    IRadientRenderTarget*      pTarget       = 0;
-    IRadientView*              pView         = 0;
-    RADIENT_STATUS             Status        = RADIENT_STATUS_OK;
+    const RadientRendererDesc*   pDesc         = IRadientRenderer_GetDesc(pRenderer);
+    RadientRenderTargetDesc      TargetDesc    = {0};
+    RadientViewDesc              ViewDesc      = {0};
+    RadientRenderAttribs         RenderAttribs = {0};
+    RadientRenderViewsAttribs    ViewsAttribs  = {0};
+    const RadientRendererStats*  pStats        = IRadientRenderer_GetStats(pRenderer);
+    Uint32                       NumPasses     = 0;
+    const RadientFramePassStats* pPassStats    = IRadientRenderer_GetFramePassStats(pRenderer, &NumPasses);
+    IRadientRenderTarget*        pTarget       = 0;
+    IRadientView*                pView         = 0;
+    RADIENT_STATUS               Status        = RADIENT_STATUS_OK;
 
     Status = IRadientRenderer_CreateRenderTarget(pRenderer, &TargetDesc, &pTarget);
     Status = IRadientRenderer_CreateView(pRenderer, &ViewDesc, &pView);
     Status = IRadientRenderer_Render(pRenderer, &RenderAttribs);
+    Status = IRadientRenderer_RenderViews(pRenderer, &ViewsAttribs);
 
     (void)pDesc;
+    (void)pStats;
+    (void)pPassStats;
     (void)pTarget;
     (void)pView;
     (void)Status;
@@ -26,8 +26,44 @@
 
 #include "Radient/interface/RadientSceneWriter.h"
 
+void RadientSceneCommandRecorder_C_TestMacros(IRadientSceneCommandRecorder* pRecorder)
+{
+    RadientEntityID                  Entity           = 0;
+    RadientEntityDesc                EntityDesc       = {0};
+    RADIENT_ENTITY_FLAGS             EntityFlags      = 0;
+    RadientTransform                 Transform        = {0};
+    RadientCameraComponent           Camera           = {0};
+    RadientMeshComponent             Mesh             = {0};
+    RadientMeshRendererComponent     MeshRenderer     = {0};
+    RadientMaterialBindingsComponent MaterialBindings = {0};
+    RadientLightComponent            Light            = {0};
+    RadientCustomComponentData       CustomComponent  = {0};
+    RADIENT_STATUS                   Status           = RADIENT_STATUS_OK;
+    Uint32                           ProducerID       = 0;
+
+    ProducerID = IRadientSceneCommandRecorder_GetProducerID(pRecorder);
+    Status     = IRadientSceneCommandRecorder_CreateEntity(pRecorder, &EntityDesc, &Entity);
+    Status     = IRadientSceneCommandRecorder_DestroyEntity(pRecorder, Entity);
+    Status     = IRadientSceneCommandRecorder_SetEntityFlags(pRecorder, Entity, EntityFlags);
+    Status     = IRadientSceneCommandRecorder_SetEntityOwnVisibility(pRecorder, Entity, True);
+    Status     = IRadientSceneCommandRecorder_SetParent(pRecorder, Entity, InvalidRadientEntityID, True);
+    Status     = IRadientSceneCommandRecorder_SetLocalTransform(pRecorder, Entity, &Transform);
+    Status     = IRadientSceneCommandRecorder_SetCamera(pRecorder, Entity, &Camera);
+    Status     = IRadientSceneCommandRecorder_SetMesh(pRecorder, Entity, &Mesh);
+    Status     = IRadientSceneCommandRecorder_SetMeshRenderer(pRecorder, Entity, &MeshRenderer);
+    Status     = IRadientSceneCommandRecorder_SetMaterialBindings(pRecorder, Entity, &MaterialBindings);
+    Status     = IRadientSceneCommandRecorder_SetLight(pRecorder, Entity, &Light);
+    Status     = IRadientSceneCommandRecorder_SetCustomComponentData(pRecorder, Entity, &CustomComponent);
+    Status     = IRadientSceneCommandRecorder_RemoveComponent(pRecorder, Entity, CustomComponent.ComponentType);
+    Status     = IRadientSceneCommandRecorder_ResolveEntity(pRecorder, Entity, &Entity);
+
+    (void)Status;
+    (void)ProducerID;
+}
+
 void RadientSceneWriter_C_TestMacros(IRadientSceneWriter* pWriter)
 {
+    IRadientSceneCommandRecorder*    pRecorder        = NULL;
     RadientEntityID                  Entity           = 0;
     RadientEntityDesc                EntityDesc       = {0};
     RADIENT_ENTITY_FLAGS             EntityFlags      = 0;
@@ -53,6 +89,7 @@ void RadientSceneWriter_C_TestMacros(IRadientSceneWriter* pWriter)
     Status = IRadientSceneWriter_SetLight(pWriter, Entity, &Light);
     Status = IRadientSceneWriter_SetCustomComponentData(pWriter, Entity, &CustomComponent);
     Status = IRadientSceneWriter_RemoveComponent(pWriter, Entity, CustomComponent.ComponentType);
+    Status = IRadientSceneWriter_CreateCommandRecorder(pWriter, 0, &pRecorder);
     Status = IRadientSceneWriter_CommitChanges(pWriter);
 
     (void)Status;
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TempDirectory.hpp"
+#include "gtest/gtest.h"
+
+#include "PBR_IBLCache.hpp"
+#include "FileWrapper.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+PBR_IBLCache::CubemapData CreateCubemapData(TEXTURE_FORMAT Format, Uint32 TexelSize, Uint32 Dimension, Uint32 MipLevels, Uint8 Seed)
+{
+    PBR_IBLCache::CubemapData Cubemap;
+    Cubemap.Format    = Format;
+    Cubemap.TexelSize = TexelSize;
+    Cubemap.Dimension = Dimension;
+    Cubemap.MipLevels = MipLevels;
+    Cubemap.Data.resize(Cubemap.GetRequiredDataSize());
+    for (size_t i = 0; i < Cubemap.Data.size(); ++i)
+        Cubemap.Data[i] = static_cast<Uint8>(i * 31 + Seed);
+    return Cubemap;
+}
+
+PBR_IBLCache::Entry CreateEntry(Uint8 Seed)
+{
+    PBR_IBLCache::Entry Entry;
+    for (Uint32 k = 0; k < PBR_IrradianceSH::NumCoeffs; ++k)
+        Entry.IrradianceSH.Coeffs[k] = float3{static_cast<float>(k), static_cast<float>(Seed), -static_cast<float>(k) * 0.5f};
+    Entry.IrradianceCube    = CreateCubemapData(TEX_FORMAT_RGBA32_FLOAT, 16, 8, 1, Seed);
+    Entry.PrefilteredEnvMap = CreateCubemapData(TEX_FORMAT_RGBA16_FLOAT, 8, 16, 5, Seed + 1);
+    return Entry;
+}
+
+bool operator==(const PBR_IBLCache::CubemapData& Lhs, const PBR_IBLCache::CubemapData& Rhs)
+{
+    return Lhs.Format == Rhs.Format &&
+        Lhs.TexelSize == Rhs.TexelSize &&
+        Lhs.Dimension == Rhs.Dimension &&
+        Lhs.MipLevels == Rhs.MipLevels &&
+        Lhs.Data == Rhs.Data;
+}
+
+bool operator==(const PBR_IBLCache::Entry& Lhs, const PBR_IBLCache::Entry& Rhs)
+{
+    for (Uint32 k = 0; k < PBR_IrradianceSH::NumCoeffs; ++k)
+    {
+        if (Lhs.IrradianceSH.Coeffs[k] != Rhs.IrradianceSH.Coeffs[k])
+            return false;
+    }
+    return Lhs.IrradianceCube == Rhs.IrradianceCube && Lhs.PrefilteredEnvMap == Rhs.PrefilteredEnvMap;
+}
+
+TEST(PBR_IBLCacheTest, CubemapLayout)
+{
+    const PBR_IBLCache::CubemapData Cubemap = CreateCubemapData(TEX_FORMAT_RGBA16_FLOAT, 8, 16, 5, 0);
+
+    // 16x16 + 8x8 + 4x4 + 2x2 + 1x1 texels per face
+    constexpr size_t FaceSize = (256 + 64 + 16 + 4 + 1) * 8;
+    EXPECT_EQ(Cubemap.GetRequiredDataSize(), FaceSize * 6);
+    EXPECT_EQ(Cubemap.GetSubresourceOffset(0, 1), size_t{256 * 8});
+    EXPECT_EQ(Cubemap.GetSubresourceOffset(2, 0), FaceSize * 2);
+    EXPECT_EQ(Cubemap.GetSubresourceOffset(2, 3), FaceSize * 2 + (256 + 64 + 16) * 8);
+    EXPECT_EQ(Cubemap.GetMipDimension(7), 1u);
+    EXPECT_TRUE(Cubemap.IsValid());
+
+    PBR_IBLCache::CubemapData Truncated = Cubemap;
+    Truncated.Data.pop_back();
+    EXPECT_FALSE(Truncated.IsValid());
+}
+
+TEST(PBR_IBLCacheTest, ContentKey)
+{
+    std::vector<Uint8> Data(1027);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i);
+
+    const Uint64 Key = PBR_IBLCache::ComputeContentKey(Data.data(), Data.size());
+    EXPECT_NE(Key, Uint64{0});
+    EXPECT_EQ(Key, PBR_IBLCache::ComputeContentKey(Data.data(), Data.size()));
+    EXPECT_NE(PBR_IBLCache::ComputeContentKey(nullptr, 0), Uint64{0});
+
+    // Changes in the aligned words and in the tail must both change the key
+    for (size_t Idx : {size_t{0}, size_t{517}, Data.size() - 1})
+    {
+        std::vector<Uint8> Modified = Data;
+        Modified[Idx] ^= 1;
+        EXPECT_NE(Key, PBR_IBLCache::ComputeContentKey(Modified.data(), Modified.size())) << "Idx = " << Idx;
+    }
+    EXPECT_NE(Key, PBR_IBLCache::ComputeContentKey(Data.data(), Data.size() - 1));
+}
+
+TEST(PBR_IBLCacheTest, Serialization)
+{
+    constexpr Uint64          Key   = 0x0123456789ABCDEFull;
+    const PBR_IBLCache::Entry Entry = CreateEntry(7);
+
+    std::vector<Uint8> Data;
+    PBR_IBLCache::Serialize(Key, Entry, Data);
+
+    PBR_IBLCache::Entry Loaded;
+    ASSERT_TRUE(PBR_IBLCache::Deserialize(Key, Data.data(), Data.size(), Loaded));
+    EXPECT_TRUE(Loaded == Entry);
+
+    // Different key
+    EXPECT_FALSE(PBR_IBLCache::Deserialize(Key + 1, Data.data(), Data.size(), Loaded));
+
+    // Truncated and extended data
+    EXPECT_FALSE(PBR_IBLCache::Deserialize(Key, Data.data(), Data.size() - 1, Loaded));
+    {
+        std::vector<Uint8> Extended = Data;
+        Extended.push_back(0);
+        EXPECT_FALSE(PBR_IBLCache::Deserialize(Key, Extended.data(), Extended.size(), Loaded));
+    }
+
+    // Corrupted header
+    {
+        std::vector<Uint8> Corrupted = Data;
+        Corrupted[0] ^= 0xFF;
+        EXPECT_FALSE(PBR_IBLCache::Deserialize(Key, Corrupted.data(), Corrupted.size(), Loaded));
+    }
+
+    EXPECT_FALSE(PBR_IBLCache::Deserialize(Key, nullptr, 0, Loaded));
+}
+
+TEST(PBR_IBLCacheTest, MemoryCache)
+{
+    PBR_IBLCache Cache;
+
+    EXPECT_EQ(Cache.Find(1), nullptr);
+
+    const PBR_IBLCache::Entry& Added = Cache.Add(1, CreateEntry(1));
+    EXPECT_TRUE(Added == CreateEntry(1));
+
+    const PBR_IBLCache::Entry* pFound = Cache.Find(1);
+    ASSERT_NE(pFound, nullptr);
+    EXPECT_EQ(pFound, &Added);
+    EXPECT_EQ(Cache.Find(2), nullptr);
+
+    // Replace the entry
+    Cache.Add(1, CreateEntry(2));
+    pFound = Cache.Find(1);
+    ASSERT_NE(pFound, nullptr);
+    EXPECT_TRUE(*pFound == CreateEntry(2));
+
+    const PBR_IBLCache::Statistics& Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.MemoryHits, 2u);
+    EXPECT_EQ(Stats.DiskHits, 0u);
+    EXPECT_EQ(Stats.Misses, 2u);
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.Find(1), nullptr);
+}
+
+TEST(PBR_IBLCacheTest, DiskMirror)
+{
+    TempDirectory TempDir{"PBR_IBLCacheTest"};
+
+    {
+        PBR_IBLCache Cache{TempDir.Get().c_str()};
+        Cache.Add(10, CreateEntry(10));
+        Cache.Add(20, CreateEntry(20));
+    }
+
+    PBR_IBLCache Cache{TempDir.Get().c_str()};
+
+    const PBR_IBLCache::Entry* pEntry = Cache.Find(10);
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_TRUE(*pEntry == CreateEntry(10));
+
+    // The second lookup is served from memory
+    EXPECT_EQ(Cache.Find(10), pEntry);
+    EXPECT_EQ(Cache.Find(30), nullptr);
+
+    const PBR_IBLCache::Statistics& Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.MemoryHits, 1u);
+    EXPECT_EQ(Stats.DiskHits, 1u);
+    EXPECT_EQ(Stats.Misses, 1u);
+
+    // Truncated mirror files are ignored
+    {
+        std::vector<Uint8> Data;
+        PBR_IBLCache::Serialize(20, CreateEntry(20), Data);
+        Data.resize(Data.size() / 2);
+
+        const std::string Path = TempDir.Get() + "/0000000000000014.ibl";
+        FileWrapper       File{Path.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        ASSERT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+    EXPECT_EQ(Cache.Find(20), nullptr);
+    EXPECT_EQ(Cache.GetStatistics().Misses, 2u);
+}
+
+} // namespace
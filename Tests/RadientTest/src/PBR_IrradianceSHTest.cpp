@@ -0,0 +1,291 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+#include "PBR_IrradianceSH.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using RadianceFunctionType = std::function<float3(const float3& Dir)>;
+
+// Face directions follow the Direct3D cube map convention
+float3 GetCubemapDirection(Uint32 Face, float u, float v)
+{
+    switch (Face)
+    {
+        // clang-format off
+        case 0:  return normalize(float3{ 1.f,  -v,  -u});
+        case 1:  return normalize(float3{-1.f,  -v,   u});
+        case 2:  return normalize(float3{   u, 1.f,   v});
+        case 3:  return normalize(float3{   u,-1.f,  -v});
+        case 4:  return normalize(float3{   u,  -v, 1.f});
+        default: return normalize(float3{  -u,  -v,-1.f});
+        // clang-format on
+    }
+}
+
+std::vector<float> CreateCubemapFace(Uint32 Face, Uint32 Size, const RadianceFunctionType& Radiance)
+{
+    std::vector<float> Texels(size_t{Size} * Size * 4);
+    for (Uint32 y = 0; y < Size; ++y)
+    {
+        for (Uint32 x = 0; x < Size; ++x)
+        {
+            const float  u     = (static_cast<float>(x) + 0.5f) / static_cast<float>(Size) * 2.f - 1.f;
+            const float  v     = (static_cast<float>(y) + 0.5f) / static_cast<float>(Size) * 2.f - 1.f;
+            const float3 Color = Radiance(GetCubemapDirection(Face, u, v));
+            float*       pDst  = &Texels[(size_t{y} * Size + x) * 4];
+            pDst[0]            = Color.x;
+            pDst[1]            = Color.y;
+            pDst[2]            = Color.z;
+            pDst[3]            = 1.f;
+        }
+    }
+    return Texels;
+}
+
+PBR_IrradianceSH ProjectCubemap(Uint32 Size, const RadianceFunctionType& Radiance)
+{
+    std::vector<float>            FaceData[6];
+    PBR_IrradianceSH::SourceImage Faces[6];
+    for (Uint32 Face = 0; Face < 6; ++Face)
+    {
+        FaceData[Face]      = CreateCubemapFace(Face, Size, Radiance);
+        Faces[Face].pData   = FaceData[Face].data();
+        Faces[Face].Width   = Size;
+        Faces[Face].Height  = Size;
+    }
+
+    PBR_IrradianceSH SH;
+    EXPECT_TRUE(PBR_IrradianceSH::ProjectCubemap(Faces, SH));
+    return SH;
+}
+
+PBR_IrradianceSH ProjectSphereMap(Uint32 Width, Uint32 Height, const RadianceFunctionType& Radiance)
+{
+    std::vector<float> Texels(size_t{Width} * Height * 3);
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        const float Latitude = ((static_cast<float>(y) + 0.5f) / static_cast<float>(Height) - 0.5f) * PI_F;
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float  Phi   = ((static_cast<float>(x) + 0.5f) / static_cast<float>(Width) - 0.5f) * 2.f * PI_F;
+            const float3 Dir   = {std::cos(Latitude) * std::cos(Phi), std::sin(Latitude), std::cos(Latitude) * std::sin(Phi)};
+            const float3 Color = Radiance(Dir);
+            float*       pDst  = &Texels[(size_t{y} * Width + x) * 3];
+            pDst[0]            = Color.x;
+            pDst[1]            = Color.y;
+            pDst[2]            = Color.z;
+        }
+    }
+
+    PBR_IrradianceSH::SourceImage Image;
+    Image.pData         = Texels.data();
+    Image.Width         = Width;
+    Image.Height        = Height;
+    Image.NumComponents = 3;
+
+    PBR_IrradianceSH SH;
+    EXPECT_TRUE(PBR_IrradianceSH::ProjectSphereMap(Image, SH));
+    return SH;
+}
+
+// Test normals that are not aligned with the cube map faces
+std::vector<float3> GetTestNormals()
+{
+    std::vector<float3> Normals;
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        // Fibonacci sphere
+        const float z   = 1.f - (static_cast<float>(i) + 0.5f) / 32.f;
+        const float r   = std::sqrt(std::max(1.f - z * z, 0.f));
+        const float Phi = static_cast<float>(i) * 2.39996323f;
+        Normals.emplace_back(r * std::cos(Phi), r * std::sin(Phi), z);
+    }
+    return Normals;
+}
+
+void CheckIrradiance(const PBR_IrradianceSH& SH, const RadianceFunctionType& ExpectedIrradiance, float Tolerance)
+{
+    for (const float3& N : GetTestNormals())
+    {
+        const float3 Irradiance = SH.Evaluate(N);
+        const float3 Expected   = ExpectedIrradiance(N);
+        EXPECT_NEAR(Irradiance.x, Expected.x, Tolerance) << "N = (" << N.x << ", " << N.y << ", " << N.z << ")";
+        EXPECT_NEAR(Irradiance.y, Expected.y, Tolerance) << "N = (" << N.x << ", " << N.y << ", " << N.z << ")";
+        EXPECT_NEAR(Irradiance.z, Expected.z, Tolerance) << "N = (" << N.x << ", " << N.y << ", " << N.z << ")";
+    }
+}
+
+// The environments below are exactly represented by L2 spherical harmonics, so the irradiance
+// divided by PI is known analytically: the bands are scaled by 1, 2/3, and 1/4.
+
+TEST(PBR_IrradianceSHTest, ConstantEnvironment)
+{
+    const RadianceFunctionType Radiance = [](const float3&) {
+        return float3{0.25f, 0.5f, 2.f};
+    };
+    CheckIrradiance(ProjectCubemap(32, Radiance), Radiance, 1e-3f);
+    CheckIrradiance(ProjectSphereMap(128, 64, Radiance), Radiance, 1e-3f);
+}
+
+TEST(PBR_IrradianceSHTest, LinearEnvironment)
+{
+    const float3 D = normalize(float3{1.f, 2.f, -0.5f});
+
+    // L(w) = 1 + 0.75 * dot(w, D)  =>  E(N) / PI = 1 + 2/3 * 0.75 * dot(N, D)
+    const RadianceFunctionType Radiance = [&](const float3& Dir) {
+        const float L = 1.f + 0.75f * dot(Dir, D);
+        return float3{L, 2.f * L, 0.5f * L};
+    };
+    const RadianceFunctionType Irradiance = [&](const float3& N) {
+        const float E = 1.f + 0.5f * dot(N, D);
+        return float3{E, 2.f * E, 0.5f * E};
+    };
+    CheckIrradiance(ProjectCubemap(32, Radiance), Irradiance, 2e-3f);
+    CheckIrradiance(ProjectSphereMap(128, 64, Radiance), Irradiance, 2e-3f);
+}
+
+TEST(PBR_IrradianceSHTest, QuadraticEnvironment)
+{
+    // L(w) = w.z^2 = 1/3 + 1/3 * (3 w.z^2 - 1)  =>  E(N) / PI = 1/3 + 1/12 * (3 N.z^2 - 1)
+    const RadianceFunctionType Radiance = [](const float3& Dir) {
+        return float3{Dir.z * Dir.z, Dir.z * Dir.z, Dir.z * Dir.z};
+    };
+    const RadianceFunctionType Irradiance = [](const float3& N) {
+        const float E = 1.f / 3.f + (3.f * N.z * N.z - 1.f) / 12.f;
+        return float3{E, E, E};
+    };
+    CheckIrradiance(ProjectCubemap(32, Radiance), Irradiance, 2e-3f);
+    CheckIrradiance(ProjectSphereMap(128, 64, Radiance), Irradiance, 2e-3f);
+}
+
+// A bright spot that is not exactly represented by L2 harmonics: compare the projection with the
+// brute-force convolution. The L2 approximation of irradiance is known to be within a few percent.
+TEST(PBR_IrradianceSHTest, SunEnvironment)
+{
+    const float3 SunDir = normalize(float3{0.3f, 0.8f, 0.5f});
+
+    const RadianceFunctionType Radiance = [&](const float3& Dir) {
+        const float L = 0.2f + (dot(Dir, SunDir) > 0.95f ? 20.f : 0.f);
+        return float3{L, L, L};
+    };
+
+    constexpr Uint32       Size = 64;
+    const PBR_IrradianceSH SH   = ProjectCubemap(Size, Radiance);
+
+    // Brute-force irradiance divided by PI for the same cube map texels
+    const RadianceFunctionType Irradiance = [&](const float3& N) {
+        double E           = 0;
+        double TotalWeight = 0;
+        for (Uint32 Face = 0; Face < 6; ++Face)
+        {
+            for (Uint32 y = 0; y < Size; ++y)
+            {
+                for (Uint32 x = 0; x < Size; ++x)
+                {
+                    const float u = (static_cast<float>(x) + 0.5f) / Size * 2.f - 1.f;
+                    const float v = (static_cast<float>(y) + 0.5f) / Size * 2.f - 1.f;
+                    const float W = 1.f / std::pow(1.f + u * u + v * v, 1.5f);
+
+                    const float3 Dir = GetCubemapDirection(Face, u, v);
+                    E += W * Radiance(Dir).x * std::max(dot(Dir, N), 0.f);
+                    TotalWeight += W;
+                }
+            }
+        }
+        const float Value = static_cast<float>(E * 4.0 / TotalWeight);
+        return float3{Value, Value, Value};
+    };
+
+    // Maximum irradiance is about 0.2 + 20 * (1 - 0.95) * 2 = 2.2
+    CheckIrradiance(SH, Irradiance, 0.1f);
+}
+
+TEST(PBR_IrradianceSHTest, HalfFloatFaces)
+{
+    // 0.5, 1.0, 2.0, 1.0 in half precision
+    const Uint16 Texel[] = {0x3800, 0x3C00, 0x4000, 0x3C00};
+
+    constexpr Uint32    Size = 8;
+    std::vector<Uint16> FaceData(size_t{Size} * Size * 4);
+    for (size_t i = 0; i < FaceData.size(); ++i)
+        FaceData[i] = Texel[i % 4];
+
+    PBR_IrradianceSH::SourceImage Faces[6];
+    for (PBR_IrradianceSH::SourceImage& Face : Faces)
+    {
+        Face.pData     = FaceData.data();
+        Face.Width     = Size;
+        Face.Height    = Size;
+        Face.ValueType = VT_FLOAT16;
+    }
+
+    PBR_IrradianceSH SH;
+    ASSERT_TRUE(PBR_IrradianceSH::ProjectCubemap(Faces, SH));
+    CheckIrradiance(
+        SH, [](const float3&) { return float3{0.5f, 1.f, 2.f}; }, 1e-3f);
+}
+
+TEST(PBR_IrradianceSHTest, InvalidFaces)
+{
+    std::vector<float> FaceData(16 * 16 * 4);
+
+    PBR_IrradianceSH::SourceImage Faces[6];
+    for (PBR_IrradianceSH::SourceImage& Face : Faces)
+    {
+        Face.pData  = FaceData.data();
+        Face.Width  = 16;
+        Face.Height = 16;
+    }
+    Faces[3].Width = 8;
+
+    PBR_IrradianceSH SH;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Cube map face 3 is invalid"};
+        EXPECT_FALSE(PBR_IrradianceSH::ProjectCubemap(Faces, SH));
+    }
+
+    Faces[3].Width         = 16;
+    Faces[3].NumComponents = 2;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Cube map face 3 is invalid"};
+        EXPECT_FALSE(PBR_IrradianceSH::ProjectCubemap(Faces, SH));
+    }
+}
+
+} // namespace
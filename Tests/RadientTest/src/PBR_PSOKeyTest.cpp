@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "PBR_Renderer.hpp"
+#include "Utilities/interface/ReadMostlyHashMap.hpp"
+#include "HashUtils.hpp"
+#include "Errors.hpp"
+
+#include <chrono>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+using PSOKey = PBR_Renderer::PSOKey;
+
+TEST(PBR_PSOKeyTest, Comparison)
+{
+    const PSOKey Key{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK};
+    EXPECT_TRUE(Key == PSOKey(PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK));
+    EXPECT_TRUE(Key == PSOKey(PBR_Renderer::PSO_FLAG_DEFAULT, Key));
+    EXPECT_EQ(PSOKey::Hasher{}(Key), PSOKey::Hasher{}(PSOKey(PBR_Renderer::PSO_FLAG_DEFAULT, Key)));
+
+    // Keys that differ in any single attribute must not be equal
+    const PSOKey OtherKeys[] = {
+        PSOKey{PBR_Renderer::RenderPassType::OITLayers, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT | PBR_Renderer::PSO_FLAG_USE_AO_MAP, ALPHA_MODE_BLEND, CULL_MODE_BACK},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_MASK, CULL_MODE_BACK},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_NONE},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK, PBR_Renderer::DebugViewType::Texcoord0},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None, PBR_Renderer::LoadingAnimationMode::Always},
+        PSOKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None, PBR_Renderer::LoadingAnimationMode::None, 1},
+    };
+    for (const PSOKey& OtherKey : OtherKeys)
+    {
+        EXPECT_FALSE(Key == OtherKey);
+        EXPECT_FALSE(OtherKey == Key);
+    }
+
+    // Static texture ids only participate in the comparison when they are present
+    PBR_Renderer::StaticShaderTextureIdsArrayType Ids0{};
+    PBR_Renderer::StaticShaderTextureIdsArrayType Ids1{};
+    Ids1[0] = 1;
+
+    const PSOKey KeyIds0{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None, PBR_Renderer::LoadingAnimationMode::None, 0, &Ids0};
+    const PSOKey KeyIds1{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None, PBR_Renderer::LoadingAnimationMode::None, 0, &Ids1};
+    const PSOKey KeyNoIds{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_DEFAULT, CULL_MODE_BACK};
+    EXPECT_FALSE(KeyIds0 == KeyIds1);
+    EXPECT_FALSE(KeyIds0 == KeyNoIds);
+    EXPECT_TRUE(KeyIds1 == PSOKey(PBR_Renderer::PSO_FLAG_DEFAULT, KeyIds1));
+}
+
+TEST(PBR_PSOKeyTest, Normalization)
+{
+    // Flags and attributes that are not used by the shadow pass are dropped, so that
+    // all such keys map to the same pipeline.
+    const PSOKey ShadowKey0{PBR_Renderer::RenderPassType::Shadow, PBR_Renderer::PSO_FLAG_DEFAULT, ALPHA_MODE_BLEND, CULL_MODE_BACK, PBR_Renderer::DebugViewType::Texcoord0};
+    const PSOKey ShadowKey1{PBR_Renderer::RenderPassType::Shadow, PBR_Renderer::PSO_FLAG_DEFAULT | PBR_Renderer::PSO_FLAG_USE_AO_MAP, ALPHA_MODE_BLEND, CULL_MODE_BACK};
+    EXPECT_TRUE(ShadowKey0 == ShadowKey1);
+    EXPECT_EQ(PSOKey::Hasher{}(ShadowKey0), PSOKey::Hasher{}(ShadowKey1));
+    EXPECT_EQ(ShadowKey0.GetDebugView(), PBR_Renderer::DebugViewType::None);
+
+    // Normalization is idempotent
+    EXPECT_TRUE(ShadowKey0 == PSOKey(ShadowKey0.GetFlags(), ShadowKey0));
+}
+
+// Key with the field-wise layout that PSOKey used before its attributes were packed
+// into two words. Used as the reference in the lookup benchmark.
+class LegacyPSOKey
+{
+public:
+    explicit LegacyPSOKey(const PSOKey& Key) noexcept :
+        Flags{Key.GetFlags()},
+        Type{Key.GetType()},
+        AlphaMode{Key.GetAlphaMode()},
+        CullMode{Key.GetCullMode()},
+        DebugView{Key.GetDebugView()},
+        LoadingAnimation{Key.GetLoadingAnimation()},
+        UserValue{Key.GetUserValue()},
+        Hash{ComputeHash(Type, Flags, AlphaMode, CullMode, static_cast<Uint32>(DebugView), static_cast<Uint32>(LoadingAnimation), UserValue, HasStaticShaderTextureIds)}
+    {}
+
+    bool operator==(const LegacyPSOKey& rhs) const noexcept
+    {
+        // clang-format off
+        return Hash                      == rhs.Hash      &&
+               Type                      == rhs.Type      &&
+               Flags                     == rhs.Flags     &&
+               CullMode                  == rhs.CullMode  &&
+               AlphaMode                 == rhs.AlphaMode &&
+               DebugView                 == rhs.DebugView &&
+               LoadingAnimation          == rhs.LoadingAnimation &&
+               UserValue                 == rhs.UserValue &&
+               HasStaticShaderTextureIds == rhs.HasStaticShaderTextureIds;
+        // clang-format on
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const LegacyPSOKey& Key) const noexcept
+        {
+            return Key.Hash;
+        }
+    };
+
+private:
+    PBR_Renderer::PSO_FLAGS            Flags;
+    PBR_Renderer::RenderPassType       Type;
+    PBR_Renderer::ALPHA_MODE           AlphaMode;
+    CULL_MODE                          CullMode;
+    PBR_Renderer::DebugViewType        DebugView;
+    PBR_Renderer::LoadingAnimationMode LoadingAnimation;
+    bool                               HasStaticShaderTextureIds = false;
+    Uint64                             UserValue;
+    size_t                             Hash;
+};
+
+constexpr Uint32 BenchmarkKeyCount    = 2048;
+constexpr Uint32 BenchmarkLookupCount = 1 << 20;
+
+std::vector<PSOKey> CreateBenchmarkKeys()
+{
+    std::vector<PSOKey> Keys;
+    Keys.reserve(BenchmarkKeyCount);
+    for (Uint32 i = 0; i < BenchmarkKeyCount; ++i)
+    {
+        Keys.emplace_back(
+            PBR_Renderer::RenderPassType::Main,
+            static_cast<PBR_Renderer::PSO_FLAGS>(PBR_Renderer::PSO_FLAG_DEFAULT | (Uint64{i % 64} << 20)),
+            (i / 64) % 3 == 0 ? ALPHA_MODE_BLEND : ALPHA_MODE_OPAQUE,
+            (i / 192) % 2 == 0 ? CULL_MODE_BACK : CULL_MODE_NONE,
+            PBR_Renderer::DebugViewType::None,
+            PBR_Renderer::LoadingAnimationMode::None,
+            Uint64{i});
+    }
+    return Keys;
+}
+
+// Performs the benchmark lookups, where FindKey(Idx) returns the value found for key Idx,
+// and returns the average time of one lookup in nanoseconds. Wrong results are counted in NumMisses.
+template <typename FindKeyType>
+double TimeLookups(FindKeyType&& FindKey, Uint32& NumMisses)
+{
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+
+    Uint32 Idx = 0;
+    for (Uint32 i = 0; i < BenchmarkLookupCount; ++i)
+    {
+        Idx = (Idx + 7919) % BenchmarkKeyCount;
+
+        const Uint32* pValue = FindKey(Idx, (i & 1) != 0);
+        if (pValue == nullptr || *pValue != Idx)
+            ++NumMisses;
+    }
+
+    const auto EndTime = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>{EndTime - StartTime}.count() / BenchmarkLookupCount;
+}
+
+// Resolves 1M pipelines the way the renderer does it for every drawable: every other lookup
+// re-creates the key from the flags, the same way PBR_Renderer::GetPSO does. Reports the average
+// cost of one lookup with the packed key and with the field-wise key it replaced.
+// The timings are informational: only the lookup results are checked.
+TEST(PBR_PSOKeyTest, Lookup1M)
+{
+    const std::vector<PSOKey> Keys = CreateBenchmarkKeys();
+
+    ReadMostlyHashMap<PSOKey, Uint32, PSOKey::Hasher>             Map;
+    ReadMostlyHashMap<LegacyPSOKey, Uint32, LegacyPSOKey::Hasher> LegacyMap;
+
+    std::vector<LegacyPSOKey> LegacyKeys;
+    LegacyKeys.reserve(BenchmarkKeyCount);
+    for (Uint32 i = 0; i < BenchmarkKeyCount; ++i)
+    {
+        Map.Insert(Keys[i], i);
+        LegacyKeys.emplace_back(Keys[i]);
+        LegacyMap.Insert(LegacyKeys[i], i);
+    }
+    EXPECT_EQ(Map.Size(), size_t{BenchmarkKeyCount});
+    EXPECT_EQ(LegacyMap.Size(), size_t{BenchmarkKeyCount});
+
+    Uint32 NumMisses = 0;
+
+    const double PackedTime = TimeLookups(
+        [&](Uint32 Idx, bool Rebuild) {
+            return Rebuild ?
+                Map.Find(PSOKey{Keys[Idx].GetFlags(), Keys[Idx]}) :
+                Map.Find(Keys[Idx]);
+        },
+        NumMisses);
+
+    const double LegacyTime = TimeLookups(
+        [&](Uint32 Idx, bool Rebuild) {
+            return Rebuild ?
+                LegacyMap.Find(LegacyPSOKey{PSOKey{Keys[Idx].GetFlags(), Keys[Idx]}}) :
+                LegacyMap.Find(LegacyKeys[Idx]);
+        },
+        NumMisses);
+
+    EXPECT_EQ(NumMisses, 0u);
+
+    LOG_INFO_MESSAGE("PSO key lookup: ", PackedTime, " ns packed, ", LegacyTime, " ns field-wise");
+}
+
+} // namespace
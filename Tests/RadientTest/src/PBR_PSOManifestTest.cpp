@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TempDirectory.hpp"
+#include "gtest/gtest.h"
+
+#include "PBR_PSOManifest.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using PSOKey = PBR_Renderer::PSOKey;
+
+GraphicsPipelineDesc MakeGraphicsDesc(TEXTURE_FORMAT RTVFormat)
+{
+    GraphicsPipelineDesc Desc;
+    Desc.NumRenderTargets                     = 1;
+    Desc.RTVFormats[0]                        = RTVFormat;
+    Desc.DSVFormat                            = TEX_FORMAT_D32_FLOAT;
+    Desc.PrimitiveTopology                    = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    Desc.DepthStencilDesc.DepthFunc           = COMPARISON_FUNC_GREATER_EQUAL;
+    Desc.RasterizerDesc.DepthBias             = -4;
+    Desc.RasterizerDesc.SlopeScaledDepthBias  = -1.5f;
+    Desc.RasterizerDesc.FrontCounterClockwise = True;
+    return Desc;
+}
+
+struct TestEntry
+{
+    GraphicsPipelineDesc GraphicsDesc;
+    PSOKey               Key;
+};
+
+std::vector<TestEntry> MakeTestEntries()
+{
+    PBR_Renderer::StaticShaderTextureIdsArrayType TextureIds;
+    TextureIds.fill(PBR_Renderer::InvalidMaterialTextureId);
+    TextureIds[PBR_Renderer::TEXTURE_ATTRIB_ID_BASE_COLOR] = 3;
+    TextureIds[PBR_Renderer::TEXTURE_ATTRIB_ID_NORMAL]     = 7;
+
+    const GraphicsPipelineDesc ColorDesc  = MakeGraphicsDesc(TEX_FORMAT_RGBA8_UNORM_SRGB);
+    const GraphicsPipelineDesc HDRDesc    = MakeGraphicsDesc(TEX_FORMAT_RGBA16_FLOAT);
+    GraphicsPipelineDesc       ShadowDesc = MakeGraphicsDesc(TEX_FORMAT_UNKNOWN);
+    ShadowDesc.NumRenderTargets           = 0;
+
+    const PBR_Renderer::PSO_FLAGS Flags = PBR_Renderer::PSO_FLAG_DEFAULT | PBR_Renderer::PSO_FLAG_ENABLE_SHADOWS;
+
+    return {
+        {ColorDesc, PSOKey{PBR_Renderer::RenderPassType::Main, Flags, ALPHA_MODE_OPAQUE, CULL_MODE_BACK}},
+        {ColorDesc, PSOKey{PBR_Renderer::RenderPassType::Main, Flags, ALPHA_MODE_MASK, CULL_MODE_NONE}},
+        {ColorDesc, PSOKey{PBR_Renderer::RenderPassType::Main, Flags, ALPHA_MODE_BLEND, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None,
+                           PBR_Renderer::LoadingAnimationMode::None, 42}},
+        {HDRDesc, PSOKey{PBR_Renderer::RenderPassType::Main, Flags, ALPHA_MODE_OPAQUE, CULL_MODE_BACK, PBR_Renderer::DebugViewType::None,
+                         PBR_Renderer::LoadingAnimationMode::Always, 0, &TextureIds}},
+        {ShadowDesc, PSOKey{PBR_Renderer::RenderPassType::Shadow, PBR_Renderer::PSO_FLAG_NONE, CULL_MODE_FRONT}},
+    };
+}
+
+void ExpectSameEntries(const PBR_PSOManifest& Manifest0, const PBR_PSOManifest& Manifest1)
+{
+    ASSERT_EQ(Manifest0.GetEntryCount(), Manifest1.GetEntryCount());
+    for (size_t i = 0; i < Manifest0.GetEntryCount(); ++i)
+    {
+        EXPECT_EQ(Manifest0.GetEntries()[i].GraphicsDesc, Manifest1.GetEntries()[i].GraphicsDesc) << "Entry " << i;
+        EXPECT_EQ(Manifest0.GetEntries()[i].Key, Manifest1.GetEntries()[i].Key) << "Entry " << i;
+    }
+}
+
+} // namespace
+
+TEST(PBR_PSOManifestTest, AddDeduplicatesPermutations)
+{
+    const std::vector<TestEntry> Entries = MakeTestEntries();
+
+    PBR_PSOManifest Manifest;
+    for (const TestEntry& Entry : Entries)
+        EXPECT_TRUE(Manifest.Add(Entry.GraphicsDesc, Entry.Key));
+    EXPECT_EQ(Manifest.GetEntryCount(), Entries.size());
+
+    for (const TestEntry& Entry : Entries)
+        EXPECT_FALSE(Manifest.Add(Entry.GraphicsDesc, Entry.Key));
+    EXPECT_EQ(Manifest.GetEntryCount(), Entries.size());
+
+    // A permutation that only differs in the graphics description is a different entry
+    GraphicsPipelineDesc GraphicsDesc              = Entries[0].GraphicsDesc;
+    GraphicsDesc.DepthStencilDesc.DepthWriteEnable = False;
+    EXPECT_TRUE(Manifest.Add(GraphicsDesc, Entries[0].Key));
+    EXPECT_EQ(Manifest.GetEntryCount(), Entries.size() + 1);
+
+    Manifest.Clear();
+    EXPECT_EQ(Manifest.GetEntryCount(), size_t{0});
+}
+
+TEST(PBR_PSOManifestTest, OrderDoesNotDependOnRequestOrder)
+{
+    std::vector<TestEntry> Entries = MakeTestEntries();
+
+    PBR_PSOManifest Manifest0;
+    for (const TestEntry& Entry : Entries)
+        Manifest0.Add(Entry.GraphicsDesc, Entry.Key);
+
+    std::reverse(Entries.begin(), Entries.end());
+    std::rotate(Entries.begin(), Entries.begin() + 2, Entries.end());
+    PBR_PSOManifest Manifest1;
+    for (const TestEntry& Entry : Entries)
+        Manifest1.Add(Entry.GraphicsDesc, Entry.Key);
+
+    ExpectSameEntries(Manifest0, Manifest1);
+
+    std::vector<Uint8> Data0;
+    std::vector<Uint8> Data1;
+    Manifest0.Serialize(Data0);
+    Manifest1.Serialize(Data1);
+    EXPECT_EQ(Data0, Data1);
+}
+
+TEST(PBR_PSOManifestTest, SerializationRoundTrip)
+{
+    PBR_PSOManifest Manifest;
+    for (const TestEntry& Entry : MakeTestEntries())
+        Manifest.Add(Entry.GraphicsDesc, Entry.Key);
+
+    std::vector<Uint8> Data;
+    Manifest.Serialize(Data);
+
+    PBR_PSOManifest Loaded;
+    ASSERT_TRUE(Loaded.Deserialize(Data.data(), Data.size()));
+    ExpectSameEntries(Manifest, Loaded);
+
+    std::vector<Uint8> LoadedData;
+    Loaded.Serialize(LoadedData);
+    EXPECT_EQ(Data, LoadedData);
+
+    // Loading the same manifest again does not add duplicates
+    ASSERT_TRUE(Loaded.Deserialize(Data.data(), Data.size()));
+    EXPECT_EQ(Loaded.GetEntryCount(), Manifest.GetEntryCount());
+
+    PBR_PSOManifest Empty;
+    Empty.Serialize(Data);
+    ASSERT_TRUE(Loaded.Deserialize(Data.data(), Data.size()));
+    EXPECT_EQ(Loaded.GetEntryCount(), Manifest.GetEntryCount());
+}
+
+TEST(PBR_PSOManifestTest, InvalidDataIsRejected)
+{
+    const std::vector<TestEntry> Entries = MakeTestEntries();
+
+    PBR_PSOManifest Manifest;
+    for (const TestEntry& Entry : Entries)
+        Manifest.Add(Entry.GraphicsDesc, Entry.Key);
+
+    std::vector<Uint8> Data;
+    Manifest.Serialize(Data);
+
+    PBR_PSOManifest Target;
+    Target.Add(Entries[0].GraphicsDesc, Entries[0].Key);
+
+    // Every truncated prefix is rejected and leaves the manifest intact
+    for (size_t Size = 0; Size < Data.size(); ++Size)
+    {
+        EXPECT_FALSE(Target.Deserialize(Data.data(), Size)) << "Size " << Size;
+        EXPECT_EQ(Target.GetEntryCount(), size_t{1});
+    }
+
+    std::vector<Uint8> BadMagic = Data;
+    BadMagic[0]                 = 'X';
+    EXPECT_FALSE(Target.Deserialize(BadMagic.data(), BadMagic.size()));
+
+    std::vector<Uint8> TrailingData = Data;
+    TrailingData.push_back(0);
+    EXPECT_FALSE(Target.Deserialize(TrailingData.data(), TrailingData.size()));
+
+    EXPECT_EQ(Target.GetEntryCount(), size_t{1});
+}
+
+TEST(PBR_PSOManifestTest, SaveAndLoad)
+{
+    PBR_PSOManifest Manifest;
+    for (const TestEntry& Entry : MakeTestEntries())
+        Manifest.Add(Entry.GraphicsDesc, Entry.Key);
+
+    TempDirectory     TempDir{"PBR_PSOManifestTest"};
+    const std::string Path = TempDir.Get() + "/pso_manifest.bin";
+    ASSERT_TRUE(Manifest.Save(Path.c_str()));
+
+    PBR_PSOManifest Loaded;
+    ASSERT_TRUE(Loaded.Load(Path.c_str()));
+    ExpectSameEntries(Manifest, Loaded);
+
+    const std::string MissingPath = TempDir.Get() + "/missing.bin";
+    EXPECT_FALSE(Loaded.Load(MissingPath.c_str()));
+}
@@ -0,0 +1,300 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TempDirectory.hpp"
+#include "gtest/gtest.h"
+
+#include "PBR_Renderer.hpp"
+#include "PBR_ShaderSourceCache.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "Utilities/interface/DiligentFXShaderSourceStreamFactory.hpp"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using GeneratedInclude = PBR_ShaderSourceCache::GeneratedInclude;
+
+RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateTestFactory()
+{
+    return CreateMemoryShaderSourceFactory(
+        {
+            MemoryShaderSourceFileInfo{
+                "Main.psh",
+                "#include \"Once.fxh\"\n"
+                "  #  include <Guarded.fxh>\n"
+                "#include \"Once.fxh\"\n"
+                "// #include \"Missing.fxh\"\n"
+                "/* Block comment\n"
+                "#include \"Missing.fxh\"\n"
+                "*/\n"
+                "#include \"Struct.generated\"\n"
+                "void main() {}\n",
+            },
+            MemoryShaderSourceFileInfo{
+                "Once.fxh",
+                "#pragma once\n"
+                "float Once;\n",
+            },
+            MemoryShaderSourceFileInfo{
+                "Guarded.fxh",
+                "#ifndef GUARDED\n"
+                "#define GUARDED\n"
+                "#endif",
+            },
+            MemoryShaderSourceFileInfo{
+                "MissingInclude.psh",
+                "#include \"Missing.fxh\"\n",
+            },
+        },
+        true);
+}
+
+TEST(PBR_ShaderSourceCacheTest, ExpandIncludes)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CreateTestFactory();
+
+    const std::string      Struct             = "struct PSOutput {};";
+    const GeneratedInclude GeneratedIncludes[] = {{"Struct.generated", &Struct}};
+
+    PBR_ShaderSourceCache Cache;
+
+    const std::string* pSource = Cache.Get("Main.psh", pFactory, GeneratedIncludes, _countof(GeneratedIncludes));
+    ASSERT_NE(pSource, nullptr);
+    EXPECT_EQ(*pSource,
+              "float Once;\n"
+              "#ifndef GUARDED\n"
+              "#define GUARDED\n"
+              "#endif\n"
+              "// #include \"Missing.fxh\"\n"
+              "/* Block comment\n"
+              "#include \"Missing.fxh\"\n"
+              "*/\n"
+              "struct PSOutput {};\n"
+              "void main() {}\n");
+
+    EXPECT_EQ(Cache.Get("MissingInclude.psh", pFactory, nullptr, 0), nullptr);
+    EXPECT_EQ(Cache.Get("Missing.psh", pFactory, nullptr, 0), nullptr);
+}
+
+TEST(PBR_ShaderSourceCacheTest, CacheHits)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CreateTestFactory();
+
+    const std::string Struct0 = "struct PSOutput { float4 Color : SV_Target0; };";
+    const std::string Struct1 = "struct PSOutput { float4 Color : SV_Target0; float4 Normal : SV_Target1; };";
+
+    PBR_ShaderSourceCache Cache;
+
+    const GeneratedInclude Includes0[] = {{"Struct.generated", &Struct0}};
+    const std::string*     pSource0    = Cache.Get("Main.psh", pFactory, Includes0, _countof(Includes0));
+    ASSERT_NE(pSource0, nullptr);
+    const std::string Source0 = *pSource0;
+
+    // The key contains the contents of the generated includes rather than their addresses
+    const std::string      Struct0Copy = Struct0;
+    const GeneratedInclude Includes0Copy[] = {{"Struct.generated", &Struct0Copy}};
+    EXPECT_EQ(Cache.Get("Main.psh", pFactory, Includes0Copy, _countof(Includes0Copy)), pSource0);
+    EXPECT_EQ(*pSource0, Source0);
+
+    const GeneratedInclude Includes1[] = {{"Struct.generated", &Struct1}};
+    const std::string*     pSource1    = Cache.Get("Main.psh", pFactory, Includes1, _countof(Includes1));
+    ASSERT_NE(pSource1, nullptr);
+    EXPECT_NE(pSource1, pSource0);
+    EXPECT_NE(pSource1->find(Struct1), std::string::npos);
+    EXPECT_EQ(pSource1->find(Struct0), std::string::npos);
+
+    EXPECT_EQ(Cache.GetStatistics().MemoryHits, 1u);
+    EXPECT_EQ(Cache.GetStatistics().Misses, 2u);
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.GetStatistics().MemoryHits, 0u);
+    EXPECT_EQ(Cache.GetStatistics().Misses, 0u);
+}
+
+TEST(PBR_ShaderSourceCacheTest, DiskMirror)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CreateTestFactory();
+
+    TempDirectory TempDir{"PBR_ShaderSourceCacheTest"};
+
+    const std::string      Struct              = "struct PSOutput {};";
+    const GeneratedInclude GeneratedIncludes[] = {{"Struct.generated", &Struct}};
+
+    std::string Source;
+    {
+        PBR_ShaderSourceCache Cache{TempDir.Get().c_str()};
+
+        const std::string* pSource = Cache.Get("Main.psh", pFactory, GeneratedIncludes, _countof(GeneratedIncludes));
+        ASSERT_NE(pSource, nullptr);
+        Source = *pSource;
+        EXPECT_EQ(Cache.GetStatistics().Misses, 1u);
+    }
+
+    {
+        PBR_ShaderSourceCache Cache{TempDir.Get().c_str()};
+
+        const std::string* pSource = Cache.Get("Main.psh", pFactory, GeneratedIncludes, _countof(GeneratedIncludes));
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(*pSource, Source);
+        EXPECT_EQ(Cache.GetStatistics().DiskHits, 1u);
+        EXPECT_EQ(Cache.GetStatistics().Misses, 0u);
+
+        // Different generated includes must not be loaded from the mirror
+        const std::string      OtherStruct     = "struct PSOutput { float4 Color : SV_Target0; };";
+        const GeneratedInclude OtherIncludes[] = {{"Struct.generated", &OtherStruct}};
+        pSource                                = Cache.Get("Main.psh", pFactory, OtherIncludes, _countof(OtherIncludes));
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_NE(*pSource, Source);
+        EXPECT_EQ(Cache.GetStatistics().Misses, 1u);
+    }
+}
+
+TEST(PBR_ShaderSourceCacheTest, DiskMirrorChangedFiles)
+{
+    TempDirectory TempDir{"PBR_ShaderSourceCacheTest"};
+
+    const auto CreateFactory = [](const char* IncludeSource) {
+        return CreateMemoryShaderSourceFactory(
+            {
+                MemoryShaderSourceFileInfo{"Main.psh", "#include \"Include.fxh\"\n"},
+                MemoryShaderSourceFileInfo{"Include.fxh", IncludeSource},
+            },
+            true);
+    };
+
+    {
+        PBR_ShaderSourceCache Cache{TempDir.Get().c_str()};
+        EXPECT_NE(Cache.Get("Main.psh", CreateFactory("float Old;\n"), nullptr, 0), nullptr);
+    }
+
+    // A mirrored source expanded from an older version of an include file must not be used
+    {
+        PBR_ShaderSourceCache Cache{TempDir.Get().c_str()};
+
+        const std::string* pSource = Cache.Get("Main.psh", CreateFactory("float New;\n"), nullptr, 0);
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(*pSource, "float New;\n");
+        EXPECT_EQ(Cache.GetStatistics().DiskHits, 0u);
+        EXPECT_EQ(Cache.GetStatistics().Misses, 1u);
+    }
+
+    // The mirror is updated with the new version
+    {
+        PBR_ShaderSourceCache Cache{TempDir.Get().c_str()};
+
+        const std::string* pSource = Cache.Get("Main.psh", CreateFactory("float New;\n"), nullptr, 0);
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(*pSource, "float New;\n");
+        EXPECT_EQ(Cache.GetStatistics().DiskHits, 1u);
+    }
+}
+
+struct PBR_RendererTestAccess : PBR_Renderer
+{
+    using PBR_Renderer::GetPSOutputStruct;
+    using PBR_Renderer::GetVSOutputStruct;
+};
+
+// Generates pixel shader sources for sampled PSO flag combinations the same way the renderer
+// does and verifies that cache hits are byte-identical to the sources expanded on a miss.
+TEST(PBR_ShaderSourceCacheTest, PermutationSources)
+{
+    constexpr Uint32 NumCombinations = 95;
+
+    std::vector<PBR_Renderer::PSO_FLAGS> FlagCombinations;
+    {
+        std::unordered_set<Uint64> UniqueFlags;
+
+        Uint64 Seed = 19;
+        while (FlagCombinations.size() < NumCombinations)
+        {
+            Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+
+            const PBR_Renderer::PSO_FLAGS Flags = static_cast<PBR_Renderer::PSO_FLAGS>((Seed >> 11) & PBR_Renderer::PSO_FLAG_ALL);
+            if (UniqueFlags.insert(Flags).second)
+                FlagCombinations.push_back(Flags);
+        }
+    }
+
+    IShaderSourceInputStreamFactory& Factory = DiligentFXShaderSourceStreamFactory::GetInstance();
+
+    const std::string Footer = "    return PSOut;\n";
+
+    struct GeneratedSources
+    {
+        std::string VSOutputStruct;
+        std::string PSOutputStruct;
+    };
+    std::vector<GeneratedSources> Generated(FlagCombinations.size());
+    for (size_t i = 0; i < FlagCombinations.size(); ++i)
+    {
+        Generated[i].VSOutputStruct = PBR_RendererTestAccess::GetVSOutputStruct(FlagCombinations[i], false, false);
+        Generated[i].PSOutputStruct = PBR_RendererTestAccess::GetPSOutputStruct(FlagCombinations[i]);
+    }
+
+    PBR_ShaderSourceCache Cache;
+
+    auto GetSource = [&](size_t i) {
+        const char*            FilePath   = (FlagCombinations[i] & PBR_Renderer::PSO_FLAG_UNSHADED) != 0 ? "RenderUnshaded.psh" : "RenderPBR.psh";
+        const GeneratedInclude Includes[] = {
+            {"VSOutputStruct.generated", &Generated[i].VSOutputStruct},
+            {"PSOutputStruct.generated", &Generated[i].PSOutputStruct},
+            {"PSMainFooter.generated", &Footer},
+        };
+        return Cache.Get(FilePath, &Factory, Includes, _countof(Includes));
+    };
+
+    std::vector<std::string> Sources(FlagCombinations.size());
+    for (size_t i = 0; i < FlagCombinations.size(); ++i)
+    {
+        const std::string* pSource = GetSource(i);
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(pSource->find("#include \"VSOutputStruct.generated\""), std::string::npos);
+        EXPECT_NE(pSource->find(Generated[i].PSOutputStruct), std::string::npos);
+        Sources[i] = *pSource;
+    }
+
+    const PBR_ShaderSourceCache::Statistics FirstPassStats = Cache.GetStatistics();
+    EXPECT_EQ(FirstPassStats.MemoryHits + FirstPassStats.Misses, NumCombinations);
+
+    for (size_t i = 0; i < FlagCombinations.size(); ++i)
+    {
+        const std::string* pSource = GetSource(i);
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(*pSource, Sources[i]);
+    }
+    EXPECT_EQ(Cache.GetStatistics().MemoryHits, FirstPassStats.MemoryHits + NumCombinations);
+    EXPECT_EQ(Cache.GetStatistics().Misses, FirstPassStats.Misses);
+}
+
+} // namespace
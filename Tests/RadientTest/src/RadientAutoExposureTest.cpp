@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientAutoExposure.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<float> MakeImage(size_t NumPixels, const float3& Color)
+{
+    std::vector<float> Pixels;
+    Pixels.reserve(NumPixels * 4);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        Pixels.push_back(Color.r);
+        Pixels.push_back(Color.g);
+        Pixels.push_back(Color.b);
+        Pixels.push_back(1.f);
+    }
+    return Pixels;
+}
+
+} // namespace
+
+TEST(RadientAutoExposureTest, HistogramBins)
+{
+    const RadientAutoExposureDesc Desc;
+
+    EXPECT_EQ(RadientAutoExposure::GetHistogramBin(0.f, Desc), 0u);
+    EXPECT_EQ(RadientAutoExposure::GetHistogramBin(std::exp2(Desc.MinLogLuminance - 4.f), Desc), 0u);
+    EXPECT_EQ(RadientAutoExposure::GetHistogramBin(std::exp2(Desc.MaxLogLuminance + 4.f), Desc), RadientAutoExposure::HistogramBinCount - 1);
+    EXPECT_EQ(RadientAutoExposure::GetHistogramBin(1e30f, Desc), RadientAutoExposure::HistogramBinCount - 1);
+
+    // Every bin center falls into its own bin
+    for (Uint32 Bin = 0; Bin < RadientAutoExposure::HistogramBinCount; ++Bin)
+    {
+        const float Luminance = std::exp2(RadientAutoExposure::GetBinLogLuminance(Bin, Desc));
+        EXPECT_EQ(RadientAutoExposure::GetHistogramBin(Luminance, Desc), Bin);
+    }
+
+    // Brighter pixels never fall into darker bins
+    Uint32 PrevBin = 0;
+    for (float LogLuminance = -12.f; LogLuminance < 8.f; LogLuminance += 0.05f)
+    {
+        const Uint32 Bin = RadientAutoExposure::GetHistogramBin(std::exp2(LogLuminance), Desc);
+        EXPECT_GE(Bin, PrevBin);
+        PrevBin = Bin;
+    }
+}
+
+TEST(RadientAutoExposureTest, Luminance)
+{
+    EXPECT_NEAR(RadientAutoExposure::GetLuminance(float3{1, 1, 1}), 1.f, 1e-5f);
+    EXPECT_GT(RadientAutoExposure::GetLuminance(float3{0, 1, 0}), RadientAutoExposure::GetLuminance(float3{1, 0, 0}));
+    EXPECT_GT(RadientAutoExposure::GetLuminance(float3{1, 0, 0}), RadientAutoExposure::GetLuminance(float3{0, 0, 1}));
+    // Negative components do not reduce the luminance
+    EXPECT_EQ(RadientAutoExposure::GetLuminance(float3{-1, 0, 0}), 0.f);
+}
+
+TEST(RadientAutoExposureTest, UniformImage)
+{
+    RadientAutoExposureDesc Desc;
+    Desc.LowPercentile  = 0.f;
+    Desc.HighPercentile = 1.f;
+
+    // The average of a uniform image is its luminance, up to the bin width
+    const float BinWidth = (Desc.MaxLogLuminance - Desc.MinLogLuminance) / static_cast<float>(RadientAutoExposure::HistogramBinCount);
+    for (float Luminance : {0.01f, 0.18f, 1.f, 20.f})
+    {
+        const std::vector<float> Pixels = MakeImage(64 * 64, float3{Luminance, Luminance, Luminance});
+
+        RadientAutoExposure::Histogram Hist{};
+        RadientAutoExposure::AddToHistogram(Pixels.data(), 64 * 64, 4, Desc, Hist);
+
+        const float Average = RadientAutoExposure::ComputeAverageLuminance(Hist, Desc);
+        EXPECT_LE(std::abs(std::log2(Average) - std::log2(Luminance)), BinWidth);
+    }
+}
+
+TEST(RadientAutoExposureTest, Percentiles)
+{
+    RadientAutoExposureDesc Desc;
+    Desc.LowPercentile  = 0.05f;
+    Desc.HighPercentile = 0.9f;
+
+    // 5% black pixels, 85% mid-gray pixels and 10% bright highlights
+    std::vector<float> Pixels = MakeImage(50, float3{0, 0, 0});
+
+    const std::vector<float> MidGray    = MakeImage(850, float3{0.18f, 0.18f, 0.18f});
+    const std::vector<float> Highlights = MakeImage(100, float3{40.f, 40.f, 40.f});
+    Pixels.insert(Pixels.end(), MidGray.begin(), MidGray.end());
+    Pixels.insert(Pixels.end(), Highlights.begin(), Highlights.end());
+
+    RadientAutoExposure::Histogram Hist{};
+    RadientAutoExposure::AddToHistogram(Pixels.data(), Pixels.size() / 4, 4, Desc, Hist);
+
+    const float BinWidth = (Desc.MaxLogLuminance - Desc.MinLogLuminance) / static_cast<float>(RadientAutoExposure::HistogramBinCount);
+    const float Average  = RadientAutoExposure::ComputeAverageLuminance(Hist, Desc);
+    EXPECT_LE(std::abs(std::log2(Average) - std::log2(0.18f)), BinWidth);
+
+    // Without the percentiles, the highlights and the black pixels shift the average
+    Desc.LowPercentile  = 0.f;
+    Desc.HighPercentile = 1.f;
+    EXPECT_GT(std::abs(std::log2(RadientAutoExposure::ComputeAverageLuminance(Hist, Desc)) - std::log2(0.18f)), BinWidth);
+}
+
+TEST(RadientAutoExposureTest, EmptyHistogram)
+{
+    const RadientAutoExposureDesc  Desc;
+    const RadientAutoExposure::Histogram Hist{};
+    EXPECT_EQ(RadientAutoExposure::ComputeAverageLuminance(Hist, Desc), 0.f);
+
+    // An empty histogram keeps the adapted luminance
+    EXPECT_EQ(RadientAutoExposure::AdaptLuminance(0.5f, 0.f, 1.f / 60.f, Desc.AdaptationSpeed), 0.5f);
+}
+
+TEST(RadientAutoExposureTest, Adaptation)
+{
+    EXPECT_EQ(RadientAutoExposure::GetAdaptationRate(1.f / 60.f, 0.f), 1.f);
+    EXPECT_EQ(RadientAutoExposure::GetAdaptationRate(0.f, 1.5f), 0.f);
+    EXPECT_GT(RadientAutoExposure::GetAdaptationRate(1.f / 30.f, 1.5f), RadientAutoExposure::GetAdaptationRate(1.f / 60.f, 1.5f));
+    EXPECT_LT(RadientAutoExposure::GetAdaptationRate(10.f, 1.5f), 1.f + 1e-6f);
+
+    // The first frame adapts immediately
+    EXPECT_EQ(RadientAutoExposure::AdaptLuminance(0.f, 2.f, 1.f / 60.f, 1.5f), 2.f);
+
+    // The adaptation does not depend on the frame rate
+    float Adapted30 = 0.1f;
+    for (int Frame = 0; Frame < 30; ++Frame)
+        Adapted30 = RadientAutoExposure::AdaptLuminance(Adapted30, 2.f, 1.f / 30.f, 1.5f);
+    float Adapted60 = 0.1f;
+    for (int Frame = 0; Frame < 60; ++Frame)
+        Adapted60 = RadientAutoExposure::AdaptLuminance(Adapted60, 2.f, 1.f / 60.f, 1.5f);
+    EXPECT_NEAR(Adapted30, Adapted60, 1e-3f);
+
+    // The adapted luminance moves monotonically towards the target and converges
+    float Adapted = 0.1f;
+    for (int Frame = 0; Frame < 600; ++Frame)
+    {
+        const float Next = RadientAutoExposure::AdaptLuminance(Adapted, 2.f, 1.f / 60.f, 1.5f);
+        EXPECT_GE(Next, Adapted);
+        EXPECT_LE(Next, 2.f);
+        Adapted = Next;
+    }
+    EXPECT_NEAR(Adapted, 2.f, 1e-3f);
+}
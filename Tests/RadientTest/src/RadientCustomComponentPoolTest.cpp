@@ -0,0 +1,303 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Scene/Components/RadientCustomComponentPool.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+entt::entity MakeEntity(Uint32 Index)
+{
+    return static_cast<entt::entity>(Index);
+}
+
+RadientCustomComponentData MakeComponent(const Char* Schema, const void* pData, Uint32 DataSize, Uint32 Version = 1)
+{
+    RadientCustomComponentData Component;
+    Component.ComponentType = 1000;
+    Component.Name          = "Test";
+    Component.Schema        = Schema;
+    Component.Version       = Version;
+    Component.pData         = pData;
+    Component.DataSize      = DataSize;
+    return Component;
+}
+
+void ExpectPoolConsistent(const CustomComponentPool& Pool)
+{
+    size_t TotalCount = 0;
+    for (const CustomComponentPool::Slab& Slab : Pool.GetSlabs())
+    {
+        ASSERT_EQ(Slab.EntityIDs.size(), Slab.Entities.size());
+        ASSERT_EQ(Slab.Data.size(), Slab.Entities.size() * Slab.DataSize);
+        for (size_t Slot = 0; Slot < Slab.GetCount(); ++Slot)
+        {
+            RadientCustomComponentData Component;
+            ASSERT_TRUE(Pool.Get(Slab.Entities[Slot], Component));
+            EXPECT_EQ(Component.DataSize, Slab.DataSize);
+            EXPECT_EQ(Component.pData, Slab.DataSize != 0 ? Slab.GetData(Slot) : nullptr);
+        }
+        TotalCount += Slab.GetCount();
+    }
+    EXPECT_EQ(TotalCount, Pool.GetCount());
+}
+
+TEST(RadientCustomComponentPoolTest, GroupsInstancesByLayout)
+{
+    CustomComponentPool Pool;
+
+    const Uint32 Small[2] = {1, 2};
+    const Uint32 Large[4] = {3, 4, 5, 6};
+
+    EXPECT_TRUE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://a", Small, sizeof(Small))));
+    EXPECT_TRUE(Pool.Set(MakeEntity(2), 2, MakeComponent("schema://a", Small, sizeof(Small))));
+    EXPECT_TRUE(Pool.Set(MakeEntity(3), 3, MakeComponent("schema://a", Large, sizeof(Large))));
+    EXPECT_TRUE(Pool.Set(MakeEntity(4), 4, MakeComponent("schema://b", Small, sizeof(Small))));
+    EXPECT_TRUE(Pool.Set(MakeEntity(5), 5, MakeComponent("schema://a", Small, sizeof(Small), 2)));
+
+    const std::vector<CustomComponentPool::Slab>& Slabs = Pool.GetSlabs();
+    ASSERT_EQ(Slabs.size(), 4u);
+    EXPECT_EQ(Slabs[0].GetCount(), 2u);
+    EXPECT_EQ(Slabs[0].DataSize, sizeof(Small));
+    EXPECT_EQ(Slabs[0].EntityIDs[0], 1u);
+    EXPECT_EQ(Slabs[0].EntityIDs[1], 2u);
+    EXPECT_EQ(Slabs[1].DataSize, sizeof(Large));
+    EXPECT_STREQ(Slabs[2].Schema.c_str(), "schema://b");
+    EXPECT_EQ(Slabs[3].Version, 2u);
+    EXPECT_EQ(Pool.GetCount(), 5u);
+
+    RadientCustomComponentData Component;
+    ASSERT_TRUE(Pool.Get(MakeEntity(3), Component));
+    EXPECT_STREQ(Component.Name, "Test");
+    EXPECT_STREQ(Component.Schema, "schema://a");
+    EXPECT_EQ(Component.Version, 1u);
+    ASSERT_EQ(Component.DataSize, sizeof(Large));
+    EXPECT_EQ(std::memcmp(Component.pData, Large, sizeof(Large)), 0);
+
+    EXPECT_FALSE(Pool.Get(MakeEntity(6), Component));
+    ExpectPoolConsistent(Pool);
+}
+
+TEST(RadientCustomComponentPoolTest, UpdateWithSameLayoutIsInPlace)
+{
+    CustomComponentPool Pool;
+
+    const Uint32 Value0 = 10;
+    const Uint32 Value1 = 20;
+    EXPECT_TRUE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://a", &Value0, sizeof(Value0))));
+
+    RadientCustomComponentData Before;
+    ASSERT_TRUE(Pool.Get(MakeEntity(1), Before));
+
+    EXPECT_FALSE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://a", &Value1, sizeof(Value1))));
+
+    RadientCustomComponentData After;
+    ASSERT_TRUE(Pool.Get(MakeEntity(1), After));
+    EXPECT_EQ(After.pData, Before.pData);
+    EXPECT_EQ(*static_cast<const Uint32*>(After.pData), Value1);
+
+    // Changing the layout moves the instance to another slab.
+    const Uint64 Wide = 30;
+    EXPECT_FALSE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://a", &Wide, sizeof(Wide))));
+    ASSERT_TRUE(Pool.Get(MakeEntity(1), After));
+    ASSERT_EQ(After.DataSize, sizeof(Wide));
+    EXPECT_EQ(*static_cast<const Uint64*>(After.pData), Wide);
+    EXPECT_EQ(Pool.GetSlabs()[0].GetCount(), 0u);
+    EXPECT_EQ(Pool.GetCount(), 1u);
+    ExpectPoolConsistent(Pool);
+}
+
+TEST(RadientCustomComponentPoolTest, SwapRemoveKeepsLocationsConsistent)
+{
+    CustomComponentPool Pool;
+
+    constexpr Uint32 Count = 16;
+    for (Uint32 i = 0; i < Count; ++i)
+        Pool.Set(MakeEntity(i), i + 1, MakeComponent("schema://a", &i, sizeof(i)));
+
+    EXPECT_TRUE(Pool.Remove(MakeEntity(0)));
+    EXPECT_TRUE(Pool.Remove(MakeEntity(7)));
+    EXPECT_TRUE(Pool.Remove(MakeEntity(Count - 1)));
+    EXPECT_FALSE(Pool.Remove(MakeEntity(7)));
+    EXPECT_FALSE(Pool.Contains(MakeEntity(7)));
+    EXPECT_EQ(Pool.GetCount(), Count - 3);
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        RadientCustomComponentData Component;
+        if (i == 0 || i == 7 || i == Count - 1)
+        {
+            EXPECT_FALSE(Pool.Get(MakeEntity(i), Component));
+            continue;
+        }
+        ASSERT_TRUE(Pool.Get(MakeEntity(i), Component));
+        EXPECT_EQ(*static_cast<const Uint32*>(Component.pData), i);
+    }
+    ExpectPoolConsistent(Pool);
+
+    for (Uint32 i = 0; i < Count; ++i)
+        Pool.Remove(MakeEntity(i));
+    EXPECT_TRUE(Pool.IsEmpty());
+}
+
+TEST(RadientCustomComponentPoolTest, PayloadMayReferencePoolStorage)
+{
+    // Copying a component from another instance of the same pool must not read freed memory
+    // when the target slab grows.
+    CustomComponentPool Pool;
+
+    const Uint8 Payload[24] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+    Pool.Set(MakeEntity(0), 1, MakeComponent("schema://a", Payload, sizeof(Payload)));
+
+    for (Uint32 i = 1; i < 64; ++i)
+    {
+        RadientCustomComponentData Source;
+        ASSERT_TRUE(Pool.Get(MakeEntity(i - 1), Source));
+        EXPECT_TRUE(Pool.Set(MakeEntity(i), i + 1, Source));
+    }
+
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        RadientCustomComponentData Component;
+        ASSERT_TRUE(Pool.Get(MakeEntity(i), Component));
+        ASSERT_EQ(Component.DataSize, sizeof(Payload));
+        EXPECT_EQ(std::memcmp(Component.pData, Payload, sizeof(Payload)), 0);
+    }
+}
+
+TEST(RadientCustomComponentPoolTest, ZeroSizedPayloads)
+{
+    CustomComponentPool Pool;
+
+    EXPECT_TRUE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://tag", nullptr, 0)));
+    EXPECT_TRUE(Pool.Set(MakeEntity(2), 2, MakeComponent("schema://tag", nullptr, 0)));
+    EXPECT_FALSE(Pool.Set(MakeEntity(1), 1, MakeComponent("schema://tag", nullptr, 0)));
+
+    RadientCustomComponentData Component;
+    ASSERT_TRUE(Pool.Get(MakeEntity(2), Component));
+    EXPECT_EQ(Component.pData, nullptr);
+    EXPECT_EQ(Component.DataSize, 0u);
+
+    EXPECT_TRUE(Pool.Remove(MakeEntity(1)));
+    ASSERT_EQ(Pool.GetSlabs().size(), 1u);
+    EXPECT_EQ(Pool.GetSlabs()[0].EntityIDs[0], 2u);
+    ExpectPoolConsistent(Pool);
+}
+
+TEST(RadientCustomComponentPoolTest, EmptySlabsAreRecycled)
+{
+    CustomComponentPool Pool;
+
+    // Payloads of varying sizes create a new layout on every update. Slabs of layouts that are
+    // no longer used are freed and reused, so they do not accumulate.
+    const Uint8 Payload[256] = {};
+    for (Uint32 Size = 1; Size <= sizeof(Payload); ++Size)
+    {
+        Pool.Set(MakeEntity(1), 1, MakeComponent("schema://var", Payload, Size));
+        Pool.Set(MakeEntity(2), 2, MakeComponent("schema://var", Payload, sizeof(Payload) + 1 - Size));
+    }
+    EXPECT_LE(Pool.GetSlabs().size(), 3u);
+    ExpectPoolConsistent(Pool);
+
+    RadientCustomComponentData Component;
+    ASSERT_TRUE(Pool.Get(MakeEntity(1), Component));
+    EXPECT_EQ(Component.DataSize, sizeof(Payload));
+    ASSERT_TRUE(Pool.Get(MakeEntity(2), Component));
+    EXPECT_EQ(Component.DataSize, 1u);
+
+    // The memory of a freed slab is released
+    EXPECT_TRUE(Pool.Remove(MakeEntity(1)));
+    EXPECT_TRUE(Pool.Remove(MakeEntity(2)));
+    for (const CustomComponentPool::Slab& Slab : Pool.GetSlabs())
+    {
+        EXPECT_EQ(Slab.GetCount(), 0u);
+        EXPECT_EQ(Slab.Data.capacity(), 0u);
+    }
+
+    // A layout that was used before gets a fresh slab
+    const Uint32 Value = 7;
+    EXPECT_TRUE(Pool.Set(MakeEntity(3), 3, MakeComponent("schema://var", &Value, sizeof(Value))));
+    ASSERT_TRUE(Pool.Get(MakeEntity(3), Component));
+    EXPECT_EQ(*static_cast<const Uint32*>(Component.pData), Value);
+    EXPECT_LE(Pool.GetSlabs().size(), 3u);
+    ExpectPoolConsistent(Pool);
+}
+
+TEST(RadientCustomComponentPoolTest, LargeScaleAttachUpdateEnumerateRemove)
+{
+    // Exercises the pool at a scale where per-instance allocations would dominate.
+    CustomComponentPool Pool;
+
+    constexpr Uint32 Count = 200000;
+
+    struct Payload
+    {
+        Uint32 Values[6];
+    };
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const Payload Data = {{i, i + 1, i + 2, i + 3, i + 4, i + 5}};
+        EXPECT_TRUE(Pool.Set(MakeEntity(i), i + 1, MakeComponent("schema://bulk", &Data, sizeof(Data))));
+    }
+
+    for (Uint32 i = 0; i < Count; i += 2)
+    {
+        const Payload Data = {{i * 2, 0, 0, 0, 0, 0}};
+        EXPECT_FALSE(Pool.Set(MakeEntity(i), i + 1, MakeComponent("schema://bulk", &Data, sizeof(Data))));
+    }
+
+    ASSERT_EQ(Pool.GetSlabs().size(), 1u);
+    const CustomComponentPool::Slab& Slab = Pool.GetSlabs()[0];
+    ASSERT_EQ(Slab.GetCount(), Count);
+
+    Uint64 Checksum = 0;
+    for (size_t Slot = 0; Slot < Slab.GetCount(); ++Slot)
+    {
+        Payload Data;
+        std::memcpy(&Data, Slab.GetData(Slot), sizeof(Data));
+        Checksum += Data.Values[0];
+    }
+
+    Uint64 ExpectedChecksum = 0;
+    for (Uint32 i = 0; i < Count; ++i)
+        ExpectedChecksum += (i % 2 == 0) ? i * 2 : i;
+    EXPECT_EQ(Checksum, ExpectedChecksum);
+
+    for (Uint32 i = 0; i < Count; i += 3)
+        EXPECT_TRUE(Pool.Remove(MakeEntity(i)));
+    EXPECT_EQ(Pool.GetCount(), Count - (Count + 2) / 3);
+    ExpectPoolConsistent(Pool);
+}
+
+} // namespace
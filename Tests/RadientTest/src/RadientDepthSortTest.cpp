@@ -0,0 +1,336 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientDepthSort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+struct SyntheticCamera
+{
+    RadientFloat3 Position;
+    RadientFloat3 Direction;
+};
+
+RadientFloat3 Normalize(const RadientFloat3& V)
+{
+    const float Len = std::sqrt(V.x * V.x + V.y * V.y + V.z * V.z);
+    return RadientFloat3{V.x / Len, V.y / Len, V.z / Len};
+}
+
+std::vector<SyntheticCamera> MakeCameras()
+{
+    return {
+        SyntheticCamera{RadientFloat3{0.f, 0.f, 10.f}, RadientFloat3{0.f, 0.f, -1.f}},
+        SyntheticCamera{RadientFloat3{-20.f, 3.f, 0.f}, RadientFloat3{1.f, 0.f, 0.f}},
+        SyntheticCamera{RadientFloat3{15.f, 15.f, 15.f}, Normalize(RadientFloat3{-1.f, -1.f, -1.f})},
+        SyntheticCamera{RadientFloat3{0.f, 50.f, 0.f}, RadientFloat3{0.f, -1.f, 0.f}},
+    };
+}
+
+// Scale, rotation about the Y axis and translation, in the row-vector convention.
+RadientMatrix4x4 MakeWorldMatrix(float Scale, float Angle, const RadientFloat3& Translation)
+{
+    const float C = std::cos(Angle) * Scale;
+    const float S = std::sin(Angle) * Scale;
+    return RadientMatrix4x4{
+        C, 0.f, -S, 0.f,
+        0.f, Scale, 0.f, 0.f,
+        S, 0.f, C, 0.f,
+        Translation.x, Translation.y, Translation.z, 1.f};
+}
+
+struct SyntheticPrimitive
+{
+    RadientMatrix4x4 WorldMatrix;
+    RadientBounds    LocalBounds;
+    Uint32           TieBreak = 0;
+};
+
+std::vector<SyntheticPrimitive> MakeRandomPrimitives(Uint32 Count, Uint32 TieBreakCount, Uint32 Seed)
+{
+    std::mt19937                          Rng{Seed};
+    std::uniform_real_distribution<float> Pos{-30.f, 30.f};
+    std::uniform_real_distribution<float> Extent{0.f, 2.f};
+    std::uniform_real_distribution<float> Scale{0.25f, 4.f};
+    std::uniform_real_distribution<float> Angle{0.f, 6.28f};
+    std::uniform_int_distribution<Uint32> TieBreak{0, TieBreakCount - 1};
+
+    std::vector<SyntheticPrimitive> Primitives(Count);
+    for (SyntheticPrimitive& Primitive : Primitives)
+    {
+        const RadientFloat3 Center{Pos(Rng) * 0.1f, Pos(Rng) * 0.1f, Pos(Rng) * 0.1f};
+        const RadientFloat3 HalfSize{Extent(Rng), Extent(Rng), Extent(Rng)};
+
+        Primitive.WorldMatrix = MakeWorldMatrix(Scale(Rng), Angle(Rng), RadientFloat3{Pos(Rng), Pos(Rng), Pos(Rng)});
+        Primitive.LocalBounds = RadientBounds{
+            RadientFloat3{Center.x - HalfSize.x, Center.y - HalfSize.y, Center.z - HalfSize.z},
+            RadientFloat3{Center.x + HalfSize.x, Center.y + HalfSize.y, Center.z + HalfSize.z},
+        };
+        Primitive.TieBreak = TieBreak(Rng);
+    }
+    return Primitives;
+}
+
+void AddBackToFront(RadientDepthSorter& Sorter, float ViewDepth, Uint32 TieBreak, Uint32 Value)
+{
+    Sorter.Add(RadientDepthSorter::GetBackToFrontKey(ViewDepth), TieBreak, Value);
+}
+
+// Reference world-space bounds center depth computed in double precision.
+double GetReferenceDepth(const SyntheticCamera& Camera, const SyntheticPrimitive& Primitive)
+{
+    const float* M = Primitive.WorldMatrix.Data;
+
+    const double Center[3] = {
+        (double{Primitive.LocalBounds.Min.x} + Primitive.LocalBounds.Max.x) * 0.5,
+        (double{Primitive.LocalBounds.Min.y} + Primitive.LocalBounds.Max.y) * 0.5,
+        (double{Primitive.LocalBounds.Min.z} + Primitive.LocalBounds.Max.z) * 0.5,
+    };
+
+    double Depth = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        const double World = Center[0] * M[i] + Center[1] * M[4 + i] + Center[2] * M[8 + i] + M[12 + i];
+        const double CamPos[3] = {Camera.Position.x, Camera.Position.y, Camera.Position.z};
+        const double CamDir[3] = {Camera.Direction.x, Camera.Direction.y, Camera.Direction.z};
+        Depth += (World - CamPos[i]) * CamDir[i];
+    }
+    return Depth;
+}
+
+// Sorts the primitives with RadientDepthSorter and verifies the result against std::stable_sort.
+void TestBackToFrontOrder(const SyntheticCamera& Camera, const std::vector<SyntheticPrimitive>& Primitives)
+{
+    const RadientFloat4 DepthPlane = RadientDepthSorter::GetDepthPlane(Camera.Position, Camera.Direction);
+
+    RadientDepthSorter Sorter;
+    Sorter.Reserve(Primitives.size());
+
+    std::vector<float> Depths(Primitives.size());
+    for (Uint32 i = 0; i < Primitives.size(); ++i)
+    {
+        const SyntheticPrimitive& Primitive = Primitives[i];
+
+        Depths[i] = RadientDepthSorter::GetViewDepth(DepthPlane, Primitive.WorldMatrix, Primitive.LocalBounds);
+        EXPECT_NEAR(Depths[i], GetReferenceDepth(Camera, Primitive), 1e-3);
+
+        AddBackToFront(Sorter, Depths[i], Primitive.TieBreak, i);
+    }
+    ASSERT_EQ(Sorter.GetItemCount(), Primitives.size());
+
+    std::vector<Uint32> Sorted;
+    Sorter.Sort(Sorted);
+
+    std::vector<Uint32> Expected(Primitives.size());
+    for (Uint32 i = 0; i < Expected.size(); ++i)
+        Expected[i] = i;
+    std::stable_sort(Expected.begin(), Expected.end(), [&](Uint32 Lhs, Uint32 Rhs) {
+        if (Depths[Lhs] != Depths[Rhs])
+            return Depths[Lhs] > Depths[Rhs];
+        return Primitives[Lhs].TieBreak < Primitives[Rhs].TieBreak;
+    });
+
+    EXPECT_EQ(Sorted, Expected);
+}
+
+} // namespace
+
+TEST(RadientDepthSortTest, BackToFrontKeyOrdersFarthestFirst)
+{
+    const std::array<float, 11> Depths{1e30f, 1000.f, 10.f, 1.f, 0.5f, 1e-30f, 0.f, -1e-30f, -0.5f, -1.f, -1000.f};
+    for (size_t i = 0; i + 1 < Depths.size(); ++i)
+    {
+        EXPECT_LT(RadientDepthSorter::GetBackToFrontKey(Depths[i]), RadientDepthSorter::GetBackToFrontKey(Depths[i + 1]))
+            << Depths[i] << " vs " << Depths[i + 1];
+    }
+
+    EXPECT_EQ(RadientDepthSorter::GetBackToFrontKey(0.f), RadientDepthSorter::GetBackToFrontKey(-0.f));
+    EXPECT_EQ(RadientDepthSorter::GetBackToFrontKey(std::nanf("")), RadientDepthSorter::GetBackToFrontKey(0.f));
+}
+
+TEST(RadientDepthSortTest, FrontToBackKeyOrdersNearestFirstInCoarseBuckets)
+{
+    const std::array<float, 8> Depths{0.01f, 0.1f, 1.f, 1.25f, 2.f, 10.f, 1000.f, 1e30f};
+    for (size_t i = 0; i + 1 < Depths.size(); ++i)
+    {
+        EXPECT_LT(RadientDepthSorter::GetFrontToBackKey(Depths[i]), RadientDepthSorter::GetFrontToBackKey(Depths[i + 1]))
+            << Depths[i] << " vs " << Depths[i + 1];
+    }
+
+    // Four buckets per octave
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(1.f), RadientDepthSorter::GetFrontToBackKey(1.2f));
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(8.f), RadientDepthSorter::GetFrontToBackKey(9.99f));
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(2.f), RadientDepthSorter::GetFrontToBackKey(1.f) + 4);
+
+    // Depths at or behind the camera plane go first
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(0.f), 0u);
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(-0.f), 0u);
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(-10.f), 0u);
+    EXPECT_EQ(RadientDepthSorter::GetFrontToBackKey(std::nanf("")), 0u);
+}
+
+TEST(RadientDepthSortTest, ViewDepthUsesWorldSpaceBoundsCenter)
+{
+    const SyntheticCamera Camera{RadientFloat3{0.f, 0.f, 10.f}, RadientFloat3{0.f, 0.f, -1.f}};
+    const RadientFloat4   DepthPlane = RadientDepthSorter::GetDepthPlane(Camera.Position, Camera.Direction);
+
+    // The local bounds center (0, 0, -2) is scaled by 2 and moved to z = 1 - 4 = -3.
+    const RadientMatrix4x4 WorldMatrix = MakeWorldMatrix(2.f, 0.f, RadientFloat3{5.f, 0.f, 1.f});
+    const RadientBounds    LocalBounds{RadientFloat3{-1.f, -1.f, -3.f}, RadientFloat3{1.f, 1.f, -1.f}};
+    EXPECT_FLOAT_EQ(RadientDepthSorter::GetViewDepth(DepthPlane, WorldMatrix, LocalBounds), 13.f);
+
+    // Empty bounds fall back to the world-space origin of the primitive.
+    EXPECT_FLOAT_EQ(RadientDepthSorter::GetViewDepth(DepthPlane, WorldMatrix, RadientBounds{}), 9.f);
+
+    // Primitives behind the camera have negative depth.
+    const RadientMatrix4x4 BehindMatrix = MakeWorldMatrix(1.f, 0.f, RadientFloat3{0.f, 0.f, 12.f});
+    EXPECT_FLOAT_EQ(RadientDepthSorter::GetViewDepth(DepthPlane, BehindMatrix, RadientBounds{}), -2.f);
+}
+
+TEST(RadientDepthSortTest, SortsBackToFrontForSyntheticCameras)
+{
+    const std::vector<SyntheticPrimitive> Primitives = MakeRandomPrimitives(2000, 4, 17);
+    for (const SyntheticCamera& Camera : MakeCameras())
+        TestBackToFrontOrder(Camera, Primitives);
+}
+
+TEST(RadientDepthSortTest, SortsFrontToBackForSyntheticCameras)
+{
+    const std::vector<SyntheticPrimitive> Primitives = MakeRandomPrimitives(2000, 8, 23);
+    for (const SyntheticCamera& Camera : MakeCameras())
+    {
+        const RadientFloat4 DepthPlane = RadientDepthSorter::GetDepthPlane(Camera.Position, Camera.Direction);
+
+        RadientDepthSorter  Sorter;
+        std::vector<Uint32> Buckets(Primitives.size());
+        for (Uint32 i = 0; i < Primitives.size(); ++i)
+        {
+            const SyntheticPrimitive& Primitive = Primitives[i];
+
+            const float ViewDepth = RadientDepthSorter::GetViewDepth(DepthPlane, Primitive.WorldMatrix, Primitive.LocalBounds);
+            Buckets[i]            = RadientDepthSorter::GetFrontToBackKey(ViewDepth);
+            Sorter.Add(Buckets[i], Primitive.TieBreak, i);
+        }
+
+        std::vector<Uint32> Sorted;
+        Sorter.Sort(Sorted);
+        ASSERT_EQ(Sorted.size(), Primitives.size());
+
+        // Buckets go from near to far. Within a bucket, primitives are grouped by the
+        // tie-break key and keep the insertion order.
+        for (size_t i = 0; i + 1 < Sorted.size(); ++i)
+        {
+            const Uint32 Curr = Sorted[i];
+            const Uint32 Next = Sorted[i + 1];
+            ASSERT_LE(Buckets[Curr], Buckets[Next]);
+            if (Buckets[Curr] == Buckets[Next])
+            {
+                ASSERT_LE(Primitives[Curr].TieBreak, Primitives[Next].TieBreak);
+                if (Primitives[Curr].TieBreak == Primitives[Next].TieBreak)
+                {
+                    ASSERT_LT(Curr, Next);
+                }
+            }
+        }
+
+        // Bucketing keeps the number of pipeline switches well below the number of primitives.
+        size_t TieBreakSwitches = 0;
+        for (size_t i = 0; i + 1 < Sorted.size(); ++i)
+        {
+            if (Primitives[Sorted[i]].TieBreak != Primitives[Sorted[i + 1]].TieBreak)
+                ++TieBreakSwitches;
+        }
+        EXPECT_LT(TieBreakSwitches, Primitives.size() / 2);
+    }
+}
+
+TEST(RadientDepthSortTest, EqualDepthsAreGroupedByTieBreakAndKeepInsertionOrder)
+{
+    RadientDepthSorter Sorter;
+    AddBackToFront(Sorter, 5.f, 2, 0);
+    AddBackToFront(Sorter, 5.f, 1, 1);
+    AddBackToFront(Sorter, 9.f, 7, 2);
+    AddBackToFront(Sorter, 5.f, 2, 3);
+    AddBackToFront(Sorter, 5.f, 1, 4);
+    AddBackToFront(Sorter, -1.f, 0, 5);
+    AddBackToFront(Sorter, 5.f, 0x01000000, 6);
+
+    std::vector<Uint32> Sorted;
+    Sorter.Sort(Sorted);
+    EXPECT_EQ(Sorted, (std::vector<Uint32>{2, 1, 4, 0, 3, 6, 5}));
+
+    // The sorter can be reused after Clear().
+    Sorter.Clear();
+    EXPECT_EQ(Sorter.GetItemCount(), 0u);
+    Sorter.Sort(Sorted);
+    EXPECT_TRUE(Sorted.empty());
+}
+
+TEST(RadientDepthSortTest, SortBiasMovesPrimitiveBackward)
+{
+    const SyntheticCamera Camera{RadientFloat3{0.f, 0.f, 0.f}, RadientFloat3{0.f, 0.f, -1.f}};
+    const RadientFloat4   DepthPlane = RadientDepthSorter::GetDepthPlane(Camera.Position, Camera.Direction);
+
+    // A decal-like primitive placed in front of the surface it covers. A sort bias pushes it
+    // behind the surface, so that it is drawn first.
+    const RadientMatrix4x4 SurfaceMatrix = MakeWorldMatrix(1.f, 0.f, RadientFloat3{0.f, 0.f, -10.f});
+    const RadientMatrix4x4 DecalMatrix   = MakeWorldMatrix(1.f, 0.f, RadientFloat3{0.f, 0.f, -9.9f});
+
+    const float SurfaceDepth = RadientDepthSorter::GetViewDepth(DepthPlane, SurfaceMatrix, RadientBounds{});
+    const float DecalDepth   = RadientDepthSorter::GetViewDepth(DepthPlane, DecalMatrix, RadientBounds{});
+
+    RadientDepthSorter  Sorter;
+    std::vector<Uint32> Sorted;
+
+    AddBackToFront(Sorter, SurfaceDepth, 0, 0);
+    AddBackToFront(Sorter, DecalDepth, 0, 1);
+    Sorter.Sort(Sorted);
+    EXPECT_EQ(Sorted, (std::vector<Uint32>{0, 1}));
+
+    const float SortBias = 0.5f;
+    Sorter.Clear();
+    AddBackToFront(Sorter, SurfaceDepth, 0, 0);
+    AddBackToFront(Sorter, DecalDepth + SortBias, 0, 1);
+    Sorter.Sort(Sorted);
+    EXPECT_EQ(Sorted, (std::vector<Uint32>{1, 0}));
+}
+
+TEST(RadientDepthSortTest, SortsOneHundredThousandPrimitives)
+{
+    const std::vector<SyntheticPrimitive> Primitives = MakeRandomPrimitives(100000, 64, 29);
+    TestBackToFrontOrder(MakeCameras()[2], Primitives);
+}
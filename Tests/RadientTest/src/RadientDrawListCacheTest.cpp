@@ -0,0 +1,214 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientDrawListCache.hpp"
+
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<RadientDrawableID> FilterByLayerMask(const RadientDrawList& DrawList, Uint64 LayerMask)
+{
+    std::vector<RadientDrawableID> DrawableIDs;
+    DrawList.FilterByLayerMask(LayerMask, DrawableIDs);
+    return DrawableIDs;
+}
+
+using IDList = std::vector<RadientDrawableID>;
+
+} // namespace
+
+TEST(RadientDrawListCacheTest, DrawListFiltersByLayerMask)
+{
+    RadientDrawList DrawList;
+    EXPECT_EQ(DrawList.Add(10, 0x1u), 0u);
+    EXPECT_EQ(DrawList.Add(11, 0x2u), 1u);
+    EXPECT_EQ(DrawList.Add(12, 0x3u), 2u);
+    EXPECT_EQ(DrawList.Add(13), 3u);
+    EXPECT_EQ(DrawList.Add(14, 0u), 4u);
+    ASSERT_EQ(DrawList.GetVisibilityMasks().size(), DrawList.GetItemCount());
+
+    EXPECT_EQ(FilterByLayerMask(DrawList, ~Uint64{0}), (IDList{10, 11, 12, 13}));
+    EXPECT_EQ(FilterByLayerMask(DrawList, 0x1u), (IDList{10, 12, 13}));
+    EXPECT_EQ(FilterByLayerMask(DrawList, 0x2u), (IDList{11, 12, 13}));
+    EXPECT_EQ(FilterByLayerMask(DrawList, Uint64{1} << 63u), (IDList{13}));
+    EXPECT_TRUE(FilterByLayerMask(DrawList, 0u).empty());
+
+    // Filtering appends to the existing IDs
+    IDList DrawableIDs{99};
+    DrawList.FilterByLayerMask(0x2u, DrawableIDs);
+    EXPECT_EQ(DrawableIDs, (IDList{99, 11, 12, 13}));
+
+    DrawList.SetVisibilityMask(4, 0x2u);
+    EXPECT_EQ(FilterByLayerMask(DrawList, 0x2u), (IDList{11, 12, 13, 14}));
+}
+
+TEST(RadientDrawListCacheTest, SwapEraseKeepsMasksAligned)
+{
+    RadientDrawList DrawList;
+    DrawList.Add(10, 0x1u);
+    DrawList.Add(11, 0x2u);
+    DrawList.Add(12, 0x4u);
+
+    // The last item moves into the removed slot together with its mask
+    EXPECT_EQ(DrawList.RemoveAt(0), 12u);
+    ASSERT_EQ(DrawList.GetItemCount(), 2u);
+    ASSERT_EQ(DrawList.GetVisibilityMasks().size(), 2u);
+    EXPECT_EQ(DrawList.GetItems()[0].DrawableID, 12u);
+    EXPECT_EQ(DrawList.GetVisibilityMasks()[0], 0x4u);
+    EXPECT_EQ(FilterByLayerMask(DrawList, 0x4u), (IDList{12}));
+    EXPECT_EQ(FilterByLayerMask(DrawList, 0x1u), IDList{});
+
+    EXPECT_EQ(DrawList.RemoveAt(1), InvalidRadientDrawableID);
+    EXPECT_EQ(FilterByLayerMask(DrawList, ~Uint64{0}), (IDList{12}));
+
+    DrawList.Clear();
+    EXPECT_TRUE(DrawList.GetVisibilityMasks().empty());
+}
+
+TEST(RadientDrawListCacheTest, ListsAreReusedUntilInvalidated)
+{
+    RadientDrawListCache Cache;
+
+    int                             Source = 0;
+    const RadientDrawListCache::Key Key{&Source, 0x1u, 0};
+
+    bool IsValid = true;
+    {
+        RadientDrawListCache::Entry& Entry = Cache.Get(Key, 0, IsValid);
+        EXPECT_FALSE(IsValid);
+        EXPECT_TRUE(Entry.DrawableIDs.empty());
+        Entry.DrawableIDs = {3, 1, 2};
+    }
+
+    Uint64 BuildID = 0;
+    {
+        RadientDrawListCache::Entry& Entry = Cache.Get(Key, 0, IsValid);
+        EXPECT_TRUE(IsValid);
+        EXPECT_EQ(Entry.DrawableIDs, (IDList{3, 1, 2}));
+        BuildID = Entry.BuildID;
+    }
+    EXPECT_EQ(Cache.GetEntryCount(), 1u);
+
+    Cache.Invalidate();
+    {
+        RadientDrawListCache::Entry& Entry = Cache.Get(Key, 0, IsValid);
+        EXPECT_FALSE(IsValid);
+        EXPECT_TRUE(Entry.DrawableIDs.empty());
+        EXPECT_NE(Entry.BuildID, BuildID);
+        Entry.DrawableIDs = {4};
+    }
+
+    Cache.Get(Key, 0, IsValid);
+    EXPECT_TRUE(IsValid);
+}
+
+TEST(RadientDrawListCacheTest, ListsAreKeyedBySourceMaskAndStage)
+{
+    RadientDrawListCache Cache;
+
+    int Source0 = 0;
+    int Source1 = 0;
+
+    const RadientDrawListCache::Key Keys[] =
+        {
+            {&Source0, 0x1u, 0},
+            {&Source0, 0x2u, 0},
+            {&Source0, 0x1u, 1},
+            {&Source1, 0x1u, 0},
+        };
+
+    bool IsValid = true;
+    for (Uint32 i = 0; i < _countof(Keys); ++i)
+    {
+        RadientDrawListCache::Entry& Entry = Cache.Get(Keys[i], 0, IsValid);
+        EXPECT_FALSE(IsValid) << "i = " << i;
+        Entry.DrawableIDs = {i};
+    }
+    EXPECT_EQ(Cache.GetEntryCount(), _countof(Keys));
+
+    // Views with the same key share the list; views with other masks keep their own
+    for (Uint32 i = 0; i < _countof(Keys); ++i)
+    {
+        const RadientDrawListCache::Entry& Entry = Cache.Get(Keys[i], 0, IsValid);
+        EXPECT_TRUE(IsValid) << "i = " << i;
+        EXPECT_EQ(Entry.DrawableIDs, IDList{i}) << "i = " << i;
+    }
+}
+
+TEST(RadientDrawListCacheTest, DependencyAndIncompleteListsForceRebuild)
+{
+    RadientDrawListCache Cache;
+
+    int                             Source = 0;
+    const RadientDrawListCache::Key Key{&Source, ~Uint64{0}, 0};
+
+    bool IsValid = true;
+    Cache.Get(Key, 1, IsValid);
+    EXPECT_FALSE(IsValid);
+
+    Cache.Get(Key, 1, IsValid);
+    EXPECT_TRUE(IsValid);
+
+    // E.g. the main pass list after the depth pre-pass list was rebuilt
+    Cache.Get(Key, 2, IsValid);
+    EXPECT_FALSE(IsValid);
+
+    // E.g. some pipelines were not ready when the list was built
+    Cache.Get(Key, 2, IsValid).IsComplete = false;
+    Cache.Get(Key, 2, IsValid);
+    EXPECT_FALSE(IsValid);
+
+    Cache.Get(Key, 2, IsValid);
+    EXPECT_TRUE(IsValid);
+}
+
+TEST(RadientDrawListCacheTest, EntryCountIsLimited)
+{
+    RadientDrawListCache Cache;
+
+    int  Source  = 0;
+    bool IsValid = true;
+    for (Uint64 Mask = 1; Mask <= RadientDrawListCache::MaxEntryCount; ++Mask)
+        Cache.Get({&Source, Mask, 0}, 0, IsValid);
+    EXPECT_EQ(Cache.GetEntryCount(), RadientDrawListCache::MaxEntryCount);
+
+    Cache.Get({&Source, 1, 0}, 0, IsValid);
+    EXPECT_TRUE(IsValid);
+
+    // A new key drops the lists of the views that are no longer rendered
+    Cache.Get({&Source, RadientDrawListCache::MaxEntryCount + 1, 0}, 0, IsValid);
+    EXPECT_FALSE(IsValid);
+    EXPECT_EQ(Cache.GetEntryCount(), 1u);
+
+    Cache.Get({&Source, 1, 0}, 0, IsValid);
+    EXPECT_FALSE(IsValid);
+}
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientDrawRecordAllocator.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 TestBufferSize      = 1024;
+constexpr Uint32 TestOffsetAlignment = 256;
+constexpr Uint32 TestRangeSize       = 200;
+
+} // namespace
+
+TEST(RadientDrawRecordAllocatorTest, RecordOffsetsAreAligned)
+{
+    RadientDrawRecordAllocator Allocator;
+    // No buffer
+    EXPECT_EQ(Allocator.Allocate(16), RadientDrawRecordAllocator::InvalidOffset);
+
+    Allocator.Reset(TestBufferSize, TestOffsetAlignment, TestRangeSize);
+    EXPECT_EQ(Allocator.Allocate(100), 0u);
+    EXPECT_EQ(Allocator.Allocate(16), TestOffsetAlignment);
+    EXPECT_EQ(Allocator.Allocate(TestOffsetAlignment + 8), 2 * TestOffsetAlignment);
+    EXPECT_EQ(Allocator.GetRecordCount(), 3u);
+    EXPECT_EQ(Allocator.GetBatchSize(), 3 * TestOffsetAlignment + 8);
+}
+
+TEST(RadientDrawRecordAllocatorTest, RangeMustFitAtRecordOffset)
+{
+    RadientDrawRecordAllocator Allocator;
+    Allocator.Reset(TestBufferSize, TestOffsetAlignment, TestRangeSize);
+
+    // 1024 bytes hold four ranges
+    for (Uint32 i = 0; i < 4; ++i)
+        EXPECT_EQ(Allocator.Allocate(16), i * TestOffsetAlignment);
+    EXPECT_EQ(Allocator.Allocate(16), RadientDrawRecordAllocator::InvalidOffset);
+    EXPECT_EQ(Allocator.GetRecordCount(), 4u);
+
+    // The last range is shorter than the alignment, but a 16-byte record still needs the full range
+    Allocator.Reset(3 * TestOffsetAlignment + TestRangeSize - 1, TestOffsetAlignment, TestRangeSize);
+    for (Uint32 i = 0; i < 3; ++i)
+        EXPECT_EQ(Allocator.Allocate(16), i * TestOffsetAlignment);
+    EXPECT_EQ(Allocator.Allocate(16), RadientDrawRecordAllocator::InvalidOffset);
+}
+
+TEST(RadientDrawRecordAllocatorTest, RestartBeginsNewBatch)
+{
+    RadientDrawRecordAllocator Allocator;
+    Allocator.Reset(TestBufferSize, TestOffsetAlignment, TestRangeSize);
+
+    while (Allocator.Allocate(64) != RadientDrawRecordAllocator::InvalidOffset)
+        ;
+    EXPECT_EQ(Allocator.GetRecordCount(), 4u);
+
+    Allocator.Restart();
+    EXPECT_EQ(Allocator.GetRecordCount(), 0u);
+    EXPECT_EQ(Allocator.GetBatchSize(), 0u);
+    EXPECT_EQ(Allocator.Allocate(64), 0u);
+
+    // A record that does not fit into an empty batch is never allocated
+    Allocator.Restart();
+    EXPECT_EQ(Allocator.Allocate(TestBufferSize + 1), RadientDrawRecordAllocator::InvalidOffset);
+    EXPECT_EQ(Allocator.GetRecordCount(), 0u);
+
+    // Reset drops the current batch
+    EXPECT_EQ(Allocator.Allocate(64), 0u);
+    Allocator.Reset(TestBufferSize, 64, 64);
+    EXPECT_EQ(Allocator.GetBatchSize(), 0u);
+    for (Uint32 i = 0; i < TestBufferSize / 64; ++i)
+        EXPECT_EQ(Allocator.Allocate(64), i * 64);
+    EXPECT_EQ(Allocator.Allocate(1), RadientDrawRecordAllocator::InvalidOffset);
+}
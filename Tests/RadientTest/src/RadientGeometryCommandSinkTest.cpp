@@ -0,0 +1,621 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "gtest/gtest.h"
+
+#include "Assets/RadientDrawableMeshConverter.hpp"
+#include "Math/RadientMath.hpp"
+#include "Render/Passes/RadientGeometryPass.hpp"
+#include "Render/RadientSceneDrawableCache.hpp"
+#include "Scene/RadientSceneImpl.hpp"
+#include "Scene/RadientSceneWriterImpl.hpp"
+#include "RadientTestAssetHelpers.hpp"
+
+#include <initializer_list>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+IVertexPool* const TestVertexPool = reinterpret_cast<IVertexPool*>(size_t{1});
+
+class TestDrawableMeshProvider final : public IRadientDrawableMeshProvider
+{
+public:
+    void RegisterMesh(IRadientMeshAsset* pMesh, GLTF::Model& Model)
+    {
+        RadientDrawableMesh& Mesh = Meshes[pMesh];
+        Mesh.Geometries.push_back(RadientDrawableMeshGeometry{TestVertexPool, PBR_Renderer::PSO_FLAG_USE_VERTEX_NORMALS, 0, 0});
+        EXPECT_EQ(ConvertGLTFDrawableMeshPrimitives(Model.Meshes[0].Primitives, Model.Materials, Mesh.Primitives), RADIENT_STATUS_OK);
+    }
+
+    RadientDrawableMeshResolveResult GetDrawableMesh(IRadientMeshAsset* pMesh) override final
+    {
+        const auto MeshIt = Meshes.find(pMesh);
+        if (MeshIt == Meshes.end())
+        {
+            ADD_FAILURE() << "Mesh asset must be registered with the test mesh provider";
+            return {};
+        }
+        return {&MeshIt->second, RADIENT_STATUS_OK};
+    }
+
+    std::unordered_map<IRadientMeshAsset*, RadientDrawableMesh> Meshes;
+};
+
+// Three opaque primitives that use two pipeline states, one alpha-tested and one alpha-blended primitive
+void InitTestModel(GLTF::Model& Model)
+{
+    Model.Materials.resize(4);
+    Model.Materials[0].Attribs.AlphaMode = GLTF::Material::ALPHA_MODE_OPAQUE;
+    Model.Materials[1].Attribs.AlphaMode = GLTF::Material::ALPHA_MODE_OPAQUE;
+    Model.Materials[1].DoubleSided       = true;
+    Model.Materials[2].Attribs.AlphaMode = GLTF::Material::ALPHA_MODE_MASK;
+    Model.Materials[3].Attribs.AlphaMode = GLTF::Material::ALPHA_MODE_BLEND;
+
+    const float3 BoundsMin{-1.f, -1.f, -1.f};
+    const float3 BoundsMax{+1.f, +1.f, +1.f};
+
+    Model.Meshes.resize(1);
+    std::vector<GLTF::Primitive>& Primitives = Model.Meshes[0].Primitives;
+    Primitives.emplace_back(GLTF::Primitive{0, 3, 0, 0, 0, BoundsMin, BoundsMax});
+    Primitives.emplace_back(GLTF::Primitive{3, 6, 0, 0, 1, BoundsMin, BoundsMax});
+    Primitives.emplace_back(GLTF::Primitive{0, 0, 12, 4, 0, BoundsMin, BoundsMax});
+    Primitives.emplace_back(GLTF::Primitive{9, 3, 0, 0, 2, BoundsMin, BoundsMax});
+    Primitives.emplace_back(GLTF::Primitive{12, 3, 0, 0, 3, BoundsMin, BoundsMax});
+}
+
+RadientEntityID AddRenderableEntity(IRadientSceneWriter& Writer,
+                                    IRadientMeshAsset*   pMesh,
+                                    float                Depth,
+                                    bool                 CastShadows = true)
+{
+    RadientEntityDesc Desc;
+    Desc.Transform.Position = {0, 0, Depth};
+
+    RadientEntityID Entity = InvalidRadientEntityID;
+    EXPECT_EQ(Writer.CreateEntity(Desc, Entity), RADIENT_STATUS_OK);
+
+    RadientMeshComponent Mesh{};
+    Mesh.pMesh = pMesh;
+    EXPECT_EQ(Writer.SetMesh(Entity, Mesh), RADIENT_STATUS_OK);
+
+    RadientMeshRendererComponent Renderer{};
+    Renderer.CastShadows = CastShadows ? True : False;
+    EXPECT_EQ(Writer.SetMeshRenderer(Entity, Renderer), RADIENT_STATUS_OK);
+    EXPECT_EQ(Writer.CommitChanges(), RADIENT_STATUS_OK);
+
+    return Entity;
+}
+
+RadientShadowCascadeDesc MakeShadowDesc(Uint32 CascadeCount)
+{
+    RadientShadowCascadeDesc ShadowDesc;
+    ShadowDesc.CascadeCount = CascadeCount;
+    return ShadowDesc;
+}
+
+class HeadlessSceneFixture
+{
+public:
+    HeadlessSceneFixture() :
+        DrawableCache{&MeshProvider},
+        pScene{RadientSceneImpl::Create()},
+        pWriter{RadientSceneWriterImpl::Create(pScene)},
+        pMesh{MakeTestMeshAsset("mesh://headless-geometry-pass-test", 1)}
+    {
+        InitTestModel(Model);
+        MeshProvider.RegisterMesh(pMesh, Model);
+
+        // Camera at the origin looking along +Z
+        RadientEntityDesc CameraDesc;
+        CameraDesc.Transform.Rotation = {0.f, 1.f, 0.f, 0.f};
+        EXPECT_EQ(pWriter->CreateEntity(CameraDesc, Camera), RADIENT_STATUS_OK);
+        EXPECT_EQ(pWriter->SetCamera(Camera, RadientCameraComponent{}), RADIENT_STATUS_OK);
+
+        // Shadow-casting sun pointing straight down
+        RadientEntityDesc LightDesc;
+        LightDesc.Transform.Rotation = {-0.70710678f, 0.f, 0.f, 0.70710678f};
+        RadientEntityID Light        = InvalidRadientEntityID;
+        EXPECT_EQ(pWriter->CreateEntity(LightDesc, Light), RADIENT_STATUS_OK);
+
+        RadientLightComponent LightComponent;
+        LightComponent.Type        = RADIENT_LIGHT_TYPE_DIRECTIONAL;
+        LightComponent.CastShadows = True;
+        EXPECT_EQ(pWriter->SetLight(Light, LightComponent), RADIENT_STATUS_OK);
+        EXPECT_EQ(pWriter->CommitChanges(), RADIENT_STATUS_OK);
+    }
+
+    // Same steps as RadientRenderPipeline::Update() with the null backend
+    void Sync(RadientGeometryRenderer& Renderer, RadientGeometryPass& Pass, RadientGeometryCommandLogSink& Sink, RadientCommandLog& Log)
+    {
+        Log.Clear();
+        Log.BeginPass("Scene sync");
+        EXPECT_TRUE(RADIENT_SUCCEEDED(DrawableCache.SyncScene(*pScene)));
+        pScene->ClearPendingRenderChanges();
+        Pass.Prepare(Renderer, DrawableCache, Sink);
+        Sink.CommitMaterialTable(Renderer.GetMaterialTable());
+        Log.EndPass();
+    }
+
+    // Same passes as RadientRenderPipeline::RecordHeadlessViews()
+    void RecordView(RadientGeometryRenderer&       Renderer,
+                    RadientGeometryPass&           Pass,
+                    RadientGeometryCommandLogSink& Sink,
+                    RadientCommandLog&             Log,
+                    Uint64                         LayerMask,
+                    Uint32                         ViewIndex)
+    {
+        const RadientDrawLists& DrawLists = DrawableCache.GetDrawLists();
+
+        RadientViewDesc ViewDesc;
+        ViewDesc.pScene    = pScene;
+        ViewDesc.Camera    = Camera;
+        ViewDesc.LayerMask = LayerMask;
+        Pass.PrepareViewDrawables(DrawLists, DrawableCache, ViewDesc, DepthPlane, View);
+        Pass.SortViewDrawables(View);
+
+        Renderer.BeginHeadlessView(DrawableCache.GetLightList(), ViewDesc, Targets);
+
+        Log.BeginPass("View constants", ViewIndex);
+        Sink.WriteFrameAttribs(Renderer.GetSettings());
+        Log.EndPass();
+
+        if (Renderer.GetShadowDesc().CascadeCount > 0)
+        {
+            Log.BeginPass("Shadow", ViewIndex);
+            Pass.RecordShadowPass(Renderer, DrawLists, DrawableCache, View);
+            Log.EndPass();
+        }
+
+        if (Pass.IsDepthPrepassEnabled())
+        {
+            Log.BeginPass("Depth prepass", ViewIndex);
+            Pass.RecordDepthPrepass(Renderer, View);
+            Log.EndPass();
+        }
+
+        Log.BeginPass("Opaque", ViewIndex);
+        Pass.Record(Renderer, DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_OPAQUE), DrawableCache, View);
+        Log.EndPass();
+
+        Log.BeginPass("Mask", ViewIndex);
+        Pass.Record(Renderer, DrawLists.GetDrawList(GLTF::Material::ALPHA_MODE_MASK), DrawableCache, View);
+        Log.EndPass();
+
+        Log.BeginPass("Blend", ViewIndex);
+        Pass.RecordBlend(Renderer, View);
+        Log.EndPass();
+    }
+
+    float GetViewDepth(Uint64 DrawableID) const
+    {
+        const RadientDrawableSlot* pDrawable = DrawableCache.GetDrawableSlot(static_cast<RadientDrawableID>(DrawableID));
+        return RadientDepthSorter::GetViewDepth(DepthPlane, *pDrawable->pWorldMatrix, pDrawable->LocalBounds);
+    }
+
+    // Shadow draws of the test model entities at the given positions: one per opaque and alpha-tested
+    // primitive in every cascade the entity overlaps, see RadientShadowCascades::IsCasterVisible()
+    static Uint32 GetShadowDrawCount(const RadientGeometryRenderer& Renderer, std::initializer_list<RadientFloat3> Positions)
+    {
+        const RadientShadowCascades& Cascades = Renderer.GetShadowCascades();
+        const RadientBounds          Bounds{{-1.f, -1.f, -1.f}, {+1.f, +1.f, +1.f}};
+
+        Uint32 DrawCount = 0;
+        for (Uint32 Cascade = 0; Cascade < Cascades.GetCascadeCount(); ++Cascade)
+        {
+            for (const RadientFloat3& Position : Positions)
+            {
+                RadientTransform Transform;
+                Transform.Position = Position;
+                if (Cascades.IsCasterVisible(Cascade, RadientMath::TransformToMatrix(Transform), Bounds))
+                    DrawCount += 4;
+            }
+        }
+        return DrawCount;
+    }
+
+    GLTF::Model                        Model;
+    TestDrawableMeshProvider           MeshProvider;
+    RadientSceneDrawableCache          DrawableCache;
+    RefCntAutoPtr<RadientSceneImpl>    pScene;
+    RefCntAutoPtr<IRadientSceneWriter> pWriter;
+    RefCntAutoPtr<IRadientMeshAsset>   pMesh;
+
+    RadientEntityID           Camera = InvalidRadientEntityID;
+    RadientFrameRenderTargets Targets;
+
+    // View depth plane of the camera
+    const RadientFloat4 DepthPlane = RadientDepthSorter::GetDepthPlane({0, 0, 0}, {0, 0, 1});
+
+    RadientGeometryViewDrawables View;
+};
+
+class HeadlessRenderer
+{
+public:
+    HeadlessRenderer(Uint32 CascadeCount, bool EnableDepthPrepass) :
+        Renderer{MakeShadowDesc(CascadeCount)},
+        Pass{/*EnableAsyncPipelineCompilation = */ true, EnableDepthPrepass},
+        Sink{Log}
+    {
+        Renderer.PrepareHeadless(RadientGeometryCommandLogSink::PrimitiveAttribsBufferSize,
+                                 RadientGeometryCommandLogSink::ConstantBufferOffsetAlignment);
+    }
+
+    void Sync(HeadlessSceneFixture& Scene)
+    {
+        Scene.Sync(Renderer, Pass, Sink, Log);
+    }
+
+    void RecordView(HeadlessSceneFixture& Scene, Uint64 LayerMask, Uint32 ViewIndex)
+    {
+        Scene.RecordView(Renderer, Pass, Sink, Log, LayerMask, ViewIndex);
+    }
+
+    // Identity of the main pass pipeline state of the drawable, see RadientGeometryCommandLogSink::GetPipelineState()
+    Uint64 GetMainPSO(const HeadlessSceneFixture& Scene, Uint64 DrawableID)
+    {
+        const RadientDrawableSlot* pDrawable = Scene.DrawableCache.GetDrawableSlot(static_cast<RadientDrawableID>(DrawableID));
+        if (pDrawable == nullptr || pDrawable->pMaterial == nullptr)
+            return 0;
+
+        const PBR_Renderer::PSOKey PsoKey = GetRadientMainPassPSOKey(Renderer.GetSettings(), Renderer.GetBaseRenderFlags(),
+                                                                     pDrawable->VertexAttribFlags, *pDrawable->pMaterial);
+        return RadientGeometryCommandLogSink::GetPipelineStateID(Sink.GetPipelineState(RadientGeometryPipelineType::Main, PsoKey));
+    }
+
+    RadientGeometryRenderer       Renderer;
+    RadientGeometryPass           Pass;
+    RadientCommandLog             Log;
+    RadientGeometryCommandLogSink Sink;
+};
+
+std::vector<RadientCommand> GetPassCommands(const RadientCommandLog& Log, const char* Name, Uint32 ViewIndex)
+{
+    std::vector<RadientCommand>        Commands;
+    const RadientCommandLog::PassInfo* pPass = Log.FindPass(Name, ViewIndex);
+    EXPECT_NE(pPass, nullptr) << Name;
+    if (pPass != nullptr)
+        Commands.assign(Log.GetCommands().begin() + pPass->FirstCommand, Log.GetCommands().begin() + pPass->FirstCommand + pPass->CommandCount);
+    return Commands;
+}
+
+Uint32 CountCommands(const std::vector<RadientCommand>& Commands, RadientCommandType Type)
+{
+    Uint32 Count = 0;
+    for (const RadientCommand& Command : Commands)
+        Count += Command.Type == Type ? 1 : 0;
+    return Count;
+}
+
+bool IsDrawCommand(const RadientCommand& Command)
+{
+    return Command.Type == RadientCommandType::Draw || Command.Type == RadientCommandType::DrawIndexed || Command.Type == RadientCommandType::DrawIndexedIndirect;
+}
+
+} // namespace
+
+TEST(RadientCommandLogTest, GroupsCommandsByPass)
+{
+    RadientCommandLog Log;
+
+    Log.BeginPass("First", 0);
+    Log.SetPipelineState(1);
+    Log.SetVertexBuffers(2);
+    Log.SetMaterial(256);
+    Log.WriteBuffer(3, 0, 512);
+    Log.DrawIndexed(7, 0, 3);
+    Log.Draw(8, 4, 6);
+    Log.EndPass();
+
+    Log.BeginPass("Second");
+    Log.WriteBuffer(3, 0, 128);
+    Log.WriteBuffer(4, 256, 64);
+    Log.EndPass();
+
+    ASSERT_EQ(Log.GetPasses().size(), 2u);
+    ASSERT_EQ(Log.GetCommands().size(), 8u);
+
+    const RadientCommandLog::PassInfo* pFirst = Log.FindPass("First", 0);
+    ASSERT_NE(pFirst, nullptr);
+    EXPECT_EQ(pFirst->FirstCommand, 0u);
+    EXPECT_EQ(pFirst->CommandCount, 6u);
+    EXPECT_EQ(pFirst->DrawCount, 2u);
+    EXPECT_EQ(pFirst->StateChangeCount, 3u);
+    EXPECT_EQ(pFirst->BufferWriteSize, 512u);
+    EXPECT_GE(pFirst->CPUTime, 0.0);
+
+    const RadientCommandLog::PassInfo* pSecond = Log.FindPass("Second");
+    ASSERT_NE(pSecond, nullptr);
+    EXPECT_EQ(pSecond->ViewIndex, RadientCommandLog::InvalidViewIndex);
+    EXPECT_EQ(pSecond->FirstCommand, 6u);
+    EXPECT_EQ(pSecond->DrawCount, 0u);
+    EXPECT_EQ(pSecond->BufferWriteSize, 192u);
+    EXPECT_EQ(Log.GetCommands()[7].Pass, 1u);
+
+    EXPECT_EQ(Log.FindPass("First"), nullptr);
+    EXPECT_EQ(Log.GetCommandCount(RadientCommandType::WriteBuffer), 3u);
+    EXPECT_EQ(Log.GetCommandCount(RadientCommandType::DrawIndexed), 1u);
+
+    Log.Clear();
+    EXPECT_TRUE(Log.GetPasses().empty());
+    EXPECT_TRUE(Log.GetCommands().empty());
+}
+
+TEST(RadientGeometryCommandLogSinkTest, RecordsIndirectDraws)
+{
+    RadientCommandLog             Log;
+    RadientGeometryCommandLogSink Sink{Log};
+
+    IBuffer* const pDrawArgs   = reinterpret_cast<IBuffer*>(size_t{5});
+    IBuffer* const pDrawCounts = reinterpret_cast<IBuffer*>(size_t{6});
+
+    Log.BeginPass("Opaque", 0);
+    Sink.DrawIndexedIndirect(pDrawArgs, 0, 16, pDrawCounts, 0);
+    Sink.DrawIndexedIndirect(pDrawArgs, 320, 4, pDrawCounts, 4);
+    Log.EndPass();
+
+    ASSERT_EQ(Log.GetCommands().size(), 2u);
+    EXPECT_EQ(Log.GetCommandCount(RadientCommandType::DrawIndexedIndirect), 2u);
+
+    const RadientCommand& Command = Log.GetCommands()[1];
+    EXPECT_EQ(Command.Object, 5u);
+    EXPECT_EQ(Command.Offset, 320u);
+    EXPECT_EQ(Command.Size, 4u);
+
+    const RadientCommandLog::PassInfo* pPass = Log.FindPass("Opaque", 0);
+    ASSERT_NE(pPass, nullptr);
+    EXPECT_EQ(pPass->DrawCount, 2u);
+}
+
+TEST(RadientGeometryCommandLogSinkTest, RecordsAllStages)
+{
+    HeadlessSceneFixture Scene;
+    for (const float Depth : {30.f, 10.f, 40.f, 20.f})
+        AddRenderableEntity(*Scene.pWriter, Scene.pMesh, Depth);
+
+    HeadlessRenderer   Headless{2, /*EnableDepthPrepass = */ true};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+
+    // Every material is uploaded once per PSO flags it is packed for
+    const RadientMaterialTable&        MaterialTable = Headless.Renderer.GetMaterialTable();
+    const RadientCommandLog::PassInfo* pSync         = Log.FindPass("Scene sync");
+    ASSERT_NE(pSync, nullptr);
+    EXPECT_EQ(pSync->BufferWriteSize, MaterialTable.GetSlotCount() * MaterialTable.GetSlotStride());
+    EXPECT_GT(pSync->BufferWriteSize, 0u);
+
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+    ASSERT_EQ(Headless.Renderer.GetShadowCascades().GetCascadeCount(), 2u);
+
+    const RadientCommandLog::PassInfo* pConstants = Log.FindPass("View constants", 0);
+    ASSERT_NE(pConstants, nullptr);
+    EXPECT_GT(pConstants->BufferWriteSize, 0u);
+
+    // Blended primitives do not cast shadows and do not take part in the depth pre-pass
+    struct ExpectedPass
+    {
+        const char* Name;
+        Uint32      DrawCount;
+    };
+    const ExpectedPass ExpectedPasses[] = {
+        {"Shadow", HeadlessSceneFixture::GetShadowDrawCount(Headless.Renderer, {{0, 0, 30}, {0, 0, 10}, {0, 0, 40}, {0, 0, 20}})},
+        {"Depth prepass", 4 * 4},
+        {"Opaque", 3 * 4},
+        {"Mask", 4},
+        {"Blend", 4},
+    };
+    for (const ExpectedPass& Expected : ExpectedPasses)
+    {
+        const RadientCommandLog::PassInfo* pPass = Log.FindPass(Expected.Name, 0);
+        ASSERT_NE(pPass, nullptr) << Expected.Name;
+        EXPECT_EQ(pPass->DrawCount, Expected.DrawCount) << Expected.Name;
+        EXPECT_GT(pPass->BufferWriteSize, 0u) << Expected.Name;
+        EXPECT_GE(pPass->CPUTime, 0.0) << Expected.Name;
+    }
+
+    // One non-indexed opaque primitive per entity
+    EXPECT_EQ(CountCommands(GetPassCommands(Log, "Opaque", 0), RadientCommandType::Draw), 4u);
+    EXPECT_EQ(CountCommands(GetPassCommands(Log, "Opaque", 0), RadientCommandType::DrawIndexed), 8u);
+}
+
+TEST(RadientGeometryCommandLogSinkTest, SortsByState)
+{
+    HeadlessSceneFixture Scene;
+    for (Uint32 i = 0; i < 8; ++i)
+        AddRenderableEntity(*Scene.pWriter, Scene.pMesh, static_cast<float>(10 + i));
+
+    HeadlessRenderer   Headless{0, /*EnableDepthPrepass = */ false};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+
+    EXPECT_EQ(Log.FindPass("Shadow", 0), nullptr);
+    EXPECT_EQ(Log.FindPass("Depth prepass", 0), nullptr);
+
+    // Single-sided and double-sided opaque primitives use two pipeline states that are bound once each
+    const std::vector<RadientCommand> Commands = GetPassCommands(Log, "Opaque", 0);
+    EXPECT_EQ(CountCommands(Commands, RadientCommandType::SetPipelineState), 2u);
+    EXPECT_EQ(CountCommands(Commands, RadientCommandType::SetVertexBuffers), 1u);
+    EXPECT_EQ(CountCommands(Commands, RadientCommandType::SetMaterial), 2u);
+    EXPECT_EQ(Log.FindPass("Opaque", 0)->StateChangeCount, 5u);
+
+    // Draws follow the pipeline state they are recorded with
+    Uint64 CurrPSO = 0;
+    for (const RadientCommand& Command : Commands)
+    {
+        if (Command.Type == RadientCommandType::SetPipelineState)
+            CurrPSO = Command.Object;
+        else if (IsDrawCommand(Command))
+            EXPECT_EQ(Headless.GetMainPSO(Scene, Command.Object), CurrPSO);
+    }
+}
+
+TEST(RadientGeometryCommandLogSinkTest, SortsByDepth)
+{
+    HeadlessSceneFixture Scene;
+    for (const float Depth : {30.f, 10.f, 80.f, 20.f, 5.f, 160.f})
+        AddRenderableEntity(*Scene.pWriter, Scene.pMesh, Depth);
+
+    HeadlessRenderer   Headless{0, /*EnableDepthPrepass = */ true};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+
+    // Blended primitives are drawn back to front
+    float PrevDepth = std::numeric_limits<float>::max();
+    for (const RadientCommand& Command : GetPassCommands(Log, "Blend", 0))
+    {
+        if (!IsDrawCommand(Command))
+            continue;
+        const float Depth = Scene.GetViewDepth(Command.Object);
+        EXPECT_LE(Depth, PrevDepth);
+        PrevDepth = Depth;
+    }
+
+    // The depth pre-pass is drawn front to back by depth buckets
+    Uint32 PrevBucket = 0;
+    for (const RadientCommand& Command : GetPassCommands(Log, "Depth prepass", 0))
+    {
+        if (!IsDrawCommand(Command))
+            continue;
+        const Uint32 Bucket = RadientDepthSorter::GetFrontToBackKey(Scene.GetViewDepth(Command.Object));
+        EXPECT_GE(Bucket, PrevBucket);
+        PrevBucket = Bucket;
+    }
+
+    // Opaque primitives rendered by the pre-pass use early-Z pipeline states
+    Uint64 CurrPSO = 0;
+    for (const RadientCommand& Command : GetPassCommands(Log, "Opaque", 0))
+    {
+        if (Command.Type == RadientCommandType::SetPipelineState)
+            CurrPSO = Command.Object;
+        else if (IsDrawCommand(Command))
+            EXPECT_NE(Headless.GetMainPSO(Scene, Command.Object), CurrPSO);
+    }
+}
+
+TEST(RadientGeometryCommandLogSinkTest, SplitsPrimitiveRecordsIntoBatches)
+{
+    HeadlessSceneFixture Scene;
+    constexpr Uint32     EntityCount = 200;
+    for (Uint32 i = 0; i < EntityCount; ++i)
+        AddRenderableEntity(*Scene.pWriter, Scene.pMesh, static_cast<float>(i));
+
+    HeadlessRenderer   Headless{0, /*EnableDepthPrepass = */ false};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+
+    const std::vector<RadientCommand> Commands = GetPassCommands(Log, "Opaque", 0);
+    EXPECT_EQ(Log.FindPass("Opaque", 0)->DrawCount, EntityCount * 3);
+
+    // Every batch is written before its draws and fits into the buffer
+    Uint32 BatchCount = 0;
+    Uint32 BatchDraws = 0;
+    for (const RadientCommand& Command : Commands)
+    {
+        if (Command.Type == RadientCommandType::WriteBuffer)
+        {
+            EXPECT_EQ(Command.Object, RadientGeometryCommandLogSink::PrimitiveAttribsBufferID);
+            EXPECT_LE(Command.Size, RadientGeometryCommandLogSink::PrimitiveAttribsBufferSize);
+            EXPECT_TRUE(BatchCount == 0 || BatchDraws > 0);
+            ++BatchCount;
+            BatchDraws = 0;
+        }
+        else if (IsDrawCommand(Command))
+        {
+            EXPECT_GT(BatchCount, 0u);
+            ++BatchDraws;
+        }
+    }
+    EXPECT_GT(BatchCount, 1u);
+}
+
+TEST(RadientGeometryCommandLogSinkTest, AppliesDrawableChanges)
+{
+    HeadlessSceneFixture  Scene;
+    const RadientEntityID Entity = AddRenderableEntity(*Scene.pWriter, Scene.pMesh, 10.f);
+    AddRenderableEntity(*Scene.pWriter, Scene.pMesh, 20.f, /*CastShadows = */ false);
+
+    HeadlessRenderer   Headless{1, /*EnableDepthPrepass = */ false};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+    EXPECT_EQ(Log.FindPass("Shadow", 0)->DrawCount, HeadlessSceneFixture::GetShadowDrawCount(Headless.Renderer, {{0, 0, 10}}));
+    EXPECT_GT(Log.FindPass("Shadow", 0)->DrawCount, 0u);
+    EXPECT_EQ(Log.FindPass("Opaque", 0)->DrawCount, 6u);
+
+    const Uint32 SlotCount = Headless.Renderer.GetMaterialTable().GetUsedSlotCount();
+
+    // Materials are only uploaded when they change
+    EXPECT_EQ(Scene.pWriter->DestroyEntity(Entity), RADIENT_STATUS_OK);
+    EXPECT_EQ(Scene.pWriter->CommitChanges(), RADIENT_STATUS_OK);
+    Headless.Sync(Scene);
+    EXPECT_EQ(Log.FindPass("Scene sync")->BufferWriteSize, 0u);
+    EXPECT_EQ(Headless.Renderer.GetMaterialTable().GetUsedSlotCount(), SlotCount);
+
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+    EXPECT_EQ(Log.FindPass("Shadow", 0)->DrawCount, 0u);
+    EXPECT_EQ(Log.FindPass("Opaque", 0)->DrawCount, 3u);
+    EXPECT_EQ(Log.FindPass("Blend", 0)->DrawCount, 1u);
+
+    // Views only draw the renderers that share a bit with their layer mask
+    Headless.RecordView(Scene, 0, 1);
+    EXPECT_EQ(Log.FindPass("Opaque", 1)->DrawCount, 0u);
+    EXPECT_EQ(Log.FindPass("Blend", 1)->DrawCount, 0u);
+}
+
+TEST(RadientGeometryCommandLogSinkTest, CullsShadowCastersPerCascade)
+{
+    HeadlessSceneFixture Scene;
+    AddRenderableEntity(*Scene.pWriter, Scene.pMesh, 20.f);
+    const RadientEntityID Far = AddRenderableEntity(*Scene.pWriter, Scene.pMesh, 20.f);
+
+    // Far outside of the camera frustum and of every cascade
+    RadientTransform FarTransform;
+    FarTransform.Position = {10000.f, 0.f, 20.f};
+    EXPECT_EQ(Scene.pWriter->SetLocalTransform(Far, FarTransform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Scene.pWriter->CommitChanges(), RADIENT_STATUS_OK);
+
+    HeadlessRenderer   Headless{4, /*EnableDepthPrepass = */ false};
+    RadientCommandLog& Log = Headless.Log;
+    Headless.Sync(Scene);
+    Headless.RecordView(Scene, ~Uint64{0}, 0);
+    ASSERT_EQ(Headless.Renderer.GetShadowCascades().GetCascadeCount(), 4u);
+
+    const Uint32 NearDrawCount = HeadlessSceneFixture::GetShadowDrawCount(Headless.Renderer, {{0.f, 0.f, 20.f}});
+    EXPECT_GT(NearDrawCount, 0u);
+    EXPECT_EQ(HeadlessSceneFixture::GetShadowDrawCount(Headless.Renderer, {FarTransform.Position}), 0u);
+    EXPECT_EQ(Log.FindPass("Shadow", 0)->DrawCount, NearDrawCount);
+}
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/Passes/RadientGeometryPass.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr PBR_Renderer::PSO_FLAGS MainPassFlags =
+    PBR_Renderer::PSO_FLAG_USE_VERTEX_NORMALS |
+    PBR_Renderer::PSO_FLAG_USE_TEXCOORD0 |
+    PBR_Renderer::PSO_FLAG_USE_JOINTS |
+    PBR_Renderer::PSO_FLAG_USE_COLOR_MAP |
+    PBR_Renderer::PSO_FLAG_USE_NORMAL_MAP |
+    PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS |
+    PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM |
+    PBR_Renderer::PSO_FLAG_CONVERT_OUTPUT_TO_SRGB |
+    PBR_Renderer::PSO_FLAG_USE_IBL |
+    PBR_Renderer::PSO_FLAG_USE_LIGHTS;
+
+PBR_Renderer::PSOKey MakeMainPSOKey(PBR_Renderer::ALPHA_MODE AlphaMode, CULL_MODE CullMode)
+{
+    return PBR_Renderer::PSOKey{PBR_Renderer::RenderPassType::Main, MainPassFlags, AlphaMode, CullMode};
+}
+
+} // namespace
+
+TEST(RadientGeometryPassTest, OpaqueDepthPrepassPSOIsPositionOnly)
+{
+    const PBR_Renderer::PSOKey DepthKey = GetRadientDepthPrepassPSOKey(MakeMainPSOKey(PBR_Renderer::ALPHA_MODE_OPAQUE, CULL_MODE_BACK));
+    EXPECT_EQ(DepthKey.GetType(), PBR_Renderer::RenderPassType::DepthOnly);
+    EXPECT_EQ(DepthKey.GetFlags(), PBR_Renderer::PSO_FLAG_USE_JOINTS);
+    EXPECT_EQ(DepthKey.GetAlphaMode(), PBR_Renderer::ALPHA_MODE_OPAQUE);
+    EXPECT_EQ(DepthKey.GetCullMode(), CULL_MODE_BACK);
+    EXPECT_EQ(DepthKey.GetDebugView(), PBR_Renderer::DebugViewType::None);
+
+    // Double-sided primitives keep their cull mode
+    const PBR_Renderer::PSOKey DoubleSidedKey = GetRadientDepthPrepassPSOKey(MakeMainPSOKey(PBR_Renderer::ALPHA_MODE_OPAQUE, CULL_MODE_NONE));
+    EXPECT_EQ(DoubleSidedKey.GetCullMode(), CULL_MODE_NONE);
+    EXPECT_NE(DoubleSidedKey, DepthKey);
+}
+
+TEST(RadientGeometryPassTest, MaskDepthPrepassPSOKeepsAlphaCutoffInputs)
+{
+    const PBR_Renderer::PSOKey DepthKey = GetRadientDepthPrepassPSOKey(MakeMainPSOKey(PBR_Renderer::ALPHA_MODE_MASK, CULL_MODE_BACK));
+    EXPECT_EQ(DepthKey.GetType(), PBR_Renderer::RenderPassType::DepthOnly);
+    EXPECT_EQ(DepthKey.GetAlphaMode(), PBR_Renderer::ALPHA_MODE_MASK);
+    EXPECT_EQ(DepthKey.GetFlags(),
+              PBR_Renderer::PSO_FLAG_USE_TEXCOORD0 |
+                  PBR_Renderer::PSO_FLAG_USE_JOINTS |
+                  PBR_Renderer::PSO_FLAG_USE_COLOR_MAP |
+                  PBR_Renderer::PSO_FLAG_USE_TEXTURE_ATLAS |
+                  PBR_Renderer::PSO_FLAG_ENABLE_TEXCOORD_TRANSFORM);
+}
+
+TEST(RadientGeometryPassTest, DepthPrepassPSOsAreSharedAcrossMaterials)
+{
+    // Opaque materials that only differ in shading features share the depth-only PSO
+    const PBR_Renderer::PSOKey LitKey{PBR_Renderer::RenderPassType::Main, MainPassFlags, PBR_Renderer::ALPHA_MODE_OPAQUE, CULL_MODE_BACK};
+    const PBR_Renderer::PSOKey UnlitKey{PBR_Renderer::RenderPassType::Main, PBR_Renderer::PSO_FLAG_USE_JOINTS | PBR_Renderer::PSO_FLAG_USE_COLOR_MAP, PBR_Renderer::ALPHA_MODE_OPAQUE, CULL_MODE_BACK};
+    EXPECT_EQ(GetRadientDepthPrepassPSOKey(LitKey), GetRadientDepthPrepassPSOKey(UnlitKey));
+
+    // Blended primitives are never rendered in the pre-pass, but their keys still map to position-only PSOs
+    const PBR_Renderer::PSOKey BlendKey = GetRadientDepthPrepassPSOKey(MakeMainPSOKey(PBR_Renderer::ALPHA_MODE_BLEND, CULL_MODE_BACK));
+    EXPECT_EQ(BlendKey, GetRadientDepthPrepassPSOKey(LitKey));
+}
+
+TEST(RadientGeometryPassTest, DepthPrepassGraphicsDescs)
+{
+    GraphicsPipelineDesc MainDesc;
+    MainDesc.NumRenderTargets                     = 1;
+    MainDesc.RTVFormats[0]                        = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    MainDesc.DSVFormat                            = TEX_FORMAT_D32_FLOAT;
+    MainDesc.PrimitiveTopology                    = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    MainDesc.RasterizerDesc.FrontCounterClockwise = true;
+
+    const GraphicsPipelineDesc DepthDesc = GetRadientDepthPrepassGraphicsDesc(MainDesc);
+    EXPECT_EQ(DepthDesc.NumRenderTargets, 0u);
+    EXPECT_EQ(DepthDesc.RTVFormats[0], TEX_FORMAT_UNKNOWN);
+    EXPECT_EQ(DepthDesc.DSVFormat, MainDesc.DSVFormat);
+    EXPECT_EQ(DepthDesc.PrimitiveTopology, MainDesc.PrimitiveTopology);
+    EXPECT_EQ(DepthDesc.RasterizerDesc, MainDesc.RasterizerDesc);
+    EXPECT_TRUE(DepthDesc.DepthStencilDesc.DepthEnable);
+    EXPECT_TRUE(DepthDesc.DepthStencilDesc.DepthWriteEnable);
+    EXPECT_EQ(DepthDesc.DepthStencilDesc.DepthFunc, COMPARISON_FUNC_LESS);
+
+    const GraphicsPipelineDesc EarlyZDesc = GetRadientEarlyZGraphicsDesc(MainDesc);
+    EXPECT_EQ(EarlyZDesc.NumRenderTargets, MainDesc.NumRenderTargets);
+    EXPECT_EQ(EarlyZDesc.RTVFormats[0], MainDesc.RTVFormats[0]);
+    EXPECT_EQ(EarlyZDesc.DSVFormat, MainDesc.DSVFormat);
+    EXPECT_EQ(EarlyZDesc.RasterizerDesc, MainDesc.RasterizerDesc);
+    EXPECT_TRUE(EarlyZDesc.DepthStencilDesc.DepthEnable);
+    EXPECT_FALSE(EarlyZDesc.DepthStencilDesc.DepthWriteEnable);
+    EXPECT_EQ(EarlyZDesc.DepthStencilDesc.DepthFunc, COMPARISON_FUNC_EQUAL);
+
+    // Different depth states must produce different PSO cache accessors
+    EXPECT_NE(EarlyZDesc, MainDesc);
+    EXPECT_NE(DepthDesc, MainDesc);
+}
+
+TEST(RadientGeometryPassTest, ShadowGraphicsDesc)
+{
+    GraphicsPipelineDesc MainDesc;
+    MainDesc.NumRenderTargets                     = 1;
+    MainDesc.RTVFormats[0]                        = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    MainDesc.DSVFormat                            = TEX_FORMAT_D24_UNORM_S8_UINT;
+    MainDesc.PrimitiveTopology                    = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    MainDesc.RasterizerDesc.FrontCounterClockwise = true;
+
+    const GraphicsPipelineDesc ShadowDesc = GetRadientShadowGraphicsDesc(MainDesc, TEX_FORMAT_D32_FLOAT, 3, true);
+    EXPECT_EQ(ShadowDesc.NumRenderTargets, 0u);
+    EXPECT_EQ(ShadowDesc.RTVFormats[0], TEX_FORMAT_UNKNOWN);
+    EXPECT_EQ(ShadowDesc.DSVFormat, TEX_FORMAT_D32_FLOAT);
+    EXPECT_EQ(ShadowDesc.PrimitiveTopology, MainDesc.PrimitiveTopology);
+    EXPECT_EQ(ShadowDesc.RasterizerDesc.FrontCounterClockwise, MainDesc.RasterizerDesc.FrontCounterClockwise);
+    EXPECT_TRUE(ShadowDesc.DepthStencilDesc.DepthEnable);
+    EXPECT_TRUE(ShadowDesc.DepthStencilDesc.DepthWriteEnable);
+    EXPECT_EQ(ShadowDesc.DepthStencilDesc.DepthFunc, COMPARISON_FUNC_LESS);
+    EXPECT_EQ(ShadowDesc.RasterizerDesc.DepthBias, 10000);
+    EXPECT_EQ(ShadowDesc.RasterizerDesc.SlopeScaledDepthBias, 2.f);
+    EXPECT_FALSE(ShadowDesc.RasterizerDesc.DepthClipEnable);
+
+    const GraphicsPipelineDesc UnormShadowDesc = GetRadientShadowGraphicsDesc(MainDesc, TEX_FORMAT_D16_UNORM, 5, false);
+    EXPECT_EQ(UnormShadowDesc.RasterizerDesc.DepthBias, 10);
+    EXPECT_EQ(UnormShadowDesc.RasterizerDesc.SlopeScaledDepthBias, 3.f);
+    EXPECT_TRUE(UnormShadowDesc.RasterizerDesc.DepthClipEnable);
+
+    // Shadow and depth pre-pass PSOs must not share the cache accessor
+    EXPECT_NE(ShadowDesc, GetRadientDepthPrepassGraphicsDesc(MainDesc));
+}
@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientIndirectDrawList.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+RadientIndirectDrawItem MakeItem(Uint32 StateIndex, Uint32 MaterialIndex, Uint32 FirstIndex)
+{
+    RadientIndirectDrawItem Item;
+    Item.StateIndex    = StateIndex;
+    Item.MaterialIndex = MaterialIndex;
+    Item.IndexCount    = 36;
+    Item.FirstIndex    = FirstIndex;
+    Item.BaseVertex    = FirstIndex * 2;
+    Item.Bounds.Min    = {-1, -1, -1};
+    Item.Bounds.Max    = {1, 1, 1};
+    return Item;
+}
+
+// 90-degree field of view looking along +Z from the origin
+float4x4 MakeViewProj()
+{
+    return float4x4::Projection(PI_F / 2.f, 1.f, 1.f, 100.f, false);
+}
+
+TEST(Radient_IndirectDrawList, BuildGroupsDrawsByStateAndMaterial)
+{
+    const std::vector<RadientIndirectDrawItem> Items =
+        {
+            MakeItem(0, 5, 0),
+            MakeItem(0, 3, 100),
+            MakeItem(0, 5, 200),
+            MakeItem(1, 3, 300),
+            MakeItem(1, 3, 400),
+            MakeItem(1, 3, 500),
+        };
+
+    RadientIndirectDrawList DrawList;
+    EXPECT_TRUE(DrawList.Build(Items, 2));
+
+    // Buckets follow the state and then the material, and are split at the maximum size
+    const std::vector<RadientIndirectDrawList::Bucket>& Buckets = DrawList.GetBuckets();
+    ASSERT_EQ(Buckets.size(), 4u);
+    const Uint32 ExpectedBuckets[][4] =
+        {
+            // State, Material, FirstDraw, DrawCount
+            {0, 3, 0, 1},
+            {0, 5, 1, 2},
+            {1, 3, 3, 2},
+            {1, 3, 5, 1},
+        };
+    for (size_t i = 0; i < Buckets.size(); ++i)
+    {
+        EXPECT_EQ(Buckets[i].StateIndex, ExpectedBuckets[i][0]);
+        EXPECT_EQ(Buckets[i].MaterialIndex, ExpectedBuckets[i][1]);
+        EXPECT_EQ(Buckets[i].FirstDraw, ExpectedBuckets[i][2]);
+        EXPECT_EQ(Buckets[i].DrawCount, ExpectedBuckets[i][3]);
+    }
+
+    // Draws with the same state and material keep the item order
+    const Uint32 ExpectedItems[] = {1, 0, 2, 3, 4, 5};
+    ASSERT_EQ(DrawList.GetDrawCount(), static_cast<Uint32>(Items.size()));
+    for (Uint32 DrawIdx = 0; DrawIdx < DrawList.GetDrawCount(); ++DrawIdx)
+        EXPECT_EQ(DrawList.GetDrawItem(DrawIdx), ExpectedItems[DrawIdx]);
+
+    // Records address the arguments, the draw count and the slot of their bucket
+    const std::vector<HLSL::RadientIndirectDrawRecord>& Records = DrawList.GetRecords();
+    for (Uint32 BucketIdx = 0; BucketIdx < Buckets.size(); ++BucketIdx)
+    {
+        const RadientIndirectDrawList::Bucket& DrawBucket = Buckets[BucketIdx];
+        for (Uint32 Slot = 0; Slot < DrawBucket.DrawCount; ++Slot)
+        {
+            const Uint32                           DrawIdx = DrawBucket.FirstDraw + Slot;
+            const HLSL::RadientIndirectDrawRecord& Record  = Records[DrawIdx];
+            const RadientIndirectDrawItem&         Item    = Items[DrawList.GetDrawItem(DrawIdx)];
+            EXPECT_EQ(Record.Bucket, BucketIdx);
+            EXPECT_EQ(Record.ArgsIndex, DrawIdx);
+            EXPECT_EQ(Record.Slot, Slot);
+            EXPECT_EQ(Record.IndexCount, Item.IndexCount);
+            EXPECT_EQ(Record.FirstIndex, Item.FirstIndex);
+            EXPECT_EQ(Record.BaseVertex, Item.BaseVertex);
+        }
+    }
+
+    DrawList.Clear();
+    EXPECT_EQ(DrawList.GetDrawCount(), 0u);
+    EXPECT_EQ(DrawList.GetBucketCount(), 0u);
+}
+
+TEST(Radient_IndirectDrawList, BufferLayout)
+{
+    // The layout must match the structured buffer and the DrawIndexedIndirect arguments
+    EXPECT_EQ(sizeof(HLSL::RadientIndirectDrawRecord), 48u);
+    EXPECT_EQ(RadientIndirectDrawList::DrawArgsStride, 20u);
+    EXPECT_EQ(sizeof(HLSL::RadientIndirectCullAttribs) % 16, 0u);
+
+    std::vector<RadientIndirectDrawItem> Items;
+    for (Uint32 i = 0; i < 10; ++i)
+        Items.push_back(MakeItem(i / 4, 0, i * 36));
+
+    RadientIndirectDrawList DrawList;
+    EXPECT_TRUE(DrawList.Build(Items, 3));
+    EXPECT_EQ(DrawList.GetRecordsSize(), 10u * 48u);
+    EXPECT_EQ(DrawList.GetDrawArgsSize(), 10u * 20u);
+    EXPECT_EQ(DrawList.GetDrawCountsSize(), DrawList.GetBucketCount() * 4u);
+    for (Uint32 BucketIdx = 0; BucketIdx < DrawList.GetBucketCount(); ++BucketIdx)
+    {
+        const RadientIndirectDrawList::Bucket& DrawBucket = DrawList.GetBuckets()[BucketIdx];
+        EXPECT_EQ(RadientIndirectDrawList::GetDrawArgsOffset(DrawBucket), DrawBucket.FirstDraw * 20u);
+        EXPECT_EQ(RadientIndirectDrawList::GetDrawCountOffset(BucketIdx), BucketIdx * 4u);
+        EXPECT_LE(DrawBucket.DrawCount, 3u);
+    }
+
+    // Records are only uploaded when they change
+    EXPECT_FALSE(DrawList.Build(Items, 3));
+    Items[7].Bounds.Max.x = 2;
+    EXPECT_TRUE(DrawList.Build(Items, 3));
+    EXPECT_FALSE(DrawList.Build(Items, 3));
+    Items.pop_back();
+    EXPECT_TRUE(DrawList.Build(Items, 3));
+}
+
+TEST(Radient_IndirectDrawList, CullingMatchesClipSpaceTest)
+{
+    const float4x4 ViewProj = MakeViewProj();
+
+    std::mt19937                          Rng{42};
+    std::uniform_real_distribution<float> Pos{-60.f, 60.f};
+    std::uniform_real_distribution<float> Depth{-20.f, 120.f};
+    std::uniform_real_distribution<float> Size{0.1f, 10.f};
+    std::uniform_int_distribution<Uint32> State{0, 7};
+
+    std::vector<RadientIndirectDrawItem> Items(2000);
+    for (RadientIndirectDrawItem& Item : Items)
+    {
+        Item = MakeItem(State(Rng), 0, 0);
+
+        const float3 Center{Pos(Rng), Pos(Rng), Depth(Rng)};
+        const float3 Extent{Size(Rng), Size(Rng), Size(Rng)};
+        Item.Bounds.Min = {Center.x - Extent.x, Center.y - Extent.y, Center.z - Extent.z};
+        Item.Bounds.Max = {Center.x + Extent.x, Center.y + Extent.y, Center.z + Extent.z};
+    }
+
+    RadientIndirectDrawList DrawList;
+    DrawList.Build(Items, 64);
+
+    const std::vector<HLSL::RadientIndirectDrawRecord>& Records = DrawList.GetRecords();
+    const HLSL::RadientIndirectCullAttribs              Attribs = GetRadientIndirectCullAttribs(ViewProj, false, DrawList.GetDrawCount());
+
+    std::vector<Uint32> DrawArgs(DrawList.GetDrawArgsSize() / sizeof(Uint32), 0xCDCDCDCDu);
+    std::vector<Uint32> DrawCounts(DrawList.GetBucketCount(), 0);
+    CullRadientIndirectDraws(Attribs, Records.data(), DrawArgs.data(), DrawCounts.data());
+
+    Uint32              CulledCount = 0;
+    std::vector<Uint32> ExpectedCounts(DrawList.GetBucketCount(), 0);
+    for (const HLSL::RadientIndirectDrawRecord& Record : Records)
+    {
+        // The box is outside if all of its corners are outside of the same clip-space plane
+        float MaxDist[6] = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+        for (Uint32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const float3 Pos{
+                (Corner & 1) ? Record.BoundsMax.x : Record.BoundsMin.x,
+                (Corner & 2) ? Record.BoundsMax.y : Record.BoundsMin.y,
+                (Corner & 4) ? Record.BoundsMax.z : Record.BoundsMin.z,
+            };
+            const float4 Clip = float4{Pos, 1.f} * ViewProj;
+
+            const float Dist[6] = {Clip.w + Clip.x, Clip.w - Clip.x, Clip.w + Clip.y, Clip.w - Clip.y, Clip.z, Clip.w - Clip.z};
+            for (int i = 0; i < 6; ++i)
+                MaxDist[i] = std::max(MaxDist[i], Dist[i]);
+        }
+
+        bool IsBorderline = false;
+        bool IsVisible    = true;
+        for (float Dist : MaxDist)
+        {
+            IsBorderline = IsBorderline || std::abs(Dist) < 1e-3f;
+            IsVisible    = IsVisible && Dist >= 0.f;
+        }
+
+        const Uint32* pArgs = &DrawArgs[Record.ArgsIndex * 5];
+        EXPECT_EQ(pArgs[0], Record.IndexCount);
+        EXPECT_EQ(pArgs[2], Record.FirstIndex);
+        EXPECT_EQ(pArgs[3], Record.BaseVertex);
+        EXPECT_EQ(pArgs[4], 0u);
+        if (!IsBorderline)
+            EXPECT_EQ(pArgs[1], IsVisible ? 1u : 0u);
+
+        if (pArgs[1] != 0)
+            ExpectedCounts[Record.Bucket] = std::max(ExpectedCounts[Record.Bucket], Record.Slot + 1);
+        else
+            ++CulledCount;
+    }
+    EXPECT_EQ(DrawCounts, ExpectedCounts);
+
+    // The distribution must exercise both outcomes
+    EXPECT_GT(CulledCount, 0u);
+    EXPECT_LT(CulledCount, DrawList.GetDrawCount());
+}
+
+TEST(Radient_IndirectDrawList, UnknownBoundsAreNotCulled)
+{
+    std::vector<RadientIndirectDrawItem> Items = {MakeItem(0, 0, 0), MakeItem(0, 0, 36), MakeItem(0, 0, 72)};
+    // Behind the camera
+    Items[0].Bounds.Min = {-1, -1, -10};
+    Items[0].Bounds.Max = {1, 1, -5};
+    // Unknown
+    Items[1].Bounds.Min = {1, 1, 1};
+    Items[1].Bounds.Max = {-1, -1, -1};
+    // Beyond the far plane
+    Items[2].Bounds.Min = {-1, -1, 200};
+    Items[2].Bounds.Max = {1, 1, 210};
+
+    RadientIndirectDrawList DrawList;
+    DrawList.Build(Items, 64);
+
+    std::vector<Uint32> DrawArgs(DrawList.GetDrawCount() * 5);
+    std::vector<Uint32> DrawCounts(DrawList.GetBucketCount(), 0);
+    CullRadientIndirectDraws(GetRadientIndirectCullAttribs(MakeViewProj(), false, DrawList.GetDrawCount()),
+                             DrawList.GetRecords().data(), DrawArgs.data(), DrawCounts.data());
+
+    EXPECT_EQ(DrawArgs[0 * 5 + 1], 0u);
+    EXPECT_EQ(DrawArgs[1 * 5 + 1], 1u);
+    EXPECT_EQ(DrawArgs[2 * 5 + 1], 0u);
+
+    // The trailing culled draw is trimmed by the draw count
+    ASSERT_EQ(DrawCounts.size(), 1u);
+    EXPECT_EQ(DrawCounts[0], 2u);
+}
+
+} // namespace
@@ -0,0 +1,249 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientLightClusters.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+RadientLightClusterGridDesc MakePerspectiveGrid()
+{
+    RadientLightClusterGridDesc Desc;
+    Desc.GridSizeX  = 16;
+    Desc.GridSizeY  = 8;
+    Desc.GridSizeZ  = 24;
+    Desc.NearZ      = 0.1f;
+    Desc.FarZ       = 200.f;
+    Desc.ProjScaleX = 1.f / std::tan(PI_F / 4.f) / (16.f / 9.f);
+    Desc.ProjScaleY = 1.f / std::tan(PI_F / 4.f);
+    return Desc;
+}
+
+float3 RandomDirection(std::mt19937& Rng)
+{
+    std::uniform_real_distribution<float> Dist{-1.f, 1.f};
+    for (;;)
+    {
+        const float3 Dir{Dist(Rng), Dist(Rng), Dist(Rng)};
+        const float  Len = length(Dir);
+        if (Len > 0.01f && Len <= 1.f)
+            return Dir / Len;
+    }
+}
+
+void AddRandomLights(RadientLightClusters& Clusters, Uint32 LightCount, float MaxDepth, Uint32 Seed)
+{
+    std::mt19937                          Rng{Seed};
+    std::uniform_real_distribution<float> PosXY{-MaxDepth * 0.75f, MaxDepth * 0.75f};
+    std::uniform_real_distribution<float> PosZ{-2.f, MaxDepth};
+    std::uniform_real_distribution<float> Range{0.1f, MaxDepth * 0.1f};
+    std::uniform_real_distribution<float> Angle{0.05f, PI_F * 0.5f};
+    for (Uint32 i = 0; i < LightCount; ++i)
+    {
+        const float3 Pos{PosXY(Rng), PosXY(Rng), PosZ(Rng)};
+        if (i % 2 == 0)
+            Clusters.AddPointLight(Pos, Range(Rng));
+        else
+            Clusters.AddSpotLight(Pos, RandomDirection(Rng), Range(Rng), Angle(Rng));
+    }
+}
+
+void ExpectMatchesBruteForce(const RadientLightClusters& Clusters)
+{
+    const std::vector<RadientLightClusterRange>& Ranges  = Clusters.GetClusterRanges();
+    const std::vector<Uint32>&                   Indices = Clusters.GetLightIndices();
+    ASSERT_EQ(Ranges.size(), Clusters.GetClusterCount());
+
+    size_t TotalCount = 0;
+    for (Uint32 ClusterIdx = 0; ClusterIdx < Clusters.GetClusterCount(); ++ClusterIdx)
+    {
+        std::vector<Uint32> Expected;
+        for (Uint32 LightIdx = 0; LightIdx < Clusters.GetLightCount(); ++LightIdx)
+        {
+            if (Clusters.LightIntersectsCluster(LightIdx, ClusterIdx))
+                Expected.push_back(LightIdx);
+        }
+
+        const RadientLightClusterRange& Range = Ranges[ClusterIdx];
+        ASSERT_LE(Range.Offset + Range.Count, Indices.size());
+        const std::vector<Uint32> Actual{Indices.begin() + Range.Offset, Indices.begin() + Range.Offset + Range.Count};
+        EXPECT_EQ(Actual, Expected) << "Cluster " << ClusterIdx;
+        TotalCount += Range.Count;
+    }
+    EXPECT_EQ(TotalCount, Indices.size());
+}
+
+TEST(RadientLightClustersTest, PerspectiveBinningMatchesBruteForce)
+{
+    RadientLightClusters Clusters;
+    Clusters.SetGrid(MakePerspectiveGrid());
+    AddRandomLights(Clusters, 500, 60.f, 17);
+    Clusters.Bin();
+
+    EXPECT_FALSE(Clusters.GetLightIndices().empty());
+    ExpectMatchesBruteForce(Clusters);
+}
+
+TEST(RadientLightClustersTest, OrthographicBinningMatchesBruteForce)
+{
+    RadientLightClusterGridDesc Desc;
+    Desc.GridSizeX    = 12;
+    Desc.GridSizeY    = 10;
+    Desc.GridSizeZ    = 16;
+    Desc.NearZ        = 1.f;
+    Desc.FarZ         = 100.f;
+    Desc.ProjScaleX   = 2.f / 80.f;
+    Desc.ProjScaleY   = 2.f / 60.f;
+    Desc.Orthographic = true;
+
+    RadientLightClusters Clusters;
+    Clusters.SetGrid(Desc);
+    AddRandomLights(Clusters, 300, 60.f, 29);
+    Clusters.Bin();
+
+    EXPECT_FALSE(Clusters.GetLightIndices().empty());
+    ExpectMatchesBruteForce(Clusters);
+}
+
+TEST(RadientLightClustersTest, LitPointsFindTheirLights)
+{
+    RadientLightClusters Clusters;
+    Clusters.SetGrid(MakePerspectiveGrid());
+
+    std::mt19937 Rng{5};
+
+    struct LightDesc
+    {
+        float3 Pos;
+        float3 Dir;
+        float  Range;
+        float  Angle;
+    };
+    std::vector<LightDesc> Lights;
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        std::uniform_real_distribution<float> PosXY{-10.f, 10.f};
+        std::uniform_real_distribution<float> PosZ{1.f, 40.f};
+        std::uniform_real_distribution<float> Range{0.5f, 8.f};
+        std::uniform_real_distribution<float> Angle{0.1f, 1.2f};
+
+        LightDesc Light{float3{PosXY(Rng), PosXY(Rng), PosZ(Rng)}, RandomDirection(Rng), Range(Rng), i % 2 == 0 ? PI_F : Angle(Rng)};
+        if (Light.Angle >= PI_F)
+            Clusters.AddPointLight(Light.Pos, Light.Range);
+        else
+            Clusters.AddSpotLight(Light.Pos, Light.Dir, Light.Range, Light.Angle);
+        Lights.push_back(Light);
+    }
+    Clusters.Bin();
+
+    const std::vector<RadientLightClusterRange>& Ranges  = Clusters.GetClusterRanges();
+    const std::vector<Uint32>&                   Indices = Clusters.GetLightIndices();
+
+    // Every point that a light reaches must find that light in its cluster.
+    Uint32 NumTestedPoints = 0;
+    for (Uint32 LightIdx = 0; LightIdx < Lights.size(); ++LightIdx)
+    {
+        const LightDesc& Light = Lights[LightIdx];
+        for (Uint32 Sample = 0; Sample < 200; ++Sample)
+        {
+            const float3 Dir  = RandomDirection(Rng);
+            const float  Dist = std::uniform_real_distribution<float>{0.f, Light.Range * 0.99f}(Rng);
+            if (Light.Angle < PI_F && dot(Dir, Light.Dir) < std::cos(Light.Angle * 0.95f))
+                continue;
+
+            const float3 Pos = Light.Pos + Dir * Dist;
+
+            Uint32 ClusterIdx = 0;
+            if (!Clusters.FindCluster(Pos, ClusterIdx))
+                continue;
+
+            const RadientLightClusterRange& Range = Ranges[ClusterIdx];
+            const auto                      Begin = Indices.begin() + Range.Offset;
+            const auto                      End   = Begin + Range.Count;
+            EXPECT_NE(std::find(Begin, End, LightIdx), End) << "Light " << LightIdx << " is missing from cluster " << ClusterIdx;
+            ++NumTestedPoints;
+        }
+    }
+    EXPECT_GT(NumTestedPoints, 1000u);
+}
+
+TEST(RadientLightClustersTest, LightsOutsideOfViewAreNotBinned)
+{
+    RadientLightClusters Clusters;
+    Clusters.SetGrid(MakePerspectiveGrid());
+    Clusters.AddPointLight(float3{0, 0, -5}, 1.f);     // Behind the camera
+    Clusters.AddPointLight(float3{0, 0, 500}, 10.f);   // Beyond the far plane
+    Clusters.AddPointLight(float3{100, 0, 10}, 2.f);   // Outside of the frustum
+    Clusters.AddSpotLight(float3{0, 0, 10}, float3{0, 0, -1}, 5.f, 0.3f);
+    Clusters.Bin();
+
+    // Only the spot light is visible
+    for (const Uint32 LightIdx : Clusters.GetLightIndices())
+        EXPECT_EQ(LightIdx, 3u);
+    EXPECT_FALSE(Clusters.GetLightIndices().empty());
+
+    Clusters.ClearLights();
+    Clusters.Bin();
+    EXPECT_TRUE(Clusters.GetLightIndices().empty());
+    for (const RadientLightClusterRange& Range : Clusters.GetClusterRanges())
+        EXPECT_EQ(Range.Count, 0u);
+}
+
+TEST(RadientLightClustersTest, BinsTenThousandLights)
+{
+    RadientLightClusters Clusters;
+    Clusters.SetGrid(MakePerspectiveGrid());
+    AddRandomLights(Clusters, 10000, 150.f, 101);
+    Clusters.Bin();
+    ASSERT_EQ(Clusters.GetLightCount(), 10000u);
+
+    // Spot-check a subset of clusters against the reference test
+    const std::vector<RadientLightClusterRange>& Ranges  = Clusters.GetClusterRanges();
+    const std::vector<Uint32>&                   Indices = Clusters.GetLightIndices();
+    for (Uint32 ClusterIdx = 0; ClusterIdx < Clusters.GetClusterCount(); ClusterIdx += 97)
+    {
+        std::vector<Uint32> Expected;
+        for (Uint32 LightIdx = 0; LightIdx < Clusters.GetLightCount(); ++LightIdx)
+        {
+            if (Clusters.LightIntersectsCluster(LightIdx, ClusterIdx))
+                Expected.push_back(LightIdx);
+        }
+
+        const RadientLightClusterRange& Range = Ranges[ClusterIdx];
+        const std::vector<Uint32>       Actual{Indices.begin() + Range.Offset, Indices.begin() + Range.Offset + Range.Count};
+        EXPECT_EQ(Actual, Expected) << "Cluster " << ClusterIdx;
+    }
+}
+
+} // namespace
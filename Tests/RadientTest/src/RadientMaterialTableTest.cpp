@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientMaterialTable.hpp"
+
+#include <array>
+#include <cstring>
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 TestAttribsSize     = 100;
+constexpr Uint32 TestOffsetAlignment = 256;
+
+std::array<Uint8, TestAttribsSize> MakeAttribs(Uint8 Value)
+{
+    std::array<Uint8, TestAttribsSize> Attribs;
+    Attribs.fill(Value);
+    return Attribs;
+}
+
+using SlotRange = RadientMaterialTable::SlotRange;
+
+void ExpectDirtySlots(const RadientMaterialTable& Table, Uint32 First, Uint32 End)
+{
+    const SlotRange& DirtySlots = Table.GetDirtySlots();
+    EXPECT_EQ(DirtySlots.First, First);
+    EXPECT_EQ(DirtySlots.End, End);
+}
+
+} // namespace
+
+TEST(RadientMaterialTableTest, SlotOffsetsAreAligned)
+{
+    RadientMaterialTable Table;
+    EXPECT_EQ(Table.Acquire(nullptr, PBR_Renderer::PSO_FLAG_NONE, MakeAttribs(1).data(), TestAttribsSize), RadientMaterialTable::InvalidIndex);
+
+    Table.SetLayout(TestAttribsSize, TestOffsetAlignment);
+    EXPECT_EQ(Table.GetAttribsSize(), TestAttribsSize);
+    EXPECT_EQ(Table.GetSlotStride(), TestOffsetAlignment);
+    EXPECT_EQ(Table.GetSlotOffset(0), 0u);
+    EXPECT_EQ(Table.GetSlotOffset(3), 3 * TestOffsetAlignment);
+
+    Table.SetLayout(TestOffsetAlignment + 1, TestOffsetAlignment);
+    EXPECT_EQ(Table.GetSlotStride(), 2 * TestOffsetAlignment);
+
+    // Attributes larger than the slot are rejected
+    std::array<Uint8, 2 * TestOffsetAlignment> LargeAttribs{};
+    EXPECT_EQ(Table.Acquire(nullptr, PBR_Renderer::PSO_FLAG_NONE, LargeAttribs.data(), static_cast<Uint32>(LargeAttribs.size())), RadientMaterialTable::InvalidIndex);
+    EXPECT_EQ(Table.GetSlotCount(), 0u);
+}
+
+TEST(RadientMaterialTableTest, SlotsAreSharedAndRecycled)
+{
+    RadientMaterialTable Table;
+    Table.SetLayout(TestAttribsSize, TestOffsetAlignment);
+
+    GLTF::Material MaterialA;
+    GLTF::Material MaterialB;
+
+    const auto AttribsA = MakeAttribs(1);
+    const auto AttribsB = MakeAttribs(2);
+
+    constexpr PBR_Renderer::PSO_FLAGS MainFlags  = PBR_Renderer::PSO_FLAG_USE_COLOR_MAP;
+    constexpr PBR_Renderer::PSO_FLAGS DepthFlags = PBR_Renderer::PSO_FLAG_NONE;
+
+    const Uint32 IndexA = Table.Acquire(&MaterialA, MainFlags, AttribsA.data(), TestAttribsSize);
+    const Uint32 IndexB = Table.Acquire(&MaterialB, MainFlags, AttribsB.data(), TestAttribsSize);
+    EXPECT_EQ(IndexA, 0u);
+    EXPECT_EQ(IndexB, 1u);
+
+    // Drawables that use the same material with the same flags share the slot
+    EXPECT_EQ(Table.Acquire(&MaterialA, MainFlags, AttribsA.data(), TestAttribsSize), IndexA);
+    EXPECT_EQ(Table.GetUseCount(IndexA), 2u);
+
+    // Attributes packed for other flags have a different layout and use their own slot
+    const Uint32 DepthIndexA = Table.Acquire(&MaterialA, DepthFlags, AttribsA.data(), TestAttribsSize / 2);
+    EXPECT_EQ(DepthIndexA, 2u);
+    EXPECT_EQ(Table.GetUsedSlotCount(), 3u);
+
+    // The unused part of a slot is zeroed
+    const Uint8* pDepthData = Table.GetSlotData(DepthIndexA);
+    ASSERT_NE(pDepthData, nullptr);
+    EXPECT_EQ(pDepthData[0], 1u);
+    EXPECT_EQ(pDepthData[TestAttribsSize / 2], 0u);
+
+    Table.Release(IndexA);
+    EXPECT_EQ(Table.GetUseCount(IndexA), 1u);
+    Table.Release(IndexA);
+    EXPECT_EQ(Table.GetUseCount(IndexA), 0u);
+    EXPECT_EQ(Table.GetUsedSlotCount(), 2u);
+    EXPECT_EQ(Table.GetSlotCount(), 3u);
+
+    // The released slot is reused by the next material
+    GLTF::Material MaterialC;
+    EXPECT_EQ(Table.Acquire(&MaterialC, MainFlags, AttribsB.data(), TestAttribsSize), IndexA);
+    EXPECT_EQ(Table.GetSlotCount(), 3u);
+    EXPECT_EQ(std::memcmp(Table.GetSlotData(IndexA), AttribsB.data(), TestAttribsSize), 0);
+
+    // Releasing an invalid index does nothing
+    Table.Release(RadientMaterialTable::InvalidIndex);
+    EXPECT_EQ(Table.GetUsedSlotCount(), 3u);
+}
+
+TEST(RadientMaterialTableTest, DirtySlotsTrackWrites)
+{
+    RadientMaterialTable Table;
+    Table.SetLayout(TestAttribsSize, TestOffsetAlignment);
+    EXPECT_TRUE(Table.GetDirtySlots().IsEmpty());
+
+    std::array<GLTF::Material, 4> Materials;
+
+    const auto Attribs = MakeAttribs(7);
+
+    std::array<Uint32, 4> Indices{};
+    for (size_t i = 0; i < Materials.size(); ++i)
+        Indices[i] = Table.Acquire(&Materials[i], PBR_Renderer::PSO_FLAG_NONE, Attribs.data(), TestAttribsSize);
+    ExpectDirtySlots(Table, 0, 4);
+
+    Table.ResetDirtySlots();
+    EXPECT_TRUE(Table.GetDirtySlots().IsEmpty());
+
+    // Acquiring an existing slot with the same attributes does not rewrite it
+    EXPECT_EQ(Table.Acquire(&Materials[2], PBR_Renderer::PSO_FLAG_NONE, Attribs.data(), TestAttribsSize), Indices[2]);
+    EXPECT_TRUE(Table.GetDirtySlots().IsEmpty());
+
+    // Releasing slots does not dirty them
+    Table.Release(Indices[1]);
+    Table.Release(Indices[3]);
+    EXPECT_TRUE(Table.GetDirtySlots().IsEmpty());
+
+    // Writes of separate slots are merged into one range
+    GLTF::Material NewMaterial0;
+    GLTF::Material NewMaterial1;
+    EXPECT_EQ(Table.Acquire(&NewMaterial0, PBR_Renderer::PSO_FLAG_NONE, Attribs.data(), TestAttribsSize), Indices[3]);
+    ExpectDirtySlots(Table, 3, 4);
+    EXPECT_EQ(Table.Acquire(&NewMaterial1, PBR_Renderer::PSO_FLAG_NONE, Attribs.data(), TestAttribsSize), Indices[1]);
+    ExpectDirtySlots(Table, 1, 4);
+
+    Table.ResetDirtySlots();
+
+    // Changed attributes are rewritten
+    const auto NewAttribs = MakeAttribs(8);
+    EXPECT_EQ(Table.Acquire(&Materials[2], PBR_Renderer::PSO_FLAG_NONE, NewAttribs.data(), TestAttribsSize), Indices[2]);
+    ExpectDirtySlots(Table, 2, 3);
+    EXPECT_EQ(Table.GetSlotData(Indices[2])[0], 8u);
+    EXPECT_EQ(Table.GetUseCount(Indices[2]), 3u);
+
+    // Changing the layout drops all slots
+    Table.SetLayout(TestAttribsSize, 2 * TestOffsetAlignment);
+    EXPECT_EQ(Table.GetSlotCount(), 0u);
+    EXPECT_TRUE(Table.GetDirtySlots().IsEmpty());
+}
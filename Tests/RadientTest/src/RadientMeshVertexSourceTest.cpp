@@ -351,6 +351,36 @@ TEST(RadientMeshVertexSourceTest, PacksStridedSourceAttributes)
                    RadientFloat4{0.f, 64.f / 255.f, 128.f / 255.f, 1.f});
 }
 
+TEST(RadientMeshVertexSourceTest, ComputesPositionBounds)
+{
+    struct SourceVertex
+    {
+        RadientFloat3 Position;
+        RadientFloat2 TexCoord0;
+    };
+
+    const std::array<SourceVertex, 3> Vertices{
+        SourceVertex{RadientFloat3{1.f, -2.f, 3.f}, RadientFloat2{}},
+        SourceVertex{RadientFloat3{-4.f, 5.f, 0.5f}, RadientFloat2{}},
+        SourceVertex{RadientFloat3{2.f, 1.f, -6.f}, RadientFloat2{}}};
+
+    const std::array<RadientMeshVertexSource::SourceAttribute, 2> SourceAttributes{
+        RadientMeshVertexSource::SourceAttribute{GLTF::PositionAttributeName, VT_FLOAT32, 3, false, &Vertices[0].Position, sizeof(SourceVertex)},
+        RadientMeshVertexSource::SourceAttribute{GLTF::Texcoord0AttributeName, VT_FLOAT32, 2, false, &Vertices[0].TexCoord0, sizeof(SourceVertex)}};
+
+    RadientMeshVertexSource::CreateInfo CI{};
+    CI.pAttributes    = SourceAttributes.data();
+    CI.AttributeCount = static_cast<Uint32>(SourceAttributes.size());
+    CI.VertexCount    = static_cast<Uint32>(Vertices.size());
+
+    RadientMeshVertexSource Source{CI};
+    ASSERT_EQ(Source.GetStatus(), RADIENT_STATUS_OK);
+
+    const RadientBounds Bounds = Source.GetPositionBounds();
+    ExpectFloat3Eq(Bounds.Min, RadientFloat3{-4.f, -2.f, -6.f});
+    ExpectFloat3Eq(Bounds.Max, RadientFloat3{2.f, 5.f, 3.f});
+}
+
 TEST(RadientMeshVertexSourceTest, BorrowsSourceDataAndKeepsOwnerAlive)
 {
     struct SourceVertex
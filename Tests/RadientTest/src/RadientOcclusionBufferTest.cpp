@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientOcclusionBuffer.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+// Not a multiple of the tile size, so that the last tiles and the odd-sized levels are exercised
+constexpr Uint32 BufferWidth  = 100;
+constexpr Uint32 BufferHeight = 60;
+
+// 90-degree field of view looking along +Z: the view covers |x / z| <= 1 and |y / z| <= 1
+float4x4 MakeViewProj()
+{
+    return float4x4::Projection(PI_F / 2.f, 1.f, 1.f, 100.f, false);
+}
+
+RadientBounds MakeBounds(const float3& Min, const float3& Max)
+{
+    RadientBounds Bounds;
+    Bounds.Min = {Min.x, Min.y, Min.z};
+    Bounds.Max = {Max.x, Max.y, Max.z};
+    return Bounds;
+}
+
+void RasterizeAndBuildHierarchy(RadientOcclusionBuffer& Buffer)
+{
+    // Tiles are processed in reverse order to verify that they do not depend on each other
+    for (Uint32 Tile = Buffer.GetTileCount(); Tile-- > 0;)
+        Buffer.RasterizeTile(Tile);
+    Buffer.BuildHierarchy();
+}
+
+float3 ToScreen(const float4& ClipPos)
+{
+    return float3{
+        (ClipPos.x / ClipPos.w * 0.5f + 0.5f) * BufferWidth,
+        (0.5f - ClipPos.y / ClipPos.w * 0.5f) * BufferHeight,
+        ClipPos.z / ClipPos.w,
+    };
+}
+
+// Brute-force rasterization of one triangle at the pixel centers
+void RasterizeReference(const float3& P0, const float3& P1, const float3& P2, std::vector<float>& Depth)
+{
+    const auto Edge = [](const float3& A, const float3& B, float x, float y) {
+        return (B.x - A.x) * (y - A.y) - (B.y - A.y) * (x - A.x);
+    };
+
+    const float Area = Edge(P0, P1, P2.x, P2.y);
+    if (Area == 0.f)
+        return;
+
+    for (Uint32 y = 0; y < BufferHeight; ++y)
+    {
+        for (Uint32 x = 0; x < BufferWidth; ++x)
+        {
+            const float PixelX = x + 0.5f;
+            const float PixelY = y + 0.5f;
+
+            const float W0 = Edge(P1, P2, PixelX, PixelY) / Area;
+            const float W1 = Edge(P2, P0, PixelX, PixelY) / Area;
+            const float W2 = Edge(P0, P1, PixelX, PixelY) / Area;
+            if (W0 < 0.f || W1 < 0.f || W2 < 0.f)
+                continue;
+
+            float& PixelDepth = Depth[y * BufferWidth + x];
+            PixelDepth        = std::min(PixelDepth, W0 * P0.z + W1 * P1.z + W2 * P2.z);
+        }
+    }
+}
+
+// Tests the box against every pixel of the full-resolution buffer
+bool IsOccludedReference(const RadientOcclusionBuffer& Buffer, const RadientBounds& Bounds)
+{
+    const float4x4 ViewProj = MakeViewProj();
+
+    float MinX = +FLT_MAX;
+    float MinY = +FLT_MAX;
+    float MaxX = -FLT_MAX;
+    float MaxY = -FLT_MAX;
+    float MinZ = +FLT_MAX;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const float3 Corner{
+            (i & 1u) != 0 ? Bounds.Max.x : Bounds.Min.x,
+            (i & 2u) != 0 ? Bounds.Max.y : Bounds.Min.y,
+            (i & 4u) != 0 ? Bounds.Max.z : Bounds.Min.z,
+        };
+        const float4 ClipPos = float4{Corner, 1.f} * ViewProj;
+        if (ClipPos.w <= 0.f || ClipPos.z < 0.f)
+            return false;
+
+        const float3 ScreenPos = ToScreen(ClipPos);
+        MinX                   = std::min(MinX, ScreenPos.x);
+        MinY                   = std::min(MinY, ScreenPos.y);
+        MaxX                   = std::max(MaxX, ScreenPos.x);
+        MaxY                   = std::max(MaxY, ScreenPos.y);
+        MinZ                   = std::min(MinZ, ScreenPos.z);
+    }
+
+    const int X0 = std::max(static_cast<int>(std::floor(MinX)), 0);
+    const int Y0 = std::max(static_cast<int>(std::floor(MinY)), 0);
+    const int X1 = std::min(static_cast<int>(std::floor(MaxX)), static_cast<int>(BufferWidth) - 1);
+    const int Y1 = std::min(static_cast<int>(std::floor(MaxY)), static_cast<int>(BufferHeight) - 1);
+    if (X0 > X1 || Y0 > Y1)
+        return false;
+
+    for (int y = Y0; y <= Y1; ++y)
+    {
+        for (int x = X0; x <= X1; ++x)
+        {
+            if (MinZ <= Buffer.GetDepth(x, y))
+                return false;
+        }
+    }
+    return true;
+}
+
+void AddRandomOccluders(RadientOcclusionBuffer& Buffer, std::mt19937& Rng, Uint32 NumTriangles, std::vector<float>& ReferenceDepth)
+{
+    std::uniform_real_distribution<float> XY{-20.f, 20.f};
+    std::uniform_real_distribution<float> Z{5.f, 50.f};
+
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+    for (Uint32 i = 0; i < NumTriangles * 3; ++i)
+    {
+        Positions.emplace_back(XY(Rng), XY(Rng), Z(Rng));
+        Indices.push_back(i);
+    }
+    Buffer.AddOccluder(Positions.data(), static_cast<Uint32>(Positions.size()), Indices.data(), static_cast<Uint32>(Indices.size()), float4x4::Identity());
+
+    const float4x4 ViewProj = MakeViewProj();
+    ReferenceDepth.assign(BufferWidth * BufferHeight, 1.f);
+    for (size_t i = 0; i < Positions.size(); i += 3)
+    {
+        RasterizeReference(ToScreen(float4{Positions[i + 0], 1.f} * ViewProj),
+                           ToScreen(float4{Positions[i + 1], 1.f} * ViewProj),
+                           ToScreen(float4{Positions[i + 2], 1.f} * ViewProj),
+                           ReferenceDepth);
+    }
+}
+
+} // namespace
+
+TEST(RadientOcclusionBufferTest, BoxBehindOccluderIsOccluded)
+{
+    RadientOcclusionBuffer Buffer;
+    Buffer.Begin(BufferWidth, BufferHeight, MakeViewProj());
+
+    // The wall covers |x / z| <= 0.5 and |y / z| <= 0.5
+    Buffer.AddOccluderBox(MakeBounds({-5, -5, 10}, {5, 5, 11}), float4x4::Identity());
+    EXPECT_EQ(Buffer.GetTriangleCount(), 12u);
+    RasterizeAndBuildHierarchy(Buffer);
+
+    EXPECT_TRUE(Buffer.IsOccluded(MakeBounds({-1, -1, 20}, {1, 1, 22}), float4x4::Identity()));
+    EXPECT_TRUE(Buffer.IsOccluded(MakeBounds({-1, -1, 0}, {1, 1, 2}), float4x4::Translation(0, 0, 20)));
+
+    // In front of the wall
+    EXPECT_FALSE(Buffer.IsOccluded(MakeBounds({-1, -1, 5}, {1, 1, 6}), float4x4::Identity()));
+    // Sticks out behind the edge of the wall
+    EXPECT_FALSE(Buffer.IsOccluded(MakeBounds({6, -1, 20}, {14, 1, 22}), float4x4::Identity()));
+    // Crosses the near plane
+    EXPECT_FALSE(Buffer.IsOccluded(MakeBounds({-1, -1, 0.5f}, {1, 1, 30}), float4x4::Identity()));
+    // Outside of the screen
+    EXPECT_FALSE(Buffer.IsOccluded(MakeBounds({100, -1, 20}, {110, 1, 22}), float4x4::Identity()));
+
+    // Triangles that cross the near plane are skipped
+    const float3 SlopedQuad[]  = {{-5, -5, 0.5f}, {5, -5, 0.5f}, {5, 5, 11}, {-5, 5, 11}};
+    const Uint32 QuadIndices[] = {0, 1, 2, 0, 2, 3};
+    Buffer.Begin(BufferWidth, BufferHeight, MakeViewProj());
+    Buffer.AddOccluder(SlopedQuad, 4, QuadIndices, 6, float4x4::Identity());
+    EXPECT_EQ(Buffer.GetTriangleCount(), 0u);
+    RasterizeAndBuildHierarchy(Buffer);
+    EXPECT_FALSE(Buffer.IsOccluded(MakeBounds({-1, -1, 20}, {1, 1, 22}), float4x4::Identity()));
+}
+
+TEST(RadientOcclusionBufferTest, MatchesReferenceRasterizer)
+{
+    std::mt19937 Rng{17};
+
+    RadientOcclusionBuffer Buffer;
+    Buffer.Begin(BufferWidth, BufferHeight, MakeViewProj());
+
+    std::vector<float> ReferenceDepth;
+    AddRandomOccluders(Buffer, Rng, 64, ReferenceDepth);
+    RasterizeAndBuildHierarchy(Buffer);
+
+    // Coverage may only differ for pixel centers that lie on the triangle edges within the rounding error
+    Uint32 CoveredCount  = 0;
+    Uint32 MismatchCount = 0;
+    for (Uint32 y = 0; y < BufferHeight; ++y)
+    {
+        for (Uint32 x = 0; x < BufferWidth; ++x)
+        {
+            const float Depth     = Buffer.GetDepth(x, y);
+            const float RefDepth  = ReferenceDepth[y * BufferWidth + x];
+            const bool  IsCovered = RefDepth < 1.f;
+            CoveredCount += IsCovered ? 1 : 0;
+            if (std::abs(Depth - RefDepth) > 1e-4f)
+                ++MismatchCount;
+        }
+    }
+    EXPECT_GT(CoveredCount, BufferWidth * BufferHeight / 2);
+    EXPECT_LE(MismatchCount, CoveredCount / 100);
+}
+
+TEST(RadientOcclusionBufferTest, HierarchyKeepsMinAndMaxDepth)
+{
+    std::mt19937 Rng{3};
+
+    RadientOcclusionBuffer Buffer;
+    Buffer.Begin(BufferWidth, BufferHeight, MakeViewProj());
+
+    std::vector<float> ReferenceDepth;
+    AddRandomOccluders(Buffer, Rng, 16, ReferenceDepth);
+    RasterizeAndBuildHierarchy(Buffer);
+
+    ASSERT_GT(Buffer.GetLevelCount(), 1u);
+    EXPECT_EQ(Buffer.GetLevelWidth(Buffer.GetLevelCount() - 1), 1u);
+    EXPECT_EQ(Buffer.GetLevelHeight(Buffer.GetLevelCount() - 1), 1u);
+
+    for (Uint32 Level = 1; Level < Buffer.GetLevelCount(); ++Level)
+    {
+        for (Uint32 y = 0; y < Buffer.GetLevelHeight(Level); ++y)
+        {
+            for (Uint32 x = 0; x < Buffer.GetLevelWidth(Level); ++x)
+            {
+                float MinDepth = +FLT_MAX;
+                float MaxDepth = -FLT_MAX;
+                for (Uint32 py = y << Level; py < std::min((y + 1) << Level, BufferHeight); ++py)
+                {
+                    for (Uint32 px = x << Level; px < std::min((x + 1) << Level, BufferWidth); ++px)
+                    {
+                        MinDepth = std::min(MinDepth, Buffer.GetDepth(px, py));
+                        MaxDepth = std::max(MaxDepth, Buffer.GetDepth(px, py));
+                    }
+                }
+                EXPECT_EQ(Buffer.GetMinDepth(Level, x, y), MinDepth) << "Level " << Level << " texel " << x << ", " << y;
+                EXPECT_EQ(Buffer.GetMaxDepth(Level, x, y), MaxDepth) << "Level " << Level << " texel " << x << ", " << y;
+            }
+        }
+    }
+}
+
+TEST(RadientOcclusionBufferTest, HierarchicalTestMatchesFullResolutionTest)
+{
+    std::mt19937 Rng{5};
+
+    RadientOcclusionBuffer Buffer;
+    Buffer.Begin(BufferWidth, BufferHeight, MakeViewProj());
+
+    std::vector<float> ReferenceDepth;
+    AddRandomOccluders(Buffer, Rng, 32, ReferenceDepth);
+    RasterizeAndBuildHierarchy(Buffer);
+
+    std::uniform_real_distribution<float> XY{-40.f, 40.f};
+    std::uniform_real_distribution<float> Z{2.f, 80.f};
+    std::uniform_real_distribution<float> Size{0.1f, 10.f};
+
+    Uint32 OccludedCount = 0;
+    for (Uint32 i = 0; i < 2000; ++i)
+    {
+        const float3        Min{XY(Rng), XY(Rng), Z(Rng)};
+        const RadientBounds Bounds = MakeBounds(Min, Min + float3{Size(Rng), Size(Rng), Size(Rng)});
+
+        const bool IsOccluded = Buffer.IsOccluded(Bounds, float4x4::Identity());
+        EXPECT_EQ(IsOccluded, IsOccludedReference(Buffer, Bounds)) << "Box " << i;
+        OccludedCount += IsOccluded ? 1 : 0;
+    }
+    // Both outcomes must be exercised
+    EXPECT_GT(OccludedCount, 0u);
+    EXPECT_LT(OccludedCount, 2000u);
+}
@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientResolutionController.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+RadientRenderScaleDesc MakeDynamicDesc()
+{
+    RadientRenderScaleDesc Desc;
+    Desc.Dynamic         = True;
+    Desc.Scale           = 1.f;
+    Desc.MinScale        = 0.5f;
+    Desc.MaxScale        = 1.f;
+    Desc.ScaleStep       = 0.05f;
+    Desc.TargetFrameTime = 1.f / 60.f;
+    return Desc;
+}
+
+bool IsQuantized(float Scale, const RadientRenderScaleDesc& Desc)
+{
+    const float Steps = Scale / Desc.ScaleStep;
+    return std::abs(Steps - std::round(Steps)) < 1e-3f;
+}
+
+// Runs the controller on the frame times of a pixel-bound workload, whose frame time is
+// proportional to the rendered pixel count, and returns the scale of every frame.
+std::vector<float> RunPixelBoundWorkload(RadientResolutionController& Controller,
+                                         const RadientRenderScaleDesc& Desc,
+                                         float                         FullResFrameTime,
+                                         size_t                        FrameCount)
+{
+    std::vector<float> Scales;
+    float              Scale = Controller.Update(Desc, 0.f);
+    for (size_t i = 0; i < FrameCount; ++i)
+    {
+        Scale = Controller.Update(Desc, FullResFrameTime * Scale * Scale);
+        Scales.push_back(Scale);
+    }
+    return Scales;
+}
+
+} // namespace
+
+TEST(RadientResolutionControllerTest, FixedScale)
+{
+    RadientResolutionController Controller;
+
+    RadientRenderScaleDesc Desc;
+    EXPECT_EQ(Controller.Update(Desc, 1.f), 1.f);
+
+    Desc.Scale = 0.73f;
+    EXPECT_EQ(Controller.Update(Desc, 1.f), 0.73f);
+    EXPECT_EQ(Controller.Update(Desc, 0.001f), 0.73f);
+
+    // A fixed scale is only clamped to the bounds
+    Desc.Scale = 0.2f;
+    EXPECT_EQ(Controller.Update(Desc, 1.f), Desc.MinScale);
+    Desc.Scale = 2.f;
+    EXPECT_EQ(Controller.Update(Desc, 1.f), 1.f);
+}
+
+TEST(RadientResolutionControllerTest, QuantizeScale)
+{
+    RadientRenderScaleDesc Desc = MakeDynamicDesc();
+
+    EXPECT_NEAR(RadientResolutionController::QuantizeScale(0.83f, Desc), 0.8f, 1e-5f);
+    EXPECT_NEAR(RadientResolutionController::QuantizeScale(0.85f, Desc), 0.85f, 1e-5f);
+    EXPECT_EQ(RadientResolutionController::QuantizeScale(0.1f, Desc), Desc.MinScale);
+    EXPECT_EQ(RadientResolutionController::QuantizeScale(1.5f, Desc), 1.f);
+
+    Desc.MinScale = 2.f;
+    EXPECT_EQ(RadientResolutionController::GetMinScale(Desc), 1.f);
+    EXPECT_EQ(RadientResolutionController::GetMaxScale(Desc), 1.f);
+
+    Desc.MinScale = 0.7f;
+    Desc.MaxScale = 0.6f;
+    EXPECT_EQ(RadientResolutionController::GetMaxScale(Desc), 0.7f);
+}
+
+TEST(RadientResolutionControllerTest, RenderSize)
+{
+    EXPECT_EQ(RadientResolutionController::GetRenderSize({1920, 1080}, 1.f), (RadientExtent2D{1920, 1080}));
+    EXPECT_EQ(RadientResolutionController::GetRenderSize({1920, 1080}, 0.5f), (RadientExtent2D{960, 540}));
+    EXPECT_EQ(RadientResolutionController::GetRenderSize({1920, 1080}, 0.75f), (RadientExtent2D{1440, 810}));
+    EXPECT_EQ(RadientResolutionController::GetRenderSize({3, 1}, 0.1f), (RadientExtent2D{1, 1}));
+}
+
+TEST(RadientResolutionControllerTest, OverBudget)
+{
+    const RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    RadientResolutionController  Controller;
+
+    // Twice the budget at the full resolution: the scale that fits is 1/sqrt(2)
+    const std::vector<float> Scales = RunPixelBoundWorkload(Controller, Desc, 2.f * Desc.TargetFrameTime, 300);
+
+    for (size_t i = 0; i < Scales.size(); ++i)
+    {
+        EXPECT_TRUE(IsQuantized(Scales[i], Desc)) << "Frame " << i;
+        if (i > 0)
+        {
+            EXPECT_LE(Scales[i], Scales[i - 1]) << "Frame " << i;
+        }
+    }
+
+    // The first drop lands within the budget at once
+    EXPECT_EQ(Controller.GetChangeCount(), 1u);
+    EXPECT_NEAR(Scales.back(), 0.7f, 1e-5f);
+    EXPECT_LE(2.f * Scales.back() * Scales.back(), 1.f);
+}
+
+TEST(RadientResolutionControllerTest, MinScale)
+{
+    const RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    RadientResolutionController  Controller;
+
+    const std::vector<float> Scales = RunPixelBoundWorkload(Controller, Desc, 10.f * Desc.TargetFrameTime, 300);
+    EXPECT_EQ(Scales.back(), Desc.MinScale);
+}
+
+TEST(RadientResolutionControllerTest, UnderBudget)
+{
+    RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    Desc.Scale                  = 0.5f;
+
+    RadientResolutionController Controller;
+
+    // Half the budget at the full resolution: the scale recovers to the maximum one step at a time
+    const std::vector<float> Scales = RunPixelBoundWorkload(Controller, Desc, 0.5f * Desc.TargetFrameTime, 1000);
+    EXPECT_EQ(Scales.back(), 1.f);
+    EXPECT_EQ(Controller.GetChangeCount(), 10u);
+
+    for (size_t i = 1; i < Scales.size(); ++i)
+    {
+        EXPECT_GE(Scales[i], Scales[i - 1]);
+        EXPECT_LE(Scales[i] - Scales[i - 1], Desc.ScaleStep + 1e-5f);
+    }
+
+    // The scale does not grow quickly
+    EXPECT_EQ(Scales[20], 0.5f);
+}
+
+TEST(RadientResolutionControllerTest, RecoversAfterDrop)
+{
+    const RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    RadientResolutionController  Controller;
+
+    // A heavy stretch drops the scale
+    RunPixelBoundWorkload(Controller, Desc, 2.f * Desc.TargetFrameTime, 100);
+    EXPECT_NEAR(Controller.GetScale(), 0.7f, 1e-5f);
+
+    // Once the load is gone, the scale grows back to the maximum
+    const std::vector<float> Scales = RunPixelBoundWorkload(Controller, Desc, 0.5f * Desc.TargetFrameTime, 1000);
+    EXPECT_EQ(Scales.back(), 1.f);
+}
+
+TEST(RadientResolutionControllerTest, ValidateDesc)
+{
+    RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    EXPECT_TRUE(RadientResolutionController::IsValidDesc(Desc));
+    EXPECT_TRUE(RadientResolutionController::IsValidDesc(RadientRenderScaleDesc{}));
+
+    Desc.ScaleStep = 0;
+    EXPECT_FALSE(RadientResolutionController::IsValidDesc(Desc));
+    Desc.ScaleStep = -0.05f;
+    EXPECT_FALSE(RadientResolutionController::IsValidDesc(Desc));
+
+    Desc                 = MakeDynamicDesc();
+    Desc.TargetFrameTime = 0;
+    EXPECT_FALSE(RadientResolutionController::IsValidDesc(Desc));
+
+    Desc          = MakeDynamicDesc();
+    Desc.MinScale = 0.75f;
+    Desc.MaxScale = 0.75f;
+    EXPECT_TRUE(RadientResolutionController::IsValidDesc(Desc));
+    Desc.MaxScale = 0.7f;
+    EXPECT_FALSE(RadientResolutionController::IsValidDesc(Desc));
+}
+
+TEST(RadientResolutionControllerTest, Hysteresis)
+{
+    RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    Desc.Scale                  = 0.8f;
+
+    RadientResolutionController Controller;
+    Controller.Update(Desc, 0.f);
+
+    // Noisy frame times between 80% and 100% of the budget do not change the scale
+    for (Uint32 i = 0; i < 1000; ++i)
+    {
+        const float Noise = static_cast<float>((i * 7919u) % 100u) / 100.f;
+        EXPECT_EQ(Controller.Update(Desc, Desc.TargetFrameTime * (0.82f + 0.16f * Noise)), 0.8f);
+    }
+    EXPECT_EQ(Controller.GetChangeCount(), 0u);
+}
+
+TEST(RadientResolutionControllerTest, Spikes)
+{
+    const RadientRenderScaleDesc Desc = MakeDynamicDesc();
+    RadientResolutionController  Controller;
+
+    // Single-frame spikes, e.g. resource uploads, are smoothed out
+    for (Uint32 i = 0; i < 600; ++i)
+    {
+        const float FrameTime = (i % 60) == 30 ? 1.5f * Desc.TargetFrameTime : 0.9f * Desc.TargetFrameTime;
+        EXPECT_EQ(Controller.Update(Desc, FrameTime), 1.f);
+    }
+}
+
+TEST(RadientResolutionControllerTest, Reset)
+{
+    RadientRenderScaleDesc      Desc = MakeDynamicDesc();
+    RadientResolutionController Controller;
+
+    RunPixelBoundWorkload(Controller, Desc, 2.f * Desc.TargetFrameTime, 100);
+    EXPECT_LT(Controller.GetScale(), 1.f);
+
+    // Disabling the dynamic resolution restarts it from the initial scale
+    Desc.Dynamic = False;
+    EXPECT_EQ(Controller.Update(Desc, Desc.TargetFrameTime), 1.f);
+    Desc.Dynamic = True;
+    EXPECT_EQ(Controller.Update(Desc, Desc.TargetFrameTime), 1.f);
+
+    // Narrowing the bounds clamps the current scale
+    Desc.MaxScale = 0.6f;
+    EXPECT_EQ(Controller.Update(Desc, Desc.TargetFrameTime), 0.6f);
+}
@@ -0,0 +1,516 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+#include "Scene/RadientSceneCommandQueue.hpp"
+#include "Scene/RadientSceneImpl.hpp"
+#include "Scene/RadientSceneState.hpp"
+#include "Scene/RadientSceneWriterImpl.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr RadientComponentTypeID TestCustomComponentType = 1000;
+
+RadientTransform MakeTranslation(float X, float Y, float Z)
+{
+    RadientTransform Transform;
+    Transform.Position = {X, Y, Z};
+    return Transform;
+}
+
+std::vector<RadientEntityID> CreateEntities(RadientSceneState& State, Uint32 Count)
+{
+    std::vector<RadientEntityID> Entities(Count, InvalidRadientEntityID);
+    for (RadientEntityID& Entity : Entities)
+        EXPECT_EQ(State.CreateEntity(RadientEntityDesc{}, Entity), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    return Entities;
+}
+
+class TestRandom
+{
+public:
+    explicit TestRandom(Uint32 Seed) :
+        m_State{Seed * 747796405u + 2891336453u}
+    {}
+
+    Uint32 Next(Uint32 Range)
+    {
+        m_State = m_State * 1664525u + 1013904223u;
+        return (m_State >> 8u) % Range;
+    }
+
+private:
+    Uint32 m_State;
+};
+
+// Records a fixed pseudo-random command stream for one producer. The stream only depends on the
+// producer ID, so any interleaving of producers must replay to the same scene.
+void RecordProducerWorkload(RadientSceneCommandQueue::Arena&    Arena,
+                            const std::vector<RadientEntityID>& SharedEntities,
+                            Uint32                              CommandCount)
+{
+    TestRandom Random{Arena.GetProducerID() + 1};
+
+    std::vector<RadientEntityID> Created;
+    for (Uint32 CommandIndex = 0; CommandIndex < CommandCount; ++CommandIndex)
+    {
+        const RadientEntityID Shared = SharedEntities[Random.Next(static_cast<Uint32>(SharedEntities.size()))];
+        switch (Random.Next(6))
+        {
+            case 0:
+            {
+                RadientEntityDesc Desc;
+                Desc.Name      = "worker";
+                Desc.Parent    = Created.empty() || Random.Next(2) == 0 ? Shared : Created[Random.Next(static_cast<Uint32>(Created.size()))];
+                Desc.Transform = MakeTranslation(static_cast<float>(CommandIndex), 0.f, 0.f);
+
+                RadientEntityID Entity = InvalidRadientEntityID;
+                EXPECT_EQ(Arena.CreateEntity(Desc, Entity), RADIENT_STATUS_OK);
+                Created.push_back(Entity);
+                break;
+            }
+
+            case 1:
+            case 2:
+                EXPECT_EQ(Arena.SetLocalTransform(Shared, MakeTranslation(static_cast<float>(Arena.GetProducerID()), static_cast<float>(CommandIndex), 0.f)), RADIENT_STATUS_OK);
+                break;
+
+            case 3:
+                if (!Created.empty())
+                    EXPECT_EQ(Arena.SetLocalTransform(Created.back(), MakeTranslation(0.f, 0.f, static_cast<float>(CommandIndex))), RADIENT_STATUS_OK);
+                break;
+
+            case 4:
+            {
+                const Uint32 Value = Arena.GetProducerID() * 100000u + CommandIndex;
+
+                RadientCustomComponentData Component;
+                Component.ComponentType = TestCustomComponentType;
+                Component.Name          = "Counter";
+                Component.pData         = &Value;
+                Component.DataSize      = sizeof(Value);
+                EXPECT_EQ(Arena.SetCustomComponentData(Shared, Component), RADIENT_STATUS_OK);
+                break;
+            }
+
+            case 5:
+                EXPECT_EQ(Arena.SetEntityOwnVisibility(Shared, Random.Next(2) == 0 ? True : False), RADIENT_STATUS_OK);
+                break;
+        }
+    }
+}
+
+struct EntitySnapshot
+{
+    RadientEntityID  Entity = InvalidRadientEntityID;
+    RadientEntityID  Parent = InvalidRadientEntityID;
+    RadientTransform Transform;
+    Bool             Visible            = True;
+    Bool             HasCustomComponent = False;
+
+    bool operator==(const EntitySnapshot& Rhs) const
+    {
+        return Entity == Rhs.Entity &&
+            Parent == Rhs.Parent &&
+            Transform == Rhs.Transform &&
+            Visible == Rhs.Visible &&
+            HasCustomComponent == Rhs.HasCustomComponent;
+    }
+};
+
+std::vector<EntitySnapshot> TakeSnapshot(RadientSceneState& State, RadientEntityID MaxEntity)
+{
+    std::vector<EntitySnapshot> Snapshot;
+    for (RadientEntityID Entity = 1; Entity <= MaxEntity; ++Entity)
+    {
+        if (State.IsEntityAlive(Entity) != RADIENT_STATUS_OK)
+            continue;
+
+        EntitySnapshot Item;
+        Item.Entity = Entity;
+        EXPECT_EQ(State.GetParent(Entity, Item.Parent), RADIENT_STATUS_OK);
+        EXPECT_EQ(State.GetLocalTransform(Entity, Item.Transform), RADIENT_STATUS_OK);
+        EXPECT_EQ(State.GetEntityOwnVisibility(Entity, Item.Visible), RADIENT_STATUS_OK);
+        EXPECT_EQ(State.HasComponent(Entity, TestCustomComponentType, Item.HasCustomComponent), RADIENT_STATUS_OK);
+        Snapshot.push_back(Item);
+    }
+    return Snapshot;
+}
+
+std::vector<EntitySnapshot> RunConcurrentWorkload(Uint32 ProducerCount, Uint32 CommandCount, RadientSceneCommandQueue::ReplayStats& Stats)
+{
+    RadientSceneState                  State;
+    const std::vector<RadientEntityID> SharedEntities = CreateEntities(State, 64);
+
+    RadientSceneCommandQueue                      Queue;
+    std::vector<RadientSceneCommandQueue::Arena*> Arenas(ProducerCount, nullptr);
+    for (Uint32 ProducerID = 0; ProducerID < ProducerCount; ++ProducerID)
+    {
+        Arenas[ProducerID] = Queue.AcquireArena(ProducerID);
+        EXPECT_NE(Arenas[ProducerID], nullptr);
+    }
+
+    std::atomic<Uint32>      ReadyCount{0};
+    std::vector<std::thread> Threads;
+    Threads.reserve(ProducerCount);
+    for (Uint32 ProducerID = 0; ProducerID < ProducerCount; ++ProducerID)
+    {
+        Threads.emplace_back([&, ProducerID]() {
+            ReadyCount.fetch_add(1, std::memory_order_acq_rel);
+            while (ReadyCount.load(std::memory_order_acquire) != ProducerCount)
+                std::this_thread::yield();
+
+            RecordProducerWorkload(*Arenas[ProducerID], SharedEntities, CommandCount);
+        });
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(Queue.Replay(State, &Stats), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+
+    for (RadientSceneCommandQueue::Arena* pArena : Arenas)
+        Queue.ReleaseArena(pArena);
+
+    return TakeSnapshot(State, SharedEntities.size() + ProducerCount * CommandCount);
+}
+
+} // namespace
+
+TEST(RadientSceneCommandQueueTest, DeferredEntitiesResolveAfterReplay)
+{
+    RadientSceneState        State;
+    RadientSceneCommandQueue Queue;
+
+    RadientSceneCommandQueue::Arena* pArena0 = Queue.AcquireArena(0);
+    RadientSceneCommandQueue::Arena* pArena1 = Queue.AcquireArena(1);
+    ASSERT_NE(pArena0, nullptr);
+    ASSERT_NE(pArena1, nullptr);
+
+    RadientEntityID Parent = InvalidRadientEntityID;
+    ASSERT_EQ(pArena1->CreateEntity(RadientEntityDesc{}, Parent), RADIENT_STATUS_OK);
+    EXPECT_TRUE(RadientSceneCommandQueue::IsDeferredEntity(Parent));
+
+    // Producer 0 is replayed first, so its child is created before the parent from producer 1 exists.
+    RadientEntityID   Child = InvalidRadientEntityID;
+    RadientEntityDesc Desc;
+    Desc.Parent    = Parent;
+    Desc.Transform = MakeTranslation(1.f, 2.f, 3.f);
+    ASSERT_EQ(pArena0->CreateEntity(Desc, Child), RADIENT_STATUS_OK);
+    EXPECT_TRUE(RadientSceneCommandQueue::IsDeferredEntity(Child));
+    EXPECT_NE(Child, Parent);
+
+    RadientEntityID Entity = InvalidRadientEntityID;
+    EXPECT_EQ(pArena0->ResolveEntity(Child, Entity), RADIENT_STATUS_PENDING);
+    EXPECT_EQ(pArena0->ResolveEntity(Parent, Entity), RADIENT_STATUS_INVALID_ARGUMENT);
+
+    RadientSceneCommandQueue::ReplayStats Stats;
+    EXPECT_EQ(Queue.Replay(State, &Stats), RADIENT_STATUS_OK);
+    EXPECT_EQ(Stats.NumCommands, 2u);
+    EXPECT_EQ(Stats.NumApplied, 2u);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+
+    RadientEntityID ChildEntity  = InvalidRadientEntityID;
+    RadientEntityID ParentEntity = InvalidRadientEntityID;
+    ASSERT_EQ(pArena0->ResolveEntity(Child, ChildEntity), RADIENT_STATUS_OK);
+    ASSERT_EQ(pArena1->ResolveEntity(Parent, ParentEntity), RADIENT_STATUS_OK);
+    EXPECT_EQ(ChildEntity, 1u);
+    EXPECT_EQ(ParentEntity, 2u);
+
+    RadientEntityID ActualParent = InvalidRadientEntityID;
+    EXPECT_EQ(State.GetParent(ChildEntity, ActualParent), RADIENT_STATUS_OK);
+    EXPECT_EQ(ActualParent, ParentEntity);
+
+    // The desc transform stays local to the deferred parent.
+    RadientTransform Transform;
+    EXPECT_EQ(State.GetLocalTransform(ChildEntity, Transform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Transform, MakeTranslation(1.f, 2.f, 3.f));
+
+    Queue.ReleaseArena(pArena0);
+    Queue.ReleaseArena(pArena1);
+}
+
+TEST(RadientSceneCommandQueueTest, StaleDeferredEntityIsNotFound)
+{
+    RadientSceneState        State;
+    RadientSceneCommandQueue Queue;
+
+    RadientSceneCommandQueue::Arena* pArena = Queue.AcquireArena(0);
+    ASSERT_NE(pArena, nullptr);
+
+    RadientEntityID Deferred = InvalidRadientEntityID;
+    ASSERT_EQ(pArena->CreateEntity(RadientEntityDesc{}, Deferred), RADIENT_STATUS_OK);
+    EXPECT_EQ(Queue.Replay(State), RADIENT_STATUS_OK);
+
+    RadientEntityID NewDeferred = InvalidRadientEntityID;
+    ASSERT_EQ(pArena->CreateEntity(RadientEntityDesc{}, NewDeferred), RADIENT_STATUS_OK);
+    EXPECT_NE(NewDeferred, Deferred);
+    EXPECT_EQ(pArena->SetLocalTransform(Deferred, MakeTranslation(1.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+
+    RadientSceneCommandQueue::ReplayStats Stats;
+    EXPECT_EQ(Queue.Replay(State, &Stats), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(Stats.NumApplied, 1u);
+    EXPECT_EQ(Stats.NumFailed, 1u);
+
+    RadientEntityID Entity = InvalidRadientEntityID;
+    EXPECT_EQ(pArena->ResolveEntity(Deferred, Entity), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(pArena->ResolveEntity(NewDeferred, Entity), RADIENT_STATUS_OK);
+    EXPECT_EQ(Entity, 2u);
+
+    RadientTransform Transform;
+    EXPECT_EQ(State.GetLocalTransform(1, Transform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Transform, RadientTransform{});
+
+    Queue.ReleaseArena(pArena);
+}
+
+TEST(RadientSceneCommandQueueTest, TransformWritesCollapseToLast)
+{
+    RadientSceneState                  State;
+    const std::vector<RadientEntityID> Entities = CreateEntities(State, 2);
+    RadientSceneCommandQueue           Queue;
+
+    RadientSceneCommandQueue::Arena* pArena0 = Queue.AcquireArena(0);
+    RadientSceneCommandQueue::Arena* pArena1 = Queue.AcquireArena(1);
+    ASSERT_NE(pArena0, nullptr);
+    ASSERT_NE(pArena1, nullptr);
+
+    // Producer 1 records first, but producer 0 is replayed first, so producer 1's last write wins.
+    EXPECT_EQ(pArena1->SetLocalTransform(Entities[0], MakeTranslation(1.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena1->SetLocalTransform(Entities[0], MakeTranslation(2.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena0->SetLocalTransform(Entities[0], MakeTranslation(3.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena0->SetLocalTransform(Entities[1], MakeTranslation(4.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena0->SetEntityOwnVisibility(Entities[0], False), RADIENT_STATUS_OK);
+
+    const RadientSceneRevisions Before = State.GetSceneRevisions();
+
+    RadientSceneCommandQueue::ReplayStats Stats;
+    EXPECT_EQ(Queue.Replay(State, &Stats), RADIENT_STATUS_OK);
+    EXPECT_EQ(Stats.NumCommands, 5u);
+    EXPECT_EQ(Stats.NumApplied, 3u);
+    EXPECT_EQ(Stats.NumCoalesced, 2u);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+
+    // One transform write per entity reaches the scene.
+    const RadientSceneRevisions After = State.GetSceneRevisions();
+    EXPECT_EQ(After.Transforms, Before.Transforms + 2);
+
+    RadientTransform Transform;
+    EXPECT_EQ(State.GetLocalTransform(Entities[0], Transform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Transform, MakeTranslation(2.f, 0.f, 0.f));
+    EXPECT_EQ(State.GetLocalTransform(Entities[1], Transform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Transform, MakeTranslation(4.f, 0.f, 0.f));
+
+    Bool Visible = True;
+    EXPECT_EQ(State.GetEntityOwnVisibility(Entities[0], Visible), RADIENT_STATUS_OK);
+    EXPECT_EQ(Visible, False);
+
+    Queue.ReleaseArena(pArena0);
+    Queue.ReleaseArena(pArena1);
+}
+
+TEST(RadientSceneCommandQueueTest, DestroySupersedesOtherCommands)
+{
+    RadientSceneState                  State;
+    const std::vector<RadientEntityID> Entities = CreateEntities(State, 3);
+    RadientSceneCommandQueue           Queue;
+
+    ASSERT_EQ(State.SetParent(Entities[2], Entities[1], False), RADIENT_STATUS_OK);
+    ASSERT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+
+    RadientSceneCommandQueue::Arena* pArena = Queue.AcquireArena(0);
+    ASSERT_NE(pArena, nullptr);
+
+    // Entities[1] is destroyed before its child in entity order; destroying the child must not fail.
+    EXPECT_EQ(pArena->DestroyEntity(Entities[2]), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena->SetLocalTransform(Entities[0], MakeTranslation(1.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena->DestroyEntity(Entities[0]), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena->SetLocalTransform(Entities[0], MakeTranslation(2.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(pArena->DestroyEntity(Entities[1]), RADIENT_STATUS_OK);
+
+    RadientSceneCommandQueue::ReplayStats Stats;
+    EXPECT_EQ(Queue.Replay(State, &Stats), RADIENT_STATUS_OK);
+    EXPECT_EQ(Stats.NumCommands, 5u);
+    EXPECT_EQ(Stats.NumApplied, 3u);
+    EXPECT_EQ(Stats.NumCoalesced, 2u);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+
+    for (const RadientEntityID Entity : Entities)
+        EXPECT_EQ(State.IsEntityAlive(Entity), RADIENT_STATUS_NOT_FOUND);
+
+    Queue.ReleaseArena(pArena);
+}
+
+TEST(RadientSceneCommandQueueTest, CustomComponentPayloadIsCopied)
+{
+    RadientSceneState                  State;
+    const std::vector<RadientEntityID> Entities = CreateEntities(State, 1);
+    RadientSceneCommandQueue           Queue;
+
+    RadientSceneCommandQueue::Arena* pArena = Queue.AcquireArena(0);
+    ASSERT_NE(pArena, nullptr);
+
+    {
+        std::vector<Uint8> Data = {1, 2, 3, 4, 5};
+
+        RadientCustomComponentData Component;
+        Component.ComponentType = TestCustomComponentType;
+        Component.Name          = "Payload";
+        Component.Schema        = "test.bytes";
+        Component.Version       = 2;
+        Component.pData         = Data.data();
+        Component.DataSize      = static_cast<Uint32>(Data.size());
+        EXPECT_EQ(pArena->SetCustomComponentData(Entities[0], Component), RADIENT_STATUS_OK);
+        Data.assign(Data.size(), 0);
+    }
+
+    const RadientSceneRevisions Before = State.GetSceneRevisions();
+    EXPECT_EQ(Queue.Replay(State), RADIENT_STATUS_OK);
+
+    Bool HasComponent = False;
+    EXPECT_EQ(State.HasComponent(Entities[0], TestCustomComponentType, HasComponent), RADIENT_STATUS_OK);
+    EXPECT_EQ(HasComponent, True);
+    EXPECT_EQ(State.GetSceneRevisions().CustomComponents, Before.CustomComponents + 1);
+
+    Queue.ReleaseArena(pArena);
+}
+
+TEST(RadientSceneCommandQueueTest, ProducerIDsAreExclusive)
+{
+    RadientSceneCommandQueue Queue;
+
+    RadientSceneCommandQueue::Arena* pArena = Queue.AcquireArena(5);
+    ASSERT_NE(pArena, nullptr);
+    EXPECT_EQ(Queue.AcquireArena(5), nullptr);
+    EXPECT_EQ(Queue.AcquireArena(RadientSceneCommandQueue::MaxProducerID + 1), nullptr);
+
+    // Commands recorded before release are kept for replay.
+    EXPECT_EQ(pArena->SetLocalTransform(InvalidRadientEntityID, RadientTransform{}), RADIENT_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(pArena->SetLocalTransform(1, MakeTranslation(1.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    Queue.ReleaseArena(pArena);
+
+    RadientSceneCommandQueue::Arena* pSameArena = Queue.AcquireArena(5);
+    EXPECT_EQ(pSameArena, pArena);
+    ASSERT_NE(pSameArena, nullptr);
+    EXPECT_EQ(pSameArena->GetCommandCount(), size_t{1});
+    Queue.ReleaseArena(pSameArena);
+}
+
+TEST(RadientSceneCommandQueueTest, ConcurrentProducersStress)
+{
+    static constexpr Uint32 ProducerCount = 8;
+    static constexpr Uint32 CommandCount  = 4096;
+
+    RadientSceneCommandQueue::ReplayStats Stats;
+    const std::vector<EntitySnapshot>     Snapshot = RunConcurrentWorkload(ProducerCount, CommandCount, Stats);
+
+    EXPECT_EQ(Stats.NumFailed, 0u);
+    EXPECT_EQ(Stats.NumApplied + Stats.NumCoalesced, Stats.NumCommands);
+    EXPECT_GT(Stats.NumCoalesced, 0u);
+    EXPECT_GT(Snapshot.size(), size_t{64});
+}
+
+TEST(RadientSceneCommandQueueTest, ReplayIsIndependentOfThreadScheduling)
+{
+    static constexpr Uint32 ProducerCount = 6;
+    static constexpr Uint32 CommandCount  = 1024;
+
+    // Reference: record every producer on this thread in reverse order.
+    RadientSceneState                  ReferenceState;
+    const std::vector<RadientEntityID> SharedEntities = CreateEntities(ReferenceState, 64);
+    {
+        RadientSceneCommandQueue Queue;
+        for (Uint32 ProducerID = ProducerCount; ProducerID-- > 0;)
+        {
+            RadientSceneCommandQueue::Arena* pArena = Queue.AcquireArena(ProducerID);
+            ASSERT_NE(pArena, nullptr);
+            RecordProducerWorkload(*pArena, SharedEntities, CommandCount);
+            Queue.ReleaseArena(pArena);
+        }
+        EXPECT_EQ(Queue.Replay(ReferenceState), RADIENT_STATUS_OK);
+        EXPECT_EQ(ReferenceState.CommitChanges(), RADIENT_STATUS_OK);
+    }
+    const std::vector<EntitySnapshot> Reference = TakeSnapshot(ReferenceState, SharedEntities.size() + ProducerCount * CommandCount);
+
+    for (Uint32 Run = 0; Run < 4; ++Run)
+    {
+        RadientSceneCommandQueue::ReplayStats Stats;
+        const std::vector<EntitySnapshot>     Snapshot = RunConcurrentWorkload(ProducerCount, CommandCount, Stats);
+        ASSERT_EQ(Snapshot.size(), Reference.size()) << "Run " << Run;
+        for (size_t i = 0; i < Snapshot.size(); ++i)
+            EXPECT_TRUE(Snapshot[i] == Reference[i]) << "Run " << Run << ", entity " << Reference[i].Entity;
+    }
+}
+
+TEST(RadientSceneCommandQueueTest, WriterReplaysRecordersOnCommit)
+{
+    RefCntAutoPtr<RadientSceneImpl> pScene = RadientSceneImpl::Create();
+    ASSERT_NE(pScene, nullptr);
+
+    RefCntAutoPtr<IRadientSceneWriter> pWriter = RadientSceneWriterImpl::Create(pScene);
+    ASSERT_NE(pWriter, nullptr);
+
+    RefCntAutoPtr<IRadientSceneCommandRecorder> pRecorder;
+    ASSERT_EQ(pWriter->CreateCommandRecorder(7, &pRecorder), RADIENT_STATUS_OK);
+    ASSERT_NE(pRecorder, nullptr);
+    EXPECT_EQ(pRecorder->GetProducerID(), 7u);
+
+    RefCntAutoPtr<IRadientSceneCommandRecorder> pDuplicate;
+    EXPECT_EQ(pWriter->CreateCommandRecorder(7, &pDuplicate), RADIENT_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(pDuplicate, nullptr);
+
+    RadientEntityID Deferred = InvalidRadientEntityID;
+    std::thread     Worker{[&]() {
+        EXPECT_EQ(pRecorder->CreateEntity(RadientEntityDesc{}, Deferred), RADIENT_STATUS_OK);
+        EXPECT_EQ(pRecorder->SetLocalTransform(Deferred, MakeTranslation(5.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    }};
+    Worker.join();
+
+    EXPECT_EQ(pWriter->CommitChanges(), RADIENT_STATUS_OK);
+
+    RadientEntityID Entity = InvalidRadientEntityID;
+    ASSERT_EQ(pRecorder->ResolveEntity(Deferred, Entity), RADIENT_STATUS_OK);
+
+    RadientTransform Transform;
+    EXPECT_EQ(pScene->GetLocalTransform(Entity, Transform), RADIENT_STATUS_OK);
+    EXPECT_EQ(Transform, MakeTranslation(5.f, 0.f, 0.f));
+
+    // The writer may be released before the recorder.
+    pWriter.Release();
+    pRecorder.Release();
+}
@@ -1191,6 +1191,18 @@ TEST(RadientSceneDrawableCacheTest, RendererChangeUpdatesExistingDrawableSlots)
     const RadientEntityID Entity = AddReadyRenderableEntity(MeshProvider, DrawableCache, *pScene, *pWriter, pMesh);
     ASSERT_NE(Entity, InvalidRadientEntityID);
 
+    const GLTF::Material::ALPHA_MODE AlphaModes[] =
+        {
+            GLTF::Material::ALPHA_MODE_OPAQUE,
+            GLTF::Material::ALPHA_MODE_MASK,
+            GLTF::Material::ALPHA_MODE_BLEND,
+        };
+    for (const GLTF::Material::ALPHA_MODE AlphaMode : AlphaModes)
+    {
+        for (const Uint64 Mask : DrawableCache.GetDrawList(AlphaMode).GetVisibilityMasks())
+            EXPECT_EQ(Mask, ~Uint64{0});
+    }
+
     // Renderer data is per-renderable metadata. Existing primitive slots should
     // update their renderer reference without asking the mesh provider again.
     RadientMeshRendererComponent Renderer;
@@ -1198,11 +1210,14 @@ TEST(RadientSceneDrawableCacheTest, RendererChangeUpdatesExistingDrawableSlots)
     EXPECT_EQ(pWriter->SetMeshRenderer(Entity, Renderer), RADIENT_STATUS_OK);
     EXPECT_EQ(pWriter->CommitChanges(), RADIENT_STATUS_OK);
 
+    const Uint64 DrawListRevision = DrawableCache.GetDrawListRevision();
+
     MeshProvider.NumCalls = 0;
     EXPECT_EQ(DrawableCache.SyncScene(*pScene), RADIENT_STATUS_OK);
     EXPECT_EQ(MeshProvider.NumCalls, 0u);
     ExpectDrawableChangeCounts(DrawableCache, 0u, 0u, 6u);
     ExpectDrawListsForEntities(DrawableCache, Model, {Entity});
+    EXPECT_NE(DrawableCache.GetDrawListRevision(), DrawListRevision);
 
     for (const RadientDrawableChange& Change : DrawableCache.GetDrawableChanges())
     {
@@ -1211,6 +1226,23 @@ TEST(RadientSceneDrawableCacheTest, RendererChangeUpdatesExistingDrawableSlots)
         ASSERT_NE(pSlot->pRenderer, nullptr);
         EXPECT_EQ(pSlot->pRenderer->VisibilityMask, Renderer.VisibilityMask);
     }
+
+    // The mask column of the draw lists follows the renderer mask
+    for (const GLTF::Material::ALPHA_MODE AlphaMode : AlphaModes)
+    {
+        const RadientDrawList& DrawList = DrawableCache.GetDrawList(AlphaMode);
+        ASSERT_EQ(DrawList.GetVisibilityMasks().size(), DrawList.GetItemCount());
+        for (const Uint64 Mask : DrawList.GetVisibilityMasks())
+            EXPECT_EQ(Mask, Renderer.VisibilityMask);
+
+        std::vector<RadientDrawableID> DrawableIDs;
+        DrawList.FilterByLayerMask(0x0004u, DrawableIDs);
+        EXPECT_EQ(DrawableIDs.size(), DrawList.GetItemCount());
+
+        DrawableIDs.clear();
+        DrawList.FilterByLayerMask(0x0001u, DrawableIDs);
+        EXPECT_TRUE(DrawableIDs.empty());
+    }
 }
 
 TEST(RadientSceneDrawableCacheTest, RemovingMiddleRenderableRepairsDrawListIndices)
@@ -1451,6 +1483,8 @@ TEST(RadientSceneDrawableCacheTest, VisibilityPointerTracksHierarchyWithoutDrawa
     EXPECT_EQ(pWriter->SetParent(Entity, HiddenParent, False), RADIENT_STATUS_OK);
     EXPECT_EQ(pWriter->CommitChanges(), RADIENT_STATUS_OK);
 
+    Uint64 DrawListRevision = DrawableCache.GetDrawListRevision();
+
     MeshProvider.NumCalls = 0;
     EXPECT_EQ(DrawableCache.SyncScene(*pScene), RADIENT_STATUS_OK);
     EXPECT_EQ(MeshProvider.NumCalls, 0u);
@@ -1458,6 +1492,12 @@ TEST(RadientSceneDrawableCacheTest, VisibilityPointerTracksHierarchyWithoutDrawa
     EXPECT_EQ(pSlot->pEffectiveVisible, pEffectiveVisible);
     EXPECT_FALSE(*pEffectiveVisible);
 
+    // Render passes that cache lists filtered by effective visibility must rebuild them
+    EXPECT_NE(DrawableCache.GetDrawListRevision(), DrawListRevision);
+    DrawListRevision = DrawableCache.GetDrawListRevision();
+    EXPECT_EQ(DrawableCache.SyncScene(*pScene), RADIENT_STATUS_NO_CHANGE);
+    EXPECT_EQ(DrawableCache.GetDrawListRevision(), DrawListRevision);
+
     // Removing the parent restores effective visibility through the same
     // pointer and still does not require a drawable-list update.
     EXPECT_EQ(pWriter->SetParent(Entity, InvalidRadientEntityID, False), RADIENT_STATUS_OK);
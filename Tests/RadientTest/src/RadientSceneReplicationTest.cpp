@@ -0,0 +1,615 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+#include "RadientTestAssetHelpers.hpp"
+#include "Scene/RadientSceneReplication.hpp"
+#include "Scene/RadientSceneState.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr RadientComponentTypeID TestCustomComponentType  = 1000;
+constexpr RadientComponentTypeID TestCustomComponentType2 = 1001;
+
+RadientTransform MakeTransform(float X, float Y, float Z, float Angle = 0.f, float Scale = 1.f)
+{
+    RadientTransform Transform;
+    Transform.Position = {X, Y, Z};
+    Transform.Rotation = {0.f, std::sin(Angle * 0.5f), 0.f, std::cos(Angle * 0.5f)};
+    Transform.Scale    = {Scale, Scale, Scale};
+    return Transform;
+}
+
+RADIENT_STATUS SetCustomValue(RadientSceneState& State, RadientEntityID Entity, RadientComponentTypeID ComponentType, Uint32 Value)
+{
+    RadientCustomComponentData Component;
+    Component.ComponentType = ComponentType;
+    Component.Name          = "Counter";
+    Component.Schema        = "u32";
+    Component.Version       = 3;
+    Component.pData         = &Value;
+    Component.DataSize      = sizeof(Value);
+    return State.SetCustomComponentData(Entity, Component);
+}
+
+class TestAssetLibrary
+{
+public:
+    TestAssetLibrary()
+    {
+        Add(MakeTestMeshAsset("mesh://cube", 2));
+        Add(MakeTestMeshAsset("mesh://sphere", 5));
+        Add(MakeTestMaterialAsset("material://red", 1));
+        Add(MakeTestMaterialAsset("material://blue", 7));
+        Add(MakeTestTextureAsset("texture://sky", 4));
+    }
+
+    template <typename AssetType>
+    AssetType* Get(const char* URI) const
+    {
+        return static_cast<AssetType*>(m_Assets.at(URI).RawPtr());
+    }
+
+    static RefCntAutoPtr<IRadientAsset> Resolve(const RadientAssetReference& Ref, RADIENT_ASSET_TYPE Type, void* pUserData)
+    {
+        const TestAssetLibrary* pLibrary = static_cast<const TestAssetLibrary*>(pUserData);
+
+        const auto It = pLibrary->m_Assets.find(Ref.URI);
+        if (It == pLibrary->m_Assets.end() || It->second->GetReference().Version != Ref.Version)
+            return {};
+        return It->second;
+    }
+
+private:
+    template <typename AssetType>
+    void Add(const RefCntAutoPtr<AssetType>& pAsset)
+    {
+        m_Assets.emplace(pAsset->GetReference().URI, RefCntAutoPtr<IRadientAsset>{pAsset, IID_RadientAsset});
+    }
+
+private:
+    std::map<std::string, RefCntAutoPtr<IRadientAsset>> m_Assets;
+};
+
+std::string GetAssetURI(const IRadientAsset* pAsset)
+{
+    return pAsset != nullptr && pAsset->GetReference().URI != nullptr ? pAsset->GetReference().URI : "";
+}
+
+float TransformTolerance(float Precision)
+{
+    // Half a quantization step plus float rounding of the reconstructed value.
+    return Precision * 0.5f + 1e-4f;
+}
+
+void ExpectTransformsNear(const RadientTransform& Expected, const RadientTransform& Actual, const RadientSceneDeltaEncoder::Desc& Desc)
+{
+    const float PositionTolerance = Desc.QuantizeTransforms ? TransformTolerance(Desc.PositionPrecision) : 0.f;
+    const float ScaleTolerance    = Desc.QuantizeTransforms ? TransformTolerance(Desc.ScalePrecision) : 0.f;
+
+    EXPECT_NEAR(Actual.Position.x, Expected.Position.x, PositionTolerance);
+    EXPECT_NEAR(Actual.Position.y, Expected.Position.y, PositionTolerance);
+    EXPECT_NEAR(Actual.Position.z, Expected.Position.z, PositionTolerance);
+    EXPECT_NEAR(Actual.Scale.x, Expected.Scale.x, ScaleTolerance);
+    EXPECT_NEAR(Actual.Scale.y, Expected.Scale.y, ScaleTolerance);
+    EXPECT_NEAR(Actual.Scale.z, Expected.Scale.z, ScaleTolerance);
+
+    // q and -q are the same rotation.
+    const float Dot = Expected.Rotation.x * Actual.Rotation.x + Expected.Rotation.y * Actual.Rotation.y +
+        Expected.Rotation.z * Actual.Rotation.z + Expected.Rotation.w * Actual.Rotation.w;
+    EXPECT_GT(std::abs(Dot), 1.f - 1e-4f);
+}
+
+void ExpectCustomComponentsEqual(const RadientSceneState& Source, RadientEntityID SourceEntity, const RadientSceneState& Replica, RadientEntityID ReplicaEntity)
+{
+    const RadientComponentTypeID* pSourceTypes   = nullptr;
+    Uint32                        NumSourceTypes = 0;
+    ASSERT_EQ(Source.GetCustomComponentTypes(SourceEntity, pSourceTypes, NumSourceTypes), RADIENT_STATUS_OK);
+
+    const RadientComponentTypeID* pReplicaTypes   = nullptr;
+    Uint32                        NumReplicaTypes = 0;
+    ASSERT_EQ(Replica.GetCustomComponentTypes(ReplicaEntity, pReplicaTypes, NumReplicaTypes), RADIENT_STATUS_OK);
+
+    std::vector<RadientComponentTypeID> SourceTypes(pSourceTypes, pSourceTypes + NumSourceTypes);
+    std::vector<RadientComponentTypeID> ReplicaTypes(pReplicaTypes, pReplicaTypes + NumReplicaTypes);
+    std::sort(SourceTypes.begin(), SourceTypes.end());
+    std::sort(ReplicaTypes.begin(), ReplicaTypes.end());
+    ASSERT_EQ(SourceTypes, ReplicaTypes);
+
+    for (RadientComponentTypeID ComponentType : SourceTypes)
+    {
+        RadientCustomComponentData SourceData;
+        RadientCustomComponentData ReplicaData;
+        ASSERT_EQ(Source.GetCustomComponentData(SourceEntity, ComponentType, SourceData), RADIENT_STATUS_OK);
+        ASSERT_EQ(Replica.GetCustomComponentData(ReplicaEntity, ComponentType, ReplicaData), RADIENT_STATUS_OK);
+        EXPECT_STREQ(SourceData.Name, ReplicaData.Name);
+        EXPECT_STREQ(SourceData.Schema, ReplicaData.Schema);
+        EXPECT_EQ(SourceData.Version, ReplicaData.Version);
+        ASSERT_EQ(SourceData.DataSize, ReplicaData.DataSize);
+        EXPECT_EQ(std::memcmp(SourceData.pData, ReplicaData.pData, SourceData.DataSize), 0);
+    }
+}
+
+void ExpectReplicaMatches(const RadientSceneState&              Source,
+                          const RadientSceneState&              Replica,
+                          const RadientSceneDeltaDecoder&       Decoder,
+                          const RadientSceneDeltaEncoder::Desc& EncoderDesc)
+{
+    Uint32 NumSourceEntities = 0;
+    Source.EnumerateEntities([&](RadientEntityID SourceEntity) {
+        ++NumSourceEntities;
+
+        const RadientEntityID ReplicaEntity = Decoder.FindEntity(SourceEntity);
+        ASSERT_NE(ReplicaEntity, InvalidRadientEntityID) << "Source entity " << SourceEntity;
+        ASSERT_EQ(Replica.IsEntityAlive(ReplicaEntity), RADIENT_STATUS_OK);
+
+        const Char* SourceName  = nullptr;
+        const Char* ReplicaName = nullptr;
+        EXPECT_EQ(Source.GetEntityName(SourceEntity, SourceName), RADIENT_STATUS_OK);
+        EXPECT_EQ(Replica.GetEntityName(ReplicaEntity, ReplicaName), RADIENT_STATUS_OK);
+        EXPECT_STREQ(SourceName, ReplicaName);
+
+        RADIENT_ENTITY_FLAGS SourceFlags  = RADIENT_ENTITY_FLAG_NONE;
+        RADIENT_ENTITY_FLAGS ReplicaFlags = RADIENT_ENTITY_FLAG_NONE;
+        EXPECT_EQ(Source.GetEntityFlags(SourceEntity, SourceFlags), RADIENT_STATUS_OK);
+        EXPECT_EQ(Replica.GetEntityFlags(ReplicaEntity, ReplicaFlags), RADIENT_STATUS_OK);
+        EXPECT_EQ(SourceFlags, ReplicaFlags);
+
+        RadientEntityID SourceParent  = InvalidRadientEntityID;
+        RadientEntityID ReplicaParent = InvalidRadientEntityID;
+        EXPECT_EQ(Source.GetParent(SourceEntity, SourceParent), RADIENT_STATUS_OK);
+        EXPECT_EQ(Replica.GetParent(ReplicaEntity, ReplicaParent), RADIENT_STATUS_OK);
+        EXPECT_EQ(Decoder.FindEntity(SourceParent), ReplicaParent);
+
+        RadientTransform SourceTransform;
+        RadientTransform ReplicaTransform;
+        EXPECT_EQ(Source.GetLocalTransform(SourceEntity, SourceTransform), RADIENT_STATUS_OK);
+        EXPECT_EQ(Replica.GetLocalTransform(ReplicaEntity, ReplicaTransform), RADIENT_STATUS_OK);
+        ExpectTransformsNear(SourceTransform, ReplicaTransform, EncoderDesc);
+
+        RadientCameraComponent SourceCamera;
+        RadientCameraComponent ReplicaCamera;
+        EXPECT_EQ(Source.GetCamera(SourceEntity, SourceCamera), Replica.GetCamera(ReplicaEntity, ReplicaCamera));
+        EXPECT_EQ(SourceCamera, ReplicaCamera);
+
+        RadientMeshComponent SourceMesh;
+        RadientMeshComponent ReplicaMesh;
+        EXPECT_EQ(Source.GetMesh(SourceEntity, SourceMesh), Replica.GetMesh(ReplicaEntity, ReplicaMesh));
+        EXPECT_EQ(GetAssetURI(SourceMesh.pMesh), GetAssetURI(ReplicaMesh.pMesh));
+
+        RadientMeshRendererComponent SourceRenderer;
+        RadientMeshRendererComponent ReplicaRenderer;
+        EXPECT_EQ(Source.GetMeshRenderer(SourceEntity, SourceRenderer), Replica.GetMeshRenderer(ReplicaEntity, ReplicaRenderer));
+        EXPECT_EQ(SourceRenderer, ReplicaRenderer);
+
+        RadientMaterialBindingsComponent SourceBindings;
+        RadientMaterialBindingsComponent ReplicaBindings;
+        EXPECT_EQ(Source.GetMaterialBindings(SourceEntity, SourceBindings), Replica.GetMaterialBindings(ReplicaEntity, ReplicaBindings));
+        ASSERT_EQ(SourceBindings.BindingCount, ReplicaBindings.BindingCount);
+        for (Uint32 i = 0; i < SourceBindings.BindingCount; ++i)
+        {
+            EXPECT_EQ(SourceBindings.pBindings[i].PrimitiveIndex, ReplicaBindings.pBindings[i].PrimitiveIndex);
+            EXPECT_EQ(GetAssetURI(SourceBindings.pBindings[i].pMaterial), GetAssetURI(ReplicaBindings.pBindings[i].pMaterial));
+        }
+
+        RadientLightComponent SourceLight;
+        RadientLightComponent ReplicaLight;
+        EXPECT_EQ(Source.GetLight(SourceEntity, SourceLight), Replica.GetLight(ReplicaEntity, ReplicaLight));
+        EXPECT_EQ(SourceLight, ReplicaLight);
+
+        ExpectCustomComponentsEqual(Source, SourceEntity, Replica, ReplicaEntity);
+    });
+
+    Uint32 NumReplicaEntities = 0;
+    Replica.EnumerateEntities([&](RadientEntityID) { ++NumReplicaEntities; });
+    EXPECT_EQ(NumSourceEntities, NumReplicaEntities);
+
+    const RadientEnvironmentDesc& SourceEnvironment  = Source.GetEnvironment();
+    const RadientEnvironmentDesc& ReplicaEnvironment = Replica.GetEnvironment();
+    EXPECT_EQ(GetAssetURI(SourceEnvironment.pEnvironmentMap), GetAssetURI(ReplicaEnvironment.pEnvironmentMap));
+    EXPECT_EQ(SourceEnvironment.Color, ReplicaEnvironment.Color);
+    EXPECT_EQ(SourceEnvironment.Intensity, ReplicaEnvironment.Intensity);
+    EXPECT_EQ(SourceEnvironment.Exposure, ReplicaEnvironment.Exposure);
+}
+
+class ReplicationHarness
+{
+public:
+    explicit ReplicationHarness(const RadientSceneDeltaEncoder::Desc& EncoderDesc = {}) :
+        Encoder{EncoderDesc}
+    {
+        Decoder.SetResolveAssetCallback(TestAssetLibrary::Resolve, &Assets);
+    }
+
+    // Encodes one frame and returns its bytes.
+    std::vector<Uint8> Encode()
+    {
+        EXPECT_EQ(Source.CommitChanges(), RADIENT_STATUS_OK);
+
+        std::vector<Uint8> Frame;
+        EXPECT_EQ(Encoder.EncodeFrame(Source, Frame), RADIENT_STATUS_OK);
+        EXPECT_EQ(Encoder.GetLastFrameStats().NumBytes, Frame.size());
+        return Frame;
+    }
+
+    RADIENT_STATUS Decode(const std::vector<Uint8>& Frame)
+    {
+        size_t               BytesConsumed = 0;
+        const RADIENT_STATUS Status        = Decoder.DecodeFrame(Frame.data(), Frame.size(), Replica, BytesConsumed);
+        EXPECT_EQ(BytesConsumed, Frame.size());
+        EXPECT_EQ(Replica.CommitChanges(), RADIENT_STATUS_OK);
+        return Status;
+    }
+
+    void SyncAndCompare()
+    {
+        EXPECT_EQ(Decode(Encode()), RADIENT_STATUS_OK);
+        EXPECT_EQ(Decoder.GetLastFrameStats().NumFailed, 0u);
+        EXPECT_EQ(Decoder.GetSourceRevisions(), Source.GetSceneRevisions());
+        ExpectReplicaMatches(Source, Replica, Decoder, Encoder.GetDesc());
+    }
+
+    RadientEntityID CreateEntity(const char* Name, RadientEntityID Parent, const RadientTransform& Transform)
+    {
+        RadientEntityDesc Desc;
+        Desc.Name      = Name;
+        Desc.Parent    = Parent;
+        Desc.Transform = Transform;
+
+        RadientEntityID Entity = InvalidRadientEntityID;
+        EXPECT_EQ(Source.CreateEntity(Desc, Entity), RADIENT_STATUS_OK);
+        return Entity;
+    }
+
+    TestAssetLibrary         Assets;
+    RadientSceneState        Source;
+    RadientSceneState        Replica;
+    RadientSceneDeltaEncoder Encoder;
+    RadientSceneDeltaDecoder Decoder;
+};
+
+TEST(RadientSceneReplicationTest, ReplicatesSceneChanges)
+{
+    ReplicationHarness H;
+
+    const RadientEntityID Root   = H.CreateEntity("Root", InvalidRadientEntityID, MakeTransform(1.f, 2.f, 3.f));
+    const RadientEntityID Child  = H.CreateEntity("Child", Root, MakeTransform(-4.25f, 0.5f, 10.f, 0.7f, 2.f));
+    const RadientEntityID Lamp   = H.CreateEntity("Lamp", Root, MakeTransform(0.f, 5.f, 0.f));
+    const RadientEntityID Camera = H.CreateEntity("Camera", InvalidRadientEntityID, MakeTransform(0.f, 1.f, -10.f, 3.f));
+
+    RadientMeshComponent Mesh;
+    Mesh.pMesh = H.Assets.Get<IRadientMeshAsset>("mesh://cube");
+    EXPECT_EQ(H.Source.SetMesh(Child, Mesh), RADIENT_STATUS_OK);
+
+    RadientMeshRendererComponent Renderer;
+    Renderer.VisibilityMask = 0x5;
+    Renderer.SortBias       = 0.25f;
+    Renderer.CastShadows    = False;
+    Renderer.Occluder       = True;
+    EXPECT_EQ(H.Source.SetMeshRenderer(Child, Renderer), RADIENT_STATUS_OK);
+
+    RadientMaterialBinding Bindings[2];
+    Bindings[0].PrimitiveIndex = 0;
+    Bindings[0].pMaterial      = H.Assets.Get<IRadientMaterialAsset>("material://red");
+    Bindings[1].PrimitiveIndex = 3;
+    Bindings[1].pMaterial      = H.Assets.Get<IRadientMaterialAsset>("material://blue");
+    RadientMaterialBindingsComponent MaterialBindings;
+    MaterialBindings.pBindings    = Bindings;
+    MaterialBindings.BindingCount = 2;
+    EXPECT_EQ(H.Source.SetMaterialBindings(Child, MaterialBindings), RADIENT_STATUS_OK);
+
+    RadientLightComponent Light;
+    Light.Type        = RADIENT_LIGHT_TYPE_POINT;
+    Light.Intensity   = 12.f;
+    Light.Normalize   = True;
+    Light.CastShadows = True;
+    EXPECT_EQ(H.Source.SetLight(Lamp, Light), RADIENT_STATUS_OK);
+
+    RadientCameraComponent CameraComponent;
+    CameraComponent.FocalLength = 3.5f;
+    EXPECT_EQ(H.Source.SetCamera(Camera, CameraComponent), RADIENT_STATUS_OK);
+
+    EXPECT_EQ(SetCustomValue(H.Source, Root, TestCustomComponentType, 42), RADIENT_STATUS_OK);
+    EXPECT_EQ(SetCustomValue(H.Source, Root, TestCustomComponentType2, 7), RADIENT_STATUS_OK);
+
+    RadientEnvironmentDesc Environment;
+    Environment.pEnvironmentMap = H.Assets.Get<IRadientTextureAsset>("texture://sky");
+    Environment.Intensity       = 0.5f;
+    EXPECT_EQ(H.Source.SetEnvironment(Environment), RADIENT_STATUS_OK);
+
+    H.SyncAndCompare();
+    EXPECT_TRUE(H.Decoder.GetLastFrameStats().IsKeyframe);
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumCreated, 4u);
+
+    // Hierarchy, transform and component updates.
+    EXPECT_EQ(H.Source.SetParent(Lamp, Camera, False), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.SetLocalTransform(Child, MakeTransform(-4.f, 0.5f, 11.f, -0.3f, 2.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.SetEntityOwnVisibility(Camera, False), RADIENT_STATUS_OK);
+    Mesh.pMesh = H.Assets.Get<IRadientMeshAsset>("mesh://sphere");
+    EXPECT_EQ(H.Source.SetMesh(Child, Mesh), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.RemoveComponent(Child, RADIENT_COMPONENT_TYPE_MESH_RENDERER), RADIENT_STATUS_OK);
+    EXPECT_EQ(SetCustomValue(H.Source, Root, TestCustomComponentType, 43), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.RemoveComponent(Root, TestCustomComponentType2), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+    EXPECT_FALSE(H.Decoder.GetLastFrameStats().IsKeyframe);
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumUpdated, 4u);
+
+    // A new subtree is created and an existing one is destroyed in the same frame.
+    // The child is created before its parent is, to check that parents are resolved after creation.
+    const RadientEntityID NewParent = H.CreateEntity("NewParent", InvalidRadientEntityID, MakeTransform(7.f, 0.f, 0.f));
+    const RadientEntityID NewChild  = H.CreateEntity("NewChild", InvalidRadientEntityID, MakeTransform(0.f, 0.f, 1.f));
+    EXPECT_EQ(H.Source.SetParent(NewParent, NewChild, False), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.DestroyEntity(Root), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumCreated, 2u);
+    EXPECT_EQ(H.Decoder.FindEntity(Root), InvalidRadientEntityID);
+    EXPECT_EQ(H.Decoder.FindEntity(Child), InvalidRadientEntityID);
+
+    // Parent and child swap places within one frame.
+    EXPECT_EQ(H.Source.SetParent(NewParent, InvalidRadientEntityID, False), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Source.SetParent(NewChild, NewParent, False), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+}
+
+TEST(RadientSceneReplicationTest, RawTransformsReplicateExactly)
+{
+    RadientSceneDeltaEncoder::Desc Desc;
+    Desc.QuantizeTransforms = false;
+
+    ReplicationHarness H{Desc};
+
+    const RadientEntityID Entity = H.CreateEntity("Entity", InvalidRadientEntityID, MakeTransform(0.123456f, -98.7654f, 1e-3f, 1.234f, 0.75f));
+    H.SyncAndCompare();
+
+    EXPECT_EQ(H.Source.SetLocalTransform(Entity, MakeTransform(1e-6f, 2e-6f, 3e-6f)), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+}
+
+TEST(RadientSceneReplicationTest, DeltaFramesOnlyCarryChangedEntities)
+{
+    constexpr Uint32 NumEntities = 1000;
+    constexpr Uint32 NumChanged  = 20;
+
+    ReplicationHarness H;
+
+    std::vector<RadientEntityID> Entities;
+    for (Uint32 i = 0; i < NumEntities; ++i)
+    {
+        const RadientEntityID Parent = i % 10 != 0 ? Entities[i - i % 10] : InvalidRadientEntityID;
+        Entities.push_back(H.CreateEntity("Entity", Parent, MakeTransform(static_cast<float>(i), 0.f, static_cast<float>(i % 7), 0.1f * static_cast<float>(i))));
+    }
+    H.SyncAndCompare();
+
+    const size_t KeyframeBytes = H.Encoder.GetLastFrameStats().NumBytes;
+    EXPECT_TRUE(H.Encoder.GetLastFrameStats().IsKeyframe);
+    EXPECT_EQ(H.Encoder.GetLastFrameStats().NumEntityRecords, NumEntities);
+
+    // Nothing changed: the frame only carries the header.
+    H.SyncAndCompare();
+    EXPECT_EQ(H.Encoder.GetLastFrameStats().NumEntityRecords, 0u);
+    const size_t EmptyFrameBytes = H.Encoder.GetLastFrameStats().NumBytes;
+    EXPECT_LT(EmptyFrameBytes, 32u);
+
+    // Small movements of a few entities.
+    for (Uint32 i = 0; i < NumChanged; ++i)
+    {
+        const RadientEntityID Entity = Entities[i * 37 % NumEntities];
+        RadientTransform      Transform;
+        EXPECT_EQ(H.Source.GetLocalTransform(Entity, Transform), RADIENT_STATUS_OK);
+        Transform.Position.x += 0.05f;
+        Transform.Position.y -= 0.02f;
+        EXPECT_EQ(H.Source.SetLocalTransform(Entity, Transform), RADIENT_STATUS_OK);
+    }
+    H.SyncAndCompare();
+    EXPECT_EQ(H.Encoder.GetLastFrameStats().NumEntityRecords, NumChanged);
+
+    const size_t DeltaBytes             = H.Encoder.GetLastFrameStats().NumBytes;
+    const double BytesPerChangedEntity  = static_cast<double>(DeltaBytes - EmptyFrameBytes) / NumChanged;
+    const double BytesPerKeyframeEntity = static_cast<double>(KeyframeBytes) / NumEntities;
+    // Entity ID delta, mask, and ten small zigzag-coded transform deltas.
+    EXPECT_LE(BytesPerChangedEntity, 20.0);
+    EXPECT_LT(BytesPerChangedEntity, BytesPerKeyframeEntity);
+
+    // Movements below the quantization precision are not sent.
+    RadientTransform Transform;
+    EXPECT_EQ(H.Source.GetLocalTransform(Entities[0], Transform), RADIENT_STATUS_OK);
+    Transform.Position.x += H.Encoder.GetDesc().PositionPrecision * 0.01f;
+    EXPECT_EQ(H.Source.SetLocalTransform(Entities[0], Transform), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+    EXPECT_EQ(H.Encoder.GetLastFrameStats().NumEntityRecords, 0u);
+}
+
+TEST(RadientSceneReplicationTest, KeyframeResynchronizesReplica)
+{
+    RadientSceneDeltaEncoder::Desc Desc;
+    Desc.KeyframeInterval = 4;
+
+    ReplicationHarness H{Desc};
+
+    const RadientEntityID A = H.CreateEntity("A", InvalidRadientEntityID, MakeTransform(1.f, 0.f, 0.f));
+    const RadientEntityID B = H.CreateEntity("B", A, MakeTransform(2.f, 0.f, 0.f));
+    EXPECT_EQ(SetCustomValue(H.Source, B, TestCustomComponentType, 1), RADIENT_STATUS_OK);
+    H.SyncAndCompare();
+
+    // Frame 1 is lost: it destroys B and creates C.
+    EXPECT_EQ(H.Source.DestroyEntity(B), RADIENT_STATUS_OK);
+    const RadientEntityID C = H.CreateEntity("C", A, MakeTransform(3.f, 0.f, 0.f));
+    H.Encode();
+
+    // Frame 2 cannot be applied on top of frame 0.
+    EXPECT_EQ(H.Source.SetLocalTransform(C, MakeTransform(4.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Decode(H.Encode()), RADIENT_STATUS_OUT_OF_DATE);
+    EXPECT_FALSE(H.Decoder.IsSynchronized());
+    EXPECT_NE(H.Decoder.FindEntity(B), InvalidRadientEntityID);
+
+    // Frame 3 is a delta frame and is skipped as well.
+    EXPECT_EQ(H.Decode(H.Encode()), RADIENT_STATUS_OUT_OF_DATE);
+    EXPECT_FALSE(H.Encoder.GetLastFrameStats().IsKeyframe);
+
+    // Frame 4 is a periodic keyframe that removes the stale entity and brings in the new one.
+    H.SyncAndCompare();
+    EXPECT_TRUE(H.Encoder.GetLastFrameStats().IsKeyframe);
+    EXPECT_TRUE(H.Decoder.IsSynchronized());
+    EXPECT_EQ(H.Decoder.FindEntity(B), InvalidRadientEntityID);
+    EXPECT_NE(H.Decoder.FindEntity(C), InvalidRadientEntityID);
+
+    // A requested keyframe does not change the replica.
+    H.Encoder.RequestKeyframe();
+    H.SyncAndCompare();
+    EXPECT_TRUE(H.Encoder.GetLastFrameStats().IsKeyframe);
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumCreated, 0u);
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumDestroyed, 0u);
+}
+
+TEST(RadientSceneReplicationTest, MalformedFramesAreRejected)
+{
+    ReplicationHarness H;
+
+    H.CreateEntity("A", InvalidRadientEntityID, MakeTransform(1.f, 0.f, 0.f));
+    const std::vector<Uint8> Frame = H.Encode();
+
+    for (size_t Size = 0; Size < Frame.size(); ++Size)
+    {
+        size_t BytesConsumed = 0;
+        EXPECT_EQ(H.Decoder.DecodeFrame(Frame.data(), Size, H.Replica, BytesConsumed), RADIENT_STATUS_INVALID_ARGUMENT);
+    }
+
+    // Trailing bytes inside the frame are rejected.
+    std::vector<Uint8> Corrupted = Frame;
+    Corrupted.push_back(0);
+    ++Corrupted[0];
+    size_t BytesConsumed = 0;
+    EXPECT_EQ(H.Decoder.DecodeFrame(Corrupted.data(), Corrupted.size(), H.Replica, BytesConsumed), RADIENT_STATUS_INVALID_ARGUMENT);
+
+    Uint32 NumReplicaEntities = 0;
+    H.Replica.EnumerateEntities([&](RadientEntityID) { ++NumReplicaEntities; });
+    EXPECT_EQ(NumReplicaEntities, 0u);
+
+    EXPECT_EQ(H.Decode(Frame), RADIENT_STATUS_OK);
+    ExpectReplicaMatches(H.Source, H.Replica, H.Decoder, H.Encoder.GetDesc());
+}
+
+TEST(RadientSceneReplicationTest, UnresolvedAssetsAreReported)
+{
+    ReplicationHarness H;
+    H.Decoder.SetResolveAssetCallback(nullptr, nullptr);
+
+    const RadientEntityID Entity = H.CreateEntity("Entity", InvalidRadientEntityID, {});
+
+    RadientMeshComponent Mesh;
+    Mesh.pMesh = H.Assets.Get<IRadientMeshAsset>("mesh://cube");
+    EXPECT_EQ(H.Source.SetMesh(Entity, Mesh), RADIENT_STATUS_OK);
+
+    EXPECT_EQ(H.Decode(H.Encode()), RADIENT_STATUS_OK);
+    EXPECT_EQ(H.Decoder.GetLastFrameStats().NumUnresolvedAssets, 1u);
+
+    Bool HasMesh = True;
+    EXPECT_EQ(H.Replica.HasComponent(H.Decoder.FindEntity(Entity), RADIENT_COMPONENT_TYPE_MESH, HasMesh), RADIENT_STATUS_OK);
+    EXPECT_FALSE(HasMesh);
+}
+
+TEST(RadientSceneReplicationTest, RandomizedEditsReplicate)
+{
+    ReplicationHarness H;
+
+    Uint32     RandomState = 12345u;
+    const auto Random      = [&RandomState](Uint32 Range) {
+        RandomState = RandomState * 1664525u + 1013904223u;
+        return (RandomState >> 8u) % Range;
+    };
+
+    std::vector<RadientEntityID> Entities;
+    for (Uint32 i = 0; i < 200; ++i)
+        Entities.push_back(H.CreateEntity("Entity", InvalidRadientEntityID, MakeTransform(static_cast<float>(i), 0.f, 0.f)));
+    H.SyncAndCompare();
+
+    for (Uint32 Frame = 0; Frame < 40; ++Frame)
+    {
+        for (Uint32 Edit = 0; Edit < 50; ++Edit)
+        {
+            const RadientEntityID Entity = Entities[Random(static_cast<Uint32>(Entities.size()))];
+            if (H.Source.IsEntityAlive(Entity) != RADIENT_STATUS_OK)
+                continue;
+
+            switch (Random(8))
+            {
+                case 0:
+                    Entities.push_back(H.CreateEntity("Spawned", Random(2) == 0 ? Entity : InvalidRadientEntityID, MakeTransform(0.f, static_cast<float>(Frame), 0.f)));
+                    break;
+
+                case 1:
+                    if (Random(4) == 0)
+                        H.Source.DestroyEntity(Entity);
+                    break;
+
+                case 2:
+                    // May fail if the new parent is a descendant; the source scene stays unchanged in this case.
+                    H.Source.SetParent(Entity, Random(3) == 0 ? InvalidRadientEntityID : Entities[Random(static_cast<Uint32>(Entities.size()))], Random(2) == 0 ? True : False);
+                    break;
+
+                case 3:
+                case 4:
+                    H.Source.SetLocalTransform(Entity, MakeTransform(static_cast<float>(Random(1000)) * 0.01f, static_cast<float>(Frame), -1.f, static_cast<float>(Random(628)) * 0.01f));
+                    break;
+
+                case 5:
+                    H.Source.SetEntityOwnVisibility(Entity, Random(2) == 0 ? True : False);
+                    break;
+
+                case 6:
+                    if (Random(3) == 0)
+                        H.Source.RemoveComponent(Entity, TestCustomComponentType);
+                    else
+                        SetCustomValue(H.Source, Entity, TestCustomComponentType, Random(100000));
+                    break;
+
+                case 7:
+                {
+                    RadientLightComponent Light;
+                    Light.Intensity = static_cast<float>(Random(100));
+                    H.Source.SetLight(Entity, Light);
+                    break;
+                }
+            }
+        }
+        H.SyncAndCompare();
+    }
+}
+
+} // namespace
@@ -35,6 +35,7 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -503,6 +504,96 @@ TEST(RadientSceneStateTest, IsEntityAlive)
     EXPECT_EQ(State.IsEntityAlive(Entity), RADIENT_STATUS_NOT_FOUND);
 }
 
+TEST(RadientSceneStateTest, StaleEntityHandlesAreRejectedAfterSlotReuse)
+{
+    // A destroyed entity's slot is reused by the next created entity, but the old ID must stay dead.
+    RadientSceneState State;
+
+    RadientEntityID First = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity({}, First), RADIENT_STATUS_OK);
+    ASSERT_EQ(State.DestroyEntity(First), RADIENT_STATUS_OK);
+
+    RadientEntityID Second = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity({}, Second), RADIENT_STATUS_OK);
+    EXPECT_NE(Second, First);
+
+    RadientEntityHandle FirstHandle;
+    RadientEntityHandle SecondHandle;
+    ASSERT_TRUE(RadientEntityHandle::FromID(First, FirstHandle));
+    ASSERT_TRUE(RadientEntityHandle::FromID(Second, SecondHandle));
+    EXPECT_EQ(SecondHandle.SlotIndex, FirstHandle.SlotIndex);
+    EXPECT_EQ(SecondHandle.Generation, FirstHandle.Generation + 1);
+
+    EXPECT_EQ(State.IsEntityAlive(First), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(Second), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.SetLocalTransform(First, MakeTranslation(1.f, 0.f, 0.f)), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.DestroyEntity(First), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(Second), RADIENT_STATUS_OK);
+
+    RadientEntityDesc Desc;
+    Desc.Parent = First;
+    RadientEntityID Child = InvalidRadientEntityID;
+    EXPECT_EQ(State.CreateEntity(Desc, Child), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.SetParent(Second, First, False), RADIENT_STATUS_NOT_FOUND);
+}
+
+TEST(RadientSceneStateTest, MalformedEntityHandlesAreRejected)
+{
+    RadientSceneState State;
+
+    RadientEntityID Entity = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity({}, Entity), RADIENT_STATUS_OK);
+
+    RadientEntityHandle Handle;
+    ASSERT_TRUE(RadientEntityHandle::FromID(Entity, Handle));
+    EXPECT_EQ(Handle.ToID(), Entity);
+
+    // Slot index out of range, a future generation, and IDs outside the handle range.
+    EXPECT_EQ(State.IsEntityAlive(RadientEntityHandle{Handle.SlotIndex + 1, Handle.Generation}.ToID()), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(RadientEntityHandle{Handle.SlotIndex, Handle.Generation + 1}.ToID()), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(Entity | (RadientEntityID{1} << 63u)), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(Entity & ~RadientEntityID{0xFFFFFFFFu}), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_FALSE(RadientEntityHandle::FromID(InvalidRadientEntityID, Handle));
+}
+
+TEST(RadientSceneStateTest, EntityChurnRecyclesSlots)
+{
+    // Repeated create/destroy churn should reuse slots while every destroyed ID stays dead.
+    static constexpr Uint32 LiveCount  = 1024;
+    static constexpr Uint32 RoundCount = 64;
+
+    RadientSceneState State;
+
+    std::vector<RadientEntityID> Live(LiveCount, InvalidRadientEntityID);
+    for (RadientEntityID& Entity : Live)
+        ASSERT_EQ(State.CreateEntity({}, Entity), RADIENT_STATUS_OK);
+
+    std::vector<RadientEntityID> Destroyed;
+    Destroyed.reserve(size_t{LiveCount} * RoundCount / 2);
+
+    Uint32 MaxSlotIndex = 0;
+    for (Uint32 Round = 0; Round < RoundCount; ++Round)
+    {
+        for (Uint32 i = Round % 2; i < LiveCount; i += 2)
+        {
+            ASSERT_EQ(State.DestroyEntity(Live[i]), RADIENT_STATUS_OK);
+            Destroyed.push_back(Live[i]);
+            ASSERT_EQ(State.CreateEntity({}, Live[i]), RADIENT_STATUS_OK);
+
+            RadientEntityHandle Handle;
+            ASSERT_TRUE(RadientEntityHandle::FromID(Live[i], Handle));
+            MaxSlotIndex = std::max(MaxSlotIndex, Handle.SlotIndex);
+        }
+        EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    }
+
+    EXPECT_LT(MaxSlotIndex, LiveCount);
+    for (const RadientEntityID Entity : Live)
+        EXPECT_EQ(State.IsEntityAlive(Entity), RADIENT_STATUS_OK);
+    for (const RadientEntityID Entity : Destroyed)
+        EXPECT_EQ(State.IsEntityAlive(Entity), RADIENT_STATUS_NOT_FOUND);
+}
+
 TEST(RadientSceneStateTest, CreateEntityRejectsMissingParent)
 {
     // Entity creation should fail when the requested parent ID does not map to
@@ -3363,4 +3454,382 @@ TEST(RadientSceneStateTest, DestroyEntityTouchesCustomRevisionWhenCustomComponen
     ExpectSceneRevisionDelta(BeforeDestroy, State.GetSceneRevisions(), ExpectedDelta);
 }
 
+TEST(RadientSceneStateTest, EnumerateCustomComponentsReturnsContiguousSpans)
+{
+    RadientSceneState State;
+
+    constexpr RadientComponentTypeID ComponentType = 103;
+
+    std::vector<RadientEntityID> Entities(8);
+    for (Uint32 i = 0; i < Entities.size(); ++i)
+    {
+        ASSERT_EQ(State.CreateEntity({}, Entities[i]), RADIENT_STATUS_OK);
+
+        RadientCustomComponentData CustomComponent;
+        CustomComponent.ComponentType = ComponentType;
+        CustomComponent.Schema        = i < 6 ? "schema://a" : "schema://b";
+        CustomComponent.pData         = &i;
+        CustomComponent.DataSize      = sizeof(i);
+        ASSERT_EQ(State.SetCustomComponentData(Entities[i], CustomComponent), RADIENT_STATUS_OK);
+    }
+    ASSERT_EQ(State.RemoveComponent(Entities[2], ComponentType), RADIENT_STATUS_OK);
+
+    Uint32 NumSpans     = 0;
+    Uint32 NumInstances = 0;
+    State.EnumerateCustomComponents(ComponentType, [&](const RadientSceneState::CustomComponentSpan& Span) {
+        ++NumSpans;
+        EXPECT_EQ(Span.DataSize, sizeof(Uint32));
+        for (Uint32 i = 0; i < Span.Count; ++i)
+        {
+            Uint32 Value = 0;
+            std::memcpy(&Value, Span.pData + i * Span.DataSize, sizeof(Value));
+            ASSERT_LT(Value, Entities.size());
+            EXPECT_EQ(Span.pEntities[i], Entities[Value]);
+            EXPECT_STREQ(Span.Schema, Value < 6 ? "schema://a" : "schema://b");
+
+            RadientCustomComponentData Component;
+            ASSERT_EQ(State.GetCustomComponentData(Span.pEntities[i], ComponentType, Component), RADIENT_STATUS_OK);
+            EXPECT_EQ(Component.pData, Span.pData + i * Span.DataSize);
+        }
+        NumInstances += Span.Count;
+    });
+    EXPECT_EQ(NumSpans, 2u);
+    EXPECT_EQ(NumInstances, 7u);
+
+    NumSpans = 0;
+    State.EnumerateCustomComponents(ComponentType + 1, [&](const RadientSceneState::CustomComponentSpan&) { ++NumSpans; });
+    EXPECT_EQ(NumSpans, 0u);
+}
+
+void ExpectSameHierarchyState(RadientSceneState& State, RadientSceneState& Reference, const std::vector<RadientEntityID>& Entities)
+{
+    for (const RadientEntityID Entity : Entities)
+    {
+        const RADIENT_STATUS Alive = Reference.IsEntityAlive(Entity);
+        ASSERT_EQ(State.IsEntityAlive(Entity), Alive) << "Entity " << Entity;
+        if (Alive != RADIENT_STATUS_OK)
+            continue;
+
+        RadientEntityID Parent          = InvalidRadientEntityID;
+        RadientEntityID ReferenceParent = InvalidRadientEntityID;
+        EXPECT_EQ(State.GetParent(Entity, Parent), RADIENT_STATUS_OK);
+        EXPECT_EQ(Reference.GetParent(Entity, ReferenceParent), RADIENT_STATUS_OK);
+        EXPECT_EQ(Parent, ReferenceParent) << "Entity " << Entity;
+
+        RadientMatrix4x4 Matrix;
+        RadientMatrix4x4 ReferenceMatrix;
+        EXPECT_EQ(State.GetCachedWorldMatrix(Entity, Matrix), RADIENT_STATUS_OK);
+        EXPECT_EQ(Reference.GetCachedWorldMatrix(Entity, ReferenceMatrix), RADIENT_STATUS_OK);
+        for (Uint32 i = 0; i < 16; ++i)
+            EXPECT_EQ(Matrix.Data[i], ReferenceMatrix.Data[i]) << "Entity " << Entity << ", i = " << i;
+
+        Bool Visible          = False;
+        Bool ReferenceVisible = False;
+        EXPECT_EQ(State.GetCachedEntityEffectiveVisibility(Entity, Visible), RADIENT_STATUS_OK);
+        EXPECT_EQ(Reference.GetCachedEntityEffectiveVisibility(Entity, ReferenceVisible), RADIENT_STATUS_OK);
+        EXPECT_EQ(Visible, ReferenceVisible) << "Entity " << Entity;
+    }
+}
+
+TEST(RadientSceneStateTest, FlatHierarchyMatchesDefaultLayoutUnderRandomEdits)
+{
+    // Applies the same random sequence of edits to scenes with and without the flat hierarchy layout
+    // and verifies that committed derived state is identical.
+    RadientSceneDesc FlatDesc;
+    FlatDesc.FlatHierarchy = True;
+
+    RadientSceneState State{FlatDesc};
+    RadientSceneState Reference;
+    EXPECT_TRUE(State.IsFlatHierarchyEnabled());
+    EXPECT_FALSE(Reference.IsFlatHierarchyEnabled());
+
+    std::mt19937                          Rng{42};
+    std::uniform_real_distribution<float> Coord{-4.f, 4.f};
+    std::uniform_real_distribution<float> Scale{0.5f, 2.f};
+
+    std::vector<RadientEntityID> Entities;
+    std::vector<RadientEntityID> LiveEntities;
+
+    auto RandomLiveEntity = [&]() {
+        return LiveEntities.empty() ? InvalidRadientEntityID : LiveEntities[Rng() % LiveEntities.size()];
+    };
+
+    for (Uint32 Step = 0; Step < 4000; ++Step)
+    {
+        const Uint32 Op = Rng() % 100;
+        if (Op < 35 || LiveEntities.size() < 4)
+        {
+            RadientEntityDesc Desc;
+            Desc.Parent    = Rng() % 4 != 0 ? RandomLiveEntity() : InvalidRadientEntityID;
+            Desc.Transform = MakeTranslation(Coord(Rng), Coord(Rng), Coord(Rng));
+
+            RadientEntityID Entity          = InvalidRadientEntityID;
+            RadientEntityID ReferenceEntity = InvalidRadientEntityID;
+            ASSERT_EQ(State.CreateEntity(Desc, Entity), RADIENT_STATUS_OK);
+            ASSERT_EQ(Reference.CreateEntity(Desc, ReferenceEntity), RADIENT_STATUS_OK);
+            ASSERT_EQ(Entity, ReferenceEntity);
+            Entities.push_back(Entity);
+            LiveEntities.push_back(Entity);
+        }
+        else if (Op < 50)
+        {
+            const RadientEntityID Entity             = RandomLiveEntity();
+            const RadientEntityID Parent             = Rng() % 5 != 0 ? RandomLiveEntity() : InvalidRadientEntityID;
+            const Bool            KeepWorldTransform = Rng() % 2 != 0 ? True : False;
+            EXPECT_EQ(State.SetParent(Entity, Parent, KeepWorldTransform), Reference.SetParent(Entity, Parent, KeepWorldTransform));
+        }
+        else if (Op < 60)
+        {
+            const RadientEntityID Entity = RandomLiveEntity();
+            EXPECT_EQ(State.DestroyEntity(Entity), RADIENT_STATUS_OK);
+            EXPECT_EQ(Reference.DestroyEntity(Entity), RADIENT_STATUS_OK);
+            LiveEntities.erase(std::remove_if(LiveEntities.begin(), LiveEntities.end(),
+                                              [&](RadientEntityID Live) { return Reference.IsEntityAlive(Live) != RADIENT_STATUS_OK; }),
+                               LiveEntities.end());
+        }
+        else if (Op < 85)
+        {
+            const RadientEntityID Entity = RandomLiveEntity();
+
+            RadientTransform Transform = MakeTranslation(Coord(Rng), Coord(Rng), Coord(Rng));
+            Transform.Scale            = {Scale(Rng), Scale(Rng), Scale(Rng)};
+            EXPECT_EQ(State.SetLocalTransform(Entity, Transform), Reference.SetLocalTransform(Entity, Transform));
+        }
+        else if (Op < 95)
+        {
+            const RadientEntityID Entity  = RandomLiveEntity();
+            const Bool            Visible = Rng() % 2 != 0 ? True : False;
+            EXPECT_EQ(State.SetEntityOwnVisibility(Entity, Visible), Reference.SetEntityOwnVisibility(Entity, Visible));
+        }
+        else
+        {
+            EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+            EXPECT_EQ(Reference.CommitChanges(), RADIENT_STATUS_OK);
+            ExpectSameHierarchyState(State, Reference, Entities);
+        }
+    }
+
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    EXPECT_EQ(Reference.CommitChanges(), RADIENT_STATUS_OK);
+    ExpectSameHierarchyState(State, Reference, Entities);
+}
+
+TEST(RadientSceneStateTest, FlatHierarchyCanBeToggled)
+{
+    RadientSceneState State;
+
+    RadientEntityID Root  = InvalidRadientEntityID;
+    RadientEntityID Child = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity({}, Root), RADIENT_STATUS_OK);
+
+    RadientEntityDesc Desc;
+    Desc.Parent    = Root;
+    Desc.Transform = MakeTranslation(1.f, 0.f, 0.f);
+    ASSERT_EQ(State.CreateEntity(Desc, Child), RADIENT_STATUS_OK);
+
+    // Enabling the layout on a populated scene builds it at the next commit.
+    State.SetFlatHierarchyEnabled(true);
+    EXPECT_EQ(State.SetLocalTransform(Root, MakeTranslation(2.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.GetFlatHierarchyRebuildCount(), 1u);
+
+    RadientMatrix4x4 Matrix;
+    EXPECT_EQ(State.GetCachedWorldMatrix(Child, Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(3.f, 0.f, 0.f)));
+
+    State.SetFlatHierarchyEnabled(false);
+    EXPECT_EQ(State.SetLocalTransform(Root, MakeTranslation(5.f, 0.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.GetCachedWorldMatrix(Child, Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(6.f, 0.f, 0.f)));
+
+    EXPECT_EQ(State.DestroyEntity(Root), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.IsEntityAlive(Child), RADIENT_STATUS_NOT_FOUND);
+}
+
+TEST(RadientSceneStateTest, FlatHierarchyReparentingIsIncremental)
+{
+    // Reparenting moves only the affected trees, so the layout is not rebuilt from scratch.
+    static constexpr Uint32 TreeCount     = 16;
+    static constexpr Uint32 LeavesPerTree = 8;
+
+    RadientSceneDesc FlatDesc;
+    FlatDesc.FlatHierarchy = True;
+    RadientSceneState State{FlatDesc};
+
+    std::vector<RadientEntityID> Roots;
+    std::vector<RadientEntityID> Leaves;
+    for (Uint32 Tree = 0; Tree < TreeCount; ++Tree)
+    {
+        RadientEntityDesc Desc;
+        Desc.Transform       = MakeTranslation(static_cast<float>(Tree), 0.f, 0.f);
+        RadientEntityID Root = InvalidRadientEntityID;
+        ASSERT_EQ(State.CreateEntity(Desc, Root), RADIENT_STATUS_OK);
+        Roots.push_back(Root);
+
+        Desc.Parent    = Root;
+        Desc.Transform = MakeTranslation(0.f, 1.f, 0.f);
+        for (Uint32 Leaf = 0; Leaf < LeavesPerTree; ++Leaf)
+        {
+            RadientEntityID LeafEntity = InvalidRadientEntityID;
+            ASSERT_EQ(State.CreateEntity(Desc, LeafEntity), RADIENT_STATUS_OK);
+            Leaves.push_back(LeafEntity);
+        }
+    }
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+
+    // Move a leaf of the first tree under the last root, whose subtree ends at the end of the layout,
+    // and a leaf of the last tree under the first root, whose subtree is in the middle of the layout.
+    EXPECT_EQ(State.SetParent(Leaves[0], Roots[TreeCount - 1], False), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.SetParent(Leaves[Leaves.size() - 1], Roots[0], False), RADIENT_STATUS_OK);
+
+    // A child created under a tree in the middle of the layout
+    RadientEntityDesc Desc;
+    Desc.Parent           = Roots[TreeCount / 2];
+    Desc.Transform        = MakeTranslation(0.f, 0.f, 1.f);
+    RadientEntityID Child = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity(Desc, Child), RADIENT_STATUS_OK);
+
+    // Detach a leaf into a new root
+    EXPECT_EQ(State.SetParent(Leaves[1], InvalidRadientEntityID, False), RADIENT_STATUS_OK);
+
+    for (const RadientEntityID Root : Roots)
+        EXPECT_EQ(State.SetLocalTransform(Root, MakeTranslation(0.f, 0.f, 5.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.GetFlatHierarchyRebuildCount(), 0u);
+
+    RadientMatrix4x4 Matrix;
+    EXPECT_EQ(State.GetCachedWorldMatrix(Leaves[0], Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(0.f, 1.f, 5.f)));
+    EXPECT_EQ(State.GetCachedWorldMatrix(Leaves[Leaves.size() - 1], Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(0.f, 1.f, 5.f)));
+    EXPECT_EQ(State.GetCachedWorldMatrix(Child, Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(0.f, 0.f, 6.f)));
+    EXPECT_EQ(State.GetCachedWorldMatrix(Leaves[1], Matrix), RADIENT_STATUS_OK);
+    ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(0.f, 1.f, 0.f)));
+
+    // Destroying a tree destroys the leaf that was moved into it as well
+    EXPECT_EQ(State.DestroyEntity(Roots[0]), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.IsEntityAlive(Leaves[Leaves.size() - 1]), RADIENT_STATUS_NOT_FOUND);
+    EXPECT_EQ(State.IsEntityAlive(Leaves[0]), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.IsEntityAlive(Leaves[1]), RADIENT_STATUS_OK);
+}
+
+TEST(RadientSceneStateTest, FlatHierarchyBreadthFirstCreationAndReparenting)
+{
+    // A single tree created in breadth-first order whose leaves are then all moved within it. Only the inserted
+    // and moved subtrees are appended to the layout, so it never accumulates enough tombstones to be rebuilt.
+    static constexpr Uint32 Fanout     = 8;
+    static constexpr Uint32 LevelCount = 4;
+
+    RadientSceneDesc FlatDesc;
+    FlatDesc.FlatHierarchy = True;
+    RadientSceneState State{FlatDesc};
+
+    RadientEntityID Root = InvalidRadientEntityID;
+    ASSERT_EQ(State.CreateEntity({}, Root), RADIENT_STATUS_OK);
+
+    std::vector<RadientEntityID> Level{Root};
+    std::vector<RadientEntityID> Interior;
+    for (Uint32 Depth = 1; Depth < LevelCount; ++Depth)
+    {
+        std::vector<RadientEntityID> NextLevel;
+        for (Uint32 Child = 0; Child < Fanout; ++Child)
+        {
+            for (const RadientEntityID Parent : Level)
+            {
+                RadientEntityDesc Desc;
+                Desc.Parent          = Parent;
+                Desc.Transform       = MakeTranslation(1.f, 0.f, 0.f);
+                RadientEntityID Node = InvalidRadientEntityID;
+                ASSERT_EQ(State.CreateEntity(Desc, Node), RADIENT_STATUS_OK);
+                NextLevel.push_back(Node);
+            }
+        }
+        Interior = std::move(Level);
+        Level    = std::move(NextLevel);
+    }
+    const std::vector<RadientEntityID> Leaves = std::move(Level);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+
+    // Move every leaf under another node of the level above it
+    std::mt19937 Rng{7};
+    for (const RadientEntityID Leaf : Leaves)
+        EXPECT_EQ(State.SetParent(Leaf, Interior[Rng() % Interior.size()], False), RADIENT_STATUS_OK);
+
+    EXPECT_EQ(State.SetLocalTransform(Root, MakeTranslation(0.f, 2.f, 0.f)), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    EXPECT_EQ(State.GetFlatHierarchyRebuildCount(), 0u);
+
+    for (const RadientEntityID Leaf : Leaves)
+    {
+        RadientMatrix4x4 Matrix;
+        EXPECT_EQ(State.GetCachedWorldMatrix(Leaf, Matrix), RADIENT_STATUS_OK);
+        ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(static_cast<float>(LevelCount - 1), 2.f, 0.f)));
+    }
+
+    EXPECT_EQ(State.DestroyEntity(Root), RADIENT_STATUS_OK);
+    for (const RadientEntityID Leaf : Leaves)
+        EXPECT_EQ(State.IsEntityAlive(Leaf), RADIENT_STATUS_NOT_FOUND);
+}
+
+TEST(RadientSceneStateTest, FlatHierarchyLargeSceneUpdateAndDestroy)
+{
+    // Large-scale run of the linear sweeps: a forest created in depth-first order, repeated root transform
+    // updates, and destruction of every other tree.
+    static constexpr Uint32 TreeCount     = 64;
+    static constexpr Uint32 ChainLength   = 64;
+    static constexpr Uint32 LeavesPerNode = 16;
+
+    RadientSceneDesc FlatDesc;
+    FlatDesc.FlatHierarchy = True;
+    RadientSceneState State{FlatDesc};
+
+    std::vector<RadientEntityID> Roots;
+    std::vector<RadientEntityID> Tips;
+    for (Uint32 Tree = 0; Tree < TreeCount; ++Tree)
+    {
+        RadientEntityDesc Desc;
+        RadientEntityID   Parent = InvalidRadientEntityID;
+        for (Uint32 Node = 0; Node < ChainLength; ++Node)
+        {
+            Desc.Parent    = Parent;
+            Desc.Transform = MakeTranslation(Node > 0 ? 1.f : 0.f, 0.f, 0.f);
+            ASSERT_EQ(State.CreateEntity(Desc, Parent), RADIENT_STATUS_OK);
+            if (Node == 0)
+                Roots.push_back(Parent);
+        }
+        Tips.push_back(Parent);
+
+        Desc.Parent    = Parent;
+        Desc.Transform = {};
+        for (Uint32 Leaf = 0; Leaf < LeavesPerNode; ++Leaf)
+        {
+            RadientEntityID LeafEntity = InvalidRadientEntityID;
+            ASSERT_EQ(State.CreateEntity(Desc, LeafEntity), RADIENT_STATUS_OK);
+        }
+    }
+    EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+
+    for (Uint32 Frame = 0; Frame < 8; ++Frame)
+    {
+        for (const RadientEntityID Root : Roots)
+            EXPECT_EQ(State.SetLocalTransform(Root, MakeTranslation(0.f, static_cast<float>(Frame), 0.f)), RADIENT_STATUS_OK);
+        EXPECT_EQ(State.CommitChanges(), RADIENT_STATUS_OK);
+    }
+
+    for (Uint32 Tree = 0; Tree < TreeCount; ++Tree)
+    {
+        RadientMatrix4x4 Matrix;
+        EXPECT_EQ(State.GetCachedWorldMatrix(Tips[Tree], Matrix), RADIENT_STATUS_OK);
+        ExpectMatrixNear(Matrix, RadientMath::TransformToMatrix(MakeTranslation(static_cast<float>(ChainLength - 1), 7.f, 0.f)));
+    }
+
+    for (Uint32 Tree = 0; Tree < TreeCount; Tree += 2)
+        EXPECT_EQ(State.DestroyEntity(Roots[Tree]), RADIENT_STATUS_OK);
+
+    for (Uint32 Tree = 0; Tree < TreeCount; ++Tree)
+        EXPECT_EQ(State.IsEntityAlive(Tips[Tree]), Tree % 2 == 0 ? RADIENT_STATUS_NOT_FOUND : RADIENT_STATUS_OK);
+}
+
 } // namespace
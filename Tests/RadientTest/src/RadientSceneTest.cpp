@@ -36,6 +36,7 @@
 #include "ThreadPool.hpp"
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <string>
 
@@ -912,6 +913,30 @@ TEST(RadientRendererTest, CreateView)
     EXPECT_EQ(StoredSkybox.MipLevel, 1.f);
 
     EXPECT_EQ(pView->SetSkybox(StoredSkybox), RADIENT_STATUS_NO_CHANGE);
+
+    EXPECT_EQ(pView->GetDesc().LayerMask, ~Uint64{0});
+    EXPECT_EQ(pView->SetLayerMask(0x5u), RADIENT_STATUS_OK);
+    EXPECT_EQ(pView->GetDesc().LayerMask, 0x5u);
+    EXPECT_EQ(pView->SetLayerMask(0x5u), RADIENT_STATUS_NO_CHANGE);
+
+    RadientRenderScaleDesc RenderScale;
+    EXPECT_EQ(pView->GetDesc().RenderScale, RenderScale);
+    RenderScale.Dynamic = True;
+    EXPECT_EQ(pView->SetRenderScale(RenderScale), RADIENT_STATUS_OK);
+    EXPECT_EQ(pView->GetDesc().RenderScale, RenderScale);
+    EXPECT_EQ(pView->SetRenderScale(RenderScale), RADIENT_STATUS_NO_CHANGE);
+
+    RadientRenderScaleDesc InvalidScale = RenderScale;
+    InvalidScale.ScaleStep              = 0;
+    EXPECT_EQ(pView->SetRenderScale(InvalidScale), RADIENT_STATUS_INVALID_ARGUMENT);
+    InvalidScale           = RenderScale;
+    InvalidScale.MinScale  = 0.8f;
+    InvalidScale.MaxScale  = 0.6f;
+    EXPECT_EQ(pView->SetRenderScale(InvalidScale), RADIENT_STATUS_INVALID_ARGUMENT);
+    InvalidScale                 = RenderScale;
+    InvalidScale.TargetFrameTime = 0;
+    EXPECT_EQ(pView->SetRenderScale(InvalidScale), RADIENT_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(pView->GetDesc().RenderScale, RenderScale);
 }
 
 TEST(RadientRendererTest, RenderHeadlessScene)
@@ -956,4 +981,189 @@ TEST(RadientRendererTest, RenderHeadlessScene)
     EXPECT_EQ(pRenderer->Render(RenderAttribs), RADIENT_STATUS_OK);
 }
 
+TEST(RadientRendererTest, RenderViewsSyncsSceneOnce)
+{
+    RefCntAutoPtr<IRadientEngine> pEngine = CreateTestEngine();
+    ASSERT_NE(pEngine, nullptr);
+
+    RefCntAutoPtr<IRadientAssetManager> pAssetManager = GetTestAssetManager(*pEngine);
+    ASSERT_NE(pAssetManager, nullptr);
+
+    RefCntAutoPtr<IRadientMaterialAsset> pMaterial = CreateTestMaterial(*pAssetManager);
+    ASSERT_NE(pMaterial, nullptr);
+
+    RefCntAutoPtr<IRadientMeshAsset> pMesh = CreateTestMesh(*pAssetManager, pMaterial);
+    ASSERT_NE(pMesh, nullptr);
+
+    RefCntAutoPtr<IRadientScene> pScene = CreateTestScene(*pEngine);
+    ASSERT_NE(pScene, nullptr);
+
+    RefCntAutoPtr<IRadientSceneWriter> pWriter = CreateTestSceneWriter(*pEngine, pScene);
+    ASSERT_NE(pWriter, nullptr);
+
+    const RadientEntityID Entity = CreateTestRenderableEntity(*pWriter, pMesh, pMaterial);
+    ASSERT_NE(Entity, InvalidRadientEntityID);
+
+    RefCntAutoPtr<IRadientRenderer> pRenderer = CreateTestRenderer(*pEngine);
+    ASSERT_NE(pRenderer, nullptr);
+
+    // Stereo pair: one target per eye
+    RefCntAutoPtr<IRadientRenderTarget> pLeftTarget = CreateTestRenderTarget(*pRenderer);
+    ASSERT_NE(pLeftTarget, nullptr);
+    RefCntAutoPtr<IRadientRenderTarget> pRightTarget = CreateTestRenderTarget(*pRenderer);
+    ASSERT_NE(pRightTarget, nullptr);
+
+    RefCntAutoPtr<IRadientView> pLeftView = CreateTestView(*pRenderer, pScene, pLeftTarget);
+    ASSERT_NE(pLeftView, nullptr);
+    RefCntAutoPtr<IRadientView> pRightView = CreateTestView(*pRenderer, pScene, pRightTarget);
+    ASSERT_NE(pRightView, nullptr);
+
+    EXPECT_EQ(pRenderer->GetStats().FrameCount, 0u);
+    EXPECT_EQ(pRenderer->GetStats().ViewCount, 0u);
+    EXPECT_EQ(pRenderer->GetStats().SceneSyncCount, 0u);
+
+    IRadientView* const Views[] = {pLeftView, pRightView};
+
+    RadientRenderViewsAttribs ViewsAttribs{};
+    ViewsAttribs.ppViews  = Views;
+    ViewsAttribs.NumViews = _countof(Views);
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_OK);
+
+    EXPECT_EQ(pRenderer->GetStats().FrameCount, 1u);
+    EXPECT_EQ(pRenderer->GetStats().ViewCount, 2u);
+    EXPECT_EQ(pRenderer->GetStats().SceneSyncCount, 1u);
+
+    // Rendering the same views one by one synchronizes the scene for every view
+    RadientRenderAttribs RenderAttribs{};
+    for (IRadientView* pView : Views)
+    {
+        RenderAttribs.pView = pView;
+        EXPECT_EQ(pRenderer->Render(RenderAttribs), RADIENT_STATUS_OK);
+    }
+
+    EXPECT_EQ(pRenderer->GetStats().FrameCount, 3u);
+    EXPECT_EQ(pRenderer->GetStats().ViewCount, 4u);
+    EXPECT_EQ(pRenderer->GetStats().SceneSyncCount, 3u);
+}
+
+TEST(RadientRendererTest, NullBackendRecordsFramePasses)
+{
+    RadientEngineCreateInfo EngineCI{};
+    EngineCI.Backend.Desc.Type = RADIENT_BACKEND_TYPE_NULL;
+
+    RefCntAutoPtr<IRadientEngine> pEngine;
+    ASSERT_EQ(CreateRadientEngine(EngineCI, &pEngine), RADIENT_STATUS_OK);
+    ASSERT_NE(pEngine, nullptr);
+
+    RefCntAutoPtr<IRadientBackend> pBackend = GetTestBackend(*pEngine);
+    ASSERT_NE(pBackend, nullptr);
+    EXPECT_EQ(pBackend->GetDesc().Type, RADIENT_BACKEND_TYPE_NULL);
+    EXPECT_EQ(pBackend->GetNativeDevice(), nullptr);
+
+    RefCntAutoPtr<IRadientScene> pScene = CreateTestScene(*pEngine);
+    ASSERT_NE(pScene, nullptr);
+
+    RefCntAutoPtr<IRadientRenderer> pRenderer = CreateTestRenderer(*pEngine);
+    ASSERT_NE(pRenderer, nullptr);
+
+    Uint32 NumPasses = ~0u;
+    EXPECT_EQ(pRenderer->GetFramePassStats(NumPasses), nullptr);
+    EXPECT_EQ(NumPasses, 0u);
+
+    RefCntAutoPtr<IRadientRenderTarget> pLeftTarget = CreateTestRenderTarget(*pRenderer);
+    ASSERT_NE(pLeftTarget, nullptr);
+    RefCntAutoPtr<IRadientRenderTarget> pRightTarget = CreateTestRenderTarget(*pRenderer);
+    ASSERT_NE(pRightTarget, nullptr);
+
+    RefCntAutoPtr<IRadientView> pLeftView = CreateTestView(*pRenderer, pScene, pLeftTarget);
+    ASSERT_NE(pLeftView, nullptr);
+    RefCntAutoPtr<IRadientView> pRightView = CreateTestView(*pRenderer, pScene, pRightTarget);
+    ASSERT_NE(pRightView, nullptr);
+
+    IRadientView* const Views[] = {pLeftView, pRightView};
+
+    RadientRenderViewsAttribs ViewsAttribs{};
+    ViewsAttribs.ppViews  = Views;
+    ViewsAttribs.NumViews = _countof(Views);
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_OK);
+    EXPECT_EQ(pRenderer->GetStats().FrameCount, 1u);
+
+    // The scene is synchronized once, then every view records its passes
+    const RadientFramePassStats* pPasses = pRenderer->GetFramePassStats(NumPasses);
+    ASSERT_NE(pPasses, nullptr);
+    ASSERT_GT(NumPasses, 1u);
+    EXPECT_STREQ(pPasses[0].Name, "Scene sync");
+    EXPECT_EQ(pPasses[0].ViewIndex, ~0u);
+
+    for (Uint32 View = 0; View < _countof(Views); ++View)
+    {
+        bool HasConstants = false;
+        bool HasOpaque    = false;
+        for (Uint32 i = 0; i < NumPasses; ++i)
+        {
+            const RadientFramePassStats& Pass = pPasses[i];
+            EXPECT_GE(Pass.CPUTime, 0.0);
+            if (Pass.ViewIndex != View)
+                continue;
+
+            if (std::strcmp(Pass.Name, "View constants") == 0)
+            {
+                HasConstants = true;
+                EXPECT_GT(Pass.BufferWriteSize, 0u);
+            }
+            else if (std::strcmp(Pass.Name, "Opaque") == 0)
+            {
+                HasOpaque = true;
+            }
+        }
+        EXPECT_TRUE(HasConstants) << "View " << View;
+        EXPECT_TRUE(HasOpaque) << "View " << View;
+    }
+
+    // The passes of the previous frame are replaced
+    const Uint32 FrameNumPasses = NumPasses;
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_OK);
+    pRenderer->GetFramePassStats(NumPasses);
+    EXPECT_EQ(NumPasses, FrameNumPasses);
+}
+
+TEST(RadientRendererTest, RenderViewsRejectsInvalidViews)
+{
+    RefCntAutoPtr<IRadientEngine> pEngine = CreateTestEngine();
+    ASSERT_NE(pEngine, nullptr);
+
+    RefCntAutoPtr<IRadientScene> pScene = CreateTestScene(*pEngine);
+    ASSERT_NE(pScene, nullptr);
+    RefCntAutoPtr<IRadientScene> pOtherScene = CreateTestScene(*pEngine);
+    ASSERT_NE(pOtherScene, nullptr);
+
+    RefCntAutoPtr<IRadientRenderer> pRenderer = CreateTestRenderer(*pEngine);
+    ASSERT_NE(pRenderer, nullptr);
+
+    RefCntAutoPtr<IRadientRenderTarget> pTarget = CreateTestRenderTarget(*pRenderer);
+    ASSERT_NE(pTarget, nullptr);
+
+    RefCntAutoPtr<IRadientView> pView = CreateTestView(*pRenderer, pScene, pTarget);
+    ASSERT_NE(pView, nullptr);
+    RefCntAutoPtr<IRadientView> pOtherView = CreateTestView(*pRenderer, pOtherScene, pTarget);
+    ASSERT_NE(pOtherView, nullptr);
+
+    RadientRenderViewsAttribs ViewsAttribs{};
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_INVALID_ARGUMENT);
+
+    IRadientView* const NullViews[] = {pView, nullptr};
+    ViewsAttribs.ppViews            = NullViews;
+    ViewsAttribs.NumViews           = _countof(NullViews);
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_INVALID_ARGUMENT);
+
+    // All views must share the scene that is synchronized once per call
+    IRadientView* const MixedViews[] = {pView, pOtherView};
+    ViewsAttribs.ppViews             = MixedViews;
+    ViewsAttribs.NumViews            = _countof(MixedViews);
+    EXPECT_EQ(pRenderer->RenderViews(ViewsAttribs), RADIENT_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(pRenderer->GetStats().FrameCount, 0u);
+    EXPECT_EQ(pRenderer->GetStats().SceneSyncCount, 0u);
+}
+
 } // namespace
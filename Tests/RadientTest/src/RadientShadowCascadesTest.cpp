@@ -0,0 +1,245 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Math/RadientMath.hpp"
+#include "Render/RadientShadowCascades.hpp"
+
+#include <cmath>
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr float CameraNearZ = 0.1f;
+constexpr float CameraFarZ  = 1000.f;
+
+float4x4 MakeCameraProj()
+{
+    RadientCameraComponent Camera;
+    Camera.ClippingRange = {CameraNearZ, CameraFarZ};
+    return RadientMath::GetCameraProjection(Camera, 16.f / 9.f, false).Matrix;
+}
+
+float3 GetLightDirection()
+{
+    return normalize(float3{0.3f, -1.f, 0.2f});
+}
+
+float3 ProjectToCascade(const RadientShadowCascade& Cascade, const float3& WorldPos)
+{
+    const float4 ProjPos = float4{WorldPos, 1.f} * Cascade.WorldToLightProjSpace;
+    return float3{ProjPos.x, ProjPos.y, ProjPos.z} / ProjPos.w;
+}
+
+bool IsInsideCascade(const RadientShadowCascade& Cascade, const float3& WorldPos)
+{
+    const float3 ProjPos = ProjectToCascade(Cascade, WorldPos);
+    return std::abs(ProjPos.x) < 1.f && std::abs(ProjPos.y) < 1.f && ProjPos.z >= 0.f && ProjPos.z <= 1.f;
+}
+
+float GetLightSpaceScaleX(const RadientShadowCascade& Cascade)
+{
+    const float4x4& M = Cascade.WorldToLightProjSpace;
+    return length(float3{M._11, M._21, M._31});
+}
+
+} // namespace
+
+TEST(RadientShadowCascadesTest, SplitsCoverCameraRange)
+{
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    ASSERT_EQ(Cascades.GetCascadeCount(), 4u);
+
+    EXPECT_NEAR(Cascades.GetCascade(0).StartZ, CameraNearZ, 1e-3f);
+    EXPECT_NEAR(Cascades.GetCascade(3).EndZ, CameraFarZ, 1e-1f);
+    for (Uint32 i = 0; i < Cascades.GetCascadeCount(); ++i)
+    {
+        const RadientShadowCascade& Cascade = Cascades.GetCascade(i);
+        EXPECT_LT(Cascade.StartZ, Cascade.EndZ);
+        if (i > 0)
+            EXPECT_EQ(Cascade.StartZ, Cascades.GetCascade(i - 1).EndZ);
+    }
+
+    // Logarithmic partitioning gives more resolution to the near cascades
+    EXPECT_LT(Cascades.GetCascade(0).EndZ - Cascades.GetCascade(0).StartZ,
+              Cascades.GetCascade(3).EndZ - Cascades.GetCascade(3).StartZ);
+
+    RadientShadowCascadeDesc UniformDesc;
+    UniformDesc.PartitioningFactor = 0.f;
+    ASSERT_TRUE(Cascades.Distribute(UniformDesc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    const float UniformRange = (CameraFarZ - CameraNearZ) / 4.f;
+    for (Uint32 i = 0; i < Cascades.GetCascadeCount(); ++i)
+        EXPECT_NEAR(Cascades.GetCascade(i).EndZ - Cascades.GetCascade(i).StartZ, UniformRange, 1e-1f);
+}
+
+TEST(RadientShadowCascadesTest, MaxDistance)
+{
+    RadientShadowCascadeDesc Desc;
+    Desc.MaxDistance = 100.f;
+
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(Desc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    ASSERT_EQ(Cascades.GetCascadeCount(), 4u);
+    EXPECT_NEAR(Cascades.GetCascade(3).EndZ, 100.f, 1e-3f);
+
+    // Distance beyond the camera far plane is ignored
+    Desc.MaxDistance = 2.f * CameraFarZ;
+    ASSERT_TRUE(Cascades.Distribute(Desc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    EXPECT_NEAR(Cascades.GetCascade(3).EndZ, CameraFarZ, 1e-1f);
+}
+
+TEST(RadientShadowCascadesTest, CascadeCount)
+{
+    RadientShadowCascadeDesc Desc;
+    Desc.CascadeCount = 1;
+
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(Desc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    ASSERT_EQ(Cascades.GetCascadeCount(), 1u);
+    EXPECT_NEAR(Cascades.GetCascade(0).StartZ, CameraNearZ, 1e-3f);
+    EXPECT_NEAR(Cascades.GetCascade(0).EndZ, CameraFarZ, 1e-1f);
+
+    Desc.CascadeCount = 16;
+    ASSERT_TRUE(Cascades.Distribute(Desc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    EXPECT_EQ(Cascades.GetCascadeCount(), 8u);
+
+    Desc.CascadeCount = 0;
+    EXPECT_FALSE(Cascades.Distribute(Desc, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    EXPECT_EQ(Cascades.GetCascadeCount(), 0u);
+}
+
+TEST(RadientShadowCascadesTest, ExtentsAreStableUnderCameraMotion)
+{
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+
+    const float4x4 MovedCamera = float4x4::RotationY(0.7f) * float4x4::RotationX(-0.3f) * float4x4::Translation(12.f, 3.f, -40.f);
+
+    RadientShadowCascades MovedCascades;
+    ASSERT_TRUE(MovedCascades.Distribute(RadientShadowCascadeDesc{}, MovedCamera, MakeCameraProj(), GetLightDirection()));
+    ASSERT_EQ(MovedCascades.GetCascadeCount(), Cascades.GetCascadeCount());
+
+    for (Uint32 i = 0; i < Cascades.GetCascadeCount(); ++i)
+    {
+        const float Scale      = GetLightSpaceScaleX(Cascades.GetCascade(i));
+        const float MovedScale = GetLightSpaceScaleX(MovedCascades.GetCascade(i));
+        EXPECT_NEAR(MovedScale / Scale, 1.f, 1e-4f) << "Cascade " << i;
+    }
+}
+
+TEST(RadientShadowCascadesTest, CascadesAreSnappedToTexels)
+{
+    RadientShadowCascadeDesc Desc;
+    Desc.Resolution = 1024;
+
+    RadientShadowCascades Cascades;
+    for (float Offset : {0.f, 0.013f, 0.37f, 5.21f})
+    {
+        ASSERT_TRUE(Cascades.Distribute(Desc, float4x4::Translation(Offset, 0.f, -Offset), MakeCameraProj(), GetLightDirection()));
+        for (Uint32 i = 0; i < Cascades.GetCascadeCount(); ++i)
+        {
+            // The light view transform has no translation, so the projection-space offset of the world origin
+            // is the cascade offset. Snapped cascades move by a whole number of texels.
+            const float4x4& M      = Cascades.GetCascade(i).WorldToLightProjSpace;
+            const float     TexelX = M._41 * static_cast<float>(Desc.Resolution) * 0.5f;
+            const float     TexelY = M._42 * static_cast<float>(Desc.Resolution) * 0.5f;
+            EXPECT_NEAR(TexelX, std::round(TexelX), 1e-2f) << "Cascade " << i << ", offset " << Offset;
+            EXPECT_NEAR(TexelY, std::round(TexelY), 1e-2f) << "Cascade " << i << ", offset " << Offset;
+        }
+    }
+}
+
+TEST(RadientShadowCascadesTest, CascadesFollowCameraViewDirection)
+{
+    // Radient cameras look along -Z
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+
+    const RadientShadowCascade& NearCascade = Cascades.GetCascade(0);
+    const RadientShadowCascade& FarCascade  = Cascades.GetCascade(Cascades.GetCascadeCount() - 1);
+
+    const float NearZ = (NearCascade.StartZ + NearCascade.EndZ) * 0.5f;
+    EXPECT_TRUE(IsInsideCascade(NearCascade, float3{0.f, 0.f, -NearZ}));
+    EXPECT_FALSE(IsInsideCascade(NearCascade, float3{0.f, 0.f, NearZ * 4.f}));
+
+    EXPECT_TRUE(IsInsideCascade(FarCascade, float3{0.f, 0.f, -CameraFarZ * 0.9f}));
+    EXPECT_FALSE(IsInsideCascade(FarCascade, float3{0.f, 0.f, CameraFarZ * 0.9f}));
+
+    // The same result for a camera that looks down the world X axis
+    const float4x4 CameraWorld = float4x4::RotationY(PI_F * 0.5f) * float4x4::Translation(100.f, 0.f, 0.f);
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, CameraWorld, MakeCameraProj(), GetLightDirection()));
+
+    const float3 CameraPos     = float3{CameraWorld._41, CameraWorld._42, CameraWorld._43};
+    const float3 ViewDirection = float3{-CameraWorld._31, -CameraWorld._32, -CameraWorld._33};
+    EXPECT_TRUE(IsInsideCascade(Cascades.GetCascade(Cascades.GetCascadeCount() - 1), CameraPos + ViewDirection * CameraFarZ * 0.9f));
+    EXPECT_FALSE(IsInsideCascade(Cascades.GetCascade(Cascades.GetCascadeCount() - 1), CameraPos - ViewDirection * CameraFarZ * 0.9f));
+}
+
+TEST(RadientShadowCascadesTest, CasterCulling)
+{
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+
+    const RadientShadowCascade& Cascade = Cascades.GetCascade(0);
+    const float3                Center{0.f, 0.f, -(Cascade.StartZ + Cascade.EndZ) * 0.5f};
+
+    RadientBounds Bounds;
+    Bounds.Min = {-0.5f, -0.5f, -0.5f};
+    Bounds.Max = {+0.5f, +0.5f, +0.5f};
+
+    auto IsVisible = [&](const float3& Pos) {
+        return Cascades.IsCasterVisible(0, RadientMath::ToRadientMatrix(float4x4::Translation(Pos.x, Pos.y, Pos.z)), Bounds);
+    };
+
+    EXPECT_TRUE(IsVisible(Center));
+    EXPECT_FALSE(IsVisible(Center + float3{1000.f, 0.f, 0.f}));
+    EXPECT_FALSE(IsVisible(Center + float3{0.f, 0.f, 1000.f}));
+
+    // Casters between the light and the cascade shadow it
+    EXPECT_TRUE(IsVisible(Center - GetLightDirection() * 5000.f));
+    // Casters behind the cascade do not
+    EXPECT_FALSE(IsVisible(Center + GetLightDirection() * 5000.f));
+
+    // Large casters overlapping the cascade are visible even if their center is outside
+    RadientBounds LargeBounds;
+    LargeBounds.Min = {-1000.f, -0.5f, -0.5f};
+    LargeBounds.Max = {+1000.f, +0.5f, +0.5f};
+    EXPECT_TRUE(Cascades.IsCasterVisible(0, RadientMath::ToRadientMatrix(float4x4::Translation(Center.x + 900.f, Center.y, Center.z)), LargeBounds));
+}
+
+TEST(RadientShadowCascadesTest, OrthographicCameraIsNotSupported)
+{
+    RadientShadowCascades Cascades;
+    ASSERT_TRUE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), MakeCameraProj(), GetLightDirection()));
+    ASSERT_GT(Cascades.GetCascadeCount(), 0u);
+
+    EXPECT_FALSE(Cascades.Distribute(RadientShadowCascadeDesc{}, float4x4::Identity(), float4x4::Ortho(10.f, 10.f, 0.1f, 100.f, false), GetLightDirection()));
+    EXPECT_EQ(Cascades.GetCascadeCount(), 0u);
+}
@@ -0,0 +1,288 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "Render/RadientTransientTargetPool.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+RadientTransientTargetDesc MakeDesc(TEXTURE_FORMAT Format, Uint32 Width, Uint32 Height)
+{
+    RadientTransientTargetDesc Desc;
+    Desc.Format = Format;
+    Desc.Width  = Width;
+    Desc.Height = Height;
+    return Desc;
+}
+
+constexpr Uint32 FullWidth  = 1920;
+constexpr Uint32 FullHeight = 1080;
+
+const RadientTransientTargetDesc HDRDesc  = MakeDesc(TEX_FORMAT_RGBA16_FLOAT, FullWidth, FullHeight);
+const RadientTransientTargetDesc HalfDesc = MakeDesc(TEX_FORMAT_RGBA16_FLOAT, FullWidth / 2, FullHeight / 2);
+const RadientTransientTargetDesc AODesc   = MakeDesc(TEX_FORMAT_R8_UNORM, FullWidth, FullHeight);
+
+// Post-processing chain: scene -> SSAO -> SSR -> bloom down/up -> tone mapping
+struct PostProcessGraph
+{
+    Uint32 SceneColor = 0;
+    Uint32 AO         = 0;
+    Uint32 SSR        = 0;
+    Uint32 BloomDown  = 0;
+    Uint32 BloomUp    = 0;
+    Uint32 Composite  = 0;
+};
+
+PostProcessGraph DeclarePostProcessGraph(RadientTransientTargetPool& Pool)
+{
+    const Uint32 Scene     = Pool.AddPass("Scene");
+    const Uint32 SSAO      = Pool.AddPass("SSAO");
+    const Uint32 SSR       = Pool.AddPass("SSR");
+    const Uint32 BloomDown = Pool.AddPass("Bloom downsample");
+    const Uint32 BloomUp   = Pool.AddPass("Bloom upsample");
+    const Uint32 Composite = Pool.AddPass("Composite");
+    const Uint32 ToneMap   = Pool.AddPass("Tone mapping");
+
+    PostProcessGraph Graph;
+    Graph.SceneColor = Pool.DeclareTarget(HDRDesc, "Scene color", Scene, SSR);
+    Graph.AO         = Pool.DeclareTarget(AODesc, "AO", SSAO, SSR);
+    Graph.SSR        = Pool.DeclareTarget(HDRDesc, "SSR", SSR, Composite);
+    Graph.BloomDown  = Pool.DeclareTarget(HalfDesc, "Bloom down", BloomDown, BloomUp);
+    Graph.BloomUp    = Pool.DeclareTarget(HalfDesc, "Bloom up", BloomUp, Composite);
+    Graph.Composite  = Pool.DeclareTarget(HDRDesc, "Composite", Composite, ToneMap);
+    return Graph;
+}
+
+bool Overlap(Uint32 First0, Uint32 Last0, Uint32 First1, Uint32 Last1)
+{
+    return First0 <= Last1 && First1 <= Last0;
+}
+
+} // namespace
+
+TEST(RadientTransientTargetPoolTest, AliasesDisjointLifetimes)
+{
+    RadientTransientTargetPool Pool;
+
+    Pool.BeginFrame();
+    const PostProcessGraph Graph = DeclarePostProcessGraph(Pool);
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+
+    // The scene color ends before the composite starts
+    EXPECT_EQ(Pool.GetPhysicalTarget(Graph.Composite), Pool.GetPhysicalTarget(Graph.SceneColor));
+    // The SSR output overlaps both
+    EXPECT_NE(Pool.GetPhysicalTarget(Graph.SSR), Pool.GetPhysicalTarget(Graph.SceneColor));
+    // Bloom targets overlap in the upsample pass
+    EXPECT_NE(Pool.GetPhysicalTarget(Graph.BloomDown), Pool.GetPhysicalTarget(Graph.BloomUp));
+    // Different formats and sizes never alias
+    EXPECT_NE(Pool.GetPhysicalTarget(Graph.AO), Pool.GetPhysicalTarget(Graph.SceneColor));
+    EXPECT_NE(Pool.GetPhysicalTarget(Graph.BloomDown), Pool.GetPhysicalTarget(Graph.SceneColor));
+
+    const Uint64 HDRSize  = Uint64{FullWidth} * FullHeight * 8;
+    const Uint64 HalfSize = HDRSize / 4;
+    const Uint64 AOSize   = Uint64{FullWidth} * FullHeight;
+
+    const RadientTransientTargetPool::MemoryReport& Report = Pool.GetMemoryReport();
+    EXPECT_EQ(Report.PassCount, 7u);
+    EXPECT_EQ(Report.TargetCount, 6u);
+    EXPECT_EQ(Report.PhysicalTargetCount, 5u);
+    EXPECT_EQ(Report.UnaliasedMemory, HDRSize * 3 + HalfSize * 2 + AOSize);
+    EXPECT_EQ(Report.AllocatedMemory, HDRSize * 2 + HalfSize * 2 + AOSize);
+    // SSR, bloom up and composite targets are alive in the composite pass
+    EXPECT_EQ(Report.PeakMemory, HDRSize * 2 + HalfSize);
+    EXPECT_EQ(Report.PeakPass, 5u);
+    EXPECT_STREQ(Pool.GetPassName(Report.PeakPass), "Composite");
+    EXPECT_LE(Report.PeakMemory, Report.AllocatedMemory);
+}
+
+TEST(RadientTransientTargetPoolTest, SequentialViewsShareTargets)
+{
+    RadientTransientTargetPool Pool;
+
+    Pool.BeginFrame();
+    std::vector<Uint32> SceneColors;
+    for (Uint32 View = 0; View < 4; ++View)
+    {
+        const Uint32 Scene   = Pool.AddPass("Scene");
+        const Uint32 ToneMap = Pool.AddPass("Tone mapping");
+        SceneColors.push_back(Pool.DeclareTarget(HDRDesc, "Scene color", Scene, ToneMap));
+    }
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+
+    for (Uint32 SceneColor : SceneColors)
+        EXPECT_EQ(Pool.GetPhysicalTarget(SceneColor), Pool.GetPhysicalTarget(SceneColors[0]));
+    EXPECT_EQ(Pool.GetMemoryReport().PhysicalTargetCount, 1u);
+    EXPECT_EQ(Pool.GetMemoryReport().UnaliasedMemory, Pool.GetMemoryReport().AllocatedMemory * 4);
+}
+
+TEST(RadientTransientTargetPoolTest, ReuseAcrossFrames)
+{
+    RadientTransientTargetPool Pool;
+
+    Pool.BeginFrame();
+    const PostProcessGraph Graph0 = DeclarePostProcessGraph(Pool);
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+    const Uint32 SlotCount = Pool.GetPhysicalSlotCount();
+
+    // The same graph gets the same physical targets
+    Pool.BeginFrame();
+    const PostProcessGraph Graph1 = DeclarePostProcessGraph(Pool);
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+    EXPECT_EQ(Pool.GetPhysicalSlotCount(), SlotCount);
+    EXPECT_EQ(Pool.GetPhysicalTarget(Graph1.SceneColor), Pool.GetPhysicalTarget(Graph0.SceneColor));
+    EXPECT_EQ(Pool.GetPhysicalTarget(Graph1.SSR), Pool.GetPhysicalTarget(Graph0.SSR));
+    EXPECT_EQ(Pool.GetPhysicalTarget(Graph1.BloomUp), Pool.GetPhysicalTarget(Graph0.BloomUp));
+
+    // A frame without bloom releases the half-resolution targets
+    Pool.BeginFrame();
+    {
+        const Uint32 Scene   = Pool.AddPass("Scene");
+        const Uint32 ToneMap = Pool.AddPass("Tone mapping");
+        Pool.DeclareTarget(HDRDesc, "Scene color", Scene, ToneMap);
+    }
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+    EXPECT_EQ(Pool.GetMemoryReport().PhysicalTargetCount, 1u);
+    EXPECT_EQ(Pool.GetMemoryReport().AllocatedMemory, RadientTransientTargetPool::GetMemorySize(HDRDesc));
+
+    // Released slots are reused rather than added
+    Pool.BeginFrame();
+    DeclarePostProcessGraph(Pool);
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+    EXPECT_EQ(Pool.GetPhysicalSlotCount(), SlotCount);
+}
+
+TEST(RadientTransientTargetPoolTest, InvalidDeclarations)
+{
+    RadientTransientTargetPool Pool;
+
+    Pool.BeginFrame();
+    const Uint32 Pass0 = Pool.AddPass("Pass0");
+    const Uint32 Pass1 = Pool.AddPass("Pass1");
+    EXPECT_EQ(Pool.DeclareTarget(MakeDesc(TEX_FORMAT_UNKNOWN, 16, 16), "Target", Pass0, Pass1), RadientTransientTargetPool::InvalidIndex);
+    EXPECT_EQ(Pool.DeclareTarget(MakeDesc(TEX_FORMAT_RGBA8_UNORM, 0, 16), "Target", Pass0, Pass1), RadientTransientTargetPool::InvalidIndex);
+    EXPECT_EQ(Pool.DeclareTarget(HDRDesc, "Target", Pass1, Pass0), RadientTransientTargetPool::InvalidIndex);
+    EXPECT_EQ(Pool.DeclareTarget(HDRDesc, "Target", Pass0, Pass1 + 1), RadientTransientTargetPool::InvalidIndex);
+    ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+
+    EXPECT_EQ(Pool.GetTargetCount(), 0u);
+    EXPECT_EQ(Pool.GetMemoryReport().AllocatedMemory, 0u);
+    EXPECT_EQ(Pool.GetMemoryReport().PeakPass, RadientTransientTargetPool::InvalidIndex);
+}
+
+TEST(RadientTransientTargetPoolTest, RandomGraphs)
+{
+    const RadientTransientTargetDesc Descs[] = {HDRDesc, HalfDesc, AODesc};
+
+    struct DeclaredTarget
+    {
+        Uint32 Index;
+        Uint32 DescIdx;
+        Uint32 FirstPass;
+        Uint32 LastPass;
+    };
+    std::vector<DeclaredTarget> Targets;
+
+    std::mt19937 Rng{17};
+
+    RadientTransientTargetPool Pool;
+    for (Uint32 Frame = 0; Frame < 50; ++Frame)
+    {
+        Pool.BeginFrame();
+
+        const Uint32 PassCount = 1 + Rng() % 32;
+        for (Uint32 Pass = 0; Pass < PassCount; ++Pass)
+            Pool.AddPass("Pass");
+
+        Targets.clear();
+        const Uint32 TargetCount = Rng() % 48;
+        for (Uint32 i = 0; i < TargetCount; ++i)
+        {
+            DeclaredTarget Target;
+            Target.DescIdx   = Rng() % 3;
+            Target.FirstPass = Rng() % PassCount;
+            Target.LastPass  = Target.FirstPass + Rng() % std::min(PassCount - Target.FirstPass, 4u);
+            Target.Index     = Pool.DeclareTarget(Descs[Target.DescIdx], "Target", Target.FirstPass, Target.LastPass);
+            ASSERT_NE(Target.Index, RadientTransientTargetPool::InvalidIndex);
+            Targets.push_back(Target);
+        }
+        ASSERT_EQ(Pool.Compile(nullptr), RADIENT_STATUS_OK);
+
+        // Targets that are alive at the same time never share a physical target,
+        // and targets with different descriptions never alias
+        for (size_t i = 0; i < Targets.size(); ++i)
+        {
+            for (size_t j = i + 1; j < Targets.size(); ++j)
+            {
+                const DeclaredTarget& T0 = Targets[i];
+                const DeclaredTarget& T1 = Targets[j];
+                if (T0.DescIdx != T1.DescIdx || Overlap(T0.FirstPass, T0.LastPass, T1.FirstPass, T1.LastPass))
+                    EXPECT_NE(Pool.GetPhysicalTarget(T0.Index), Pool.GetPhysicalTarget(T1.Index));
+            }
+        }
+
+        // Every description uses as many physical targets as its targets alive in one pass at most
+        Uint32 MaxAliveCount = 0;
+        for (Uint32 DescIdx = 0; DescIdx < 3; ++DescIdx)
+        {
+            std::vector<Uint32> Physical;
+            for (const DeclaredTarget& Target : Targets)
+            {
+                if (Target.DescIdx == DescIdx)
+                    Physical.push_back(Pool.GetPhysicalTarget(Target.Index));
+            }
+            std::sort(Physical.begin(), Physical.end());
+            const Uint32 PhysicalCount = static_cast<Uint32>(std::unique(Physical.begin(), Physical.end()) - Physical.begin());
+
+            Uint32 AliveCount = 0;
+            for (Uint32 Pass = 0; Pass < PassCount; ++Pass)
+            {
+                Uint32 Count = 0;
+                for (const DeclaredTarget& Target : Targets)
+                {
+                    if (Target.DescIdx == DescIdx && Target.FirstPass <= Pass && Pass <= Target.LastPass)
+                        ++Count;
+                }
+                AliveCount = std::max(AliveCount, Count);
+            }
+            EXPECT_EQ(PhysicalCount, AliveCount);
+            MaxAliveCount += AliveCount;
+        }
+
+        const RadientTransientTargetPool::MemoryReport& Report = Pool.GetMemoryReport();
+        EXPECT_EQ(Report.TargetCount, TargetCount);
+        EXPECT_EQ(Report.PhysicalTargetCount, MaxAliveCount);
+        EXPECT_LE(Report.PeakMemory, Report.AllocatedMemory);
+        EXPECT_LE(Report.AllocatedMemory, Report.UnaliasedMemory);
+    }
+}
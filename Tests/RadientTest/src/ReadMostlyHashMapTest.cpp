@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "gtest/gtest.h"
+
+#include "PBR_Renderer.hpp"
+#include "Utilities/interface/ReadMostlyHashMap.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+using PSOKey = PBR_Renderer::PSOKey;
+
+// Stands in for a pipeline state object
+struct DummyPipeline
+{
+    explicit DummyPipeline(Uint32 _Id) :
+        Id{_Id}
+    {}
+
+    const Uint32 Id;
+};
+
+using DummyPSOMap = ReadMostlyHashMap<PSOKey, std::shared_ptr<DummyPipeline>, PSOKey::Hasher>;
+
+PSOKey MakeKey(Uint32 Idx)
+{
+    // Use few distinct flag combinations, so that many keys only differ in the user value
+    const PBR_Renderer::PSO_FLAGS Flags = static_cast<PBR_Renderer::PSO_FLAGS>(PBR_Renderer::PSO_FLAG_DEFAULT | (Uint64{Idx % 4} << 20));
+    return PSOKey{
+        PBR_Renderer::RenderPassType::Main,
+        Flags,
+        (Idx % 3) == 0 ? ALPHA_MODE_BLEND : ALPHA_MODE_OPAQUE,
+        CULL_MODE_BACK,
+        PBR_Renderer::DebugViewType::None,
+        PBR_Renderer::LoadingAnimationMode::None,
+        Idx,
+    };
+}
+
+TEST(ReadMostlyHashMapTest, InsertAndFind)
+{
+    constexpr Uint32 NumKeys = 1000;
+
+    DummyPSOMap Map;
+    EXPECT_EQ(Map.Size(), 0u);
+    EXPECT_EQ(Map.Find(MakeKey(0)), nullptr);
+
+    for (Uint32 i = 0; i < NumKeys; ++i)
+    {
+        const auto Res = Map.Insert(MakeKey(i), std::make_shared<DummyPipeline>(i));
+        ASSERT_NE(Res.first, nullptr);
+        EXPECT_TRUE(Res.second);
+        EXPECT_EQ((*Res.first)->Id, i);
+    }
+    EXPECT_EQ(Map.Size(), size_t{NumKeys});
+
+    // Values of existing keys are not replaced
+    const auto Res = Map.Insert(MakeKey(7), std::make_shared<DummyPipeline>(12345));
+    EXPECT_FALSE(Res.second);
+    EXPECT_EQ((*Res.first)->Id, 7u);
+    EXPECT_EQ(Map.Size(), size_t{NumKeys});
+
+    // Values keep their addresses when the table grows
+    const std::shared_ptr<DummyPipeline>* pFirst = Map.Find(MakeKey(0));
+    for (Uint32 i = 0; i < NumKeys; ++i)
+    {
+        const std::shared_ptr<DummyPipeline>* pValue = Map.Find(MakeKey(i));
+        ASSERT_NE(pValue, nullptr);
+        EXPECT_EQ((*pValue)->Id, i);
+    }
+    EXPECT_EQ(Map.Find(MakeKey(0)), pFirst);
+    EXPECT_EQ(Map.Find(MakeKey(NumKeys)), nullptr);
+
+    Uint32 NextId = 0;
+    Map.ProcessEntries([&](const PSOKey& Key, const std::shared_ptr<DummyPipeline>& pPipeline) {
+        EXPECT_TRUE(Key == MakeKey(NextId));
+        EXPECT_EQ(pPipeline->Id, NextId);
+        ++NextId;
+    });
+    EXPECT_EQ(NextId, NumKeys);
+}
+
+// Many threads look up pipelines while a few threads create them, the way render threads record
+// draw commands while new permutations are compiled.
+TEST(ReadMostlyHashMapTest, ConcurrentAccess)
+{
+    constexpr Uint32 NumKeys          = 4096;
+    constexpr Uint32 NumWriterThreads = 2;
+    constexpr Uint32 NumReaderThreads = 6;
+
+    std::vector<PSOKey> Keys;
+    Keys.reserve(NumKeys);
+    for (Uint32 i = 0; i < NumKeys; ++i)
+        Keys.push_back(MakeKey(i));
+
+    DummyPSOMap Map;
+
+    std::atomic<Uint32> NumInserted{0};
+    std::atomic<Uint32> NumErrors{0};
+    std::atomic<bool>   WritersDone{false};
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumWriterThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            // Writers insert all keys in different orders, so that they also race on the same keys
+            for (Uint32 i = 0; i < NumKeys; ++i)
+            {
+                const Uint32 Idx = t % 2 == 0 ? i : NumKeys - 1 - i;
+                const auto   Res = Map.Insert(Keys[Idx], std::make_shared<DummyPipeline>(Idx));
+                if (Res.first == nullptr || (*Res.first)->Id != Idx)
+                    NumErrors.fetch_add(1);
+                if (Res.second)
+                    NumInserted.fetch_add(1);
+            }
+        });
+    }
+
+    std::atomic<Uint64> NumHits{0};
+    for (Uint32 t = 0; t < NumReaderThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            Uint64 Hits   = 0;
+            Uint32 Idx    = t * 977;
+            bool   IsLast = false;
+            while (!IsLast)
+            {
+                // Make one more pass after the writers are done to check that all keys are visible
+                IsLast = WritersDone.load();
+                for (Uint32 i = 0; i < NumKeys; ++i)
+                {
+                    Idx = (Idx + 7919) % NumKeys;
+
+                    const std::shared_ptr<DummyPipeline>* pValue = Map.Find(Keys[Idx]);
+                    if (pValue != nullptr)
+                    {
+                        ++Hits;
+                        if (!*pValue || (*pValue)->Id != Idx)
+                            NumErrors.fetch_add(1);
+                    }
+                    else if (IsLast)
+                    {
+                        NumErrors.fetch_add(1);
+                    }
+                }
+            }
+            NumHits.fetch_add(Hits);
+        });
+    }
+
+    for (Uint32 t = 0; t < NumWriterThreads; ++t)
+        Threads[t].join();
+    WritersDone.store(true);
+    for (Uint32 t = NumWriterThreads; t < Threads.size(); ++t)
+        Threads[t].join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    EXPECT_EQ(NumInserted.load(), NumKeys);
+    EXPECT_EQ(Map.Size(), size_t{NumKeys});
+    EXPECT_GE(NumHits.load(), Uint64{NumKeys} * NumReaderThreads);
+}
+
+} // namespace
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+#include "Utilities/interface/DiligentFXShaderSourceStreamFactory.hpp"
+#include "Utilities/interface/ShaderSourceBundle.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::string Decompress(const std::vector<Uint8>& Data, size_t Size)
+{
+    std::string Result(Size, '\0');
+    if (!ShaderSourceBundle::Decompress(Data.data(), Data.size(), &Result[0], Result.size()))
+        return "<error>";
+    return Result;
+}
+
+TEST(ShaderSourceBundleTest, Decompress)
+{
+    // 3 literals "abc" followed by an overlapping match of 9 bytes at offset 3, then the final literal "!"
+    const std::vector<Uint8> Data = {0x35, 'a', 'b', 'c', 0x03, 0x00, 0x10, '!'};
+    EXPECT_EQ(Decompress(Data, 13), "abcabcabcabc!");
+
+    // Extended lengths: 15 + 245 = 260 literals followed by a match of 4 + 15 + 255 + 255 + 81 = 610 bytes at offset 26
+    std::vector<Uint8> LongData = {0xFF, 245};
+    for (size_t i = 0; i < 260; ++i)
+        LongData.push_back(static_cast<Uint8>('a' + i % 26));
+    LongData.insert(LongData.end(), {26, 0, 255, 255, 81});
+    const std::string LongResult = Decompress(LongData, 870);
+    ASSERT_EQ(LongResult.size(), 870u);
+    for (size_t i = 0; i < LongResult.size(); ++i)
+    {
+        if (LongResult[i] != static_cast<char>('a' + i % 26))
+        {
+            ADD_FAILURE() << "Mismatch at " << i;
+            break;
+        }
+    }
+
+    // Empty file
+    EXPECT_EQ(Decompress({0x00}, 0), "");
+
+    // Invalid data
+    EXPECT_EQ(Decompress(Data, 12), "<error>");                                         // Output size mismatch
+    EXPECT_EQ(Decompress(Data, 14), "<error>");                                         // Output size mismatch
+    EXPECT_EQ(Decompress({0x35, 'a', 'b', 'c', 0x04, 0x00, 0x10, '!'}, 13), "<error>"); // Offset before the start
+    EXPECT_EQ(Decompress({0x35, 'a', 'b', 'c', 0x00, 0x00, 0x10, '!'}, 13), "<error>"); // Zero offset
+    EXPECT_EQ(Decompress({0x35, 'a', 'b', 'c', 0x03}, 13), "<error>");                  // Truncated offset
+    EXPECT_EQ(Decompress({0x50, 'a', 'b'}, 5), "<error>");                              // Truncated literals
+    EXPECT_EQ(Decompress({0xF0}, 15), "<error>");                                       // Truncated length
+}
+
+TEST(ShaderSourceBundleTest, FindFiles)
+{
+    const std::string Sources[] = {"float A;", "float B;", "float C;"};
+
+    // Every file is stored as a single literal run
+    std::vector<Uint8>  Data;
+    std::vector<Uint32> Offsets;
+    for (const std::string& Source : Sources)
+    {
+        Offsets.push_back(static_cast<Uint32>(Data.size()));
+        Data.push_back(static_cast<Uint8>(Source.size() << 4));
+        Data.insert(Data.end(), Source.begin(), Source.end());
+    }
+
+    const auto GetInfo = [&](const char* Name, Uint32 Idx) {
+        return ShaderSourceBundle::FileInfo{
+            Name,
+            Offsets[Idx],
+            static_cast<Uint32>(Sources[Idx].size() + 1),
+            static_cast<Uint32>(Sources[Idx].size()),
+            ShaderSourceBundle::ComputeHash(Sources[Idx].data(), Sources[Idx].size()),
+        };
+    };
+
+    std::vector<ShaderSourceBundle::FileInfo> Files = {
+        GetInfo("A.fxh", 0),
+        GetInfo("B.fxh", 1),
+        GetInfo("C.psh", 2),
+    };
+    // Wrong hash
+    Files.push_back(GetInfo("D.psh", 2));
+    Files.back().Hash ^= 1;
+
+    ShaderSourceBundle Bundle{Files.data(), static_cast<Uint32>(Files.size()), Data.data(), Data.size()};
+    EXPECT_EQ(Bundle.GetFileCount(), 4u);
+    EXPECT_EQ(Bundle.GetCompressedSize(), Data.size());
+    EXPECT_EQ(Bundle.GetUncompressedSize(), Sources[0].size() + Sources[1].size() + Sources[2].size() * 2);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const std::string* pSource = Bundle.GetSource(Files[i].Name);
+        ASSERT_NE(pSource, nullptr);
+        EXPECT_EQ(*pSource, Sources[i]);
+        // Decompressed sources are cached
+        EXPECT_EQ(Bundle.GetSource(Files[i].Name), pSource);
+    }
+
+    EXPECT_EQ(Bundle.FindFile("0.fxh"), nullptr);
+    EXPECT_EQ(Bundle.FindFile("B.fx"), nullptr);
+    EXPECT_EQ(Bundle.FindFile("Z.fxh"), nullptr);
+    EXPECT_EQ(Bundle.GetSource("Z.fxh"), nullptr);
+    EXPECT_EQ(Bundle.FindFile(nullptr), nullptr);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Data of shader file 'D.psh' in the shader bundle are corrupted"};
+        EXPECT_EQ(Bundle.GetSource("D.psh"), nullptr);
+    }
+}
+
+// Verifies that every file of the DiligentFX bundle can be found and decompressed, and that
+// the bundle is smaller than the raw sources.
+TEST(ShaderSourceBundleTest, DiligentFXShaders)
+{
+    ShaderSourceBundle* pBundle = DiligentFXShaderSourceStreamFactory::GetBundle();
+    if (pBundle == nullptr)
+    {
+        GTEST_SKIP() << "DiligentFX shaders are embedded as raw strings";
+    }
+
+    ASSERT_GT(pBundle->GetFileCount(), 0u);
+    EXPECT_LT(pBundle->GetCompressedSize(), pBundle->GetUncompressedSize());
+
+    IShaderSourceInputStreamFactory& Factory = DiligentFXShaderSourceStreamFactory::GetInstance();
+    for (Uint32 i = 0; i < pBundle->GetFileCount(); ++i)
+    {
+        const ShaderSourceBundle::FileInfo& Info = pBundle->GetFileInfo(i);
+        EXPECT_EQ(pBundle->FindFile(Info.Name), &Info);
+
+        const std::string* pSource = pBundle->GetSource(Info.Name);
+        ASSERT_NE(pSource, nullptr) << Info.Name;
+        EXPECT_EQ(pSource->size(), Info.Size) << Info.Name;
+        EXPECT_EQ(ShaderSourceBundle::ComputeHash(pSource->data(), pSource->size()), Info.Hash) << Info.Name;
+
+        RefCntAutoPtr<IFileStream> pStream;
+        Factory.CreateInputStream(Info.Name, &pStream);
+        ASSERT_NE(pStream, nullptr) << Info.Name;
+        EXPECT_EQ(pStream->GetSize(), pSource->size()) << Info.Name;
+    }
+
+    RefCntAutoPtr<IFileStream> pStream;
+    Factory.CreateInputStream2("NonExistentFile.fxh", CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    EXPECT_EQ(pStream, nullptr);
+}
+
+} // namespace
@@ -27,9 +27,13 @@
 
 #pragma once
 
+#include <memory>
+
 #include "Shader.h"
 #include "RefCntAutoPtr.hpp"
 
+#include "ShaderSourceBundle.hpp"
+
 namespace Diligent
 {
 
@@ -38,9 +42,16 @@ class DiligentFXShaderSourceStreamFactory final
 public:
     static IShaderSourceInputStreamFactory& GetInstance();
 
+    /// Returns the compressed shader bundle, or null if the shaders are embedded as raw strings
+    /// (DILIGENT_FX_COMPRESS_SHADERS CMake option is disabled).
+    static ShaderSourceBundle* GetBundle();
+
 private:
     DiligentFXShaderSourceStreamFactory();
 
+    static DiligentFXShaderSourceStreamFactory& GetFactory();
+
+    std::unique_ptr<ShaderSourceBundle>            m_pBundle;
     RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
 };
 
@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2019-2023 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "../../../DiligentCore/Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Hash map optimized for concurrent lookups of values that are rarely inserted and never removed,
+/// such as pipeline states.
+///
+/// Lookups are lock-free and may run concurrently with insertions from other threads.
+/// Insertions are serialized with a mutex.
+///
+/// Values are stored in separately allocated entries that are never moved, and the entries are referenced
+/// by an open-addressing table of atomic pointers. A new entry is fully constructed before it is published
+/// in the table. When the table needs to grow, a new table is built and published, and the old one is
+/// retired, but kept alive until the map is destroyed, since readers may still access it. Tables grow
+/// geometrically, so retired tables never take more memory than the current table.
+template <typename KeyType, typename ValueType, typename HasherType = std::hash<KeyType>>
+class ReadMostlyHashMap
+{
+public:
+    ReadMostlyHashMap()
+    {
+        m_Tables.emplace_back(std::make_unique<Table>(InitialLog2Capacity));
+        m_pTable.store(m_Tables.back().get(), std::memory_order_relaxed);
+    }
+
+    // clang-format off
+    ReadMostlyHashMap           (const ReadMostlyHashMap&) = delete;
+    ReadMostlyHashMap           (ReadMostlyHashMap&&)      = delete;
+    ReadMostlyHashMap& operator=(const ReadMostlyHashMap&) = delete;
+    ReadMostlyHashMap& operator=(ReadMostlyHashMap&&)      = delete;
+    // clang-format on
+
+    /// Returns a pointer to the value of the key, or null if the key is not in the map.
+    ///
+    /// \remarks    The method is lock-free. The returned pointer stays valid until the map is destroyed.
+    ///             The value must not be modified while other threads may access it.
+    ValueType* Find(const KeyType& Key) noexcept
+    {
+        Entry* pEntry = FindEntry(Key);
+        return pEntry != nullptr ? &pEntry->Value : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const noexcept
+    {
+        const Entry* pEntry = FindEntry(Key);
+        return pEntry != nullptr ? &pEntry->Value : nullptr;
+    }
+
+    /// Inserts the value if the key is not in the map.
+    ///
+    /// \return     A pair of the pointer to the value of the key and a flag indicating whether the value was inserted.
+    std::pair<ValueType*, bool> Insert(const KeyType& Key, ValueType Value)
+    {
+        std::lock_guard<std::mutex> Lock{m_InsertMtx};
+
+        if (Entry* pEntry = FindEntry(Key))
+            return {&pEntry->Value, false};
+
+        Table* pTable = m_pTable.load(std::memory_order_relaxed);
+        // Keep the load factor at or below 1/2 to keep probe sequences short
+        if ((m_Entries.size() + 1) * 2 > pTable->Mask + 1)
+        {
+            m_Tables.emplace_back(std::make_unique<Table>(pTable->Log2Capacity + 1));
+            pTable = m_Tables.back().get();
+            // The new table is not visible to readers until it is published below
+            for (const std::unique_ptr<Entry>& pEntry : m_Entries)
+                InsertEntry(*pTable, pEntry.get(), std::memory_order_relaxed);
+            m_pTable.store(pTable, std::memory_order_release);
+        }
+
+        m_Entries.emplace_back(std::unique_ptr<Entry>{new Entry{Key, std::move(Value)}});
+        // The entry is fully constructed before it is published
+        InsertEntry(*pTable, m_Entries.back().get(), std::memory_order_release);
+
+        return {&m_Entries.back()->Value, true};
+    }
+
+    /// Returns the number of values in the map.
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> Lock{m_InsertMtx};
+        return m_Entries.size();
+    }
+
+    /// Calls the handler for every key and value in the order of insertion.
+    ///
+    /// \remarks    The handler must not insert values into the map.
+    template <typename HandlerType>
+    void ProcessEntries(HandlerType&& Handler) const
+    {
+        std::lock_guard<std::mutex> Lock{m_InsertMtx};
+        for (const std::unique_ptr<Entry>& pEntry : m_Entries)
+        {
+            const Entry& E = *pEntry;
+            Handler(E.Key, E.Value);
+        }
+    }
+
+private:
+    static constexpr Uint32 InitialLog2Capacity = 4;
+
+    struct Entry
+    {
+        const KeyType Key;
+        ValueType     Value;
+    };
+
+    struct Table
+    {
+        const Uint32 Log2Capacity;
+        const size_t Mask;
+
+        std::unique_ptr<std::atomic<Entry*>[]> Slots;
+
+        explicit Table(Uint32 _Log2Capacity) :
+            Log2Capacity{_Log2Capacity},
+            Mask{(size_t{1} << _Log2Capacity) - 1},
+            Slots{new std::atomic<Entry*>[size_t{1} << _Log2Capacity]}
+        {
+            for (size_t i = 0; i <= Mask; ++i)
+                Slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        size_t GetStartIndex(size_t Hash) const noexcept
+        {
+            // Fibonacci hashing spreads keys with poorly distributed low bits
+            return static_cast<size_t>((static_cast<Uint64>(Hash) * 0x9E3779B97F4A7C15ull) >> (64 - Log2Capacity));
+        }
+    };
+
+    Entry* FindEntry(const KeyType& Key) const noexcept
+    {
+        const Table* pTable = m_pTable.load(std::memory_order_acquire);
+        for (size_t Idx = pTable->GetStartIndex(m_Hasher(Key));; Idx = (Idx + 1) & pTable->Mask)
+        {
+            Entry* pEntry = pTable->Slots[Idx].load(std::memory_order_acquire);
+            // The load factor is at most 1/2, so there is always an empty slot
+            if (pEntry == nullptr || pEntry->Key == Key)
+                return pEntry;
+        }
+    }
+
+    void InsertEntry(Table& Tbl, Entry* pEntry, std::memory_order Order) const
+    {
+        size_t Idx = Tbl.GetStartIndex(m_Hasher(pEntry->Key));
+        while (Tbl.Slots[Idx].load(std::memory_order_relaxed) != nullptr)
+            Idx = (Idx + 1) & Tbl.Mask;
+        Tbl.Slots[Idx].store(pEntry, Order);
+    }
+
+private:
+    HasherType m_Hasher;
+
+    std::atomic<Table*> m_pTable{nullptr};
+
+    mutable std::mutex m_InsertMtx;
+
+    // All tables including the retired ones
+    std::vector<std::unique_ptr<Table>> m_Tables;
+
+    std::vector<std::unique_ptr<Entry>> m_Entries;
+};
+
+} // namespace Diligent
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2019-2023 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Read-only bundle of compressed shader files.
+///
+/// The bundle is generated at build time by BuildTools/ShaderBundle/pack_shaders.py.
+/// Every file is compressed independently and is decompressed on first access.
+/// Decompressed files are kept until the bundle is destroyed.
+class ShaderSourceBundle
+{
+public:
+    /// Bundle index entry.
+    struct FileInfo
+    {
+        /// File name. Entries must be sorted by name.
+        const char* Name = nullptr;
+
+        /// Offset of the compressed data in the bundle.
+        Uint32 Offset = 0;
+
+        /// Compressed data size.
+        Uint32 CompressedSize = 0;
+
+        /// Uncompressed file size.
+        Uint32 Size = 0;
+
+        /// Hash of the uncompressed file, see ComputeHash().
+        Uint32 Hash = 0;
+    };
+
+    ShaderSourceBundle(const FileInfo* pFiles,
+                       Uint32          NumFiles,
+                       const Uint8*    pData,
+                       size_t          DataSize);
+
+    /// Returns the index entry of the file, or null if the file is not in the bundle.
+    const FileInfo* FindFile(const char* Name) const;
+
+    /// Returns the contents of the file, or null if the file is not in the bundle or its data are corrupted.
+    ///
+    /// \remarks    The method is thread-safe. The returned string stays valid until the bundle is destroyed.
+    const std::string* GetSource(const char* Name);
+
+    Uint32          GetFileCount() const { return m_NumFiles; }
+    const FileInfo& GetFileInfo(Uint32 Index) const { return m_pFiles[Index]; }
+
+    /// Returns the total size of the compressed data.
+    size_t GetCompressedSize() const { return m_DataSize; }
+
+    /// Returns the total size of all files.
+    size_t GetUncompressedSize() const;
+
+    /// Decompresses the data of one file.
+    ///
+    /// \return     true if the data are valid and decompress to exactly DstSize bytes.
+    static bool Decompress(const Uint8* pSrc, size_t SrcSize, char* pDst, size_t DstSize);
+
+    /// FNV-1a hash of the data.
+    static Uint32 ComputeHash(const char* pData, size_t Size);
+
+private:
+    const FileInfo* const m_pFiles;
+    const Uint32          m_NumFiles;
+    const Uint8* const    m_pData;
+    const size_t          m_DataSize;
+
+    std::mutex                                m_SourcesMtx;
+    std::vector<std::unique_ptr<std::string>> m_Sources;
+};
+
+} // namespace Diligent
@@ -26,12 +26,80 @@
  */
 
 #include "../interface/DiligentFXShaderSourceStreamFactory.hpp"
-#include "ShaderSourceFactoryUtils.h"
+
+#if DILIGENT_FX_SHADER_BUNDLE
+#    include "ObjectBase.hpp"
+#    include "MemoryFileStream.hpp"
+#    include "ProxyDataBlob.hpp"
+#else
+#    include "ShaderSourceFactoryUtils.h"
+#endif
 
 namespace Diligent
 {
 
-#include "shaders_list.h"
+#if DILIGENT_FX_SHADER_BUNDLE
+
+#    include "shaders_bundle.h"
+
+namespace
+{
+
+class ShaderSourceBundleFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    ShaderSourceBundleFactory(IReferenceCounters* pRefCounters, ShaderSourceBundle& Bundle) :
+        TBase{pRefCounters},
+        m_Bundle{Bundle}
+    {
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        DEV_CHECK_ERR(ppStream != nullptr, "ppStream must not be null");
+        *ppStream = nullptr;
+
+        const std::string* pSource = m_Bundle.GetSource(Name);
+        if (pSource == nullptr)
+        {
+            if ((Flags & CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT) == 0)
+                LOG_ERROR_MESSAGE("Failed to create input stream for source file ", Name);
+            return;
+        }
+
+        // Decompressed sources are kept by the bundle, so the stream can reference them directly
+        RefCntAutoPtr<IDataBlob>   pData = ProxyDataBlob::Create(pSource->data(), pSource->size());
+        RefCntAutoPtr<IFileStream> pStream{MakeNewRCObj<MemoryFileStream>()(pData)};
+        *ppStream = pStream.Detach();
+    }
+
+private:
+    ShaderSourceBundle& m_Bundle;
+};
+
+} // namespace
+
+DiligentFXShaderSourceStreamFactory::DiligentFXShaderSourceStreamFactory() :
+    m_pBundle{std::make_unique<ShaderSourceBundle>(g_ShaderBundleFiles, static_cast<Uint32>(_countof(g_ShaderBundleFiles)),
+                                                   g_ShaderBundleData, sizeof(g_ShaderBundleData))},
+    m_pFactory{MakeNewRCObj<ShaderSourceBundleFactory>()(*m_pBundle)}
+{
+}
+
+#else
+
+#    include "shaders_list.h"
 
 DiligentFXShaderSourceStreamFactory::DiligentFXShaderSourceStreamFactory()
 {
@@ -40,10 +108,22 @@ DiligentFXShaderSourceStreamFactory::DiligentFXShaderSourceStreamFactory()
     CreateMemoryShaderSourceFactory(CI, &m_pFactory);
 }
 
-IShaderSourceInputStreamFactory& DiligentFXShaderSourceStreamFactory::GetInstance()
+#endif
+
+DiligentFXShaderSourceStreamFactory& DiligentFXShaderSourceStreamFactory::GetFactory()
 {
     static DiligentFXShaderSourceStreamFactory TheFactory;
-    return *TheFactory.m_pFactory;
+    return TheFactory;
+}
+
+IShaderSourceInputStreamFactory& DiligentFXShaderSourceStreamFactory::GetInstance()
+{
+    return *GetFactory().m_pFactory;
+}
+
+ShaderSourceBundle* DiligentFXShaderSourceStreamFactory::GetBundle()
+{
+    return GetFactory().m_pBundle.get();
 }
 
 } // namespace Diligent
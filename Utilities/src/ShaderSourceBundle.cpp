@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2019-2023 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../interface/ShaderSourceBundle.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Must match pack_shaders.py
+constexpr size_t MinMatchLength = 4;
+
+// Reads the extended part of the length. Lengths of 15 and more are followed by bytes that are
+// added to the length until a byte other than 255 is found.
+bool ReadLength(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Length)
+{
+    if (Length != 15)
+        return true;
+
+    Uint8 Byte = 0;
+    do
+    {
+        if (pSrc == pSrcEnd)
+            return false;
+        Byte = *pSrc++;
+        Length += Byte;
+    } while (Byte == 255);
+
+    return true;
+}
+
+} // namespace
+
+ShaderSourceBundle::ShaderSourceBundle(const FileInfo* pFiles,
+                                       Uint32          NumFiles,
+                                       const Uint8*    pData,
+                                       size_t          DataSize) :
+    m_pFiles{pFiles},
+    m_NumFiles{NumFiles},
+    m_pData{pData},
+    m_DataSize{DataSize},
+    m_Sources(NumFiles)
+{
+#ifdef DILIGENT_DEBUG
+    for (Uint32 i = 1; i < m_NumFiles; ++i)
+        VERIFY(strcmp(m_pFiles[i - 1].Name, m_pFiles[i].Name) < 0, "Shader bundle files must be sorted by name");
+#endif
+}
+
+const ShaderSourceBundle::FileInfo* ShaderSourceBundle::FindFile(const char* Name) const
+{
+    if (Name == nullptr)
+        return nullptr;
+
+    const FileInfo* pEnd = m_pFiles + m_NumFiles;
+    const FileInfo* it   = std::lower_bound(m_pFiles, pEnd, Name, [](const FileInfo& Info, const char* Str) {
+        return strcmp(Info.Name, Str) < 0;
+    });
+    return (it != pEnd && strcmp(it->Name, Name) == 0) ? it : nullptr;
+}
+
+const std::string* ShaderSourceBundle::GetSource(const char* Name)
+{
+    const FileInfo* pInfo = FindFile(Name);
+    if (pInfo == nullptr)
+        return nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_SourcesMtx};
+
+    std::unique_ptr<std::string>& pSource = m_Sources[pInfo - m_pFiles];
+    if (!pSource)
+    {
+        auto Source = std::make_unique<std::string>(pInfo->Size, '\0');
+
+        const bool IsValid =
+            static_cast<size_t>(pInfo->Offset) + pInfo->CompressedSize <= m_DataSize &&
+            Decompress(m_pData + pInfo->Offset, pInfo->CompressedSize, &(*Source)[0], Source->size()) &&
+            ComputeHash(Source->data(), Source->size()) == pInfo->Hash;
+        if (!IsValid)
+        {
+            LOG_ERROR_MESSAGE("Data of shader file '", Name, "' in the shader bundle are corrupted");
+            return nullptr;
+        }
+
+        pSource = std::move(Source);
+    }
+
+    return pSource.get();
+}
+
+size_t ShaderSourceBundle::GetUncompressedSize() const
+{
+    size_t Size = 0;
+    for (Uint32 i = 0; i < m_NumFiles; ++i)
+        Size += m_pFiles[i].Size;
+    return Size;
+}
+
+// The data is a series of sequences. Every sequence starts with a token whose high four bits are the
+// number of literals and low four bits are the match length minus MinMatchLength. The token is followed
+// by the literals, the 16-bit match offset and the extended match length. The last sequence has no match.
+bool ShaderSourceBundle::Decompress(const Uint8* pSrc, size_t SrcSize, char* pDst, size_t DstSize)
+{
+    const Uint8* const pSrcEnd = pSrc + SrcSize;
+
+    size_t DstPos = 0;
+    while (pSrc < pSrcEnd)
+    {
+        const Uint8 Token = *pSrc++;
+
+        size_t LiteralLength = Token >> 4;
+        if (!ReadLength(pSrc, pSrcEnd, LiteralLength))
+            return false;
+        if (LiteralLength > static_cast<size_t>(pSrcEnd - pSrc) || LiteralLength > DstSize - DstPos)
+            return false;
+        memcpy(pDst + DstPos, pSrc, LiteralLength);
+        pSrc += LiteralLength;
+        DstPos += LiteralLength;
+
+        if (pSrc == pSrcEnd)
+            break;
+
+        if (pSrcEnd - pSrc < 2)
+            return false;
+        const size_t Offset = static_cast<size_t>(pSrc[0]) | (static_cast<size_t>(pSrc[1]) << 8);
+        pSrc += 2;
+
+        size_t MatchLength = Token & 0xF;
+        if (!ReadLength(pSrc, pSrcEnd, MatchLength))
+            return false;
+        MatchLength += MinMatchLength;
+        if (Offset == 0 || Offset > DstPos || MatchLength > DstSize - DstPos)
+            return false;
+
+        // The match may overlap the bytes it produces, so copy byte by byte
+        const char* pMatch = pDst + DstPos - Offset;
+        for (size_t i = 0; i < MatchLength; ++i)
+            pDst[DstPos + i] = pMatch[i];
+        DstPos += MatchLength;
+    }
+
+    return DstPos == DstSize;
+}
+
+Uint32 ShaderSourceBundle::ComputeHash(const char* pData, size_t Size)
+{
+    Uint32 Hash = 2166136261u;
+    for (size_t i = 0; i < Size; ++i)
+    {
+        Hash ^= static_cast<Uint8>(pData[i]);
+        Hash *= 16777619u;
+    }
+    return Hash;
+}
+
+} // namespace Diligent